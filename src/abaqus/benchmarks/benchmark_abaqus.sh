@@ -0,0 +1,142 @@
+# Make bash script more like high-level languages.
+set -Eeuo pipefail
+
+# Get this script's file name and location
+script=`basename "$0"`
+script_dir=$(cd "$(dirname "$0")" && pwd)
+
+# Default sweep
+elements="1 10 100 1000 10000 100000"
+particles="1 8 64"
+cpus="1 2 4 8"
+modes="cpus threads"
+
+usage(){
+    echo "${script} USAGE:"
+    echo "./${script} [-e ELEMENTS] [-p PARTICLES] [-c CPUS] [-m MODES] ABAQUS_PROGRAM USER_SUBROUTINE OUTPUT_FILE"
+    echo "  REQUIRED POSITIONAL ARGUMENTS:"
+    echo "    ABAQUS_PROGRAM: abaqus executable on PATH or absolute path"
+    echo "    USER_SUBROUTINE: user subroutine file path, absolute or relative to the working directory"
+    echo "    OUTPUT_FILE: comma separated values file of the results, one row per analysis"
+    echo "  OPTIONAL ARGUMENTS:"
+    echo "    -e ELEMENTS: quoted list of the numbers of elements of the generated meshes. Default: '${elements}'"
+    echo "    -p PARTICLES: quoted list of the numbers of particles written to PROPS. Default: '${particles}'"
+    echo "    -c CPUS: quoted list of the numbers of cpus. Default: '${cpus}'"
+    echo "    -m MODES: quoted list of the parallel modes, 'cpus' (-mp_mode mpi) and/or 'threads'. Default: '${modes}'"
+}
+
+# Parse arguments
+while getopts "e:p:c:m:h" option; do
+    case ${option} in
+        e) elements=${OPTARG};;
+        p) particles=${OPTARG};;
+        c) cpus=${OPTARG};;
+        m) modes=${OPTARG};;
+        *) usage; exit 1;;
+    esac
+done
+shift $((OPTIND - 1))
+if [ "$#" -ne 3 ]; then
+    usage
+    exit 1
+fi
+abaqus_program=$1
+user=$(realpath "$2")
+output=$3
+
+# Verify abaqus path
+if [ ! "$(command -v ${abaqus_program})" ]; then
+    echo "Command '${abaqus_program}' not found."
+    exit 2
+fi
+
+# Verify user subroutine file
+if [ ! -f "${user}" ]; then
+    echo "user file ${user} not found"
+    exit 4
+fi
+
+# Verify the parallel modes
+for mode in ${modes}; do
+    if [ "${mode}" != "cpus" ] && [ "${mode}" != "threads" ]; then
+        echo "Unknown parallel mode '${mode}'. Expected 'cpus' or 'threads'."
+        exit 5
+    fi
+done
+
+# The peak resident set size of the analysis and its children is recorded with GNU time when it is available
+time_program=""
+if [ -x /usr/bin/time ] && /usr/bin/time -v true > /dev/null 2>&1; then
+    time_program="/usr/bin/time -v -o"
+else
+    echo "GNU time not found. The peak resident set size will not be recorded."
+fi
+
+echo "elements,nx,ny,nz,particles,mode,cpus,integration_points,increments,wall_time_s,wall_time_per_increment_s,umat_calls,umat_time_per_call_s,peak_rss_kb,status" > ${output}
+
+for num_elements in ${elements}; do
+    for num_particles in ${particles}; do
+
+        job="benchmark_c3d8_${num_elements}_${num_particles}"
+        bash ${script_dir}/generate_c3d8_block.sh ${num_elements} ${num_particles} ${job}.inp
+        read nx ny nz <<< $(sed -n 's/^Block of \([0-9]*\) x \([0-9]*\) x \([0-9]*\) .*/\1 \2 \3/p' ${job}.inp)
+
+        for mode in ${modes}; do
+            for num_cpus in ${cpus}; do
+
+                run="${job}_${mode}_${num_cpus}"
+                # Clean up any abaqus output files in local directory
+                rm -f ${run}.{com,dat,log,msg,odb,prt,sim,sta,time}
+                cp ${job}.inp ${run}.inp
+                if [ "${mode}" == "cpus" ]; then
+                    parallel_options="-cpus ${num_cpus} -mp_mode mpi"
+                else
+                    parallel_options="-cpus ${num_cpus} -mp_mode threads"
+                fi
+
+                # Run abaqus against the input file and redirect interactive output to log file
+                # Use interactive to avoid sleep and wait statements
+                set +e
+                start=$(date +%s.%N)
+                if [ -n "${time_program}" ]; then
+                    ${time_program} ${run}.time ${abaqus_program} -job ${run} -user ${user} ${parallel_options} -interactive >> ${run}.log 2>&1
+                else
+                    ${abaqus_program} -job ${run} -user ${user} ${parallel_options} -interactive >> ${run}.log 2>&1
+                fi
+                end=$(date +%s.%N)
+                if grep -q "COMPLETED SUCCESSFULLY" ${run}.sta 2> /dev/null; then
+                    status="completed"
+                else
+                    status="failed"
+                fi
+                set -e
+
+                # Converged increments are the rows of the status file whose increment number is numeric. Cutback
+                # attempts are flagged with a trailing U and are not counted.
+                increments=$(awk '$1 ~ /^[0-9]+$/ && $2 ~ /^[0-9]+$/ && $3 ~ /^[0-9]+$/ && NF >= 9 { n++ } END { print n + 0 }' ${run}.sta 2> /dev/null || echo 0)
+                # The umat calls and times are only written to the log when the UMAT is built with ASP_INSTRUMENTATION.
+                # Every process of an MPI analysis writes its own counters.
+                read umat_calls umat_seconds <<< $(awk '/^  abaqus umat:/ { calls += $3; seconds += $5; found = 1 }
+                                                        END { if ( found ){ print calls, seconds } else { print "NA NA" } }' ${run}.log)
+                peak_rss="NA"
+                if [ -f ${run}.time ]; then
+                    peak_rss=$(awk -F': ' '/Maximum resident set size/ { print $2 }' ${run}.time)
+                fi
+
+                awk -v elements=${num_elements} -v nx=${nx} -v ny=${ny} -v nz=${nz} -v particles=${num_particles} \
+                    -v mode=${mode} -v cpus=${num_cpus} -v increments=${increments} -v start=${start} -v end=${end} \
+                    -v umat_calls=${umat_calls} -v umat_seconds=${umat_seconds} -v peak_rss=${peak_rss} -v status=${status} '
+                    BEGIN{
+                        wall = end - start
+                        per_increment = ( increments > 0 ) ? sprintf( "%.6g", wall / increments ) : "NA"
+                        per_call = ( umat_calls != "NA" && umat_calls > 0 ) ? sprintf( "%.6g", umat_seconds / umat_calls ) : "NA"
+                        printf "%d,%d,%d,%d,%d,%s,%d,%d,%d,%.6g,%s,%s,%s,%s,%s\n", elements, nx, ny, nz, particles, mode, cpus,
+                               8 * elements, increments, wall, per_increment, umat_calls, per_call, peak_rss, status
+                    }' >> ${output}
+                tail -n 1 ${output}
+
+            done
+        done
+
+    done
+done
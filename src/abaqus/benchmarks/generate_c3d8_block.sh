@@ -0,0 +1,157 @@
+# Make bash script more like high-level languages.
+set -Eeuo pipefail
+
+# Get this script's file name
+script=`basename "$0"`
+
+# Parse arguments
+if [ "$#" -ne 3 ]; then
+    echo "${script} USAGE:"
+    echo "./${script} NUMBER_OF_ELEMENTS NUMBER_OF_PARTICLES OUTPUT_FILE"
+    echo "  REQUIRED POSITIONAL ARGUMENTS:"
+    echo "    NUMBER_OF_ELEMENTS: number of C3D8 elements of the unit cube block"
+    echo "    NUMBER_OF_PARTICLES: number of particles written as the first material constant"
+    echo "    OUTPUT_FILE: generated Abaqus input file path"
+    exit 1
+fi
+num_elements=$1
+num_particles=$2
+output=$3
+
+# Verify the mesh parameters
+if ! [[ "${num_elements}" =~ ^[1-9][0-9]*$ ]]; then
+    echo "The number of elements '${num_elements}' must be a positive integer."
+    exit 2
+fi
+if ! [[ "${num_particles}" =~ ^[1-9][0-9]*$ ]]; then
+    echo "The number of particles '${num_particles}' must be a positive integer."
+    exit 3
+fi
+
+# Write a structured block of num_elements = nx * ny * nz elements with the boundary conditions, material, and step of
+# single_element_c3d8.inp. The factors are chosen to be as close to a cube as possible. The nodes are numbered with x
+# varying fastest and y slowest so that the bottom and top node sets are contiguous.
+awk -v num_elements=${num_elements} -v num_particles=${num_particles} '
+function node(i, j, k){
+    return 1 + i + ( nx + 1 ) * ( k + ( nz + 1 ) * j )
+}
+function write_list(name, values, count,    n, line){
+    printf "*Nset, Nset=%s\n", name
+    line = ""
+    for ( n = 1; n <= count; n++ ){
+        line = line values[ n ]
+        if ( ( n % 16 == 0 ) || ( n == count ) ){
+            print line
+            line = ""
+        }
+        else{
+            line = line ", "
+        }
+    }
+}
+BEGIN{
+    # Factor the number of elements into the three most similar integers
+    nx = num_elements; ny = 1; nz = 1; largest = num_elements
+    for ( a = 1; a * a * a <= num_elements; a++ ){
+        if ( num_elements % a != 0 ){ continue }
+        remainder = num_elements / a
+        for ( b = a; b * b <= remainder; b++ ){
+            if ( remainder % b != 0 ){ continue }
+            c = remainder / b
+            if ( c < largest ){ nx = c; ny = b; nz = a; largest = c }
+        }
+    }
+    num_nodes = ( nx + 1 ) * ( ny + 1 ) * ( nz + 1 )
+    layer = ( nx + 1 ) * ( nz + 1 )
+
+    print "*Heading"
+    printf "Block of %d x %d x %d C3D8 elements for benchmarking umats\n", nx, ny, nz
+    print "**===================================================================== PART ==="
+    print "*Part, name=PART-1"
+    print "*********************************************"
+    print "** NODES"
+    print "*********************************************"
+    print "*Node, Nset=alln"
+    for ( j = 0; j <= ny; j++ ){
+        for ( k = 0; k <= nz; k++ ){
+            for ( i = 0; i <= nx; i++ ){
+                printf "%d, %.10g,%.10g,%.10g\n", node(i, j, k), i / nx, j / ny, k / nz
+            }
+        }
+    }
+    print "*Nset, Nset=top, generate"
+    printf "%d, %d, 1\n", num_nodes - layer + 1, num_nodes
+    print "*Nset, Nset=bottom, generate"
+    printf "%d, %d, 1\n", 1, layer
+    print "*Nset, Nset=NegX, generate"
+    printf "%d, %d, %d\n", 1, num_nodes - nx, nx + 1
+    count = 0
+    for ( j = 0; j <= ny; j++ ){
+        for ( i = 0; i <= nx; i++ ){
+            values[ ++count ] = node(i, j, 0)
+        }
+    }
+    write_list("NegZ", values, count)
+    print "*Nset, Nset=all, generate"
+    printf "%d, %d, 1\n", 1, num_nodes
+    print "*********************************************"
+    print "** ELEMENTS"
+    print "*********************************************"
+    print "*Element, type=C3D8, Elset=ALLE"
+    e = 0
+    for ( j = 0; j < ny; j++ ){
+        for ( k = 0; k < nz; k++ ){
+            for ( i = 0; i < nx; i++ ){
+                printf "%d, %d,%d,%d,%d,%d,%d,%d,%d\n", ++e,
+                       node(i, j, k), node(i, j, k + 1), node(i + 1, j, k + 1), node(i + 1, j, k),
+                       node(i, j + 1, k), node(i, j + 1, k + 1), node(i + 1, j + 1, k + 1), node(i + 1, j + 1, k)
+            }
+        }
+    }
+    print "*********************************************"
+    print "** SECTIONS"
+    print "*********************************************"
+    print "*SOLID SECTION, ELSET=ALLE, MATERIAL=test"
+    print "*End Part"
+    print "**================================================================= ASSEMBLY ==="
+    print "*Assembly, name=ASSEMBLY-1"
+    print "*Instance, name=INSTANCE-1, part=PART-1"
+    print "*End Instance"
+    print "*END ASSEMBLY"
+    print "**================================================================= MATERIAL ==="
+    print "*Material, name=test"
+    print "***** USER SUBROUTINE(S) *****"
+    print "*USER MATERIAL, CONSTANTS=2, UNSYMM"
+    printf "%d., 1.\n", num_particles
+    print "*DEPVAR"
+    print "2"
+    print "1, \"STATEV1_NAME\", \"STATEV1 DESCRIPTION\""
+    print "2, \"STATEV2_NAME\", \"STATEV2 DESCRIPTION\""
+    print "**====================================================== BOUNDARY CONDITIONS ==="
+    print "*boundary,type=displacement"
+    print "INSTANCE-1.1, 1,3,0.0"
+    print "INSTANCE-1.bottom, 2,2,0.0"
+    print "INSTANCE-1.NegX, 1,1,0.0"
+    print "INSTANCE-1.NegZ, 3,3,0.0"
+    print "**======================================================= INITIAL CONDITIONS ==="
+    print "*INITIAL CONDITIONS,TYPE=TEMPERATURE"
+    print "INSTANCE-1.alln,  298.0"
+    print "**==================================================================== STEP1 ==="
+    print "*STEP,INC=100,nlgeom"
+    print "*STATIC"
+    print "0.001,1.0,0.001,1.0"
+    print "*TEMPERATURE"
+    print "INSTANCE-1.alln, 298.0"
+    print "*BOUNDARY, TYPE=DISPLACEMENT "
+    print "INSTANCE-1.top, 2, 2, 0.01"
+    print "***** ODB OUTPUT *****"
+    print "** Only the final frame is written so that the output does not dominate the larger meshes"
+    print "*Output, field, number interval=1"
+    print "*Node Output"
+    print "U"
+    print "*Element Output, directions=YES, position=CENTROIDAL"
+    print "S, SDV"
+    print "***** STA OUTPUT *****"
+    printf "*monitor, node=INSTANCE-1.%d, dof=2\n", num_nodes - layer + 1
+    print "*end step"
+}' > ${output}
@@ -11,4559 +11,8286 @@
 #include<traction_separation.h>
 #include<surface_integration.h>
 
+#include<fstream>
+#include<cstring>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<fcntl.h>
+#include<unistd.h>
+
 namespace asp{
 
     //Define asp global constants in a place that Doxygen can pick up for documentation
     /** \brief Define the expected number of tensor spatial dimensions for the Abaqus interface. */
     const int spatialDimensions = 3;
 
-    aspBase::aspBase( ){
+    void sparseSurfaceResponse::initialize( const unsigned int &_numLocalParticles, const unsigned int &_numSurfacePoints, const unsigned int &_valueSize,
+                                            const unsigned int expectedPairs ){
         /*!
-         * The default constructor for ASP
+         * Initialize the storage for a new assembly. The capacity of the arrays is retained.
+         * 
+         * \param &_numLocalParticles: The number of local particles
+         * \param &_numSurfacePoints: The number of surface points on each local particle
+         * \param &_valueSize: The number of values stored for each entry
+         * \param expectedPairs: The number of pairs expected to be stored
          */
 
-        // Initialize surface integral pairs
-        const unsigned int *dim = getDimension( );
-
-        _localReferenceRadius = dataStorage( false, 0. );
+        numLocalParticles = _numLocalParticles;
 
-        _nonLocalReferenceRadius = dataStorage( false, 0. );
+        numSurfacePoints = _numSurfacePoints;
 
-        _unitSpherePoints = dataStorage( false, floatVector( ( *dim ), 0 ) );
+        valueSize = _valueSize;
 
-        _localReferenceNormal = dataStorage( false, floatVector( ( *dim ), 0 ) );
+        rowOffsets.clear( );
 
-        _localSurfaceReferenceRelativePositionVector = dataStorage( false, floatVector( ( *dim ), 0 ) );
+        nonLocalIndices.clear( );
 
-        _nonLocalSurfaceReferenceRelativePositionVector = dataStorage( false, floatVector( ( *dim ), 0 ) );
+        entryOffsets.clear( );
 
-        _referenceDistanceVector = dataStorage( false, floatVector( ( *dim ), 0 ) );
+        entryKeys.clear( );
 
-        _localReferenceParticleSpacing = dataStorage( false, floatVector( ( *dim ), 0 ) );
+        values.clear( );
 
-        _localDeformationGradient = dataStorage( false, floatVector( ( *dim ), 0 ) );
+        rowOffsets.reserve( numLocalParticles * numSurfacePoints + 1 );
 
-        _localMicroDeformation = dataStorage( false, floatVector( ( *dim ), 0 ) );
+        nonLocalIndices.reserve( expectedPairs );
 
-        _nonLocalMicroDeformation = dataStorage( false, floatVector( ( *dim ), 0 ) );
+        entryOffsets.reserve( expectedPairs + 1 );
 
-        _currentDistanceVector = dataStorage( false, floatVector( ( *dim ), 0 ) );
+        rowOffsets.push_back( 0 );
 
-        _localCurrentNormal = dataStorage( false, floatVector( ( *dim ), 0 ) );
+        entryOffsets.push_back( 0 );
 
     }
 
-    void aspBase::computeLocalParticleEnergyDensity( const floatType &previousTime, const floatType &deltaTime,
-                                                     const floatVector &currentMicroDeformation, const floatVector &previousMicroDeformation,
-                                                     const floatType &currentTemperature, const floatType &previousTemperature,
-                                                     const floatVector &previousStateVariables,
-                                                     const floatVector &parameters,
-                                                     floatType &energyDensity, floatVector &cauchyStress, floatVector &stateVariables ){
+    void sparseSurfaceResponse::appendPair( const unsigned int &nonLocalIndex, const floatType &value ){
         /*!
-         * Default function for computing the local particle's energy in the current configuration
-         * Defaults to a linear-elastic solid with parameters defined in the reference configuration.
+         * Append a pair with a single scalar value to the current row
          * 
-         * \param &previousTime: The previous value of the time
-         * \param &deltaTime: The change in time
-         * \param &currentMicroDeformation: The current value of the micro-deformation tensor \f$\chi\f$
-         * \param &previousMicroDeformation: The previous value of the micro-deformation tensor \f$\chi\f$
-         * \param &currentTemperature: The current value of the temperature
-         * \param &previousTemperature: The previous value of the temperature
-         * \param &previousStateVariables: The previous values of the state variables
-         * \param &parameters: The parameters for the model
-         * \param &energyDensity: The current value of the Helmholtz free energy density in the current configuration
-         * \param &cauchyStress: The current value of the Cauchy stress
-         * \param &stateVariables: The updated values of the state variables
+         * \param &nonLocalIndex: The index of the non-local particle
+         * \param &value: The value of the pair
          */
 
-        ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::linearElasticity::evaluateEnergy( currentMicroDeformation, parameters, energyDensity, cauchyStress ) );
+        if ( valueSize != 1 ){
 
-        return;
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "A scalar value can only be stored when the value size is 1.\n  valueSize: " + std::to_string( valueSize ) ) );
 
-    }
+        }
 
-    void aspBase::computeLocalParticleEnergyDensity( const floatType &previousTime, const floatType &deltaTime,
-                                                     const floatVector &currentMicroDeformation, const floatVector &previousMicroDeformation,
-                                                     const floatType &currentTemperature, const floatType &previousTemperature,
-                                                     const floatVector &previousStateVariables,
-                                                     const floatVector &parameters,
-                                                     floatType &energyDensity, floatVector &cauchyStress, floatVector &stateVariables,
-                                                     floatType &logProbabilityRatio ){
-        /*!
-         * Default function for computing the local particle's energy density in the current configuration
-         * Defaults to a linear-elastic solid with parameters defined in the reference configuration.
-         * 
-         * \param &previousTime: The previous value of the time
-         * \param &deltaTime: The change in time
-         * \param &currentMicroDeformation: The current value of the micro-deformation tensor \f$\chi\f$
-         * \param &previousMicroDeformation: The previous value of the micro-deformation tensor \f$\chi\f$
-         * \param &currentTemperature: The current value of the temperature
-         * \param &previousTemperature: The previous value of the temperature
-         * \param &previousStateVariables: The previous values of the state variables
-         * \param &parameters: The parameters for the model
-         * \param &energyDensity: The current value of the Helmholtz free energy density in the current configuration
-         * \param &cauchyStress: The current value of the Cauchy stress
-         * \param &stateVariables: The updated values of the state variables
-         * \param &logProbabilityRatio: The natural logarithm of the probability ratio between the new
-         *     probability density and the previous value.
-         */
+        nonLocalIndices.push_back( nonLocalIndex );
 
-        ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::linearElasticity::evaluateEnergy( currentMicroDeformation, parameters, energyDensity, cauchyStress ) );
+        entryKeys.push_back( 0 );
 
-        logProbabilityRatio = 0.;
+        values.push_back( value );
 
-        return;
+        entryOffsets.push_back( entryKeys.size( ) );
 
     }
 
-    void aspBase::initializeUnitSphere( ){
+    void sparseSurfaceResponse::appendPair( const unsigned int &nonLocalIndex, const floatVector &value ){
         /*!
-         * Initialize the unit sphere (i.e. a sphere of radius 1) to integrate over
+         * Append a pair with a single vector value to the current row
+         * 
+         * \param &nonLocalIndex: The index of the non-local particle
+         * \param &value: The value of the pair
          */
 
-        surfaceIntegration::decomposeSphere( 1.0, _surfaceElementCount, _unitSpherePoints.second, _unitSphereConnectivity.second );
+        if ( value.size( ) != valueSize ){
 
-        _unitSpherePoints.first = true;
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "The value has a size of " + std::to_string( value.size( ) ) + " but the value size is " + std::to_string( valueSize ) ) );
 
-        _unitSphereConnectivity.first = true;
+        }
 
-        return;
+        nonLocalIndices.push_back( nonLocalIndex );
 
-    }
+        entryKeys.push_back( 0 );
 
-    const unsigned int* aspBase::getDimension( ){
-        /*!
-         * Get the spacial dimension
-         */
+        values.insert( values.end( ), value.begin( ), value.end( ) );
 
-        return &_dimension;
+        entryOffsets.push_back( entryKeys.size( ) );
 
     }
 
-    const floatType* aspBase::getRadius( ){
+    void sparseSurfaceResponse::appendPair( const unsigned int &nonLocalIndex, const mapFloatType &value ){
         /*!
-         * Get the radius
+         * Append a pair with keyed scalar entries to the current row. The entries are stored in order of increasing key.
+         * 
+         * \param &nonLocalIndex: The index of the non-local particle
+         * \param &value: The entries of the pair
          */
 
-        return &_radius;
+        if ( valueSize != 1 ){
 
-    }
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "A scalar value can only be stored when the value size is 1.\n  valueSize: " + std::to_string( valueSize ) ) );
 
-    const floatVector* aspBase::getUnitSpherePoints( ){
-        /*!
-         * Get the points on the unit sphere
-         */
+        }
 
-        if ( !_unitSpherePoints.first ){
+        nonLocalIndices.push_back( nonLocalIndex );
 
-            ERROR_TOOLS_CATCH( initializeUnitSphere( ) );
+        // The map iterates in order of increasing key
+        for ( auto v = value.begin( ); v != value.end( ); v++ ){
+
+            entryKeys.push_back( v->first );
+
+            values.push_back( v->second );
 
         }
 
-        return &_unitSpherePoints.second;
+        entryOffsets.push_back( entryKeys.size( ) );
 
     }
 
-    const std::vector< unsigned int >* aspBase::getUnitSphereConnectivity( ){
+    void sparseSurfaceResponse::appendPair( const unsigned int &nonLocalIndex, const mapFloatVector &value ){
         /*!
-         * Get the points on the unit sphere
+         * Append a pair with keyed vector entries to the current row. The entries are stored in order of increasing key.
+         * 
+         * \param &nonLocalIndex: The index of the non-local particle
+         * \param &value: The entries of the pair
          */
 
-        if ( !_unitSphereConnectivity.first ){
+        for ( auto v = value.begin( ); v != value.end( ); v++ ){
 
-            ERROR_TOOLS_CATCH( initializeUnitSphere( ) );
+            if ( v->second.size( ) != valueSize ){
 
-        }
+                ERROR_TOOLS_CATCH( throw std::runtime_error( "Entry " + std::to_string( v->first ) + " has a size of " + std::to_string( v->second.size( ) ) + " but the value size is " + std::to_string( valueSize ) ) );
 
-        return &_unitSphereConnectivity.second;
+            }
 
-    }
+        }
 
-    void aspBase::setLocalReferenceNormal( ){
-        /*!
-         * Set the local reference normal vector
-         * 
-         * Because we have a unit sphere centered on zero as a basis the normal vector is the same
-         * as any position vector on the surface of the sphere.
-         */
+        nonLocalIndices.push_back( nonLocalIndex );
 
-        floatVector localReferenceNormal;
+        // The map iterates in order of increasing key
+        for ( auto v = value.begin( ); v != value.end( ); v++ ){
 
-        ERROR_TOOLS_CATCH( getLocalReferenceNormal( *getLocalSurfaceNodeIndex( ), localReferenceNormal ) );
+            entryKeys.push_back( v->first );
 
-        setLocalReferenceNormal( localReferenceNormal );
+            values.insert( values.end( ), v->second.begin( ), v->second.end( ) );
 
-        return;
+        }
+
+        entryOffsets.push_back( entryKeys.size( ) );
 
     }
 
-    void aspBase::setLocalReferenceNormal( const floatVector &value ){
+    void sparseSurfaceResponse::closeRow( ){
         /*!
-         * Set the local reference normal vector
-         * 
-         * \param &value: The local reference normal vector
-         * 
+         * Close the current ( local particle, surface point ) row. Must be called for every row even if it has no pairs.
          */
 
-        _localReferenceNormal.second = value;
-
-        _localReferenceNormal.first = true;
-
-        addSurfacePointData( &_localReferenceNormal );
-
-        return;
+        rowOffsets.push_back( nonLocalIndices.size( ) );
 
     }
 
-    const floatVector* aspBase::getLocalReferenceNormal( ){
+    void sparseSurfaceResponse::appendRows( const sparseSurfaceResponse &other ){
         /*!
-         * Get the local reference normal vector
+         * Append the rows of another compressed quantity to the end of this one. Used to combine quantities which were
+         * assembled over consecutive ranges of the local particles.
          * 
-         * Get the local reference normal vector or set it and return it if necessary
+         * \param &other: The quantity whose rows are to be appended
          */
 
-        if ( !_localReferenceNormal.first ){
+        if ( ( other.valueSize != valueSize ) || ( other.numSurfacePoints != numSurfacePoints ) ){
 
-            ERROR_TOOLS_CATCH( setLocalReferenceNormal( ) );
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "The quantities must have the same value size and number of surface points.\n  valueSize: " + std::to_string( valueSize ) + ", " + std::to_string( other.valueSize ) + "\n  numSurfacePoints: " + std::to_string( numSurfacePoints ) + ", " + std::to_string( other.numSurfacePoints ) ) );
 
         }
 
-        return &_localReferenceNormal.second;
+        if ( ( other.rowOffsets.size( ) == 0 ) || ( other.entryOffsets.size( ) == 0 ) ){
 
-    }
+            return;
 
-    void aspBase::setLocalSurfaceReferenceRelativePositionVector( ){
-        /*!
-         * Set the local surface relative position vector
-         * 
-         * \f$\Xi_I = R^{local} N_I\f$
-         * 
-         * where \f$R^{local}\f$ is the local radius and \f$N_I\f$ is the local reference normal.
-         */
+        }
 
-        const floatVector* localReferenceNormal;
-        ERROR_TOOLS_CATCH( localReferenceNormal = getLocalReferenceNormal( ) );
+        unsigned int pairOffset = nonLocalIndices.size( );
 
-        const floatType* localReferenceRadius;
-        ERROR_TOOLS_CATCH( localReferenceRadius = getLocalReferenceRadius( ) );
+        unsigned int entryOffset = entryKeys.size( );
 
-        setLocalSurfaceReferenceRelativePositionVector( ( *localReferenceRadius ) * ( *localReferenceNormal ) );
+        for ( auto r = other.rowOffsets.begin( ) + 1; r != other.rowOffsets.end( ); r++ ){
 
-        return;
+            rowOffsets.push_back( *r + pairOffset );
 
-    }
+        }
 
-    void aspBase::setLocalSurfaceReferenceRelativePositionVector( const floatVector &value ){
-        /*!
-         * Set the local surface relative position vector
-         * 
-         * \param &value: The value of the local surface relative position vector
-         */
+        for ( auto e = other.entryOffsets.begin( ) + 1; e != other.entryOffsets.end( ); e++ ){
 
-        _localSurfaceReferenceRelativePositionVector.second = value;
+            entryOffsets.push_back( *e + entryOffset );
 
-        _localSurfaceReferenceRelativePositionVector.first = true;
+        }
 
-        addSurfacePointData( &_localSurfaceReferenceRelativePositionVector );
+        nonLocalIndices.insert( nonLocalIndices.end( ), other.nonLocalIndices.begin( ), other.nonLocalIndices.end( ) );
 
-        return;
+        entryKeys.insert( entryKeys.end( ), other.entryKeys.begin( ), other.entryKeys.end( ) );
+
+        values.insert( values.end( ), other.values.begin( ), other.values.end( ) );
 
     }
 
-    const floatVector* aspBase::getLocalSurfaceReferenceRelativePositionVector( ){
+    bool sparseSurfaceResponse::findPair( const unsigned int &localIndex, const unsigned int &surfacePointIndex, const unsigned int &nonLocalIndex,
+                                          unsigned int &pair ) const{
         /*!
-         * Get the value of the local surface reference relative position vector
+         * Find the index of the pair. Requires the non-local indices of each row to have been appended in increasing order.
+         * 
+         * \param &localIndex: The index of the local particle
+         * \param &surfacePointIndex: The index of the surface point on the local particle
+         * \param &nonLocalIndex: The index of the non-local particle
+         * \param &pair: The index of the pair. The entries of the pair are entryOffsets[ pair ] to entryOffsets[ pair + 1 ]
+         * 
+         * \return True if the pair was stored and false otherwise
          */
 
-        if ( !_localSurfaceReferenceRelativePositionVector.first ){
+        unsigned int row = localIndex * numSurfacePoints + surfacePointIndex;
 
-            ERROR_TOOLS_CATCH( setLocalSurfaceReferenceRelativePositionVector( ) );
+        if ( ( localIndex >= numLocalParticles ) || ( surfacePointIndex >= numSurfacePoints ) || ( row + 1 >= rowOffsets.size( ) ) ){
+
+            return false;
 
         }
 
-        return &_localSurfaceReferenceRelativePositionVector.second;
+        auto begin = nonLocalIndices.begin( ) + rowOffsets[ row ];
 
-    }
+        auto end   = nonLocalIndices.begin( ) + rowOffsets[ row + 1 ];
 
-    void aspBase::setNonLocalSurfaceReferenceRelativePositionVector( ){
-        /*!
-         * Set the non-local relative position vector
-         * 
-         * \f$\Xi_I^{non-local} = -R^{non-local} N_I\f$
-         * 
-         * where \f$R^{non-local}\f$ is the non-local radius and \f$N_I\f$ is the local reference normal.
-         */
+        auto location = std::lower_bound( begin, end, nonLocalIndex );
 
-        const floatVector* localReferenceNormal;
-        ERROR_TOOLS_CATCH( localReferenceNormal = getLocalReferenceNormal( ) );
+        if ( ( location == end ) || ( *location != nonLocalIndex ) ){
 
-        const floatType* nonLocalReferenceRadius;
-        ERROR_TOOLS_CATCH( nonLocalReferenceRadius = getNonLocalReferenceRadius( ) );
+            return false;
 
-        setNonLocalSurfaceReferenceRelativePositionVector( -( *nonLocalReferenceRadius ) * ( *localReferenceNormal ) );
+        }
 
-        return;
+        pair = location - nonLocalIndices.begin( );
+
+        return true;
 
     }
 
-    void aspBase::setNonLocalSurfaceReferenceRelativePositionVector( const floatVector &value ){
+    void sparseSurfaceResponse::toDense( std::vector< std::vector< floatVector > > &dense ) const{
         /*!
-         * Set the non-local relative position vector
+         * Expand a quantity with scalar pair values into the dense ( local particle, surface point, non-local particle ) form.
+         * Pairs which are not stored are zero.
          * 
-         * \param &value: The value of the non-local surface reference relative position vector
+         * \param &dense: The dense form of the quantity
          */
 
-        _nonLocalSurfaceReferenceRelativePositionVector.second = value;
+        dense = std::vector< std::vector< floatVector > >( numLocalParticles, std::vector< floatVector >( numSurfacePoints, floatVector( numLocalParticles, 0 ) ) );
 
-        _nonLocalSurfaceReferenceRelativePositionVector.first = true;
+        for ( unsigned int i = 0; i < numLocalParticles; i++ ){
 
-        addInteractionPairData( &_nonLocalSurfaceReferenceRelativePositionVector );
+            for ( unsigned int j = 0; j < numSurfacePoints; j++ ){
 
-        return;
+                unsigned int row = i * numSurfacePoints + j;
 
-    }
+                for ( unsigned int p = rowOffsets[ row ]; p < rowOffsets[ row + 1 ]; p++ ){
 
-    const floatVector* aspBase::getNonLocalSurfaceReferenceRelativePositionVector( ){
-        /*!
-         * Get the non-local surface reference relative position vector
-         */
+                    dense[ i ][ j ][ nonLocalIndices[ p ] ] = values[ entryOffsets[ p ] ];
 
-        if ( !_nonLocalSurfaceReferenceRelativePositionVector.first ){
+                }
 
-            ERROR_TOOLS_CATCH( setNonLocalSurfaceReferenceRelativePositionVector( ) );
+            }
 
         }
 
-        return &_nonLocalSurfaceReferenceRelativePositionVector.second;
-
     }
 
-    void aspBase::setLocalReferenceRadius( ){
+    void sparseSurfaceResponse::toDense( std::vector< std::vector< floatMatrix > > &dense ) const{
         /*!
-         * Set the local reference radius
+         * Expand a quantity with vector pair values into the dense ( local particle, surface point, non-local particle ) form.
+         * Pairs which are not stored are empty.
+         * 
+         * \param &dense: The dense form of the quantity
          */
 
-        setLocalReferenceRadius( *getRadius( ) );
+        dense = std::vector< std::vector< floatMatrix > >( numLocalParticles, std::vector< floatMatrix >( numSurfacePoints, floatMatrix( numLocalParticles ) ) );
 
-        return;
+        for ( unsigned int i = 0; i < numLocalParticles; i++ ){
 
-    }
+            for ( unsigned int j = 0; j < numSurfacePoints; j++ ){
 
-    void aspBase::setLocalReferenceRadius( const floatType &value ){
-        /*!
-         * Set the local reference radius
-         * 
-         * \param &value: The value of the local reference radius
-         */
+                unsigned int row = i * numSurfacePoints + j;
 
-        _localReferenceRadius.second = value;
+                for ( unsigned int p = rowOffsets[ row ]; p < rowOffsets[ row + 1 ]; p++ ){
 
-        _localReferenceRadius.first = true;
+                    dense[ i ][ j ][ nonLocalIndices[ p ] ] = floatVector( values.begin( ) + valueSize * entryOffsets[ p ],
+                                                                           values.begin( ) + valueSize * ( entryOffsets[ p ] + 1 ) );
 
-        addLocalParticleData( &_localReferenceRadius );
+                }
 
-        return;
+            }
+
+        }
 
     }
 
-    const floatType* aspBase::getLocalReferenceRadius( ){
+    void sparseSurfaceResponse::toDense( std::vector< std::vector< std::vector< mapFloatType > > > &dense ) const{
         /*!
-         * Get the local reference radius
+         * Expand a quantity with keyed scalar entries into the dense ( local particle, surface point, non-local particle ) form.
+         * Pairs which are not stored are empty.
+         * 
+         * \param &dense: The dense form of the quantity
          */
 
-        if ( !_localReferenceRadius.first ){
+        dense = std::vector< std::vector< std::vector< mapFloatType > > >( numLocalParticles, std::vector< std::vector< mapFloatType > >( numSurfacePoints, std::vector< mapFloatType >( numLocalParticles ) ) );
 
-            ERROR_TOOLS_CATCH( setLocalReferenceRadius( ) );
+        for ( unsigned int i = 0; i < numLocalParticles; i++ ){
 
-        }
+            for ( unsigned int j = 0; j < numSurfacePoints; j++ ){
 
-        return &_localReferenceRadius.second;
+                unsigned int row = i * numSurfacePoints + j;
 
-    }
+                for ( unsigned int p = rowOffsets[ row ]; p < rowOffsets[ row + 1 ]; p++ ){
 
-    void aspBase::setNonLocalReferenceRadius( ){
-        /*!
-         * Set the non-local reference radius
-         */
+                    mapFloatType &pairValue = dense[ i ][ j ][ nonLocalIndices[ p ] ];
 
-        setNonLocalReferenceRadius( *getRadius( ) );
+                    for ( unsigned int e = entryOffsets[ p ]; e < entryOffsets[ p + 1 ]; e++ ){
 
-        return;
+                        pairValue.emplace( entryKeys[ e ], values[ e ] );
 
-    }
+                    }
 
-    void aspBase::setNonLocalReferenceRadius( const floatType &value ){
-        /*!
-         * Set the non-local reference radius
-         * 
-         * \param &value: The value of the non-local reference radius
-         */
-
-        _nonLocalReferenceRadius.second = value;
-
-        _nonLocalReferenceRadius.first = true;
+                }
 
-        addInteractionPairData( &_nonLocalReferenceRadius );
+            }
 
-        return;
+        }
 
     }
 
-    const floatType* aspBase::getNonLocalReferenceRadius( ){
+    void sparseSurfaceResponse::toDense( std::vector< std::vector< std::vector< mapFloatVector > > > &dense ) const{
         /*!
-         * Get the local reference radius
+         * Expand a quantity with keyed vector entries into the dense ( local particle, surface point, non-local particle ) form.
+         * Pairs which are not stored are empty.
+         * 
+         * \param &dense: The dense form of the quantity
          */
 
-        if ( !_nonLocalReferenceRadius.first ){
+        dense = std::vector< std::vector< std::vector< mapFloatVector > > >( numLocalParticles, std::vector< std::vector< mapFloatVector > >( numSurfacePoints, std::vector< mapFloatVector >( numLocalParticles ) ) );
 
-            ERROR_TOOLS_CATCH( setNonLocalReferenceRadius( ) );
+        for ( unsigned int i = 0; i < numLocalParticles; i++ ){
 
-        }
+            for ( unsigned int j = 0; j < numSurfacePoints; j++ ){
 
-        return &_nonLocalReferenceRadius.second;
+                unsigned int row = i * numSurfacePoints + j;
 
-    }
+                for ( unsigned int p = rowOffsets[ row ]; p < rowOffsets[ row + 1 ]; p++ ){
 
-    const floatVector* aspBase::getDeformationGradient( ){
-        /*!
-         * Get the deformation gradient
-         */
+                    mapFloatVector &pairValue = dense[ i ][ j ][ nonLocalIndices[ p ] ];
 
-        return &_deformationGradient;
+                    for ( unsigned int e = entryOffsets[ p ]; e < entryOffsets[ p + 1 ]; e++ ){
 
-    }
+                        pairValue.emplace( entryKeys[ e ], floatVector( values.begin( ) + valueSize * e, values.begin( ) + valueSize * ( e + 1 ) ) );
 
-    const floatVector* aspBase::getPreviousDeformationGradient( ){
-        /*!
-         * Get the previous deformation gradient
-         */
+                    }
 
-        return &_previousDeformationGradient;
+                }
+
+            }
+
+        }
 
     }
 
-    const floatVector* aspBase::getPreviousMicroDeformation( ){
+    void sparseSurfaceResponse::clear( ){
         /*!
-         * Get the previous value of the micro deformation
+         * Erase the stored pairs. The capacity of the arrays is retained so that the next assembly does not need to reallocate.
          */
 
-        return &_previousMicroDeformation;
+        numLocalParticles = 0;
 
-    }
+        numSurfacePoints = 0;
 
-    void aspBase::setLocalDeformationGradient( ){
-        /*!
-         * Set the local deformation gradient
-         */
+        rowOffsets.clear( );
 
-        const floatVector* deformationGradient;
-        ERROR_TOOLS_CATCH( deformationGradient = getDeformationGradient( ) );
+        nonLocalIndices.clear( );
 
-        setLocalDeformationGradient( *deformationGradient );
+        entryOffsets.clear( );
 
-        return;
+        entryKeys.clear( );
+
+        values.clear( );
 
     }
 
-    void aspBase::setLocalDeformationGradient( const floatVector &value ){
+    const char *getInstrumentationStageName( const instrumentationStage &stage ){
         /*!
-         * Set the local deformation gradient
+         * Get the name of an instrumentation stage
          * 
-         * \param &value: The value of the local deformation gradient
+         * \param &stage: The stage
          */
 
-        _localDeformationGradient.second = value;
+        switch ( stage ){
 
-        _localDeformationGradient.first = true;
+            case UNIT_SPHERE_SETUP: return "unit sphere setup";
 
-        addLocalParticleData( &_localDeformationGradient );
+            case LOCAL_PARTICLE_ENERGY: return "local particle energy";
 
-        return;
+            case BOUNDING_BOX: return "bounding box";
 
-    }
+            case OVERLAP_CULLING: return "overlap culling";
 
-    const floatVector* aspBase::getLocalDeformationGradient( ){
-        /*!
-         * Get the local deformation gradient
-         */
+            case OVERLAP_SOLVE: return "overlap solve";
 
-        if ( !_localDeformationGradient.first ){
+            case ADHESION_TRACTION: return "adhesion traction";
 
-            ERROR_TOOLS_CATCH( setLocalDeformationGradient( ) );
+            case SURFACE_RESPONSES: return "surface responses";
 
-        }
+            case LOCAL_PARTICLE_ASSEMBLY: return "local particle assembly";
 
-        return &_localDeformationGradient.second;
+            case SURFACE_RESPONSE_ASSEMBLY: return "surface response assembly";
+
+            case ABAQUS_UMAT: return "abaqus umat";
+
+            default: return "unknown";
+
+        }
 
     }
 
-    void aspBase::setPreviousLocalDeformationGradient( ){
+    void instrumentationCounters::merge( const instrumentationCounters &other ){
         /*!
-         * Set the local previous deformation gradient
+         * Add the counts and times of another set of counters to these counters
+         * 
+         * \param &other: The counters to add
          */
 
-        const floatVector* previousDeformationGradient;
-        ERROR_TOOLS_CATCH( previousDeformationGradient = getPreviousDeformationGradient( ) );
+        for ( unsigned int i = 0; i < NUM_INSTRUMENTATION_STAGES; i++ ){
 
-        setPreviousLocalDeformationGradient( *previousDeformationGradient );
+            calls[ i ] += other.calls[ i ];
 
-        return;
+            seconds[ i ] += other.seconds[ i ];
 
-    }
+        }
 
-    void aspBase::setPreviousLocalDeformationGradient( const floatVector &value ){
-        /*!
-         * Set the local previous deformation gradient
-         * 
-         * \param &value: The value of the local previous deformation gradient
-         */
+        overlapCandidatesTested += other.overlapCandidatesTested;
 
-        _previousLocalDeformationGradient.second = value;
+        overlapCandidatesRetained += other.overlapCandidatesRetained;
 
-        _previousLocalDeformationGradient.first = true;
+        overlapSolves += other.overlapSolves;
 
-        addLocalParticleData( &_previousLocalDeformationGradient );
+        overlapNewtonIterations += other.overlapNewtonIterations;
 
-        return;
+        overlapLineSearchIterations += other.overlapLineSearchIterations;
 
     }
 
-    const floatVector* aspBase::getPreviousLocalDeformationGradient( ){
+    void instrumentationCounters::reset( ){
         /*!
-         * Get the local previous deformation gradient
+         * Set all of the counts and times to zero
          */
 
-        if ( !_previousLocalDeformationGradient.first ){
+        *this = instrumentationCounters( );
 
-            ERROR_TOOLS_CATCH( setPreviousLocalDeformationGradient( ) );
+    }
 
-        }
+    void instrumentationCounters::write( std::ostream &stream ) const{
+        /*!
+         * Write a table of the counts and times to a stream
+         * 
+         * \param &stream: The stream to write to
+         */
 
-        return &_previousLocalDeformationGradient.second;
+        stream << "asp instrumentation\n";
 
-    }
+        for ( unsigned int i = 0; i < NUM_INSTRUMENTATION_STAGES; i++ ){
 
+            stream << "  " << getInstrumentationStageName( static_cast< instrumentationStage >( i ) ) << ": "
+                   << calls[ i ] << " calls, " << seconds[ i ] << " s\n";
 
-    void aspBase::setLocalMicroDeformation( ){
-        /*!
-         * Set the local micro deformation
-         */
+        }
 
-        const floatVector* microDeformation;
-        ERROR_TOOLS_CATCH( microDeformation = getMicroDeformation( ) );
+        stream << "  overlap candidates tested: " << overlapCandidatesTested << "\n";
 
-        setLocalMicroDeformation( *microDeformation );
+        stream << "  overlap candidates retained: " << overlapCandidatesRetained << "\n";
 
-        return;
+        stream << "  overlap solves: " << overlapSolves << "\n";
+
+        stream << "  overlap Newton iterations: " << overlapNewtonIterations << "\n";
+
+        stream << "  overlap line-search backtracks: " << overlapLineSearchIterations << "\n";
 
     }
 
-    void aspBase::setLocalMicroDeformation( const floatVector &value ){
-        /*!
-         * Set the local micro deformation
-         * 
-         * \param &value: The value of the local micro deformation
-         */
+    namespace{
 
-        _localMicroDeformation.second = value;
+        std::mutex recordedInstrumentationMutex; //!< The mutex which guards the list of the thread counters and the counters of the finished threads
 
-        _localMicroDeformation.first = true;
+        instrumentationCounters &getFinishedThreadInstrumentation( ){
+            /*!
+             * Get the instrumentation counters recorded by the threads which have finished
+             */
 
-        addLocalParticleData( &_localMicroDeformation );
+            static instrumentationCounters counters;
 
-        return;
+            return counters;
 
-    }
+        }
 
-    const floatVector* aspBase::getLocalMicroDeformation( ){
-        /*!
-         * Get the local micro deformation
-         */
+        class threadInstrumentation;
 
-        if ( !_localMicroDeformation.first ){
+        std::vector< threadInstrumentation* > &getThreadInstrumentationList( ){
+            /*!
+             * Get the instrumentation counters of the threads which are running
+             */
 
-            ERROR_TOOLS_CATCH( setLocalMicroDeformation( ) );
+            static std::vector< threadInstrumentation* > threads;
+
+            return threads;
 
         }
 
-        return &_localMicroDeformation.second;
+        class threadInstrumentation{
+            /*!
+             * The instrumentation counters recorded by one thread. The counters are guarded by their own mutex so that the
+             * threads do not wait for each other when they record their counters. The counters are added to those of the
+             * finished threads when the thread exits.
+             */
 
-    }
+            public:
 
-    void aspBase::setPreviousLocalMicroDeformation( ){
-        /*!
-         * Set the local previous micro deformation
-         */
+                threadInstrumentation( ){
 
-        const floatVector* previousMicroDeformation;
-        ERROR_TOOLS_CATCH( previousMicroDeformation = getPreviousMicroDeformation( ) );
+                    std::lock_guard< std::mutex > lock( recordedInstrumentationMutex );
 
-        setPreviousLocalMicroDeformation( *previousMicroDeformation );
+                    getThreadInstrumentationList( ).push_back( this );
 
-        return;
+                }
 
-    }
+                ~threadInstrumentation( ){
 
-    void aspBase::setPreviousLocalMicroDeformation( const floatVector &value ){
-        /*!
-         * Set the local previous micro deformation
-         * 
-         * \param &value: The previous local micro deformation
-         */
+                    std::lock_guard< std::mutex > lock( recordedInstrumentationMutex );
 
-        _previousLocalMicroDeformation.second = value;
+                    std::vector< threadInstrumentation* > &threads = getThreadInstrumentationList( );
 
-        _previousLocalMicroDeformation.first = true;
+                    threads.erase( std::find( threads.begin( ), threads.end( ), this ) );
 
-        addLocalParticleData( &_previousLocalMicroDeformation );
+                    getFinishedThreadInstrumentation( ).merge( counters );
 
-        return;
+                }
 
-    }
+                threadInstrumentation( const threadInstrumentation & ) = delete;
 
-    const floatVector* aspBase::getPreviousLocalMicroDeformation( ){
-        /*!
-         * Get the local previous micro deformation
-         */
+                threadInstrumentation &operator=( const threadInstrumentation & ) = delete;
 
-        if ( !_previousLocalMicroDeformation.first ){
+                std::mutex mutex; //!< The mutex which guards the counters of the thread
 
-            ERROR_TOOLS_CATCH( setPreviousLocalMicroDeformation( ) );
+                instrumentationCounters counters; //!< The counters recorded by the thread
 
-        }
+        };
 
-        return &_previousLocalMicroDeformation.second;
+        threadInstrumentation &getThreadInstrumentation( ){
+            /*!
+             * Get the instrumentation counters recorded by the calling thread
+             */
+
+            thread_local threadInstrumentation counters;
+
+            return counters;
+
+        }
 
     }
 
-    void aspBase::setLocalReferenceParticleSpacingVector( ){
+    void recordInstrumentation( const instrumentationCounters &counters ){
         /*!
-         * Set the local particle spacing
+         * Add the counters of an evaluation to the counters recorded by the calling thread e.g. for each call of the
+         * Abaqus UMAT. May be called concurrently. Each thread only locks its own counters so the threads are not
+         * serialized.
          * 
-         * \f$dX_I = \Xi_I^{local} + D_I - \Xi_I^{non-local}\f$
+         * \param &counters: The counters to record
          */
 
-        const floatVector* localSurfaceReferenceRelativePositionVector;
-        ERROR_TOOLS_CATCH( localSurfaceReferenceRelativePositionVector = getLocalSurfaceReferenceRelativePositionVector( ) );
-
-        const floatVector* nonLocalSurfaceReferenceRelativePositionVector;
-        ERROR_TOOLS_CATCH( nonLocalSurfaceReferenceRelativePositionVector = getNonLocalSurfaceReferenceRelativePositionVector( ) );
-
-        const floatVector* referenceDistanceVector;
-        ERROR_TOOLS_CATCH( referenceDistanceVector = getReferenceDistanceVector( ) );
-
-        floatVector localReferenceParticleSpacing;
-
-        localReferenceParticleSpacing = ( *localSurfaceReferenceRelativePositionVector )
-                                      + ( *referenceDistanceVector )
-                                      - ( *nonLocalSurfaceReferenceRelativePositionVector );
+        threadInstrumentation &thread = getThreadInstrumentation( );
 
-        setLocalReferenceParticleSpacingVector( localReferenceParticleSpacing );
+        std::lock_guard< std::mutex > lock( thread.mutex );
 
-        return;
+        thread.counters.merge( counters );
 
     }
 
-    void aspBase::setLocalReferenceParticleSpacingVector( const floatVector &value ){
+    instrumentationCounters getRecordedInstrumentation( ){
         /*!
-         * Set the local particle spacing
-         * 
-         * \param &value: The local particle spacing
+         * Get the sum of the instrumentation counters recorded by all of the threads of the process
          */
 
-        _localReferenceParticleSpacing.second = value;
+        std::lock_guard< std::mutex > lock( recordedInstrumentationMutex );
 
-        _localReferenceParticleSpacing.first = true;
+        instrumentationCounters counters = getFinishedThreadInstrumentation( );
 
-        addInteractionPairData( &_localReferenceParticleSpacing );
+        for ( auto thread = getThreadInstrumentationList( ).begin( ); thread != getThreadInstrumentationList( ).end( ); thread++ ){
 
-        return;
+            std::lock_guard< std::mutex > threadLock( ( *thread )->mutex );
+
+            counters.merge( ( *thread )->counters );
+
+        }
+
+        return counters;
 
     }
 
-    const floatVector* aspBase::getLocalReferenceParticleSpacingVector( ){
+    void resetRecordedInstrumentation( ){
         /*!
-         * Get the local reference particle spacing
+         * Reset the instrumentation counters recorded by all of the threads of the process
          */
 
-        if ( !_localReferenceParticleSpacing.first ){
+        std::lock_guard< std::mutex > lock( recordedInstrumentationMutex );
 
-            ERROR_TOOLS_CATCH( setLocalReferenceParticleSpacingVector( ) );
+        getFinishedThreadInstrumentation( ).reset( );
 
-        }
+        for ( auto thread = getThreadInstrumentationList( ).begin( ); thread != getThreadInstrumentationList( ).end( ); thread++ ){
 
-        return &_localReferenceParticleSpacing.second;
+            std::lock_guard< std::mutex > threadLock( ( *thread )->mutex );
+
+            ( *thread )->counters.reset( );
+
+        }
 
     }
 
-    void aspBase::setNonLocalMicroDeformation( ){
+    aspBase::aspBase( ){
         /*!
-         * Set the non-local micro deformation given
-         * 
-         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
-         * 
-         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
-         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
-         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
-         * 
-         * \f$dX_I = \Xi_I + D_I - \Xi_I^{\text{NL}} \f$
-         * 
-         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
-         * \f$D_I\f$ is the reference distance, and \f$\Xi_I^{\text{NL}}\f$ is the
-         * non-local relative position vector in the reference configuration
+         * The default constructor for ASP
          */
 
+        // Initialize surface integral pairs
         const unsigned int *dim = getDimension( );
 
-        const floatVector* localReferenceParticleSpacing;
-        ERROR_TOOLS_CATCH( localReferenceParticleSpacing = getLocalReferenceParticleSpacingVector( ) );
+        _localReferenceRadius = dataStorage( false, 0. );
 
-        const floatVector* microDeformationBase;
-        ERROR_TOOLS_CATCH( microDeformationBase = getNonLocalMicroDeformationBase( ) );
+        _nonLocalReferenceRadius = dataStorage( false, 0. );
 
-        const floatVector* gradientMicroDeformation;
-        ERROR_TOOLS_CATCH( gradientMicroDeformation = getGradientMicroDeformation( ) );
+        _unitSpherePoints = dataStorage( false, floatVector( ( *dim ), 0 ) );
 
-        floatVector nonLocalMicroDeformation = *microDeformationBase;
+        _localReferenceNormal = dataStorage( false, floatVector( ( *dim ), 0 ) );
 
-        for ( unsigned int i = 0; i < ( *dim ); i++ ){
+        _localSurfaceReferenceRelativePositionVector = dataStorage( false, floatVector( ( *dim ), 0 ) );
 
-            for ( unsigned int I = 0; I < ( *dim ); I++ ){
+        _nonLocalSurfaceReferenceRelativePositionVector = dataStorage( false, floatVector( ( *dim ), 0 ) );
 
-                for ( unsigned int J = 0; J < ( *dim ); J++ ){
+        _referenceDistanceVector = dataStorage( false, floatVector( ( *dim ), 0 ) );
 
-                    nonLocalMicroDeformation[ ( *dim ) * i + I ]
-                        += ( *gradientMicroDeformation )[ ( *dim ) * ( *dim ) * i + ( *dim ) * I + J ]
-                         * ( *localReferenceParticleSpacing )[ J ];
+        _localReferenceParticleSpacing = dataStorage( false, floatVector( ( *dim ), 0 ) );
 
-                }
+        _localDeformationGradient = dataStorage( false, floatVector( ( *dim ), 0 ) );
 
-            }
+        _localMicroDeformation = dataStorage( false, floatVector( ( *dim ), 0 ) );
 
-        }
+        _nonLocalMicroDeformation = dataStorage( false, floatVector( ( *dim ), 0 ) );
 
-        setNonLocalMicroDeformation( nonLocalMicroDeformation );
+        _currentDistanceVector = dataStorage( false, floatVector( ( *dim ), 0 ) );
 
-        return;
+        _localCurrentNormal = dataStorage( false, floatVector( ( *dim ), 0 ) );
 
     }
 
-    void aspBase::setdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ){
+    void aspBase::computeLocalParticleEnergyDensity( const floatType &previousTime, const floatType &deltaTime,
+                                                     const floatVector &currentMicroDeformation, const floatVector &previousMicroDeformation,
+                                                     const floatType &currentTemperature, const floatType &previousTemperature,
+                                                     const floatVector &previousStateVariables,
+                                                     const floatVector &parameters,
+                                                     floatType &energyDensity, floatVector &cauchyStress, floatVector &stateVariables ){
         /*!
-         * Set the derivative of the non-local micro deformation w.r.t. the local relative position
-         * vector in the reference configuration given
-         * 
-         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
-         * 
-         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
-         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
-         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
-         * 
-         * \f$dX_I = \Xi_I + D_I - \Xi_I^{\text{NL}} \f$
+         * Default function for computing the local particle's energy in the current configuration
+         * Defaults to a linear-elastic solid with parameters defined in the reference configuration.
          * 
-         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
-         * \f$D_I\f$ is the reference distance, and \f$\Xi_I^{\text{NL}}\f$ is the
-         * non-local relative position vector in the reference configuration
+         * \param &previousTime: The previous value of the time
+         * \param &deltaTime: The change in time
+         * \param &currentMicroDeformation: The current value of the micro-deformation tensor \f$\chi\f$
+         * \param &previousMicroDeformation: The previous value of the micro-deformation tensor \f$\chi\f$
+         * \param &currentTemperature: The current value of the temperature
+         * \param &previousTemperature: The previous value of the temperature
+         * \param &previousStateVariables: The previous values of the state variables
+         * \param &parameters: The parameters for the model
+         * \param &energyDensity: The current value of the Helmholtz free energy density in the current configuration
+         * \param &cauchyStress: The current value of the Cauchy stress
+         * \param &stateVariables: The updated values of the state variables
          */
 
-        const unsigned int *dim = getDimension( );
+        ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::linearElasticity::evaluateEnergy( currentMicroDeformation, parameters, energyDensity, cauchyStress ) );
 
-        setdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( tardigradeVectorTools::inflate( *getGradientMicroDeformation( ), ( *dim ) * ( *dim ), ( *dim ) ) );
+        return;
 
     }
 
-    void aspBase::setdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( const floatMatrix &value ){
+    void aspBase::computeLocalParticleEnergyDensity( const floatType &previousTime, const floatType &deltaTime,
+                                                     const floatVector &currentMicroDeformation, const floatVector &previousMicroDeformation,
+                                                     const floatType &currentTemperature, const floatType &previousTemperature,
+                                                     const floatVector &previousStateVariables,
+                                                     const floatVector &parameters,
+                                                     floatType &energyDensity, floatVector &cauchyStress, floatVector &stateVariables,
+                                                     floatType &logProbabilityRatio ){
         /*!
-         * Set the derivative of the non-local micro deformation w.r.t. the local relative position
-         * vector in the reference configuration
+         * Default function for computing the local particle's energy density in the current configuration
+         * Defaults to a linear-elastic solid with parameters defined in the reference configuration.
          * 
-         * \param &value: The value of the gradient of the non-local micro-deformation w.r.t. the local reference relative
-         *     position vector
+         * \param &previousTime: The previous value of the time
+         * \param &deltaTime: The change in time
+         * \param &currentMicroDeformation: The current value of the micro-deformation tensor \f$\chi\f$
+         * \param &previousMicroDeformation: The previous value of the micro-deformation tensor \f$\chi\f$
+         * \param &currentTemperature: The current value of the temperature
+         * \param &previousTemperature: The previous value of the temperature
+         * \param &previousStateVariables: The previous values of the state variables
+         * \param &parameters: The parameters for the model
+         * \param &energyDensity: The current value of the Helmholtz free energy density in the current configuration
+         * \param &cauchyStress: The current value of the Cauchy stress
+         * \param &stateVariables: The updated values of the state variables
+         * \param &logProbabilityRatio: The natural logarithm of the probability ratio between the new
+         *     probability density and the previous value.
          */
 
-        _dNonLocalMicroDeformationdLocalReferenceRelativePositionVector.second = value;
+        ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::linearElasticity::evaluateEnergy( currentMicroDeformation, parameters, energyDensity, cauchyStress ) );
 
-        _dNonLocalMicroDeformationdLocalReferenceRelativePositionVector.first = true;
+        logProbabilityRatio = 0.;
 
-        addInteractionPairData( &_dNonLocalMicroDeformationdLocalReferenceRelativePositionVector );
+        return;
 
     }
 
-    const floatMatrix* aspBase::getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ){
+    void aspBase::initializeUnitSphere( ){
         /*!
-         * Get the gradient of the non-local micro-deformation w.r.t. the local reference relative position vector
+         * Initialize the unit sphere (i.e. a sphere of radius 1) to integrate over
+         * 
+         * The decomposition is taken from the process-wide cache so that it is only formed once for
+         * each surface element count.
          */
 
-        if ( !_dNonLocalMicroDeformationdLocalReferenceRelativePositionVector.first ){
+        const surfaceIntegration::unitSphereQuadrature *quadrature;
 
-            ERROR_TOOLS_CATCH( setdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) );
+        ERROR_TOOLS_CATCH( quadrature = &surfaceIntegration::getUnitSphereQuadrature( _surfaceElementCount ) );
 
-        }
+        _unitSpherePoints.second = quadrature->points;
 
-        return &_dNonLocalMicroDeformationdLocalReferenceRelativePositionVector.second;
+        _unitSphereConnectivity.second = quadrature->connectivity;
+
+        _unitSpherePoints.first = true;
+
+        _unitSphereConnectivity.first = true;
+
+        return;
 
     }
 
-    void aspBase::setdNonLocalMicroDeformationdLocalReferenceDistanceVector( ){
+    const unsigned int* aspBase::getDimension( ){
         /*!
-         * Set the derivative of the non-local micro deformation w.r.t. the local relative position
-         * vector in the reference configuration given
-         * 
-         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
-         * 
-         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
-         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
-         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
-         * 
-         * \f$dX_I = \Xi_I + D_I - \Xi_I^{\text{NL}} \f$
-         * 
-         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
-         * \f$D_I\f$ is the reference distance, and \f$\Xi_I^{\text{NL}}\f$ is the
-         * non-local relative position vector in the reference configuration
+         * Get the spacial dimension
          */
 
-        setdNonLocalMicroDeformationdLocalReferenceDistanceVector( *getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) );
+        return &_dimension;
 
     }
 
-    void aspBase::setdNonLocalMicroDeformationdLocalReferenceDistanceVector( const floatMatrix &value ){
+    const floatType* aspBase::getRadius( ){
         /*!
-         * Set the derivative of the non-local micro deformation w.r.t. the local distance
-         * vector in the reference configuration
-         * 
-         * \param &value: The value of the gradient of the non-local micro-deformation w.r.t. the relative
-         *     spacing vector in the reference configuration
+         * Get the radius
          */
 
-        _dNonLocalMicroDeformationdLocalReferenceDistanceVector.second = value;
+        return &_radius;
 
-        _dNonLocalMicroDeformationdLocalReferenceDistanceVector.first = true;
+    }
 
-        addInteractionPairData( &_dNonLocalMicroDeformationdLocalReferenceDistanceVector );
+    const floatVector* aspBase::getUnitSpherePoints( ){
+        /*!
+         * Get the points on the unit sphere
+         */
+
+        if ( !_unitSpherePoints.first ){
+
+            ASP_INSTRUMENT_STAGE( UNIT_SPHERE_SETUP );
+
+            ERROR_TOOLS_CATCH( initializeUnitSphere( ) );
+
+        }
+
+        return &_unitSpherePoints.second;
 
     }
 
-    const floatMatrix* aspBase::getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ){
+    const std::vector< unsigned int >* aspBase::getUnitSphereConnectivity( ){
         /*!
-         * Get the gradient of the non-local micro-deformation w.r.t. the local reference distance vector
+         * Get the points on the unit sphere
          */
 
-        if ( !_dNonLocalMicroDeformationdLocalReferenceDistanceVector.first ){
+        if ( !_unitSphereConnectivity.first ){
 
-            ERROR_TOOLS_CATCH( setdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) );
+            ASP_INSTRUMENT_STAGE( UNIT_SPHERE_SETUP );
+
+            ERROR_TOOLS_CATCH( initializeUnitSphere( ) );
 
         }
 
-        return &_dNonLocalMicroDeformationdLocalReferenceDistanceVector.second;
+        return &_unitSphereConnectivity.second;
 
     }
 
-    void aspBase::setdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ){
+    void aspBase::setLocalReferenceNormal( ){
         /*!
-         * Set the derivative of the non-local micro deformation w.r.t. the non-local relative position
-         * vector in the reference configuration given
-         * 
-         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
-         * 
-         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
-         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
-         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
-         * 
-         * \f$dX_I = \Xi_I + D_I - \Xi_I^{\text{NL}} \f$
+         * Set the local reference normal vector
          * 
-         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
-         * \f$D_I\f$ is the reference distance, and \f$\Xi_I^{\text{NL}}\f$ is the
-         * non-local relative position vector in the reference configuration
+         * Because we have a unit sphere centered on zero as a basis the normal vector is the same
+         * as any position vector on the surface of the sphere.
          */
 
-        setdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( -( *getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) ) );
+        floatVector localReferenceNormal;
+
+        ERROR_TOOLS_CATCH( getLocalReferenceNormal( *getLocalSurfaceNodeIndex( ), localReferenceNormal ) );
+
+        setLocalReferenceNormal( localReferenceNormal );
+
+        return;
 
     }
 
-    void aspBase::setdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
+    void aspBase::setLocalReferenceNormal( const floatVector &value ){
         /*!
-         * Set the derivative of the non-local micro deformation w.r.t. the non-local relative position
-         * vector in the reference configuration
+         * Set the local reference normal vector
+         * 
+         * \param &value: The local reference normal vector
          * 
-         * \param &value: The value of the gradient of the non-local micro-deformation w.r.t. the non-local reference relative
-         *     position vector
          */
 
-        _dNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector.second = value;
+        _localReferenceNormal.second = value;
 
-        _dNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector.first = true;
+        _localReferenceNormal.first = true;
 
-        addInteractionPairData( &_dNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector );
+        addSurfacePointData( &_localReferenceNormal );
+
+        return;
 
     }
 
-    const floatMatrix* aspBase::getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ){
+    const floatVector* aspBase::getLocalReferenceNormal( ){
         /*!
-         * Get the gradient of the non-local micro-deformation w.r.t. the non-local reference relative position vector
+         * Get the local reference normal vector
+         * 
+         * Get the local reference normal vector or set it and return it if necessary
          */
 
-        if ( !_dNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector.first ){
+        if ( !_localReferenceNormal.first ){
 
-            ERROR_TOOLS_CATCH( setdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) );
+            ERROR_TOOLS_CATCH( setLocalReferenceNormal( ) );
 
         }
 
-        return &_dNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector.second;
+        return &_localReferenceNormal.second;
 
     }
 
-    void aspBase::setdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ){
+    void aspBase::setLocalSurfaceReferenceRelativePositionVector( ){
         /*!
-         * Set the derivative of the non-local micro deformation w.r.t. the non-local micro-deformation base given
-         * 
-         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
-         * 
-         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
-         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
-         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
+         * Set the local surface relative position vector
          * 
-         * \f$dX_I = \Xi_I + D_I - \Xi_I^{\text{NL}} \f$
+         * \f$\Xi_I = R^{local} N_I\f$
          * 
-         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
-         * \f$D_I\f$ is the reference inter-particle spacing, and \f$\Xi_I^{\text{NL}}\f$ is the
-         * non-local relative position vector in the reference configuration
+         * where \f$R^{local}\f$ is the local radius and \f$N_I\f$ is the local reference normal.
          */
 
-        setdNonLocalMicroDeformationdNonLocalMicroDeformationBase( tardigradeVectorTools::eye< floatType >( getNonLocalMicroDeformation( )->size( ) ) );
+        const floatVector* localReferenceNormal;
+        ERROR_TOOLS_CATCH( localReferenceNormal = getLocalReferenceNormal( ) );
+
+        const floatType* localReferenceRadius;
+        ERROR_TOOLS_CATCH( localReferenceRadius = getLocalReferenceRadius( ) );
+
+        setLocalSurfaceReferenceRelativePositionVector( ( *localReferenceRadius ) * ( *localReferenceNormal ) );
+
+        return;
 
     }
 
-    void aspBase::setdNonLocalMicroDeformationdNonLocalMicroDeformationBase( const floatMatrix &value ){
+    void aspBase::setLocalSurfaceReferenceRelativePositionVector( const floatVector &value ){
         /*!
-         * Set the derivative of the non-local micro deformation w.r.t. the non-local micro-deformation base
+         * Set the local surface relative position vector
          * 
-         * \param &value: The value of the gradient of the non-local micro-deformation w.r.t. the non-local micro-deformation base
-         *     position vector
+         * \param &value: The value of the local surface relative position vector
          */
 
-        _dNonLocalMicroDeformationdNonLocalMicroDeformationBase.second = value;
+        _localSurfaceReferenceRelativePositionVector.second = value;
 
-        _dNonLocalMicroDeformationdNonLocalMicroDeformationBase.first = true;
+        _localSurfaceReferenceRelativePositionVector.first = true;
 
-        addInteractionPairData( &_dNonLocalMicroDeformationdNonLocalMicroDeformationBase );
+        addSurfacePointData( &_localSurfaceReferenceRelativePositionVector );
+
+        return;
 
     }
 
-    const floatMatrix* aspBase::getdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ){
+    const floatVector* aspBase::getLocalSurfaceReferenceRelativePositionVector( ){
         /*!
-         * Get the gradient of the non-local micro-deformation w.r.t. the non-local micro deformation base
+         * Get the value of the local surface reference relative position vector
          */
 
-        if ( !_dNonLocalMicroDeformationdNonLocalMicroDeformationBase.first ){
+        if ( !_localSurfaceReferenceRelativePositionVector.first ){
 
-            ERROR_TOOLS_CATCH( setdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ) );
+            ERROR_TOOLS_CATCH( setLocalSurfaceReferenceRelativePositionVector( ) );
 
         }
 
-        return &_dNonLocalMicroDeformationdNonLocalMicroDeformationBase.second;
+        return &_localSurfaceReferenceRelativePositionVector.second;
 
     }
 
-    void aspBase::setdNonLocalMicroDeformationdGradientMicroDeformation( ){
+    void aspBase::setNonLocalSurfaceReferenceRelativePositionVector( ){
         /*!
-         * Set the derivative of the non-local micro deformation w.r.t. the reference coordinate gradient of the micro-deformation
-         * 
-         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
+         * Set the non-local relative position vector
          * 
-         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
-         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
-         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
+         * \f$\Xi_I^{non-local} = -R^{non-local} N_I\f$
+         * 
+         * where \f$R^{non-local}\f$ is the non-local radius and \f$N_I\f$ is the local reference normal.
+         */
+
+        const floatVector* localReferenceNormal;
+        ERROR_TOOLS_CATCH( localReferenceNormal = getLocalReferenceNormal( ) );
+
+        const floatType* nonLocalReferenceRadius;
+        ERROR_TOOLS_CATCH( nonLocalReferenceRadius = getNonLocalReferenceRadius( ) );
+
+        setNonLocalSurfaceReferenceRelativePositionVector( -( *nonLocalReferenceRadius ) * ( *localReferenceNormal ) );
+
+        return;
+
+    }
+
+    void aspBase::setNonLocalSurfaceReferenceRelativePositionVector( const floatVector &value ){
+        /*!
+         * Set the non-local relative position vector
+         * 
+         * \param &value: The value of the non-local surface reference relative position vector
+         */
+
+        _nonLocalSurfaceReferenceRelativePositionVector.second = value;
+
+        _nonLocalSurfaceReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_nonLocalSurfaceReferenceRelativePositionVector );
+
+        return;
+
+    }
+
+    const floatVector* aspBase::getNonLocalSurfaceReferenceRelativePositionVector( ){
+        /*!
+         * Get the non-local surface reference relative position vector
+         */
+
+        if ( !_nonLocalSurfaceReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setNonLocalSurfaceReferenceRelativePositionVector( ) );
+
+        }
+
+        return &_nonLocalSurfaceReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setLocalReferenceRadius( ){
+        /*!
+         * Set the local reference radius
+         */
+
+        setLocalReferenceRadius( *getRadius( ) );
+
+        return;
+
+    }
+
+    void aspBase::setLocalReferenceRadius( const floatType &value ){
+        /*!
+         * Set the local reference radius
+         * 
+         * \param &value: The value of the local reference radius
+         */
+
+        _localReferenceRadius.second = value;
+
+        _localReferenceRadius.first = true;
+
+        addLocalParticleData( &_localReferenceRadius );
+
+        return;
+
+    }
+
+    const floatType* aspBase::getLocalReferenceRadius( ){
+        /*!
+         * Get the local reference radius
+         */
+
+        if ( !_localReferenceRadius.first ){
+
+            ERROR_TOOLS_CATCH( setLocalReferenceRadius( ) );
+
+        }
+
+        return &_localReferenceRadius.second;
+
+    }
+
+    void aspBase::setNonLocalReferenceRadius( ){
+        /*!
+         * Set the non-local reference radius
+         */
+
+        setNonLocalReferenceRadius( *getRadius( ) );
+
+        return;
+
+    }
+
+    void aspBase::setNonLocalReferenceRadius( const floatType &value ){
+        /*!
+         * Set the non-local reference radius
+         * 
+         * \param &value: The value of the non-local reference radius
+         */
+
+        _nonLocalReferenceRadius.second = value;
+
+        _nonLocalReferenceRadius.first = true;
+
+        addInteractionPairData( &_nonLocalReferenceRadius );
+
+        return;
+
+    }
+
+    const floatType* aspBase::getNonLocalReferenceRadius( ){
+        /*!
+         * Get the local reference radius
+         */
+
+        if ( !_nonLocalReferenceRadius.first ){
+
+            ERROR_TOOLS_CATCH( setNonLocalReferenceRadius( ) );
+
+        }
+
+        return &_nonLocalReferenceRadius.second;
+
+    }
+
+    const floatVector* aspBase::getDeformationGradient( ){
+        /*!
+         * Get the deformation gradient
+         */
+
+        return &_deformationGradient;
+
+    }
+
+    const floatVector* aspBase::getPreviousDeformationGradient( ){
+        /*!
+         * Get the previous deformation gradient
+         */
+
+        return &_previousDeformationGradient;
+
+    }
+
+    const floatVector* aspBase::getPreviousMicroDeformation( ){
+        /*!
+         * Get the previous value of the micro deformation
+         */
+
+        return &_previousMicroDeformation;
+
+    }
+
+    void aspBase::setLocalDeformationGradient( ){
+        /*!
+         * Set the local deformation gradient
+         */
+
+        const floatVector* deformationGradient;
+        ERROR_TOOLS_CATCH( deformationGradient = getDeformationGradient( ) );
+
+        setLocalDeformationGradient( *deformationGradient );
+
+        return;
+
+    }
+
+    void aspBase::setLocalDeformationGradient( const floatVector &value ){
+        /*!
+         * Set the local deformation gradient
+         * 
+         * \param &value: The value of the local deformation gradient
+         */
+
+        _localDeformationGradient.second = value;
+
+        _localDeformationGradient.first = true;
+
+        addLocalParticleData( &_localDeformationGradient );
+
+        return;
+
+    }
+
+    const floatVector* aspBase::getLocalDeformationGradient( ){
+        /*!
+         * Get the local deformation gradient
+         */
+
+        if ( !_localDeformationGradient.first ){
+
+            ERROR_TOOLS_CATCH( setLocalDeformationGradient( ) );
+
+        }
+
+        return &_localDeformationGradient.second;
+
+    }
+
+    void aspBase::setPreviousLocalDeformationGradient( ){
+        /*!
+         * Set the local previous deformation gradient
+         */
+
+        const floatVector* previousDeformationGradient;
+        ERROR_TOOLS_CATCH( previousDeformationGradient = getPreviousDeformationGradient( ) );
+
+        setPreviousLocalDeformationGradient( *previousDeformationGradient );
+
+        return;
+
+    }
+
+    void aspBase::setPreviousLocalDeformationGradient( const floatVector &value ){
+        /*!
+         * Set the local previous deformation gradient
+         * 
+         * \param &value: The value of the local previous deformation gradient
+         */
+
+        _previousLocalDeformationGradient.second = value;
+
+        _previousLocalDeformationGradient.first = true;
+
+        addLocalParticleData( &_previousLocalDeformationGradient );
+
+        return;
+
+    }
+
+    const floatVector* aspBase::getPreviousLocalDeformationGradient( ){
+        /*!
+         * Get the local previous deformation gradient
+         */
+
+        if ( !_previousLocalDeformationGradient.first ){
+
+            ERROR_TOOLS_CATCH( setPreviousLocalDeformationGradient( ) );
+
+        }
+
+        return &_previousLocalDeformationGradient.second;
+
+    }
+
+
+    void aspBase::setLocalMicroDeformation( ){
+        /*!
+         * Set the local micro deformation
+         */
+
+        const floatVector* microDeformation;
+        ERROR_TOOLS_CATCH( microDeformation = getMicroDeformation( ) );
+
+        setLocalMicroDeformation( *microDeformation );
+
+        return;
+
+    }
+
+    void aspBase::setLocalMicroDeformation( const floatVector &value ){
+        /*!
+         * Set the local micro deformation
+         * 
+         * \param &value: The value of the local micro deformation
+         */
+
+        _localMicroDeformation.second = value;
+
+        _localMicroDeformation.first = true;
+
+        addLocalParticleData( &_localMicroDeformation );
+
+        return;
+
+    }
+
+    const floatVector* aspBase::getLocalMicroDeformation( ){
+        /*!
+         * Get the local micro deformation
+         */
+
+        if ( !_localMicroDeformation.first ){
+
+            ERROR_TOOLS_CATCH( setLocalMicroDeformation( ) );
+
+        }
+
+        return &_localMicroDeformation.second;
+
+    }
+
+    void aspBase::setPreviousLocalMicroDeformation( ){
+        /*!
+         * Set the local previous micro deformation
+         */
+
+        const floatVector* previousMicroDeformation;
+        ERROR_TOOLS_CATCH( previousMicroDeformation = getPreviousMicroDeformation( ) );
+
+        setPreviousLocalMicroDeformation( *previousMicroDeformation );
+
+        return;
+
+    }
+
+    void aspBase::setPreviousLocalMicroDeformation( const floatVector &value ){
+        /*!
+         * Set the local previous micro deformation
+         * 
+         * \param &value: The previous local micro deformation
+         */
+
+        _previousLocalMicroDeformation.second = value;
+
+        _previousLocalMicroDeformation.first = true;
+
+        addLocalParticleData( &_previousLocalMicroDeformation );
+
+        return;
+
+    }
+
+    const floatVector* aspBase::getPreviousLocalMicroDeformation( ){
+        /*!
+         * Get the local previous micro deformation
+         */
+
+        if ( !_previousLocalMicroDeformation.first ){
+
+            ERROR_TOOLS_CATCH( setPreviousLocalMicroDeformation( ) );
+
+        }
+
+        return &_previousLocalMicroDeformation.second;
+
+    }
+
+    void aspBase::setLocalReferenceParticleSpacingVector( ){
+        /*!
+         * Set the local particle spacing
+         * 
+         * \f$dX_I = \Xi_I^{local} + D_I - \Xi_I^{non-local}\f$
+         */
+
+        const floatVector* localSurfaceReferenceRelativePositionVector;
+        ERROR_TOOLS_CATCH( localSurfaceReferenceRelativePositionVector = getLocalSurfaceReferenceRelativePositionVector( ) );
+
+        const floatVector* nonLocalSurfaceReferenceRelativePositionVector;
+        ERROR_TOOLS_CATCH( nonLocalSurfaceReferenceRelativePositionVector = getNonLocalSurfaceReferenceRelativePositionVector( ) );
+
+        const floatVector* referenceDistanceVector;
+        ERROR_TOOLS_CATCH( referenceDistanceVector = getReferenceDistanceVector( ) );
+
+        floatVector localReferenceParticleSpacing;
+
+        localReferenceParticleSpacing = ( *localSurfaceReferenceRelativePositionVector )
+                                      + ( *referenceDistanceVector )
+                                      - ( *nonLocalSurfaceReferenceRelativePositionVector );
+
+        setLocalReferenceParticleSpacingVector( localReferenceParticleSpacing );
+
+        return;
+
+    }
+
+    void aspBase::setLocalReferenceParticleSpacingVector( const floatVector &value ){
+        /*!
+         * Set the local particle spacing
+         * 
+         * \param &value: The local particle spacing
+         */
+
+        _localReferenceParticleSpacing.second = value;
+
+        _localReferenceParticleSpacing.first = true;
+
+        addInteractionPairData( &_localReferenceParticleSpacing );
+
+        return;
+
+    }
+
+    const floatVector* aspBase::getLocalReferenceParticleSpacingVector( ){
+        /*!
+         * Get the local reference particle spacing
+         */
+
+        if ( !_localReferenceParticleSpacing.first ){
+
+            ERROR_TOOLS_CATCH( setLocalReferenceParticleSpacingVector( ) );
+
+        }
+
+        return &_localReferenceParticleSpacing.second;
+
+    }
+
+    void aspBase::setNonLocalMicroDeformation( ){
+        /*!
+         * Set the non-local micro deformation given
+         * 
+         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
+         * 
+         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
+         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
+         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
+         * 
+         * \f$dX_I = \Xi_I + D_I - \Xi_I^{\text{NL}} \f$
+         * 
+         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
+         * \f$D_I\f$ is the reference distance, and \f$\Xi_I^{\text{NL}}\f$ is the
+         * non-local relative position vector in the reference configuration
+         */
+
+        const unsigned int *dim = getDimension( );
+
+        const floatVector* localReferenceParticleSpacing;
+        ERROR_TOOLS_CATCH( localReferenceParticleSpacing = getLocalReferenceParticleSpacingVector( ) );
+
+        const floatVector* microDeformationBase;
+        ERROR_TOOLS_CATCH( microDeformationBase = getNonLocalMicroDeformationBase( ) );
+
+        const floatVector* gradientMicroDeformation;
+        ERROR_TOOLS_CATCH( gradientMicroDeformation = getGradientMicroDeformation( ) );
+
+        floatVector nonLocalMicroDeformation = *microDeformationBase;
+
+        for ( unsigned int i = 0; i < ( *dim ); i++ ){
+
+            for ( unsigned int I = 0; I < ( *dim ); I++ ){
+
+                for ( unsigned int J = 0; J < ( *dim ); J++ ){
+
+                    nonLocalMicroDeformation[ ( *dim ) * i + I ]
+                        += ( *gradientMicroDeformation )[ ( *dim ) * ( *dim ) * i + ( *dim ) * I + J ]
+                         * ( *localReferenceParticleSpacing )[ J ];
+
+                }
+
+            }
+
+        }
+
+        setNonLocalMicroDeformation( nonLocalMicroDeformation );
+
+        return;
+
+    }
+
+    void aspBase::setdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ){
+        /*!
+         * Set the derivative of the non-local micro deformation w.r.t. the local relative position
+         * vector in the reference configuration given
+         * 
+         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
+         * 
+         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
+         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
+         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
+         * 
+         * \f$dX_I = \Xi_I + D_I - \Xi_I^{\text{NL}} \f$
+         * 
+         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
+         * \f$D_I\f$ is the reference distance, and \f$\Xi_I^{\text{NL}}\f$ is the
+         * non-local relative position vector in the reference configuration
+         */
+
+        const unsigned int *dim = getDimension( );
+
+        setdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( tardigradeVectorTools::inflate( *getGradientMicroDeformation( ), ( *dim ) * ( *dim ), ( *dim ) ) );
+
+    }
+
+    void aspBase::setdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * Set the derivative of the non-local micro deformation w.r.t. the local relative position
+         * vector in the reference configuration
+         * 
+         * \param &value: The value of the gradient of the non-local micro-deformation w.r.t. the local reference relative
+         *     position vector
+         */
+
+        _dNonLocalMicroDeformationdLocalReferenceRelativePositionVector.second = value;
+
+        _dNonLocalMicroDeformationdLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_dNonLocalMicroDeformationdLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix* aspBase::getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the gradient of the non-local micro-deformation w.r.t. the local reference relative position vector
+         */
+
+        if ( !_dNonLocalMicroDeformationdLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) );
+
+        }
+
+        return &_dNonLocalMicroDeformationdLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setdNonLocalMicroDeformationdLocalReferenceDistanceVector( ){
+        /*!
+         * Set the derivative of the non-local micro deformation w.r.t. the local relative position
+         * vector in the reference configuration given
+         * 
+         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
+         * 
+         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
+         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
+         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
+         * 
+         * \f$dX_I = \Xi_I + D_I - \Xi_I^{\text{NL}} \f$
+         * 
+         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
+         * \f$D_I\f$ is the reference distance, and \f$\Xi_I^{\text{NL}}\f$ is the
+         * non-local relative position vector in the reference configuration
+         */
+
+        setdNonLocalMicroDeformationdLocalReferenceDistanceVector( *getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) );
+
+    }
+
+    void aspBase::setdNonLocalMicroDeformationdLocalReferenceDistanceVector( const floatMatrix &value ){
+        /*!
+         * Set the derivative of the non-local micro deformation w.r.t. the local distance
+         * vector in the reference configuration
+         * 
+         * \param &value: The value of the gradient of the non-local micro-deformation w.r.t. the relative
+         *     spacing vector in the reference configuration
+         */
+
+        _dNonLocalMicroDeformationdLocalReferenceDistanceVector.second = value;
+
+        _dNonLocalMicroDeformationdLocalReferenceDistanceVector.first = true;
+
+        addInteractionPairData( &_dNonLocalMicroDeformationdLocalReferenceDistanceVector );
+
+    }
+
+    const floatMatrix* aspBase::getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ){
+        /*!
+         * Get the gradient of the non-local micro-deformation w.r.t. the local reference distance vector
+         */
+
+        if ( !_dNonLocalMicroDeformationdLocalReferenceDistanceVector.first ){
+
+            ERROR_TOOLS_CATCH( setdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) );
+
+        }
+
+        return &_dNonLocalMicroDeformationdLocalReferenceDistanceVector.second;
+
+    }
+
+    void aspBase::setdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * Set the derivative of the non-local micro deformation w.r.t. the non-local relative position
+         * vector in the reference configuration given
+         * 
+         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
+         * 
+         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
+         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
+         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
+         * 
+         * \f$dX_I = \Xi_I + D_I - \Xi_I^{\text{NL}} \f$
+         * 
+         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
+         * \f$D_I\f$ is the reference distance, and \f$\Xi_I^{\text{NL}}\f$ is the
+         * non-local relative position vector in the reference configuration
+         */
+
+        setdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( -( *getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) ) );
+
+    }
+
+    void aspBase::setdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * Set the derivative of the non-local micro deformation w.r.t. the non-local relative position
+         * vector in the reference configuration
+         * 
+         * \param &value: The value of the gradient of the non-local micro-deformation w.r.t. the non-local reference relative
+         *     position vector
+         */
+
+        _dNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector.second = value;
+
+        _dNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_dNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix* aspBase::getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the gradient of the non-local micro-deformation w.r.t. the non-local reference relative position vector
+         */
+
+        if ( !_dNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) );
+
+        }
+
+        return &_dNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ){
+        /*!
+         * Set the derivative of the non-local micro deformation w.r.t. the non-local micro-deformation base given
+         * 
+         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
+         * 
+         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
+         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
+         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
+         * 
+         * \f$dX_I = \Xi_I + D_I - \Xi_I^{\text{NL}} \f$
+         * 
+         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
+         * \f$D_I\f$ is the reference inter-particle spacing, and \f$\Xi_I^{\text{NL}}\f$ is the
+         * non-local relative position vector in the reference configuration
+         */
+
+        setdNonLocalMicroDeformationdNonLocalMicroDeformationBase( tardigradeVectorTools::eye< floatType >( getNonLocalMicroDeformation( )->size( ) ) );
+
+    }
+
+    void aspBase::setdNonLocalMicroDeformationdNonLocalMicroDeformationBase( const floatMatrix &value ){
+        /*!
+         * Set the derivative of the non-local micro deformation w.r.t. the non-local micro-deformation base
+         * 
+         * \param &value: The value of the gradient of the non-local micro-deformation w.r.t. the non-local micro-deformation base
+         *     position vector
+         */
+
+        _dNonLocalMicroDeformationdNonLocalMicroDeformationBase.second = value;
+
+        _dNonLocalMicroDeformationdNonLocalMicroDeformationBase.first = true;
+
+        addInteractionPairData( &_dNonLocalMicroDeformationdNonLocalMicroDeformationBase );
+
+    }
+
+    const floatMatrix* aspBase::getdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ){
+        /*!
+         * Get the gradient of the non-local micro-deformation w.r.t. the non-local micro deformation base
+         */
+
+        if ( !_dNonLocalMicroDeformationdNonLocalMicroDeformationBase.first ){
+
+            ERROR_TOOLS_CATCH( setdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ) );
+
+        }
+
+        return &_dNonLocalMicroDeformationdNonLocalMicroDeformationBase.second;
+
+    }
+
+    void aspBase::setdNonLocalMicroDeformationdGradientMicroDeformation( ){
+        /*!
+         * Set the derivative of the non-local micro deformation w.r.t. the reference coordinate gradient of the micro-deformation
+         * 
+         * \f$ \chi_{iI}^{\text{NL}} = \chi_{iI}^{\text{NL base}} + \chi_{iI,J} dX_J\f$
+         * 
+         * where \f$ \chi_{iI}^{\text{NL}} \f$ is the non-local micro-deformation, \f$\chi_{iI}^{\text{NL base}}\f$
+         * is the non-local micro-deformation base, \f$\chi_{iI,J}\f$ is the gradient of the micro-deformation w.r.t.
+         * the reference spacial coordinate, and \f$dX_J\f$ is the center-to-center spacing of the two particles defined as
          * 
          * \f$dX_I = \Xi_I + D_I - \Xi_I^{\text{NL}} \f$
          * 
-         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
-         * \f$D_I\f$ is the reference inter-particle spacing, and \f$\Xi_I^{\text{NL}}\f$ is the
-         * non-local relative position vector in the reference configuration
+         * where \f$\Xi_I\f$ is the local relative position vector in the reference configuration,
+         * \f$D_I\f$ is the reference inter-particle spacing, and \f$\Xi_I^{\text{NL}}\f$ is the
+         * non-local relative position vector in the reference configuration
+         */
+
+        const unsigned int *dim = getDimension( );
+
+        const floatVector *dX;
+        ERROR_TOOLS_CATCH( dX = getLocalReferenceParticleSpacingVector( ) );
+
+        floatMatrix value( ( *dim ) * ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( *dim ), 0 ) );
+
+        // The derivative is \f$\delta_{ia} \delta_{IA} dX_B\f$ so only the terms with a = i and A = I are non-zero
+        for ( unsigned int i = 0; i < *dim; i++ ){
+
+            for ( unsigned int I = 0; I < *dim; I++ ){
+
+                for ( unsigned int B = 0; B < *dim; B++ ){
+
+                    value[ ( *dim ) * i + I ][ ( *dim ) * ( *dim ) * i + ( *dim ) * I + B ] = ( *dX )[ B ];
+
+                }
+
+            }
+
+        }
+
+        setdNonLocalMicroDeformationdGradientMicroDeformation( value );
+
+    }
+
+    void aspBase::setdNonLocalMicroDeformationdGradientMicroDeformation( const floatMatrix &value ){
+        /*!
+         * Set the derivative of the non-local micro deformation w.r.t. the reference coordinate gradient of the micro-deformation
+         * 
+         * \param &value: The value of the gradient of the non-local micro-deformation w.r.t. the reference coordinate gradient
+         *     of the micro-deformation.
+         */
+
+        _dNonLocalMicroDeformationdGradientMicroDeformation.second = value;
+
+        _dNonLocalMicroDeformationdGradientMicroDeformation.first = true;
+
+        addInteractionPairData( &_dNonLocalMicroDeformationdGradientMicroDeformation );
+
+    }
+
+    const floatMatrix* aspBase::getdNonLocalMicroDeformationdGradientMicroDeformation( ){
+        /*!
+         * Get the gradient of the non-local micro-deformation w.r.t. the reference coordinate gradient of the micro-deformation
+         */
+
+        if ( !_dNonLocalMicroDeformationdGradientMicroDeformation.first ){
+
+            ERROR_TOOLS_CATCH( setdNonLocalMicroDeformationdGradientMicroDeformation( ) );
+
+        }
+
+        return &_dNonLocalMicroDeformationdGradientMicroDeformation.second;
+
+    }
+
+    void aspBase::setd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ){
+        /*!
+         * Set the second derivative of the non-local micro-deformation w.r.t. the local reference relative position vector and the gradient of the micro deformation.
+         */
+
+        const unsigned int* dim = getDimension( );
+
+        floatMatrix value( getNonLocalMicroDeformation( )->size( ), floatVector( getLocalSurfaceReferenceRelativePositionVector( )->size( ) * getGradientMicroDeformation( )->size( ), 0 ) );
+
+        floatVector eye( ( *dim ) * ( *dim ), 0 );
+        tardigradeVectorTools::eye( eye );
+
+        for ( unsigned int i = 0; i < *dim; i++ ){
+
+            for ( unsigned int I = 0; I < *dim; I++ ){
+
+                for ( unsigned int J = 0; J < *dim; J++ ){
+
+                    for ( unsigned int a = 0; a < *dim; a++ ){
+
+                        for ( unsigned int A = 0; A < *dim; A++ ){
+
+                            for ( unsigned int B = 0; B < *dim; B++ ){
+
+                                value[ ( *dim ) * i + I ][ ( *dim ) * ( *dim ) * ( *dim ) * J + ( *dim ) * ( *dim ) * a + ( *dim ) * A + B ]
+                                    += eye[ ( *dim ) * i + a ] * eye[ ( *dim ) * I + A ] * eye[ ( *dim ) * J + B ];
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        setd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( value );
+
+    }
+
+    void aspBase::setd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( const floatMatrix &value ){
+        /*!
+         * Set the second derivative of the non-local micro-deformation w.r.t. the local reference relative position vector and the gradient of the micro deformation.
+         * 
+         * \param &value: The second derivative of the non-local micro-deformation w.r.t. the local reference relative position vector and the gradient of the micro deformation.
+         */
+
+        _d2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation.second = value;
+
+        _d2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation.first = true;
+
+        addInteractionPairData( &_d2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation );
+
+    }
+
+    const floatMatrix* aspBase::getd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ){
+        /*!
+         * Get the second derivative of the non-local micro-deformation w.r.t. the reference relative position vector and the gradient of the micro deformation.
+         */
+
+        if ( !_d2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation.first ){
+
+            ERROR_TOOLS_CATCH( setd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ) );
+
+        }
+
+        return &_d2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation.second;
+
+    }
+
+    void aspBase::setd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( ){
+        /*!
+         * Set the second derivative of the non-local micro-deformation w.r.t. the non-local reference relative position vector and the gradient of the micro deformation.
+         */
+
+        setd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( -( *getd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ) ) );
+
+    }
+
+    void aspBase::setd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( const floatMatrix &value ){
+        /*!
+         * Set the second derivative of the non-local micro-deformation w.r.t. the non-local reference relative position vector and the gradient of the micro deformation.
+         * 
+         * \param &value: The second derivative of the non-local micro-deformation w.r.t. the non-local reference relative position vector and the gradient of the micro deformation.
+         */
+
+        _d2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation.second = value;
+
+        _d2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation.first = true;
+
+        addInteractionPairData( &_d2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation );
+
+    }
+
+    const floatMatrix* aspBase::getd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( ){
+        /*!
+         * Get the second derivative of the non-local micro-deformation w.r.t. the non-local reference relative position vector and the gradient of the micro deformation.
+         */
+
+        if ( !_d2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation.first ){
+
+            ERROR_TOOLS_CATCH( setd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( ) );
+
+        }
+
+        return &_d2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation.second;
+
+    }
+
+    void aspBase::setd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( ){
+        /*!
+         * Set the second derivative of the non-local micro-deformation w.r.t. the reference distance vector and the gradient of the micro deformation.
+         */
+
+        setd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( *getd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ) );
+
+    }
+
+    void aspBase::setd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( const floatMatrix &value ){
+        /*!
+         * Set the second derivative of the non-local micro-deformation w.r.t. the reference distance vector and the gradient of the micro deformation.
+         * 
+         * \param &value: The second derivative of the non-local micro-deformation w.r.t. the reference distance vector and the gradient of the micro deformation.
+         */
+
+        _d2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation.second = value;
+
+        _d2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation.first = true;
+
+        addInteractionPairData( &_d2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation );
+
+    }
+
+    const floatMatrix* aspBase::getd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( ){
+        /*!
+         * Get the second derivative of the non-local micro-deformation w.r.t. the reference distance vector and the gradient of the micro deformation.
+         */
+
+        if ( !_d2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation.first ){
+
+            ERROR_TOOLS_CATCH( setd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( ) );
+
+        }
+
+        return &_d2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation.second;
+
+    }
+
+    void aspBase::setNonLocalMicroDeformation( const floatVector &value ){
+        /*!
+         * Set the non-local micro deformation
+         * 
+         * \param &value: The value of the non-local micro deformation
+         */
+
+        _nonLocalMicroDeformation.second = value;
+
+        _nonLocalMicroDeformation.first = true;
+
+        addInteractionPairData( &_nonLocalMicroDeformation );
+
+        return;
+
+    }
+
+    const floatVector* aspBase::getNonLocalMicroDeformation( ){
+        /*!
+         * Get the non-local micro deformation tensor
+         */
+
+        if ( !_nonLocalMicroDeformation.first ){
+
+            ERROR_TOOLS_CATCH( setNonLocalMicroDeformation( ) );
+
+        }
+
+        return &_nonLocalMicroDeformation.second;
+
+    }
+
+    const floatVector* aspBase::getNonLocalMicroDeformationBase( ){
+        /*!
+         * Get the base of the non-local micro deformation tensor
+         */
+
+        if ( !_nonLocalMicroDeformationBase.first ){
+
+            ERROR_TOOLS_CATCH( setNonLocalMicroDeformationBase( ) );
+
+        }
+
+        return &_nonLocalMicroDeformationBase.second;
+
+    }
+
+    void aspBase::setNonLocalMicroDeformationBase( ){
+        /*!
+         * Set the non-local micro-deformation tensor base
+         */
+
+        const floatVector *microDeformationTensor;
+        ERROR_TOOLS_CATCH( microDeformationTensor = getMicroDeformation( ) );
+
+        setNonLocalMicroDeformationBase( *microDeformationTensor );
+
+    }
+
+    void aspBase::setNonLocalMicroDeformationBase( const floatVector &value ){
+        /*!
+         * Set the non-local micro-deformation tensor base
+         * 
+         * \param &value: The value of the non-local micro-deformation tensor base
+         */
+
+        _nonLocalMicroDeformationBase.second = value;
+
+        _nonLocalMicroDeformationBase.first = true;
+
+        addInteractionPairData( &_nonLocalMicroDeformationBase );
+
+    }
+
+    void aspBase::setCurrentDistanceVector( ){
+        /*!
+         * Set the current distance vector and the derivatives required by the evaluation mode
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( _evaluationMode ) );
+
+    }
+
+    void aspBase::formCurrentDistanceVector( const evaluationMode &mode ){
+        /*!
+         * Set the current distance vector and its derivatives up to the order of the provided evaluation mode. The
+         * current distance vector and its derivatives w.r.t. the deformation measures are taken from the batched
+         * evaluation of the local surface point if it has been formed with the required derivatives.
+         * 
+         * \param &mode: The highest order of the derivatives to be formed
+         */
+
+        const unsigned int* dim = getDimension( );
+
+        const floatVector* localSurfaceReferenceRelativePositionVector;
+        ERROR_TOOLS_CATCH( localSurfaceReferenceRelativePositionVector = getLocalSurfaceReferenceRelativePositionVector( ) );
+
+        const floatVector* nonLocalSurfaceReferenceRelativePositionVector;
+        ERROR_TOOLS_CATCH( nonLocalSurfaceReferenceRelativePositionVector = getNonLocalSurfaceReferenceRelativePositionVector( ) );
+
+        const floatVector* referenceDistanceVector;
+        ERROR_TOOLS_CATCH( referenceDistanceVector = getReferenceDistanceVector( ) );
+
+        const floatVector* localDeformationGradient;
+        ERROR_TOOLS_CATCH( localDeformationGradient = getLocalDeformationGradient( ) );
+
+        const floatVector* localMicroDeformation;
+        ERROR_TOOLS_CATCH( localMicroDeformation = getLocalMicroDeformation( ) );
+
+        const floatVector* nonLocalMicroDeformation;
+        ERROR_TOOLS_CATCH( nonLocalMicroDeformation = getNonLocalMicroDeformation( ) );
+
+        // Find the current pair in the batched evaluation of the local surface point
+        bool useBatch = false;
+
+        unsigned int batchIndex = 0;
+
+        unsigned int batchSize = 0;
+
+        if ( ( mode != HESSIAN ) && _surfacePointCurrentDistanceVectors.first
+          && ( ( mode == ENERGY ) || _surfacePointdCurrentDistanceVectorsdLocalDeformationGradient.first ) ){
+
+            const std::vector< unsigned int > &nonLocalIndices = _surfacePointCurrentDistanceNonLocalIndices.second;
+
+            auto search = std::find( nonLocalIndices.begin( ), nonLocalIndices.end( ), _nonLocalIndex );
+
+            if ( search != nonLocalIndices.end( ) ){
+
+                useBatch = true;
+
+                batchIndex = search - nonLocalIndices.begin( );
+
+                batchSize = nonLocalIndices.size( );
+
+            }
+
+        }
+
+        // Compute the current distance
+
+        floatVector currentDistanceVector;
+
+        if ( useBatch ){
+
+            currentDistanceVector = floatVector( *dim, 0 );
+
+            for ( unsigned int i = 0; i < ( *dim ); i++ ){
+
+                currentDistanceVector[ i ] = _surfacePointCurrentDistanceVectors.second[ batchSize * i + batchIndex ];
+
+            }
+
+        }
+
+        if ( mode == ENERGY ){
+
+            if ( !useBatch ){
+
+                ERROR_TOOLS_CATCH( tractionSeparation::computeCurrentDistanceGeneral( *localSurfaceReferenceRelativePositionVector,
+                                                                                      *nonLocalSurfaceReferenceRelativePositionVector,
+                                                                                      *referenceDistanceVector,
+                                                                                      *localDeformationGradient,
+                                                                                      *localMicroDeformation,
+                                                                                      *nonLocalMicroDeformation,
+                                                                                      currentDistanceVector ) );
+
+            }
+
+            setCurrentDistanceVector( currentDistanceVector );
+
+            return;
+
+        }
+
+        floatMatrix dddXi, dddXiNL, dddD, dddF, dddchi, dddchiNL;
+
+        floatMatrix d2ddFdXi, d2ddChidXi, d2ddFdXiNL, d2ddChiNLdXiNL, d2ddFdD;
+
+        if ( useBatch ){
+
+            // The gradients w.r.t. the reference vectors are formed from the deformation measures of the pair
+            dddXi    = floatMatrix( *dim, floatVector( *dim, 0 ) );
+
+            dddXiNL  = floatMatrix( *dim, floatVector( *dim, 0 ) );
+
+            dddD     = floatMatrix( *dim, floatVector( *dim, 0 ) );
+
+            dddF     = floatMatrix( *dim, floatVector( ( *dim ) * ( *dim ), 0 ) );
+
+            dddchi   = floatMatrix( *dim, floatVector( ( *dim ) * ( *dim ), 0 ) );
+
+            dddchiNL = floatMatrix( *dim, floatVector( ( *dim ) * ( *dim ), 0 ) );
+
+            for ( unsigned int i = 0; i < ( *dim ); i++ ){
+
+                for ( unsigned int I = 0; I < ( *dim ); I++ ){
+
+                    dddXi[ i ][ I ]   =  ( *localDeformationGradient )[ ( *dim ) * i + I ] - ( *localMicroDeformation )[ ( *dim ) * i + I ];
+
+                    dddXiNL[ i ][ I ] = -( *localDeformationGradient )[ ( *dim ) * i + I ] + ( *nonLocalMicroDeformation )[ ( *dim ) * i + I ];
+
+                    dddD[ i ][ I ]    =  ( *localDeformationGradient )[ ( *dim ) * i + I ];
+
+                }
+
+                for ( unsigned int IA = 0; IA < ( *dim ) * ( *dim ); IA++ ){
+
+                    const unsigned int index = batchSize * ( ( *dim ) * ( *dim ) * i + IA ) + batchIndex;
+
+                    dddF[ i ][ IA ]     = _surfacePointdCurrentDistanceVectorsdLocalDeformationGradient.second[ index ];
+
+                    dddchi[ i ][ IA ]   = _surfacePointdCurrentDistanceVectorsdLocalMicroDeformation.second[ index ];
+
+                    dddchiNL[ i ][ IA ] = _surfacePointdCurrentDistanceVectorsdNonLocalMicroDeformation.second[ index ];
+
+                }
+
+            }
+
+        }
+        else if ( mode == GRADIENT ){
+
+            ERROR_TOOLS_CATCH( tractionSeparation::computeCurrentDistanceGeneral( *localSurfaceReferenceRelativePositionVector,
+                                                                                  *nonLocalSurfaceReferenceRelativePositionVector,
+                                                                                  *referenceDistanceVector,
+                                                                                  *localDeformationGradient,
+                                                                                  *localMicroDeformation,
+                                                                                  *nonLocalMicroDeformation,
+                                                                                  currentDistanceVector,
+                                                                                  dddXi, dddXiNL, dddD, dddF, dddchi, dddchiNL ) );
+
+        }
+        else{
+
+            ERROR_TOOLS_CATCH( tractionSeparation::computeCurrentDistanceGeneral( *localSurfaceReferenceRelativePositionVector,
+                                                                                  *nonLocalSurfaceReferenceRelativePositionVector,
+                                                                                  *referenceDistanceVector,
+                                                                                  *localDeformationGradient,
+                                                                                  *localMicroDeformation,
+                                                                                  *nonLocalMicroDeformation,
+                                                                                  currentDistanceVector,
+                                                                                  dddXi, dddXiNL, dddD, dddF, dddchi, dddchiNL,
+                                                                                  d2ddFdXi, d2ddChidXi, d2ddFdXiNL, d2ddChiNLdXiNL, d2ddFdD ) );
+
+        }
+
+        setCurrentDistanceVector( currentDistanceVector );
+
+        // Set first order derivatives
+        dddXi   += tardigradeVectorTools::dot( dddchiNL, *getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) );
+
+        dddXiNL += tardigradeVectorTools::dot( dddchiNL, *getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) );
+
+        dddD    += tardigradeVectorTools::dot( dddchiNL, *getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) );
+
+        floatMatrix dddChiNLBase = tardigradeVectorTools::dot( dddchiNL, *getdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ) );
+
+        floatMatrix dddGradChi = tardigradeVectorTools::dot( dddchiNL, *getdNonLocalMicroDeformationdGradientMicroDeformation( ) );
+
+        setdCurrentDistanceVectordLocalReferenceRelativePositionVector( dddXi );
+
+        setdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( dddXiNL );
+
+        setdCurrentDistanceVectordLocalReferenceDistanceVector( dddD );
+
+        setdCurrentDistanceVectordLocalDeformationGradient( dddF );
+
+        setdCurrentDistanceVectordLocalMicroDeformation( dddchi );
+
+        setdCurrentDistanceVectordNonLocalMicroDeformationBase( dddChiNLBase );
+
+        setdCurrentDistanceVectordGradientMicroDeformation( dddGradChi );
+
+        if ( mode == GRADIENT ){
+
+            return;
+
+        }
+
+        // Set second order derivatives
+
+        floatMatrix d2ddXiNLdXi( ( *dim ), floatVector( ( *dim ) * ( *dim ), 0 ) );
+
+        floatMatrix d2ddGradChidXi( ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( *dim ) * ( *dim ), 0 ) );
+
+        floatMatrix d2ddXiNLdD( ( *dim ), floatVector( ( *dim ) * ( *dim ), 0 ) );
+
+        floatMatrix d2ddGradChidD( ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( *dim ) * ( *dim ), 0 ) );
+
+        floatMatrix d2ddXiNLdXiNL( ( *dim ), floatVector( ( *dim ) * ( *dim ), 0 ) );
+
+        floatMatrix d2ddChiNLBasedXiNL( ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( *dim ), 0 ) );
+
+        floatMatrix d2ddGradChidXiNL( ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( *dim ) * ( *dim ), 0 ) );
+
+        for ( unsigned int i = 0; i < *dim; i++ ){
+
+            for ( unsigned int I = 0; I < ( *dim ) * ( *dim ); I++ ){
+
+                for ( unsigned int A = 0; A < *dim; A++ ){
+    
+                    for ( unsigned int B = 0; B < *dim; B++ ){
+
+                        d2ddXiNLdXi[ i ][ ( *dim ) * B + A ] += d2ddChiNLdXiNL[ i ][ ( *dim ) * I + B ]
+                                                              * ( *getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) )[ I ][ A ];
+
+                        d2ddXiNLdD[ i ][ ( *dim ) * B + A ] += d2ddChiNLdXiNL[ i ][ ( *dim ) * I + B ]
+                                                             * ( *getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) )[ I ][ A ];
+
+                        d2ddXiNLdXiNL[ i ][ ( *dim ) * B + A ] += d2ddChiNLdXiNL[ i ][ ( *dim ) * I + B ]
+                                                                * ( *getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) )[ I ][ A ]
+                                                                + d2ddChiNLdXiNL[ i ][ ( *dim ) * I + A ]
+                                                                * ( *getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) )[ I ][ B ];
+
+                    }
+
+                    for ( unsigned int B = 0; B < ( *dim ) * ( *dim ); B++ ){
+
+                        d2ddChiNLBasedXiNL[ i ][ ( *dim ) * B + A ] += d2ddChiNLdXiNL[ i ][ ( *dim ) * I + A ]
+                                                                     * ( *getdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ) )[ I ][ B ];
+
+                    }
+
+                    for ( unsigned int B = 0; B < ( *dim ) * ( *dim ) * ( *dim ); B++ ){
+
+                        d2ddGradChidXi[ i ][ ( *dim ) * B + A ] += dddchiNL[ i ][ I ]
+                                                                 * ( *getd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ) )[ I ][ ( *dim ) * ( *dim ) * ( *dim ) * A + B ];
+
+                        d2ddGradChidD[ i ][ ( *dim ) * B + A ] += dddchiNL[ i ][ I ]
+                                                                * ( *getd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( ) )[ I ][ ( *dim ) * ( *dim ) * ( *dim ) * A + B ];
+
+                        d2ddGradChidXiNL[ i ][ ( *dim ) * B + A ] += dddchiNL[ i ][ I ]
+                                                                 * ( *getd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( ) )[ I ][ ( *dim ) * ( *dim ) * ( *dim ) * A + B ]
+                                                                   + d2ddChiNLdXiNL[ i ][ ( *dim ) * I + A ]
+                                                                   * ( *getdNonLocalMicroDeformationdGradientMicroDeformation( ) )[ I ][ B ];
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( d2ddXiNLdXi );
+
+        setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( d2ddFdXi );
+
+        setd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( d2ddChidXi );
+
+        setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( d2ddGradChidXi );
+
+        setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( d2ddXiNLdD );
+
+        setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( d2ddFdD );
+
+        setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( d2ddGradChidD );
+
+        setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( d2ddXiNLdXiNL );
+
+        setd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( d2ddFdXiNL );
+
+        setd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( d2ddChiNLBasedXiNL );
+
+        setd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( d2ddGradChidXiNL );
+
+        return;
+
+    }
+
+    void aspBase::formSurfacePointCurrentDistanceVectors( const std::vector< unsigned int > &nonLocalIndices ){
+        /*!
+         * Form the current distance vectors of the current local surface point with each of the provided non-local
+         * particles in a single batched evaluation. The inputs of each pair are formed with the interaction pair getters
+         * and the pair data is reset after each pair. The derivatives w.r.t. the deformation measures are also formed
+         * unless the evaluation mode is ENERGY. The Hessian evaluation mode isn't batched.
+         * 
+         * The results are used by formCurrentDistanceVector for the pairs of the local surface point and are reset with
+         * the surface point data.
+         * 
+         * \param &nonLocalIndices: The indices of the non-local particles which interact with the local surface point
+         */
+
+        const unsigned int *dim = getDimension( );
+
+        const unsigned int numPairs = nonLocalIndices.size( );
+
+        const unsigned int nonLocalIndex = _nonLocalIndex;
+
+        // The deformation measures of the local particle are shared by all of the pairs
+        floatVector localDeformationGradient, localMicroDeformation;
+
+        ERROR_TOOLS_CATCH( localDeformationGradient = *getLocalDeformationGradient( ) );
+
+        ERROR_TOOLS_CATCH( localMicroDeformation = *getLocalMicroDeformation( ) );
+
+        // Gather the inputs of the pairs as structures of arrays
+        floatVector Xi_1( ( *dim ) * numPairs, 0 );
+
+        floatVector Xi_2( ( *dim ) * numPairs, 0 );
+
+        floatVector D( ( *dim ) * numPairs, 0 );
+
+        floatVector chiNL( ( *dim ) * ( *dim ) * numPairs, 0 );
+
+        for ( unsigned int p = 0; p < numPairs; p++ ){
+
+            _nonLocalIndex = nonLocalIndices[ p ];
+
+            const floatVector* localSurfaceReferenceRelativePositionVector;
+            ERROR_TOOLS_CATCH( localSurfaceReferenceRelativePositionVector = getLocalSurfaceReferenceRelativePositionVector( ) );
+
+            const floatVector* nonLocalSurfaceReferenceRelativePositionVector;
+            ERROR_TOOLS_CATCH( nonLocalSurfaceReferenceRelativePositionVector = getNonLocalSurfaceReferenceRelativePositionVector( ) );
+
+            const floatVector* referenceDistanceVector;
+            ERROR_TOOLS_CATCH( referenceDistanceVector = getReferenceDistanceVector( ) );
+
+            const floatVector* nonLocalMicroDeformation;
+            ERROR_TOOLS_CATCH( nonLocalMicroDeformation = getNonLocalMicroDeformation( ) );
+
+            if ( ( localSurfaceReferenceRelativePositionVector->size( ) != ( *dim ) ) || ( nonLocalSurfaceReferenceRelativePositionVector->size( ) != ( *dim ) )
+              || ( referenceDistanceVector->size( ) != ( *dim ) ) || ( nonLocalMicroDeformation->size( ) != ( *dim ) * ( *dim ) ) ){
+
+                ERROR_TOOLS_CATCH( throw std::runtime_error( "The inputs of the current distance of non-local particle " + std::to_string( _nonLocalIndex ) + " must have the spatial dimension" ) );
+
+            }
+
+            for ( unsigned int I = 0; I < ( *dim ); I++ ){
+
+                Xi_1[ numPairs * I + p ] = ( *localSurfaceReferenceRelativePositionVector )[ I ];
+
+                Xi_2[ numPairs * I + p ] = ( *nonLocalSurfaceReferenceRelativePositionVector )[ I ];
+
+                D[ numPairs * I + p ] = ( *referenceDistanceVector )[ I ];
+
+            }
+
+            for ( unsigned int iI = 0; iI < ( *dim ) * ( *dim ); iI++ ){
+
+                chiNL[ numPairs * iI + p ] = ( *nonLocalMicroDeformation )[ iI ];
+
+            }
+
+            resetInteractionPairData( );
+
+        }
+
+        _nonLocalIndex = nonLocalIndex;
+
+        if ( _evaluationMode == ENERGY ){
+
+            ERROR_TOOLS_CATCH( tractionSeparation::computeCurrentDistanceGeneralBatch( numPairs, Xi_1, Xi_2, D, localDeformationGradient, localMicroDeformation,
+                                                                                       chiNL, _surfacePointCurrentDistanceVectors.second ) );
+
+        }
+        else{
+
+            ERROR_TOOLS_CATCH( tractionSeparation::computeCurrentDistanceGeneralBatch( numPairs, Xi_1, Xi_2, D, localDeformationGradient, localMicroDeformation,
+                                                                                       chiNL, _surfacePointCurrentDistanceVectors.second,
+                                                                                       _surfacePointdCurrentDistanceVectorsdLocalDeformationGradient.second,
+                                                                                       _surfacePointdCurrentDistanceVectorsdLocalMicroDeformation.second,
+                                                                                       _surfacePointdCurrentDistanceVectorsdNonLocalMicroDeformation.second ) );
+
+            _surfacePointdCurrentDistanceVectorsdLocalDeformationGradient.first = true;
+
+            _surfacePointdCurrentDistanceVectorsdLocalMicroDeformation.first = true;
+
+            _surfacePointdCurrentDistanceVectorsdNonLocalMicroDeformation.first = true;
+
+            addSurfacePointData( &_surfacePointdCurrentDistanceVectorsdLocalDeformationGradient );
+
+            addSurfacePointData( &_surfacePointdCurrentDistanceVectorsdLocalMicroDeformation );
+
+            addSurfacePointData( &_surfacePointdCurrentDistanceVectorsdNonLocalMicroDeformation );
+
+        }
+
+        _surfacePointCurrentDistanceNonLocalIndices.second = nonLocalIndices;
+
+        _surfacePointCurrentDistanceNonLocalIndices.first = true;
+
+        _surfacePointCurrentDistanceVectors.first = true;
+
+        addSurfacePointData( &_surfacePointCurrentDistanceNonLocalIndices );
+
+        addSurfacePointData( &_surfacePointCurrentDistanceVectors );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the local and non-local reference relative position vectors
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( HESSIAN ) );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the local and non-local reference relative position vectors
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the local and non-local reference relative position vectors
+         */
+
+        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector.second = value;
+
+        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix* aspBase::getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the gradient of the current distance vector w.r.t. the local and non-local reference relative position vectors
+         */
+
+        if ( !_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( ) );
+
+        }
+
+        return &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the non-local reference relative position vectors twice
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( HESSIAN ) );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the non-local reference relative position vectors twice
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the non-local reference relative position vectors twice
+         */
+
+        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector.second = value;
+
+        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix* aspBase::getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the gradient of the current distance vector w.r.t. the non-local reference relative position vectors twice
+         */
+
+        if ( !_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( ) );
+
+        }
+
+        return &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference relative position vector
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( HESSIAN ) );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference relative position vectors
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the local deformation gradient and the local reference relative position vectors
+         */
+
+        _d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector.second = value;
+
+        _d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix* aspBase::getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference relative position vectors
+         */
+
+        if ( !_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( ) );
+
+        }
+
+        return &_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the non-local micro-deformation base and the non-local reference relative position vector
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( HESSIAN ) );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the non-local micro-deformation base and the non-local reference relative position vectors
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the non-local micro-deformation base and the non-local reference relative position vectors
+         */
+
+        _d2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector.second = value;
+
+        _d2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_d2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix* aspBase::getd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the gradient of the current distance vector w.r.t. the non-local micro-deformation base and the non-local reference relative position vectors
+         */
+
+        if ( !_d2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( ) );
+
+        }
+
+        return &_d2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the non-local reference relative position vector
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( HESSIAN ) );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the non-local reference relative position vectors
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the local deformation gradient and the non-local reference relative position vectors
+         */
+
+        _d2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector.second = value;
+
+        _d2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_d2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix* aspBase::getd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the gradient of the current distance vector w.r.t. the local deformation gradient and the non-local reference relative position vectors
+         */
+
+        if ( !_d2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( ) );
+
+        }
+
+        return &_d2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the local micro-deformation and the local reference relative position vector
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( HESSIAN ) );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the local micro-deformation and the local reference relative position vectors
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the local micro-deformation and the local reference relative position vectors
+         */
+
+        _d2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector.second = value;
+
+        _d2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_d2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix* aspBase::getd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the gradient of the current distance vector w.r.t. the local micro deformation and the local reference relative position vectors
+         */
+
+        if ( !_d2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( ) );
+
+        }
+
+        return &_d2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the local reference relative position vector
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( HESSIAN ) );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the local reference relative position vectors
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the gradient micro-deformation and the local reference relative position vectors
+         */
+
+        _d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector.second = value;
+
+        _d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix* aspBase::getd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the gradient of the current distance vector w.r.t. the gradient micro deformation and the local reference relative position vectors
+         */
+
+        if ( !_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( ) );
+
+        }
+
+        return &_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the non-local reference relative position and local
+         * reference distance vector
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( HESSIAN ) );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( const floatMatrix &value ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the non-local reference relative position vectors and local
+         * reference distance vector
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the non-local reference relative position vector
+         *     and local reference distance vector
+         */
+
+        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector.second = value;
+
+        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector.first = true;
+
+        addInteractionPairData( &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector );
+
+    }
+
+    const floatMatrix* aspBase::getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( ){
+        /*!
+         * Get the gradient of the current distance vector w.r.t. the non-local reference relative position vector and the local
+         *   reference distance vector
+         */
+
+        if ( !_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector.first ){
+
+            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( ) );
+
+        }
+
+        return &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector.second;
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference distance vector
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( HESSIAN ) );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( const floatMatrix &value ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference distance vectors
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the local deformation gradient and the local reference distance vectors
+         */
+
+        _d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector.second = value;
+
+        _d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector.first = true;
+
+        addInteractionPairData( &_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector );
+
+    }
+
+    const floatMatrix* aspBase::getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( ){
+        /*!
+         * Get the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference distance vectors
+         */
+
+        if ( !_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector.first ){
+
+            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( ) );
+
+        }
+
+        return &_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector.second;
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the local reference distance vector
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( HESSIAN ) );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( const floatMatrix &value ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the local reference distance vectors
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the gradient micro-deformation and the local reference distance vectors
+         */
+
+        _d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector.second = value;
+
+        _d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector.first = true;
+
+        addInteractionPairData( &_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector );
+
+    }
+
+    const floatMatrix* aspBase::getd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( ){
+        /*!
+         * Get the gradient of the current distance vector w.r.t. the gradient micro deformation and the local reference distance vectors
+         */
+
+        if ( !_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector.first ){
+
+            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( ) );
+
+        }
+
+        return &_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector.second;
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the non-local reference relative position vector
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( HESSIAN ) );
+
+    }
+
+    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the non-local reference relative position vector
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the gradient micro-deformation and the non-local reference relative position vectors
+         */
+
+        _d2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector.second = value;
+
+        _d2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_d2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix* aspBase::getd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the gradient of the current distance vector w.r.t. the gradient micro deformation and the non-local reference relative position vectors
+         */
+
+        if ( !_d2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( ) );
+
+        }
+
+        return &_d2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setCurrentDistanceVector( const floatVector &value ){
+        /*!
+         * Set the current distance vector
+         * 
+         * \param &value: The value of the current distance vector
+         */
+
+        _currentDistanceVector.second = value;
+
+        _currentDistanceVector.first = true;
+
+        addInteractionPairData( &_currentDistanceVector );
+
+        return;
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordLocalReferenceRelativePositionVector( ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the local reference
+         * relative position vector.
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( std::max( _evaluationMode, GRADIENT ) ) );
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the local reference
+         * relative position vector.
+         * 
+         * \param &value: The derivative of the current distance vector w.r.t. the local
+         *     reference relative position vector
+         */
+
+        _dCurrentDistanceVectordLocalReferenceRelativePositionVector.second = value;
+
+        _dCurrentDistanceVectordLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_dCurrentDistanceVectordLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix *aspBase::getdCurrentDistanceVectordLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the derivative of the current distance vector w.r.t. the local reference
+         * relative position vector.
+         */
+
+        if ( !_dCurrentDistanceVectordLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordLocalReferenceRelativePositionVector( ) )
+
+        }
+
+        return &_dCurrentDistanceVectordLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the non-local reference
+         * relative position vector.
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( std::max( _evaluationMode, GRADIENT ) ) );
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the non-local reference
+         * relative position vector.
+         * 
+         * \param &value: The value of the derivative of the current distance vector w.r.t. the non-local relative position vector.
+         */
+
+        _dCurrentDistanceVectordNonLocalReferenceRelativePositionVector.second = value;
+
+        _dCurrentDistanceVectordNonLocalReferenceRelativePositionVector.first = true;
+
+        addInteractionPairData( &_dCurrentDistanceVectordNonLocalReferenceRelativePositionVector );
+
+    }
+
+    const floatMatrix *aspBase::getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ){
+        /*!
+         * Get the derivative of the current distance vector w.r.t. the non-local reference
+         * relative position vector.
+         */
+
+        if ( !_dCurrentDistanceVectordNonLocalReferenceRelativePositionVector.first ){
+
+            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )
+
+        }
+
+        return &_dCurrentDistanceVectordNonLocalReferenceRelativePositionVector.second;
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordLocalReferenceDistanceVector( ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the reference
+         * distance vector
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( std::max( _evaluationMode, GRADIENT ) ) );
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordLocalReferenceDistanceVector( const floatMatrix &value ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the reference
+         * distance vector
+         * 
+         * \param &value: The derivative of the current distance vector w.r.t. the reference distance vector
+         */
+
+        _dCurrentDistanceVectordLocalReferenceDistanceVector.second = value;
+
+        _dCurrentDistanceVectordLocalReferenceDistanceVector.first = true;
+
+        addInteractionPairData( &_dCurrentDistanceVectordLocalReferenceDistanceVector );
+
+    }
+
+    const floatMatrix *aspBase::getdCurrentDistanceVectordLocalReferenceDistanceVector( ){
+        /*!
+         * Get the derivative of the current distance vector w.r.t. the reference distance vector.
+         */
+
+        if ( !_dCurrentDistanceVectordLocalReferenceDistanceVector.first ){
+
+            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordLocalReferenceDistanceVector( ) )
+
+        }
+
+        return &_dCurrentDistanceVectordLocalReferenceDistanceVector.second;
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordLocalDeformationGradient( ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the local
+         * deformation gradient.
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( std::max( _evaluationMode, GRADIENT ) ) );
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordLocalDeformationGradient( const floatMatrix &value ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the local
+         * deformation gradient.
+         * 
+         * \param &value: The derivative of the current distance vector w.r.t. the local
+         *     deformation gradient.
+         */
+
+        _dCurrentDistanceVectordLocalDeformationGradient.second = value;
+
+        _dCurrentDistanceVectordLocalDeformationGradient.first = true;
+
+        addInteractionPairData( &_dCurrentDistanceVectordLocalDeformationGradient );
+
+    }
+
+    const floatMatrix *aspBase::getdCurrentDistanceVectordLocalDeformationGradient( ){
+        /*!
+         * Get the derivative of the current distance vector w.r.t. the local deformation gradient.
+         */
+
+        if ( !_dCurrentDistanceVectordLocalDeformationGradient.first ){
+
+            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordLocalDeformationGradient( ) )
+
+        }
+
+        return &_dCurrentDistanceVectordLocalDeformationGradient.second;
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordLocalMicroDeformation( ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the local
+         * micro-deformation
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( std::max( _evaluationMode, GRADIENT ) ) );
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordLocalMicroDeformation( const floatMatrix &value ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the local
+         * micro-deformation
+         * 
+         * \param &value: The derivative of the current distance vector w.r.t. the local
+         *     micro-deformation
+         */
+
+        _dCurrentDistanceVectordLocalMicroDeformation.second = value;
+
+        _dCurrentDistanceVectordLocalMicroDeformation.first = true;
+
+        addInteractionPairData( &_dCurrentDistanceVectordLocalMicroDeformation );
+
+    }
+
+    const floatMatrix *aspBase::getdCurrentDistanceVectordLocalMicroDeformation( ){
+        /*!
+         * Get the derivative of the current distance vector w.r.t. the local micro-deformation.
+         */
+
+        if ( !_dCurrentDistanceVectordLocalMicroDeformation.first ){
+
+            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordLocalMicroDeformation( ) )
+
+        }
+
+        return &_dCurrentDistanceVectordLocalMicroDeformation.second;
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordNonLocalMicroDeformationBase( ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the non-local
+         * micro-deformation
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( std::max( _evaluationMode, GRADIENT ) ) );
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordNonLocalMicroDeformationBase( const floatMatrix &value ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the non-local
+         * micro-deformation
+         * 
+         * \param &value: The derivative of the current distance vector w.r.t. the non-local micro-deformation
+         */
+
+        _dCurrentDistanceVectordNonLocalMicroDeformationBase.second = value;
+
+        _dCurrentDistanceVectordNonLocalMicroDeformationBase.first = true;
+
+        addInteractionPairData( &_dCurrentDistanceVectordNonLocalMicroDeformationBase );
+
+    }
+
+    const floatMatrix *aspBase::getdCurrentDistanceVectordNonLocalMicroDeformationBase( ){
+        /*!
+         * Get the derivative of the current distance vector w.r.t. the non-local micro-deformation.
+         */
+
+        if ( !_dCurrentDistanceVectordNonLocalMicroDeformationBase.first ){
+
+            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )
+
+        }
+
+        return &_dCurrentDistanceVectordNonLocalMicroDeformationBase.second;
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordGradientMicroDeformation( ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the reference
+         * spatial gradient of the micro-deformation.
+         */
+
+        ERROR_TOOLS_CATCH( formCurrentDistanceVector( std::max( _evaluationMode, GRADIENT ) ) );
+
+    }
+
+    void aspBase::setdCurrentDistanceVectordGradientMicroDeformation( const floatMatrix &value ){
+        /*!
+         * set the derivative of the current distance vector w.r.t. the reference
+         * spatial gradient of the micro-deformation.
+         * 
+         * \param &value:
+         */
+
+        _dCurrentDistanceVectordGradientMicroDeformation.second = value;
+
+        _dCurrentDistanceVectordGradientMicroDeformation.first = true;
+
+        addInteractionPairData( &_dCurrentDistanceVectordGradientMicroDeformation );
+
+    }
+
+    const floatMatrix *aspBase::getdCurrentDistanceVectordGradientMicroDeformation( ){
+        /*!
+         * Get the derivative of the current distance vector w.r.t. the gradient of the micro-deformation.
+         */
+
+        if ( !_dCurrentDistanceVectordGradientMicroDeformation.first ){
+
+            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordGradientMicroDeformation( ) )
+
+        }
+
+        return &_dCurrentDistanceVectordGradientMicroDeformation.second;
+
+    }
+
+    const floatVector* aspBase::getCurrentDistanceVector( ){
+        /*!
+         * Get the current distance vector
+         */
+
+        if ( !_currentDistanceVector.first ){
+
+            ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+
+        }
+
+        return &_currentDistanceVector.second;
+
+    }
+
+    void aspBase::setLocalCurrentNormal( ){
+        /*!
+         * Set the current local normal and the derivatives required by the evaluation mode
+         */
+
+        ERROR_TOOLS_CATCH( formLocalCurrentNormal( _evaluationMode ) );
+
+    }
+
+    void aspBase::formLocalCurrentNormal( const evaluationMode &mode ){
+        /*!
+         * Set the current local normal and its derivatives if the evaluation mode requires them
+         * 
+         * \param &mode: The highest order of the derivatives to be formed
+         */
+
+        const floatVector* localReferenceNormal;
+        ERROR_TOOLS_CATCH( localReferenceNormal = getLocalReferenceNormal( ) );
+
+        const floatVector* localMicroDeformation;
+        ERROR_TOOLS_CATCH( localMicroDeformation = getLocalMicroDeformation( ) );
+
+        floatVector dan, localCurrentNormal;
+
+        if ( mode == ENERGY ){
+
+            ERROR_TOOLS_CATCH( tractionSeparation::computeNansonsRelation( *localMicroDeformation, *localReferenceNormal, dan ) );
+
+            setLocalCurrentNormal( dan / tardigradeVectorTools::l2norm( dan ) );
+
+            return;
+
+        }
+
+        floatMatrix ddandChi, ddandN;
+
+        ERROR_TOOLS_CATCH( tractionSeparation::computeNansonsRelation( *localMicroDeformation, *localReferenceNormal,
+                                                                       dan, ddandChi, ddandN ) );
+
+        floatType da = tardigradeVectorTools::l2norm( dan );
+
+        localCurrentNormal = dan / da;
+
+        floatMatrix dndChi = ddandChi / da - tardigradeVectorTools::dyadic( dan, tardigradeVectorTools::Tdot( ddandChi, localCurrentNormal ) ) / ( da * da );
+
+        floatMatrix dndN = ddandN / da - tardigradeVectorTools::dyadic( dan, tardigradeVectorTools::Tdot( ddandN, localCurrentNormal ) ) / ( da * da );
+
+        setLocalCurrentNormal( localCurrentNormal );
+
+        setdLocalCurrentNormaldLocalMicroDeformation( dndChi );
+
+        setdLocalCurrentNormaldLocalReferenceNormal( dndN );
+
+        return;
+
+    }
+
+    void aspBase::setLocalCurrentNormal( const floatVector &value ){
+        /*!
+         * Set the current local normal
+         * 
+         * \param &value: The value of the local current normal
+         */
+
+        _localCurrentNormal.second = value;
+
+        _localCurrentNormal.first = true;
+
+        addSurfacePointData( &_localCurrentNormal );
+
+        return;
+
+    }
+
+    const floatVector* aspBase::getLocalCurrentNormal( ){
+        /*!
+         * Get the local current normal vector
+         */
+
+        if ( !_localCurrentNormal.first ){
+
+            ERROR_TOOLS_CATCH( setLocalCurrentNormal( ) );
+
+        }
+
+        return &_localCurrentNormal.second;
+
+    }
+
+    void aspBase::setdLocalCurrentNormaldLocalReferenceNormal( ){
+        /*!
+         * Set the derivative of the local current normal vector w.r.t. the local reference normal
+         */
+
+        ERROR_TOOLS_CATCH( formLocalCurrentNormal( GRADIENT ) );
+
+    }
+
+    void aspBase::setdLocalCurrentNormaldLocalReferenceNormal( const floatMatrix &value ){
+        /*!
+         * Set the derivative of the local current normal vector w.r.t. the local reference normal
+         * 
+         * \param &value: The gradient of the local current normal w.r.t. the reference current normal
+         */
+
+        _dLocalCurrentNormaldLocalReferenceNormal.second = value;
+
+        _dLocalCurrentNormaldLocalReferenceNormal.first = true;
+
+        addSurfacePointData( &_dLocalCurrentNormaldLocalReferenceNormal );
+
+    }
+
+    const floatMatrix* aspBase::getdLocalCurrentNormaldLocalReferenceNormal( ){
+        /*!
+         * Get the derivative of the local current normal w.r.t. the local reference normal
+         */
+
+        if ( !_dLocalCurrentNormaldLocalReferenceNormal.first ){
+
+            ERROR_TOOLS_CATCH( setdLocalCurrentNormaldLocalReferenceNormal( ) );
+
+        }
+
+        return &_dLocalCurrentNormaldLocalReferenceNormal.second;
+
+    }
+
+    void aspBase::setdLocalCurrentNormaldLocalMicroDeformation( ){
+        /*!
+         * Set the derivative of the local current normal vector w.r.t. the local micro-deformation
+         */
+
+        ERROR_TOOLS_CATCH( formLocalCurrentNormal( GRADIENT ) );
+
+    }
+
+    void aspBase::setdLocalCurrentNormaldLocalMicroDeformation( const floatMatrix &value ){
+        /*!
+         * Set the derivative of the local current normal vector w.r.t. the local micro-deformation
+         * 
+         * \param &value: The gradient of the local current normal w.r.t. the local micro-deformation
+         */
+
+        _dLocalCurrentNormaldLocalMicroDeformation.second = value;
+
+        _dLocalCurrentNormaldLocalMicroDeformation.first = true;
+
+        addSurfacePointData( &_dLocalCurrentNormaldLocalMicroDeformation );
+
+    }
+
+    const floatMatrix* aspBase::getdLocalCurrentNormaldLocalMicroDeformation( ){
+        /*!
+         * Get the derivative of the local current normal w.r.t. the local micro-deformation
+         */
+
+        if ( !_dLocalCurrentNormaldLocalMicroDeformation.first ){
+
+            ERROR_TOOLS_CATCH( setdLocalCurrentNormaldLocalMicroDeformation( ) );
+
+        }
+
+        return &_dLocalCurrentNormaldLocalMicroDeformation.second;
+
+    }
+
+    void aspBase::getLocalReferenceNormal( const unsigned int &index, floatVector &localReferenceNormal ){
+        /*!
+         * compute the local reference normal at the referenced surface point index
+         * 
+         * \param &index: The index of the local surface point
+         * \param &localReferenceNormal: The resulting local reference normal vector
+         */
+
+        const unsigned int *dim = getDimension( );
+
+        const floatVector* unitSpherePoints;
+        ERROR_TOOLS_CATCH( unitSpherePoints = getUnitSpherePoints( ) );
+
+        if ( ( *dim ) * ( index + 1 ) > unitSpherePoints->size( ) ){
+
+            std::string message = "The requested index is greater than the number of points available on the unit sphere.\n";
+            message            += "  index:            " + std::to_string( index ) + "\n";
+            message            += "  number of points: " + std::to_string( unitSpherePoints->size( ) / ( *dim ) );
+
+            ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+        }
+
+        localReferenceNormal = floatVector( unitSpherePoints->begin( ) + ( *dim ) * index,
+                                            unitSpherePoints->begin( ) + ( *dim ) * ( index + 1 ) );
+
+        localReferenceNormal /= tardigradeVectorTools::l2norm( localReferenceNormal );
+
+        return;
+
+    }
+
+    void aspBase::getLocalCurrentNormal( const unsigned int &index, floatVector &normal ){
+        /*!
+         * compute the local current normal at the referenced surface point index
+         * 
+         * \param &index: The index of the local surface point
+         * \param &normal: The resulting normal vector
+         */
+
+        floatVector referenceNormal;
+        ERROR_TOOLS_CATCH( getLocalReferenceNormal( index, referenceNormal ) );
+
+        const floatVector* localMicroDeformation;
+        ERROR_TOOLS_CATCH( localMicroDeformation = getLocalMicroDeformation( ) );
+
+        ERROR_TOOLS_CATCH( tractionSeparation::computeNansonsRelation( *localMicroDeformation, referenceNormal,
+                                                                       normal ) );
+
+        normal /= tardigradeVectorTools::l2norm( normal );
+
+        return;
+
+    }
+
+    void aspBase::setSurfaceParameters( ){
+        /*!
+         * Set the surface parameters for the integrand
+         */
+
+        setSurfaceParameters( floatVector( 0, 0 ) );        
+
+        return;
+    }
+
+    void aspBase::setSurfaceParameters( const floatVector &value ){
+        /*!
+         * Set the surface parameters for the integrand
+         * 
+         * \param &value: The values of the surface parameters
+         */
+
+        _surfaceParameters.second = value;
+
+        _surfaceParameters.first = true;
+
+        addInteractionPairData( &_surfaceParameters );
+
+        return;
+    }
+
+    const floatVector* aspBase::getSurfaceParameters( ){
+        /*!
+         * Get the surface parameters
+         */
+
+        if ( !_surfaceParameters.first ){
+
+            ERROR_TOOLS_CATCH( setSurfaceParameters( ) );
+
+        }
+
+        return &_surfaceParameters.second;
+
+    }
+
+    void aspBase::setReferenceDistanceVector( ){
+        /*!
+         * Set the initial distance between two particles
+         */
+
+
+        setReferenceDistanceVector( floatVector( *getDimension( ), 0. ) );
+
+        return;
+
+    }
+
+    void aspBase::setReferenceDistanceVector( const floatVector &value ){
+        /*!
+         * Set the initial distance between two particles
+         * 
+         * \param &value: The value of the reference distance vector
+         */
+
+        _referenceDistanceVector.second = value;
+
+        _referenceDistanceVector.first = true;
+
+        addInteractionPairData( &_referenceDistanceVector );
+
+        return;
+
+    }
+
+    const floatVector* aspBase::getReferenceDistanceVector( ){
+        /*!
+         * Get the initial distance between two particles
+         */
+
+        if ( !_referenceDistanceVector.first ){
+
+            ERROR_TOOLS_CATCH( setReferenceDistanceVector( ) );
+
+        }
+
+        return &_referenceDistanceVector.second;
+
+    }
+
+    void aspBase::resetInteractionPairData( ){
+        /*!
+         * Reset the interaction pair data to the base state
+         */
+
+        for ( auto d = _interactionPairData.begin( ); d != _interactionPairData.end( ); d++ ){
+
+            ( *d )->clear( );
+
+        }
+
+        _interactionPairData.clear( );
+
+        return;
+
+    }
+
+    void aspBase::resetSurfacePointData( ){
+        /*!
+         * Reset the surface point data to the base state
+         */
+
+        // Reset the interaction pair
+        resetInteractionPairData( );
+
+        for ( auto d = _surfacePointData.begin( ); d != _surfacePointData.end( ); d++ ){
+
+            ( *d )->clear( );
+
+        }
+
+        _surfacePointData.clear( );
+
+        return;
+
+    }
+
+    void aspBase::resetLocalParticleData( ){
+        /*!
+         * Reset the local particle data to the base state
+         */
+
+        resetSurfacePointData( );
+
+        for ( auto d = _localParticleData.begin( ); d != _localParticleData.end( ); d++ ){
+
+            ( *d )->clear( );
+
+        }
+
+        _localParticleData.clear( );
+
+        return;
+
+    }
+
+    void aspBase::resetAssembledData( ){
+        /*!
+         * Reset the assembled quantities of all of the particles along with the local particle data
+         */
+
+        resetLocalParticleData( );
+
+        for ( auto d = _assembledData.begin( ); d != _assembledData.end( ); d++ ){
+
+            ( *d )->clear( );
+
+        }
+
+        _assembledData.clear( );
+
+        return;
+
+    }
+
+    namespace{
+
+        //! The kinds of objects which are stored in a checkpoint
+        enum checkpointKind{ ASPBASE_CHECKPOINT = 1, INTEGRATION_POINT_STATE_CHECKPOINT = 2 };
+
+        const char checkpointMagic[ 8 ] = { 'A', 'S', 'P', 'C', 'K', 'P', 'T', '\0' }; //!< The identifier at the start of every checkpoint
+
+        const uint64_t checkpointByteOrderMarker = 0x0102030405060708; //!< Written in the byte order of the machine so that checkpoints from machines of the other byte order are rejected
+
+        class checkpointWriter{
+            /*!
+             * Write a binary checkpoint. The checkpoint starts with a header of the identifier, the byte order marker, the
+             * format version, the kind of the object and the size of floatType. It is followed by arrays which are each stored as their number of
+             * values and their raw values padded to eight bytes so that every array of a memory-mapped checkpoint is aligned.
+             */
+
+            public:
+
+                checkpointWriter( const std::string &filename, const checkpointKind &kind ) : _file( filename, std::ios::binary | std::ios::trunc ){
+
+                    if ( !_file ){
+
+                        throw std::runtime_error( "The checkpoint " + filename + " could not be opened for writing" );
+
+                    }
+
+                    _file.write( checkpointMagic, sizeof( checkpointMagic ) );
+
+                    writeValue( checkpointByteOrderMarker );
+
+                    uint32_t header[ 2 ] = { checkpointVersion, static_cast< uint32_t >( kind ) };
+
+                    _file.write( reinterpret_cast< const char* >( header ), sizeof( header ) );
+
+                    writeValue( uint64_t( sizeof( floatType ) ) );
+
+                }
+
+                void writeValue( const uint64_t &value ){
+
+                    _file.write( reinterpret_cast< const char* >( &value ), sizeof( value ) );
+
+                }
+
+                template< typename T >
+                void writeArray( const std::vector< T > &values ){
+
+                    writeValue( values.size( ) );
+
+                    _file.write( reinterpret_cast< const char* >( values.data( ) ), values.size( ) * sizeof( T ) );
+
+                    const char padding[ 8 ] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+                    _file.write( padding, ( 8 - ( values.size( ) * sizeof( T ) ) % 8 ) % 8 );
+
+                }
+
+                template< typename T >
+                void writeNestedArray( const std::vector< std::vector< T > > &values ){
+
+                    std::vector< uint64_t > offsets( values.size( ) + 1, 0 );
+
+                    for ( unsigned int i = 0; i < values.size( ); i++ ){
+
+                        offsets[ i + 1 ] = offsets[ i ] + values[ i ].size( );
+
+                    }
+
+                    std::vector< T > flattened;
+
+                    flattened.reserve( offsets.back( ) );
+
+                    for ( auto v = values.begin( ); v != values.end( ); v++ ){
+
+                        flattened.insert( flattened.end( ), v->begin( ), v->end( ) );
+
+                    }
+
+                    writeArray( offsets );
+
+                    writeArray( flattened );
+
+                }
+
+                void close( ){
+
+                    _file.close( );
+
+                    if ( !_file ){
+
+                        throw std::runtime_error( "The checkpoint could not be written" );
+
+                    }
+
+                }
+
+            private:
+
+                std::ofstream _file; //!< The checkpoint file
+
+        };
+
+        class memoryMappedFile{
+            /*!
+             * A read-only memory mapping of a file which is unmapped when the object is destroyed
+             */
+
+            public:
+
+                memoryMappedFile( const std::string &filename ){
+
+                    int descriptor = open( filename.c_str( ), O_RDONLY );
+
+                    if ( descriptor < 0 ){
+
+                        throw std::runtime_error( "The checkpoint " + filename + " could not be opened for reading" );
+
+                    }
+
+                    struct stat status;
+
+                    if ( fstat( descriptor, &status ) != 0 ){
+
+                        ::close( descriptor );
+
+                        throw std::runtime_error( "The size of the checkpoint " + filename + " could not be determined" );
+
+                    }
+
+                    _size = status.st_size;
+
+                    if ( _size > 0 ){
+
+                        void *mapping = mmap( NULL, _size, PROT_READ, MAP_PRIVATE, descriptor, 0 );
+
+                        _data = ( mapping == MAP_FAILED ) ? NULL : static_cast< const char* >( mapping );
+
+                    }
+
+                    ::close( descriptor );
+
+                    if ( !_data ){
+
+                        throw std::runtime_error( "The checkpoint " + filename + " could not be memory-mapped" );
+
+                    }
+
+                }
+
+                ~memoryMappedFile( ){
+
+                    if ( _data ){
+
+                        munmap( const_cast< char* >( _data ), _size );
+
+                    }
+
+                }
+
+                memoryMappedFile( const memoryMappedFile & ) = delete;
+
+                memoryMappedFile &operator=( const memoryMappedFile & ) = delete;
+
+                const char *data( ) const{ return _data; }
+
+                uint64_t size( ) const{ return _size; }
+
+            private:
+
+                const char *_data = NULL; //!< The mapped contents of the file
+
+                uint64_t _size = 0; //!< The size of the file in bytes
+
+        };
+
+        class checkpointReader{
+            /*!
+             * Read a binary checkpoint written by checkpointWriter. The file is memory-mapped and the arrays are copied
+             * directly from the mapping. The mapping is owned by a member so that it is released if the header is rejected.
+             */
+
+            public:
+
+                checkpointReader( const std::string &filename, const checkpointKind &kind ) : _mapping( filename ), _data( _mapping.data( ) ), _size( _mapping.size( ) ){
+
+                    if ( ( _size < sizeof( checkpointMagic ) + sizeof( uint64_t ) + 2 * sizeof( uint32_t ) ) || ( std::memcmp( _data, checkpointMagic, sizeof( checkpointMagic ) ) != 0 ) ){
+
+                        throw std::runtime_error( filename + " is not an asp checkpoint" );
+
+                    }
+
+                    _position = sizeof( checkpointMagic );
+
+                    if ( readValue( ) != checkpointByteOrderMarker ){
+
+                        throw std::runtime_error( "The checkpoint " + filename + " was written with a different byte order" );
+
+                    }
+
+                    uint32_t header[ 2 ];
+
+                    std::memcpy( header, advance( sizeof( header ) ), sizeof( header ) );
+
+                    if ( header[ 0 ] != checkpointVersion ){
+
+                        throw std::runtime_error( "The checkpoint " + filename + " has version " + std::to_string( header[ 0 ] ) + " but version " + std::to_string( checkpointVersion ) + " is required" );
+
+                    }
+
+                    if ( header[ 1 ] != static_cast< uint32_t >( kind ) ){
+
+                        throw std::runtime_error( "The checkpoint " + filename + " stores a different kind of object" );
+
+                    }
+
+                    if ( readValue( ) != sizeof( floatType ) ){
+
+                        throw std::runtime_error( "The checkpoint " + filename + " was written with a different floatType" );
+
+                    }
+
+                }
+
+                checkpointReader( const checkpointReader & ) = delete;
+
+                checkpointReader &operator=( const checkpointReader & ) = delete;
+
+                uint64_t readValue( ){
+
+                    uint64_t value;
+
+                    std::memcpy( &value, advance( sizeof( value ) ), sizeof( value ) );
+
+                    return value;
+
+                }
+
+                template< typename T >
+                void readArray( std::vector< T > &values ){
+
+                    const uint64_t size = readValue( );
+
+                    if ( size > ( _size - _position ) / sizeof( T ) ){
+
+                        throw std::runtime_error( "The checkpoint is truncated" );
+
+                    }
+
+                    const T *begin = reinterpret_cast< const T* >( advance( size * sizeof( T ) ) );
+
+                    values.assign( begin, begin + size );
+
+                    advance( ( 8 - ( size * sizeof( T ) ) % 8 ) % 8 );
+
+                }
+
+                template< typename T >
+                void readNestedArray( std::vector< std::vector< T > > &values ){
+
+                    std::vector< uint64_t > offsets;
+
+                    std::vector< T > flattened;
+
+                    readArray( offsets );
+
+                    readArray( flattened );
+
+                    if ( offsets.empty( ) || ( offsets.back( ) != flattened.size( ) ) ){
+
+                        throw std::runtime_error( "The checkpoint is corrupted" );
+
+                    }
+
+                    values.resize( offsets.size( ) - 1 );
+
+                    for ( unsigned int i = 0; i < values.size( ); i++ ){
+
+                        if ( offsets[ i ] > offsets[ i + 1 ] ){
+
+                            throw std::runtime_error( "The checkpoint is corrupted" );
+
+                        }
+
+                        values[ i ].assign( flattened.begin( ) + offsets[ i ], flattened.begin( ) + offsets[ i + 1 ] );
+
+                    }
+
+                }
+
+            private:
+
+                const char *advance( const uint64_t &bytes ){
+
+                    if ( bytes > _size - _position ){
+
+                        throw std::runtime_error( "The checkpoint is truncated" );
+
+                    }
+
+                    const char *current = _data + _position;
+
+                    _position += bytes;
+
+                    return current;
+
+                }
+
+                memoryMappedFile _mapping; //!< The memory-mapped checkpoint
+
+                const char *_data; //!< The contents of the checkpoint
+
+                uint64_t _size; //!< The size of the checkpoint in bytes
+
+                uint64_t _position = 0; //!< The position of the next value in bytes
+
+        };
+
+    }
+
+    void aspBase::writeCheckpoint( const std::string &filename ){
+        /*!
+         * Write a binary checkpoint of the deformation measures, the unit sphere, the neighbor lists and the assembled local
+         * particle quantities. Quantities which have not been formed are not computed and are recorded as missing.
+         * 
+         * The surface responses and any quantities owned by derived classes are not stored.
+         * 
+         * \param &filename: The name of the checkpoint file
+         */
+
+        checkpointWriter writer( filename, ASPBASE_CHECKPOINT );
+
+        writer.writeArray( _previousDeformationGradient );
+
+        writer.writeArray( _previousMicroDeformation );
+
+        writer.writeArray( _previousGradientMicroDeformation );
+
+        writer.writeArray( _deformationGradient );
+
+        writer.writeArray( _microDeformation );
+
+        writer.writeArray( _gradientMicroDeformation );
+
+        writer.writeValue( _unitSpherePoints.first && _unitSphereConnectivity.first );
+
+        writer.writeArray( _unitSpherePoints.second );
+
+        writer.writeArray( _unitSphereConnectivity.second );
+
+        writer.writeValue( _localParticleNeighbors.first );
+
+        writer.writeNestedArray( _localParticleNeighbors.second );
+
+        const bool assembled = _assembledLocalParticleEnergies.first && _assembledLocalParticleMicroCauchyStress.first &&
+                               _assembledLocalParticleVolumes.first && _assembledLocalParticleLogProbabilityRatios.first;
+
+        writer.writeValue( assembled );
+
+        writer.writeArray( _assembledLocalParticleEnergies.second );
+
+        writer.writeNestedArray( _assembledLocalParticleMicroCauchyStress.second );
+
+        writer.writeArray( _assembledLocalParticleVolumes.second );
+
+        writer.writeArray( _assembledLocalParticleLogProbabilityRatios.second );
+
+        writer.close( );
+
+    }
+
+    void aspBase::readCheckpoint( const std::string &filename ){
+        /*!
+         * Restore the quantities stored by writeCheckpoint. The assembled data is reset before the stored quantities are
+         * restored so a following call of setDeformation with the stored deformation measures re-uses the restored
+         * assembled quantities.
+         * 
+         * The whole checkpoint is read and checked before any of the quantities are restored so that this object is left
+         * unchanged if the checkpoint is rejected.
+         * 
+         * \param &filename: The name of the checkpoint file
+         */
+
+        floatVector previousDeformationGradient, previousMicroDeformation, previousGradientMicroDeformation;
+
+        floatVector deformationGradient, microDeformation, gradientMicroDeformation;
+
+        floatVector unitSpherePoints;
+
+        std::vector< unsigned int > unitSphereConnectivity;
+
+        std::vector< std::vector< unsigned int > > localParticleNeighbors;
+
+        floatVector energies, volumes, logProbabilityRatios;
+
+        floatMatrix microCauchyStresses;
+
+        bool unitSphere, neighbors, assembled;
+
+        {
+
+            checkpointReader reader( filename, ASPBASE_CHECKPOINT );
+
+            reader.readArray( previousDeformationGradient );
+
+            reader.readArray( previousMicroDeformation );
+
+            reader.readArray( previousGradientMicroDeformation );
+
+            reader.readArray( deformationGradient );
+
+            reader.readArray( microDeformation );
+
+            reader.readArray( gradientMicroDeformation );
+
+            unitSphere = reader.readValue( );
+
+            reader.readArray( unitSpherePoints );
+
+            reader.readArray( unitSphereConnectivity );
+
+            neighbors = reader.readValue( );
+
+            reader.readNestedArray( localParticleNeighbors );
+
+            assembled = reader.readValue( );
+
+            reader.readArray( energies );
+
+            reader.readNestedArray( microCauchyStresses );
+
+            reader.readArray( volumes );
+
+            reader.readArray( logProbabilityRatios );
+
+        }
+
+        ERROR_TOOLS_CATCH( resetAssembledData( ) );
+
+        _previousDeformationGradient.swap( previousDeformationGradient );
+
+        _previousMicroDeformation.swap( previousMicroDeformation );
+
+        _previousGradientMicroDeformation.swap( previousGradientMicroDeformation );
+
+        _deformationGradient.swap( deformationGradient );
+
+        _microDeformation.swap( microDeformation );
+
+        _gradientMicroDeformation.swap( gradientMicroDeformation );
+
+        _unitSpherePoints.second.swap( unitSpherePoints );
+
+        _unitSphereConnectivity.second.swap( unitSphereConnectivity );
+
+        _unitSpherePoints.first = unitSphere;
+
+        _unitSphereConnectivity.first = unitSphere;
+
+        if ( neighbors ){
+
+            // The restored lists are reset with the other assembled quantities when the deformation changes
+            setLocalParticleNeighbors( localParticleNeighbors );
+
+        }
+
+        if ( assembled ){
+
+            _assembledLocalParticleEnergies.second.swap( energies );
+
+            _assembledLocalParticleEnergies.first = true;
+
+            addAssembledData( &_assembledLocalParticleEnergies );
+
+            _assembledLocalParticleMicroCauchyStress.second.swap( microCauchyStresses );
+
+            _assembledLocalParticleMicroCauchyStress.first = true;
+
+            addAssembledData( &_assembledLocalParticleMicroCauchyStress );
+
+            _assembledLocalParticleVolumes.second.swap( volumes );
+
+            _assembledLocalParticleVolumes.first = true;
+
+            addAssembledData( &_assembledLocalParticleVolumes );
+
+            _assembledLocalParticleLogProbabilityRatios.second.swap( logProbabilityRatios );
+
+            _assembledLocalParticleLogProbabilityRatios.first = true;
+
+            addAssembledData( &_assembledLocalParticleLogProbabilityRatios );
+
+        }
+
+    }
+
+    void aspBase::setDeformationChangeTolerance( const floatType &value ){
+        /*!
+         * Set the largest change in a component of the deformation measures which setDeformation treats as no change. The
+         * quantities assembled for the stored deformation measures are re-used by calls of setDeformation with measures
+         * which are within the tolerance.
+         * 
+         * \param &value: The tolerance of the change in the deformation measures
+         */
+
+        if ( value < 0 ){
+
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "The deformation change tolerance must be non-negative but is " + std::to_string( value ) ) );
+
+        }
+
+        _deformationChangeTolerance = value;
+
+    }
+
+    void aspBase::setDeformation( const floatVector &previousDeformationGradient, const floatVector &previousMicroDeformation,
+                                  const floatVector &previousGradientMicroDeformation, const floatVector &deformationGradient,
+                                  const floatVector &microDeformation, const floatVector &gradientMicroDeformation ){
+        /*!
+         * Set the deformation measures of the increment. If no component of the measures has changed by more than
+         * _deformationChangeTolerance the measures are left unchanged and the previously assembled quantities are
+         * re-used. Otherwise the assembled quantities are reset so that they are re-computed when they are next requested.
+         * 
+         * Quantities which only depend on the reference configuration are not affected by the deformation. Changes in
+         * any other input (e.g. the time or temperature) must be followed by a call to resetAssembledData.
+         * 
+         * \param &previousDeformationGradient: The deformation gradient at the start of the increment
+         * \param &previousMicroDeformation: The micro deformation at the start of the increment
+         * \param &previousGradientMicroDeformation: The spatial gradient of the micro deformation at the start of the increment
+         * \param &deformationGradient: The deformation gradient at the end of the increment
+         * \param &microDeformation: The micro deformation at the end of the increment
+         * \param &gradientMicroDeformation: The spatial gradient of the micro deformation at the end of the increment
+         */
+
+        auto hasChanged = [ & ]( const floatVector &current, const floatVector &value ){
+
+            if ( current.size( ) != value.size( ) ){
+
+                return true;
+
+            }
+
+            for ( unsigned int i = 0; i < value.size( ); i++ ){
+
+                if ( !( std::fabs( current[ i ] - value[ i ] ) <= _deformationChangeTolerance ) ){
+
+                    return true;
+
+                }
+
+            }
+
+            return false;
+
+        };
+
+        _deformationChanged = hasChanged( _previousDeformationGradient, previousDeformationGradient ) ||
+                              hasChanged( _previousMicroDeformation, previousMicroDeformation ) ||
+                              hasChanged( _previousGradientMicroDeformation, previousGradientMicroDeformation ) ||
+                              hasChanged( _deformationGradient, deformationGradient ) ||
+                              hasChanged( _microDeformation, microDeformation ) ||
+                              hasChanged( _gradientMicroDeformation, gradientMicroDeformation );
+
+        if ( !_deformationChanged ){
+
+            return;
+
+        }
+
+        _previousDeformationGradient = previousDeformationGradient;
+
+        _previousMicroDeformation = previousMicroDeformation;
+
+        _previousGradientMicroDeformation = previousGradientMicroDeformation;
+
+        _deformationGradient = deformationGradient;
+
+        _microDeformation = microDeformation;
+
+        _gradientMicroDeformation = gradientMicroDeformation;
+
+        ERROR_TOOLS_CATCH( resetAssembledData( ) );
+
+        return;
+
+    }
+
+    void aspBase::computeSurfaceAdhesionEnergyDensity( floatType &surfaceAdhesionEnergyDensity ){
+        /*!
+         * Compute the surface adhesion energy density in the current configuration ( energy / da )
+         * 
+         * \param &surfaceAdhesionEnergyDensity: The surface adhesion energy density i.e., the energy bonding the local and non-local particles together
+         */
+
+        const floatVector* currentDistanceVector;
+        ERROR_TOOLS_CATCH( currentDistanceVector = getCurrentDistanceVector( ) );
+
+        const floatVector* localCurrentNormal;
+        ERROR_TOOLS_CATCH( localCurrentNormal = getLocalCurrentNormal( ) );
+
+        const floatVector* surfaceParameters;
+        ERROR_TOOLS_CATCH( surfaceParameters = getSurfaceParameters( ) );
+
+        // Decompose the traction into normal and tangential directions
+        floatVector dn, dt;
+        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::decomposeVector( *currentDistanceVector, *localCurrentNormal, dn, dt ) );
+
+        floatType energyDensity;
+        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::computeLinearTractionEnergy( dn, dt, *surfaceParameters, energyDensity ) );
+
+        surfaceAdhesionEnergyDensity = 0.5 * energyDensity * tardigradeVectorTools::l2norm( dn );
+
+        return;
+
+    }
+
+    void aspBase::computeSurfaceAdhesionEnergyDensity( floatType &surfaceAdhesionEnergyDensity,
+                                                       floatVector &dSurfaceAdhesionEnergyDensitydLocalDeformationGradient,
+                                                       floatVector &dSurfaceAdhesionEnergyDensitydLocalMicroDeformation,
+                                                       floatVector &dSurfaceAdhesionEnergyDensitydGradientMicroDeformation ){
+        /*!
+         * Compute the surface adhesion energy density in the current configuration ( energy / da )
+         * \param &surfaceAdhesionEnergyDensity: The surface adhesion energy density i.e., the energy bonding the local and non-local particles together
+         * \param &dSurfaceAdhesionEnergyDensitydLocalDeformationGradient: The gradient of the surface adhesion energy density w.r.t. the
+         *     local deformation gradient
+         * \param &dSurfaceAdhesionEnergyDensitydLocalMicroDeformation: The gradient of the surface adhesion energy density w.r.t. the
+         *     local micro-deformation
+         * \param &dSurfaceAdhesionEnergyDensitydGradientMicroDeformation: The gradient of the surface adhesion energy density w.r.t. the
+         *     gradient of the micro-deformation.
+         */
+
+        const floatVector* currentDistanceVector;
+        ERROR_TOOLS_CATCH( currentDistanceVector = getCurrentDistanceVector( ) );
+
+        const floatVector* localCurrentNormal;
+        ERROR_TOOLS_CATCH( localCurrentNormal = getLocalCurrentNormal( ) );
+
+        const floatVector* surfaceParameters;
+        ERROR_TOOLS_CATCH( surfaceParameters = getSurfaceParameters( ) );
+
+        // Decompose the traction into normal and tangential directions
+        floatVector dn, dt;
+        floatMatrix ddndd, ddndn, ddtdd, ddtdn;
+        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::decomposeVector( *currentDistanceVector, *localCurrentNormal, dn, dt,
+                                                                             ddndd, ddndn, ddtdd, ddtdn ) );
+
+        floatMatrix ddndF = tardigradeVectorTools::dot( ddndd, *getdCurrentDistanceVectordLocalDeformationGradient( ) );
+
+        floatMatrix ddndChi = tardigradeVectorTools::dot( ddndd, *getdCurrentDistanceVectordLocalMicroDeformation( ) )
+                            + tardigradeVectorTools::dot( ddndn, *getdLocalCurrentNormaldLocalMicroDeformation( ) );
+
+        floatMatrix ddndGradChi = tardigradeVectorTools::dot( ddndd, *getdCurrentDistanceVectordGradientMicroDeformation( ) );
+
+        floatMatrix ddtdF = tardigradeVectorTools::dot( ddtdd, *getdCurrentDistanceVectordLocalDeformationGradient( ) );
+
+        floatMatrix ddtdChi = tardigradeVectorTools::dot( ddtdd, *getdCurrentDistanceVectordLocalMicroDeformation( ) )
+                            + tardigradeVectorTools::dot( ddtdn, *getdLocalCurrentNormaldLocalMicroDeformation( ) );
+
+        floatMatrix ddtdGradChi = tardigradeVectorTools::dot( ddtdd, *getdCurrentDistanceVectordGradientMicroDeformation( ) );
+
+        floatType energyDensity;
+        floatVector deddn, deddt;
+        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::computeLinearTractionEnergy( dn, dt, *surfaceParameters, energyDensity,
+                                                                                         deddn, deddt ) );
+
+        floatVector dedF = tardigradeVectorTools::Tdot( ddndF, deddn )
+                         + tardigradeVectorTools::Tdot( ddtdF, deddt );
+
+        floatVector dedChi = tardigradeVectorTools::Tdot( ddndChi, deddn )
+                           + tardigradeVectorTools::Tdot( ddtdChi, deddt );
+
+        floatVector dedGradChi = tardigradeVectorTools::Tdot( ddndGradChi, deddn )
+                               + tardigradeVectorTools::Tdot( ddtdGradChi, deddt );
+
+        surfaceAdhesionEnergyDensity = 0.5 * energyDensity * tardigradeVectorTools::l2norm( dn );
+
+        floatType dsede = 0.5 * tardigradeVectorTools::l2norm( dn );
+
+        floatVector dseddn = 0.5 * energyDensity * dn / ( tardigradeVectorTools::l2norm( dn ) + *getAbsoluteTolerance( ) );
+
+        dSurfaceAdhesionEnergyDensitydLocalDeformationGradient = dsede * dedF + tardigradeVectorTools::Tdot( ddndF, dseddn );
+
+        dSurfaceAdhesionEnergyDensitydLocalMicroDeformation = dsede * dedChi + tardigradeVectorTools::Tdot( ddndChi, dseddn );
+
+        dSurfaceAdhesionEnergyDensitydGradientMicroDeformation = dsede * dedGradChi + tardigradeVectorTools::Tdot( ddndGradChi, dseddn );
+
+    }
+
+    namespace{
+
+        template< typename pointType >
+        void convertBoundingBoxBounds( const floatType &lower, const floatType &upper, pointType &lowerBound, pointType &upperBound ){
+            /*!
+             * Convert the bounds of one dimension of a bounding box to the type of the points which are tested against it.
+             * Bounds which are rounded inwards are moved to the next representable value so that the test in a lower
+             * precision is conservative i.e. a point which is inside of the box is never culled.
+             * 
+             * \param &lower: The lower bound
+             * \param &upper: The upper bound
+             * \param &lowerBound: The lower bound in the type of the points
+             * \param &upperBound: The upper bound in the type of the points
+             */
+
+            lowerBound = static_cast< pointType >( lower );
+
+            upperBound = static_cast< pointType >( upper );
+
+            if ( lowerBound > lower ){
+
+                lowerBound = std::nextafter( lowerBound, -std::numeric_limits< pointType >::infinity( ) );
+
+            }
+
+            if ( upperBound < upper ){
+
+                upperBound = std::nextafter( upperBound, std::numeric_limits< pointType >::infinity( ) );
+
+            }
+
+        }
+
+    }
+
+    template< typename pointType >
+    bool aspBase::pointInBoundingBox( const std::vector< pointType > &point, const floatMatrix &boundingBox ){
+        /*!
+         * Determine if the point is inside of the bounding box and return a boolean value. Points of a lower precision than
+         * floatType are tested conservatively against the bounding box (see convertBoundingBoxBounds).
+         * 
+         * \param &point: The point in [x, y, z, ...] space. Must be of the same length of the bounding box
+         * \param &boundingBox: The bouning box in the form (point.size( ), 2 ) where for each dimension
+         *    the row is of the form (lower bound, upper bound)
+         */
+
+        if ( point.size( ) != boundingBox.size( ) ){
+
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "point and boundingBox must be the same size.\n  point.size( ): " + std::to_string( point.size( ) ) + "\n  boundingBox.size( ): " + std::to_string( boundingBox.size( ) ) ) );
+
+        }
+
+        for ( unsigned int i = 0; i < point.size( ); i++ ){
+
+            if ( boundingBox[ i ].size( ) != 2 ){
+
+                ERROR_TOOLS_CATCH( throw std::runtime_error( "boundingBox row " + std::to_string( i ) + " has a length of " + std::to_string( boundingBox[ i ].size( ) ) + " and it should be of length 2" ) );
+
+            }
+
+            pointType lower, upper;
+
+            convertBoundingBoxBounds( boundingBox[ i ][ 0 ], boundingBox[ i ][ 1 ], lower, upper );
+
+            if ( ( point[ i ] < lower ) || ( point[ i ] > upper ) ){
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    template bool aspBase::pointInBoundingBox< double >( const std::vector< double > &point, const floatMatrix &boundingBox );
+
+    template bool aspBase::pointInBoundingBox< float >( const std::vector< float > &point, const floatMatrix &boundingBox );
+
+    template< typename pointType >
+    void aspBase::idBoundingBoxContainedPoints( const std::vector< pointType > &points, const floatMatrix &boundingBox, std::vector< unsigned int > &containedPoints ){
+        /*!
+         * Determine which of the points are in the bounding box
+         * 
+         * The points may be stored in a lower precision than floatType (e.g. broadPhaseFloatType) in which case the test is
+         * conservative (see convertBoundingBoxBounds) and some points just outside of the bounding box may be retained.
+         * 
+         * \param &points: The points in [x1, y1, z1, x2, y2, z2, ... ] format.
+         * \param &boundingBox: The bounding box which must be in the form (_dimension, 2 ) where for each dimension
+         *    the row is of the form (lower bound, upper bound)
+         * \param &containedPoints: The points contained in the vector
          */
 
+        ASP_INSTRUMENT_STAGE( OVERLAP_CULLING );
+
         const unsigned int *dim = getDimension( );
 
-        const floatVector *dX;
-        ERROR_TOOLS_CATCH( dX = getLocalReferenceParticleSpacingVector( ) );
+        if ( boundingBox.size( ) != *dim ){
 
-        floatVector eye( ( *dim ) * ( *dim ), 0 );
-        tardigradeVectorTools::eye( eye );
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "The points and boundingBox must have the same dimension.\n  dimension: " + std::to_string( *dim ) + "\n  boundingBox.size( ): " + std::to_string( boundingBox.size( ) ) ) );
 
-        floatMatrix value( ( *dim ) * ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( *dim ), 0 ) );
+        }
 
         for ( unsigned int i = 0; i < *dim; i++ ){
 
-            for ( unsigned int I = 0; I < *dim; I++ ){
+            if ( boundingBox[ i ].size( ) != 2 ){
 
-                for ( unsigned int a = 0; a < *dim; a++ ){
+                ERROR_TOOLS_CATCH( throw std::runtime_error( "boundingBox row " + std::to_string( i ) + " has a length of " + std::to_string( boundingBox[ i ].size( ) ) + " and it should be of length 2" ) );
 
-                    for ( unsigned int A = 0; A < *dim; A++ ){
+            }
 
-                        for ( unsigned int B = 0; B < *dim; B++ ){
+        }
 
-                            value[ ( *dim ) * i + I ][ ( *dim ) * ( *dim ) * a + ( *dim ) * A + B ]
-                                += eye[ ( *dim ) * i + a ] * eye[ ( *dim ) * I + A ] * ( *dX )[ B ];
+        const unsigned int numPoints = points.size( ) / ( *dim );
 
-                        }
+        // Every point is written to the next open slot and the slot is only kept if the point is contained which avoids
+        // branching on the result of the containment test
+        containedPoints.resize( numPoints );
 
-                    }
+        unsigned int numContainedPoints = 0;
+
+        if ( *dim == 3 ){
+
+            pointType xLower, xUpper, yLower, yUpper, zLower, zUpper;
+
+            convertBoundingBoxBounds( boundingBox[ 0 ][ 0 ], boundingBox[ 0 ][ 1 ], xLower, xUpper );
+
+            convertBoundingBoxBounds( boundingBox[ 1 ][ 0 ], boundingBox[ 1 ][ 1 ], yLower, yUpper );
+
+            convertBoundingBoxBounds( boundingBox[ 2 ][ 0 ], boundingBox[ 2 ][ 1 ], zLower, zUpper );
+
+            const pointType *point = points.data( );
+
+            for ( unsigned int p = 0; p < numPoints; p++, point += 3 ){
+
+                const bool outside = ( point[ 0 ] < xLower ) | ( point[ 0 ] > xUpper )
+                                   | ( point[ 1 ] < yLower ) | ( point[ 1 ] > yUpper )
+                                   | ( point[ 2 ] < zLower ) | ( point[ 2 ] > zUpper );
+
+                containedPoints[ numContainedPoints ] = p;
+
+                numContainedPoints += !outside;
+
+            }
+
+        }
+        else{
+
+            std::vector< pointType > lower( *dim ), upper( *dim );
+
+            for ( unsigned int i = 0; i < *dim; i++ ){
+
+                convertBoundingBoxBounds( boundingBox[ i ][ 0 ], boundingBox[ i ][ 1 ], lower[ i ], upper[ i ] );
+
+            }
+
+            const pointType *point = points.data( );
+
+            for ( unsigned int p = 0; p < numPoints; p++, point += ( *dim ) ){
+
+                bool outside = false;
+
+                for ( unsigned int i = 0; i < *dim; i++ ){
+
+                    outside |= ( point[ i ] < lower[ i ] ) | ( point[ i ] > upper[ i ] );
 
                 }
 
+                containedPoints[ numContainedPoints ] = p;
+
+                numContainedPoints += !outside;
+
             }
 
         }
 
-        setdNonLocalMicroDeformationdGradientMicroDeformation( value );
+        containedPoints.resize( numContainedPoints );
+
+        return;
 
     }
 
-    void aspBase::setdNonLocalMicroDeformationdGradientMicroDeformation( const floatMatrix &value ){
+    template void aspBase::idBoundingBoxContainedPoints< double >( const std::vector< double > &points, const floatMatrix &boundingBox, std::vector< unsigned int > &containedPoints );
+
+    template void aspBase::idBoundingBoxContainedPoints< float >( const std::vector< float > &points, const floatMatrix &boundingBox, std::vector< unsigned int > &containedPoints );
+
+    void aspBase::computeSurfaceOverlapEnergyDensity( mapFloatType &surfaceOverlapEnergyDensity ){
         /*!
-         * Set the derivative of the non-local micro deformation w.r.t. the reference coordinate gradient of the micro-deformation
+         * Compute the surface overlap energy density for the local particle and a given interaction
          * 
-         * \param &value: The value of the gradient of the non-local micro-deformation w.r.t. the reference coordinate gradient
-         *     of the micro-deformation.
+         * \param &surfaceOverlapEnergyDensity: The index is the index of the local points which may be overlapping with a neighboring particle and the values are the overlap energies. It is not a scalar because two particles could be overlapping at multiple points
          */
 
-        _dNonLocalMicroDeformationdGradientMicroDeformation.second = value;
+        surfaceOverlapEnergyDensity.clear( );
 
-        _dNonLocalMicroDeformationdGradientMicroDeformation.first = true;
+        const mapFloatVector *particlePairOverlap;
+        ERROR_TOOLS_CATCH( particlePairOverlap = getParticlePairOverlap( ) );
 
-        addInteractionPairData( &_dNonLocalMicroDeformationdGradientMicroDeformation );
+        const floatVector *overlapParameters;
+        ERROR_TOOLS_CATCH( overlapParameters = getSurfaceOverlapParameters( ) );
 
-    }
+        surfaceOverlapEnergyDensity.reserve( particlePairOverlap->size( ) );
 
-    const floatMatrix* aspBase::getdNonLocalMicroDeformationdGradientMicroDeformation( ){
-        /*!
-         * Get the gradient of the non-local micro-deformation w.r.t. the reference coordinate gradient of the micro-deformation
-         */
+        for ( auto overlap = particlePairOverlap->begin( ); overlap != particlePairOverlap->end( ); overlap++ ){
 
-        if ( !_dNonLocalMicroDeformationdGradientMicroDeformation.first ){
+            floatVector normal;
 
-            ERROR_TOOLS_CATCH( setdNonLocalMicroDeformationdGradientMicroDeformation( ) );
+            getLocalCurrentNormal( overlap->first, normal );
+
+            surfaceOverlapEnergyDensity.insert( { overlap->first, 0.5 * ( *overlapParameters )[ 0 ] * tardigradeVectorTools::dot( overlap->second, overlap->second ) * std::fabs( tardigradeVectorTools::dot( overlap->second, normal ) ) } );
 
         }
 
-        return &_dNonLocalMicroDeformationdGradientMicroDeformation.second;
+        return;
 
     }
 
-    void aspBase::setd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ){
+    void aspBase::setParticlePairOverlap( ){
         /*!
-         * Set the second derivative of the non-local micro-deformation w.r.t. the local reference relative position vector and the gradient of the micro deformation.
+         * Set the particle overlap for the current local to non-local pair
+         * 
+         * The overlap distance solve of each local surface point is warm started by the solution of the same point and pair
+         * from the previous evaluation, e.g. the previous equilibrium iteration or increment. The solutions are kept until
+         * resetOverlapSolutions is called.
          */
 
-        const unsigned int* dim = getDimension( );
+        mapFloatVector particlePairOverlap;
 
-        floatMatrix value( getNonLocalMicroDeformation( )->size( ), floatVector( getLocalSurfaceReferenceRelativePositionVector( )->size( ) * getGradientMicroDeformation( )->size( ), 0 ) );
+        const unsigned int *dim = getDimension( );
 
-        floatVector eye( ( *dim ) * ( *dim ), 0 );
-        tardigradeVectorTools::eye( eye );
+        const floatMatrix *nonLocalBoundingBox;
+        ERROR_TOOLS_CATCH( nonLocalBoundingBox = getNonLocalParticleCurrentBoundingBox( ) );
 
-        for ( unsigned int i = 0; i < *dim; i++ ){
+        const floatVector *localReferenceSurfacePoints;
+        ERROR_TOOLS_CATCH( localReferenceSurfacePoints = getLocalReferenceSurfacePoints( ) );
 
-            for ( unsigned int I = 0; I < *dim; I++ ){
+        const floatVector *localDeformationGradient;
+        ERROR_TOOLS_CATCH( localDeformationGradient = getLocalDeformationGradient( ) );
 
-                for ( unsigned int J = 0; J < *dim; J++ ){
+        const floatType *nonLocalReferenceRadius;
+        ERROR_TOOLS_CATCH( nonLocalReferenceRadius = getNonLocalReferenceRadius( ) );
 
-                    for ( unsigned int a = 0; a < *dim; a++ ){
+        const floatVector *localMicroDeformation;
+        ERROR_TOOLS_CATCH( localMicroDeformation = getLocalMicroDeformation( ) );
 
-                        for ( unsigned int A = 0; A < *dim; A++ ){
+        const floatVector *localReferenceParticleSpacing;
+        ERROR_TOOLS_CATCH( localReferenceParticleSpacing = getLocalReferenceParticleSpacingVector( ) );
 
-                            for ( unsigned int B = 0; B < *dim; B++ ){
+        const floatVector *localGradientMicroDeformation;
+        ERROR_TOOLS_CATCH( localGradientMicroDeformation = getLocalGradientMicroDeformation( ) );
+
+        const broadPhaseFloatVector *localCurrentSurfacePointsBroadPhase;
+        ERROR_TOOLS_CATCH( localCurrentSurfacePointsBroadPhase = getLocalCurrentSurfacePointsBroadPhase( ) );
+
+        // Check which of the local points are contained in the non-local bounding box
+        std::vector< unsigned int > possiblePoints;
+        ERROR_TOOLS_CATCH( idBoundingBoxContainedPoints( *localCurrentSurfacePointsBroadPhase, *nonLocalBoundingBox, possiblePoints ) );
+
+#ifdef ASP_INSTRUMENTATION
+        _instrumentation.overlapCandidatesTested += localCurrentSurfacePointsBroadPhase->size( ) / ( *dim );
+
+        _instrumentation.overlapCandidatesRetained += possiblePoints.size( );
+#endif
+
+        ASP_INSTRUMENT_STAGE( OVERLAP_SOLVE );
+
+#ifdef ASP_INSTRUMENTATION
+        const tractionSeparation::overlapSolverStatistics initialSolverStatistics = tractionSeparation::getOverlapSolverStatistics( );
+#endif
+
+        const floatVector *nonLocalMicroDeformationBase;
+        ERROR_TOOLS_CATCH( nonLocalMicroDeformationBase = getNonLocalMicroDeformationBase( ) );
+
+        const unsigned int *localIndex = getLocalIndex( );
+
+        const unsigned int *nonLocalIndex = getNonLocalIndex( );
+
+        if ( _overlapSolutions.second.size( ) <= *localIndex ){
+
+            _overlapSolutions.second.resize( std::max( *localIndex + 1, *getNumLocalParticles( ) ) );
+
+        }
+
+        _overlapSolutions.first = true;
+
+        std::map< std::pair< unsigned int, unsigned int >, floatVector > &overlapSolutions = _overlapSolutions.second[ *localIndex ];
+
+        particlePairOverlap.reserve( possiblePoints.size( ) );
+
+        for ( auto p = possiblePoints.begin( ); p != possiblePoints.end( ); p++ ){
+
+            // Compute the overlap between the local and non-local particles
+            floatVector overlap;
+
+            ERROR_TOOLS_CATCH( tractionSeparation::computeParticleOverlap( floatVector( localReferenceSurfacePoints->begin( ) + ( *dim ) * ( *p ),
+                                                                                        localReferenceSurfacePoints->begin( ) + ( *dim ) * ( ( *p ) + 1 ) ),
+                                                                           *localReferenceParticleSpacing, *nonLocalReferenceRadius, *localDeformationGradient,
+                                                                           *localMicroDeformation, *nonLocalMicroDeformationBase, *localGradientMicroDeformation,
+                                                                           overlapSolutions[ std::make_pair( *nonLocalIndex, *p ) ], overlap ) );
 
-                                value[ ( *dim ) * i + I ][ ( *dim ) * ( *dim ) * ( *dim ) * J + ( *dim ) * ( *dim ) * a + ( *dim ) * A + B ]
-                                    += eye[ ( *dim ) * i + a ] * eye[ ( *dim ) * I + A ] * eye[ ( *dim ) * J + B ];
+            particlePairOverlap.insert( { *p, overlap } );
 
-                            }
+        }
 
-                        }
+#ifdef ASP_INSTRUMENTATION
+        const tractionSeparation::overlapSolverStatistics &solverStatistics = tractionSeparation::getOverlapSolverStatistics( );
 
-                    }
+        _instrumentation.overlapSolves += solverStatistics.solves - initialSolverStatistics.solves;
 
-                }
+        _instrumentation.overlapNewtonIterations += solverStatistics.iterations - initialSolverStatistics.iterations;
 
-            }
+        _instrumentation.overlapLineSearchIterations += solverStatistics.lineSearchIterations - initialSolverStatistics.lineSearchIterations;
+#endif
 
-        }
+        setParticlePairOverlap( particlePairOverlap );
 
-        setd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( value );
+        return;
 
     }
 
-    void aspBase::setd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( const floatMatrix &value ){
+    void aspBase::setParticlePairOverlap( const mapFloatVector &value ){
         /*!
-         * Set the second derivative of the non-local micro-deformation w.r.t. the local reference relative position vector and the gradient of the micro deformation.
+         * Set the vector of the overlap of the current pariticle pair
          * 
-         * \param &value: The second derivative of the non-local micro-deformation w.r.t. the local reference relative position vector and the gradient of the micro deformation.
+         * \param &value: The vector defining the overlap of the two particles.
          */
 
-        _d2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation.second = value;
+        _particlePairOverlap.second = value;
 
-        _d2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation.first = true;
+        _particlePairOverlap.first = true;
 
-        addInteractionPairData( &_d2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation );
+        addInteractionPairData( &_particlePairOverlap );
 
     }
 
-    const floatMatrix* aspBase::getd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ){
+    const mapFloatVector* aspBase::getParticlePairOverlap( ){
         /*!
-         * Get the second derivative of the non-local micro-deformation w.r.t. the reference relative position vector and the gradient of the micro deformation.
+         * Get an unordered map of the overlap distance between the current local to non-local particle pair
          */
 
-        if ( !_d2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation.first ){
+        if ( !_particlePairOverlap.first ){
 
-            ERROR_TOOLS_CATCH( setd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ) );
+            ERROR_TOOLS_CATCH( setParticlePairOverlap( ) );
 
         }
 
-        return &_d2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation.second;
+        return &_particlePairOverlap.second;
 
     }
 
-    void aspBase::setd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( ){
+    const floatType* aspBase::getSurfaceAdhesionEnergyDensity( ){
         /*!
-         * Set the second derivative of the non-local micro-deformation w.r.t. the non-local reference relative position vector and the gradient of the micro deformation.
+         * Get the surface adhesion energy density
          */
 
-        setd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( -( *getd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ) ) );
+        if ( !_surfaceAdhesionEnergyDensity.first ){
+
+            ERROR_TOOLS_CATCH( setSurfaceAdhesionEnergyDensity( ) );
+
+        }
+
+        return &_surfaceAdhesionEnergyDensity.second;
 
     }
 
-    void aspBase::setd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( const floatMatrix &value ){
+    const mapFloatType* aspBase::getSurfaceOverlapEnergyDensity( ){
         /*!
-         * Set the second derivative of the non-local micro-deformation w.r.t. the non-local reference relative position vector and the gradient of the micro deformation.
-         * 
-         * \param &value: The second derivative of the non-local micro-deformation w.r.t. the non-local reference relative position vector and the gradient of the micro deformation.
+         * Get the surface overlap energy density
          */
 
-        _d2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation.second = value;
+        if ( !_surfaceOverlapEnergyDensity.first ){
 
-        _d2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation.first = true;
+            ERROR_TOOLS_CATCH( setSurfaceOverlapEnergyDensity( ) );
 
-        addInteractionPairData( &_d2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation );
+        }
+
+        return &_surfaceOverlapEnergyDensity.second;
 
     }
 
-    const floatMatrix* aspBase::getd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( ){
+    const floatVector *aspBase::getGradientMicroDeformation( ){
         /*!
-         * Get the second derivative of the non-local micro-deformation w.r.t. the non-local reference relative position vector and the gradient of the micro deformation.
+         * Get the gradient of the micro-deformation
          */
 
-        if ( !_d2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation.first ){
+        return &_gradientMicroDeformation;
 
-            ERROR_TOOLS_CATCH( setd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( ) );
+    }
 
-        }
+    const floatVector *aspBase::getMicroDeformation( ){
+        /*!
+         * Get the gradient of the micro-deformation
+         */
 
-        return &_d2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation.second;
+        return &_microDeformation;
 
     }
 
-    void aspBase::setd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( ){
+    void aspBase::setLocalGradientMicroDeformation( ){
         /*!
-         * Set the second derivative of the non-local micro-deformation w.r.t. the reference distance vector and the gradient of the micro deformation.
+         * Set the local gradient of the micro-deformation
          */
 
-        setd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( *getd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ) );
+        const floatVector *gradientMicroDeformation;
+        ERROR_TOOLS_CATCH( gradientMicroDeformation = getGradientMicroDeformation( ) );
+
+        setLocalGradientMicroDeformation( *gradientMicroDeformation );
 
     }
 
-    void aspBase::setd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( const floatMatrix &value ){
+    void aspBase::setLocalGradientMicroDeformation( const floatVector &value ){
         /*!
-         * Set the second derivative of the non-local micro-deformation w.r.t. the reference distance vector and the gradient of the micro deformation.
+         * Set the local gradient of the micro-deformation
          * 
-         * \param &value: The second derivative of the non-local micro-deformation w.r.t. the reference distance vector and the gradient of the micro deformation.
+         * \param &value: The current value of the local gradient of the micro deformation
          */
 
-        _d2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation.second = value;
+        _localGradientMicroDeformation.second = value;
 
-        _d2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation.first = true;
+        _localGradientMicroDeformation.first = true;
 
-        addInteractionPairData( &_d2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation );
+        addLocalParticleData( &_localGradientMicroDeformation );
 
     }
 
-    const floatMatrix* aspBase::getd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( ){
+    const floatVector *aspBase::getLocalGradientMicroDeformation( ){
         /*!
-         * Get the second derivative of the non-local micro-deformation w.r.t. the reference distance vector and the gradient of the micro deformation.
+         * Get the local gradient of the micro-deformation
          */
 
-        if ( !_d2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation.first ){
+        if ( !_localGradientMicroDeformation.first ){
 
-            ERROR_TOOLS_CATCH( setd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( ) );
+            ERROR_TOOLS_CATCH( setLocalGradientMicroDeformation( ) );
 
         }
 
-        return &_d2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation.second;
+        return &_localGradientMicroDeformation.second;
 
     }
 
-    void aspBase::setNonLocalMicroDeformation( const floatVector &value ){
+    void aspBase::computeSurfaceResponses( floatType &surfaceAdhesionEnergyDensity, floatVector &surfaceAdhesionTraction,
+                                           floatType &surfaceAdhesionThickness, mapFloatType &surfaceOverlapEnergyDensity,
+                                           mapFloatVector &surfaceOverlapTraction, mapFloatType &surfaceOverlapThickness ){
         /*!
-         * Set the non-local micro deformation
+         * Compute the surface adhesion and overlap responses of the current interaction pair in a single pass. The current
+         * distance vector is decomposed once for all of the adhesion responses and the current normal of each overlapping
+         * point is evaluated once for all of the overlap responses. The tractions are not computed if the evaluation mode is
+         * ENERGY.
          * 
-         * \param &value: The value of the non-local micro deformation
+         * The results are identical to those of computeSurfaceAdhesionEnergyDensity, computeSurfaceAdhesionTraction,
+         * setSurfaceAdhesionThickness, computeSurfaceOverlapEnergyDensity, computeSurfaceOverlapTraction, and
+         * setSurfaceOverlapThickness. The containers are cleared before they are filled so their storage may be re-used
+         * between pairs.
+         * 
+         * \param &surfaceAdhesionEnergyDensity: The surface adhesion energy density
+         * \param &surfaceAdhesionTraction: The surface adhesion traction
+         * \param &surfaceAdhesionThickness: The thickness of the surface adhesion
+         * \param &surfaceOverlapEnergyDensity: The map from the overlapping local surface points to the overlap energy density
+         * \param &surfaceOverlapTraction: The map from the overlapping local surface points to the overlap traction
+         * \param &surfaceOverlapThickness: The map from the overlapping local surface points to the overlap thickness
          */
 
-        _nonLocalMicroDeformation.second = value;
-
-        _nonLocalMicroDeformation.first = true;
-
-        addInteractionPairData( &_nonLocalMicroDeformation );
-
-        return;
+        const bool computeTractions = ( _evaluationMode != ENERGY );
 
-    }
+        const floatVector* currentDistanceVector;
+        ERROR_TOOLS_CATCH( currentDistanceVector = getCurrentDistanceVector( ) );
 
-    const floatVector* aspBase::getNonLocalMicroDeformation( ){
-        /*!
-         * Get the non-local micro deformation tensor
-         */
+        const floatVector* localCurrentNormal;
+        ERROR_TOOLS_CATCH( localCurrentNormal = getLocalCurrentNormal( ) );
 
-        if ( !_nonLocalMicroDeformation.first ){
+        const floatVector* surfaceParameters;
+        ERROR_TOOLS_CATCH( surfaceParameters = getSurfaceParameters( ) );
 
-            ERROR_TOOLS_CATCH( setNonLocalMicroDeformation( ) );
+        // Decompose the distance into normal and tangential directions
+        floatVector dn, dt;
+        ERROR_TOOLS_CATCH( tractionSeparation::decomposeVector( *currentDistanceVector, *localCurrentNormal, dn, dt ) );
 
-        }
+        floatType energyDensity;
+        ERROR_TOOLS_CATCH( tractionSeparation::computeLinearTractionEnergy( dn, dt, *surfaceParameters, energyDensity ) );
 
-        return &_nonLocalMicroDeformation.second;
+        surfaceAdhesionThickness = tardigradeVectorTools::l2norm( dn );
 
-    }
+        surfaceAdhesionEnergyDensity = 0.5 * energyDensity * surfaceAdhesionThickness;
 
-    const floatVector* aspBase::getNonLocalMicroDeformationBase( ){
-        /*!
-         * Get the base of the non-local micro deformation tensor
-         */
+        surfaceAdhesionTraction.clear( );
 
-        if ( !_nonLocalMicroDeformationBase.first ){
+        if ( computeTractions ){
 
-            ERROR_TOOLS_CATCH( setNonLocalMicroDeformationBase( ) );
+            ERROR_TOOLS_CATCH( tractionSeparation::computeLinearTraction( dn, dt, *surfaceParameters, surfaceAdhesionTraction ) );
 
         }
 
-        return &_nonLocalMicroDeformationBase.second;
+        const mapFloatVector *particlePairOverlap;
+        ERROR_TOOLS_CATCH( particlePairOverlap = getParticlePairOverlap( ) );
 
-    }
+        const floatVector *overlapParameters;
+        ERROR_TOOLS_CATCH( overlapParameters = getSurfaceOverlapParameters( ) );
 
-    void aspBase::setNonLocalMicroDeformationBase( ){
-        /*!
-         * Set the non-local micro-deformation tensor base
-         */
+        surfaceOverlapEnergyDensity.clear( );
 
-        const floatVector *microDeformationTensor;
-        ERROR_TOOLS_CATCH( microDeformationTensor = getMicroDeformation( ) );
+        surfaceOverlapTraction.clear( );
 
-        setNonLocalMicroDeformationBase( *microDeformationTensor );
+        surfaceOverlapThickness.clear( );
 
-    }
+        surfaceOverlapEnergyDensity.reserve( particlePairOverlap->size( ) );
 
-    void aspBase::setNonLocalMicroDeformationBase( const floatVector &value ){
-        /*!
-         * Set the non-local micro-deformation tensor base
-         * 
-         * \param &value: The value of the non-local micro-deformation tensor base
-         */
+        surfaceOverlapThickness.reserve( particlePairOverlap->size( ) );
 
-        _nonLocalMicroDeformationBase.second = value;
+        if ( computeTractions ){
 
-        _nonLocalMicroDeformationBase.first = true;
+            surfaceOverlapTraction.reserve( particlePairOverlap->size( ) );
 
-        addInteractionPairData( &_nonLocalMicroDeformationBase );
+        }
 
-    }
+        floatVector normal;
 
-    void aspBase::setCurrentDistanceVector( ){
-        /*!
-         * Set the current distance vector
-         */
+        for ( auto overlap = particlePairOverlap->begin( ); overlap != particlePairOverlap->end( ); overlap++ ){
 
-        const unsigned int* dim = getDimension( );
+            ERROR_TOOLS_CATCH( getLocalCurrentNormal( overlap->first, normal ) );
 
-        const floatVector* localSurfaceReferenceRelativePositionVector;
-        ERROR_TOOLS_CATCH( localSurfaceReferenceRelativePositionVector = getLocalSurfaceReferenceRelativePositionVector( ) );
+            const floatType thickness = std::fabs( tardigradeVectorTools::dot( overlap->second, normal ) );
 
-        const floatVector* nonLocalSurfaceReferenceRelativePositionVector;
-        ERROR_TOOLS_CATCH( nonLocalSurfaceReferenceRelativePositionVector = getNonLocalSurfaceReferenceRelativePositionVector( ) );
+            surfaceOverlapThickness.insert( { overlap->first, thickness } );
 
-        const floatVector* referenceDistanceVector;
-        ERROR_TOOLS_CATCH( referenceDistanceVector = getReferenceDistanceVector( ) );
+            surfaceOverlapEnergyDensity.insert( { overlap->first, 0.5 * ( *overlapParameters )[ 0 ] * tardigradeVectorTools::dot( overlap->second, overlap->second ) * thickness } );
 
-        const floatVector* localDeformationGradient;
-        ERROR_TOOLS_CATCH( localDeformationGradient = getLocalDeformationGradient( ) );
+            if ( computeTractions ){
 
-        const floatVector* localMicroDeformation;
-        ERROR_TOOLS_CATCH( localMicroDeformation = getLocalMicroDeformation( ) );
+                surfaceOverlapTraction.insert( { overlap->first, ( *overlapParameters )[ 0 ] * overlap->second } );
 
-        const floatVector* nonLocalMicroDeformation;
-        ERROR_TOOLS_CATCH( nonLocalMicroDeformation = getNonLocalMicroDeformation( ) );
+            }
 
-        // Compute the current distance
+        }
 
-        floatVector currentDistanceVector;
+        return;
 
-        floatMatrix dddXi, dddXiNL, dddD, dddF, dddchi, dddchiNL;
+    }
 
-        floatMatrix d2ddFdXi, d2ddChidXi, d2ddFdXiNL, d2ddChiNLdXiNL, d2ddFdD;
+    void aspBase::setSurfaceAdhesionEnergyDensity( ){
+        /*!
+         * Set the surface adhesion energy density if required.
+         */
 
-        ERROR_TOOLS_CATCH( tractionSeparation::computeCurrentDistanceGeneral( *localSurfaceReferenceRelativePositionVector,
-                                                                              *nonLocalSurfaceReferenceRelativePositionVector,
-                                                                              *referenceDistanceVector,
-                                                                              *localDeformationGradient,
-                                                                              *localMicroDeformation,
-                                                                              *nonLocalMicroDeformation,
-                                                                              currentDistanceVector,
-                                                                              dddXi, dddXiNL, dddD, dddF, dddchi, dddchiNL,
-                                                                              d2ddFdXi, d2ddChidXi, d2ddFdXiNL, d2ddChiNLdXiNL, d2ddFdD ) );
+        floatType surfaceAdhesionEnergyDensity;
 
-        setCurrentDistanceVector( currentDistanceVector );
+        ERROR_TOOLS_CATCH( computeSurfaceAdhesionEnergyDensity( surfaceAdhesionEnergyDensity ) );
 
-        // Set first order derivatives
-        dddXi   += tardigradeVectorTools::dot( dddchiNL, *getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) );
+        setSurfaceAdhesionEnergyDensity( surfaceAdhesionEnergyDensity );
 
-        dddXiNL += tardigradeVectorTools::dot( dddchiNL, *getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) );
+        return;
 
-        dddD    += tardigradeVectorTools::dot( dddchiNL, *getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) );
+    }
 
-        floatMatrix dddChiNLBase = tardigradeVectorTools::dot( dddchiNL, *getdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ) );
+    void aspBase::setSurfaceAdhesionEnergyDensity( const floatType& value ){
+        /*!
+         * Set the surface adhesion energy density if required.
+         * 
+         * \param &value: the current value of the surface adhesion density
+         */
 
-        floatMatrix dddGradChi = tardigradeVectorTools::dot( dddchiNL, *getdNonLocalMicroDeformationdGradientMicroDeformation( ) );
+        _surfaceAdhesionEnergyDensity.second = value;
 
-        setdCurrentDistanceVectordLocalReferenceRelativePositionVector( dddXi );
+        _surfaceAdhesionEnergyDensity.first = true;
 
-        setdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( dddXiNL );
+        addInteractionPairData( &_surfaceAdhesionEnergyDensity );
 
-        setdCurrentDistanceVectordLocalReferenceDistanceVector( dddD );
+        return;
 
-        setdCurrentDistanceVectordLocalDeformationGradient( dddF );
+    }
 
-        setdCurrentDistanceVectordLocalMicroDeformation( dddchi );
+    void aspBase::setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ){
+        /*!
+         * Set the value of the gradient of the surface adhesion energy density w.r.t. the local deformation gradient
+         */
 
-        setdCurrentDistanceVectordNonLocalMicroDeformationBase( dddChiNLBase );
+        floatType surfaceAdhesionEnergyDensity;
 
-        setdCurrentDistanceVectordGradientMicroDeformation( dddGradChi );
+        floatVector dSEdF, dSEdChi, dSEdGradChi;
 
-        // Set second order derivatives
+        ERROR_TOOLS_CATCH( computeSurfaceAdhesionEnergyDensity( surfaceAdhesionEnergyDensity, dSEdF, dSEdChi, dSEdGradChi ) );
 
-        floatMatrix d2ddXiNLdXi( ( *dim ), floatVector( ( *dim ) * ( *dim ), 0 ) );
+        setSurfaceAdhesionEnergyDensity( surfaceAdhesionEnergyDensity );
 
-        floatMatrix d2ddGradChidXi( ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( *dim ) * ( *dim ), 0 ) );
+        setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( dSEdF );
 
-        floatMatrix d2ddXiNLdD( ( *dim ), floatVector( ( *dim ) * ( *dim ), 0 ) );
+        setdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( dSEdChi );
 
-        floatMatrix d2ddGradChidD( ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( *dim ) * ( *dim ), 0 ) );
+        setdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( dSEdGradChi );
 
-        floatMatrix d2ddXiNLdXiNL( ( *dim ), floatVector( ( *dim ) * ( *dim ), 0 ) );
+    }
 
-        floatMatrix d2ddChiNLBasedXiNL( ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( *dim ), 0 ) );
+    void aspBase::setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( const floatVector &value ){
+        /*!
+         * Set the value of the gradient of the surface adhesion energy density w.r.t. the local deformation gradient
+         * 
+         * \param &value: The value of the gradient of the surface adhesion energy density w.r.t. the local deformation gradient
+         */
 
-        floatMatrix d2ddGradChidXiNL( ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( *dim ) * ( *dim ), 0 ) );
+        _dSurfaceAdhesionEnergyDensitydLocalDeformationGradient.second = value;
 
-        for ( unsigned int i = 0; i < *dim; i++ ){
+        _dSurfaceAdhesionEnergyDensitydLocalDeformationGradient.first = true;
 
-            for ( unsigned int I = 0; I < ( *dim ) * ( *dim ); I++ ){
+        addInteractionPairData( &_dSurfaceAdhesionEnergyDensitydLocalDeformationGradient );
 
-                for ( unsigned int A = 0; A < *dim; A++ ){
-    
-                    for ( unsigned int B = 0; B < *dim; B++ ){
+    }
 
-                        d2ddXiNLdXi[ i ][ ( *dim ) * B + A ] += d2ddChiNLdXiNL[ i ][ ( *dim ) * I + B ]
-                                                              * ( *getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) )[ I ][ A ];
+    const floatVector* aspBase::getdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ){
+        /*!
+         * Get the value of the gradient of the surface adhesion energy density w.r.t. the deformation gradient
+         */
 
-                        d2ddXiNLdD[ i ][ ( *dim ) * B + A ] += d2ddChiNLdXiNL[ i ][ ( *dim ) * I + B ]
-                                                             * ( *getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) )[ I ][ A ];
+        if ( !_dSurfaceAdhesionEnergyDensitydLocalDeformationGradient.first ){
 
-                        d2ddXiNLdXiNL[ i ][ ( *dim ) * B + A ] += d2ddChiNLdXiNL[ i ][ ( *dim ) * I + B ]
-                                                                * ( *getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) )[ I ][ A ]
-                                                                + d2ddChiNLdXiNL[ i ][ ( *dim ) * I + A ]
-                                                                * ( *getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) )[ I ][ B ];
+            ERROR_TOOLS_CATCH( setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ) )
 
-                    }
+        }
 
-                    for ( unsigned int B = 0; B < ( *dim ) * ( *dim ); B++ ){
+        return &_dSurfaceAdhesionEnergyDensitydLocalDeformationGradient.second;
 
-                        d2ddChiNLBasedXiNL[ i ][ ( *dim ) * B + A ] += d2ddChiNLdXiNL[ i ][ ( *dim ) * I + A ]
-                                                                     * ( *getdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ) )[ I ][ B ];
+    }
 
-                    }
+    void aspBase::setdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( ){
+        /*!
+         * Set the value of the gradient of the surface adhesion energy density w.r.t. the local micro-deformation
+         */
 
-                    for ( unsigned int B = 0; B < ( *dim ) * ( *dim ) * ( *dim ); B++ ){
+        ERROR_TOOLS_CATCH( setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ) );
 
-                        d2ddGradChidXi[ i ][ ( *dim ) * B + A ] += dddchiNL[ i ][ I ]
-                                                                 * ( *getd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ) )[ I ][ ( *dim ) * ( *dim ) * ( *dim ) * A + B ];
+    }
 
-                        d2ddGradChidD[ i ][ ( *dim ) * B + A ] += dddchiNL[ i ][ I ]
-                                                                * ( *getd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( ) )[ I ][ ( *dim ) * ( *dim ) * ( *dim ) * A + B ];
+    void aspBase::setdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( const floatVector &value ){
+        /*!
+         * Set the value of the gradient of the surface adhesion energy density w.r.t. the local micro-deformation
+         * 
+         * \param &value: The value of the gradient of the surface adhesion energy density w.r.t. the local micro-deformation
+         */
 
-                        d2ddGradChidXiNL[ i ][ ( *dim ) * B + A ] += dddchiNL[ i ][ I ]
-                                                                 * ( *getd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( ) )[ I ][ ( *dim ) * ( *dim ) * ( *dim ) * A + B ]
-                                                                   + d2ddChiNLdXiNL[ i ][ ( *dim ) * I + A ]
-                                                                   * ( *getdNonLocalMicroDeformationdGradientMicroDeformation( ) )[ I ][ B ];
+        _dSurfaceAdhesionEnergyDensitydLocalMicroDeformation.second = value;
 
-                    }
+        _dSurfaceAdhesionEnergyDensitydLocalMicroDeformation.first = true;
 
-                }
+        addInteractionPairData( &_dSurfaceAdhesionEnergyDensitydLocalMicroDeformation );
 
-            }
+    }
 
-        }
+    const floatVector* aspBase::getdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( ){
+        /*!
+         * Get the value of the gradient of the surface adhesion energy density w.r.t. the micro-deformation
+         */
 
-        setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( d2ddXiNLdXi );
+        if ( !_dSurfaceAdhesionEnergyDensitydLocalMicroDeformation.first ){
 
-        setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( d2ddFdXi );
+            ERROR_TOOLS_CATCH( setdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( ) )
 
-        setd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( d2ddChidXi );
+        }
 
-        setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( d2ddGradChidXi );
+        return &_dSurfaceAdhesionEnergyDensitydLocalMicroDeformation.second;
 
-        setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( d2ddXiNLdD );
+    }
 
-        setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( d2ddFdD );
+    void aspBase::setdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( ){
+        /*!
+         * Set the value of the gradient of the surface adhesion energy density w.r.t. the gradient of the micro-deformation
+         */
 
-        setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( d2ddGradChidD );
+        ERROR_TOOLS_CATCH( setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ) );
 
-        setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( d2ddXiNLdXiNL );
+    }
 
-        setd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( d2ddFdXiNL );
+    void aspBase::setdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( const floatVector &value ){
+        /*!
+         * Set the value of the gradient of the surface adhesion energy density w.r.t. the gradient of the micro-deformation
+         * 
+         * \param &value: The value of the gradient of the surface adhesion energy density w.r.t. the gradient of the micro-deformation
+         */
 
-        setd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( d2ddChiNLBasedXiNL );
+        _dSurfaceAdhesionEnergyDensitydGradientMicroDeformation.second = value;
 
-        setd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( d2ddGradChidXiNL );
+        _dSurfaceAdhesionEnergyDensitydGradientMicroDeformation.first = true;
 
-        return;
+        addInteractionPairData( &_dSurfaceAdhesionEnergyDensitydGradientMicroDeformation );
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( ){
+    const floatVector* aspBase::getdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the local and non-local reference relative position vectors
+         * Get the value of the gradient of the surface adhesion energy density w.r.t. the gradient of the micro-deformation
          */
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        if ( !_dSurfaceAdhesionEnergyDensitydGradientMicroDeformation.first ){
+
+            ERROR_TOOLS_CATCH( setdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( ) )
+
+        }
+
+        return &_dSurfaceAdhesionEnergyDensitydGradientMicroDeformation.second;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( const floatMatrix &value ){
+    void aspBase::setSurfaceOverlapEnergyDensity( ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the local and non-local reference relative position vectors
-         * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the local and non-local reference relative position vectors
+         * Set the surface overlap energy density if required.
          */
 
-        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector.second = value;
+        mapFloatType surfaceOverlapEnergyDensity;
 
-        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector.first = true;
+        ERROR_TOOLS_CATCH( computeSurfaceOverlapEnergyDensity( surfaceOverlapEnergyDensity ) );
 
-        addInteractionPairData( &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector );
+        setSurfaceOverlapEnergyDensity( surfaceOverlapEnergyDensity );
+
+        return;
 
     }
 
-    const floatMatrix* aspBase::getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( ){
+    void aspBase::setSurfaceOverlapEnergyDensity( const mapFloatType &value ){
         /*!
-         * Get the gradient of the current distance vector w.r.t. the local and non-local reference relative position vectors
+         * Set the surface overlap energy density if required.
+         * 
+         * \param &value: The map to the surface overlap energy density
          */
 
-        if ( !_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector.first ){
+        _surfaceOverlapEnergyDensity.second = value;
 
-            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( ) );
+        _surfaceOverlapEnergyDensity.first = true;
 
-        }
+        addInteractionPairData( &_surfaceOverlapEnergyDensity );
 
-        return &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector.second;
+        return;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( ){
+    void aspBase::setSurfaceOverlapParameters( ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the non-local reference relative position vectors twice
+         * Set the surface overlap parameters
          */
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        setSurfaceOverlapParameters( { 1 } );
+
+        return;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
+    void aspBase::setSurfaceOverlapParameters( const floatVector &value ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the non-local reference relative position vectors twice
+         * Set the surface overlap parameters
          * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the non-local reference relative position vectors twice
+         * \param &value: Set the value of the surface overlap parameters
          */
 
-        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector.second = value;
+        _surfaceOverlapParameters.second = value;
 
-        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector.first = true;
+        _surfaceOverlapParameters.first = true;
 
-        addInteractionPairData( &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector );
+        addInteractionPairData( &_surfaceOverlapParameters );
+
+        return;
 
     }
 
-    const floatMatrix* aspBase::getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( ){
+    const floatVector *aspBase::getSurfaceOverlapParameters( ){
         /*!
-         * Get the gradient of the current distance vector w.r.t. the non-local reference relative position vectors twice
+         * Get the surface overlap parameters
          */
 
-        if ( !_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector.first ){
+        if ( !_surfaceOverlapParameters.first ){
 
-            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( ) );
+            ERROR_TOOLS_CATCH( setSurfaceOverlapParameters( ) );
 
         }
 
-        return &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector.second;
+        return &_surfaceOverlapParameters.second;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( ){
+    void aspBase::setLocalReferenceSurfacePoints( ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference relative position vector
+         * Set the collection of points which are on the surface of the local particle in the reference configuration
          */
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        const floatVector *unitSpherePoints;
+        ERROR_TOOLS_CATCH( unitSpherePoints = getUnitSpherePoints( ) );
+
+        const floatType *localReferenceRadius;
+        ERROR_TOOLS_CATCH( localReferenceRadius = getLocalReferenceRadius( ) );
+
+        setLocalReferenceSurfacePoints( ( *localReferenceRadius ) * ( *unitSpherePoints ) );
+
+        return;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( const floatMatrix &value ){
+    void aspBase::setLocalReferenceSurfacePoints( const floatVector &value ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference relative position vectors
-         * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the local deformation gradient and the local reference relative position vectors
+         * Set the collection of points which are on the surface of the local particle in the reference configuration
+         * \param &value: The values of the local reference surface points
          */
 
-        _d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector.second = value;
+        _localReferenceSurfacePoints.second = value;
 
-        _d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector.first = true;
+        _localReferenceSurfacePoints.first = true;
 
-        addInteractionPairData( &_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector );
+        addLocalParticleData( &_localReferenceSurfacePoints );
 
     }
 
-    const floatMatrix* aspBase::getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( ){
+    const floatVector* aspBase::getLocalReferenceSurfacePoints( ){
         /*!
-         * Get the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference relative position vectors
+         * Get the local reference surface points
          */
 
-        if ( !_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector.first ){
+        if ( !_localReferenceSurfacePoints.first ){
 
-            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( ) );
+            ERROR_TOOLS_CATCH( setLocalReferenceSurfacePoints( ) );
 
         }
 
-        return &_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector.second;
+        return &_localReferenceSurfacePoints.second;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( ){
+    void aspBase::setNonLocalReferenceSurfacePoints( ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the non-local micro-deformation base and the non-local reference relative position vector
+         * Set the collection of points which are on the surface of the non-local particle in the reference configuration
          */
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        const floatVector *unitSpherePoints;
+        ERROR_TOOLS_CATCH( unitSpherePoints = getUnitSpherePoints( ) );
+
+        const floatType *nonLocalReferenceRadius;
+        ERROR_TOOLS_CATCH( nonLocalReferenceRadius = getNonLocalReferenceRadius( ) );
+
+        setNonLocalReferenceSurfacePoints( ( *nonLocalReferenceRadius ) * ( *unitSpherePoints ) );
+
+        return;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
+    void aspBase::setNonLocalReferenceSurfacePoints( const floatVector &value ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the non-local micro-deformation base and the non-local reference relative position vectors
+         * Set the collection of points which are on the surface of the non-local particle in the reference configuration
          * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the non-local micro-deformation base and the non-local reference relative position vectors
+         * \param &value: The value of the non-local reference surface points
          */
 
-        _d2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector.second = value;
+        _nonLocalReferenceSurfacePoints.second = value;
 
-        _d2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector.first = true;
+        _nonLocalReferenceSurfacePoints.first = true;
 
-        addInteractionPairData( &_d2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector );
+        addInteractionPairData( &_nonLocalReferenceSurfacePoints );
+
+        return;
 
     }
 
-    const floatMatrix* aspBase::getd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( ){
+    const floatVector* aspBase::getNonLocalReferenceSurfacePoints( ){
         /*!
-         * Get the gradient of the current distance vector w.r.t. the non-local micro-deformation base and the non-local reference relative position vectors
+         * Get the non-local reference surface points
          */
 
-        if ( !_d2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector.first ){
+        if ( !_nonLocalReferenceSurfacePoints.first ){
 
-            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( ) );
+            ERROR_TOOLS_CATCH( setNonLocalReferenceSurfacePoints( ) );
 
         }
 
-        return &_d2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector.second;
+        return &_nonLocalReferenceSurfacePoints.second;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( ){
-        /*!
-         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the non-local reference relative position vector
-         */
+    void aspBase::setLocalCurrentSurfacePoints( ){
+        /*!
+         * Set the collection of points on the surface of the local particle in the current configuration
+         */
+
+        const unsigned int *dim = getDimension( );
+
+        const floatVector *localReferenceSurfacePoints;
+        ERROR_TOOLS_CATCH( localReferenceSurfacePoints = getLocalReferenceSurfacePoints( ) );
+
+        const floatVector *localMicroDeformation;
+        ERROR_TOOLS_CATCH( localMicroDeformation = getLocalMicroDeformation( ) );
+
+        floatVector localCurrentSurfacePoints;
+
+        ERROR_TOOLS_CATCH( localCurrentSurfacePoints = tardigradeVectorTools::matrixMultiply( *localReferenceSurfacePoints, *localMicroDeformation,
+                                                                                    localReferenceSurfacePoints->size( ) / ( *dim ), *dim, *dim, *dim, false, true ) );
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        setLocalCurrentSurfacePoints( localCurrentSurfacePoints );
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
+    void aspBase::setLocalCurrentSurfacePoints( const floatVector &value ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the non-local reference relative position vectors
-         * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the local deformation gradient and the non-local reference relative position vectors
+         * Set the collection of points on the surface of the local particle in the current configuration
+         *
+         * \param &value: The current points on the surface of the local particle
          */
 
-        _d2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector.second = value;
+        _localCurrentSurfacePoints.second = value;
 
-        _d2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector.first = true;
+        _localCurrentSurfacePoints.first = true;
 
-        addInteractionPairData( &_d2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector );
+        addLocalParticleData( &_localCurrentSurfacePoints );
 
     }
 
-    const floatMatrix* aspBase::getd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( ){
+    const floatVector* aspBase::getLocalCurrentSurfacePoints( ){
         /*!
-         * Get the gradient of the current distance vector w.r.t. the local deformation gradient and the non-local reference relative position vectors
+         * Get the collection of points on the surface of the local particle in the current configuration
          */
 
-        if ( !_d2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector.first ){
+        if ( !_localCurrentSurfacePoints.first ){
 
-            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( ) );
+            ERROR_TOOLS_CATCH( setLocalCurrentSurfacePoints( ) );
 
         }
 
-        return &_d2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector.second;
+        return &_localCurrentSurfacePoints.second;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( ){
+    void aspBase::setLocalCurrentSurfacePointsBroadPhase( ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the local micro-deformation and the local reference relative position vector
+         * Set the collection of points on the surface of the local particle in the current configuration in the precision
+         * of the overlap candidate culling
          */
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        const floatVector *localCurrentSurfacePoints;
+        ERROR_TOOLS_CATCH( localCurrentSurfacePoints = getLocalCurrentSurfacePoints( ) );
+
+        setLocalCurrentSurfacePointsBroadPhase( broadPhaseFloatVector( localCurrentSurfacePoints->begin( ), localCurrentSurfacePoints->end( ) ) );
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( const floatMatrix &value ){
+    void aspBase::setLocalCurrentSurfacePointsBroadPhase( const broadPhaseFloatVector &value ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the local micro-deformation and the local reference relative position vectors
-         * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the local micro-deformation and the local reference relative position vectors
+         * Set the collection of points on the surface of the local particle in the current configuration in the precision
+         * of the overlap candidate culling
+         *
+         * \param &value: The current points on the surface of the local particle
          */
 
-        _d2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector.second = value;
+        _localCurrentSurfacePointsBroadPhase.second = value;
 
-        _d2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector.first = true;
+        _localCurrentSurfacePointsBroadPhase.first = true;
 
-        addInteractionPairData( &_d2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector );
+        addLocalParticleData( &_localCurrentSurfacePointsBroadPhase );
 
     }
 
-    const floatMatrix* aspBase::getd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( ){
+    const broadPhaseFloatVector* aspBase::getLocalCurrentSurfacePointsBroadPhase( ){
         /*!
-         * Get the gradient of the current distance vector w.r.t. the local micro deformation and the local reference relative position vectors
+         * Get the collection of points on the surface of the local particle in the current configuration in the precision
+         * of the overlap candidate culling. The points are converted once for each local particle and shared by all of its
+         * interaction pairs. If the culling is performed in floatType the current surface points are returned directly.
          */
 
-        if ( !_d2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector.first ){
+#ifdef ASP_SINGLE_PRECISION_BROAD_PHASE
+        if ( !_localCurrentSurfacePointsBroadPhase.first ){
 
-            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( ) );
+            ERROR_TOOLS_CATCH( setLocalCurrentSurfacePointsBroadPhase( ) );
 
         }
 
-        return &_d2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector.second;
+        return &_localCurrentSurfacePointsBroadPhase.second;
+#else
+        return getLocalCurrentSurfacePoints( );
+#endif
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( ){
+    void aspBase::setNonLocalCurrentSurfacePoints( ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the local reference relative position vector
+         * Set the collection of points on the surface of the non-local particle in the current configuration
          */
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        const unsigned int *dim = getDimension( );
+
+        const floatVector *nonLocalReferenceSurfacePoints;
+        ERROR_TOOLS_CATCH( nonLocalReferenceSurfacePoints = getNonLocalReferenceSurfacePoints( ) );
+
+        const floatVector *nonLocalMicroDeformation;
+        ERROR_TOOLS_CATCH( nonLocalMicroDeformation = getNonLocalMicroDeformation( ) );
+
+        floatVector nonLocalCurrentSurfacePoints;
+
+        ERROR_TOOLS_CATCH( nonLocalCurrentSurfacePoints = tardigradeVectorTools::matrixMultiply( *nonLocalReferenceSurfacePoints, *nonLocalMicroDeformation,
+                                                                                       nonLocalReferenceSurfacePoints->size( ) / ( *dim ),
+                                                                                               *dim, *dim, *dim, false, true ) );
+
+        setNonLocalCurrentSurfacePoints( nonLocalCurrentSurfacePoints );
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( const floatMatrix &value ){
+    void aspBase::setNonLocalCurrentSurfacePoints( const floatVector &value ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the local reference relative position vectors
+         * Set the collection of points on the surface of the non-local particle in the current configuration
          * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the gradient micro-deformation and the local reference relative position vectors
+         * \param &value: The current non-local surface points
          */
 
-        _d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector.second = value;
+        _nonLocalCurrentSurfacePoints.second = value;
 
-        _d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector.first = true;
+        _nonLocalCurrentSurfacePoints.first = true;
 
-        addInteractionPairData( &_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector );
+        addInteractionPairData( &_nonLocalCurrentSurfacePoints );
 
     }
 
-    const floatMatrix* aspBase::getd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( ){
+    const floatVector* aspBase::getNonLocalCurrentSurfacePoints( ){
         /*!
-         * Get the gradient of the current distance vector w.r.t. the gradient micro deformation and the local reference relative position vectors
+         * Get the collection of points on the surface of the non-local particle in the current configuration
          */
 
-        if ( !_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector.first ){
+        if ( !_nonLocalCurrentSurfacePoints.first ){
 
-            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( ) );
+            ERROR_TOOLS_CATCH( setNonLocalCurrentSurfacePoints( ) );
 
         }
 
-        return &_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector.second;
+        return &_nonLocalCurrentSurfacePoints.second;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( ){
+    void aspBase::setLocalParticleCurrentBoundingBox( ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the non-local reference relative position and local
-         * reference distance vector
+         * Set the bounding box of the local particle (dimension, (lower bound, upper bound))
          */
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        const floatVector *localCurrentSurfacePoints;
+        ERROR_TOOLS_CATCH( localCurrentSurfacePoints = getLocalCurrentSurfacePoints( ) ); 
+
+        floatMatrix localParticleCurrentBoundingBox;
+
+        ERROR_TOOLS_CATCH( formBoundingBox( *localCurrentSurfacePoints, localParticleCurrentBoundingBox ) );
+
+        setLocalParticleCurrentBoundingBox( localParticleCurrentBoundingBox );
+
+        return;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( const floatMatrix &value ){
+    void aspBase::setLocalParticleCurrentBoundingBox( const floatMatrix &value ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the non-local reference relative position vectors and local
-         * reference distance vector
+         * Set the bounding box of the local particle (dimension, (lower bound, upper bound))
          * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the non-local reference relative position vector
-         *     and local reference distance vector
+         * \param &value: The local particle's current bounding box
          */
 
-        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector.second = value;
+        _localParticleCurrentBoundingBox.second = value;
 
-        _d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector.first = true;
+        _localParticleCurrentBoundingBox.first = true;
 
-        addInteractionPairData( &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector );
+        addLocalParticleData( &_localParticleCurrentBoundingBox );
+
+        return;
 
     }
 
-    const floatMatrix* aspBase::getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( ){
+    template< typename pointType >
+    void aspBase::formBoundingBox( const std::vector< pointType > &points, floatMatrix &boundingBox ){
         /*!
-         * Get the gradient of the current distance vector w.r.t. the non-local reference relative position vector and the local
-         *   reference distance vector
+         * Form a bounding box from the provided points. If the points are stored in a lower precision than floatType the
+         * bounds are moved outwards to the next representable value so that the box contains the points they were rounded from.
+         * 
+         * \param &points: The points to form the bounding box in [x1, y1, z1, x2, y2, z2, ...] format
+         * \param &boundingBox: The resulting bounding box
          */
 
-        if ( !_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector.first ){
+        ASP_INSTRUMENT_STAGE( BOUNDING_BOX );
 
-            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( ) );
+        const unsigned int *dim = getDimension( );
+
+        if ( ( points.size( ) % ( *dim ) ) > 0 ){
+
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "The length of points must be an integer multiple of the dimension.\n  points.size( ) = " + std::to_string( points.size( ) ) + "\n  dimension: " + std::to_string( ( *dim ) ) ) );
 
         }
 
-        return &_d2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector.second;
+        if ( points.size( ) < ( *dim ) ){
 
-    }
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "The points need at least one point" ) );
 
-    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( ){
-        /*!
-         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference distance vector
-         */
+        }
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        boundingBox = { { points[ 0 ], points[ 0 ] },
+                        { points[ 1 ], points[ 1 ] },
+                        { points[ 2 ], points[ 2 ] } };
 
-    }
+        for ( unsigned int i = ( *dim ); i < points.size( ); i += ( *dim ) ){
 
-    void aspBase::setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( const floatMatrix &value ){
-        /*!
-         * Set the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference distance vectors
-         * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the local deformation gradient and the local reference distance vectors
-         */
+            for ( unsigned int j = 0; j < ( *dim ); j++ ){
 
-        _d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector.second = value;
+                boundingBox[ j ][ 0 ] = std::fmin( boundingBox[ j ][ 0 ], points[ i + j ] );
+                boundingBox[ j ][ 1 ] = std::fmax( boundingBox[ j ][ 1 ], points[ i + j ] );
 
-        _d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector.first = true;
+            }
 
-        addInteractionPairData( &_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector );
+        }
 
-    }
+        if ( std::numeric_limits< pointType >::digits < std::numeric_limits< floatType >::digits ){
 
-    const floatMatrix* aspBase::getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( ){
-        /*!
-         * Get the gradient of the current distance vector w.r.t. the local deformation gradient and the local reference distance vectors
-         */
+            for ( unsigned int j = 0; j < ( *dim ); j++ ){
 
-        if ( !_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector.first ){
+                boundingBox[ j ][ 0 ] = std::nextafter( static_cast< pointType >( boundingBox[ j ][ 0 ] ), -std::numeric_limits< pointType >::infinity( ) );
+                boundingBox[ j ][ 1 ] = std::nextafter( static_cast< pointType >( boundingBox[ j ][ 1 ] ), std::numeric_limits< pointType >::infinity( ) );
 
-            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( ) );
+            }
 
         }
 
-        return &_d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector.second;
+        return;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( ){
-        /*!
-         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the local reference distance vector
-         */
-
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+    template void aspBase::formBoundingBox< double >( const std::vector< double > &points, floatMatrix &boundingBox );
 
-    }
+    template void aspBase::formBoundingBox< float >( const std::vector< float > &points, floatMatrix &boundingBox );
 
-    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( const floatMatrix &value ){
+    bool aspBase::boundingBoxesOverlap( const floatMatrix &boundingBox1, const floatMatrix &boundingBox2 ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the local reference distance vectors
+         * Determine if two bounding boxes overlap. Boxes which share a face, edge, or corner are considered to overlap.
          * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the gradient micro-deformation and the local reference distance vectors
+         * \param &boundingBox1: The first bounding box in the form (dimension, 2) where for each dimension
+         *    the row is of the form (lower bound, upper bound)
+         * \param &boundingBox2: The second bounding box in the same form as the first
          */
 
-        _d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector.second = value;
+        if ( boundingBox1.size( ) != boundingBox2.size( ) ){
 
-        _d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector.first = true;
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "The bounding boxes must be the same size.\n  boundingBox1.size( ): " + std::to_string( boundingBox1.size( ) ) + "\n  boundingBox2.size( ): " + std::to_string( boundingBox2.size( ) ) ) );
 
-        addInteractionPairData( &_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector );
+        }
 
-    }
+        for ( unsigned int i = 0; i < boundingBox1.size( ); i++ ){
 
-    const floatMatrix* aspBase::getd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( ){
-        /*!
-         * Get the gradient of the current distance vector w.r.t. the gradient micro deformation and the local reference distance vectors
-         */
+            if ( ( boundingBox1[ i ].size( ) != 2 ) || ( boundingBox2[ i ].size( ) != 2 ) ){
 
-        if ( !_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector.first ){
+                ERROR_TOOLS_CATCH( throw std::runtime_error( "The bounding boxes' rows must be of length 2 but row " + std::to_string( i ) + " has lengths of " + std::to_string( boundingBox1[ i ].size( ) ) + " and " + std::to_string( boundingBox2[ i ].size( ) ) ) );
 
-            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( ) );
+            }
 
-        }
+            if ( ( boundingBox1[ i ][ 1 ] < boundingBox2[ i ][ 0 ] ) || ( boundingBox2[ i ][ 1 ] < boundingBox1[ i ][ 0 ] ) ){
 
-        return &_d2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector.second;
+                return false;
 
-    }
+            }
 
-    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( ){
-        /*!
-         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the non-local reference relative position vector
-         */
+        }
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        return true;
 
     }
 
-    void aspBase::setd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
+    void aspBase::formNeighborLists( const std::vector< floatMatrix > &boundingBoxes, std::vector< std::vector< unsigned int > > &neighbors ){
         /*!
-         * Set the gradient of the current distance vector w.r.t. the gradient micro-deformation and the non-local reference relative position vector
+         * Form the lists of the bounding boxes which overlap each of the provided bounding boxes. Each bounding box is
+         * considered to be its own neighbor.
          * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the gradient micro-deformation and the non-local reference relative position vectors
+         * The boxes are binned into a uniform grid whose cell size is the largest extent of any of the boxes so that
+         * each box touches at most two cells in each direction and only boxes which share a cell need to be compared.
+         * 
+         * \param &boundingBoxes: The bounding boxes in the form (dimension, 2) where for each dimension the row is
+         *     of the form (lower bound, upper bound)
+         * \param &neighbors: The sorted indices of the bounding boxes which overlap each bounding box
          */
 
-        _d2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector.second = value;
+        const unsigned int *dim = getDimension( );
 
-        _d2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector.first = true;
+        neighbors = std::vector< std::vector< unsigned int > >( boundingBoxes.size( ) );
 
-        addInteractionPairData( &_d2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector );
+        if ( boundingBoxes.size( ) == 0 ){
 
-    }
+            return;
 
-    const floatMatrix* aspBase::getd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( ){
-        /*!
-         * Get the gradient of the current distance vector w.r.t. the gradient micro deformation and the non-local reference relative position vectors
-         */
+        }
 
-        if ( !_d2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector.first ){
+        // Determine the size of the grid cells and the origin of the grid
+        floatType cellSize = 0;
 
-            ERROR_TOOLS_CATCH( setd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( ) );
+        floatVector origin( *dim );
 
-        }
+        for ( unsigned int i = 0; i < boundingBoxes.size( ); i++ ){
 
-        return &_d2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector.second;
+            if ( boundingBoxes[ i ].size( ) != ( *dim ) ){
 
-    }
+                ERROR_TOOLS_CATCH( throw std::runtime_error( "Bounding box " + std::to_string( i ) + " has " + std::to_string( boundingBoxes[ i ].size( ) ) + " rows but should have " + std::to_string( *dim ) ) );
 
-    void aspBase::setCurrentDistanceVector( const floatVector &value ){
-        /*!
-         * Set the current distance vector
-         * 
-         * \param &value: The value of the current distance vector
-         */
+            }
 
-        _currentDistanceVector.second = value;
+            for ( unsigned int j = 0; j < ( *dim ); j++ ){
 
-        _currentDistanceVector.first = true;
+                if ( boundingBoxes[ i ][ j ].size( ) != 2 ){
 
-        addInteractionPairData( &_currentDistanceVector );
+                    ERROR_TOOLS_CATCH( throw std::runtime_error( "Row " + std::to_string( j ) + " of bounding box " + std::to_string( i ) + " has a length of " + std::to_string( boundingBoxes[ i ][ j ].size( ) ) + " and it should be of length 2" ) );
 
-        return;
+                }
 
-    }
+                cellSize = std::fmax( cellSize, boundingBoxes[ i ][ j ][ 1 ] - boundingBoxes[ i ][ j ][ 0 ] );
 
-    void aspBase::setdCurrentDistanceVectordLocalReferenceRelativePositionVector( ){
-        /*!
-         * set the derivative of the current distance vector w.r.t. the local reference
-         * relative position vector.
-         */
+                if ( i == 0 ){
+
+                    origin[ j ] = boundingBoxes[ i ][ j ][ 0 ];
+
+                }
+                else{
+
+                    origin[ j ] = std::fmin( origin[ j ], boundingBoxes[ i ][ j ][ 0 ] );
+
+                }
+
+            }
+
+        }
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        if ( cellSize <= 0 ){
 
-    }
+            // All of the boxes are points so any positive cell size will do
+            cellSize = 1;
 
-    void aspBase::setdCurrentDistanceVectordLocalReferenceRelativePositionVector( const floatMatrix &value ){
-        /*!
-         * set the derivative of the current distance vector w.r.t. the local reference
-         * relative position vector.
-         * 
-         * \param &value: The derivative of the current distance vector w.r.t. the local
-         *     reference relative position vector
-         */
+        }
 
-        _dCurrentDistanceVectordLocalReferenceRelativePositionVector.second = value;
+        // Compute the range of cells that each bounding box touches
+        std::vector< std::vector< long int > > lowerCells( boundingBoxes.size( ), std::vector< long int >( *dim ) );
 
-        _dCurrentDistanceVectordLocalReferenceRelativePositionVector.first = true;
+        std::vector< std::vector< long int > > upperCells( boundingBoxes.size( ), std::vector< long int >( *dim ) );
 
-        addInteractionPairData( &_dCurrentDistanceVectordLocalReferenceRelativePositionVector );
+        for ( unsigned int i = 0; i < boundingBoxes.size( ); i++ ){
 
-    }
+            for ( unsigned int j = 0; j < ( *dim ); j++ ){
 
-    const floatMatrix *aspBase::getdCurrentDistanceVectordLocalReferenceRelativePositionVector( ){
-        /*!
-         * Get the derivative of the current distance vector w.r.t. the local reference
-         * relative position vector.
-         */
+                lowerCells[ i ][ j ] = ( long int )std::floor( ( boundingBoxes[ i ][ j ][ 0 ] - origin[ j ] ) / cellSize );
 
-        if ( !_dCurrentDistanceVectordLocalReferenceRelativePositionVector.first ){
+                upperCells[ i ][ j ] = ( long int )std::floor( ( boundingBoxes[ i ][ j ][ 1 ] - origin[ j ] ) / cellSize );
 
-            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordLocalReferenceRelativePositionVector( ) )
+            }
 
         }
 
-        return &_dCurrentDistanceVectordLocalReferenceRelativePositionVector.second;
+        // Loop over all of the cells between the lower and upper cells of a box
+        auto forEachCell = [ & ]( const unsigned int &index, std::function< void( const std::vector< long int > & ) > function ){
 
-    }
+            std::vector< long int > cell = lowerCells[ index ];
 
-    void aspBase::setdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ){
-        /*!
-         * set the derivative of the current distance vector w.r.t. the non-local reference
-         * relative position vector.
-         */
+            while ( true ){
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+                function( cell );
 
-    }
+                unsigned int j = 0;
 
-    void aspBase::setdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( const floatMatrix &value ){
-        /*!
-         * set the derivative of the current distance vector w.r.t. the non-local reference
-         * relative position vector.
-         * 
-         * \param &value: The value of the derivative of the current distance vector w.r.t. the non-local relative position vector.
-         */
+                for ( ; j < ( *dim ); j++ ){
 
-        _dCurrentDistanceVectordNonLocalReferenceRelativePositionVector.second = value;
+                    if ( cell[ j ] < upperCells[ index ][ j ] ){
 
-        _dCurrentDistanceVectordNonLocalReferenceRelativePositionVector.first = true;
+                        cell[ j ]++;
 
-        addInteractionPairData( &_dCurrentDistanceVectordNonLocalReferenceRelativePositionVector );
+                        break;
 
-    }
+                    }
 
-    const floatMatrix *aspBase::getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ){
-        /*!
-         * Get the derivative of the current distance vector w.r.t. the non-local reference
-         * relative position vector.
-         */
+                    cell[ j ] = lowerCells[ index ][ j ];
 
-        if ( !_dCurrentDistanceVectordNonLocalReferenceRelativePositionVector.first ){
+                }
 
-            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )
+                if ( j == ( *dim ) ){
 
-        }
+                    break;
 
-        return &_dCurrentDistanceVectordNonLocalReferenceRelativePositionVector.second;
+                }
 
-    }
+            }
 
-    void aspBase::setdCurrentDistanceVectordLocalReferenceDistanceVector( ){
-        /*!
-         * set the derivative of the current distance vector w.r.t. the reference
-         * distance vector
-         */
+        };
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        // Bin the bounding boxes
+        std::map< std::vector< long int >, std::vector< unsigned int > > grid;
 
-    }
+        for ( unsigned int i = 0; i < boundingBoxes.size( ); i++ ){
 
-    void aspBase::setdCurrentDistanceVectordLocalReferenceDistanceVector( const floatMatrix &value ){
-        /*!
-         * set the derivative of the current distance vector w.r.t. the reference
-         * distance vector
-         * 
-         * \param &value: The derivative of the current distance vector w.r.t. the reference distance vector
-         */
+            forEachCell( i, [ & ]( const std::vector< long int > &cell ){ grid[ cell ].push_back( i ); } );
 
-        _dCurrentDistanceVectordLocalReferenceDistanceVector.second = value;
+        }
 
-        _dCurrentDistanceVectordLocalReferenceDistanceVector.first = true;
+        // Find the overlapping boxes in the neighboring cells
+        for ( unsigned int i = 0; i < boundingBoxes.size( ); i++ ){
 
-        addInteractionPairData( &_dCurrentDistanceVectordLocalReferenceDistanceVector );
+            forEachCell( i, [ & ]( const std::vector< long int > &cell ){
 
-    }
+                const std::vector< unsigned int > &candidates = grid.find( cell )->second;
 
-    const floatMatrix *aspBase::getdCurrentDistanceVectordLocalReferenceDistanceVector( ){
-        /*!
-         * Get the derivative of the current distance vector w.r.t. the reference distance vector.
-         */
+                for ( auto j = candidates.begin( ); j != candidates.end( ); j++ ){
 
-        if ( !_dCurrentDistanceVectordLocalReferenceDistanceVector.first ){
+                    if ( boundingBoxesOverlap( boundingBoxes[ i ], boundingBoxes[ *j ] ) ){
 
-            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordLocalReferenceDistanceVector( ) )
+                        neighbors[ i ].push_back( *j );
 
-        }
+                    }
 
-        return &_dCurrentDistanceVectordLocalReferenceDistanceVector.second;
+                }
 
-    }
+            } );
 
-    void aspBase::setdCurrentDistanceVectordLocalDeformationGradient( ){
-        /*!
-         * set the derivative of the current distance vector w.r.t. the local
-         * deformation gradient.
-         */
+            // Boxes which share more than one cell will have been found more than once
+            std::sort( neighbors[ i ].begin( ), neighbors[ i ].end( ) );
+
+            neighbors[ i ].erase( std::unique( neighbors[ i ].begin( ), neighbors[ i ].end( ) ), neighbors[ i ].end( ) );
+
+        }
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        return;
 
     }
 
-    void aspBase::setdCurrentDistanceVectordLocalDeformationGradient( const floatMatrix &value ){
+    void aspBase::selectInteractionPairs( const std::vector< std::vector< unsigned int > > &neighbors, std::vector< std::vector< unsigned int > > &pairs ){
         /*!
-         * set the derivative of the current distance vector w.r.t. the local
-         * deformation gradient.
+         * Select the particle pairs whose surface responses are assembled from the neighbor lists of the local particles
+         * according to _pairSelection.
          * 
-         * \param &value: The derivative of the current distance vector w.r.t. the local
-         *     deformation gradient.
+         * A particle cannot adhere to or overlap with itself so DISTINCT_PAIRS removes each particle from its own list.
+         * The responses of a pair are evaluated at the surface points of the local particle so both ( i, k ) and ( k, i )
+         * are retained.
+         * 
+         * \param &neighbors: The sorted indices of the candidate non-local particles for each local particle
+         * \param &pairs: The sorted indices of the non-local particles whose pairs with each local particle are assembled
          */
 
-        _dCurrentDistanceVectordLocalDeformationGradient.second = value;
+        pairs = std::vector< std::vector< unsigned int > >( neighbors.size( ) );
 
-        _dCurrentDistanceVectordLocalDeformationGradient.first = true;
+        for ( unsigned int i = 0; i < neighbors.size( ); i++ ){
 
-        addInteractionPairData( &_dCurrentDistanceVectordLocalDeformationGradient );
+            pairs[ i ].reserve( neighbors[ i ].size( ) );
 
-    }
+            for ( auto k = neighbors[ i ].begin( ); k != neighbors[ i ].end( ); k++ ){
 
-    const floatMatrix *aspBase::getdCurrentDistanceVectordLocalDeformationGradient( ){
-        /*!
-         * Get the derivative of the current distance vector w.r.t. the local deformation gradient.
-         */
+                if ( ( _pairSelection == ALL_PAIRS ) || ( *k != i ) ){
 
-        if ( !_dCurrentDistanceVectordLocalDeformationGradient.first ){
+                    pairs[ i ].push_back( *k );
 
-            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordLocalDeformationGradient( ) )
+                }
+
+            }
 
         }
 
-        return &_dCurrentDistanceVectordLocalDeformationGradient.second;
+        return;
 
     }
 
-    void aspBase::setdCurrentDistanceVectordLocalMicroDeformation( ){
+    const floatMatrix* aspBase::getLocalParticleCurrentBoundingBox( ){
         /*!
-         * set the derivative of the current distance vector w.r.t. the local
-         * micro-deformation
+         * Get the local particle's bounding box
          */
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        if ( !_localParticleCurrentBoundingBox.first ){
+
+            ERROR_TOOLS_CATCH( setLocalParticleCurrentBoundingBox( ) );
+
+        }
+
+        return &_localParticleCurrentBoundingBox.second;
 
     }
 
-    void aspBase::setdCurrentDistanceVectordLocalMicroDeformation( const floatMatrix &value ){
+    void aspBase::setNonLocalParticleCurrentBoundingBox( ){
         /*!
-         * set the derivative of the current distance vector w.r.t. the local
-         * micro-deformation
-         * 
-         * \param &value: The derivative of the current distance vector w.r.t. the local
-         *     micro-deformation
+         * Set the bounding box of the non-local particle (dimension, (lower bound, upper bound))
          */
 
-        _dCurrentDistanceVectordLocalMicroDeformation.second = value;
+        const floatVector *nonLocalCurrentSurfacePoints;
+        ERROR_TOOLS_CATCH( nonLocalCurrentSurfacePoints = getNonLocalCurrentSurfacePoints( ) ); 
 
-        _dCurrentDistanceVectordLocalMicroDeformation.first = true;
+        floatMatrix nonLocalParticleCurrentBoundingBox;
 
-        addInteractionPairData( &_dCurrentDistanceVectordLocalMicroDeformation );
+        ERROR_TOOLS_CATCH( formBoundingBox( *nonLocalCurrentSurfacePoints, nonLocalParticleCurrentBoundingBox ) );
+
+        setNonLocalParticleCurrentBoundingBox( nonLocalParticleCurrentBoundingBox );
+
+        return;
 
     }
 
-    const floatMatrix *aspBase::getdCurrentDistanceVectordLocalMicroDeformation( ){
+    void aspBase::setNonLocalParticleCurrentBoundingBox( const floatMatrix &value ){
         /*!
-         * Get the derivative of the current distance vector w.r.t. the local micro-deformation.
+         * Set the bounding box of the non-local particle (dimension, (lower bound, upper bound))
+         * 
+         * \param &value: The non-local particle's current bounding box
          */
 
-        if ( !_dCurrentDistanceVectordLocalMicroDeformation.first ){
+        _nonLocalParticleCurrentBoundingBox.second = value;
 
-            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordLocalMicroDeformation( ) )
+        _nonLocalParticleCurrentBoundingBox.first = true;
 
-        }
+        addInteractionPairData( &_nonLocalParticleCurrentBoundingBox );
 
-        return &_dCurrentDistanceVectordLocalMicroDeformation.second;
+        return;
 
     }
 
-    void aspBase::setdCurrentDistanceVectordNonLocalMicroDeformationBase( ){
+    void aspBase::setSurfaceAdhesionTraction( ){
         /*!
-         * set the derivative of the current distance vector w.r.t. the non-local
-         * micro-deformation
+         * Set the surface adhesion traction
          */
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        floatVector surfaceAdhesionTraction;
+
+        ERROR_TOOLS_CATCH( computeSurfaceAdhesionTraction( surfaceAdhesionTraction ) );
+
+        setSurfaceAdhesionTraction( surfaceAdhesionTraction );
+
+        return;
 
     }
 
-    void aspBase::setdCurrentDistanceVectordNonLocalMicroDeformationBase( const floatMatrix &value ){
+    void aspBase::setSurfaceAdhesionTraction( const floatVector &value ){
         /*!
-         * set the derivative of the current distance vector w.r.t. the non-local
-         * micro-deformation
-         * 
-         * \param &value: The derivative of the current distance vector w.r.t. the non-local micro-deformation
+         * Set the surface adhesion traction
+         *
+         * \param &value: The value of the surface adhesion traction.
          */
 
-        _dCurrentDistanceVectordNonLocalMicroDeformationBase.second = value;
+        _surfaceAdhesionTraction.second = value;
 
-        _dCurrentDistanceVectordNonLocalMicroDeformationBase.first = true;
+        _surfaceAdhesionTraction.first = true;
 
-        addInteractionPairData( &_dCurrentDistanceVectordNonLocalMicroDeformationBase );
+        addInteractionPairData( &_surfaceAdhesionTraction );
+
+        return;
 
     }
 
-    const floatMatrix *aspBase::getdCurrentDistanceVectordNonLocalMicroDeformationBase( ){
+    const floatVector* aspBase::getSurfaceAdhesionTraction( ){
         /*!
-         * Get the derivative of the current distance vector w.r.t. the non-local micro-deformation.
+         * Get the surface adhesion traction
          */
 
-        if ( !_dCurrentDistanceVectordNonLocalMicroDeformationBase.first ){
+        if ( !_surfaceAdhesionTraction.first ){
 
-            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )
+            ASP_INSTRUMENT_STAGE( ADHESION_TRACTION );
+
+            ERROR_TOOLS_CATCH( setSurfaceAdhesionTraction( ) );
 
         }
 
-        return &_dCurrentDistanceVectordNonLocalMicroDeformationBase.second;
+        return &_surfaceAdhesionTraction.second;
 
     }
 
-    void aspBase::setdCurrentDistanceVectordGradientMicroDeformation( ){
+    void aspBase::computeSurfaceAdhesionTraction( floatVector &surfaceAdhesionTraction ){
         /*!
-         * set the derivative of the current distance vector w.r.t. the reference
-         * spatial gradient of the micro-deformation.
+         * Compute the surface adhesion traction
+         * 
+         * \param &surfaceAdhesionTraction: The current adhesion traction between the local and non-local particles
          */
 
-        ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+        const floatVector* currentDistanceVector;
+        ERROR_TOOLS_CATCH( currentDistanceVector = getCurrentDistanceVector( ) );
+
+        const floatVector* localCurrentNormal;
+        ERROR_TOOLS_CATCH( localCurrentNormal = getLocalCurrentNormal( ) );
+
+        const floatVector* surfaceParameters;
+        ERROR_TOOLS_CATCH( surfaceParameters = getSurfaceParameters( ) );
+
+        // Decompose the traction into normal and tangential directions
+        floatVector dn, dt;
+        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::decomposeVector( *currentDistanceVector, *localCurrentNormal, dn, dt ) );
+
+        ERROR_TOOLS_CATCH( tractionSeparation::computeLinearTraction( dn, dt, *surfaceParameters, surfaceAdhesionTraction ) );
+
+        return;
 
     }
 
-    void aspBase::setdCurrentDistanceVectordGradientMicroDeformation( const floatMatrix &value ){
+    void aspBase::setSurfaceAdhesionThickness( ){
         /*!
-         * set the derivative of the current distance vector w.r.t. the reference
-         * spatial gradient of the micro-deformation.
-         * 
-         * \param &value:
+         * Set the current thickness of the surface adhesion
          */
 
-        _dCurrentDistanceVectordGradientMicroDeformation.second = value;
+        const floatVector* currentDistanceVector;
+        ERROR_TOOLS_CATCH( currentDistanceVector = getCurrentDistanceVector( ) );
 
-        _dCurrentDistanceVectordGradientMicroDeformation.first = true;
+        const floatVector* localCurrentNormal;
+        ERROR_TOOLS_CATCH( localCurrentNormal = getLocalCurrentNormal( ) );
+        
+        // Decompose the distance into normal and tangential directions
+        floatVector dn, dt;
+        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::decomposeVector( *currentDistanceVector, *localCurrentNormal, dn, dt ) );
 
-        addInteractionPairData( &_dCurrentDistanceVectordGradientMicroDeformation );
+        setSurfaceAdhesionThickness( tardigradeVectorTools::l2norm( dn ) );
 
     }
 
-    const floatMatrix *aspBase::getdCurrentDistanceVectordGradientMicroDeformation( ){
+    void aspBase::setSurfaceAdhesionThickness( const floatType &value ){
         /*!
-         * Get the derivative of the current distance vector w.r.t. the gradient of the micro-deformation.
+         * Set the current thickness of the surface adhesion
+         * 
+         * \param &value: The thickness associated with the surface adhesion
          */
 
-        if ( !_dCurrentDistanceVectordGradientMicroDeformation.first ){
-
-            ERROR_TOOLS_CATCH( setdCurrentDistanceVectordGradientMicroDeformation( ) )
+        _surfaceAdhesionThickness.second = value;
 
-        }
+        _surfaceAdhesionThickness.first = true;
 
-        return &_dCurrentDistanceVectordGradientMicroDeformation.second;
+        addInteractionPairData( &_surfaceAdhesionThickness );
 
     }
 
-    const floatVector* aspBase::getCurrentDistanceVector( ){
+    const floatType* aspBase::getSurfaceAdhesionThickness( ){
         /*!
-         * Get the current distance vector
+         * Get the current value of the surface adhesion thickness
          */
 
-        if ( !_currentDistanceVector.first ){
+        if ( !_surfaceAdhesionThickness.first ){
 
-            ERROR_TOOLS_CATCH( setCurrentDistanceVector( ) );
+            ERROR_TOOLS_CATCH( setSurfaceAdhesionThickness( ) );
 
         }
 
-        return &_currentDistanceVector.second;
+        return &_surfaceAdhesionThickness.second;
 
     }
 
-    void aspBase::setLocalCurrentNormal( ){
+    void aspBase::setSurfaceOverlapThickness( ){
         /*!
-         * Set the current local normal
+         * Set the current thickness of the surface overlap
          */
 
-        const floatVector* localReferenceNormal;
-        ERROR_TOOLS_CATCH( localReferenceNormal = getLocalReferenceNormal( ) );
-
-        const floatVector* localMicroDeformation;
-        ERROR_TOOLS_CATCH( localMicroDeformation = getLocalMicroDeformation( ) );
-
-        floatVector dan, localCurrentNormal;
-
-        floatMatrix ddandChi, ddandN;
-
-        ERROR_TOOLS_CATCH( tractionSeparation::computeNansonsRelation( *localMicroDeformation, *localReferenceNormal,
-                                                                       dan, ddandChi, ddandN ) );
-
-        floatType da = tardigradeVectorTools::l2norm( dan );
+        const mapFloatVector* particlePairOverlap;
+        ERROR_TOOLS_CATCH( particlePairOverlap = getParticlePairOverlap( ) );
 
-        localCurrentNormal = dan / da;
+        mapFloatType surfaceOverlapThickness;
 
-        floatMatrix dndChi = ddandChi / da - tardigradeVectorTools::dyadic( dan, tardigradeVectorTools::Tdot( ddandChi, localCurrentNormal ) ) / ( da * da );
+        surfaceOverlapThickness.reserve( particlePairOverlap->size( ) );
 
-        floatMatrix dndN = ddandN / da - tardigradeVectorTools::dyadic( dan, tardigradeVectorTools::Tdot( ddandN, localCurrentNormal ) ) / ( da * da );
+        for ( auto overlap = particlePairOverlap->begin( ); overlap != particlePairOverlap->end( ); overlap++ ){
 
-        setLocalCurrentNormal( localCurrentNormal );
+            floatVector normal;
 
-        setdLocalCurrentNormaldLocalMicroDeformation( dndChi );
+            ERROR_TOOLS_CATCH( getLocalCurrentNormal( overlap->first, normal ) );
+        
+            surfaceOverlapThickness.insert( { overlap->first, std::fabs( tardigradeVectorTools::dot( overlap->second, normal ) ) } );
 
-        setdLocalCurrentNormaldLocalReferenceNormal( dndN );
+        }
 
-        return;
+        setSurfaceOverlapThickness( surfaceOverlapThickness );
 
     }
 
-    void aspBase::setLocalCurrentNormal( const floatVector &value ){
+    void aspBase::setSurfaceOverlapThickness( const mapFloatType &value ){
         /*!
-         * Set the current local normal
+         * Set the current thickness of the surface overlap
          * 
-         * \param &value: The value of the local current normal
+         * \param &value: The map from local surface node indices to the overlap thickness
          */
 
-        _localCurrentNormal.second = value;
-
-        _localCurrentNormal.first = true;
+        _surfaceOverlapThickness.second = value;
 
-        addSurfacePointData( &_localCurrentNormal );
+        _surfaceOverlapThickness.first = true;
 
-        return;
+        addInteractionPairData( &_surfaceOverlapThickness );
 
     }
 
-    const floatVector* aspBase::getLocalCurrentNormal( ){
+    const mapFloatType* aspBase::getSurfaceOverlapThickness( ){
         /*!
-         * Get the local current normal vector
+         * Get the current value of the surface overlap thickness
          */
 
-        if ( !_localCurrentNormal.first ){
+        if ( !_surfaceOverlapThickness.first ){
 
-            ERROR_TOOLS_CATCH( setLocalCurrentNormal( ) );
+            ERROR_TOOLS_CATCH( setSurfaceOverlapThickness( ) );
 
         }
 
-        return &_localCurrentNormal.second;
+        return &_surfaceOverlapThickness.second;
 
     }
 
-    void aspBase::setdLocalCurrentNormaldLocalReferenceNormal( ){
+    const std::vector< std::vector< floatVector > >* aspBase::getAssembledSurfaceAdhesionThicknesses( ){
         /*!
-         * Set the derivative of the local current normal vector w.r.t. the local reference normal
+         * Get the current value of the surface adhesion thicknesses
+         * 
+         * The dense form is expanded from the sparse form the first time it is requested
          */
 
-        ERROR_TOOLS_CATCH( setLocalCurrentNormal( ) );
+        if ( !_assembledSurfaceAdhesionThicknesses.first ){
 
-    }
+            const sparseSurfaceResponse *sparse;
+            ERROR_TOOLS_CATCH( sparse = getAssembledSparseSurfaceAdhesionThicknesses( ) );
 
-    void aspBase::setdLocalCurrentNormaldLocalReferenceNormal( const floatMatrix &value ){
-        /*!
-         * Set the derivative of the local current normal vector w.r.t. the local reference normal
-         * 
-         * \param &value: The gradient of the local current normal w.r.t. the reference current normal
-         */
+            sparse->toDense( _assembledSurfaceAdhesionThicknesses.second );
 
-        _dLocalCurrentNormaldLocalReferenceNormal.second = value;
+            _assembledSurfaceAdhesionThicknesses.first = true;
 
-        _dLocalCurrentNormaldLocalReferenceNormal.first = true;
+            addAssembledData( &_assembledSurfaceAdhesionThicknesses );
 
-        addSurfacePointData( &_dLocalCurrentNormaldLocalReferenceNormal );
+        }
+
+        return &_assembledSurfaceAdhesionThicknesses.second;
 
     }
 
-    const floatMatrix* aspBase::getdLocalCurrentNormaldLocalReferenceNormal( ){
+    const std::vector< std::vector< floatVector > >* aspBase::getAssembledSurfaceAdhesionEnergyDensities( ){
         /*!
-         * Get the derivative of the local current normal w.r.t. the local reference normal
+         * Get the current value of the surface adhesion energy densities
+         * 
+         * The dense form is expanded from the sparse form the first time it is requested
          */
 
-        if ( !_dLocalCurrentNormaldLocalReferenceNormal.first ){
+        if ( !_assembledSurfaceAdhesionEnergyDensities.first ){
 
-            ERROR_TOOLS_CATCH( setdLocalCurrentNormaldLocalReferenceNormal( ) );
+            const sparseSurfaceResponse *sparse;
+            ERROR_TOOLS_CATCH( sparse = getAssembledSparseSurfaceAdhesionEnergyDensities( ) );
 
-        }
+            sparse->toDense( _assembledSurfaceAdhesionEnergyDensities.second );
 
-        return &_dLocalCurrentNormaldLocalReferenceNormal.second;
+            _assembledSurfaceAdhesionEnergyDensities.first = true;
 
-    }
+            addAssembledData( &_assembledSurfaceAdhesionEnergyDensities );
 
-    void aspBase::setdLocalCurrentNormaldLocalMicroDeformation( ){
-        /*!
-         * Set the derivative of the local current normal vector w.r.t. the local micro-deformation
-         */
+        }
 
-        ERROR_TOOLS_CATCH( setLocalCurrentNormal( ) );
+        return &_assembledSurfaceAdhesionEnergyDensities.second;
 
     }
 
-    void aspBase::setdLocalCurrentNormaldLocalMicroDeformation( const floatMatrix &value ){
+    const std::vector< std::vector< floatMatrix > >* aspBase::getAssembledSurfaceAdhesionTractions( ){
         /*!
-         * Set the derivative of the local current normal vector w.r.t. the local micro-deformation
+         * Get the current value of the surface adhesion thicknesses
          * 
-         * \param &value: The gradient of the local current normal w.r.t. the local micro-deformation
+         * The dense form is expanded from the sparse form the first time it is requested
          */
 
-        _dLocalCurrentNormaldLocalMicroDeformation.second = value;
-
-        _dLocalCurrentNormaldLocalMicroDeformation.first = true;
-
-        addSurfacePointData( &_dLocalCurrentNormaldLocalMicroDeformation );
+        if ( !_assembledSurfaceAdhesionTractions.first ){
 
-    }
+            const sparseSurfaceResponse *sparse;
+            ERROR_TOOLS_CATCH( sparse = getAssembledSparseSurfaceAdhesionTractions( ) );
 
-    const floatMatrix* aspBase::getdLocalCurrentNormaldLocalMicroDeformation( ){
-        /*!
-         * Get the derivative of the local current normal w.r.t. the local micro-deformation
-         */
+            sparse->toDense( _assembledSurfaceAdhesionTractions.second );
 
-        if ( !_dLocalCurrentNormaldLocalMicroDeformation.first ){
+            _assembledSurfaceAdhesionTractions.first = true;
 
-            ERROR_TOOLS_CATCH( setdLocalCurrentNormaldLocalMicroDeformation( ) );
+            addAssembledData( &_assembledSurfaceAdhesionTractions );
 
         }
 
-        return &_dLocalCurrentNormaldLocalMicroDeformation.second;
+        return &_assembledSurfaceAdhesionTractions.second;
 
     }
 
-    void aspBase::getLocalReferenceNormal( const unsigned int &index, floatVector &localReferenceNormal ){
+    const std::vector< std::vector< std::vector< mapFloatType > > >* aspBase::getAssembledSurfaceOverlapThicknesses( ){
         /*!
-         * compute the local reference normal at the referenced surface point index
+         * Get the current value of the surface overlap thicknesses
          * 
-         * \param &index: The index of the local surface point
-         * \param &localReferenceNormal: The resulting local reference normal vector
+         * The dense form is expanded from the sparse form the first time it is requested
          */
 
-        const unsigned int *dim = getDimension( );
+        if ( !_assembledSurfaceOverlapThicknesses.first ){
 
-        const floatVector* unitSpherePoints;
-        ERROR_TOOLS_CATCH( unitSpherePoints = getUnitSpherePoints( ) );
+            const sparseSurfaceResponse *sparse;
+            ERROR_TOOLS_CATCH( sparse = getAssembledSparseSurfaceOverlapThicknesses( ) );
 
-        if ( ( *dim ) * ( index + 1 ) > unitSpherePoints->size( ) ){
+            sparse->toDense( _assembledSurfaceOverlapThicknesses.second );
 
-            std::string message = "The requested index is greater than the number of points available on the unit sphere.\n";
-            message            += "  index:            " + std::to_string( index ) + "\n";
-            message            += "  number of points: " + std::to_string( unitSpherePoints->size( ) / ( *dim ) );
+            _assembledSurfaceOverlapThicknesses.first = true;
 
-            ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+            addAssembledData( &_assembledSurfaceOverlapThicknesses );
 
         }
 
-        localReferenceNormal = floatVector( unitSpherePoints->begin( ) + ( *dim ) * index,
-                                            unitSpherePoints->begin( ) + ( *dim ) * ( index + 1 ) );
-
-        localReferenceNormal /= tardigradeVectorTools::l2norm( localReferenceNormal );
-
-        return;
+        return &_assembledSurfaceOverlapThicknesses.second;
 
     }
 
-    void aspBase::getLocalCurrentNormal( const unsigned int &index, floatVector &normal ){
+    const std::vector< std::vector< std::vector< mapFloatType > > >* aspBase::getAssembledSurfaceOverlapEnergyDensities( ){
         /*!
-         * compute the local current normal at the referenced surface point index
+         * Get the current value of the surface overlap energy densities
          * 
-         * \param &index: The index of the local surface point
-         * \param &normal: The resulting normal vector
+         * The dense form is expanded from the sparse form the first time it is requested
          */
 
-        floatVector referenceNormal;
-        ERROR_TOOLS_CATCH( getLocalReferenceNormal( index, referenceNormal ) );
-
-        const floatVector* localMicroDeformation;
-        ERROR_TOOLS_CATCH( localMicroDeformation = getLocalMicroDeformation( ) );
+        if ( !_assembledSurfaceOverlapEnergyDensities.first ){
 
-        ERROR_TOOLS_CATCH( tractionSeparation::computeNansonsRelation( *localMicroDeformation, referenceNormal,
-                                                                       normal ) );
+            const sparseSurfaceResponse *sparse;
+            ERROR_TOOLS_CATCH( sparse = getAssembledSparseSurfaceOverlapEnergyDensities( ) );
 
-        normal /= tardigradeVectorTools::l2norm( normal );
+            sparse->toDense( _assembledSurfaceOverlapEnergyDensities.second );
 
-        return;
+            _assembledSurfaceOverlapEnergyDensities.first = true;
 
-    }
+            addAssembledData( &_assembledSurfaceOverlapEnergyDensities );
 
-    void aspBase::setSurfaceParameters( ){
-        /*!
-         * Set the surface parameters for the integrand
-         */
+        }
 
-        setSurfaceParameters( floatVector( 0, 0 ) );        
+        return &_assembledSurfaceOverlapEnergyDensities.second;
 
-        return;
     }
 
-    void aspBase::setSurfaceParameters( const floatVector &value ){
+    const std::vector< std::vector< std::vector< mapFloatVector > > >* aspBase::getAssembledSurfaceOverlapTractions( ){
         /*!
-         * Set the surface parameters for the integrand
+         * Get the current value of the surface overlap thicknesses
          * 
-         * \param &value: The values of the surface parameters
+         * The dense form is expanded from the sparse form the first time it is requested
          */
 
-        _surfaceParameters.second = value;
+        if ( !_assembledSurfaceOverlapTractions.first ){
 
-        _surfaceParameters.first = true;
+            const sparseSurfaceResponse *sparse;
+            ERROR_TOOLS_CATCH( sparse = getAssembledSparseSurfaceOverlapTractions( ) );
 
-        addInteractionPairData( &_surfaceParameters );
+            sparse->toDense( _assembledSurfaceOverlapTractions.second );
+
+            _assembledSurfaceOverlapTractions.first = true;
+
+            addAssembledData( &_assembledSurfaceOverlapTractions );
+
+        }
+
+        return &_assembledSurfaceOverlapTractions.second;
 
-        return;
     }
 
-    const floatVector* aspBase::getSurfaceParameters( ){
+    const sparseSurfaceResponse* aspBase::getAssembledSparseSurfaceAdhesionThicknesses( ){
         /*!
-         * Get the surface parameters
+         * Get the compressed form of the assembled surface adhesion thicknesses
          */
 
-        if ( !_surfaceParameters.first ){
+        if ( !_assembledSparseSurfaceAdhesionThicknesses.first ){
 
-            ERROR_TOOLS_CATCH( setSurfaceParameters( ) );
+            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
 
         }
 
-        return &_surfaceParameters.second;
+        return &_assembledSparseSurfaceAdhesionThicknesses.second;
 
     }
 
-    void aspBase::setReferenceDistanceVector( ){
+    const sparseSurfaceResponse* aspBase::getAssembledSparseSurfaceAdhesionEnergyDensities( ){
         /*!
-         * Set the initial distance between two particles
+         * Get the compressed form of the assembled surface adhesion energy densities
          */
 
+        if ( !_assembledSparseSurfaceAdhesionEnergyDensities.first ){
 
-        setReferenceDistanceVector( floatVector( *getDimension( ), 0. ) );
+            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
 
-        return;
+        }
+
+        return &_assembledSparseSurfaceAdhesionEnergyDensities.second;
 
     }
 
-    void aspBase::setReferenceDistanceVector( const floatVector &value ){
+    const sparseSurfaceResponse* aspBase::getAssembledSparseSurfaceAdhesionTractions( ){
         /*!
-         * Set the initial distance between two particles
-         * 
-         * \param &value: The value of the reference distance vector
+         * Get the compressed form of the assembled surface adhesion tractions
          */
 
-        _referenceDistanceVector.second = value;
+        if ( !_assembledSparseSurfaceAdhesionTractions.first ){
 
-        _referenceDistanceVector.first = true;
+            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
 
-        addInteractionPairData( &_referenceDistanceVector );
+        }
 
-        return;
+        return &_assembledSparseSurfaceAdhesionTractions.second;
 
     }
 
-    const floatVector* aspBase::getReferenceDistanceVector( ){
+    const sparseSurfaceResponse* aspBase::getAssembledSparseSurfaceOverlapThicknesses( ){
         /*!
-         * Get the initial distance between two particles
+         * Get the compressed form of the assembled surface overlap thicknesses
          */
 
-        if ( !_referenceDistanceVector.first ){
+        if ( !_assembledSparseSurfaceOverlapThicknesses.first ){
 
-            ERROR_TOOLS_CATCH( setReferenceDistanceVector( ) );
+            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
 
         }
 
-        return &_referenceDistanceVector.second;
+        return &_assembledSparseSurfaceOverlapThicknesses.second;
 
     }
 
-    void aspBase::resetInteractionPairData( ){
+    const sparseSurfaceResponse* aspBase::getAssembledSparseSurfaceOverlapEnergyDensities( ){
         /*!
-         * Reset the interaction pair data to the base state
+         * Get the compressed form of the assembled surface overlap energy densities
          */
 
-        for ( auto d = _interactionPairData.begin( ); d != _interactionPairData.end( ); d++ ){
+        if ( !_assembledSparseSurfaceOverlapEnergyDensities.first ){
 
-            ( *d )->clear( );
+            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
 
         }
 
-        _interactionPairData.clear( );
-
-        return;
+        return &_assembledSparseSurfaceOverlapEnergyDensities.second;
 
     }
 
-    void aspBase::resetSurfacePointData( ){
+    const sparseSurfaceResponse* aspBase::getAssembledSparseSurfaceOverlapTractions( ){
         /*!
-         * Reset the surface point data to the base state
+         * Get the compressed form of the assembled surface overlap tractions
          */
 
-        // Reset the interaction pair
-        resetInteractionPairData( );
-
-        for ( auto d = _surfacePointData.begin( ); d != _surfacePointData.end( ); d++ ){
+        if ( !_assembledSparseSurfaceOverlapTractions.first ){
 
-            ( *d )->clear( );
+            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
 
         }
 
-        _surfacePointData.clear( );
-
-        return;
+        return &_assembledSparseSurfaceOverlapTractions.second;
 
     }
 
-    void aspBase::resetLocalParticleData( ){
+    void aspBase::computeSurfaceOverlapTraction( mapFloatVector &surfaceOverlapTraction ){
         /*!
-         * Reset the local particle data to the base state
+         * Compute the surface overlap traction
+         * 
+         * \param &surfaceOverlapTraction: An unordered map mapping from points on the local particle to the amount they overlap the non-local particle
          */
 
-        resetSurfacePointData( );
+        surfaceOverlapTraction.clear( );
 
-        for ( auto d = _localParticleData.begin( ); d != _localParticleData.end( ); d++ ){
+        const mapFloatVector *particlePairOverlap;
+        ERROR_TOOLS_CATCH( particlePairOverlap = getParticlePairOverlap( ) );
 
-            ( *d )->clear( );
+        const floatVector *overlapParameters;
+        ERROR_TOOLS_CATCH( overlapParameters = getSurfaceOverlapParameters( ) );
 
-        }
+        surfaceOverlapTraction.reserve( particlePairOverlap->size( ) );
 
-        _localParticleData.clear( );
+        for ( auto overlap = particlePairOverlap->begin( ); overlap != particlePairOverlap->end( ); overlap++ ){
+
+            surfaceOverlapTraction.insert( { overlap->first, ( *overlapParameters )[ 0 ] * overlap->second } );
+
+        }
 
         return;
 
     }
 
-    void aspBase::computeSurfaceAdhesionEnergyDensity( floatType &surfaceAdhesionEnergyDensity ){
+    void aspBase::setSurfaceOverlapTraction( ){
         /*!
-         * Compute the surface adhesion energy density in the current configuration ( energy / da )
-         * 
-         * \param &surfaceAdhesionEnergyDensity: The surface adhesion energy density i.e., the energy bonding the local and non-local particles together
+         * Set the surface overlap traction
          */
 
-        const floatVector* currentDistanceVector;
-        ERROR_TOOLS_CATCH( currentDistanceVector = getCurrentDistanceVector( ) );
-
-        const floatVector* localCurrentNormal;
-        ERROR_TOOLS_CATCH( localCurrentNormal = getLocalCurrentNormal( ) );
-
-        const floatVector* surfaceParameters;
-        ERROR_TOOLS_CATCH( surfaceParameters = getSurfaceParameters( ) );
-
-        // Decompose the traction into normal and tangential directions
-        floatVector dn, dt;
-        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::decomposeVector( *currentDistanceVector, *localCurrentNormal, dn, dt ) );
+        mapFloatVector surfaceOverlapTraction;
 
-        floatType energyDensity;
-        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::computeLinearTractionEnergy( dn, dt, *surfaceParameters, energyDensity ) );
+        ERROR_TOOLS_CATCH( computeSurfaceOverlapTraction( surfaceOverlapTraction ) );
 
-        surfaceAdhesionEnergyDensity = 0.5 * energyDensity * tardigradeVectorTools::l2norm( dn );
+        setSurfaceOverlapTraction( surfaceOverlapTraction );
 
         return;
 
     }
 
-    void aspBase::computeSurfaceAdhesionEnergyDensity( floatType &surfaceAdhesionEnergyDensity,
-                                                       floatVector &dSurfaceAdhesionEnergyDensitydLocalDeformationGradient,
-                                                       floatVector &dSurfaceAdhesionEnergyDensitydLocalMicroDeformation,
-                                                       floatVector &dSurfaceAdhesionEnergyDensitydGradientMicroDeformation ){
+    void aspBase::setSurfaceOverlapTraction( const mapFloatVector &value ){
         /*!
-         * Compute the surface adhesion energy density in the current configuration ( energy / da )
-         * \param &surfaceAdhesionEnergyDensity: The surface adhesion energy density i.e., the energy bonding the local and non-local particles together
-         * \param &dSurfaceAdhesionEnergyDensitydLocalDeformationGradient: The gradient of the surface adhesion energy density w.r.t. the
-         *     local deformation gradient
-         * \param &dSurfaceAdhesionEnergyDensitydLocalMicroDeformation: The gradient of the surface adhesion energy density w.r.t. the
-         *     local micro-deformation
-         * \param &dSurfaceAdhesionEnergyDensitydGradientMicroDeformation: The gradient of the surface adhesion energy density w.r.t. the
-         *     gradient of the micro-deformation.
+         * Set the surface overlap traction
+         * 
+         * \param &value: The map from the local node indices to the overlap traction vectors
          */
 
-        const floatVector* currentDistanceVector;
-        ERROR_TOOLS_CATCH( currentDistanceVector = getCurrentDistanceVector( ) );
+        _surfaceOverlapTraction.second = value;
 
-        const floatVector* localCurrentNormal;
-        ERROR_TOOLS_CATCH( localCurrentNormal = getLocalCurrentNormal( ) );
+        _surfaceOverlapTraction.first = true;
 
-        const floatVector* surfaceParameters;
-        ERROR_TOOLS_CATCH( surfaceParameters = getSurfaceParameters( ) );
+        addInteractionPairData( &_surfaceOverlapTraction );
 
-        // Decompose the traction into normal and tangential directions
-        floatVector dn, dt;
-        floatMatrix ddndd, ddndn, ddtdd, ddtdn;
-        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::decomposeVector( *currentDistanceVector, *localCurrentNormal, dn, dt,
-                                                                             ddndd, ddndn, ddtdd, ddtdn ) );
+        return;
 
-        floatMatrix ddndF = tardigradeVectorTools::dot( ddndd, *getdCurrentDistanceVectordLocalDeformationGradient( ) );
+    }
 
-        floatMatrix ddndChi = tardigradeVectorTools::dot( ddndd, *getdCurrentDistanceVectordLocalMicroDeformation( ) )
-                            + tardigradeVectorTools::dot( ddndn, *getdLocalCurrentNormaldLocalMicroDeformation( ) );
+    const mapFloatVector* aspBase::getSurfaceOverlapTraction( ){
+        /*!
+         * Get the surface overlap traction
+         */
 
-        floatMatrix ddndGradChi = tardigradeVectorTools::dot( ddndd, *getdCurrentDistanceVectordGradientMicroDeformation( ) );
+        if ( !_surfaceOverlapTraction.first ){
 
-        floatMatrix ddtdF = tardigradeVectorTools::dot( ddtdd, *getdCurrentDistanceVectordLocalDeformationGradient( ) );
+            ERROR_TOOLS_CATCH( setSurfaceOverlapTraction( ) );
 
-        floatMatrix ddtdChi = tardigradeVectorTools::dot( ddtdd, *getdCurrentDistanceVectordLocalMicroDeformation( ) )
-                            + tardigradeVectorTools::dot( ddtdn, *getdLocalCurrentNormaldLocalMicroDeformation( ) );
+        }
 
-        floatMatrix ddtdGradChi = tardigradeVectorTools::dot( ddtdd, *getdCurrentDistanceVectordGradientMicroDeformation( ) );
+        return &_surfaceOverlapTraction.second;
 
-        floatType energyDensity;
-        floatVector deddn, deddt;
-        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::computeLinearTractionEnergy( dn, dt, *surfaceParameters, energyDensity,
-                                                                                         deddn, deddt ) );
+    }
 
-        floatVector dedF = tardigradeVectorTools::Tdot( ddndF, deddn )
-                         + tardigradeVectorTools::Tdot( ddtdF, deddt );
+    const floatMatrix* aspBase::getNonLocalParticleCurrentBoundingBox( ){
+        /*!
+         * Get the local particle's bounding box
+         */
 
-        floatVector dedChi = tardigradeVectorTools::Tdot( ddndChi, deddn )
-                           + tardigradeVectorTools::Tdot( ddtdChi, deddt );
+        if ( !_nonLocalParticleCurrentBoundingBox.first ){
 
-        floatVector dedGradChi = tardigradeVectorTools::Tdot( ddndGradChi, deddn )
-                               + tardigradeVectorTools::Tdot( ddtdGradChi, deddt );
+            ERROR_TOOLS_CATCH( setNonLocalParticleCurrentBoundingBox( ) );
 
-        surfaceAdhesionEnergyDensity = 0.5 * energyDensity * tardigradeVectorTools::l2norm( dn );
+        }
 
-        floatType dsede = 0.5 * tardigradeVectorTools::l2norm( dn );
+        return &_nonLocalParticleCurrentBoundingBox.second;
 
-        floatVector dseddn = 0.5 * energyDensity * dn / ( tardigradeVectorTools::l2norm( dn ) + *getAbsoluteTolerance( ) );
+    }
 
-        dSurfaceAdhesionEnergyDensitydLocalDeformationGradient = dsede * dedF + tardigradeVectorTools::Tdot( ddndF, dseddn );
+    void aspBase::setUseNeighborSearch( const bool &value ){
+        /*!
+         * Set whether the neighbor lists are formed by the neighbor search. The neighbor search requires the reference
+         * positions of the local particles (see setLocalParticleReferencePositions).
+         * 
+         * \param &value: The flag for whether to use the neighbor search
+         */
 
-        dSurfaceAdhesionEnergyDensitydLocalMicroDeformation = dsede * dedChi + tardigradeVectorTools::Tdot( ddndChi, dseddn );
+        _useNeighborSearch = value;
 
-        dSurfaceAdhesionEnergyDensitydGradientMicroDeformation = dsede * dedGradChi + tardigradeVectorTools::Tdot( ddndGradChi, dseddn );
+        resetAssembledData( );
 
     }
 
-    bool aspBase::pointInBoundingBox( const floatVector &point, const floatMatrix &boundingBox ){
+    void aspBase::setNeighborSearchPadding( const floatType &value ){
         /*!
-         * Determine if the point is inside of the bounding box and return a boolean value
+         * Set the distance added to each side of the particle bounding boxes by the neighbor search. The padding should
+         * be at least the distance over which the surfaces of two particles interact.
          * 
-         * \param &point: The point in [x, y, z, ...] space. Must be of the same length of the bounding box
-         * \param &boundingBox: The bouning box in the form (point.size( ), 2 ) where for each dimension
-         *    the row is of the form (lower bound, upper bound)
+         * \param &value: The padding of the bounding boxes
          */
 
-        if ( point.size( ) != boundingBox.size( ) ){
+        if ( value < 0 ){
 
-            ERROR_TOOLS_CATCH( throw std::runtime_error( "point and boundingBox must be the same size.\n  point.size( ): " + std::to_string( point.size( ) ) + "\n  boundingBox.size( ): " + std::to_string( boundingBox.size( ) ) ) );
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "The neighbor search padding must be non-negative but is " + std::to_string( value ) ) );
 
         }
 
-        for ( unsigned int i = 0; i < point.size( ); i++ ){
-
-            if ( boundingBox[ i ].size( ) != 2 ){
-
-                ERROR_TOOLS_CATCH( throw std::runtime_error( "boundingBox row " + std::to_string( i ) + " has a length of " + std::to_string( boundingBox[ i ].size( ) ) + " and it should be of length 2" ) );
-
-            }
+        _neighborSearchPadding = value;
 
-            if ( ( point[ i ] < boundingBox[ i ][ 0 ] ) || ( point[ i ] > boundingBox[ i ][ 1 ] ) ){
+        resetAssembledData( );
 
-                return false;
+    }
 
-            }
+    void aspBase::setLocalParticleReferencePositions( const floatVector &value ){
+        /*!
+         * Set the reference positions of the centers of the local particles which are binned by the neighbor search. The
+         * positions must be consistent with the particle spacing i.e. \f$dX_I = X^{non-local} - X^{local}\f$ within the
+         * neighbor search padding.
+         * 
+         * \param &value: The reference positions stored particle by particle
+         */
 
-        }
+        _localParticleReferencePositions = value;
 
-        return true;
+        resetAssembledData( );
 
     }
 
-    void aspBase::idBoundingBoxContainedPoints( const floatVector &points, const floatMatrix &boundingBox, std::vector< unsigned int > &containedPoints ){
+    void aspBase::setLocalParticleNeighbors( ){
         /*!
-         * Determine which of the points are in the bounding box
+         * Set the lists of the particles which may interact with each of the local particles.
          * 
-         * \param &points: The points in [x1, y1, z1, x2, y2, z2, ... ] format.
-         * \param &boundingBox: The bounding box which must be in the form (_dimension, 2 ) where for each dimension
-         *    the row is of the form (lower bound, upper bound)
-         * \param &containedPoints: The points contained in the vector
+         * If the neighbor search is disabled every particle is a candidate for every other particle. Otherwise, the
+         * current bounding box of each local particle is placed at the current position of its center \f$F_{iI} X_I\f$,
+         * padded by _neighborSearchPadding, and the boxes are binned in a uniform grid (see formNeighborLists). The
+         * candidate pairs whose boxes overlap are then retained if the bounding box of the non-local particle, placed at
+         * one of the surface points of the local particle at the current spacing \f$F_{iI} dX_I\f$, overlaps the bounding
+         * box of the local particle where both boxes are padded by _neighborSearchPadding.
+         * 
+         * The search moves the local, surface node, and non-local indices and they are restored once the lists are formed.
          */
 
         const unsigned int *dim = getDimension( );
 
-        containedPoints = std::vector< unsigned int >( points.size( ) );
+        const unsigned int numLocalParticles = *getNumLocalParticles( );
 
-        unsigned int numContainedPoints = 0;
+        std::vector< std::vector< unsigned int > > localParticleNeighbors( numLocalParticles );
 
-        for ( unsigned int i = 0; i < points.size( ); i += ( *dim ) ){
+        if ( !_useNeighborSearch ){
 
-            if ( pointInBoundingBox( floatVector( points.begin( ) + i, points.begin( ) + i + ( *dim ) ), boundingBox ) ){
+            std::vector< unsigned int > allParticles( numLocalParticles );
 
-                containedPoints[ numContainedPoints ] = i / ( *dim );
+            for ( unsigned int i = 0; i < numLocalParticles; i++ ){
 
-                numContainedPoints++;
+                allParticles[ i ] = i;
 
             }
 
-        }
-
-        containedPoints.resize( numContainedPoints );
-
-        return;
-
-    }
-
-    void aspBase::computeSurfaceOverlapEnergyDensity( mapFloatType &surfaceOverlapEnergyDensity ){
-        /*!
-         * Compute the surface overlap energy density for the local particle and a given interaction
-         * 
-         * \param &surfaceOverlapEnergyDensity: The index is the index of the local points which may be overlapping with a neighboring particle and the values are the overlap energies. It is not a scalar because two particles could be overlapping at multiple points
-         */
-
-        surfaceOverlapEnergyDensity.clear( );
-
-        const mapFloatVector *particlePairOverlap;
-        ERROR_TOOLS_CATCH( particlePairOverlap = getParticlePairOverlap( ) );
+            localParticleNeighbors = std::vector< std::vector< unsigned int > >( numLocalParticles, allParticles );
 
-        const floatVector *overlapParameters;
-        ERROR_TOOLS_CATCH( overlapParameters = getSurfaceOverlapParameters( ) );
+            setLocalParticleNeighbors( localParticleNeighbors );
 
-        for ( auto overlap = particlePairOverlap->begin( ); overlap != particlePairOverlap->end( ); overlap++ ){
+            return;
 
-            floatVector normal;
+        }
 
-            getLocalCurrentNormal( overlap->first, normal );
+        if ( _localParticleReferencePositions.size( ) != numLocalParticles * ( *dim ) ){
 
-            surfaceOverlapEnergyDensity.insert( { overlap->first, 0.5 * ( *overlapParameters )[ 0 ] * tardigradeVectorTools::dot( overlap->second, overlap->second ) * std::fabs( tardigradeVectorTools::dot( overlap->second, normal ) ) } );
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "The neighbor search requires the reference positions of the local particles.\n  expected size: " + std::to_string( numLocalParticles * ( *dim ) ) + "\n  size: " + std::to_string( _localParticleReferencePositions.size( ) ) ) );
 
         }
 
-        return;
+        const unsigned int numSurfacePoints = getUnitSpherePoints( )->size( ) / ( *dim );
 
-    }
+        const unsigned int localIndex = _localIndex;
 
-    void aspBase::setParticlePairOverlap( ){
-        /*!
-         * Set the particle overlap for the current local to non-local pair
-         */
+        const unsigned int localSurfaceNodeIndex = _localSurfaceNodeIndex;
 
-        mapFloatVector particlePairOverlap;
+        const unsigned int nonLocalIndex = _nonLocalIndex;
 
-        const unsigned int *dim = getDimension( );
+        // Quantities formed for the current indices before the search would otherwise be used for the first particle
+        resetLocalParticleData( );
 
-        const floatMatrix *nonLocalBoundingBox;
-        ERROR_TOOLS_CATCH( nonLocalBoundingBox = getNonLocalParticleCurrentBoundingBox( ) );
+        auto padBoundingBox = [ & ]( floatMatrix &boundingBox ){
 
-        const floatVector *localReferenceSurfacePoints;
-        ERROR_TOOLS_CATCH( localReferenceSurfacePoints = getLocalReferenceSurfacePoints( ) );
+            for ( unsigned int a = 0; a < ( *dim ); a++ ){
 
-        const floatVector *localCurrentSurfacePoints;
-        ERROR_TOOLS_CATCH( localCurrentSurfacePoints = getLocalCurrentSurfacePoints( ) );
+                boundingBox[ a ][ 0 ] -= _neighborSearchPadding;
 
-        const floatVector *localDeformationGradient;
-        ERROR_TOOLS_CATCH( localDeformationGradient = getLocalDeformationGradient( ) );
+                boundingBox[ a ][ 1 ] += _neighborSearchPadding;
 
-        const floatType *nonLocalReferenceRadius;
-        ERROR_TOOLS_CATCH( nonLocalReferenceRadius = getNonLocalReferenceRadius( ) );
+            }
 
-        const floatVector *localMicroDeformation;
-        ERROR_TOOLS_CATCH( localMicroDeformation = getLocalMicroDeformation( ) );
+        };
 
-        const floatVector *localReferenceParticleSpacing;
-        ERROR_TOOLS_CATCH( localReferenceParticleSpacing = getLocalReferenceParticleSpacingVector( ) );
+        // Form the padded current bounding boxes of the local particles relative to their centers
+        std::vector< floatMatrix > localBoundingBoxes( numLocalParticles );
 
-        const floatVector *localGradientMicroDeformation;
-        ERROR_TOOLS_CATCH( localGradientMicroDeformation = getLocalGradientMicroDeformation( ) );
+        std::vector< floatVector > localDeformationGradients( numLocalParticles );
 
-        // Check which of the local points are contained in the non-local bounding box
-        std::vector< unsigned int > possiblePoints;
-        ERROR_TOOLS_CATCH( idBoundingBoxContainedPoints( *localCurrentSurfacePoints, *nonLocalBoundingBox, possiblePoints ) );
+        std::vector< floatMatrix > placedBoundingBoxes( numLocalParticles );
 
-        const floatVector *nonLocalMicroDeformationBase;
-        ERROR_TOOLS_CATCH( nonLocalMicroDeformationBase = getNonLocalMicroDeformationBase( ) );
+        for ( unsigned int i = 0; i < numLocalParticles; i++ ){
 
-        for ( auto p = possiblePoints.begin( ); p != possiblePoints.end( ); p++ ){
+            _localIndex = i; // Set the current local index
 
-            // Compute the overlap between the local and non-local particles
-            floatVector overlap;
+            ERROR_TOOLS_CATCH( localBoundingBoxes[ i ] = *getLocalParticleCurrentBoundingBox( ) );
 
-            ERROR_TOOLS_CATCH( tractionSeparation::computeParticleOverlap( floatVector( localReferenceSurfacePoints->begin( ) + ( *dim ) * ( *p ),
-                                                                                        localReferenceSurfacePoints->begin( ) + ( *dim ) * ( ( *p ) + 1 ) ),
-                                                                           *localReferenceParticleSpacing, *nonLocalReferenceRadius, *localDeformationGradient,
-                                                                           *localMicroDeformation, *nonLocalMicroDeformationBase, *localGradientMicroDeformation,
-                                                                           overlap ) );
+            ERROR_TOOLS_CATCH( localDeformationGradients[ i ] = *getLocalDeformationGradient( ) );
 
-            particlePairOverlap.insert( { *p, overlap } );
+            if ( ( localBoundingBoxes[ i ].size( ) != ( *dim ) ) || ( localDeformationGradients[ i ].size( ) != ( *dim ) * ( *dim ) ) ){
 
-        }
+                ERROR_TOOLS_CATCH( throw std::runtime_error( "The bounding box and deformation gradient of local particle " + std::to_string( i ) + " must have the spatial dimension.\n  bounding box rows: " + std::to_string( localBoundingBoxes[ i ].size( ) ) + "\n  deformation gradient size: " + std::to_string( localDeformationGradients[ i ].size( ) ) ) );
 
-        setParticlePairOverlap( particlePairOverlap );
+            }
 
-        return;
+            padBoundingBox( localBoundingBoxes[ i ] );
 
-    }
+            // Move the box to the current position of the center of the particle
+            placedBoundingBoxes[ i ] = localBoundingBoxes[ i ];
 
-    void aspBase::setParticlePairOverlap( const mapFloatVector &value ){
-        /*!
-         * Set the vector of the overlap of the current pariticle pair
-         * 
-         * \param &value: The vector defining the overlap of the two particles.
-         */
+            for ( unsigned int a = 0; a < ( *dim ); a++ ){
 
-        _particlePairOverlap.second = value;
+                floatType currentPosition = 0;
 
-        _particlePairOverlap.first = true;
+                for ( unsigned int A = 0; A < ( *dim ); A++ ){
 
-        addInteractionPairData( &_particlePairOverlap );
+                    currentPosition += localDeformationGradients[ i ][ ( *dim ) * a + A ] * _localParticleReferencePositions[ ( *dim ) * i + A ];
 
-    }
+                }
 
-    const mapFloatVector* aspBase::getParticlePairOverlap( ){
-        /*!
-         * Get an unordered map of the overlap distance between the current local to non-local particle pair
-         */
+                placedBoundingBoxes[ i ][ a ][ 0 ] += currentPosition;
 
-        if ( !_particlePairOverlap.first ){
+                placedBoundingBoxes[ i ][ a ][ 1 ] += currentPosition;
 
-            ERROR_TOOLS_CATCH( setParticlePairOverlap( ) );
+            }
+
+            resetLocalParticleData( );
 
         }
 
-        return &_particlePairOverlap.second;
+        std::vector< std::vector< unsigned int > > candidates;
 
-    }
+        ERROR_TOOLS_CATCH( formNeighborLists( placedBoundingBoxes, candidates ) );
 
-    const floatType* aspBase::getSurfaceAdhesionEnergyDensity( ){
-        /*!
-         * Get the surface adhesion energy density
-         */
+        // Test the candidate pairs at the surface points of the local particle
+        floatMatrix placedNonLocalBoundingBox;
 
-        if ( !_surfaceAdhesionEnergyDensity.first ){
+        for ( unsigned int i = 0; i < numLocalParticles; i++ ){
 
-            ERROR_TOOLS_CATCH( setSurfaceAdhesionEnergyDensity( ) );
+            _localIndex = i; // Set the current local index
 
-        }
+            const floatVector &localDeformationGradient = localDeformationGradients[ i ];
 
-        return &_surfaceAdhesionEnergyDensity.second;
+            for ( auto k = candidates[ i ].begin( ); k != candidates[ i ].end( ); k++ ){
 
-    }
+                _nonLocalIndex = *k; // Set the interaction index
 
-    const mapFloatType* aspBase::getSurfaceOverlapEnergyDensity( ){
-        /*!
-         * Get the surface overlap energy density
-         */
+                bool isNeighbor = false;
 
-        if ( !_surfaceOverlapEnergyDensity.first ){
+                for ( unsigned int j = 0; ( j < numSurfacePoints ) && !isNeighbor; j++ ){
 
-            ERROR_TOOLS_CATCH( setSurfaceOverlapEnergyDensity( ) );
+                    _localSurfaceNodeIndex = j; // Set the local surface node index
 
-        }
+                    const floatVector *localReferenceParticleSpacing;
+                    ERROR_TOOLS_CATCH( localReferenceParticleSpacing = getLocalReferenceParticleSpacingVector( ) );
 
-        return &_surfaceOverlapEnergyDensity.second;
+                    // The non-local micro deformation and so the non-local bounding box depend on the spacing at the surface point
+                    const floatMatrix *nonLocalParticleCurrentBoundingBox;
+                    ERROR_TOOLS_CATCH( nonLocalParticleCurrentBoundingBox = getNonLocalParticleCurrentBoundingBox( ) );
 
-    }
+                    if ( ( localReferenceParticleSpacing->size( ) != ( *dim ) ) || ( nonLocalParticleCurrentBoundingBox->size( ) != ( *dim ) ) ){
 
-    const floatVector *aspBase::getGradientMicroDeformation( ){
-        /*!
-         * Get the gradient of the micro-deformation
-         */
+                        ERROR_TOOLS_CATCH( throw std::runtime_error( "The particle spacing and non-local bounding box must have the spatial dimension.\n  particle spacing size: " + std::to_string( localReferenceParticleSpacing->size( ) ) + "\n  bounding box rows: " + std::to_string( nonLocalParticleCurrentBoundingBox->size( ) ) ) );
 
-        return &_gradientMicroDeformation;
+                    }
 
-    }
+                    // Move the non-local bounding box to the current position of the non-local particle
+                    placedNonLocalBoundingBox = *nonLocalParticleCurrentBoundingBox;
 
-    const floatVector *aspBase::getMicroDeformation( ){
-        /*!
-         * Get the gradient of the micro-deformation
-         */
+                    for ( unsigned int a = 0; a < ( *dim ); a++ ){
 
-        return &_microDeformation;
+                        floatType currentSpacing = 0;
 
-    }
+                        for ( unsigned int A = 0; A < ( *dim ); A++ ){
 
-    void aspBase::setLocalGradientMicroDeformation( ){
-        /*!
-         * Set the local gradient of the micro-deformation
-         */
+                            currentSpacing += localDeformationGradient[ ( *dim ) * a + A ] * ( *localReferenceParticleSpacing )[ A ];
 
-        const floatVector *gradientMicroDeformation;
-        ERROR_TOOLS_CATCH( gradientMicroDeformation = getGradientMicroDeformation( ) );
+                        }
 
-        setLocalGradientMicroDeformation( *gradientMicroDeformation );
+                        placedNonLocalBoundingBox[ a ][ 0 ] += currentSpacing;
 
-    }
+                        placedNonLocalBoundingBox[ a ][ 1 ] += currentSpacing;
 
-    void aspBase::setLocalGradientMicroDeformation( const floatVector &value ){
-        /*!
-         * Set the local gradient of the micro-deformation
-         * 
-         * \param &value: The current value of the local gradient of the micro deformation
-         */
+                    }
 
-        _localGradientMicroDeformation.second = value;
+                    padBoundingBox( placedNonLocalBoundingBox );
 
-        _localGradientMicroDeformation.first = true;
+                    ERROR_TOOLS_CATCH( isNeighbor = boundingBoxesOverlap( localBoundingBoxes[ i ], placedNonLocalBoundingBox ) );
 
-        addLocalParticleData( &_localGradientMicroDeformation );
+                    resetSurfacePointData( );
 
-    }
+                }
 
-    const floatVector *aspBase::getLocalGradientMicroDeformation( ){
-        /*!
-         * Get the local gradient of the micro-deformation
-         */
+                if ( isNeighbor ){
 
-        if ( !_localGradientMicroDeformation.first ){
+                    localParticleNeighbors[ i ].push_back( *k );
 
-            ERROR_TOOLS_CATCH( setLocalGradientMicroDeformation( ) );
+                }
 
-        }
+            }
 
-        return &_localGradientMicroDeformation.second;
+            resetLocalParticleData( );
 
-    }
+        }
 
-    void aspBase::setSurfaceAdhesionEnergyDensity( ){
-        /*!
-         * Set the surface adhesion energy density if required.
-         */
+        _localIndex = localIndex;
 
-        floatType surfaceAdhesionEnergyDensity;
+        _localSurfaceNodeIndex = localSurfaceNodeIndex;
 
-        ERROR_TOOLS_CATCH( computeSurfaceAdhesionEnergyDensity( surfaceAdhesionEnergyDensity ) );
+        _nonLocalIndex = nonLocalIndex;
 
-        setSurfaceAdhesionEnergyDensity( surfaceAdhesionEnergyDensity );
+        setLocalParticleNeighbors( localParticleNeighbors );
 
         return;
 
     }
 
-    void aspBase::setSurfaceAdhesionEnergyDensity( const floatType& value ){
+    void aspBase::setLocalParticleNeighbors( const std::vector< std::vector< unsigned int > > &value ){
         /*!
-         * Set the surface adhesion energy density if required.
+         * Set the lists of the particles which may interact with each of the local particles. The lists depend on the
+         * deformation and are reset along with the assembled quantities.
          * 
-         * \param &value: the current value of the surface adhesion density
+         * \param &value: The sorted indices of the candidate non-local particles for each local particle
          */
 
-        _surfaceAdhesionEnergyDensity.second = value;
+        _localParticleNeighbors.second = value;
 
-        _surfaceAdhesionEnergyDensity.first = true;
+        _localParticleNeighbors.first = true;
 
-        addInteractionPairData( &_surfaceAdhesionEnergyDensity );
+        addAssembledData( &_localParticleNeighbors );
 
         return;
 
     }
 
-    void aspBase::setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ){
+    const std::vector< std::vector< unsigned int > >* aspBase::getLocalParticleNeighbors( ){
         /*!
-         * Set the value of the gradient of the surface adhesion energy density w.r.t. the local deformation gradient
+         * Get the lists of the particles which may interact with each of the local particles
          */
 
-        floatType surfaceAdhesionEnergyDensity;
-
-        floatVector dSEdF, dSEdChi, dSEdGradChi;
-
-        ERROR_TOOLS_CATCH( computeSurfaceAdhesionEnergyDensity( surfaceAdhesionEnergyDensity, dSEdF, dSEdChi, dSEdGradChi ) );
-
-        setSurfaceAdhesionEnergyDensity( surfaceAdhesionEnergyDensity );
+        if ( !_localParticleNeighbors.first ){
 
-        setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( dSEdF );
+            ERROR_TOOLS_CATCH( setLocalParticleNeighbors( ) );
 
-        setdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( dSEdChi );
+        }
 
-        setdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( dSEdGradChi );
+        return &_localParticleNeighbors.second;
 
     }
 
-    void aspBase::setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( const floatVector &value ){
+    const unsigned int* aspBase::getNumLocalParticles( ){
         /*!
-         * Set the value of the gradient of the surface adhesion energy density w.r.t. the local deformation gradient
-         * 
-         * \param &value: The value of the gradient of the surface adhesion energy density w.r.t. the local deformation gradient
+         * Get the number of local particles
          */
 
-        _dSurfaceAdhesionEnergyDensitydLocalDeformationGradient.second = value;
-
-        _dSurfaceAdhesionEnergyDensitydLocalDeformationGradient.first = true;
-
-        addInteractionPairData( &_dSurfaceAdhesionEnergyDensitydLocalDeformationGradient );
-
+        return &_numLocalParticles;
     }
 
-    const floatVector* aspBase::getdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ){
+    void aspBase::setLocalParticleQuantities( ){
         /*!
-         * Get the value of the gradient of the surface adhesion energy density w.r.t. the deformation gradient
+         * Set the energy, microstress, and log probability ratio for the local particle
          */
 
-        if ( !_dSurfaceAdhesionEnergyDensitydLocalDeformationGradient.first ){
-
-            ERROR_TOOLS_CATCH( setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ) )
-
-        }
-
-        return &_dSurfaceAdhesionEnergyDensitydLocalDeformationGradient.second;
+        ERROR_TOOLS_CATCH( evaluateLocalParticleQuantities( *this ) );
 
     }
 
-    void aspBase::setdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( ){
+    void aspBase::setLocalParticleEnergy( ){
         /*!
-         * Set the value of the gradient of the surface adhesion energy density w.r.t. the local micro-deformation
+         * Set the local particle's energy
          */
 
-        ERROR_TOOLS_CATCH( setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ) );
+        floatType localParticleEnergy;
+
+        localParticleEnergy = ( *getLocalParticleEnergyDensity( ) ) * ( *getLocalParticleCurrentVolume( ) );
+
+        setLocalParticleEnergy( localParticleEnergy );
 
     }
 
-    void aspBase::setdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( const floatVector &value ){
+    void aspBase::setLocalParticleEnergy( const floatType &value ){
         /*!
-         * Set the value of the gradient of the surface adhesion energy density w.r.t. the local micro-deformation
+         * Set the local particle's energy
          * 
-         * \param &value: The value of the gradient of the surface adhesion energy density w.r.t. the local micro-deformation
+         * \param &value: The local particle's energy
          */
 
-        _dSurfaceAdhesionEnergyDensitydLocalMicroDeformation.second = value;
+        _localParticleEnergy.second = value;
 
-        _dSurfaceAdhesionEnergyDensitydLocalMicroDeformation.first = true;
+        _localParticleEnergy.first = true;
 
-        addInteractionPairData( &_dSurfaceAdhesionEnergyDensitydLocalMicroDeformation );
+        addLocalParticleData( &_localParticleEnergy );
 
     }
 
-    const floatVector* aspBase::getdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( ){
+    const floatType* aspBase::getLocalParticleEnergy( ){
         /*!
-         * Get the value of the gradient of the surface adhesion energy density w.r.t. the micro-deformation
+         * Get the local particle's energy
          */
 
-        if ( !_dSurfaceAdhesionEnergyDensitydLocalMicroDeformation.first ){
+        if ( !_localParticleEnergy.first ){
 
-            ERROR_TOOLS_CATCH( setdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( ) )
+            ASP_INSTRUMENT_STAGE( LOCAL_PARTICLE_ENERGY );
+
+            ERROR_TOOLS_CATCH( setLocalParticleEnergy( ) );
 
         }
 
-        return &_dSurfaceAdhesionEnergyDensitydLocalMicroDeformation.second;
+        return &_localParticleEnergy.second;
 
     }
 
-    void aspBase::setdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( ){
+    void aspBase::setLocalParticleEnergyDensity( const floatType &value ){
         /*!
-         * Set the value of the gradient of the surface adhesion energy density w.r.t. the gradient of the micro-deformation
+         * Set the local particle's energy density
+         *
+         * \param &value: The value of the local particle's energy density
          */
 
-        ERROR_TOOLS_CATCH( setdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ) );
+        _localParticleEnergyDensity.second = value;
+
+        _localParticleEnergyDensity.first = true;
+
+        addLocalParticleData( &_localParticleEnergyDensity );
 
     }
 
-    void aspBase::setdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( const floatVector &value ){
+    const floatType* aspBase::getLocalParticleEnergyDensity( ){
         /*!
-         * Set the value of the gradient of the surface adhesion energy density w.r.t. the gradient of the micro-deformation
-         * 
-         * \param &value: The value of the gradient of the surface adhesion energy density w.r.t. the gradient of the micro-deformation
+         * Get the local particle's energy density
          */
 
-        _dSurfaceAdhesionEnergyDensitydGradientMicroDeformation.second = value;
+        if ( !_localParticleEnergyDensity.first ){
 
-        _dSurfaceAdhesionEnergyDensitydGradientMicroDeformation.first = true;
+            ERROR_TOOLS_CATCH( setLocalParticleQuantities( ) );
 
-        addInteractionPairData( &_dSurfaceAdhesionEnergyDensitydGradientMicroDeformation );
+        }
+
+        return &_localParticleEnergyDensity.second;
 
     }
 
-    const floatVector* aspBase::getdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( ){
+    void aspBase::setLocalParticleLogProbabilityRatio( const floatType &value ){
         /*!
-         * Get the value of the gradient of the surface adhesion energy density w.r.t. the gradient of the micro-deformation
+         * Set the local particle's log-probability ratio (i.e. the change in
+         * the local particle's energy log probability (log(p_current) - log(p_previous))
+         * 
+         * \param &value: The value of the change in log probability.
          */
 
-        if ( !_dSurfaceAdhesionEnergyDensitydGradientMicroDeformation.first ){
-
-            ERROR_TOOLS_CATCH( setdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( ) )
+        _localParticleLogProbabilityRatio.second = value;
 
-        }
+        _localParticleLogProbabilityRatio.first = true;
 
-        return &_dSurfaceAdhesionEnergyDensitydGradientMicroDeformation.second;
+        addLocalParticleData( &_localParticleLogProbabilityRatio );
 
     }
 
-    void aspBase::setSurfaceOverlapEnergyDensity( ){
+    const floatType* aspBase::getLocalParticleLogProbabilityRatio( ){
         /*!
-         * Set the surface overlap energy density if required.
+         * Get the local particle's log probability ratio
          */
 
-        mapFloatType surfaceOverlapEnergyDensity;
+        if ( !_localParticleLogProbabilityRatio.first ){
 
-        ERROR_TOOLS_CATCH( computeSurfaceOverlapEnergyDensity( surfaceOverlapEnergyDensity ) );
+            ERROR_TOOLS_CATCH( setLocalParticleQuantities( ) );
 
-        setSurfaceOverlapEnergyDensity( surfaceOverlapEnergyDensity );
+        }
 
-        return;
+        return &_localParticleLogProbabilityRatio.second;
 
     }
 
-    void aspBase::setSurfaceOverlapEnergyDensity( const mapFloatType &value ){
+    void aspBase::setLocalParticleMicroCauchyStress( const floatVector &value ){
         /*!
-         * Set the surface overlap energy density if required.
+         * Set the local particle's value of the micro Cauchy stress
          * 
-         * \param &value: The map to the surface overlap energy density
+         * \param &value: The value of the micro-cauchy stress
          */
 
-        _surfaceOverlapEnergyDensity.second = value;
-
-        _surfaceOverlapEnergyDensity.first = true;
+        _localParticleMicroCauchyStress.second = value;
 
-        addInteractionPairData( &_surfaceOverlapEnergyDensity );
+        _localParticleMicroCauchyStress.first = true;
 
-        return;
+        addLocalParticleData( &_localParticleMicroCauchyStress );
 
     }
 
-    void aspBase::setSurfaceOverlapParameters( ){
+    const floatVector* aspBase::getLocalParticleMicroCauchyStress( ){
         /*!
-         * Set the surface overlap parameters
+         * Get the local particle's micro cauchy stress
          */
 
-        setSurfaceOverlapParameters( { 1 } );
+        if ( !_localParticleMicroCauchyStress.first ){
 
-        return;
+            ERROR_TOOLS_CATCH( setLocalParticleQuantities( ) );
+
+        }
+
+        return &_localParticleMicroCauchyStress.second;
 
     }
 
-    void aspBase::setSurfaceOverlapParameters( const floatVector &value ){
+    void aspBase::setLocalParticleStateVariables( const floatVector &value ){
         /*!
-         * Set the surface overlap parameters
+         * Set the local particle's state variables
          * 
-         * \param &value: Set the value of the surface overlap parameters
+         * \param &value: The value of the local particle's state variables
          */
 
-        _surfaceOverlapParameters.second = value;
-
-        _surfaceOverlapParameters.first = true;
+        _localParticleStateVariables.second = value;
 
-        addInteractionPairData( &_surfaceOverlapParameters );
+        _localParticleStateVariables.first = true;
 
-        return;
+        addLocalParticleData( &_localParticleStateVariables );
 
     }
 
-    const floatVector *aspBase::getSurfaceOverlapParameters( ){
+    const floatVector* aspBase::getLocalParticleStateVariables( ){
         /*!
-         * Get the surface overlap parameters
+         * Get the local particle's state variables
          */
 
-        if ( !_surfaceOverlapParameters.first ){
+        if ( !_localParticleStateVariables.first ){
 
-            ERROR_TOOLS_CATCH( setSurfaceOverlapParameters( ) );
+            ERROR_TOOLS_CATCH( setLocalParticleQuantities( ) );
 
         }
 
-        return &_surfaceOverlapParameters.second;
+        return &_localParticleStateVariables.second;
 
     }
 
-    void aspBase::setLocalReferenceSurfacePoints( ){
+    const floatType* aspBase::getPreviousTime( ){
         /*!
-         * Set the collection of points which are on the surface of the local particle in the reference configuration
+         * Get the previous value of the time
          */
 
-        const floatVector *unitSpherePoints;
-        ERROR_TOOLS_CATCH( unitSpherePoints = getUnitSpherePoints( ) );
-
-        const floatType *localReferenceRadius;
-        ERROR_TOOLS_CATCH( localReferenceRadius = getLocalReferenceRadius( ) );
+        return &_previousTime;
 
-        setLocalReferenceSurfacePoints( ( *localReferenceRadius ) * ( *unitSpherePoints ) );
+    }
+    
+    const floatType* aspBase::getDeltaTime( ){
+        /*!
+         * Get the change in time
+         */
 
-        return;
+        return &_deltaTime;
 
     }
 
-    void aspBase::setLocalReferenceSurfacePoints( const floatVector &value ){
+    const floatType* aspBase::getPreviousTemperature( ){
         /*!
-         * Set the collection of points which are on the surface of the local particle in the reference configuration
-         * \param &value: The values of the local reference surface points
+         * Get the previous value of the temperature
          */
 
-        _localReferenceSurfacePoints.second = value;
+        return &_previousTemperature;
 
-        _localReferenceSurfacePoints.first = true;
+    }
+    
+    const floatType* aspBase::getTemperature( ){
+        /*!
+         * Get the current temperature
+         */
 
-        addLocalParticleData( &_localReferenceSurfacePoints );
+        return &_temperature;
 
     }
 
-    const floatVector* aspBase::getLocalReferenceSurfacePoints( ){
-        /*!
-         * Get the local reference surface points
-         */
+    const floatType* aspBase::getLocalParticleReferenceVolume( ){
+        /*!
+         * Get the reference configuration volume for the local particle
+         */ 
 
-        if ( !_localReferenceSurfacePoints.first ){
+        if ( !_localParticleReferenceVolume.first ){
 
-            ERROR_TOOLS_CATCH( setLocalReferenceSurfacePoints( ) );
+            ERROR_TOOLS_CATCH( setLocalParticleReferenceVolume( ) );
 
         }
 
-        return &_localReferenceSurfacePoints.second;
+        return &_localParticleReferenceVolume.second;
 
     }
 
-    void aspBase::setNonLocalReferenceSurfacePoints( ){
+    void aspBase::setLocalParticleReferenceVolume( ){
         /*!
-         * Set the collection of points which are on the surface of the non-local particle in the reference configuration
-         */
+         * Set the reference configuration volume for the local particle
+         */ 
 
-        const floatVector *unitSpherePoints;
-        ERROR_TOOLS_CATCH( unitSpherePoints = getUnitSpherePoints( ) );
+        const floatType* localReferenceRadius;
+        ERROR_TOOLS_CATCH( localReferenceRadius = getLocalReferenceRadius( ) );
 
-        const floatType *nonLocalReferenceRadius;
-        ERROR_TOOLS_CATCH( nonLocalReferenceRadius = getNonLocalReferenceRadius( ) );
+        floatType localParticleReferenceVolume;
 
-        setNonLocalReferenceSurfacePoints( ( *nonLocalReferenceRadius ) * ( *unitSpherePoints ) );
+        localParticleReferenceVolume = 4./3 * _pi * std::pow( *localReferenceRadius, 3 );
+
+        setLocalParticleReferenceVolume( localParticleReferenceVolume );
 
         return;
 
     }
 
-    void aspBase::setNonLocalReferenceSurfacePoints( const floatVector &value ){
+    void aspBase::setLocalParticleReferenceVolume( const floatType &value ){
         /*!
-         * Set the collection of points which are on the surface of the non-local particle in the reference configuration
+         * Set the reference configuration volume for the local particle
          * 
-         * \param &value: The value of the non-local reference surface points
+         * \param &value: The value of the reference configuration volume of the
+         *     local particle.
          */
 
-        _nonLocalReferenceSurfacePoints.second = value;
+        _localParticleReferenceVolume.second = value;
 
-        _nonLocalReferenceSurfacePoints.first = true;
+        _localParticleReferenceVolume.first = true;
 
-        addInteractionPairData( &_nonLocalReferenceSurfacePoints );
+        addLocalParticleData( &_localParticleReferenceVolume );
 
         return;
 
     }
 
-    const floatVector* aspBase::getNonLocalReferenceSurfacePoints( ){
+    const floatType* aspBase::getLocalParticleCurrentVolume( ){
         /*!
-         * Get the non-local reference surface points
-         */
+         * Set the current configuration volume for the local particle
+         */ 
 
-        if ( !_nonLocalReferenceSurfacePoints.first ){
+        if ( !_localParticleCurrentVolume.first ){
 
-            ERROR_TOOLS_CATCH( setNonLocalReferenceSurfacePoints( ) );
+            ERROR_TOOLS_CATCH( setLocalParticleCurrentVolume( ) );
 
         }
 
-        return &_nonLocalReferenceSurfacePoints.second;
+        return &_localParticleCurrentVolume.second;
 
     }
 
-    void aspBase::setLocalCurrentSurfacePoints( ){
+    void aspBase::setLocalParticleCurrentVolume( ){
         /*!
-         * Set the collection of points on the surface of the local particle in the current configuration
-         */
+         * Set the current configuration local particle volume
+         */ 
 
         const unsigned int *dim = getDimension( );
 
-        const floatVector *localReferenceSurfacePoints;
-        ERROR_TOOLS_CATCH( localReferenceSurfacePoints = getLocalReferenceSurfacePoints( ) );
+        const floatVector* microDeformation;
+        ERROR_TOOLS_CATCH( microDeformation = getLocalMicroDeformation( ) );
 
-        const floatVector *localMicroDeformation;
-        ERROR_TOOLS_CATCH( localMicroDeformation = getLocalMicroDeformation( ) );
+        const floatType* referenceVolume;
+        ERROR_TOOLS_CATCH( referenceVolume = getLocalParticleReferenceVolume( ) );
 
-        floatVector localCurrentSurfacePoints;
+        floatType J;
+        ERROR_TOOLS_CATCH( J = tardigradeVectorTools::determinant( *microDeformation, ( *dim ), ( *dim ) ) );
 
-        ERROR_TOOLS_CATCH( localCurrentSurfacePoints = tardigradeVectorTools::matrixMultiply( *localReferenceSurfacePoints, *localMicroDeformation,
-                                                                                    localReferenceSurfacePoints->size( ) / ( *dim ), *dim, *dim, *dim, false, true ) );
+        floatType currentVolume = J * ( *referenceVolume );
 
-        setLocalCurrentSurfacePoints( localCurrentSurfacePoints );
+        setLocalParticleCurrentVolume( currentVolume );
 
     }
 
-    void aspBase::setLocalCurrentSurfacePoints( const floatVector &value ){
+    void aspBase::setLocalParticleCurrentVolume( const floatType &value ){
         /*!
-         * Set the collection of points on the surface of the local particle in the current configuration
-         *
-         * \param &value: The current points on the surface of the local particle
+         * Set the current configuration local particle volume
+         * 
+         * \param &value: The current configuration local particle volume
          */
 
-        _localCurrentSurfacePoints.second = value;
+        _localParticleCurrentVolume.second = value;
 
-        _localCurrentSurfacePoints.first = true;
+        _localParticleCurrentVolume.first = true;
 
-        addLocalParticleData( &_localCurrentSurfacePoints );
+        addLocalParticleData( &_localParticleCurrentVolume );
 
     }
 
-    const floatVector* aspBase::getLocalCurrentSurfacePoints( ){
+    const floatVector* aspBase::getPreviousStateVariables( ){
         /*!
-         * Get the collection of points on the surface of the local particle in the current configuration
+         * Get the previous state variables
          */
 
-        if ( !_localCurrentSurfacePoints.first ){
+        return &_previousStateVariables;
 
-            ERROR_TOOLS_CATCH( setLocalCurrentSurfacePoints( ) );
+    }
 
-        }
+    const floatVector* aspBase::getPreviousLocalStateVariables( ){
+        /*!
+         * Get the previous state variables for the local particle
+         */
 
-        return &_localCurrentSurfacePoints.second;
+        const floatVector* previousStateVariables;
+        ERROR_TOOLS_CATCH( previousStateVariables = getPreviousStateVariables( ) );
+
+        return previousStateVariables;
 
     }
 
-    void aspBase::setNonLocalCurrentSurfacePoints( ){
+    const floatVector* aspBase::getParticleParameters( ){
         /*!
-         * Set the collection of points on the surface of the non-local particle in the current configuration
+         * Get the parameters for the internal particle computation
          */
 
-        const unsigned int *dim = getDimension( );
-
-        const floatVector *nonLocalReferenceSurfacePoints;
-        ERROR_TOOLS_CATCH( nonLocalReferenceSurfacePoints = getNonLocalReferenceSurfacePoints( ) );
-
-        const floatVector *nonLocalMicroDeformation;
-        ERROR_TOOLS_CATCH( nonLocalMicroDeformation = getNonLocalMicroDeformation( ) );
+        return &_particleParameters;
 
-        floatVector nonLocalCurrentSurfacePoints;
+    }
 
-        ERROR_TOOLS_CATCH( nonLocalCurrentSurfacePoints = tardigradeVectorTools::matrixMultiply( *nonLocalReferenceSurfacePoints, *nonLocalMicroDeformation,
-                                                                                       nonLocalReferenceSurfacePoints->size( ) / ( *dim ),
-                                                                                               *dim, *dim, *dim, false, true ) );
+    void aspBase::setLocalParticleParameters( ){
+        /*!
+         * Set the parameters for the local particle
+         */
 
-        setNonLocalCurrentSurfacePoints( nonLocalCurrentSurfacePoints );
+        setLocalParticleParameters( *getParticleParameters( ) );
 
     }
 
-    void aspBase::setNonLocalCurrentSurfacePoints( const floatVector &value ){
+    void aspBase::setLocalParticleParameters( const floatVector &value ){
         /*!
-         * Set the collection of points on the surface of the non-local particle in the current configuration
+         * Set the parameters for the local particle
          * 
-         * \param &value: The current non-local surface points
+         * \param &value: The current parameters for the local particle
          */
 
-        _nonLocalCurrentSurfacePoints.second = value;
+        _localParticleParameters.second = value;
 
-        _nonLocalCurrentSurfacePoints.first = true;
+        _localParticleParameters.first = true;
 
-        addInteractionPairData( &_nonLocalCurrentSurfacePoints );
+        addLocalParticleData( &_localParticleParameters );
 
     }
 
-    const floatVector* aspBase::getNonLocalCurrentSurfacePoints( ){
+
+    const floatVector* aspBase::getLocalParticleParameters( ){
         /*!
-         * Get the collection of points on the surface of the non-local particle in the current configuration
+         * Get the local particle's parameters
          */
 
-        if ( !_nonLocalCurrentSurfacePoints.first ){
+        if ( !_localParticleParameters.first ){
 
-            ERROR_TOOLS_CATCH( setNonLocalCurrentSurfacePoints( ) );
+            ERROR_TOOLS_CATCH( setLocalParticleParameters( ) );
 
         }
 
-        return &_nonLocalCurrentSurfacePoints.second;
+        return &_localParticleParameters.second;
 
     }
 
-    void aspBase::setLocalParticleCurrentBoundingBox( ){
+    void aspBase::assembleLocalParticles( ){
         /*!
-         * Set the bounding box of the local particle (dimension, (lower bound, upper bound))
+         * Assemble all the required quantities for the local particles
+         * 
+         * If _numAssemblyThreads is greater than one the local particles are split into contiguous ranges which
+         * are each assembled by a copy of this object (see createAssemblyWorker) that writes directly into the
+         * pre-allocated output arrays.
          */
 
-        const floatVector *localCurrentSurfacePoints;
-        ERROR_TOOLS_CATCH( localCurrentSurfacePoints = getLocalCurrentSurfacePoints( ) ); 
+        ASP_INSTRUMENT_STAGE( LOCAL_PARTICLE_ASSEMBLY );
 
-        floatMatrix localParticleCurrentBoundingBox;
+        const unsigned int numLocalParticles = *getNumLocalParticles( );
 
-        ERROR_TOOLS_CATCH( formBoundingBox( *localCurrentSurfacePoints, localParticleCurrentBoundingBox ) );
+        _assembledLocalParticleEnergies.second = floatVector( numLocalParticles );
 
-        setLocalParticleCurrentBoundingBox( localParticleCurrentBoundingBox );
+        _assembledLocalParticleMicroCauchyStress.second = floatMatrix( numLocalParticles );
 
-        return;
+        _assembledLocalParticleVolumes.second = floatVector( numLocalParticles );
+
+        _assembledLocalParticleLogProbabilityRatios.second = floatVector( numLocalParticles );
+
+        if ( _numAssemblyThreads > 1 ){
+
+            ERROR_TOOLS_CATCH( runAssemblyWorkers( numLocalParticles,
+                                                   [ & ]( aspBase &worker, const unsigned int &workerIndex, const unsigned int &begin, const unsigned int &end ){
+
+                                                       worker.assembleLocalParticleRange( begin, end,
+                                                                                          _assembledLocalParticleEnergies.second,
+                                                                                          _assembledLocalParticleMicroCauchyStress.second,
+                                                                                          _assembledLocalParticleVolumes.second,
+                                                                                          _assembledLocalParticleLogProbabilityRatios.second );
+
+                                                   } ) );
+
+        }
+        else{
+
+            ERROR_TOOLS_CATCH( assembleLocalParticleRange( 0, numLocalParticles,
+                                                           _assembledLocalParticleEnergies.second,
+                                                           _assembledLocalParticleMicroCauchyStress.second,
+                                                           _assembledLocalParticleVolumes.second,
+                                                           _assembledLocalParticleLogProbabilityRatios.second ) );
+
+        }
+
+        _assembledLocalParticleEnergies.first = true;
+
+        addAssembledData( &_assembledLocalParticleEnergies );
+
+        _assembledLocalParticleMicroCauchyStress.first = true;
+
+        addAssembledData( &_assembledLocalParticleMicroCauchyStress );
+
+        _assembledLocalParticleVolumes.first = true;
+
+        addAssembledData( &_assembledLocalParticleVolumes );
+
+        _assembledLocalParticleLogProbabilityRatios.first = true;
+
+        addAssembledData( &_assembledLocalParticleLogProbabilityRatios );
 
     }
 
-    void aspBase::setLocalParticleCurrentBoundingBox( const floatMatrix &value ){
+    void aspBase::assembleLocalParticleRange( const unsigned int &begin, const unsigned int &end,
+                                              floatVector &energies, floatMatrix &microCauchyStresses,
+                                              floatVector &volumes, floatVector &logProbabilityRatios ){
         /*!
-         * Set the bounding box of the local particle (dimension, (lower bound, upper bound))
+         * Assemble the quantities of the local particles with indices in [begin, end) into pre-allocated arrays
          * 
-         * \param &value: The local particle's current bounding box
+         * \param &begin: The index of the first local particle
+         * \param &end: The index one past the last local particle
+         * \param &energies: The energies of all of the local particles
+         * \param &microCauchyStresses: The micro Cauchy stresses of all of the local particles
+         * \param &volumes: The current volumes of all of the local particles
+         * \param &logProbabilityRatios: The log probability ratios of all of the local particles
          */
 
-        _localParticleCurrentBoundingBox.second = value;
-
-        _localParticleCurrentBoundingBox.first = true;
-
-        addLocalParticleData( &_localParticleCurrentBoundingBox );
-
-        return;
+        ERROR_TOOLS_CATCH( assembleLocalParticleLoop( *this, begin, end, energies, microCauchyStresses, volumes, logProbabilityRatios ) );
 
     }
 
-    void aspBase::formBoundingBox( const floatVector &points, floatMatrix &boundingBox ){
+    void aspBase::assembleSurfaceResponses( ){
         /*!
-         * Form a bounding box from the provided points
+         * Assemble the surface responses of the particles
          * 
-         * \param &points: The points to form the bounding box in [x1, y1, z1, x2, y2, z2, ...] format
-         * \param &boundingBox: The resulting bounding box
+         * If _numAssemblyThreads is greater than one the local particles are split into contiguous ranges which
+         * are each assembled by a copy of this object (see createAssemblyWorker). The ranges are combined in order
+         * so the result is identical to the serial assembly.
+         * 
+         * If the evaluation mode is ENERGY the tractions are not assembled and the current distance vectors and normals
+         * are formed without their derivatives.
+         * 
+         * The pairs which are assembled from the neighbor lists are determined by the pair selection (see
+         * selectInteractionPairs).
          */
 
+        ASP_INSTRUMENT_STAGE( SURFACE_RESPONSE_ASSEMBLY );
+
         const unsigned int *dim = getDimension( );
 
-        if ( ( points.size( ) % ( *dim ) ) > 0 ){
+        unsigned int numLocalParticles = *getNumLocalParticles( );
 
-            ERROR_TOOLS_CATCH( throw std::runtime_error( "The length of points must be an integer multiple of the dimension.\n  points.size( ) = " + std::to_string( points.size( ) ) + "\n  dimension: " + std::to_string( ( *dim ) ) ) );
+        unsigned int numSurfacePoints = getUnitSpherePoints( )->size( ) / ( *dim );
 
-        }
+        // Pairs which are not neighbors cannot interact
+        const std::vector< std::vector< unsigned int > > *localParticleNeighbors;
+        ERROR_TOOLS_CATCH( localParticleNeighbors = getLocalParticleNeighbors( ) );
 
-        if ( points.size( ) < ( *dim ) ){
+        if ( localParticleNeighbors->size( ) != numLocalParticles ){
 
-            ERROR_TOOLS_CATCH( throw std::runtime_error( "The points need at least one point" ) );
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "The neighbor lists must be defined for every local particle.\n  neighbor lists: " + std::to_string( localParticleNeighbors->size( ) ) + "\n  local particles: " + std::to_string( numLocalParticles ) ) );
 
         }
 
-        boundingBox = { { points[ 0 ], points[ 0 ] },
-                        { points[ 1 ], points[ 1 ] },
-                        { points[ 2 ], points[ 2 ] } };
+        std::vector< std::vector< unsigned int > > selectedPairs;
 
-        for ( unsigned int i = ( *dim ); i < points.size( ); i += ( *dim ) ){
+        if ( _pairSelection != ALL_PAIRS ){
 
-            for ( unsigned int j = 0; j < ( *dim ); j++ ){
+            ERROR_TOOLS_CATCH( selectInteractionPairs( *localParticleNeighbors, selectedPairs ) );
 
-                boundingBox[ j ][ 0 ] = std::fmin( boundingBox[ j ][ 0 ], points[ i + j ] );
-                boundingBox[ j ][ 1 ] = std::fmax( boundingBox[ j ][ 1 ], points[ i + j ] );
+            localParticleNeighbors = &selectedPairs;
 
-            }
+        }
+
+        // Only the pairs which are neighbors are stored
+        unsigned int numPairs = 0;
+
+        for ( auto n = localParticleNeighbors->begin( ); n != localParticleNeighbors->end( ); n++ ){
+
+            numPairs += n->size( ) * numSurfacePoints;
 
         }
 
-        return;
+        _assembledSparseSurfaceAdhesionEnergyDensities.second.initialize( numLocalParticles, numSurfacePoints, 1, numPairs );
 
-    }
+        _assembledSparseSurfaceAdhesionThicknesses.second.initialize( numLocalParticles, numSurfacePoints, 1, numPairs );
 
-    const floatMatrix* aspBase::getLocalParticleCurrentBoundingBox( ){
-        /*!
-         * Get the local particle's bounding box
-         */
+        _assembledSparseSurfaceAdhesionTractions.second.initialize( numLocalParticles, numSurfacePoints, *dim, numPairs );
 
-        if ( !_localParticleCurrentBoundingBox.first ){
+        _assembledSparseSurfaceOverlapEnergyDensities.second.initialize( numLocalParticles, numSurfacePoints, 1, numPairs );
 
-            ERROR_TOOLS_CATCH( setLocalParticleCurrentBoundingBox( ) );
+        _assembledSparseSurfaceOverlapThicknesses.second.initialize( numLocalParticles, numSurfacePoints, 1, numPairs );
 
-        }
+        _assembledSparseSurfaceOverlapTractions.second.initialize( numLocalParticles, numSurfacePoints, *dim, numPairs );
 
-        return &_localParticleCurrentBoundingBox.second;
+        if ( _numAssemblyThreads > 1 ){
 
-    }
+            // Each worker assembles into its own containers which are combined in order afterwards
+            unsigned int numWorkers = std::max( 1u, std::min( _numAssemblyThreads, numLocalParticles ) );
 
-    void aspBase::setNonLocalParticleCurrentBoundingBox( ){
-        /*!
-         * Set the bounding box of the non-local particle (dimension, (lower bound, upper bound))
-         */
+            std::vector< sparseSurfaceResponse > adhesionEnergyDensities( numWorkers ), adhesionTractions( numWorkers ), adhesionThicknesses( numWorkers );
 
-        const floatVector *nonLocalCurrentSurfacePoints;
-        ERROR_TOOLS_CATCH( nonLocalCurrentSurfacePoints = getNonLocalCurrentSurfacePoints( ) ); 
+            std::vector< sparseSurfaceResponse > overlapEnergyDensities( numWorkers ), overlapTractions( numWorkers ), overlapThicknesses( numWorkers );
 
-        floatMatrix nonLocalParticleCurrentBoundingBox;
+            ERROR_TOOLS_CATCH( runAssemblyWorkers( numLocalParticles,
+                                                   [ & ]( aspBase &worker, const unsigned int &workerIndex, const unsigned int &begin, const unsigned int &end ){
 
-        ERROR_TOOLS_CATCH( formBoundingBox( *nonLocalCurrentSurfacePoints, nonLocalParticleCurrentBoundingBox ) );
+                                                       unsigned int workerPairs = 0;
 
-        setNonLocalParticleCurrentBoundingBox( nonLocalParticleCurrentBoundingBox );
+                                                       for ( unsigned int i = begin; i < end; i++ ){
 
-        return;
+                                                           workerPairs += ( *localParticleNeighbors )[ i ].size( ) * numSurfacePoints;
 
-    }
+                                                       }
 
-    void aspBase::setNonLocalParticleCurrentBoundingBox( const floatMatrix &value ){
-        /*!
-         * Set the bounding box of the non-local particle (dimension, (lower bound, upper bound))
-         * 
-         * \param &value: The non-local particle's current bounding box
-         */
+                                                       adhesionEnergyDensities[ workerIndex ].initialize( numLocalParticles, numSurfacePoints, 1, workerPairs );
 
-        _nonLocalParticleCurrentBoundingBox.second = value;
+                                                       adhesionTractions[ workerIndex ].initialize( numLocalParticles, numSurfacePoints, *dim, workerPairs );
 
-        _nonLocalParticleCurrentBoundingBox.first = true;
+                                                       adhesionThicknesses[ workerIndex ].initialize( numLocalParticles, numSurfacePoints, 1, workerPairs );
+
+                                                       overlapEnergyDensities[ workerIndex ].initialize( numLocalParticles, numSurfacePoints, 1, workerPairs );
+
+                                                       overlapTractions[ workerIndex ].initialize( numLocalParticles, numSurfacePoints, *dim, workerPairs );
+
+                                                       overlapThicknesses[ workerIndex ].initialize( numLocalParticles, numSurfacePoints, 1, workerPairs );
+
+                                                       worker.assembleSurfaceResponseRange( begin, end, numSurfacePoints, *localParticleNeighbors,
+                                                                                            adhesionEnergyDensities[ workerIndex ], adhesionTractions[ workerIndex ],
+                                                                                            adhesionThicknesses[ workerIndex ], overlapEnergyDensities[ workerIndex ],
+                                                                                            overlapTractions[ workerIndex ], overlapThicknesses[ workerIndex ] );
+
+                                                   } ) );
+
+            for ( unsigned int w = 0; w < numWorkers; w++ ){
 
-        addInteractionPairData( &_nonLocalParticleCurrentBoundingBox );
+                ERROR_TOOLS_CATCH( _assembledSparseSurfaceAdhesionEnergyDensities.second.appendRows( adhesionEnergyDensities[ w ] ) );
 
-        return;
+                ERROR_TOOLS_CATCH( _assembledSparseSurfaceAdhesionTractions.second.appendRows( adhesionTractions[ w ] ) );
 
-    }
+                ERROR_TOOLS_CATCH( _assembledSparseSurfaceAdhesionThicknesses.second.appendRows( adhesionThicknesses[ w ] ) );
 
-    void aspBase::setSurfaceAdhesionTraction( ){
-        /*!
-         * Set the surface adhesion traction
-         */
+                ERROR_TOOLS_CATCH( _assembledSparseSurfaceOverlapEnergyDensities.second.appendRows( overlapEnergyDensities[ w ] ) );
 
-        floatVector surfaceAdhesionTraction;
+                ERROR_TOOLS_CATCH( _assembledSparseSurfaceOverlapTractions.second.appendRows( overlapTractions[ w ] ) );
 
-        ERROR_TOOLS_CATCH( computeSurfaceAdhesionTraction( surfaceAdhesionTraction ) );
+                ERROR_TOOLS_CATCH( _assembledSparseSurfaceOverlapThicknesses.second.appendRows( overlapThicknesses[ w ] ) );
 
-        setSurfaceAdhesionTraction( surfaceAdhesionTraction );
+            }
 
-        return;
+        }
+        else{
 
-    }
+            ERROR_TOOLS_CATCH( assembleSurfaceResponseRange( 0, numLocalParticles, numSurfacePoints, *localParticleNeighbors,
+                                                             _assembledSparseSurfaceAdhesionEnergyDensities.second,
+                                                             _assembledSparseSurfaceAdhesionTractions.second,
+                                                             _assembledSparseSurfaceAdhesionThicknesses.second,
+                                                             _assembledSparseSurfaceOverlapEnergyDensities.second,
+                                                             _assembledSparseSurfaceOverlapTractions.second,
+                                                             _assembledSparseSurfaceOverlapThicknesses.second ) );
 
-    void aspBase::setSurfaceAdhesionTraction( const floatVector &value ){
-        /*!
-         * Set the surface adhesion traction
-         *
-         * \param &value: The value of the surface adhesion traction.
-         */
+        }
 
-        _surfaceAdhesionTraction.second = value;
+        _assembledSparseSurfaceAdhesionEnergyDensities.first = true;
 
-        _surfaceAdhesionTraction.first = true;
+        addAssembledData( &_assembledSparseSurfaceAdhesionEnergyDensities );
 
-        addInteractionPairData( &_surfaceAdhesionTraction );
+        _assembledSparseSurfaceAdhesionTractions.first = true;
 
-        return;
+        addAssembledData( &_assembledSparseSurfaceAdhesionTractions );
 
-    }
+        _assembledSparseSurfaceAdhesionThicknesses.first = true;
 
-    const floatVector* aspBase::getSurfaceAdhesionTraction( ){
-        /*!
-         * Get the surface adhesion traction
-         */
+        addAssembledData( &_assembledSparseSurfaceAdhesionThicknesses );
 
-        if ( !_surfaceAdhesionTraction.first ){
+        _assembledSparseSurfaceOverlapEnergyDensities.first = true;
 
-            ERROR_TOOLS_CATCH( setSurfaceAdhesionTraction( ) );
+        addAssembledData( &_assembledSparseSurfaceOverlapEnergyDensities );
 
-        }
+        _assembledSparseSurfaceOverlapTractions.first = true;
 
-        return &_surfaceAdhesionTraction.second;
+        addAssembledData( &_assembledSparseSurfaceOverlapTractions );
 
-    }
+        _assembledSparseSurfaceOverlapThicknesses.first = true;
 
-    void aspBase::computeSurfaceAdhesionTraction( floatVector &surfaceAdhesionTraction ){
-        /*!
-         * Compute the surface adhesion traction
-         * 
-         * \param &surfaceAdhesionTraction: The current adhesion traction between the local and non-local particles
-         */
+        addAssembledData( &_assembledSparseSurfaceOverlapThicknesses );
 
-        const floatVector* currentDistanceVector;
-        ERROR_TOOLS_CATCH( currentDistanceVector = getCurrentDistanceVector( ) );
+        // The dense forms are expanded from the sparse forms when they are requested
+        _assembledSurfaceAdhesionEnergyDensities.clear( );
 
-        const floatVector* localCurrentNormal;
-        ERROR_TOOLS_CATCH( localCurrentNormal = getLocalCurrentNormal( ) );
+        _assembledSurfaceAdhesionTractions.clear( );
 
-        const floatVector* surfaceParameters;
-        ERROR_TOOLS_CATCH( surfaceParameters = getSurfaceParameters( ) );
+        _assembledSurfaceAdhesionThicknesses.clear( );
 
-        // Decompose the traction into normal and tangential directions
-        floatVector dn, dt;
-        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::decomposeVector( *currentDistanceVector, *localCurrentNormal, dn, dt ) );
+        _assembledSurfaceOverlapEnergyDensities.clear( );
 
-        ERROR_TOOLS_CATCH( tractionSeparation::computeLinearTraction( dn, dt, *surfaceParameters, surfaceAdhesionTraction ) );
+        _assembledSurfaceOverlapTractions.clear( );
 
-        return;
+        _assembledSurfaceOverlapThicknesses.clear( );
 
     }
 
-    void aspBase::setSurfaceAdhesionThickness( ){
+    void aspBase::assembleSurfaceResponseRange( const unsigned int &begin, const unsigned int &end, const unsigned int &numSurfacePoints,
+                                                const std::vector< std::vector< unsigned int > > &neighbors,
+                                                sparseSurfaceResponse &adhesionEnergyDensities, sparseSurfaceResponse &adhesionTractions,
+                                                sparseSurfaceResponse &adhesionThicknesses, sparseSurfaceResponse &overlapEnergyDensities,
+                                                sparseSurfaceResponse &overlapTractions, sparseSurfaceResponse &overlapThicknesses ){
         /*!
-         * Set the current thickness of the surface adhesion
+         * Append the surface responses of the local particles with indices in [begin, end) to initialized compressed quantities
+         * 
+         * \param &begin: The index of the first local particle
+         * \param &end: The index one past the last local particle
+         * \param &numSurfacePoints: The number of surface points on each local particle
+         * \param &neighbors: The non-local particles which may interact with each local particle
+         * \param &adhesionEnergyDensities: The surface adhesion energy densities
+         * \param &adhesionTractions: The surface adhesion tractions
+         * \param &adhesionThicknesses: The surface adhesion thicknesses
+         * \param &overlapEnergyDensities: The surface overlap energy densities
+         * \param &overlapTractions: The surface overlap tractions
+         * \param &overlapThicknesses: The surface overlap thicknesses
          */
 
-        const floatVector* currentDistanceVector;
-        ERROR_TOOLS_CATCH( currentDistanceVector = getCurrentDistanceVector( ) );
-
-        const floatVector* localCurrentNormal;
-        ERROR_TOOLS_CATCH( localCurrentNormal = getLocalCurrentNormal( ) );
-        
-        // Decompose the distance into normal and tangential directions
-        floatVector dn, dt;
-        ERROR_TOOLS_CATCH_NODE_POINTER( tractionSeparation::decomposeVector( *currentDistanceVector, *localCurrentNormal, dn, dt ) );
-
-        setSurfaceAdhesionThickness( tardigradeVectorTools::l2norm( dn ) );
+        ERROR_TOOLS_CATCH( assembleSurfaceResponseLoop( *this, begin, end, numSurfacePoints, neighbors,
+                                                        adhesionEnergyDensities, adhesionTractions, adhesionThicknesses,
+                                                        overlapEnergyDensities, overlapTractions, overlapThicknesses ) );
 
     }
 
-    void aspBase::setSurfaceAdhesionThickness( const floatType &value ){
+    std::unique_ptr< aspBase > aspBase::createAssemblyWorker( ) const{
         /*!
-         * Set the current thickness of the surface adhesion
+         * Create a copy of this object which is used to assemble a range of the local particles in the parallel assembly.
+         * Each worker carries its own loop indices and cached values so the workers may be evaluated concurrently. The
+         * user-defined functions of the copy must only read from shared data.
          * 
-         * \param &value: The thickness associated with the surface adhesion
+         * The copy is made by runAssemblyWorkers while the cached particle data is reset and the assembled quantities and
+         * neighbor lists are moved out of this object, so only the parameters, the deformation, and the unit sphere are
+         * copied along with any members of the derived class. Large read-only members of derived classes should be held
+         * by shared pointers so that they are shared by the workers rather than copied.
+         * 
+         * Classes which derive from aspBase must override this function to copy themselves in order to use the parallel
+         * assembly, e.g.
+         * 
+         * return std::unique_ptr< aspBase >( new derivedClass( *this ) );
          */
 
-        _surfaceAdhesionThickness.second = value;
-
-        _surfaceAdhesionThickness.first = true;
-
-        addInteractionPairData( &_surfaceAdhesionThickness );
+        return std::unique_ptr< aspBase >( new aspBase( *this ) );
 
     }
 
-    const floatType* aspBase::getSurfaceAdhesionThickness( ){
+    void aspBase::runAssemblyWorkers( const unsigned int &numItems,
+                                      const std::function< void( aspBase &worker, const unsigned int &workerIndex,
+                                                                 const unsigned int &begin, const unsigned int &end ) > &task ){
         /*!
-         * Get the current value of the surface adhesion thickness
+         * Split the items into at most _numAssemblyThreads contiguous ranges and evaluate the task for each range with
+         * an independent worker. The workers are evaluated concurrently when OpenMP is available. The items are the local
+         * particles and each worker uses the overlap solutions of the local particles which it evaluates.
+         * 
+         * \param &numItems: The number of items to be split between the workers
+         * \param &task: The function to evaluate for each worker and the range of items [begin, end) assigned to it
          */
 
-        if ( !_surfaceAdhesionThickness.first ){
+        unsigned int numWorkers = std::max( 1u, std::min( _numAssemblyThreads, numItems ) );
 
-            ERROR_TOOLS_CATCH( setSurfaceAdhesionThickness( ) );
+        // Cached values for a particular particle must not be copied into the workers
+        resetLocalParticleData( );
 
-        }
+        std::vector< std::unique_ptr< aspBase > > workers( numWorkers );
 
-        return &_surfaceAdhesionThickness.second;
+        {
+            // The assembled quantities and the neighbor lists are owned by this object and are only accessed through it so
+            // they are moved out while the workers are copied and restored before the tasks are evaluated
+            storageStash assembledStorage( _localParticleNeighbors, _assembledLocalParticleEnergies, _assembledLocalParticleMicroCauchyStress,
+                                           _assembledLocalParticleVolumes, _assembledLocalParticleLogProbabilityRatios,
+                                           _assembledSurfaceAdhesionThicknesses, _assembledSurfaceAdhesionEnergyDensities,
+                                           _assembledSurfaceAdhesionTractions, _assembledSurfaceOverlapThicknesses,
+                                           _assembledSurfaceOverlapEnergyDensities, _assembledSurfaceOverlapTractions,
+                                           _assembledSparseSurfaceAdhesionThicknesses, _assembledSparseSurfaceAdhesionEnergyDensities,
+                                           _assembledSparseSurfaceAdhesionTractions, _assembledSparseSurfaceOverlapThicknesses,
+                                           _assembledSparseSurfaceOverlapEnergyDensities, _assembledSparseSurfaceOverlapTractions,
+                                           _overlapSolutions );
 
-    }
+            for ( unsigned int w = 0; w < numWorkers; w++ ){
 
-    void aspBase::setSurfaceOverlapThickness( ){
-        /*!
-         * Set the current thickness of the surface overlap
-         */
+                ERROR_TOOLS_CATCH( workers[ w ] = createAssemblyWorker( ) );
 
-        const mapFloatVector* particlePairOverlap;
-        ERROR_TOOLS_CATCH( particlePairOverlap = getParticlePairOverlap( ) );
+                if ( !workers[ w ] || ( typeid( *workers[ w ] ) != typeid( *this ) ) ){
 
-        mapFloatType surfaceOverlapThickness;
+                    ERROR_TOOLS_CATCH( throw std::runtime_error( "createAssemblyWorker must return a copy of the object. It must be overridden by " + std::string( typeid( *this ).name( ) ) + " to use the parallel assembly" ) );
 
-        for ( auto overlap = particlePairOverlap->begin( ); overlap != particlePairOverlap->end( ); overlap++ ){
+                }
 
-            floatVector normal;
+                workers[ w ]->_numAssemblyThreads = 1;
 
-            ERROR_TOOLS_CATCH( getLocalCurrentNormal( overlap->first, normal ) );
-        
-            surfaceOverlapThickness.insert( { overlap->first, std::fabs( tardigradeVectorTools::dot( overlap->second, normal ) ) } );
+                // The assembled quantities are owned by this object
+                workers[ w ]->_assembledData.clear( );
+
+                // The work of each worker is added to the counters of this object once it is complete
+                workers[ w ]->_instrumentation.reset( );
+
+            }
 
         }
 
-        setSurfaceOverlapThickness( surfaceOverlapThickness );
+        auto begin = [ & ]( const unsigned int &w ){ return ( w * numItems ) / numWorkers; };
 
-    }
+        // The overlap solutions of the local particles are moved to the worker which evaluates them and moved back afterwards
+        auto swapOverlapSolutions = [ & ]( ){
 
-    void aspBase::setSurfaceOverlapThickness( const mapFloatType &value ){
-        /*!
-         * Set the current thickness of the surface overlap
-         * 
-         * \param &value: The map from local surface node indices to the overlap thickness
-         */
+            if ( _overlapSolutions.second.size( ) < numItems ){
 
-        _surfaceOverlapThickness.second = value;
+                _overlapSolutions.second.resize( numItems );
 
-        _surfaceOverlapThickness.first = true;
+            }
 
-        addInteractionPairData( &_surfaceOverlapThickness );
+            for ( unsigned int w = 0; w < numWorkers; w++ ){
 
-    }
+                workers[ w ]->_overlapSolutions.first = true;
 
-    const mapFloatType* aspBase::getSurfaceOverlapThickness( ){
-        /*!
-         * Get the current value of the surface overlap thickness
-         */
+                workers[ w ]->_overlapSolutions.second.resize( _overlapSolutions.second.size( ) );
 
-        if ( !_surfaceOverlapThickness.first ){
+                for ( unsigned int i = begin( w ); i < begin( w + 1 ); i++ ){
 
-            ERROR_TOOLS_CATCH( setSurfaceOverlapThickness( ) );
+                    std::swap( workers[ w ]->_overlapSolutions.second[ i ], _overlapSolutions.second[ i ] );
 
-        }
+                }
 
-        return &_surfaceOverlapThickness.second;
+            }
 
-    }
+        };
 
-    const std::vector< std::vector< floatVector > >* aspBase::getAssembledSurfaceAdhesionThicknesses( ){
-        /*!
-         * Get the current value of the surface adhesion thicknesses
-         */
+        swapOverlapSolutions( );
 
-        if ( !_assembledSurfaceAdhesionThicknesses.first ){
+        std::vector< std::exception_ptr > errors( numWorkers );
 
-            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
+#ifdef _OPENMP
+        #pragma omp parallel for num_threads( numWorkers ) schedule( static, 1 )
+#endif
+        for ( unsigned int w = 0; w < numWorkers; w++ ){
 
-        }
+            try{
 
-        return &_assembledSurfaceAdhesionThicknesses.second;
+                task( *workers[ w ], w, begin( w ), begin( w + 1 ) );
 
-    }
+            }
+            catch( ... ){
 
-    const std::vector< std::vector< floatVector > >* aspBase::getAssembledSurfaceAdhesionEnergyDensities( ){
-        /*!
-         * Get the current value of the surface adhesion energy densities
-         */
+                errors[ w ] = std::current_exception( );
 
-        if ( !_assembledSurfaceAdhesionEnergyDensities.first ){
+            }
 
-            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
+        }
+
+        swapOverlapSolutions( );
+
+        for ( auto w = workers.begin( ); w != workers.end( ); w++ ){
+
+            _instrumentation.merge( ( *w )->_instrumentation );
 
         }
 
-        return &_assembledSurfaceAdhesionEnergyDensities.second;
+        for ( auto e = errors.begin( ); e != errors.end( ); e++ ){
+
+            if ( *e ){
+
+                ERROR_TOOLS_CATCH( std::rethrow_exception( *e ) );
+
+            }
+
+        }
 
     }
 
-    const std::vector< std::vector< floatMatrix > >* aspBase::getAssembledSurfaceAdhesionTractions( ){
+    const floatVector* aspBase::getAssembledLocalParticleEnergies( ){
         /*!
-         * Get the current value of the surface adhesion thicknesses
+         * Get the assembled local particle energies
          */
 
-        if ( !_assembledSurfaceAdhesionTractions.first ){
+        if ( !_assembledLocalParticleEnergies.first ){
 
-            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
+            ERROR_TOOLS_CATCH( assembleLocalParticles( ) );
 
         }
 
-        return &_assembledSurfaceAdhesionTractions.second;
+        return &_assembledLocalParticleEnergies.second;
 
     }
 
-    const std::vector< std::vector< std::vector< mapFloatType > > >* aspBase::getAssembledSurfaceOverlapThicknesses( ){
+    const floatMatrix* aspBase::getAssembledLocalParticleMicroCauchyStresses( ){
         /*!
-         * Get the current value of the surface overlap thicknesses
+         * Get the assembled local particle micro Cauchy stress
          */
 
-        if ( !_assembledSurfaceOverlapThicknesses.first ){
+        if ( !_assembledLocalParticleMicroCauchyStress.first ){
 
-            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
+            ERROR_TOOLS_CATCH( assembleLocalParticles( ) );
 
         }
 
-        return &_assembledSurfaceOverlapThicknesses.second;
+        return &_assembledLocalParticleMicroCauchyStress.second;
 
     }
 
-    const std::vector< std::vector< std::vector< mapFloatType > > >* aspBase::getAssembledSurfaceOverlapEnergyDensities( ){
+    const floatVector* aspBase::getAssembledLocalParticleVolumes( ){
         /*!
-         * Get the current value of the surface overlap energy densities
+         * Get the assembled local particle volumes
          */
 
-        if ( !_assembledSurfaceOverlapEnergyDensities.first ){
+        if ( !_assembledLocalParticleVolumes.first ){
 
-            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
+            ERROR_TOOLS_CATCH( assembleLocalParticles( ) );
 
         }
 
-        return &_assembledSurfaceOverlapEnergyDensities.second;
+        return &_assembledLocalParticleVolumes.second;
 
     }
 
-    const std::vector< std::vector< std::vector< mapFloatVector > > >* aspBase::getAssembledSurfaceOverlapTractions( ){
+    const floatVector* aspBase::getAssembledLocalParticleLogProbabilityRatios( ){
         /*!
-         * Get the current value of the surface overlap thicknesses
+         * Get the assembled local particle log probability ratios
          */
 
-        if ( !_assembledSurfaceOverlapTractions.first ){
+        if ( !_assembledLocalParticleLogProbabilityRatios.first ){
 
-            ERROR_TOOLS_CATCH( assembleSurfaceResponses( ) );
+            ERROR_TOOLS_CATCH( assembleLocalParticles( ) );
 
         }
 
-        return &_assembledSurfaceOverlapTractions.second;
+        return &_assembledLocalParticleLogProbabilityRatios.second;
 
     }
 
-    void aspBase::computeSurfaceOverlapTraction( mapFloatVector &surfaceOverlapTraction ){
+    /** \brief Define required number of Abaqus material constants for the Abaqus interface. */
+    const int nStateVariables = 2;
+
+    /** \brief Define required number of Abaqus material constants for the Abaqus interface. */
+    const int nMaterialParameters = 2;
+
+    /** \brief Define the time increment ratio requested from Abaqus when a solver fails to converge. */
+    const double convergenceCutbackRatio = 0.5;
+
+    bool isConvergenceError( const std::exception &e ){
         /*!
-         * Compute the surface overlap traction
+         * Check if an exception, or any of the exceptions nested within it, is a failure of a solver to converge
          * 
-         * \param &surfaceOverlapTraction: An unordered map mapping from points on the local particle to the amount they overlap the non-local particle
+         * \param &e: The exception to check
          */
 
-        surfaceOverlapTraction.clear( );
+        if ( dynamic_cast< const tractionSeparation::convergenceError* >( &e ) ){
 
-        const mapFloatVector *particlePairOverlap;
-        ERROR_TOOLS_CATCH( particlePairOverlap = getParticlePairOverlap( ) );
+            return true;
 
-        const floatVector *overlapParameters;
-        ERROR_TOOLS_CATCH( overlapParameters = getSurfaceOverlapParameters( ) );
+        }
 
-        for ( auto overlap = particlePairOverlap->begin( ); overlap != particlePairOverlap->end( ); overlap++ ){
+        try{
 
-            surfaceOverlapTraction.insert( { overlap->first, ( *overlapParameters )[ 0 ] * overlap->second } );
+            std::rethrow_if_nested( e );
 
         }
+        catch( std::exception &nested ){
 
-        return;
-
-    }
-
-    void aspBase::setSurfaceOverlapTraction( ){
-        /*!
-         * Set the surface overlap traction
-         */
+            return isConvergenceError( nested );
 
-        mapFloatVector surfaceOverlapTraction;
+        }
+        catch( ... ){
 
-        ERROR_TOOLS_CATCH( computeSurfaceOverlapTraction( surfaceOverlapTraction ) );
+        }
 
-        setSurfaceOverlapTraction( surfaceOverlapTraction );
+        return false;
 
-        return;
+    }
 
+    /// Say hello
+    /// @param message The message to print
+    void sayHello( std::string message ) {
+        TARDIGRADE_ERROR_TOOLS_CHECK( message.compare( "George" ) != 0, "ERROR: George is a wolf in sheep's clothing!" );
+        std::cout << "Hello " << message << std::endl;
+        return NULL;
     }
 
-    void aspBase::setSurfaceOverlapTraction( const mapFloatVector &value ){
+    void dummyMaterialModel( floatVector &stress,             floatVector &statev,        floatMatrix &ddsdde,       floatType &SSE,            floatType &SPD,
+                             floatType &SCD,                  floatType &RPL,             floatVector &ddsddt,       floatVector &drplde,       floatType &DRPLDT,
+                             const floatVector &strain,       const floatVector &dstrain, const floatVector &time,   const floatType &DTIME,    const floatType &TEMP,
+                             const floatType &DTEMP,          const floatVector &predef,  const floatVector &dpred,  const std::string &cmname, const int &NDI,
+                             const int &NSHR,                 const int &NTENS,           const int &NSTATV,         const floatVector &props,  const int &NPROPS,
+                             const floatVector &coords,       const floatMatrix &drot,    floatType &PNEWDT,         const floatType &CELENT,   const floatMatrix &dfgrd0,
+                             const floatMatrix &dfgrd1,       const int &NOEL,            const int &NPT,            const int &LAYER,          const int &KSPT,
+                             const std::vector< int > &jstep, const int &KINC ){
         /*!
-         * Set the surface overlap traction
-         * 
-         * \param &value: The map from the local node indices to the overlap traction vectors
+         * A template Abaqus c++ UMAT using c++ STL types. Variables in all caps reference ABAQUS FORTRAN
+         * memory directly. Variables in lower case are native c++ type conversions stored separately from the original
+         * ABAQUS FORTRAN memory.
          */
 
-        _surfaceOverlapTraction.second = value;
-
-        _surfaceOverlapTraction.first = true;
-
-        addInteractionPairData( &_surfaceOverlapTraction );
-
-        return;
+        //Call functions of constitutive model to do things
+        TARDIGRADE_ERROR_TOOLS_CATCH( sayHello( "Abaqus" ) );
 
+        return void;
     }
 
-    const mapFloatVector* aspBase::getSurfaceOverlapTraction( ){
+    void dummyMaterialModel( vectorView &stress,              vectorView &statev,         matrixView &ddsdde,           floatType &SSE,            floatType &SPD,
+                             floatType &SCD,                  floatType &RPL,             vectorView &ddsddt,           vectorView &drplde,        floatType &DRPLDT,
+                             const constVectorView &strain,   const constVectorView &dstrain, const constVectorView &time, const floatType &DTIME, const floatType &TEMP,
+                             const floatType &DTEMP,          const constVectorView &predef, const constVectorView &dpred, const std::string &cmname, const int &NDI,
+                             const int &NSHR,                 const int &NTENS,           const int &NSTATV,            const constVectorView &props, const int &NPROPS,
+                             const constVectorView &coords,   const constMatrixView &drot, floatType &PNEWDT,           const floatType &CELENT,   const constMatrixView &dfgrd0,
+                             const constMatrixView &dfgrd1,   const int &NOEL,            const int &NPT,               const int &LAYER,          const int &KSPT,
+                             const constIntVectorView &jstep, const int &KINC ){
         /*!
-         * Get the surface overlap traction
+         * A template Abaqus c++ UMAT using non-owning views of the ABAQUS FORTRAN memory. The views are column major
+         * so that ``ddsdde( i, j )`` is the same entry as ``DDSDDE[ i + NTENS * j ]`` and any changes are made directly
+         * to the ABAQUS FORTRAN memory.
          */
 
-        if ( !_surfaceOverlapTraction.first ){
-
-            ERROR_TOOLS_CATCH( setSurfaceOverlapTraction( ) );
-
-        }
-
-        return &_surfaceOverlapTraction.second;
+        //Call functions of constitutive model to do things
+        TARDIGRADE_ERROR_TOOLS_CATCH( sayHello( "Abaqus" ) );
 
     }
 
-    const floatMatrix* aspBase::getNonLocalParticleCurrentBoundingBox( ){
+    integrationPointStateCache::entry *integrationPointStateCache::getEntry( const int &NOEL, const int &NPT, const bool &create ){
         /*!
-         * Get the local particle's bounding box
+         * Get the entry of an integration point. References to the entries remain valid as further entries are added so
+         * the lock is only held for the lookup.
+         * 
+         * \param &NOEL: The element number
+         * \param &NPT: The integration point number
+         * \param &create: Flag for whether to create the entry if it doesn't exist
          */
 
-        if ( !_nonLocalParticleCurrentBoundingBox.first ){
+        std::lock_guard< std::mutex > lock( _mutex );
 
-            ERROR_TOOLS_CATCH( setNonLocalParticleCurrentBoundingBox( ) );
+        auto key = std::make_pair( NOEL, NPT );
+
+        if ( create ){
+
+            return &_entries[ key ];
 
         }
 
-        return &_nonLocalParticleCurrentBoundingBox.second;
+        auto e = _entries.find( key );
 
-    }
+        if ( e == _entries.end( ) ){
 
-    const unsigned int* aspBase::getNumLocalParticles( ){
-        /*!
-         * Get the number of local particles
-         */
+            return NULL;
+
+        }
+
+        return &e->second;
 
-        return &_numLocalParticles;
     }
 
-    void aspBase::setLocalParticleQuantities( ){
+    integrationPointState &integrationPointStateCache::getTrialState( const int &NOEL, const int &NPT, const floatType &time, const floatType &DTIME ){
         /*!
-         * Set the energy, microstress, and log probability ratio for the local particle
+         * Get the trial state of an integration point for the increment which starts at the provided time. If the time is
+         * the end time of the previous trial increment that increment has converged and its trial state is committed. If
+         * the increment is the same as the previous trial increment the trial state is returned unchanged. Otherwise the
+         * returned trial state starts as a copy of the committed state.
+         * 
+         * \param &NOEL: The element number
+         * \param &NPT: The integration point number
+         * \param &time: The total time at the start of the increment (TIME[ 1 ])
+         * \param &DTIME: The time increment
          */
 
-        const floatType *previousTime;
-        ERROR_TOOLS_CATCH( previousTime = getPreviousTime( ) );
+        entry *e = getEntry( NOEL, NPT, true );
 
-        const floatType *deltaTime;
-        ERROR_TOOLS_CATCH( deltaTime = getDeltaTime( ) );
+        if ( e->hasTrial ){
 
-        const floatVector *currentLocalMicroDeformation;
-        ERROR_TOOLS_CATCH( currentLocalMicroDeformation = getLocalMicroDeformation( ) );
+            floatType tolerance = 1e-9 * std::max( { 1., std::fabs( e->trialEndTime ), std::fabs( time ) } );
 
-        const floatVector *previousLocalMicroDeformation;
-        ERROR_TOOLS_CATCH( previousLocalMicroDeformation = getPreviousLocalMicroDeformation( ) );
+            bool converged = ( std::fabs( time - e->trialEndTime ) <= tolerance ) && ( std::fabs( time - e->trialStartTime ) > tolerance );
 
-        const floatType *currentTemperature;
-        ERROR_TOOLS_CATCH( currentTemperature = getTemperature( ) );
+            bool sameIncrement = ( std::fabs( time - e->trialStartTime ) <= tolerance ) && ( std::fabs( time + DTIME - e->trialEndTime ) <= tolerance );
 
-        const floatType *previousTemperature;
-        ERROR_TOOLS_CATCH( previousTemperature = getPreviousTemperature( ) );
+            if ( converged ){
 
-        const floatVector *previousStateVariables;
-        ERROR_TOOLS_CATCH( previousStateVariables = getPreviousLocalStateVariables( ) );
+                std::swap( e->committed, e->trial );
 
-        const floatVector *parameters;
-        ERROR_TOOLS_CATCH( parameters = getLocalParticleParameters( ) );
-
-        floatType localParticleEnergyDensity;
+            }
+            else if ( sameIncrement ){
 
-        floatVector localParticleStateVariables;
+                // Further equilibrium iterations continue from the previous iteration
+                return e->trial;
 
-        floatVector localParticleMicroCauchyStress;
+            }
 
-        floatType localParticleLogProbabilityRatio;
+        }
 
-        ERROR_TOOLS_CATCH( computeLocalParticleEnergyDensity( *previousTime, *deltaTime, *currentLocalMicroDeformation, *previousLocalMicroDeformation,
-                                                              *currentTemperature, *previousTemperature, *previousStateVariables, *parameters,
-                                                              localParticleEnergyDensity, localParticleMicroCauchyStress,
-                                                              localParticleStateVariables, localParticleLogProbabilityRatio ) );
+        e->trial = e->committed;
 
-        setLocalParticleEnergyDensity( localParticleEnergyDensity );
+        e->trialStartTime = time;
 
-        setLocalParticleMicroCauchyStress( localParticleMicroCauchyStress );
+        e->trialEndTime = time + DTIME;
 
-        setLocalParticleStateVariables( localParticleStateVariables );
+        e->hasTrial = true;
 
-        setLocalParticleLogProbabilityRatio( localParticleLogProbabilityRatio );
+        return e->trial;
 
     }
 
-    void aspBase::setLocalParticleEnergy( ){
+    const integrationPointState *integrationPointStateCache::getCommittedState( const int &NOEL, const int &NPT ){
         /*!
-         * Set the local particle's energy
+         * Get the committed state of an integration point. Returns NULL if the point has no state.
+         * 
+         * \param &NOEL: The element number
+         * \param &NPT: The integration point number
          */
 
-        floatType localParticleEnergy;
+        entry *e = getEntry( NOEL, NPT, false );
 
-        localParticleEnergy = ( *getLocalParticleEnergyDensity( ) ) * ( *getLocalParticleCurrentVolume( ) );
+        if ( !e ){
 
-        setLocalParticleEnergy( localParticleEnergy );
+            return NULL;
+
+        }
+
+        return &e->committed;
 
     }
 
-    void aspBase::setLocalParticleEnergy( const floatType &value ){
+    void integrationPointStateCache::rollback( const int &NOEL, const int &NPT ){
         /*!
-         * Set the local particle's energy
+         * Discard the trial state of an integration point so that the next call starts from the committed state.
+         * Points without a state are ignored.
          * 
-         * \param &value: The local particle's energy
+         * \param &NOEL: The element number
+         * \param &NPT: The integration point number
          */
 
-        _localParticleEnergy.second = value;
+        entry *e = getEntry( NOEL, NPT, false );
 
-        _localParticleEnergy.first = true;
+        if ( e ){
 
-        addLocalParticleData( &_localParticleEnergy );
+            e->hasTrial = false;
+
+        }
 
     }
 
-    const floatType* aspBase::getLocalParticleEnergy( ){
+    void integrationPointStateCache::commit( ){
         /*!
-         * Get the local particle's energy
+         * Commit the trial states of all of the integration points. Called at the end of a converged increment so that
+         * the committed states are up to date before e.g. a checkpoint is written.
          */
 
-        if ( !_localParticleEnergy.first ){
+        std::lock_guard< std::mutex > lock( _mutex );
 
-            ERROR_TOOLS_CATCH( setLocalParticleEnergy( ) );
+        for ( auto e = _entries.begin( ); e != _entries.end( ); e++ ){
 
-        }
+            if ( e->second.hasTrial ){
 
-        return &_localParticleEnergy.second;
+                std::swap( e->second.committed, e->second.trial );
+
+                e->second.hasTrial = false;
+
+            }
+
+        }
 
     }
 
-    void aspBase::setLocalParticleEnergyDensity( const floatType &value ){
+    void integrationPointStateCache::clear( ){
         /*!
-         * Set the local particle's energy density
-         *
-         * \param &value: The value of the local particle's energy density
+         * Remove the states of all of the integration points
          */
 
-        _localParticleEnergyDensity.second = value;
-
-        _localParticleEnergyDensity.first = true;
+        std::lock_guard< std::mutex > lock( _mutex );
 
-        addLocalParticleData( &_localParticleEnergyDensity );
+        _entries.clear( );
 
     }
 
-    const floatType* aspBase::getLocalParticleEnergyDensity( ){
+    unsigned int integrationPointStateCache::size( ){
         /*!
-         * Get the local particle's energy density
+         * Get the number of integration points with a state
          */
 
-        if ( !_localParticleEnergyDensity.first ){
-
-            ERROR_TOOLS_CATCH( setLocalParticleQuantities( ) );
-
-        }
+        std::lock_guard< std::mutex > lock( _mutex );
 
-        return &_localParticleEnergyDensity.second;
+        return _entries.size( );
 
     }
 
-    void aspBase::setLocalParticleLogProbabilityRatio( const floatType &value ){
+    void integrationPointStateCache::writeCheckpoint( const std::string &filename ){
         /*!
-         * Set the local particle's log-probability ratio (i.e. the change in
-         * the local particle's energy log probability (log(p_current) - log(p_previous))
+         * Write a binary checkpoint of the committed states of all of the integration points. Trial states are not stored
+         * so the trial states of a converged increment must be committed first.
          * 
-         * \param &value: The value of the change in log probability.
+         * \param &filename: The name of the checkpoint file
          */
 
-        _localParticleLogProbabilityRatio.second = value;
+        std::lock_guard< std::mutex > lock( _mutex );
 
-        _localParticleLogProbabilityRatio.first = true;
+        checkpointWriter writer( filename, INTEGRATION_POINT_STATE_CHECKPOINT );
 
-        addLocalParticleData( &_localParticleLogProbabilityRatio );
+        writer.writeValue( _entries.size( ) );
 
-    }
+        for ( auto e = _entries.begin( ); e != _entries.end( ); e++ ){
 
-    const floatType* aspBase::getLocalParticleLogProbabilityRatio( ){
-        /*!
-         * Get the local particle's log probability ratio
-         */
+            writer.writeArray( std::vector< int >( { e->first.first, e->first.second } ) );
 
-        if ( !_localParticleLogProbabilityRatio.first ){
+            writer.writeNestedArray( e->second.committed.localParticleNeighbors );
 
-            ERROR_TOOLS_CATCH( setLocalParticleQuantities( ) );
+            writer.writeArray( e->second.committed.referenceSurfacePoints );
+
+            writer.writeArray( e->second.committed.overlapSolutions );
+
+            writer.writeArray( e->second.committed.deformation );
 
         }
 
-        return &_localParticleLogProbabilityRatio.second;
+        writer.close( );
 
     }
 
-    void aspBase::setLocalParticleMicroCauchyStress( const floatVector &value ){
+    void integrationPointStateCache::readCheckpoint( const std::string &filename ){
         /*!
-         * Set the local particle's value of the micro Cauchy stress
+         * Replace the states of all of the integration points with the committed states stored by writeCheckpoint, e.g.
+         * when an analysis is restarted. The cache is left unchanged if the checkpoint can't be read.
          * 
-         * \param &value: The value of the micro-cauchy stress
+         * \param &filename: The name of the checkpoint file
          */
 
-        _localParticleMicroCauchyStress.second = value;
+        std::map< std::pair< int, int >, entry > entries;
 
-        _localParticleMicroCauchyStress.first = true;
+        checkpointReader reader( filename, INTEGRATION_POINT_STATE_CHECKPOINT );
 
-        addLocalParticleData( &_localParticleMicroCauchyStress );
+        const uint64_t numEntries = reader.readValue( );
 
-    }
+        std::vector< int > key;
 
-    const floatVector* aspBase::getLocalParticleMicroCauchyStress( ){
-        /*!
-         * Get the local particle's micro cauchy stress
-         */
+        for ( uint64_t i = 0; i < numEntries; i++ ){
 
-        if ( !_localParticleMicroCauchyStress.first ){
+            reader.readArray( key );
 
-            ERROR_TOOLS_CATCH( setLocalParticleQuantities( ) );
+            if ( key.size( ) != 2 ){
+
+                throw std::runtime_error( "The checkpoint is corrupted" );
+
+            }
+
+            integrationPointState &state = entries[ std::make_pair( key[ 0 ], key[ 1 ] ) ].committed;
+
+            reader.readNestedArray( state.localParticleNeighbors );
+
+            reader.readArray( state.referenceSurfacePoints );
+
+            reader.readArray( state.overlapSolutions );
+
+            reader.readArray( state.deformation );
 
         }
 
-        return &_localParticleMicroCauchyStress.second;
+        std::lock_guard< std::mutex > lock( _mutex );
+
+        std::swap( _entries, entries );
 
     }
 
-    void aspBase::setLocalParticleStateVariables( const floatVector &value ){
+    integrationPointStateCache &getIntegrationPointStateCache( ){
         /*!
-         * Set the local particle's state variables
-         * 
-         * \param &value: The value of the local particle's state variables
+         * Get the integration point state cache of the process. The cache lives as long as the UMAT shared library so that
+         * the states are retained between increments. The Abaqus interfaces request the trial state of each integration
+         * point, which records the deformation gradient of the call, and roll the trial state back whenever a smaller time
+         * increment is requested (PNEWDT < 1). The trial states are committed by UEXTERNALDB at the end of each increment.
          */
 
-        _localParticleStateVariables.second = value;
-
-        _localParticleStateVariables.first = true;
+        static integrationPointStateCache cache;
 
-        addLocalParticleData( &_localParticleStateVariables );
+        return cache;
 
     }
 
-    const floatVector* aspBase::getLocalParticleStateVariables( ){
+    void columnToRowMajor( const double *columnMajor, const int &nRows, const int &nCols, floatMatrix &rowMajor ){
         /*!
-         * Get the local particle's state variables
+         * Convert a column major Fortran array to a row major matrix. The storage of the matrix is re-used if it
+         * already has the correct shape.
+         * 
+         * \param *columnMajor: The pointer to the start of the column major array
+         * \param &nRows: The number of rows
+         * \param &nCols: The number of columns
+         * \param &rowMajor: The resulting row major matrix
          */
 
-        if ( !_localParticleStateVariables.first ){
+        rowMajor.resize( nRows );
 
-            ERROR_TOOLS_CATCH( setLocalParticleQuantities( ) );
+        for ( int row = 0; row < nRows; row++ ){
 
-        }
+            rowMajor[ row ].resize( nCols );
 
-        return &_localParticleStateVariables.second;
+            for ( int col = 0; col < nCols; col++ ){
 
-    }
+                rowMajor[ row ][ col ] = columnMajor[ nRows * col + row ];
 
-    const floatType* aspBase::getPreviousTime( ){
-        /*!
-         * Get the previous value of the time
-         */
+            }
 
-        return &_previousTime;
+        }
 
     }
-    
-    const floatType* aspBase::getDeltaTime( ){
-        /*!
-         * Get the change in time
-         */
 
-        return &_deltaTime;
+    namespace{
 
-    }
+        void checkAbaqusInterfaceSizes( const int &NSTATV, const int &NPROPS, const std::string &function ){
+            /*!
+             * Check the number of state variables and material constants passed to an Abaqus interface against the asp
+             * expectations
+             * 
+             * \param &NSTATV: The number of state variables
+             * \param &NPROPS: The number of material constants
+             * \param &function: The name of the interface which is reported in the error messages
+             */
 
-    const floatType* aspBase::getPreviousTemperature( ){
-        /*!
-         * Get the previous value of the temperature
-         */
+            //Provide a variable string message for error nodes
+            std::ostringstream message;
 
-        return &_previousTemperature;
+            //Verify number of state variables against asp expectations
+            if ( NSTATV != nStateVariables ){
+                message << "ERROR:" << __FILENAME__ << "." << function << ": The asp Abaqus interface requires exactly "
+                    << nStateVariables << " state variables. Found " << NSTATV << ".";
+                throw std::runtime_error( message.str( ) );
+            }
 
-    }
-    
-    const floatType* aspBase::getTemperature( ){
-        /*!
-         * Get the current temperature
-         */
+            //Verify number of material parameters against asp expectations
+            if ( NPROPS != nMaterialParameters ){
+                message << "ERROR:" << __FILENAME__ << "." << function << ": The asp Abaqus interface requires exactly "
+                    << nMaterialParameters << " material constants. Found " << NPROPS << ".";
+                throw std::runtime_error( message.str( ) );
+            }
 
-        return &_temperature;
+        }
 
-    }
+        template< class materialModel >
+        void evaluateAbaqusMaterialModel( const materialModel &model, const double *TIME, const double &DTIME, const double *DFGRD0,
+                                          const double *DFGRD1, const int &NOEL, const int &NPT, const int &KINC, double &PNEWDT ){
+            /*!
+             * Call the material model of an Abaqus UMAT interface. The trial state of the integration point is requested
+             * before the call and records the deformation gradient at the end of the increment. If the point has an asp
+             * model its deformation measures are set from the deformation gradients so that the equilibrium iterations
+             * which don't change the deformation re-use the assembled quantities. The micro deformation of a classical
+             * continuum follows the deformation gradient and has no spatial gradient.
+             * 
+             * A failure of a solver to converge requests a smaller time increment rather than terminating the analysis and
+             * the persistent state of the integration point is discarded whenever a smaller time increment is requested.
+             * 
+             * \param &model: The function which calls the c++ material model
+             * \param *TIME: The time vector at the beginning of the increment = {Step time, Total time}
+             * \param &DTIME: The time increment
+             * \param *DFGRD0: The column major deformation gradient at the beginning of the increment
+             * \param *DFGRD1: The column major deformation gradient at the end of the increment
+             * \param &NOEL: The element number
+             * \param &NPT: The integration point number
+             * \param &KINC: The increment number
+             * \param &PNEWDT: The ratio of the suggested new time increment to the current time increment
+             */
+
+            //Get the state retained for the increment by the integration point
+            integrationPointState &state = getIntegrationPointStateCache( ).getTrialState( NOEL, NPT, TIME[ 1 ], DTIME );
+
+            state.deformation.resize( spatialDimensions * spatialDimensions );
+
+            for ( int i = 0; i < spatialDimensions; i++ ){
+
+                for ( int j = 0; j < spatialDimensions; j++ ){
+
+                    state.deformation[ spatialDimensions * i + j ] = DFGRD1[ spatialDimensions * j + i ];
 
-    const floatType* aspBase::getLocalParticleReferenceVolume( ){
-        /*!
-         * Get the reference configuration volume for the local particle
-         */ 
+                }
 
-        if ( !_localParticleReferenceVolume.first ){
+            }
 
-            ERROR_TOOLS_CATCH( setLocalParticleReferenceVolume( ) );
+            if ( state.model ){
 
-        }
+                floatVector previousDeformation( spatialDimensions * spatialDimensions );
 
-        return &_localParticleReferenceVolume.second;
+                for ( int i = 0; i < spatialDimensions; i++ ){
+
+                    for ( int j = 0; j < spatialDimensions; j++ ){
+
+                        previousDeformation[ spatialDimensions * i + j ] = DFGRD0[ spatialDimensions * j + i ];
+
+                    }
+
+                }
+
+                const floatVector gradientMicroDeformation( spatialDimensions * spatialDimensions * spatialDimensions, 0 );
+
+                state.model->setDeformation( previousDeformation, previousDeformation, gradientMicroDeformation,
+                                             state.deformation, state.deformation, gradientMicroDeformation );
+
+            }
+
+            //Call the constitutive model c++ interface
+            if ( KINC == 1 && NOEL == 1 && NPT == 1 ){
+                try{
+                    model( );
+                }
+                catch( std::exception &e ){
+
+                    //Request a smaller time increment rather than terminating the analysis if a solver failed to converge
+                    if ( isConvergenceError( e ) ){
+
+                        PNEWDT = std::fmin( PNEWDT, convergenceCutbackRatio );
+
+                    }
+
+                    if ( tardigradeVectorTools::fuzzyEquals( PNEWDT, 1. ) ){
+
+                        throw;
+
+                    }
+
+                }
+            }
+
+            //Discard the persistent state of the increment if Abaqus will cut back the time increment
+            if ( PNEWDT < 1 ){
+                getIntegrationPointStateCache( ).rollback( NOEL, NPT );
+            }
+
+        }
 
     }
 
-    void aspBase::setLocalParticleReferenceVolume( ){
+    void abaqusInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
+                          double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
+                          const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
+                          const double &DTEMP,  const double *PREDEF, const double *DPRED,  const char *CMNAME,   const int &NDI,
+                          const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
+                          const double *COORDS, const double *DROT,   double &PNEWDT,       const double &CELENT, const double *DFGRD0,
+                          const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
+                          const int *JSTEP,     const int &KINC ){
         /*!
-         * Set the reference configuration volume for the local particle
-         */ 
+         * A template Abaqus UMAT c++ interface that performs Fortran to C++ type conversions, calculates the material
+         * model's expected input, handles tensor shape changes, and calls a c++ material model.
+         * 
+         * The interface is reentrant. Each calling thread uses its own abaqusInterfaceWorkspace which is re-used
+         * between the calls made by that thread.
+         */
 
-        const floatType* localReferenceRadius;
-        ERROR_TOOLS_CATCH( localReferenceRadius = getLocalReferenceRadius( ) );
+        thread_local abaqusInterfaceWorkspace workspace;
 
-        floatType localParticleReferenceVolume;
+        abaqusInterface( STRESS, STATEV, DDSDDE,    SSE,    SPD,
+                            SCD,    RPL, DDSDDT, DRPLDE, DRPLDT,
+                          STRAN, DSTRAN,   TIME,  DTIME,   TEMP,
+                          DTEMP, PREDEF,  DPRED, CMNAME,    NDI,
+                           NSHR,  NTENS, NSTATV,  PROPS, NPROPS,
+                         COORDS,   DROT, PNEWDT, CELENT, DFGRD0,
+                         DFGRD1,   NOEL,    NPT,  LAYER,   KSPT,
+                          JSTEP,   KINC, workspace );
 
-        localParticleReferenceVolume = 4./3 * _pi * std::pow( *localReferenceRadius, 3 );
+    }
 
-        setLocalParticleReferenceVolume( localParticleReferenceVolume );
+    void abaqusInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
+                          double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
+                          const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
+                          const double &DTEMP,  const double *PREDEF, const double *DPRED,  const char *CMNAME,   const int &NDI,
+                          const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
+                          const double *COORDS, const double *DROT,   double &PNEWDT,       const double &CELENT, const double *DFGRD0,
+                          const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
+                          const int *JSTEP,     const int &KINC,      abaqusInterfaceWorkspace &workspace ){
+        /*!
+         * A template Abaqus UMAT c++ interface that performs Fortran to C++ type conversions, calculates the material
+         * model's expected input, handles tensor shape changes, and calls a c++ material model.
+         * 
+         * The conversions are stored in the provided workspace. The only shared state which is modified is the state of the
+         * integration point in the integration point state cache so it may be called concurrently as long as each
+         * concurrent call uses a different workspace and integration point.
+         * 
+         * \param &workspace: The scratch buffers for the Fortran to C++ type conversions
+         */
 
-        return;
+        checkAbaqusInterfaceSizes( NSTATV, NPROPS, __func__ );
+
+        //Map FORTRAN UMAT variables to C++ types as necessary. Use case sensitivity to distinguish.
+        //TODO: Decide if case sensitive variable names is a terrible idea or not
+        //Vectors can be assigned directly with pointer arithmetic which re-uses the workspace storage
+        floatVector &stress = workspace.stress;
+        floatVector &statev = workspace.statev;
+        floatVector &ddsddt = workspace.ddsddt;
+        floatVector &drplde = workspace.drplde;
+        stress.assign( STRESS, STRESS + NTENS );
+        statev.assign( STATEV, STATEV + NSTATV );
+        ddsddt.assign( DDSDDT, DDSDDT + NTENS );
+        drplde.assign( DRPLDE, DRPLDE + NTENS );
+        workspace.strain.assign( STRAN, STRAN + NTENS );
+        workspace.dstrain.assign( DSTRAN, DSTRAN + NTENS );
+        workspace.time.assign( TIME, TIME + 2 );
+        workspace.predef.assign( PREDEF, PREDEF + 1 );
+        workspace.dpred.assign( DPRED, DPRED + 1 );
+        workspace.cmname = abaqusTools::FtoCString( 80, CMNAME );
+        workspace.props.assign( PROPS, PROPS + NPROPS );
+        workspace.coords.assign( COORDS, COORDS + spatialDimensions );
+        workspace.jstep.assign( JSTEP, JSTEP + 4 );
+        const floatVector &strain = workspace.strain;
+        const floatVector &dstrain = workspace.dstrain;
+        const floatVector &time = workspace.time;
+        const floatVector &predef = workspace.predef;
+        const floatVector &dpred = workspace.dpred;
+        const std::string &cmname = workspace.cmname;
+        const floatVector &props = workspace.props;
+        const floatVector &coords = workspace.coords;
+        const std::vector< int > &jstep = workspace.jstep;
+        //Fortran two-dimensional arrays require careful column to row major conversions to c++ types
+        floatMatrix &ddsdde = workspace.ddsdde;
+        columnToRowMajor( DDSDDE, NTENS, NTENS, ddsdde );
+        columnToRowMajor( DROT, spatialDimensions, spatialDimensions, workspace.drot );
+        columnToRowMajor( DFGRD0, spatialDimensions, spatialDimensions, workspace.dfgrd0 );
+        columnToRowMajor( DFGRD1, spatialDimensions, spatialDimensions, workspace.dfgrd1 );
+        const floatMatrix &drot = workspace.drot;
+        const floatMatrix &dfgrd0 = workspace.dfgrd0;
+        const floatMatrix &dfgrd1 = workspace.dfgrd1;
+
+        //Call the constitutive model c++ interface
+        evaluateAbaqusMaterialModel( [ & ]( ){
+                                         dummyMaterialModel( stress, statev,  ddsdde, SSE,    SPD,
+                                                             SCD,    RPL,     ddsddt, drplde, DRPLDT,
+                                                             strain, dstrain, time,   DTIME,  TEMP,
+                                                             DTEMP,  predef,  dpred,  cmname, NDI,
+                                                             NSHR,   NTENS,   NSTATV, props,  NPROPS,
+                                                             coords, drot,    PNEWDT, CELENT, dfgrd0,
+                                                             dfgrd1, NOEL,    NPT,    LAYER,  KSPT,
+                                                             jstep,  KINC );
+                                     }, TIME, DTIME, DFGRD0, DFGRD1, NOEL, NPT, KINC, PNEWDT );
+
+        //Re-pack C++ objects into FORTRAN memory to return values to Abaqus
+        //Scalars were passed by reference and will update correctly
+        //Vectors don't require row/column major considerations, but do require re-packing to the Fortran pointer
+        abaqusTools::rowToColumnMajor( STRESS, stress, 1, NTENS );
+        abaqusTools::rowToColumnMajor( DDSDDT, ddsddt, 1, NTENS );
+        abaqusTools::rowToColumnMajor( DRPLDE, drplde, 1, NTENS );
+        abaqusTools::rowToColumnMajor( STATEV, statev, 1, NSTATV );
+        //Arrays require vector of vector to column major conversion
+        abaqusTools::rowToColumnMajor( DDSDDE, ddsdde, NTENS, NTENS );
 
     }
 
-    void aspBase::setLocalParticleReferenceVolume( const floatType &value ){
+    void abaqusViewInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
+                              double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
+                              const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
+                              const double &DTEMP,  const double *PREDEF, const double *DPRED,  const char *CMNAME,   const int &NDI,
+                              const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
+                              const double *COORDS, const double *DROT,   double &PNEWDT,       const double &CELENT, const double *DFGRD0,
+                              const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
+                              const int *JSTEP,     const int &KINC ){
         /*!
-         * Set the reference configuration volume for the local particle
+         * An Abaqus UMAT c++ interface that passes non-owning column major views of the Fortran memory to the material
+         * model. No copies of the arrays are made and the material model writes its results directly to the Fortran
+         * memory so no re-packing is required. The interface is reentrant.
          * 
-         * \param &value: The value of the reference configuration volume of the
-         *     local particle.
+         * The arguments are the same as abaqusInterface
          */
 
-        _localParticleReferenceVolume.second = value;
-
-        _localParticleReferenceVolume.first = true;
+        checkAbaqusInterfaceSizes( NSTATV, NPROPS, __func__ );
 
-        addLocalParticleData( &_localParticleReferenceVolume );
+        //Map FORTRAN UMAT variables to non-owning views. The leading dimension of the matrices is their number of rows.
+        vectorView stress( STRESS, NTENS );
+        vectorView statev( STATEV, NSTATV );
+        vectorView ddsddt( DDSDDT, NTENS );
+        vectorView drplde( DRPLDE, NTENS );
+        const constVectorView strain( STRAN, NTENS );
+        const constVectorView dstrain( DSTRAN, NTENS );
+        const constVectorView time( TIME, 2 );
+        const constVectorView predef( PREDEF, 1 );
+        const constVectorView dpred( DPRED, 1 );
+        const std::string cmname( abaqusTools::FtoCString( 80, CMNAME ) );
+        const constVectorView props( PROPS, NPROPS );
+        const constVectorView coords( COORDS, spatialDimensions );
+        const constIntVectorView jstep( JSTEP, 4 );
+        matrixView ddsdde( DDSDDE, NTENS, NTENS, Eigen::OuterStride< >( NTENS ) );
+        const constMatrixView drot( DROT, spatialDimensions, spatialDimensions, Eigen::OuterStride< >( spatialDimensions ) );
+        const constMatrixView dfgrd0( DFGRD0, spatialDimensions, spatialDimensions, Eigen::OuterStride< >( spatialDimensions ) );
+        const constMatrixView dfgrd1( DFGRD1, spatialDimensions, spatialDimensions, Eigen::OuterStride< >( spatialDimensions ) );
 
-        return;
+        //Call the constitutive model c++ interface
+        evaluateAbaqusMaterialModel( [ & ]( ){
+                                         dummyMaterialModel( stress, statev,  ddsdde, SSE,    SPD,
+                                                             SCD,    RPL,     ddsddt, drplde, DRPLDT,
+                                                             strain, dstrain, time,   DTIME,  TEMP,
+                                                             DTEMP,  predef,  dpred,  cmname, NDI,
+                                                             NSHR,   NTENS,   NSTATV, props,  NPROPS,
+                                                             coords, drot,    PNEWDT, CELENT, dfgrd0,
+                                                             dfgrd1, NOEL,    NPT,    LAYER,  KSPT,
+                                                             jstep,  KINC );
+                                     }, TIME, DTIME, DFGRD0, DFGRD1, NOEL, NPT, KINC, PNEWDT );
 
     }
 
-    const floatType* aspBase::getLocalParticleCurrentVolume( ){
-        /*!
-         * Set the current configuration volume for the local particle
-         */ 
+    namespace{
 
-        if ( !_localParticleCurrentVolume.first ){
+        const double *offsetPointer( const double *array, const int &point ){
+            /*!
+             * Get the pointer to the value of a point in a structure of arrays. Arrays which are not provided remain NULL.
+             *
+             * \param *array: The pointer to the start of the array
+             * \param &point: The index of the point
+             */
 
-            ERROR_TOOLS_CATCH( setLocalParticleCurrentVolume( ) );
+            return array ? array + point : NULL;
 
         }
 
-        return &_localParticleCurrentVolume.second;
-
-    }
-
-    void aspBase::setLocalParticleCurrentVolume( ){
-        /*!
-         * Set the current configuration local particle volume
-         */ 
-
-        const unsigned int *dim = getDimension( );
-
-        const floatVector* microDeformation;
-        ERROR_TOOLS_CATCH( microDeformation = getLocalMicroDeformation( ) );
+        void checkBlockArray( const void *array, const int &size, const std::string &name ){
+            /*!
+             * Check that an array of a materialPointBlock with a non-zero size has been provided
+             *
+             * \param *array: The pointer to the start of the array
+             * \param &size: The number of components of each point of the array
+             * \param &name: The name of the array
+             */
 
-        const floatType* referenceVolume;
-        ERROR_TOOLS_CATCH( referenceVolume = getLocalParticleReferenceVolume( ) );
+            if ( ( size > 0 ) && !array ){
 
-        floatType J;
-        ERROR_TOOLS_CATCH( J = tardigradeVectorTools::determinant( *microDeformation, ( *dim ), ( *dim ) ) );
+                std::ostringstream message;
+                message << "ERROR:" << __FILENAME__ << "." << __func__ << ": The " << name << " array of the material point block must be provided.";
+                throw std::runtime_error( message.str( ) );
 
-        floatType currentVolume = J * ( *referenceVolume );
+            }
 
-        setLocalParticleCurrentVolume( currentVolume );
+        }
 
     }
 
-    void aspBase::setLocalParticleCurrentVolume( const floatType &value ){
-        /*!
-         * Set the current configuration local particle volume
-         * 
-         * \param &value: The current configuration local particle volume
+    materialPointView::materialPointView( const materialPointBlock &block, const int &point ) :
+        coords( offsetPointer( block.coordMp, point ), spatialDimensions, Eigen::InnerStride< >( block.nblock ) ),
+        strainInc( offsetPointer( block.strainInc, point ), block.ndir + block.nshr, Eigen::InnerStride< >( block.nblock ) ),
+        relSpinInc( offsetPointer( block.relSpinInc, point ), block.nshr, Eigen::InnerStride< >( block.nblock ) ),
+        stretchOld( offsetPointer( block.stretchOld, point ), block.ndir + block.nshr, Eigen::InnerStride< >( block.nblock ) ),
+        defgradOld( offsetPointer( block.defgradOld, point ), block.ndir + 2 * block.nshr, Eigen::InnerStride< >( block.nblock ) ),
+        fieldOld( offsetPointer( block.fieldOld, point ), block.nfieldv, Eigen::InnerStride< >( block.nblock ) ),
+        stressOld( offsetPointer( block.stressOld, point ), block.ndir + block.nshr, Eigen::InnerStride< >( block.nblock ) ),
+        stateOld( offsetPointer( block.stateOld, point ), block.nstatev, Eigen::InnerStride< >( block.nblock ) ),
+        stretchNew( offsetPointer( block.stretchNew, point ), block.ndir + block.nshr, Eigen::InnerStride< >( block.nblock ) ),
+        defgradNew( offsetPointer( block.defgradNew, point ), block.ndir + 2 * block.nshr, Eigen::InnerStride< >( block.nblock ) ),
+        fieldNew( offsetPointer( block.fieldNew, point ), block.nfieldv, Eigen::InnerStride< >( block.nblock ) ),
+        stressNew( block.stressNew + point, block.ndir + block.nshr, Eigen::InnerStride< >( block.nblock ) ),
+        stateNew( block.stateNew + point, block.nstatev, Eigen::InnerStride< >( block.nblock ) ),
+        charLength( block.charLength[ point ] ),
+        density( block.density[ point ] ),
+        tempOld( block.tempOld[ point ] ),
+        tempNew( block.tempNew[ point ] ),
+        enerInternOld( block.enerInternOld[ point ] ),
+        enerInelasOld( block.enerInelasOld[ point ] ),
+        enerInternNew( block.enerInternNew[ point ] ),
+        enerInelasNew( block.enerInelasNew[ point ] ){
+        /*!
+         * Form the views of a point of a block. The arrays of the block which hold a value for every point must have been
+         * provided (see abaqusBlockInterface).
+         *
+         * \param &block: The block of material points
+         * \param &point: The index of the point in the block
          */
 
-        _localParticleCurrentVolume.second = value;
-
-        _localParticleCurrentVolume.first = true;
-
-        addLocalParticleData( &_localParticleCurrentVolume );
-
     }
 
-    const floatVector* aspBase::getPreviousStateVariables( ){
+    void abaqusBlockInterface( const materialPointBlock &block, const unsigned int numThreads ){
         /*!
-         * Get the previous state variables
+         * An Abaqus VUMAT style c++ interface which evaluates the material model for a block of material points.
+         *
+         * The checks of the block, the conversion of the material name, and the views of the material constants are formed
+         * once and shared by every point of the block. Each point is then evaluated with strided views of the structure of
+         * arrays of the block (see materialPointView) so the results are written directly to the memory of the block.
+         *
+         * The points may be split into contiguous ranges which are evaluated concurrently by up to numThreads OpenMP threads.
+         * The material model must then only read from shared data. The first exception thrown by a range is re-thrown once
+         * every range has been evaluated.
+         *
+         * \param &block: The block of material points
+         * \param numThreads: The number of threads used to evaluate the points. A value of one evaluates the points serially
          */
 
-        return &_previousStateVariables;
-
-    }
+        //Provide a variable string message for error nodes
+        std::ostringstream message;
 
-    const floatVector* aspBase::getPreviousLocalStateVariables( ){
-        /*!
-         * Get the previous state variables for the local particle
-         */
+        if ( block.nblock < 0 ){
+            message << "ERROR:" << __FILENAME__ << "." << __func__ << ": The number of points in the block must not be negative. Found "
+                << block.nblock << ".";
+            throw std::runtime_error( message.str( ) );
+        }
 
-        const floatVector* previousStateVariables;
-        ERROR_TOOLS_CATCH( previousStateVariables = getPreviousStateVariables( ) );
+        checkAbaqusInterfaceSizes( block.nstatev, block.nprops, __func__ );
 
-        return previousStateVariables;
+        if ( block.nblock == 0 ){
+            return;
+        }
 
-    }
+        //Verify that the arrays of the points have been provided
+        const int nsym = block.ndir + block.nshr;
+        checkBlockArray( block.cmname, 1, "cmname" );
+        checkBlockArray( block.props, block.nprops, "props" );
+        checkBlockArray( block.coordMp, spatialDimensions, "coordMp" );
+        checkBlockArray( block.charLength, 1, "charLength" );
+        checkBlockArray( block.density, 1, "density" );
+        checkBlockArray( block.strainInc, nsym, "strainInc" );
+        checkBlockArray( block.relSpinInc, block.nshr, "relSpinInc" );
+        checkBlockArray( block.tempOld, 1, "tempOld" );
+        checkBlockArray( block.stretchOld, nsym, "stretchOld" );
+        checkBlockArray( block.defgradOld, nsym + block.nshr, "defgradOld" );
+        checkBlockArray( block.fieldOld, block.nfieldv, "fieldOld" );
+        checkBlockArray( block.stressOld, nsym, "stressOld" );
+        checkBlockArray( block.stateOld, block.nstatev, "stateOld" );
+        checkBlockArray( block.enerInternOld, 1, "enerInternOld" );
+        checkBlockArray( block.enerInelasOld, 1, "enerInelasOld" );
+        checkBlockArray( block.tempNew, 1, "tempNew" );
+        checkBlockArray( block.stretchNew, nsym, "stretchNew" );
+        checkBlockArray( block.defgradNew, nsym + block.nshr, "defgradNew" );
+        checkBlockArray( block.fieldNew, block.nfieldv, "fieldNew" );
+        checkBlockArray( block.stressNew, nsym, "stressNew" );
+        checkBlockArray( block.stateNew, block.nstatev, "stateNew" );
+        checkBlockArray( block.enerInternNew, 1, "enerInternNew" );
+        checkBlockArray( block.enerInelasNew, 1, "enerInelasNew" );
+
+        //The setup which is shared by every point of the block
+        const std::string cmname( abaqusTools::FtoCString( 80, block.cmname ) );
+        const constVectorView props( block.props, block.nprops );
+
+        unsigned int numWorkers = std::max( 1u, std::min( numThreads, ( unsigned int )block.nblock ) );
+
+        std::vector< std::exception_ptr > errors( numWorkers );
+
+#ifdef _OPENMP
+        #pragma omp parallel for num_threads( numWorkers ) schedule( static, 1 )
+#endif
+        for ( unsigned int w = 0; w < numWorkers; w++ ){
 
-    const floatVector* aspBase::getParticleParameters( ){
-        /*!
-         * Get the parameters for the internal particle computation
-         */
+            try{
 
-        return &_particleParameters;
+                const int begin = ( w * block.nblock ) / numWorkers;
 
-    }
+                const int end = ( ( w + 1 ) * block.nblock ) / numWorkers;
 
-    void aspBase::setLocalParticleParameters( ){
-        /*!
-         * Set the parameters for the local particle
-         */
+                for ( int b = begin; b < end; b++ ){
 
-        setLocalParticleParameters( *getParticleParameters( ) );
+                    materialPointView point( block, b );
 
-    }
+                    dummyMaterialModel( point, block, cmname, props );
 
-    void aspBase::setLocalParticleParameters( const floatVector &value ){
-        /*!
-         * Set the parameters for the local particle
-         * 
-         * \param &value: The current parameters for the local particle
-         */
+                }
 
-        _localParticleParameters.second = value;
+            }
+            catch( ... ){
 
-        _localParticleParameters.first = true;
+                errors[ w ] = std::current_exception( );
 
-        addLocalParticleData( &_localParticleParameters );
+            }
 
-    }
+        }
 
+        for ( auto e = errors.begin( ); e != errors.end( ); e++ ){
 
-    const floatVector* aspBase::getLocalParticleParameters( ){
-        /*!
-         * Get the local particle's parameters
-         */
+            if ( *e ){
 
-        if ( !_localParticleParameters.first ){
+                std::rethrow_exception( *e );
 
-            ERROR_TOOLS_CATCH( setLocalParticleParameters( ) );
+            }
 
         }
 
-        return &_localParticleParameters.second;
-
     }
 
-    void aspBase::assembleLocalParticles( ){
+    void dummyMaterialModel( materialPointView &point, const materialPointBlock &block, const std::string &cmname,
+                             const constVectorView &props ){
         /*!
-         * Assemble all the required quantities for the local particles
+         * A template c++ material model for a single point of a block of material points. The views of the point reference
+         * the memory of the block directly. The dummy model carries the stress, state variables, and energies of the start
+         * of the increment over to the end of the increment.
+         *
+         * \param &point: The views of the values of the point
+         * \param &block: The block of material points which holds the values shared by the points, e.g. the time increment
+         * \param &cmname: The material name
+         * \param &props: The material constants
          */
 
-        _assembledLocalParticleEnergies.second = floatVector( *getNumLocalParticles( ) );
+        point.stressNew = point.stressOld;
 
-        _assembledLocalParticleMicroCauchyStress.second = floatMatrix( *getNumLocalParticles( ) );
+        point.stateNew = point.stateOld;
 
-        _assembledLocalParticleVolumes.second = floatVector( *getNumLocalParticles( ) );
+        point.enerInternNew = point.enerInternOld;
 
-        _assembledLocalParticleLogProbabilityRatios.second = floatVector( *getNumLocalParticles( ) );
+        point.enerInelasNew = point.enerInelasOld;
 
-        for ( unsigned int i = 0; i < *getNumLocalParticles( ); i++ ){
-
-            _localIndex = i; // Set the current local index
-
-            // Quantities required for the energy calculation
-            _assembledLocalParticleEnergies.second[ i ] = *getLocalParticleEnergy( );
+    }
 
-            _assembledLocalParticleMicroCauchyStress.second[ i ] = *getLocalParticleMicroCauchyStress( );
+    namespace{
 
-            _assembledLocalParticleVolumes.second[ i ] = *getLocalParticleCurrentVolume( );
+        uint64_t splitMix64( uint64_t value ){
+            /*!
+             * The SplitMix64 finalizer which maps each 64 bit value to a statistically independent 64 bit value
+             * 
+             * \param value: The value to be mixed
+             */
 
-            _assembledLocalParticleLogProbabilityRatios.second[ i ] = *getLocalParticleLogProbabilityRatio( );
+            value += 0x9E3779B97F4A7C15ULL;
 
-            // Quantities required for the gradient calculation
+            value = ( value ^ ( value >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
 
-            // Quantities required for the Hessian calculation
+            value = ( value ^ ( value >> 27 ) ) * 0x94D049BB133111EBULL;
 
-            resetLocalParticleData( );
+            return value ^ ( value >> 31 );
 
         }
 
-        _assembledLocalParticleEnergies.first = true;
-
-        _assembledLocalParticleMicroCauchyStress.first = true;
+    }
 
-        _assembledLocalParticleVolumes.first = true;
+    counterRandomStream::counterRandomStream( const uint64_t &seed, const uint64_t &stream ){
+        /*!
+         * Construct a random stream
+         * 
+         * \param &seed: The seed shared by all of the streams of an evaluation
+         * \param &stream: The index of the stream
+         */
 
-        _assembledLocalParticleLogProbabilityRatios.first = true;
+        _key = splitMix64( seed ^ splitMix64( stream ) );
 
     }
 
-    void aspBase::assembleSurfaceResponses( ){
+    uint64_t counterRandomStream::at( const uint64_t &counter ) const{
         /*!
-         * Assemble the surface responses of the particles
+         * Get a value of the stream without advancing it
+         * 
+         * \param &counter: The index of the value in the stream
          */
 
-        const unsigned int *dim = getDimension( );
+        return splitMix64( _key ^ splitMix64( counter ) );
 
-        unsigned int numLocalParticles = *getNumLocalParticles( );
+    }
 
-        unsigned int numSurfacePoints = getUnitSpherePoints( )->size( ) / ( *dim );
+    uint64_t counterRandomStream::operator()( ){
+        /*!
+         * Draw the next value of the stream
+         */
 
-        _assembledSurfaceAdhesionEnergyDensities.second = std::vector< std::vector< floatVector > >( numLocalParticles, std::vector< floatVector >( numSurfacePoints, floatVector( numLocalParticles ) ) );
+        return at( _counter++ );
 
-        _assembledSurfaceAdhesionThicknesses.second = std::vector< std::vector< floatVector > >( numLocalParticles, std::vector< floatVector >( numSurfacePoints, floatVector( numLocalParticles ) ) );
+    }
 
-        _assembledSurfaceAdhesionTractions.second = std::vector< std::vector< floatMatrix > >( numLocalParticles, std::vector< floatMatrix >( numSurfacePoints, floatMatrix( numLocalParticles ) ) );
+    floatType counterRandomStream::uniform( ){
+        /*!
+         * Draw the next value of the stream as a uniformly distributed number in [0, 1)
+         */
 
-        _assembledSurfaceOverlapEnergyDensities.second = std::vector< std::vector< std::vector< mapFloatType > > >( numLocalParticles, std::vector< std::vector< mapFloatType > >( numSurfacePoints, std::vector< mapFloatType >( numLocalParticles ) ) );
+        // The upper 53 bits fill the mantissa of a double
+        return ( ( *this )( ) >> 11 ) * ( 1.0 / 9007199254740992.0 );
 
-        _assembledSurfaceOverlapThicknesses.second = std::vector< std::vector< std::vector< mapFloatType > > >( numLocalParticles, std::vector< std::vector< mapFloatType > >( numSurfacePoints, std::vector< mapFloatType >( numLocalParticles ) ) );
+    }
 
-        _assembledSurfaceOverlapTractions.second = std::vector< std::vector< std::vector< mapFloatVector > > >( numLocalParticles, std::vector< std::vector< mapFloatVector > >( numSurfacePoints, std::vector< mapFloatVector >( numLocalParticles ) ) );
+    namespace{
 
-        for ( unsigned int i = 0; i < *getNumLocalParticles( ); i++ ){
+        void packRealization( aspBase &realization, const unsigned int &index, ensembleResults &results ){
+            /*!
+             * Assemble the quantities of a realization and store them in the buffer of the ensemble
+             * 
+             * \param &realization: The realization to be evaluated
+             * \param &index: The index of the realization in the ensemble
+             * \param &results: The results of the ensemble whose layout has been set
+             */
 
-            _localIndex = i; // Set the current local index
+            const floatVector *energies;
+            ERROR_TOOLS_CATCH( energies = realization.getAssembledLocalParticleEnergies( ) );
 
-            for ( unsigned int j = 0; j < numSurfacePoints; j++ ){
+            const floatMatrix *microCauchyStresses;
+            ERROR_TOOLS_CATCH( microCauchyStresses = realization.getAssembledLocalParticleMicroCauchyStresses( ) );
+
+            const floatVector *logProbabilityRatios;
+            ERROR_TOOLS_CATCH( logProbabilityRatios = realization.getAssembledLocalParticleLogProbabilityRatios( ) );
 
-                _localSurfaceNodeIndex = j; // Set the local surface node index
+            // Check every array before any of them are copied so that a mismatched realization cannot write outside of its slice
+            if ( index >= results.numRealizations ){
 
-                for ( unsigned int k = 0; k < *getNumLocalParticles( ); k++ ){
+                throw std::runtime_error( "Realization " + std::to_string( index ) + " is outside of the ensemble of " + std::to_string( results.numRealizations ) + " realizations" );
 
-                    _nonLocalIndex = k; // Set the interaction index
+            }
 
-                    // Quantities required for the energy calculation
-                    _assembledSurfaceAdhesionEnergyDensities.second[ i ][ j ][ k ] = *getSurfaceAdhesionEnergyDensity( );
+            if ( energies->size( ) != results.numLocalParticles ){
 
-                    _assembledSurfaceAdhesionTractions.second[ i ][ j ][ k ] = *getSurfaceAdhesionTraction( );
+                throw std::runtime_error( "Realization " + std::to_string( index ) + " has " + std::to_string( energies->size( ) ) + " local particles but the ensemble has " + std::to_string( results.numLocalParticles ) );
 
-                    _assembledSurfaceAdhesionThicknesses.second[ i ][ j ][ k ] = *getSurfaceAdhesionThickness( );
+            }
 
-                    _assembledSurfaceOverlapEnergyDensities.second[ i ][ j ][ k ] = *getSurfaceOverlapEnergyDensity( );
+            if ( microCauchyStresses->size( ) != results.numLocalParticles ){
 
-                    _assembledSurfaceOverlapTractions.second[ i ][ j ][ k ] = *getSurfaceOverlapTraction( );
+                throw std::runtime_error( "Realization " + std::to_string( index ) + " has " + std::to_string( microCauchyStresses->size( ) ) + " micro Cauchy stresses but the ensemble has " + std::to_string( results.numLocalParticles ) + " local particles" );
 
-                    _assembledSurfaceOverlapThicknesses.second[ i ][ j ][ k ] = *getSurfaceOverlapThickness( );
+            }
 
-                    // Quantities required for the gradient calculation
+            for ( auto stress = microCauchyStresses->begin( ); stress != microCauchyStresses->end( ); stress++ ){
 
-                    // Quantities required for the Hessian calculation
+                if ( stress->size( ) != results.stressSize ){
 
-                    resetInteractionPairData( );
+                    throw std::runtime_error( "The micro Cauchy stresses of realization " + std::to_string( index ) + " have " + std::to_string( stress->size( ) ) + " components but the ensemble has " + std::to_string( results.stressSize ) );
 
                 }
 
-                resetSurfacePointData( );
-
             }
 
-            resetLocalParticleData( );
+            if ( logProbabilityRatios->size( ) != results.numLocalParticles ){
 
-        }
+                throw std::runtime_error( "Realization " + std::to_string( index ) + " has " + std::to_string( logProbabilityRatios->size( ) ) + " log probability ratios but the ensemble has " + std::to_string( results.numLocalParticles ) + " local particles" );
 
-        _assembledSurfaceAdhesionEnergyDensities.first = true;
+            }
 
-        _assembledSurfaceAdhesionTractions.first = true;
+            if ( results.values.size( ) < ( index + 1 ) * results.getRealizationSize( ) ){
 
-        _assembledSurfaceAdhesionThicknesses.first = true;
+                throw std::runtime_error( "The buffer of the ensemble has " + std::to_string( results.values.size( ) ) + " values which cannot hold realization " + std::to_string( index ) );
 
-        _assembledSurfaceOverlapEnergyDensities.first = true;
+            }
 
-        _assembledSurfaceOverlapTractions.first = true;
+            floatType *values = results.values.data( ) + index * results.getRealizationSize( );
 
-        _assembledSurfaceOverlapThicknesses.first = true;
+            values = std::copy( energies->begin( ), energies->end( ), values );
 
-    }
+            for ( auto stress = microCauchyStresses->begin( ); stress != microCauchyStresses->end( ); stress++ ){
 
-    const floatVector* aspBase::getAssembledLocalParticleEnergies( ){
-        /*!
-         * Get the assembled local particle energies
-         */
+                values = std::copy( stress->begin( ), stress->end( ), values );
 
-        if ( !_assembledLocalParticleEnergies.first ){
+            }
 
-            ERROR_TOOLS_CATCH( assembleLocalParticles( ) );
+            std::copy( logProbabilityRatios->begin( ), logProbabilityRatios->end( ), values );
 
         }
 
-        return &_assembledLocalParticleEnergies.second;
-
     }
 
-    const floatMatrix* aspBase::getAssembledLocalParticleMicroCauchyStresses( ){
+    void evaluateEnsemble( const unsigned int &numRealizations, const realizationFactory &createRealization, const uint64_t &seed,
+                           ensembleResults &results, const unsigned int numThreads ){
         /*!
-         * Get the assembled local particle micro Cauchy stress
+         * Evaluate an ensemble of independent realizations, e.g. of the particle configurations of a material point, and store
+         * their assembled local particle energies, micro Cauchy stresses and log probability ratios in a single buffer.
+         * 
+         * Each realization is created by createRealization with its own counterRandomStream formed from the seed and the index
+         * of the realization. The results therefore do not depend on the number of threads. Every realization must have the
+         * same number of local particles and micro Cauchy stress components as the first.
+         * 
+         * \param &numRealizations: The number of realizations
+         * \param &createRealization: The function which creates the configured realization of a given index from its random stream
+         * \param &seed: The seed of the ensemble
+         * \param &results: The results of the ensemble
+         * \param numThreads: The number of threads the realizations are split between when OpenMP is available
          */
 
-        if ( !_assembledLocalParticleMicroCauchyStress.first ){
+        results.numRealizations = numRealizations;
 
-            ERROR_TOOLS_CATCH( assembleLocalParticles( ) );
+        if ( numRealizations == 0 ){
 
-        }
+            results.numLocalParticles = 0;
 
-        return &_assembledLocalParticleMicroCauchyStress.second;
+            results.stressSize = 0;
 
-    }
+            results.values.clear( );
 
-    const floatVector* aspBase::getAssembledLocalParticleVolumes( ){
-        /*!
-         * Get the assembled local particle volumes
-         */
+            return;
 
-        if ( !_assembledLocalParticleVolumes.first ){
+        }
 
-            ERROR_TOOLS_CATCH( assembleLocalParticles( ) );
+        // The first realization determines the layout of the buffer
+        counterRandomStream firstStream( seed, 0 );
 
-        }
+        std::unique_ptr< aspBase > first;
+        ERROR_TOOLS_CATCH( first = createRealization( 0, firstStream ) );
 
-        return &_assembledLocalParticleVolumes.second;
+        if ( !first ){
 
-    }
+            throw std::runtime_error( "The realization factory did not create realization 0" );
 
-    const floatVector* aspBase::getAssembledLocalParticleLogProbabilityRatios( ){
-        /*!
-         * Get the assembled local particle log probability ratios
-         */
+        }
 
-        if ( !_assembledLocalParticleLogProbabilityRatios.first ){
+        const floatMatrix *firstStresses;
+        ERROR_TOOLS_CATCH( firstStresses = first->getAssembledLocalParticleMicroCauchyStresses( ) );
 
-            ERROR_TOOLS_CATCH( assembleLocalParticles( ) );
+        results.numLocalParticles = firstStresses->size( );
 
-        }
+        results.stressSize = ( firstStresses->size( ) > 0 ) ? ( *firstStresses )[ 0 ].size( ) : 0;
 
-        return &_assembledLocalParticleLogProbabilityRatios.second;
+        results.values.resize( numRealizations * results.getRealizationSize( ) );
 
-    }
+        ERROR_TOOLS_CATCH( packRealization( *first, 0, results ) );
 
-    /** \brief Define required number of Abaqus material constants for the Abaqus interface. */
-    const int nStateVariables = 2;
+        first.reset( );
 
-    /** \brief Define required number of Abaqus material constants for the Abaqus interface. */
-    const int nMaterialParameters = 2;
+        std::vector< std::exception_ptr > errors( numRealizations );
 
-    /// Say hello
-    /// @param message The message to print
-    void sayHello( std::string message ) {
-        TARDIGRADE_ERROR_TOOLS_CHECK( message.compare( "George" ) != 0, "ERROR: George is a wolf in sheep's clothing!" );
-        std::cout << "Hello " << message << std::endl;
-        return NULL;
-    }
+#ifdef _OPENMP
+        #pragma omp parallel for num_threads( std::max( 1u, numThreads ) ) schedule( dynamic )
+#endif
+        for ( unsigned int r = 1; r < numRealizations; r++ ){
 
-    void dummyMaterialModel( floatVector &stress,             floatVector &statev,        floatMatrix &ddsdde,       floatType &SSE,            floatType &SPD,
-                             floatType &SCD,                  floatType &RPL,             floatVector &ddsddt,       floatVector &drplde,       floatType &DRPLDT,
-                             const floatVector &strain,       const floatVector &dstrain, const floatVector &time,   const floatType &DTIME,    const floatType &TEMP,
-                             const floatType &DTEMP,          const floatVector &predef,  const floatVector &dpred,  const std::string &cmname, const int &NDI,
-                             const int &NSHR,                 const int &NTENS,           const int &NSTATV,         const floatVector &props,  const int &NPROPS,
-                             const floatVector &coords,       const floatMatrix &drot,    floatType &PNEWDT,         const floatType &CELENT,   const floatMatrix &dfgrd0,
-                             const floatMatrix &dfgrd1,       const int &NOEL,            const int &NPT,            const int &LAYER,          const int &KSPT,
-                             const std::vector< int > &jstep, const int &KINC ){
-        /*!
-         * A template Abaqus c++ UMAT using c++ STL types. Variables in all caps reference ABAQUS FORTRAN
-         * memory directly. Variables in lower case are native c++ type conversions stored separately from the original
-         * ABAQUS FORTRAN memory.
-         */
+            try{
 
-        //Call functions of constitutive model to do things
-        TARDIGRADE_ERROR_TOOLS_CATCH( sayHello( "Abaqus" ) );
+                counterRandomStream stream( seed, r );
 
-        return void;
-    }
+                std::unique_ptr< aspBase > realization = createRealization( r, stream );
 
-    void abaqusInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
-                          double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
-                          const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
-                          const double &DTEMP,  const double *PREDEF, const double *DPRED,  const char *CMNAME,   const int &NDI,
-                          const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
-                          const double *COORDS, const double *DROT,   double &PNEWDT,       const double &CELENT, const double *DFGRD0,
-                          const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
-                          const int *JSTEP,     const int &KINC ){
-        /*!
-         * A template Abaqus UMAT c++ interface that performs Fortran to C++ type conversions, calculates the material
-         * model's expected input, handles tensor shape changes, and calls a c++ material model.
-         */
+                if ( !realization ){
 
-        //Provide a variable string message for error nodes
-        std::ostringstream message;
+                    throw std::runtime_error( "The realization factory did not create realization " + std::to_string( r ) );
 
-        //Map FORTRAN UMAT variables to C++ types as necessary. Use case sensitivity to distinguish.
-        //TODO: Decide if case sensitive variable names is a terrible idea or not
-        //Vectors can be created directly with pointer arithmetic
-        std::vector< double > stress( STRESS, STRESS + NTENS );
-        std::vector< double > statev( STATEV, STATEV + NSTATV );
-        std::vector< double > ddsddt( DDSDDT, DDSDDT + NTENS );
-        std::vector< double > drplde( DRPLDE, DRPLDE + NTENS );
-        const std::vector< double > strain( STRAN, STRAN + NTENS );
-        const std::vector< double > dstrain( DSTRAN, DSTRAN + NTENS );
-        const std::vector< double > time( TIME, TIME + 2 );
-        const std::vector< double > predef( PREDEF, PREDEF + 1 );
-        const std::vector< double > dpred( DPRED, DPRED + 1 );
-        const std::string cmname( abaqusTools::FtoCString( 80, CMNAME ) );
-        const std::vector< double > props( PROPS, PROPS + NPROPS );
-        const std::vector< double > coords( COORDS, COORDS + spatialDimensions );
-        const std::vector< int > jstep( JSTEP, JSTEP + 4 );
-        //Fortran two-dimensional arrays require careful column to row major conversions to c++ types
-        std::vector< std::vector< double > > ddsdde = abaqusTools::columnToRowMajor( DDSDDE, NTENS, NTENS );
-        const std::vector< std::vector< double > > drot = abaqusTools::columnToRowMajor( DROT, spatialDimensions, spatialDimensions );
-        const std::vector< std::vector< double > > dfgrd0 = abaqusTools::columnToRowMajor( DFGRD0, spatialDimensions, spatialDimensions );
-        const std::vector< std::vector< double > > dfgrd1 = abaqusTools::columnToRowMajor( DFGRD1, spatialDimensions, spatialDimensions );
-
-        //Verify number of state variables against asp expectations
-        if ( statev.size( ) != nStateVariables ){
-            message.clear();
-            message << "ERROR:" << __FILENAME__ << "." << __func__ << ": The asp Abaqus interface requires exactly "
-                << nStateVariables << " state variables. Found " << statev.size( ) << ".";
-            throw std::runtime_error( message.str( ) );
-        }
+                }
 
-        //Verify number of material parameters against asp expectations
-        if ( props.size( ) != nMaterialParameters ){
-            message.clear();
-            message << "ERROR:" << __FILENAME__ << "." << __func__ << ": The asp Abaqus interface requires exactly "
-                << nMaterialParameters << " material constants. Found " << props.size( ) << ".";
-            throw std::runtime_error( message.str( ) );
-        }
+                packRealization( *realization, r, results );
+
+            }
+            catch( ... ){
+
+                errors[ r ] = std::current_exception( );
 
-        //Call the constitutive model c++ interface
-        if ( KINC == 1 && NOEL == 1 && NPT == 1 ){
-            try{
-                dummyMaterialModel( stress, statev,  ddsdde, SSE,    SPD,
-                                    SCD,    RPL,     ddsddt, drplde, DRPLDT,
-                                    strain, dstrain, time,   DTIME,  TEMP,
-                                    DTEMP,  predef,  dpred,  cmname, NDI,
-                                    NSHR,   NTENS,   NSTATV, props,  NPROPS,
-                                    coords, drot,    PNEWDT, CELENT, dfgrd0,
-                                    dfgrd1, NOEL,    NPT,    LAYER,  KSPT,
-                                    jstep,  KINC );
             }
-            catch(std::exception e){
 
-                if ( tardigradeVectorTools::fuzzyEquals( PNEWDT, 1. ) ){
+        }
 
-                    throw e;
+        for ( auto e = errors.begin( ); e != errors.end( ); e++ ){
 
-                }
+            if ( *e ){
+
+                ERROR_TOOLS_CATCH( std::rethrow_exception( *e ) );
 
             }
-        }
 
-        //Re-pack C++ objects into FORTRAN memory to return values to Abaqus
-        //Scalars were passed by reference and will update correctly
-        //Vectors don't require row/column major considerations, but do require re-packing to the Fortran pointer
-        abaqusTools::rowToColumnMajor( STRESS, stress, 1, NTENS );
-        abaqusTools::rowToColumnMajor( DDSDDT, ddsddt, 1, NTENS );
-        abaqusTools::rowToColumnMajor( DRPLDE, drplde, 1, NTENS );
-        abaqusTools::rowToColumnMajor( STATEV, statev, 1, NSTATV );
-        //Arrays require vector of vector to column major conversion
-        abaqusTools::rowToColumnMajor( DDSDDE, ddsdde, NTENS, NTENS );
+        }
 
     }
 
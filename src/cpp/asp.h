@@ -10,12 +10,35 @@
 #define ASP_H
 
 #include<sstream>
+#include<map>
+#include<functional>
+#include<algorithm>
+#include<memory>
+#include<exception>
+#include<typeinfo>
+#include<tuple>
+#include<stdexcept>
+#include<mutex>
+#include<array>
+#include<chrono>
+#include<type_traits>
+#include<cstdint>
+#include<limits>
+#include<cmath>
 
 #include<error_tools.h>
 #define USE_EIGEN
 #include<vector_tools.h>
 #include<abaqus_tools.h>
 
+#ifdef ASP_FAST_ERROR_HANDLING
+//! Remove the exception context frames from the inner loops. Exceptions still propagate but without the nested context.
+#undef ERROR_TOOLS_CATCH
+#define ERROR_TOOLS_CATCH( expr ) { expr; }
+#undef TARDIGRADE_ERROR_TOOLS_CATCH
+#define TARDIGRADE_ERROR_TOOLS_CATCH( expr ) { expr; }
+#endif
+
 namespace asp{
 
     namespace unit_test{
@@ -58,16 +81,426 @@ namespace asp{
     typedef double floatType; //!< Define the float values type.
     typedef std::vector< floatType > floatVector; //!< Define a vector of floats
     typedef std::vector< std::vector< floatType > > floatMatrix; //!< Define a matrix of floats
-    typedef std::unordered_map< unsigned int, floatType > mapFloatType; //!< Define an unordered map of floats
-    typedef std::unordered_map< unsigned int, floatVector > mapFloatVector; //!< Define an unordered map of float vectors
-    typedef std::unordered_map< unsigned int, floatMatrix > mapFloatMatrix; //!< Define an unordered map of float matrices
 
-    floatType _pi = 3.14159265;
+#ifdef ASP_SINGLE_PRECISION_BROAD_PHASE
+    typedef float broadPhaseFloatType; //!< Define the float values type of the overlap candidate culling
+#else
+    typedef floatType broadPhaseFloatType; //!< Define the float values type of the overlap candidate culling
+#endif
+    typedef std::vector< broadPhaseFloatType > broadPhaseFloatVector; //!< Define a vector of the floats of the overlap candidate culling
+
+    template < typename T >
+    class flatMap{
+        /*!
+         * A map from small unsigned integer keys to values stored as a flat vector of pairs sorted by key. The
+         * interface mirrors the subset of std::unordered_map used by asp. Iteration is in order of increasing key.
+         * Clearing the map keeps its storage so that re-populating it does not allocate.
+         */
+
+        public:
+
+            typedef unsigned int key_type; //!< The type of the keys
+
+            typedef T mapped_type; //!< The type of the values
+
+            typedef std::pair< unsigned int, T > value_type; //!< The type of the stored key value pairs
+
+            typedef typename std::vector< value_type >::iterator iterator; //!< The iterator type
+
+            typedef typename std::vector< value_type >::const_iterator const_iterator; //!< The constant iterator type
+
+            flatMap( ){ }
+
+            flatMap( std::initializer_list< value_type > values ){
+                /*!
+                 * Construct the map from a list of key value pairs. As for std::unordered_map, only the first
+                 * occurrence of a repeated key is stored.
+                 *
+                 * \param values: The key value pairs
+                 */
+
+                _values.reserve( values.size( ) );
+
+                for ( auto v = values.begin( ); v != values.end( ); v++ ){
+
+                    insert( *v );
+
+                }
+
+            }
+
+            iterator begin( ){ return _values.begin( ); }
+
+            iterator end( ){ return _values.end( ); }
+
+            const_iterator begin( ) const{ return _values.begin( ); }
+
+            const_iterator end( ) const{ return _values.end( ); }
+
+            const_iterator cbegin( ) const{ return _values.cbegin( ); }
+
+            const_iterator cend( ) const{ return _values.cend( ); }
+
+            std::size_t size( ) const{ return _values.size( ); }
+
+            bool empty( ) const{ return _values.empty( ); }
+
+            void clear( ){ _values.clear( ); }
+
+            void reserve( const std::size_t &n ){ _values.reserve( n ); }
+
+            iterator find( const unsigned int &key ){
+                /*!
+                 * Find the entry with the given key
+                 *
+                 * \param &key: The key to search for
+                 */
+
+                iterator position = lowerBound( key );
+
+                if ( ( position != _values.end( ) ) && ( position->first == key ) ){
+
+                    return position;
+
+                }
+
+                return _values.end( );
+
+            }
+
+            const_iterator find( const unsigned int &key ) const{
+                /*!
+                 * Find the entry with the given key
+                 *
+                 * \param &key: The key to search for
+                 */
+
+                const_iterator position = std::lower_bound( _values.begin( ), _values.end( ), key, compareKey );
+
+                if ( ( position != _values.end( ) ) && ( position->first == key ) ){
+
+                    return position;
+
+                }
+
+                return _values.end( );
+
+            }
+
+            std::size_t count( const unsigned int &key ) const{
+                /*!
+                 * Return the number of entries with the given key
+                 *
+                 * \param &key: The key to search for
+                 */
+
+                return ( find( key ) != _values.end( ) ) ? 1 : 0;
+
+            }
+
+            std::pair< iterator, bool > insert( const value_type &value ){
+                /*!
+                 * Insert a key value pair if the key isn't already in the map. Inserting keys in increasing order
+                 * appends to the end of the storage.
+                 *
+                 * \param &value: The key value pair
+                 */
+
+                iterator position = lowerBound( value.first );
+
+                if ( ( position != _values.end( ) ) && ( position->first == value.first ) ){
+
+                    return { position, false };
+
+                }
+
+                return { _values.insert( position, value ), true };
+
+            }
+
+            template< typename... Args >
+            std::pair< iterator, bool > emplace( const unsigned int &key, Args&&... args ){
+                /*!
+                 * Construct a value in place if the key isn't already in the map
+                 *
+                 * \param &key: The key of the value
+                 * \param args: The arguments for the construction of the value
+                 */
+
+                iterator position = lowerBound( key );
+
+                if ( ( position != _values.end( ) ) && ( position->first == key ) ){
+
+                    return { position, false };
+
+                }
+
+                return { _values.emplace( position, std::piecewise_construct, std::forward_as_tuple( key ), std::forward_as_tuple( std::forward< Args >( args )... ) ), true };
+
+            }
+
+            T &operator[]( const unsigned int &key ){
+                /*!
+                 * Return a reference to the value with the given key. A default value is inserted if the key isn't
+                 * in the map.
+                 *
+                 * \param &key: The key of the value
+                 */
+
+                return emplace( key ).first->second;
+
+            }
+
+            T &at( const unsigned int &key ){
+                /*!
+                 * Return a reference to the value with the given key
+                 *
+                 * \param &key: The key of the value
+                 */
+
+                iterator position = find( key );
+
+                if ( position == _values.end( ) ){
+
+                    throw std::out_of_range( "The key " + std::to_string( key ) + " is not in the map" );
+
+                }
+
+                return position->second;
+
+            }
+
+            const T &at( const unsigned int &key ) const{
+                /*!
+                 * Return a constant reference to the value with the given key
+                 *
+                 * \param &key: The key of the value
+                 */
+
+                const_iterator position = find( key );
+
+                if ( position == _values.end( ) ){
+
+                    throw std::out_of_range( "The key " + std::to_string( key ) + " is not in the map" );
+
+                }
+
+                return position->second;
+
+            }
+
+            std::size_t erase( const unsigned int &key ){
+                /*!
+                 * Remove the entry with the given key if it exists and return the number of removed entries
+                 *
+                 * \param &key: The key of the value
+                 */
+
+                iterator position = find( key );
+
+                if ( position == _values.end( ) ){
+
+                    return 0;
+
+                }
+
+                _values.erase( position );
+
+                return 1;
+
+            }
+
+            bool operator==( const flatMap< T > &other ) const{ return _values == other._values; }
+
+            bool operator!=( const flatMap< T > &other ) const{ return _values != other._values; }
+
+        private:
+
+            std::vector< value_type > _values; //!< The key value pairs sorted by key
+
+            static bool compareKey( const value_type &value, const unsigned int &key ){ return value.first < key; }
+
+            iterator lowerBound( const unsigned int &key ){
+                /*!
+                 * Return the first entry whose key isn't less than the given key. Appending in increasing key order
+                 * doesn't require a search.
+                 *
+                 * \param &key: The key to search for
+                 */
+
+                if ( _values.empty( ) || ( _values.back( ).first < key ) ){
+
+                    return _values.end( );
+
+                }
+
+                return std::lower_bound( _values.begin( ), _values.end( ), key, compareKey );
+
+            }
+
+    };
+
+    typedef flatMap< floatType > mapFloatType; //!< Define a flat map of floats
+    typedef flatMap< floatVector > mapFloatVector; //!< Define a flat map of float vectors
+    typedef flatMap< floatMatrix > mapFloatMatrix; //!< Define a flat map of float matrices
+
+    typedef std::vector< std::map< std::pair< unsigned int, unsigned int >, floatVector > > overlapSolutionStorage; //!< Define the storage of the overlap distance solutions of each local particle keyed by the non-local particle and the local surface point
+
+    typedef Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > vectorView; //!< Define a non-owning view of a vector of floats
+    typedef Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > constVectorView; //!< Define a non-owning view of a constant vector of floats
+    typedef Eigen::Map< const Eigen::Matrix< int, Eigen::Dynamic, 1 > > constIntVectorView; //!< Define a non-owning view of a constant vector of integers
+    typedef Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor >, Eigen::Unaligned, Eigen::OuterStride< > > matrixView; //!< Define a non-owning view of a column major matrix of floats
+    typedef Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor >, Eigen::Unaligned, Eigen::OuterStride< > > constMatrixView; //!< Define a non-owning view of a constant column major matrix of floats
+    typedef Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 >, Eigen::Unaligned, Eigen::InnerStride< > > stridedVectorView; //!< Define a non-owning view of a vector of floats whose entries are separated by a constant stride
+    typedef Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, 1 >, Eigen::Unaligned, Eigen::InnerStride< > > constStridedVectorView; //!< Define a non-owning view of a constant vector of floats whose entries are separated by a constant stride
+
+    constexpr floatType _pi = 3.14159265358979323846; //!< The value of pi. Immutable so that concurrent evaluations do not share mutable state
+
+    constexpr uint32_t checkpointVersion = 2; //!< The version of the binary checkpoint format. Checkpoints of any other version are rejected
 
     /// Say hello
     /// @param message The message to print
     void sayHello(std::string message);
 
+    struct abaqusInterfaceWorkspace{
+        /*!
+         * The scratch buffers used to convert the Abaqus Fortran arrays to C++ types. The buffers are re-used between
+         * calls so that their storage is only allocated the first time a given size is requested. A workspace must not
+         * be shared by concurrent calls.
+         */
+
+        floatVector stress; //!< The Cauchy stress
+
+        floatVector statev; //!< The state variables
+
+        floatVector ddsddt; //!< The variation of the stress increment w.r.t. the temperature
+
+        floatVector drplde; //!< The variation of RPL w.r.t. the strain increment
+
+        floatVector strain; //!< The strain at the beginning of the increment
+
+        floatVector dstrain; //!< The strain increment
+
+        floatVector time; //!< The step and total time
+
+        floatVector predef; //!< The predefined field variables
+
+        floatVector dpred; //!< The change in the predefined field variables
+
+        floatVector props; //!< The material constants
+
+        floatVector coords; //!< The coordinates of the integration point
+
+        std::vector< int > jstep; //!< The step meta data
+
+        std::string cmname; //!< The material name
+
+        floatMatrix ddsdde; //!< The Jacobian matrix
+
+        floatMatrix drot; //!< The rigid body rotation increment
+
+        floatMatrix dfgrd0; //!< The deformation gradient at the beginning of the increment
+
+        floatMatrix dfgrd1; //!< The deformation gradient at the end of the increment
+
+    };
+
+    class aspBase;
+
+    struct integrationPointState{
+        /*!
+         * The data of an Abaqus integration point which is retained between calls to the interface so that it does not
+         * have to be re-built on every call.
+         */
+
+        std::vector< std::vector< unsigned int > > localParticleNeighbors; //!< The neighbor lists of the local particles
+
+        floatVector referenceSurfacePoints; //!< The surface points of the particles in the reference configuration
+
+        floatVector overlapSolutions; //!< The previous solutions of the overlap distances used to warm start the next solve
+
+        floatVector deformation; //!< The deformation measures for which the retained data was computed
+
+        std::shared_ptr< aspBase > model; //!< The optional asp model of the point whose deformation measures are set by the Abaqus interfaces on every call. The model is shared by the committed and trial states and is not stored by checkpoints
+
+    };
+
+    class integrationPointStateCache{
+        /*!
+         * Persistent storage of the integrationPointState of each Abaqus integration point identified by the element
+         * number (NOEL) and the integration point number (NPT).
+         * 
+         * Each point has a committed state, from the end of the last converged increment, and a trial state for the
+         * increment which is being solved. The trial state starts from the committed state and is kept by the further
+         * equilibrium iterations of the same increment so that they are warm started by the previous iteration. When a
+         * call is made at the end time of the previous trial the previous increment has converged and its trial state is
+         * committed. Calls for any other increment (e.g. the retry of an increment after a cutback) discard the previous
+         * trial state. A trial state may also be discarded directly with rollback.
+         * 
+         * The trial states of a converged increment should be committed explicitly with commit at the end of the
+         * increment (UEXTERNALDB with LOP = 2) so that a checkpoint written before the next increment contains them.
+         * 
+         * The cache may be used concurrently by the threads of a multi-threaded analysis as long as each integration
+         * point is only evaluated by one thread at a time.
+         */
+
+        public:
+
+            integrationPointState &getTrialState( const int &NOEL, const int &NPT, const floatType &time, const floatType &DTIME );
+
+            const integrationPointState *getCommittedState( const int &NOEL, const int &NPT );
+
+            void rollback( const int &NOEL, const int &NPT );
+
+            void commit( );
+
+            void clear( );
+
+            void writeCheckpoint( const std::string &filename );
+
+            void readCheckpoint( const std::string &filename );
+
+            unsigned int size( );
+
+        private:
+
+            struct entry{
+
+                integrationPointState committed; //!< The state at the end of the last converged increment
+
+                integrationPointState trial; //!< The state of the increment being solved
+
+                bool hasTrial = false; //!< Flag for whether the trial state is active
+
+                floatType trialStartTime = 0; //!< The total time at the start of the trial increment
+
+                floatType trialEndTime = 0; //!< The total time at the end of the trial increment
+
+            };
+
+            entry *getEntry( const int &NOEL, const int &NPT, const bool &create );
+
+            std::map< std::pair< int, int >, entry > _entries; //!< The states of the integration points
+
+            std::mutex _mutex; //!< The mutex which guards the insertion and lookup of the entries
+
+    };
+
+    integrationPointStateCache &getIntegrationPointStateCache( );
+
+    void columnToRowMajor( const double *columnMajor, const int &nRows, const int &nCols, floatMatrix &rowMajor );
+
+    bool isConvergenceError( const std::exception &e );
+
+    void abaqusInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
+                          double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
+                          const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
+                          const double &DTEMP,  const double *PREDEF, const double *DPRED,  const char *CMNAME,   const int &NDI,
+                          const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
+                          const double *COORDS, const double *DROT,   double &PNEWDT,       const double &CELENT, const double *DFGRD0,
+                          const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
+                          const int *JSTEP,     const int &KINC,      abaqusInterfaceWorkspace &workspace );
+
     void abaqusInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
                           double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
                           const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
@@ -86,6 +519,160 @@ namespace asp{
                              const floatMatrix &dfgrd1,       const int &NOEL,            const int &NPT,            const int &LAYER,          const int &KSPT,
                              const std::vector< int > &jstep, const int &KINC );
 
+    void abaqusViewInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
+                              double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
+                              const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
+                              const double &DTEMP,  const double *PREDEF, const double *DPRED,  const char *CMNAME,   const int &NDI,
+                              const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
+                              const double *COORDS, const double *DROT,   double &PNEWDT,       const double &CELENT, const double *DFGRD0,
+                              const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
+                              const int *JSTEP,     const int &KINC );
+
+    void dummyMaterialModel( vectorView &stress,              vectorView &statev,         matrixView &ddsdde,           floatType &SSE,            floatType &SPD,
+                             floatType &SCD,                  floatType &RPL,             vectorView &ddsddt,           vectorView &drplde,        floatType &DRPLDT,
+                             const constVectorView &strain,   const constVectorView &dstrain, const constVectorView &time, const floatType &DTIME, const floatType &TEMP,
+                             const floatType &DTEMP,          const constVectorView &predef, const constVectorView &dpred, const std::string &cmname, const int &NDI,
+                             const int &NSHR,                 const int &NTENS,           const int &NSTATV,            const constVectorView &props, const int &NPROPS,
+                             const constVectorView &coords,   const constMatrixView &drot, floatType &PNEWDT,           const floatType &CELENT,   const constMatrixView &dfgrd0,
+                             const constMatrixView &dfgrd1,   const int &NOEL,            const int &NPT,               const int &LAYER,          const int &KSPT,
+                             const constIntVectorView &jstep, const int &KINC );
+
+    struct materialPointBlock{
+        /*!
+         * The arrays of a block of material points as they are passed to an Abaqus VUMAT. The arrays which have a value
+         * for every point are stored as a structure of arrays, i.e. column major with the point as the leading dimension,
+         * so that component c of point b is the entry b + nblock * c. The arrays are not owned by the block.
+         * 
+         * The symmetric tensors (strainInc, stretch, and stress) have ndir + nshr components ordered as
+         * ( 11, 22, 33, 12, 23, 31 ) and the deformation gradients have ndir + 2 * nshr components ordered as
+         * ( 11, 22, 33, 12, 23, 31, 21, 32, 13 ).
+         */
+
+        int nblock = 0; //!< The number of material points in the block
+
+        int ndir = 3; //!< The number of direct components of a symmetric tensor
+
+        int nshr = 3; //!< The number of indirect components of a symmetric tensor
+
+        int nstatev = 0; //!< The number of state variables of each point
+
+        int nfieldv = 0; //!< The number of user-defined field variables of each point
+
+        int nprops = 0; //!< The number of material constants
+
+        int lanneal = 0; //!< Flag for whether the routine is called during an annealing process
+
+        double stepTime = 0; //!< The step time at the start of the increment
+
+        double totalTime = 0; //!< The total time at the start of the increment
+
+        double dt = 0; //!< The time increment
+
+        const char *cmname = NULL; //!< The user defined material name. Left justified as passed by FORTRAN
+
+        const double *coordMp = NULL; //!< The coordinates of the points. Shape ( nblock, 3 )
+
+        const double *charLength = NULL; //!< The characteristic element lengths. Shape ( nblock )
+
+        const double *props = NULL; //!< The material constants shared by all of the points. Shape ( nprops )
+
+        const double *density = NULL; //!< The current densities. Shape ( nblock )
+
+        const double *strainInc = NULL; //!< The strain increments. Shape ( nblock, ndir + nshr )
+
+        const double *relSpinInc = NULL; //!< The incremental relative rotations. Shape ( nblock, nshr )
+
+        const double *tempOld = NULL; //!< The temperatures at the start of the increment. Shape ( nblock )
+
+        const double *stretchOld = NULL; //!< The stretch tensors at the start of the increment. Shape ( nblock, ndir + nshr )
+
+        const double *defgradOld = NULL; //!< The deformation gradients at the start of the increment. Shape ( nblock, ndir + 2 * nshr )
+
+        const double *fieldOld = NULL; //!< The field variables at the start of the increment. Shape ( nblock, nfieldv )
+
+        const double *stressOld = NULL; //!< The stresses at the start of the increment. Shape ( nblock, ndir + nshr )
+
+        const double *stateOld = NULL; //!< The state variables at the start of the increment. Shape ( nblock, nstatev )
+
+        const double *enerInternOld = NULL; //!< The internal energies per unit mass at the start of the increment. Shape ( nblock )
+
+        const double *enerInelasOld = NULL; //!< The dissipated inelastic energies per unit mass at the start of the increment. Shape ( nblock )
+
+        const double *tempNew = NULL; //!< The temperatures at the end of the increment. Shape ( nblock )
+
+        const double *stretchNew = NULL; //!< The stretch tensors at the end of the increment. Shape ( nblock, ndir + nshr )
+
+        const double *defgradNew = NULL; //!< The deformation gradients at the end of the increment. Shape ( nblock, ndir + 2 * nshr )
+
+        const double *fieldNew = NULL; //!< The field variables at the end of the increment. Shape ( nblock, nfieldv )
+
+        double *stressNew = NULL; //!< The stresses at the end of the increment. Shape ( nblock, ndir + nshr )
+
+        double *stateNew = NULL; //!< The state variables at the end of the increment. Shape ( nblock, nstatev )
+
+        double *enerInternNew = NULL; //!< The internal energies per unit mass at the end of the increment. Shape ( nblock )
+
+        double *enerInelasNew = NULL; //!< The dissipated inelastic energies per unit mass at the end of the increment. Shape ( nblock )
+
+    };
+
+    struct materialPointView{
+        /*!
+         * Non-owning views of the values of a single point of a materialPointBlock. The views are strided by the number
+         * of points in the block so no copies are made and the results are written directly to the arrays of the block.
+         */
+
+        materialPointView( const materialPointBlock &block, const int &point );
+
+        const constStridedVectorView coords; //!< The coordinates of the point
+
+        const constStridedVectorView strainInc; //!< The strain increment
+
+        const constStridedVectorView relSpinInc; //!< The incremental relative rotation
+
+        const constStridedVectorView stretchOld; //!< The stretch tensor at the start of the increment
+
+        const constStridedVectorView defgradOld; //!< The deformation gradient at the start of the increment
+
+        const constStridedVectorView fieldOld; //!< The field variables at the start of the increment
+
+        const constStridedVectorView stressOld; //!< The stress at the start of the increment
+
+        const constStridedVectorView stateOld; //!< The state variables at the start of the increment
+
+        const constStridedVectorView stretchNew; //!< The stretch tensor at the end of the increment
+
+        const constStridedVectorView defgradNew; //!< The deformation gradient at the end of the increment
+
+        const constStridedVectorView fieldNew; //!< The field variables at the end of the increment
+
+        stridedVectorView stressNew; //!< The stress at the end of the increment
+
+        stridedVectorView stateNew; //!< The state variables at the end of the increment
+
+        const floatType &charLength; //!< The characteristic element length
+
+        const floatType &density; //!< The current density
+
+        const floatType &tempOld; //!< The temperature at the start of the increment
+
+        const floatType &tempNew; //!< The temperature at the end of the increment
+
+        const floatType &enerInternOld; //!< The internal energy per unit mass at the start of the increment
+
+        const floatType &enerInelasOld; //!< The dissipated inelastic energy per unit mass at the start of the increment
+
+        floatType &enerInternNew; //!< The internal energy per unit mass at the end of the increment
+
+        floatType &enerInelasNew; //!< The dissipated inelastic energy per unit mass at the end of the increment
+
+    };
+
+    void abaqusBlockInterface( const materialPointBlock &block, const unsigned int numThreads = 1 );
+
+    void dummyMaterialModel( materialPointView &point, const materialPointBlock &block, const std::string &cmname,
+                             const constVectorView &props );
+
     class dataBase{
 
         public:
@@ -122,7 +709,9 @@ namespace asp{
 
             virtual void clear( ){
                 /*!
-                 * The function to erase the current values stored by setting first to false and clearing second
+                 * The function to erase the current values stored by setting first to false and clearing second. For the
+                 * standard containers the capacity of second is retained so that the next value can be stored without
+                 * allocating.
                  */
 
                 first = false;
@@ -169,6 +758,262 @@ namespace asp{
 
     }
 
+    template <>
+    inline void dataStorage< floatMatrix >::clear( ){
+                /*!
+                 * The function to erase the current values stored by setting first to false. The rows of second are kept
+                 * along with their values so that the outer and inner sizes remain consistent and the next value is
+                 * copy-assigned into the existing rows. A value of the same shape is stored without allocating. The
+                 * retained values are not valid once first is false.
+                 */
+
+        first = false;
+
+    }
+
+    template < typename... types >
+    inline void clearStorage( dataStorage< types > &... storage ){
+        /*!
+         * Clear a fixed list of data storage objects. The list is known at compile time and the clear functions are
+         * called directly rather than through dataBase pointers so that they may be inlined. Used by models to reset the
+         * quantities which they cache themselves rather than registering them with the data lists of aspBase.
+         * 
+         * \param &storage: The data storage objects to clear
+         */
+
+        ( storage.dataStorage< types >::clear( ), ... );
+
+    }
+
+    template < typename... types >
+    class storageStash{
+        /*!
+         * Move the values of a fixed list of data storage objects out of them for the lifetime of the stash. The objects
+         * are left unset and their values are moved back when the stash is destroyed. The values are swapped so no copies
+         * of them are made.
+         */
+
+        public:
+
+            storageStash( dataStorage< types > &... storage ) : _storage( storage... ){
+
+                swapValues( std::index_sequence_for< types... >( ) );
+
+            }
+
+            ~storageStash( ){
+
+                swapValues( std::index_sequence_for< types... >( ) );
+
+            }
+
+            storageStash( const storageStash & ) = delete;
+
+            storageStash &operator=( const storageStash & ) = delete;
+
+        private:
+
+            template < std::size_t... indices >
+            void swapValues( std::index_sequence< indices... > ){
+
+                ( std::swap( std::get< indices >( _storage ).first, std::get< indices >( _values ).first ), ... );
+
+                ( std::swap( std::get< indices >( _storage ).second, std::get< indices >( _values ).second ), ... );
+
+            }
+
+            std::tuple< dataStorage< types > &... > _storage; //!< The stashed data storage objects
+
+            std::tuple< dataStorage< types >... > _values; //!< The values of the stashed objects
+
+    };
+
+    class sparseSurfaceResponse{
+        /*!
+         * Compressed storage of a quantity assembled over the interaction pairs of the local particles
+         * 
+         * The pairs are stored in a compressed sparse row format where the rows are the ( local particle, local surface point )
+         * combinations ordered as localIndex * numSurfacePoints + surfacePointIndex and the columns are the non-local particle
+         * indices. Each pair has one or more entries (e.g., one entry for each overlapping non-local surface point) which are
+         * identified by a key and which each store valueSize contiguous values. Quantities with a single value per pair use
+         * a key of zero.
+         */
+
+        public:
+
+            unsigned int numLocalParticles = 0; //!< The number of local particles
+
+            unsigned int numSurfacePoints = 0; //!< The number of surface points on each local particle
+
+            unsigned int valueSize = 1; //!< The number of values stored for each entry
+
+            std::vector< unsigned int > rowOffsets; //!< The offsets into nonLocalIndices for each row. Has a length of the number of rows + 1
+
+            std::vector< unsigned int > nonLocalIndices; //!< The non-local particle index of each pair
+
+            std::vector< unsigned int > entryOffsets; //!< The offsets into entryKeys for each pair. Has a length of the number of pairs + 1
+
+            std::vector< unsigned int > entryKeys; //!< The key of each entry
+
+            floatVector values; //!< The values of the entries with valueSize values per entry
+
+            void initialize( const unsigned int &_numLocalParticles, const unsigned int &_numSurfacePoints, const unsigned int &_valueSize,
+                             const unsigned int expectedPairs = 0 );
+
+            void appendPair( const unsigned int &nonLocalIndex, const floatType &value );
+
+            void appendPair( const unsigned int &nonLocalIndex, const floatVector &value );
+
+            void appendPair( const unsigned int &nonLocalIndex, const mapFloatType &value );
+
+            void appendPair( const unsigned int &nonLocalIndex, const mapFloatVector &value );
+
+            void closeRow( );
+
+            void appendRows( const sparseSurfaceResponse &other );
+
+            unsigned int getNumPairs( ) const{
+                /*!
+                 * Get the number of stored pairs
+                 */
+
+                return nonLocalIndices.size( );
+
+            }
+
+            unsigned int getNumEntries( ) const{
+                /*!
+                 * Get the number of stored entries
+                 */
+
+                return entryKeys.size( );
+
+            }
+
+            bool findPair( const unsigned int &localIndex, const unsigned int &surfacePointIndex, const unsigned int &nonLocalIndex,
+                           unsigned int &pair ) const;
+
+            void toDense( std::vector< std::vector< floatVector > > &dense ) const;
+
+            void toDense( std::vector< std::vector< floatMatrix > > &dense ) const;
+
+            void toDense( std::vector< std::vector< std::vector< mapFloatType > > > &dense ) const;
+
+            void toDense( std::vector< std::vector< std::vector< mapFloatVector > > > &dense ) const;
+
+            void clear( );
+
+    };
+
+    enum evaluationMode{
+        /*!
+         * The highest order of the derivatives which are formed when the quantities of a particle pair are evaluated
+         */
+
+        ENERGY = 0, //!< Only the energies are required e.g. for line-search or predictor evaluations
+        GRADIENT = 1, //!< The energies and their first derivatives are required
+        HESSIAN = 2 //!< The energies and their first and second derivatives are required
+    };
+
+    enum pairSelection{
+        /*!
+         * The particle pairs whose surface responses are assembled from the neighbor lists
+         */
+
+        ALL_PAIRS = 0, //!< Every neighbor of a local particle, including the particle itself, forms a pair
+        DISTINCT_PAIRS = 1 //!< A particle does not form a pair with itself
+    };
+
+    enum instrumentationStage{
+        /*!
+         * The stages of an aspBase evaluation which are timed when compiled with ASP_INSTRUMENTATION
+         */
+
+        UNIT_SPHERE_SETUP = 0, //!< The initialization of the unit sphere
+        LOCAL_PARTICLE_ENERGY, //!< The evaluation of the energy of a local particle
+        BOUNDING_BOX, //!< The formation of the current bounding box of a particle
+        OVERLAP_CULLING, //!< The identification of the surface points which may overlap a non-local particle
+        OVERLAP_SOLVE, //!< The solution of the overlap of the candidate surface points
+        ADHESION_TRACTION, //!< The evaluation of the surface adhesion traction
+        SURFACE_RESPONSES, //!< The fused evaluation of the surface responses of an interaction pair
+        LOCAL_PARTICLE_ASSEMBLY, //!< The assembly of the local particles
+        SURFACE_RESPONSE_ASSEMBLY, //!< The assembly of the surface responses
+        ABAQUS_UMAT, //!< A call of the Abaqus UMAT i.e. the evaluation of one integration point
+        NUM_INSTRUMENTATION_STAGES //!< The number of stages
+    };
+
+    const char *getInstrumentationStageName( const instrumentationStage &stage );
+
+    struct instrumentationCounters{
+        /*!
+         * The call counts and cumulative times of the stages of an evaluation along with the work done by the overlap
+         * candidate culling and the overlap distance solver. The times of a stage include the time of any stage which is
+         * nested in it, and the stages evaluated by parallel assembly workers contribute the time of every worker.
+         */
+
+        std::array< unsigned long long, NUM_INSTRUMENTATION_STAGES > calls = { }; //!< The number of calls of each stage
+
+        std::array< double, NUM_INSTRUMENTATION_STAGES > seconds = { }; //!< The cumulative wall time of each stage in seconds
+
+        unsigned long long overlapCandidatesTested = 0; //!< The number of surface points tested against a non-local bounding box
+
+        unsigned long long overlapCandidatesRetained = 0; //!< The number of surface points contained in a non-local bounding box
+
+        unsigned long long overlapSolves = 0; //!< The number of overlap distance solves
+
+        unsigned long long overlapNewtonIterations = 0; //!< The number of Newton iterations of the overlap distance solves
+
+        unsigned long long overlapLineSearchIterations = 0; //!< The number of line-search backtracks of the overlap distance solves
+
+        void merge( const instrumentationCounters &other );
+
+        void reset( );
+
+        void write( std::ostream &stream ) const;
+
+    };
+
+    class instrumentationTimer{
+        /*!
+         * Scope guard which counts a call of a stage and adds the time until it is destroyed
+         */
+
+        public:
+
+            instrumentationTimer( instrumentationCounters &counters, const instrumentationStage &stage )
+                : _counters( counters ), _stage( stage ), _start( std::chrono::steady_clock::now( ) ){ }
+
+            ~instrumentationTimer( ){
+
+                _counters.calls[ _stage ]++;
+
+                _counters.seconds[ _stage ] += std::chrono::duration< double >( std::chrono::steady_clock::now( ) - _start ).count( );
+
+            }
+
+        private:
+
+            instrumentationCounters &_counters; //!< The counters being recorded
+
+            instrumentationStage _stage; //!< The stage being timed
+
+            std::chrono::steady_clock::time_point _start; //!< The time the stage started
+
+    };
+
+    void recordInstrumentation( const instrumentationCounters &counters );
+
+    instrumentationCounters getRecordedInstrumentation( );
+
+    void resetRecordedInstrumentation( );
+
+//! Time the rest of the enclosing scope as the given stage of the aspBase evaluation. Removed unless ASP_INSTRUMENTATION is defined.
+#ifdef ASP_INSTRUMENTATION
+    #define ASP_INSTRUMENT_STAGE( stage ) asp::instrumentationTimer _aspInstrumentationTimer( _instrumentation, stage )
+#else
+    #define ASP_INSTRUMENT_STAGE( stage )
+#endif
+
     class aspBase{
         /*!
          * The base class for all Anisotropic Stochastic Particle (ASP) models.
@@ -181,6 +1026,8 @@ namespace asp{
             // Constructors
             aspBase( );
 
+            virtual ~aspBase( ){ }
+
             // Public member functions
             virtual void computeLocalParticleEnergyDensity( const floatType &previousTime, const floatType &deltaTime,
                                                             const floatVector &currentMicroDeformation, const floatVector &previousMicroDeformation,
@@ -209,6 +1056,10 @@ namespace asp{
 
             virtual void computeSurfaceOverlapEnergyDensity( mapFloatType &surfaceOverlapEnergyDensity );
 
+            virtual void computeSurfaceResponses( floatType &surfaceAdhesionEnergyDensity, floatVector &surfaceAdhesionTraction,
+                                                  floatType &surfaceAdhesionThickness, mapFloatType &surfaceOverlapEnergyDensity,
+                                                  mapFloatVector &surfaceOverlapTraction, mapFloatType &surfaceOverlapThickness );
+
             // Getter functions
             const unsigned int* getDimension( );
 
@@ -310,18 +1161,22 @@ namespace asp{
 
             const floatVector* getNonLocalCurrentSurfacePoints( );
 
+            const broadPhaseFloatVector* getLocalCurrentSurfacePointsBroadPhase( );
+
             const floatVector* getSurfaceAdhesionTraction( );
 
             const floatVector* getPreviousStateVariables( );
 
             const floatVector* getPreviousLocalStateVariables( );
 
-            const std::unordered_map< unsigned int, floatVector>* getSurfaceOverlapTraction( );
+            const mapFloatVector* getSurfaceOverlapTraction( );
 
             const floatMatrix* getLocalParticleCurrentBoundingBox( );
 
             const floatMatrix* getNonLocalParticleCurrentBoundingBox( );
 
+            const std::vector< std::vector< unsigned int > >* getLocalParticleNeighbors( );
+
             const mapFloatType* getSurfaceOverlapEnergyDensity( );
 
             const mapFloatVector* getParticlePairOverlap( );
@@ -379,6 +1234,18 @@ namespace asp{
 
             const std::vector< std::vector< std::vector< mapFloatVector > > >* getAssembledSurfaceOverlapTractions( );
 
+            const sparseSurfaceResponse* getAssembledSparseSurfaceAdhesionThicknesses( );
+
+            const sparseSurfaceResponse* getAssembledSparseSurfaceAdhesionEnergyDensities( );
+
+            const sparseSurfaceResponse* getAssembledSparseSurfaceAdhesionTractions( );
+
+            const sparseSurfaceResponse* getAssembledSparseSurfaceOverlapThicknesses( );
+
+            const sparseSurfaceResponse* getAssembledSparseSurfaceOverlapEnergyDensities( );
+
+            const sparseSurfaceResponse* getAssembledSparseSurfaceOverlapTractions( );
+
             const floatMatrix* getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( );
 
             const floatMatrix* getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( );
@@ -435,6 +1302,58 @@ namespace asp{
             //! Get the value of the relative tolerance
             const floatType* getRelativeTolerance( ){ return &_relativeTolerance; }
 
+            //! Get the highest order of the derivatives which are formed with the values
+            const evaluationMode* getEvaluationMode( ){ return &_evaluationMode; }
+
+            //! Set the highest order of the derivatives which are formed with the values
+            void setEvaluationMode( const evaluationMode &mode ){ _evaluationMode = mode; }
+
+            //! Get the particle pairs whose surface responses are assembled
+            const pairSelection* getPairSelection( ){ return &_pairSelection; }
+
+            //! Set the particle pairs whose surface responses are assembled
+            void setPairSelection( const pairSelection &selection ){ _pairSelection = selection; }
+
+            //! Get whether the neighbor lists are formed by the neighbor search
+            const bool* getUseNeighborSearch( ){ return &_useNeighborSearch; }
+
+            void setUseNeighborSearch( const bool &value );
+
+            //! Get the distance added to each side of the particle bounding boxes by the neighbor search
+            const floatType* getNeighborSearchPadding( ){ return &_neighborSearchPadding; }
+
+            void setNeighborSearchPadding( const floatType &value );
+
+            //! Get the reference positions of the local particles used by the neighbor search
+            const floatVector* getLocalParticleReferencePositions( ){ return &_localParticleReferencePositions; }
+
+            void setLocalParticleReferencePositions( const floatVector &value );
+
+            //! Remove the overlap distance solutions which warm start the overlap solves e.g. when the particles are re-numbered
+            void resetOverlapSolutions( ){ _overlapSolutions.clear( ); }
+
+            //! Get the largest change in a component of the deformation measures which setDeformation treats as no change
+            const floatType* getDeformationChangeTolerance( ){ return &_deformationChangeTolerance; }
+
+            void setDeformationChangeTolerance( const floatType &value );
+
+            void setDeformation( const floatVector &previousDeformationGradient, const floatVector &previousMicroDeformation,
+                                 const floatVector &previousGradientMicroDeformation, const floatVector &deformationGradient,
+                                 const floatVector &microDeformation, const floatVector &gradientMicroDeformation );
+
+            void writeCheckpoint( const std::string &filename );
+
+            void readCheckpoint( const std::string &filename );
+
+            //! Get whether the deformation measures were changed the last time that they were set
+            const bool* getDeformationChanged( ){ return &_deformationChanged; }
+
+            //! Get the call counts and times of the evaluation stages of this object
+            const instrumentationCounters* getInstrumentationCounters( ){ return &_instrumentation; }
+
+            //! Reset the call counts and times of the evaluation stages of this object
+            void resetInstrumentationCounters( ){ _instrumentation.reset( ); }
+
             const floatMatrix* getd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( );
 
             const floatMatrix* getd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( );
@@ -462,31 +1381,73 @@ namespace asp{
 
                 _surfacePointData.push_back( data );
 
-            }
+            }
+
+            void addInteractionPairData( dataBase *data ){
+                /*!
+                 * Add the pointer to the data object to the interaction pair data garbage collection vector
+                 * 
+                 * \param *data: The pointer to the object to be cleaned when the interaction pair's index changes
+                 */
+
+                _interactionPairData.push_back( data );
+
+            }
+
+            void addAssembledData( dataBase *data ){
+                /*!
+                 * Add the pointer to the data object to the assembled data garbage collection vector
+                 * 
+                 * \param *data: The pointer to the object to be cleaned when the deformation changes
+                 */
+
+                _assembledData.push_back( data );
+
+            }
+
+        protected:
+
+            // Protected parameters
+            unsigned int _dimension = 3; //!< The spatial dimension
+
+            unsigned int _surfaceElementCount = 1; //!< The base number of surface elements. Will result in the unit sphere having eight elements.
+
+            bool _useNeighborSearch = false; //!< Flag for whether to only assemble the surface responses of particle pairs whose bounding boxes overlap
+
+            floatType _neighborSearchPadding = 0; //!< The distance added to each side of the particle bounding boxes when searching for neighbors
+
+            floatVector _localParticleReferencePositions; //!< The reference positions of the centers of the local particles stored particle by particle which are binned by the neighbor search
+
+            unsigned int _numAssemblyThreads = 1; //!< The number of threads used to assemble the local particles and surface responses. A value of one assembles serially
+
+            evaluationMode _evaluationMode = HESSIAN; //!< The highest order of the derivatives formed along with the values. Derivatives which are requested directly are always formed
+
+            pairSelection _pairSelection = ALL_PAIRS; //!< The particle pairs whose surface responses are assembled from the neighbor lists
+
+            floatType _deformationChangeTolerance = 0; //!< The largest change in a component of the deformation measures which setDeformation treats as no change
+
+            bool _useFusedSurfaceResponses = false; //!< Flag for whether the surface responses of each pair are assembled from a single call of computeSurfaceResponses rather than the individual getters. Classes which override the individual surface response setters must leave it disabled or override computeSurfaceResponses
 
-            void addInteractionPairData( dataBase *data ){
-                /*!
-                 * Add the pointer to the data object to the interaction pair data garbage collection vector
-                 * 
-                 * \param *data: The pointer to the object to be cleaned when the interaction pair's index changes
-                 */
+            bool _useBatchedCurrentDistances = false; //!< Flag for whether the current distance vectors of a local surface point with all of its non-local particles are formed in a single batched evaluation for the energy and gradient evaluation modes. The inputs of the current distance of every pair are then formed twice so classes whose surface responses don't use the current distance vector should leave it disabled
 
-                _interactionPairData.push_back( data );
+            instrumentationCounters _instrumentation; //!< The call counts and times of the evaluation stages. Only recorded when compiled with ASP_INSTRUMENTATION
 
-            }
+            template< typename pointType >
+            bool pointInBoundingBox( const std::vector< pointType > &point, const floatMatrix &boundingBox );
 
-        protected:
+            template< typename pointType >
+            void formBoundingBox( const std::vector< pointType > &points, floatMatrix &boundingBox );
 
-            // Protected parameters
-            unsigned int _dimension = 3; //!< The spatial dimension
+            template< typename pointType >
+            void idBoundingBoxContainedPoints( const std::vector< pointType > &points, const floatMatrix &boundingBox, std::vector< unsigned int > &containedPoints );
 
-            unsigned int _surfaceElementCount = 1; //!< The base number of surface elements. Will result in the unit sphere having eight elements.
+            bool boundingBoxesOverlap( const floatMatrix &boundingBox1, const floatMatrix &boundingBox2 );
 
-            bool pointInBoundingBox( const floatVector &point, const floatMatrix &boundingBox );
+            void formNeighborLists( const std::vector< floatMatrix > &boundingBoxes, std::vector< std::vector< unsigned int > > &neighbors );
 
-            void formBoundingBox( const floatVector &points, floatMatrix &boundingBox );
+            void selectInteractionPairs( const std::vector< std::vector< unsigned int > > &neighbors, std::vector< std::vector< unsigned int > > &pairs );
 
-            void idBoundingBoxContainedPoints( const floatVector &points, const floatMatrix &boundingBox, std::vector< unsigned int > &containedPoints );
+            virtual std::unique_ptr< aspBase > createAssemblyWorker( ) const;
 
             // Setter functions
             void setLocalReferenceRadius( const floatType &value );
@@ -553,6 +1514,8 @@ namespace asp{
 
             void setNonLocalParticleCurrentBoundingBox( const floatMatrix &value );
 
+            void setLocalParticleNeighbors( const std::vector< std::vector< unsigned int > > &value );
+
             void setLocalReferenceSurfacePoints( const floatVector &value );
 
             void setNonLocalReferenceSurfacePoints( const floatVector &value );
@@ -561,6 +1524,8 @@ namespace asp{
 
             void setNonLocalCurrentSurfacePoints( const floatVector &value );
 
+            void setLocalCurrentSurfacePointsBroadPhase( const broadPhaseFloatVector &value );
+
             void setParticlePairOverlap( const mapFloatVector &value );
 
             void setLocalParticleReferenceVolume( const floatType &value );
@@ -629,10 +1594,19 @@ namespace asp{
 
             void setdLocalCurrentNormaldLocalMicroDeformation( const floatMatrix &value );
 
+            // Reset functions which may be extended by derived classes
+            virtual void resetInteractionPairData( );
+
+            virtual void resetSurfacePointData( );
+
+            virtual void resetLocalParticleData( );
+
         private:
             // Friend classes
             friend class unit_test::aspBaseTester;
 
+            template < class model > friend class aspModel;
+
             // Private parameters
             unsigned int _localIndex = 0;
 
@@ -670,6 +1644,8 @@ namespace asp{
 
             floatVector _gradientMicroDeformation;
 
+            bool _deformationChanged = true;
+
             floatVector _particleParameters;
 
             dataStorage< floatMatrix > _localParticleCurrentBoundingBox;
@@ -678,6 +1654,8 @@ namespace asp{
 
             dataStorage< floatVector > _localCurrentSurfacePoints;
 
+            dataStorage< broadPhaseFloatVector > _localCurrentSurfacePointsBroadPhase;
+
             // ALL OF THESE MUST BE CLEARED AFTER EACH SURFACE INTEGRAND CALCULATION
             dataStorage< floatType > _localReferenceRadius;
 
@@ -717,6 +1695,16 @@ namespace asp{
 
             dataStorage< floatVector > _currentDistanceVector;
 
+            dataStorage< std::vector< unsigned int > > _surfacePointCurrentDistanceNonLocalIndices;
+
+            dataStorage< floatVector > _surfacePointCurrentDistanceVectors;
+
+            dataStorage< floatVector > _surfacePointdCurrentDistanceVectorsdLocalDeformationGradient;
+
+            dataStorage< floatVector > _surfacePointdCurrentDistanceVectorsdLocalMicroDeformation;
+
+            dataStorage< floatVector > _surfacePointdCurrentDistanceVectorsdNonLocalMicroDeformation;
+
             dataStorage< floatVector > _localCurrentNormal;
 
             dataStorage< floatVector > _surfaceParameters;
@@ -733,8 +1721,12 @@ namespace asp{
 
             dataStorage< floatMatrix > _nonLocalParticleCurrentBoundingBox;
 
+            dataStorage< std::vector< std::vector< unsigned int > > > _localParticleNeighbors;
+
             dataStorage< mapFloatVector > _particlePairOverlap;
 
+            dataStorage< overlapSolutionStorage > _overlapSolutions;
+
             dataStorage< floatVector > _surfaceAdhesionTraction;
 
             dataStorage< mapFloatVector > _surfaceOverlapTraction;
@@ -787,6 +1779,18 @@ namespace asp{
 
             dataStorage< std::vector< std::vector< std::vector< mapFloatVector > > > > _assembledSurfaceOverlapTractions;
 
+            dataStorage< sparseSurfaceResponse > _assembledSparseSurfaceAdhesionThicknesses;
+
+            dataStorage< sparseSurfaceResponse > _assembledSparseSurfaceAdhesionEnergyDensities;
+
+            dataStorage< sparseSurfaceResponse > _assembledSparseSurfaceAdhesionTractions;
+
+            dataStorage< sparseSurfaceResponse > _assembledSparseSurfaceOverlapThicknesses;
+
+            dataStorage< sparseSurfaceResponse > _assembledSparseSurfaceOverlapEnergyDensities;
+
+            dataStorage< sparseSurfaceResponse > _assembledSparseSurfaceOverlapTractions;
+
             dataStorage< floatMatrix > _dNonLocalMicroDeformationdNonLocalMicroDeformationBase;
 
             dataStorage< floatMatrix > _dNonLocalMicroDeformationdGradientMicroDeformation;
@@ -857,6 +1861,8 @@ namespace asp{
 
             std::vector< dataBase* > _interactionPairData; //! A vector of pointers to quantities required for a particle interaction
 
+            std::vector< dataBase* > _assembledData; //! A vector of pointers to the assembled quantities of all of the particles
+
             // END OF MEMBERS WHICH MUST BE CLEARED AFTER EACH SURFACE INTEGRAND CALCULATION
 
             // Private member functions
@@ -890,10 +1896,16 @@ namespace asp{
 
             virtual void setLocalCurrentNormal( );
 
+            void formLocalCurrentNormal( const evaluationMode &mode );
+
             virtual void setLocalReferenceParticleSpacingVector( );
 
             virtual void setCurrentDistanceVector( );
 
+            void formCurrentDistanceVector( const evaluationMode &mode );
+
+            void formSurfacePointCurrentDistanceVectors( const std::vector< unsigned int > &nonLocalIndices );
+
             virtual void setdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( );
 
             virtual void setdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( );
@@ -976,6 +1988,8 @@ namespace asp{
 
             virtual void setNonLocalParticleCurrentBoundingBox( );
 
+            virtual void setLocalParticleNeighbors( );
+
             virtual void setLocalReferenceSurfacePoints( );
 
             virtual void setNonLocalReferenceSurfacePoints( );
@@ -984,6 +1998,8 @@ namespace asp{
 
             virtual void setNonLocalCurrentSurfacePoints( );
 
+            virtual void setLocalCurrentSurfacePointsBroadPhase( );
+
             virtual void setParticlePairOverlap( );
 
             virtual void setLocalParticleReferenceVolume( );
@@ -996,18 +2012,540 @@ namespace asp{
 
             virtual void setSurfaceOverlapThickness( );
 
-            virtual void resetInteractionPairData( );
-
-            virtual void resetSurfacePointData( );
-
-            virtual void resetLocalParticleData( );
+            virtual void resetAssembledData( );
 
             virtual void assembleLocalParticles( );
 
             virtual void assembleSurfaceResponses( );
 
+            void runAssemblyWorkers( const unsigned int &numItems,
+                                     const std::function< void( aspBase &worker, const unsigned int &workerIndex,
+                                                                const unsigned int &begin, const unsigned int &end ) > &task );
+
+            virtual void assembleLocalParticleRange( const unsigned int &begin, const unsigned int &end,
+                                             floatVector &energies, floatMatrix &microCauchyStresses,
+                                             floatVector &volumes, floatVector &logProbabilityRatios );
+
+            virtual void assembleSurfaceResponseRange( const unsigned int &begin, const unsigned int &end, const unsigned int &numSurfacePoints,
+                                                       const std::vector< std::vector< unsigned int > > &neighbors,
+                                                       sparseSurfaceResponse &adhesionEnergyDensities, sparseSurfaceResponse &adhesionTractions,
+                                                       sparseSurfaceResponse &adhesionThicknesses, sparseSurfaceResponse &overlapEnergyDensities,
+                                                       sparseSurfaceResponse &overlapTractions, sparseSurfaceResponse &overlapThicknesses );
+
+            template < class model >
+            void evaluateLocalParticleQuantities( model &m );
+
+            template < class model >
+            const floatType* evaluateLocalParticleEnergy( model &m );
+
+            template < class model >
+            void assembleLocalParticleLoop( model &m, const unsigned int &begin, const unsigned int &end,
+                                            floatVector &energies, floatMatrix &microCauchyStresses,
+                                            floatVector &volumes, floatVector &logProbabilityRatios );
+
+            template < class model >
+            void assembleSurfaceResponseLoop( model &m, const unsigned int &begin, const unsigned int &end, const unsigned int &numSurfacePoints,
+                                              const std::vector< std::vector< unsigned int > > &neighbors,
+                                              sparseSurfaceResponse &adhesionEnergyDensities, sparseSurfaceResponse &adhesionTractions,
+                                              sparseSurfaceResponse &adhesionThicknesses, sparseSurfaceResponse &overlapEnergyDensities,
+                                              sparseSurfaceResponse &overlapTractions, sparseSurfaceResponse &overlapThicknesses );
+
+    };
+
+    template < class model >
+    class aspModel : public aspBase{
+        /*!
+         * The base class for ASP models whose user-defined functions are dispatched statically. A model derives from
+         * aspModel< model > and must be a final class, e.g.
+         * 
+         * class myModel final : public aspModel< myModel >{ ... };
+         * 
+         * The assembly loops of the local particles and the surface responses are the loops of aspBase instantiated for the
+         * model, which call computeLocalParticleEnergyDensity, computeSurfaceResponses, and the reset functions through a
+         * reference to the model. Because the model is final these calls are resolved at compile time so that small models
+         * may be inlined into the loops. The fused evaluation of the surface responses is enabled by default.
+         * 
+         * The energy of a local particle is formed directly from computeLocalParticleEnergyDensity, which a model overrides
+         * in the form with the log probability ratio, so overrides of setLocalParticleEnergy and setLocalParticleQuantities
+         * are not used by the assembly.
+         * 
+         * The fused surface responses of a pair are composed from the model's computeSurfaceAdhesionEnergyDensity,
+         * computeSurfaceAdhesionTraction, computeSurfaceOverlapEnergyDensity, and computeSurfaceOverlapTraction so that
+         * overrides of these functions are used and bound at compile time. A model may instead override
+         * computeSurfaceResponses to evaluate all of the responses of a pair at once. A model which overrides one form of
+         * computeSurfaceAdhesionEnergyDensity must bring the other into scope with a using declaration.
+         * 
+         * Quantities which a model caches itself may be reset in its overrides of the reset functions with clearStorage
+         * rather than being registered with the data lists. A model whose overrides of the reset functions are not public
+         * must declare aspModel< model > as a friend.
+         */
+
+        public:
+
+            aspModel( ) : aspBase( ){
+
+                _useFusedSurfaceResponses = true;
+
+            }
+
+            virtual void computeSurfaceResponses( floatType &surfaceAdhesionEnergyDensity, floatVector &surfaceAdhesionTraction,
+                                                  floatType &surfaceAdhesionThickness, mapFloatType &surfaceOverlapEnergyDensity,
+                                                  mapFloatVector &surfaceOverlapTraction, mapFloatType &surfaceOverlapThickness ) override;
+
+        protected:
+
+            virtual std::unique_ptr< aspBase > createAssemblyWorker( ) const override{
+                /*!
+                 * Create a copy of the model which is used to assemble a range of the local particles in the parallel assembly
+                 */
+
+                return std::unique_ptr< aspBase >( new model( static_cast< const model & >( *this ) ) );
+
+            }
+
+        private:
+
+            model &derived( ){
+
+                return static_cast< model & >( *this );
+
+            }
+
+            virtual void assembleLocalParticleRange( const unsigned int &begin, const unsigned int &end,
+                                                     floatVector &energies, floatMatrix &microCauchyStresses,
+                                                     floatVector &volumes, floatVector &logProbabilityRatios ) override;
+
+            virtual void assembleSurfaceResponseRange( const unsigned int &begin, const unsigned int &end, const unsigned int &numSurfacePoints,
+                                                       const std::vector< std::vector< unsigned int > > &neighbors,
+                                                       sparseSurfaceResponse &adhesionEnergyDensities, sparseSurfaceResponse &adhesionTractions,
+                                                       sparseSurfaceResponse &adhesionThicknesses, sparseSurfaceResponse &overlapEnergyDensities,
+                                                       sparseSurfaceResponse &overlapTractions, sparseSurfaceResponse &overlapThicknesses ) override;
+
+    };
+
+    class counterRandomStream{
+        /*!
+         * A counter-based stream of random numbers. The n'th value of the stream is a hash of the seed, the stream index
+         * and n, so the values of a stream do not depend on which thread evaluates it or on the values drawn from any
+         * other stream.
+         */
+
+        public:
+
+            counterRandomStream( const uint64_t &seed = 0, const uint64_t &stream = 0 );
+
+            uint64_t operator()( );
+
+            floatType uniform( );
+
+            uint64_t at( const uint64_t &counter ) const;
+
+            //! Get the number of values which have been drawn from the stream
+            const uint64_t* getCounter( ) const{ return &_counter; }
+
+        private:
+
+            uint64_t _key; //!< The key of the stream formed from the seed and the stream index
+
+            uint64_t _counter = 0; //!< The index of the next value of the stream
+
+    };
+
+    struct ensembleResults{
+        /*!
+         * The assembled quantities of an ensemble of independent realizations stored in a single contiguous buffer. The
+         * quantities of the r'th realization start at values[ r * getRealizationSize( ) ] and are stored as the local particle
+         * energies, the local particle micro Cauchy stresses stored particle by particle and the local particle log
+         * probability ratios.
+         */
+
+        unsigned int numRealizations = 0; //!< The number of realizations
+
+        unsigned int numLocalParticles = 0; //!< The number of local particles of each realization
+
+        unsigned int stressSize = 0; //!< The number of components of the micro Cauchy stress of each local particle
+
+        floatVector values; //!< The assembled quantities of all of the realizations
+
+        //! Get the number of values stored for each realization
+        unsigned int getRealizationSize( ) const{ return numLocalParticles * ( stressSize + 2 ); }
+
+        //! Get the local particle energies of a realization
+        const floatType* getEnergies( const unsigned int &realization ) const{ return values.data( ) + realization * getRealizationSize( ); }
+
+        //! Get the local particle micro Cauchy stresses of a realization
+        const floatType* getMicroCauchyStresses( const unsigned int &realization ) const{ return getEnergies( realization ) + numLocalParticles; }
+
+        //! Get the local particle log probability ratios of a realization
+        const floatType* getLogProbabilityRatios( const unsigned int &realization ) const{ return getMicroCauchyStresses( realization ) + numLocalParticles * stressSize; }
+
     };
 
+    typedef std::function< std::unique_ptr< aspBase >( const unsigned int &realization, counterRandomStream &stream ) > realizationFactory; //!< A function which creates a configured realization of an ensemble
+
+    void evaluateEnsemble( const unsigned int &numRealizations, const realizationFactory &createRealization, const uint64_t &seed,
+                           ensembleResults &results, const unsigned int numThreads = 1 );
+
+    template < class model >
+    void aspBase::evaluateLocalParticleQuantities( model &m ){
+        /*!
+         * Set the energy density, microstress, state variables, and log probability ratio of the local particle from the
+         * computeLocalParticleEnergyDensity of the model
+         * 
+         * \param &m: The model which computes the energy density. This object for aspBase and the derived model for aspModel
+         */
+
+        const floatType *previousTime;
+        ERROR_TOOLS_CATCH( previousTime = getPreviousTime( ) );
+
+        const floatType *deltaTime;
+        ERROR_TOOLS_CATCH( deltaTime = getDeltaTime( ) );
+
+        const floatVector *currentLocalMicroDeformation;
+        ERROR_TOOLS_CATCH( currentLocalMicroDeformation = getLocalMicroDeformation( ) );
+
+        const floatVector *previousLocalMicroDeformation;
+        ERROR_TOOLS_CATCH( previousLocalMicroDeformation = getPreviousLocalMicroDeformation( ) );
+
+        const floatType *currentTemperature;
+        ERROR_TOOLS_CATCH( currentTemperature = getTemperature( ) );
+
+        const floatType *previousTemperature;
+        ERROR_TOOLS_CATCH( previousTemperature = getPreviousTemperature( ) );
+
+        const floatVector *previousStateVariables;
+        ERROR_TOOLS_CATCH( previousStateVariables = getPreviousLocalStateVariables( ) );
+
+        const floatVector *parameters;
+        ERROR_TOOLS_CATCH( parameters = getLocalParticleParameters( ) );
+
+        floatType localParticleEnergyDensity;
+
+        floatVector localParticleStateVariables;
+
+        floatVector localParticleMicroCauchyStress;
+
+        floatType localParticleLogProbabilityRatio;
+
+        ERROR_TOOLS_CATCH( m.computeLocalParticleEnergyDensity( *previousTime, *deltaTime, *currentLocalMicroDeformation, *previousLocalMicroDeformation,
+                                                                *currentTemperature, *previousTemperature, *previousStateVariables, *parameters,
+                                                                localParticleEnergyDensity, localParticleMicroCauchyStress,
+                                                                localParticleStateVariables, localParticleLogProbabilityRatio ) );
+
+        setLocalParticleEnergyDensity( localParticleEnergyDensity );
+
+        setLocalParticleMicroCauchyStress( localParticleMicroCauchyStress );
+
+        setLocalParticleStateVariables( localParticleStateVariables );
+
+        setLocalParticleLogProbabilityRatio( localParticleLogProbabilityRatio );
+
+    }
+
+    template < class model >
+    const floatType* aspBase::evaluateLocalParticleEnergy( model &m ){
+        /*!
+         * Get the energy of the local particle for the assembly. For aspBase the energy is formed by the setters, which
+         * may be overridden by the derived classes. For a model which derives from aspModel the energy is formed directly
+         * from the model's computeLocalParticleEnergyDensity so that it is bound at compile time.
+         * 
+         * \param &m: The model which computes the energy density. This object for aspBase and the derived model for aspModel
+         */
+
+        if constexpr ( std::is_same< model, aspBase >::value ){
+
+            return getLocalParticleEnergy( );
+
+        }
+        else{
+
+            if ( !_localParticleEnergy.first ){
+
+                ASP_INSTRUMENT_STAGE( LOCAL_PARTICLE_ENERGY );
+
+                if ( !_localParticleEnergyDensity.first ){
+
+                    ERROR_TOOLS_CATCH( evaluateLocalParticleQuantities( m ) );
+
+                }
+
+                const floatType *localParticleCurrentVolume;
+                ERROR_TOOLS_CATCH( localParticleCurrentVolume = m.getLocalParticleCurrentVolume( ) );
+
+                setLocalParticleEnergy( _localParticleEnergyDensity.second * ( *localParticleCurrentVolume ) );
+
+            }
+
+            return &_localParticleEnergy.second;
+
+        }
+
+    }
+
+    template < class model >
+    void aspBase::assembleLocalParticleLoop( model &m, const unsigned int &begin, const unsigned int &end,
+                                             floatVector &energies, floatMatrix &microCauchyStresses,
+                                             floatVector &volumes, floatVector &logProbabilityRatios ){
+        /*!
+         * Assemble the quantities of the local particles with indices in [begin, end) into pre-allocated arrays. The loop
+         * is shared by aspBase, which evaluates it for itself, and aspModel, which evaluates it for the derived model so
+         * that the model's functions are bound at compile time.
+         * 
+         * \param &m: The model whose local particles are assembled
+         * \param &begin: The index of the first local particle
+         * \param &end: The index one past the last local particle
+         * \param &energies: The energies of all of the local particles
+         * \param &microCauchyStresses: The micro Cauchy stresses of all of the local particles
+         * \param &volumes: The current volumes of all of the local particles
+         * \param &logProbabilityRatios: The log probability ratios of all of the local particles
+         */
+
+        for ( unsigned int i = begin; i < end; i++ ){
+
+            _localIndex = i; // Set the current local index
+
+            // Quantities required for the energy calculation
+            ERROR_TOOLS_CATCH( energies[ i ] = *evaluateLocalParticleEnergy( m ) );
+
+            ERROR_TOOLS_CATCH( microCauchyStresses[ i ] = *m.getLocalParticleMicroCauchyStress( ) );
+
+            ERROR_TOOLS_CATCH( volumes[ i ] = *m.getLocalParticleCurrentVolume( ) );
+
+            ERROR_TOOLS_CATCH( logProbabilityRatios[ i ] = *m.getLocalParticleLogProbabilityRatio( ) );
+
+            // Quantities required for the gradient calculation
+
+            // Quantities required for the Hessian calculation
+
+            m.resetLocalParticleData( );
+
+        }
+
+    }
+
+    template < class model >
+    void aspBase::assembleSurfaceResponseLoop( model &m, const unsigned int &begin, const unsigned int &end, const unsigned int &numSurfacePoints,
+                                               const std::vector< std::vector< unsigned int > > &neighbors,
+                                               sparseSurfaceResponse &adhesionEnergyDensities, sparseSurfaceResponse &adhesionTractions,
+                                               sparseSurfaceResponse &adhesionThicknesses, sparseSurfaceResponse &overlapEnergyDensities,
+                                               sparseSurfaceResponse &overlapTractions, sparseSurfaceResponse &overlapThicknesses ){
+        /*!
+         * Append the surface responses of the local particles with indices in [begin, end) to initialized compressed
+         * quantities. The loop is shared by aspBase, which evaluates it for itself, and aspModel, which evaluates it for
+         * the derived model so that the model's functions are bound at compile time.
+         * 
+         * \param &m: The model whose surface responses are assembled
+         * \param &begin: The index of the first local particle
+         * \param &end: The index one past the last local particle
+         * \param &numSurfacePoints: The number of surface points on each local particle
+         * \param &neighbors: The non-local particles which may interact with each local particle
+         * \param &adhesionEnergyDensities: The surface adhesion energy densities
+         * \param &adhesionTractions: The surface adhesion tractions
+         * \param &adhesionThicknesses: The surface adhesion thicknesses
+         * \param &overlapEnergyDensities: The surface overlap energy densities
+         * \param &overlapTractions: The surface overlap tractions
+         * \param &overlapThicknesses: The surface overlap thicknesses
+         */
+
+        // Storage for the fused evaluation which is re-used for every pair
+        floatType adhesionEnergyDensity, adhesionThickness;
+
+        floatVector adhesionTraction;
+
+        mapFloatType overlapEnergyDensity, overlapThickness;
+
+        mapFloatVector overlapTraction;
+
+        for ( unsigned int i = begin; i < end; i++ ){
+
+            _localIndex = i; // Set the current local index
+
+            for ( unsigned int j = 0; j < numSurfacePoints; j++ ){
+
+                _localSurfaceNodeIndex = j; // Set the local surface node index
+
+                if ( _useBatchedCurrentDistances && ( _evaluationMode != HESSIAN ) && ( neighbors[ i ].size( ) > 0 ) ){
+
+                    ERROR_TOOLS_CATCH( m.formSurfacePointCurrentDistanceVectors( neighbors[ i ] ) );
+
+                }
+
+                for ( auto k = neighbors[ i ].begin( ); k != neighbors[ i ].end( ); k++ ){
+
+                    _nonLocalIndex = *k; // Set the interaction index
+
+                    if ( _useFusedSurfaceResponses ){
+
+                        {
+
+                            ASP_INSTRUMENT_STAGE( SURFACE_RESPONSES );
+
+                            ERROR_TOOLS_CATCH( m.computeSurfaceResponses( adhesionEnergyDensity, adhesionTraction, adhesionThickness,
+                                                                          overlapEnergyDensity, overlapTraction, overlapThickness ) );
+
+                        }
+
+                        ERROR_TOOLS_CATCH( adhesionEnergyDensities.appendPair( *k, adhesionEnergyDensity ) );
+
+                        ERROR_TOOLS_CATCH( adhesionThicknesses.appendPair( *k, adhesionThickness ) );
+
+                        ERROR_TOOLS_CATCH( overlapEnergyDensities.appendPair( *k, overlapEnergyDensity ) );
+
+                        ERROR_TOOLS_CATCH( overlapThicknesses.appendPair( *k, overlapThickness ) );
+
+                        if ( _evaluationMode != ENERGY ){
+
+                            ERROR_TOOLS_CATCH( adhesionTractions.appendPair( *k, adhesionTraction ) );
+
+                            ERROR_TOOLS_CATCH( overlapTractions.appendPair( *k, overlapTraction ) );
+
+                        }
+
+                    }
+                    else{
+
+                        // Quantities required for the energy calculation
+                        ERROR_TOOLS_CATCH( adhesionEnergyDensities.appendPair( *k, *m.getSurfaceAdhesionEnergyDensity( ) ) );
+
+                        ERROR_TOOLS_CATCH( adhesionThicknesses.appendPair( *k, *m.getSurfaceAdhesionThickness( ) ) );
+
+                        ERROR_TOOLS_CATCH( overlapEnergyDensities.appendPair( *k, *m.getSurfaceOverlapEnergyDensity( ) ) );
+
+                        ERROR_TOOLS_CATCH( overlapThicknesses.appendPair( *k, *m.getSurfaceOverlapThickness( ) ) );
+
+                        // Quantities required for the gradient calculation
+                        if ( _evaluationMode != ENERGY ){
+
+                            ERROR_TOOLS_CATCH( adhesionTractions.appendPair( *k, *m.getSurfaceAdhesionTraction( ) ) );
+
+                            ERROR_TOOLS_CATCH( overlapTractions.appendPair( *k, *m.getSurfaceOverlapTraction( ) ) );
+
+                        }
+
+                        // Quantities required for the Hessian calculation
+
+                    }
+
+                    m.resetInteractionPairData( );
+
+                }
+
+                adhesionEnergyDensities.closeRow( );
+
+                adhesionTractions.closeRow( );
+
+                adhesionThicknesses.closeRow( );
+
+                overlapEnergyDensities.closeRow( );
+
+                overlapTractions.closeRow( );
+
+                overlapThicknesses.closeRow( );
+
+                m.resetSurfacePointData( );
+
+            }
+
+            m.resetLocalParticleData( );
+
+        }
+
+    }
+
+    template < class model >
+    void aspModel< model >::computeSurfaceResponses( floatType &surfaceAdhesionEnergyDensity, floatVector &surfaceAdhesionTraction,
+                                                     floatType &surfaceAdhesionThickness, mapFloatType &surfaceOverlapEnergyDensity,
+                                                     mapFloatVector &surfaceOverlapTraction, mapFloatType &surfaceOverlapThickness ){
+        /*!
+         * Compute the surface adhesion and overlap responses of the current interaction pair from the individual response
+         * functions of the model. The tractions are not computed if the evaluation mode is ENERGY.
+         * 
+         * \param &surfaceAdhesionEnergyDensity: The surface adhesion energy density
+         * \param &surfaceAdhesionTraction: The surface adhesion traction
+         * \param &surfaceAdhesionThickness: The thickness of the surface adhesion
+         * \param &surfaceOverlapEnergyDensity: The map from the overlapping local surface points to the overlap energy density
+         * \param &surfaceOverlapTraction: The map from the overlapping local surface points to the overlap traction
+         * \param &surfaceOverlapThickness: The map from the overlapping local surface points to the overlap thickness
+         */
+
+        model &m = derived( );
+
+        surfaceOverlapEnergyDensity.clear( );
+
+        surfaceAdhesionTraction.clear( );
+
+        surfaceOverlapTraction.clear( );
+
+        ERROR_TOOLS_CATCH( m.computeSurfaceAdhesionEnergyDensity( surfaceAdhesionEnergyDensity ) );
+
+        ERROR_TOOLS_CATCH( surfaceAdhesionThickness = *getSurfaceAdhesionThickness( ) );
+
+        ERROR_TOOLS_CATCH( m.computeSurfaceOverlapEnergyDensity( surfaceOverlapEnergyDensity ) );
+
+        ERROR_TOOLS_CATCH( surfaceOverlapThickness = *getSurfaceOverlapThickness( ) );
+
+        if ( _evaluationMode != ENERGY ){
+
+            ERROR_TOOLS_CATCH( m.computeSurfaceAdhesionTraction( surfaceAdhesionTraction ) );
+
+            ERROR_TOOLS_CATCH( m.computeSurfaceOverlapTraction( surfaceOverlapTraction ) );
+
+        }
+
+    }
+
+    template < class model >
+    void aspModel< model >::assembleLocalParticleRange( const unsigned int &begin, const unsigned int &end,
+                                                        floatVector &energies, floatMatrix &microCauchyStresses,
+                                                        floatVector &volumes, floatVector &logProbabilityRatios ){
+        /*!
+         * Assemble the quantities of the local particles with indices in [begin, end) into pre-allocated arrays with
+         * the loop of aspBase evaluated for the model
+         * 
+         * \param &begin: The index of the first local particle
+         * \param &end: The index one past the last local particle
+         * \param &energies: The energies of all of the local particles
+         * \param &microCauchyStresses: The micro Cauchy stresses of all of the local particles
+         * \param &volumes: The current volumes of all of the local particles
+         * \param &logProbabilityRatios: The log probability ratios of all of the local particles
+         */
+
+        static_assert( std::is_final< model >::value, "A model which derives from aspModel< model > must be a final class" );
+
+        ERROR_TOOLS_CATCH( assembleLocalParticleLoop( derived( ), begin, end, energies, microCauchyStresses, volumes, logProbabilityRatios ) );
+
+    }
+
+    template < class model >
+    void aspModel< model >::assembleSurfaceResponseRange( const unsigned int &begin, const unsigned int &end, const unsigned int &numSurfacePoints,
+                                                          const std::vector< std::vector< unsigned int > > &neighbors,
+                                                          sparseSurfaceResponse &adhesionEnergyDensities, sparseSurfaceResponse &adhesionTractions,
+                                                          sparseSurfaceResponse &adhesionThicknesses, sparseSurfaceResponse &overlapEnergyDensities,
+                                                          sparseSurfaceResponse &overlapTractions, sparseSurfaceResponse &overlapThicknesses ){
+        /*!
+         * Append the surface responses of the local particles with indices in [begin, end) to initialized compressed
+         * quantities with the loop of aspBase evaluated for the model
+         * 
+         * \param &begin: The index of the first local particle
+         * \param &end: The index one past the last local particle
+         * \param &numSurfacePoints: The number of surface points on each local particle
+         * \param &neighbors: The non-local particles which may interact with each local particle
+         * \param &adhesionEnergyDensities: The surface adhesion energy densities
+         * \param &adhesionTractions: The surface adhesion tractions
+         * \param &adhesionThicknesses: The surface adhesion thicknesses
+         * \param &overlapEnergyDensities: The surface overlap energy densities
+         * \param &overlapTractions: The surface overlap tractions
+         * \param &overlapThicknesses: The surface overlap thicknesses
+         */
+
+        static_assert( std::is_final< model >::value, "A model which derives from aspModel< model > must be a final class" );
+
+        ERROR_TOOLS_CATCH( assembleSurfaceResponseLoop( derived( ), begin, end, numSurfacePoints, neighbors,
+                                                        adhesionEnergyDensities, adhesionTractions, adhesionThicknesses,
+                                                        overlapEnergyDensities, overlapTractions, overlapThicknesses ) );
+
+    }
+
 }
 
 #endif
@@ -7,6 +7,7 @@
   */
 
 #include<asp_umat.h>
+#include<iostream>
 
 extern "C" void umat_( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
                        double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
@@ -26,6 +27,8 @@ extern "C" void umat_( double *STRESS,       double *STATEV,       double *DDSDD
      * described in the Abaqus User's Manual > Introduction & Spatial Modeling > Input Syntax Rules and the sample
      * Fortran UMAT in the Abaqus User's Manual > User Subroutines > Abaqus/Standard User Subroutines > UMAT.
      *
+     * The interface is reentrant and may be called concurrently by the threads of a multi-threaded Abaqus analysis.
+     *
      * \param *STRESS: Cauchy stress tensor at beginning of time increment stored in vector form, \f$ \sigma \f$.
      * \param *STATEV: State variable vector.
      * \param *DDSDDE: Jacobian matrix \f$ \frac{\delta \Delta \sigma}{\delta \Delta \epsilon} \f$.
@@ -65,16 +68,157 @@ extern "C" void umat_( double *STRESS,       double *STATEV,       double *DDSDD
      * \param &KINC: Increment number.
      */
 
+#ifdef ASP_INSTRUMENTATION
+     //Time the call as one integration point. The counters are added to those of the calling thread after the timer
+     //is destroyed so that the recording is not included in the time.
+     asp::instrumentationCounters counters;
+     {
+     asp::instrumentationTimer timer( counters, asp::ABAQUS_UMAT );
+#endif
+
      //Add switching logic to handle more than one UMAT.
-     //Call the appropriate UMAT interface
-     asp::abaqusInterface( STRESS, STATEV, DDSDDE,    SSE,    SPD,
-                                  SCD,    RPL, DDSDDT, DRPLDE, DRPLDT,
-                                STRAN, DSTRAN,   TIME,  DTIME,   TEMP,
-                                DTEMP, PREDEF,  DPRED, CMNAME,    NDI,
-                                 NSHR,  NTENS, NSTATV,  PROPS, NPROPS,
-                               COORDS,   DROT, PNEWDT, CELENT, DFGRD0,
-                               DFGRD1,   NOEL,    NPT,  LAYER,   KSPT,
-                                JSTEP,   KINC );
+     //Call the appropriate UMAT interface. The view interface operates directly on the Fortran memory.
+     asp::abaqusViewInterface( STRESS, STATEV, DDSDDE,    SSE,    SPD,
+                                      SCD,    RPL, DDSDDT, DRPLDE, DRPLDT,
+                                    STRAN, DSTRAN,   TIME,  DTIME,   TEMP,
+                                    DTEMP, PREDEF,  DPRED, CMNAME,    NDI,
+                                     NSHR,  NTENS, NSTATV,  PROPS, NPROPS,
+                                   COORDS,   DROT, PNEWDT, CELENT, DFGRD0,
+                                   DFGRD1,   NOEL,    NPT,  LAYER,   KSPT,
+                                    JSTEP,   KINC );
+
+#ifdef ASP_INSTRUMENTATION
+     }
+     asp::recordInstrumentation( counters );
+#endif
+
+     return;
+}
+
+extern "C" void vumat_( const int &nblock,          const int &ndir,             const int &nshr,             const int &nstatev,
+                        const int &nfieldv,         const int &nprops,           const int &lanneal,          const double &stepTime,
+                        const double &totalTime,    const double &dt,            const char *cmname,          const double *coordMp,
+                        const double *charLength,   const double *props,         const double *density,       const double *strainInc,
+                        const double *relSpinInc,   const double *tempOld,       const double *stretchOld,    const double *defgradOld,
+                        const double *fieldOld,     const double *stressOld,     const double *stateOld,      const double *enerInternOld,
+                        const double *enerInelasOld, const double *tempNew,      const double *stretchNew,    const double *defgradNew,
+                        const double *fieldNew,     double *stressNew,           double *stateNew,            double *enerInternNew,
+                        double *enerInelasNew ){
+    /*!
+     * A template Abaqus VUMAT c++ interface which evaluates a block of material points.
+     *
+     * The variables defined in this interface are described more completely in the Abaqus User Subroutines
+     * manual entry for VUMAT user subroutines. The arrays with a value for each point have the point as the leading
+     * dimension, e.g. component i of the stress of point b is stressNew[ b + nblock * i ].
+     *
+     * Abaqus/Explicit parallelizes the analysis over domains so the points of a block are evaluated serially.
+     *
+     * \param &nblock: Number of material points in the block.
+     * \param &ndir: Number of direct components of a symmetric tensor.
+     * \param &nshr: Number of indirect components of a symmetric tensor.
+     * \param &nstatev: Number of state variables for this material, cmname.
+     * \param &nfieldv: Number of user-defined external field variables.
+     * \param &nprops: Number of user defined material constants.
+     * \param &lanneal: Flag indicating whether the routine is being called during an annealing process.
+     * \param &stepTime: Value of the step time at the start of the increment.
+     * \param &totalTime: Value of the total time at the start of the increment.
+     * \param &dt: Time increment size.
+     * \param *cmname: User defined material name. Left justified as passed by FORTRAN.
+     * \param *coordMp: Material point coordinates.
+     * \param *charLength: Characteristic element length.
+     * \param *props: Material model constants defined as part of the *MATERIAL keyword in the input file.
+     * \param *density: Current density at the material points.
+     * \param *strainInc: Strain increment tensor at each material point.
+     * \param *relSpinInc: Incremental relative rotation vector at each material point.
+     * \param *tempOld: Temperatures at the start of the increment.
+     * \param *stretchOld: Stretch tensor at the start of the increment.
+     * \param *defgradOld: Deformation gradient tensor at the start of the increment.
+     * \param *fieldOld: Values of the user-defined field variables at the start of the increment.
+     * \param *stressOld: Stress tensor at the start of the increment.
+     * \param *stateOld: State variables at the start of the increment.
+     * \param *enerInternOld: Internal energy per unit mass at the start of the increment.
+     * \param *enerInelasOld: Dissipated inelastic energy per unit mass at the start of the increment.
+     * \param *tempNew: Temperatures at the end of the increment.
+     * \param *stretchNew: Stretch tensor at the end of the increment.
+     * \param *defgradNew: Deformation gradient tensor at the end of the increment.
+     * \param *fieldNew: Values of the user-defined field variables at the end of the increment.
+     * \param *stressNew: Stress tensor at the end of the increment.
+     * \param *stateNew: State variables at the end of the increment.
+     * \param *enerInternNew: Internal energy per unit mass at the end of the increment.
+     * \param *enerInelasNew: Dissipated inelastic energy per unit mass at the end of the increment.
+     */
+
+     asp::materialPointBlock block;
+
+     block.nblock = nblock;
+     block.ndir = ndir;
+     block.nshr = nshr;
+     block.nstatev = nstatev;
+     block.nfieldv = nfieldv;
+     block.nprops = nprops;
+     block.lanneal = lanneal;
+     block.stepTime = stepTime;
+     block.totalTime = totalTime;
+     block.dt = dt;
+     block.cmname = cmname;
+     block.coordMp = coordMp;
+     block.charLength = charLength;
+     block.props = props;
+     block.density = density;
+     block.strainInc = strainInc;
+     block.relSpinInc = relSpinInc;
+     block.tempOld = tempOld;
+     block.stretchOld = stretchOld;
+     block.defgradOld = defgradOld;
+     block.fieldOld = fieldOld;
+     block.stressOld = stressOld;
+     block.stateOld = stateOld;
+     block.enerInternOld = enerInternOld;
+     block.enerInelasOld = enerInelasOld;
+     block.tempNew = tempNew;
+     block.stretchNew = stretchNew;
+     block.defgradNew = defgradNew;
+     block.fieldNew = fieldNew;
+     block.stressNew = stressNew;
+     block.stateNew = stateNew;
+     block.enerInternNew = enerInternNew;
+     block.enerInelasNew = enerInelasNew;
+
+     //Add switching logic to handle more than one VUMAT.
+     asp::abaqusBlockInterface( block );
+
+     return;
+}
+
+extern "C" void uexternaldb_( const int &LOP, const int &LRESTART, const double *TIME, const double &DTIME,
+                              const int &KSTEP, const int &KINC ){
+    /*!
+     * The Abaqus UEXTERNALDB interface. Commits the trial states of the integration points at the end of each converged
+     * increment. With ASP_INSTRUMENTATION the instrumentation counters recorded by the process are written to the
+     * standard output (the Abaqus log file) at the end of the analysis.
+     *
+     * \param &LOP: Flag for when the subroutine is called. A value of 2 is the end of an increment and 3 is the end of
+     *     the analysis.
+     * \param &LRESTART: Flag for whether restart data is being written.
+     * \param *TIME: Time vector = {Step time, Total time}.
+     * \param &DTIME: Time increment.
+     * \param &KSTEP: Step number.
+     * \param &KINC: Increment number.
+     */
+
+     if ( LOP == 2 ){
+
+         asp::getIntegrationPointStateCache( ).commit( );
+
+     }
+
+#ifdef ASP_INSTRUMENTATION
+     if ( LOP == 3 ){
+
+         asp::getRecordedInstrumentation( ).write( std::cout );
+
+     }
+#endif
 
      return;
 }
@@ -20,4 +20,17 @@ extern "C" void UMAT( double *STRESS,       double *STATEV,       double *DDSDDE
                       const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
                       const int *JSTEP,     const int &KINC );
 
+extern "C" void vumat_( const int &nblock,          const int &ndir,             const int &nshr,             const int &nstatev,
+                        const int &nfieldv,         const int &nprops,           const int &lanneal,          const double &stepTime,
+                        const double &totalTime,    const double &dt,            const char *cmname,          const double *coordMp,
+                        const double *charLength,   const double *props,         const double *density,       const double *strainInc,
+                        const double *relSpinInc,   const double *tempOld,       const double *stretchOld,    const double *defgradOld,
+                        const double *fieldOld,     const double *stressOld,     const double *stateOld,      const double *enerInternOld,
+                        const double *enerInelasOld, const double *tempNew,      const double *stretchNew,    const double *defgradNew,
+                        const double *fieldNew,     double *stressNew,           double *stateNew,            double *enerInternNew,
+                        double *enerInelasNew );
+
+extern "C" void uexternaldb_( const int &LOP, const int &LRESTART, const double *TIME, const double &DTIME,
+                              const int &KSTEP, const int &KINC );
+
 #endif
@@ -0,0 +1,340 @@
+/**
+  * \file benchmark_asp.cpp
+  *
+  * Micro-benchmarks for the assembly of the local particles and surface responses of asp
+  */
+
+#include<asp.h>
+
+#include<benchmark/benchmark.h>
+
+typedef asp::floatType floatType; //!< Redefinition of the float type
+typedef asp::floatVector floatVector; //!< Redefinition of a vector of floats
+typedef asp::floatMatrix floatMatrix; //!< Redefinition of a matrix of floats
+
+// Tester to open the private members of aspBase which have no protected setter
+namespace asp{
+
+    namespace unit_test{
+
+        class aspBaseTester{
+
+            public:
+
+                static void set_numLocalParticles( asp::aspBase &asp, const unsigned int &value ){
+
+                    asp._numLocalParticles = value;
+
+                }
+
+                static void resetAssembledData( asp::aspBase &asp ){
+
+                    asp.resetAssembledData( );
+
+                }
+
+        };
+
+    }
+
+}
+
+namespace{
+
+    class aspBaseBenchmark : public asp::aspBase{
+        /*!
+         * An ASP whose particle and surface kernels are trivial so that the cost of the assembly itself is measured
+         */
+
+        public:
+
+            aspBaseBenchmark( const unsigned int &numLocalParticles, const unsigned int &surfaceElementCount,
+                              const unsigned int &numNeighbors, const unsigned int &numThreads ) : aspBase( ){
+                /*!
+                 * \param &numLocalParticles: The number of local particles
+                 * \param &surfaceElementCount: The number of surface elements along each edge of the base cube
+                 * \param &numNeighbors: The number of neighbors of each local particle (including itself)
+                 * \param &numThreads: The number of assembly threads
+                 */
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+                _surfaceElementCount = surfaceElementCount;
+
+                _numAssemblyThreads = numThreads;
+
+                // Each particle interacts with itself and the following particles
+                neighbors.resize( numLocalParticles );
+
+                for ( unsigned int i = 0; i < numLocalParticles; i++ ){
+
+                    for ( unsigned int j = 0; j < std::min( numNeighbors, numLocalParticles ); j++ ){
+
+                        neighbors[ i ].push_back( ( i + j ) % numLocalParticles );
+
+                    }
+
+                }
+
+            }
+
+        private:
+
+            std::vector< std::vector< unsigned int > > neighbors;
+
+            floatType value( ){
+
+                return 1 + *getLocalIndex( ) + 1e-3 * ( *getLocalSurfaceNodeIndex( ) ) + 1e-6 * ( *getNonLocalIndex( ) );
+
+            }
+
+            virtual std::unique_ptr< asp::aspBase > createAssemblyWorker( ) const{
+
+                return std::unique_ptr< asp::aspBase >( new aspBaseBenchmark( *this ) );
+
+            }
+
+            virtual void setLocalParticleNeighbors( ){
+
+                asp::aspBase::setLocalParticleNeighbors( neighbors );
+
+            }
+
+            virtual void setLocalParticleEnergy( ){
+
+                asp::aspBase::setLocalParticleEnergy( 1. + *getLocalIndex( ) );
+
+            }
+
+            virtual void setLocalParticleQuantities( ){
+
+                const floatType index = *getLocalIndex( );
+
+                asp::aspBase::setLocalParticleEnergyDensity( index );
+
+                asp::aspBase::setLocalParticleMicroCauchyStress( floatVector( 9, index ) );
+
+                asp::aspBase::setLocalParticleCurrentVolume( 1. + index );
+
+                asp::aspBase::setLocalParticleLogProbabilityRatio( -index );
+
+            }
+
+            virtual void setSurfaceAdhesionEnergyDensity( ){
+
+                asp::aspBase::setSurfaceAdhesionEnergyDensity( value( ) );
+
+            }
+
+            virtual void setSurfaceAdhesionTraction( ){
+
+                const floatType v = value( );
+
+                asp::aspBase::setSurfaceAdhesionTraction( { v, 2 * v, 3 * v } );
+
+            }
+
+            virtual void setSurfaceAdhesionThickness( ){
+
+                asp::aspBase::setSurfaceAdhesionThickness( -value( ) );
+
+            }
+
+            virtual void setSurfaceOverlapEnergyDensity( ){
+
+                asp::aspBase::setSurfaceOverlapEnergyDensity( asp::mapFloatType( { { *getNonLocalIndex( ), value( ) } } ) );
+
+            }
+
+            virtual void setSurfaceOverlapTraction( ){
+
+                const floatType v = value( );
+
+                asp::aspBase::setSurfaceOverlapTraction( asp::mapFloatVector( { { *getNonLocalIndex( ), { v, 0, -v } } } ) );
+
+            }
+
+            virtual void setSurfaceOverlapThickness( ){
+
+                asp::aspBase::setSurfaceOverlapThickness( asp::mapFloatType( { { *getNonLocalIndex( ), value( ) } } ) );
+
+            }
+
+    };
+
+    class aspModelBenchmark final : public asp::aspModel< aspModelBenchmark >{
+        /*!
+         * The same trivial kernels as aspBaseBenchmark evaluated by a statically dispatched model so that the cost of the
+         * virtual dispatch of the pair loop can be compared
+         */
+
+        public:
+
+            aspModelBenchmark( const unsigned int &numLocalParticles, const unsigned int &surfaceElementCount,
+                               const unsigned int &numNeighbors, const unsigned int &numThreads ) : aspModel< aspModelBenchmark >( ){
+                /*!
+                 * \param &numLocalParticles: The number of local particles
+                 * \param &surfaceElementCount: The number of surface elements along each edge of the base cube
+                 * \param &numNeighbors: The number of neighbors of each local particle (including itself)
+                 * \param &numThreads: The number of assembly threads
+                 */
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+                _surfaceElementCount = surfaceElementCount;
+
+                _numAssemblyThreads = numThreads;
+
+                neighbors.resize( numLocalParticles );
+
+                for ( unsigned int i = 0; i < numLocalParticles; i++ ){
+
+                    for ( unsigned int j = 0; j < std::min( numNeighbors, numLocalParticles ); j++ ){
+
+                        neighbors[ i ].push_back( ( i + j ) % numLocalParticles );
+
+                    }
+
+                }
+
+            }
+
+            virtual void computeSurfaceResponses( floatType &surfaceAdhesionEnergyDensity, floatVector &surfaceAdhesionTraction,
+                                                  floatType &surfaceAdhesionThickness, asp::mapFloatType &surfaceOverlapEnergyDensity,
+                                                  asp::mapFloatVector &surfaceOverlapTraction, asp::mapFloatType &surfaceOverlapThickness ) override{
+
+                const floatType v = 1 + *getLocalIndex( ) + 1e-3 * ( *getLocalSurfaceNodeIndex( ) ) + 1e-6 * ( *getNonLocalIndex( ) );
+
+                surfaceAdhesionEnergyDensity = v;
+
+                surfaceAdhesionTraction = { v, 2 * v, 3 * v };
+
+                surfaceAdhesionThickness = -v;
+
+                surfaceOverlapEnergyDensity = asp::mapFloatType( { { *getNonLocalIndex( ), v } } );
+
+                surfaceOverlapTraction = asp::mapFloatVector( { { *getNonLocalIndex( ), { v, 0, -v } } } );
+
+                surfaceOverlapThickness = asp::mapFloatType( { { *getNonLocalIndex( ), v } } );
+
+            }
+
+        private:
+
+            std::vector< std::vector< unsigned int > > neighbors;
+
+            virtual void setLocalParticleNeighbors( ){
+
+                asp::aspBase::setLocalParticleNeighbors( neighbors );
+
+            }
+
+    };
+
+}
+
+static void BM_assembleLocalParticles( benchmark::State &state ){
+    /*!
+     * Assemble the responses of the local particles
+     *
+     * Argument 0: The number of local particles
+     * Argument 1: The number of threads
+     */
+
+    const unsigned int numLocalParticles = state.range( 0 );
+
+    const unsigned int numThreads = state.range( 1 );
+
+    aspBaseBenchmark asp( numLocalParticles, 1, 1, numThreads );
+
+    for ( auto _ : state ){
+
+        asp::unit_test::aspBaseTester::resetAssembledData( asp );
+
+        benchmark::DoNotOptimize( asp.getAssembledLocalParticleEnergies( ) );
+
+        benchmark::DoNotOptimize( asp.getAssembledLocalParticleMicroCauchyStresses( ) );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * numLocalParticles );
+
+}
+BENCHMARK( BM_assembleLocalParticles )->ArgsProduct( { { 1, 8, 64, 512 }, { 1 } } );
+BENCHMARK( BM_assembleLocalParticles )->ArgsProduct( { { 512 }, { 2, 4, 8 } } )->UseRealTime( );
+
+static void BM_assembleSurfaceResponses( benchmark::State &state ){
+    /*!
+     * Assemble the surface responses of all of the interacting pairs
+     *
+     * Argument 0: The number of local particles
+     * Argument 1: The number of surface elements along each edge of the base cube of the unit sphere
+     * Argument 2: The number of neighbors of each particle
+     * Argument 3: The number of threads
+     */
+
+    const unsigned int numLocalParticles = state.range( 0 );
+
+    const unsigned int surfaceElementCount = state.range( 1 );
+
+    const unsigned int numNeighbors = state.range( 2 );
+
+    const unsigned int numThreads = state.range( 3 );
+
+    aspBaseBenchmark asp( numLocalParticles, surfaceElementCount, numNeighbors, numThreads );
+
+    unsigned int numPairs = 0;
+
+    for ( auto _ : state ){
+
+        asp::unit_test::aspBaseTester::resetAssembledData( asp );
+
+        const asp::sparseSurfaceResponse *energies = asp.getAssembledSparseSurfaceAdhesionEnergyDensities( );
+
+        benchmark::DoNotOptimize( asp.getAssembledSparseSurfaceOverlapTractions( ) );
+
+        numPairs = energies->nonLocalIndices.size( );
+
+    }
+
+    state.counters[ "pairs" ] = numPairs;
+
+    state.SetItemsProcessed( state.iterations( ) * numPairs );
+
+}
+BENCHMARK( BM_assembleSurfaceResponses )->ArgsProduct( { { 1, 8, 64 }, { 1, 2, 4 }, { 4 }, { 1 } } );
+BENCHMARK( BM_assembleSurfaceResponses )->ArgsProduct( { { 64 }, { 4 }, { 4 }, { 2, 4, 8 } } )->UseRealTime( );
+
+static void BM_assembleSurfaceResponsesStatic( benchmark::State &state ){
+    /*!
+     * Assemble the surface responses of all of the interacting pairs of a statically dispatched model
+     *
+     * Argument 0: The number of local particles
+     * Argument 1: The number of surface elements along each edge of the base cube of the unit sphere
+     * Argument 2: The number of neighbors of each particle
+     */
+
+    aspModelBenchmark asp( state.range( 0 ), state.range( 1 ), state.range( 2 ), 1 );
+
+    unsigned int numPairs = 0;
+
+    for ( auto _ : state ){
+
+        asp::unit_test::aspBaseTester::resetAssembledData( asp );
+
+        const asp::sparseSurfaceResponse *energies = asp.getAssembledSparseSurfaceAdhesionEnergyDensities( );
+
+        benchmark::DoNotOptimize( asp.getAssembledSparseSurfaceOverlapTractions( ) );
+
+        numPairs = energies->nonLocalIndices.size( );
+
+    }
+
+    state.counters[ "pairs" ] = numPairs;
+
+    state.SetItemsProcessed( state.iterations( ) * numPairs );
+
+}
+BENCHMARK( BM_assembleSurfaceResponsesStatic )->ArgsProduct( { { 1, 8, 64 }, { 1, 2, 4 }, { 4 } } );
+
+BENCHMARK_MAIN( );
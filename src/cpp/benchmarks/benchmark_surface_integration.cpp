@@ -0,0 +1,135 @@
+/**
+  * \file benchmark_surface_integration.cpp
+  *
+  * Micro-benchmarks for the surface integration support module
+  */
+
+#include<surface_integration.h>
+
+#include<benchmark/benchmark.h>
+
+typedef surfaceIntegration::floatType floatType; //!< Redefinition for the float type
+typedef surfaceIntegration::floatVector floatVector; //!< Redefinition for the float vector
+typedef surfaceIntegration::floatMatrix floatMatrix; //!< Redefinition for the float matrix
+
+static void BM_decomposeSphere( benchmark::State &state ){
+    /*!
+     * Decompose the sphere into a quadratic surface mesh
+     *
+     * Argument 0: The number of elements along the edge of the base cube
+     */
+
+    const unsigned int elementCount = state.range( 0 );
+
+    const floatType radius = 1.3;
+
+    for ( auto _ : state ){
+
+        floatVector points;
+
+        std::vector< unsigned int > connectivity;
+
+        surfaceIntegration::decomposeSphere( radius, elementCount, points, connectivity );
+
+        benchmark::DoNotOptimize( points.data( ) );
+
+    }
+
+    state.counters[ "elements" ] = 6 * elementCount * elementCount;
+
+}
+BENCHMARK( BM_decomposeSphere )->Arg( 1 )->Arg( 2 )->Arg( 4 )->Arg( 8 )->Arg( 16 );
+
+static void BM_getUnitSphereQuadrature( benchmark::State &state ){
+    /*!
+     * Look up the cached unit sphere integration tables
+     *
+     * Argument 0: The number of elements along the edge of the base cube
+     */
+
+    const unsigned int elementCount = state.range( 0 );
+
+    for ( auto _ : state ){
+
+        benchmark::DoNotOptimize( &surfaceIntegration::getUnitSphereQuadrature( elementCount ) );
+
+    }
+
+}
+BENCHMARK( BM_getUnitSphereQuadrature )->Arg( 2 )->Arg( 8 );
+
+static void BM_integrateMesh( benchmark::State &state ){
+    /*!
+     * Integrate a vector and a scalar field over the decomposed sphere
+     *
+     * Argument 0: The number of elements along the edge of the base cube
+     * Argument 1: The Gauss quadrature order
+     * Argument 2: The number of threads
+     */
+
+    const unsigned int elementCount = state.range( 0 );
+
+    const unsigned int quadratureOrder = state.range( 1 );
+
+    const unsigned int numThreads = state.range( 2 );
+
+    floatVector points;
+
+    std::vector< unsigned int > connectivity;
+
+    surfaceIntegration::decomposeSphere( 1.3, elementCount, points, connectivity );
+
+    // Integrate a vector and a scalar field at once
+    floatVector scalarField( points.size( ) / 3 );
+
+    for ( unsigned int i = 0; i < scalarField.size( ); i++ ){
+
+        scalarField[ i ] = points[ 3 * i + 0 ] * points[ 3 * i + 1 ] + points[ 3 * i + 2 ];
+
+    }
+
+    const floatMatrix nodalValues = { points, scalarField };
+
+    for ( auto _ : state ){
+
+        floatMatrix answer;
+
+        surfaceIntegration::integrateMesh( points, connectivity, nodalValues, quadratureOrder, answer, numThreads );
+
+        benchmark::DoNotOptimize( answer.data( ) );
+
+    }
+
+    state.counters[ "elements" ] = connectivity.size( ) / 9;
+
+}
+BENCHMARK( BM_integrateMesh )->ArgsProduct( { { 1, 2, 4, 8, 16 }, { 2, 3 }, { 1 } } );
+BENCHMARK( BM_integrateMesh )->ArgsProduct( { { 16 }, { 3 }, { 2, 4, 8 } } )->UseRealTime( );
+
+static void BM_integrateSphere( benchmark::State &state ){
+    /*!
+     * Integrate a scalar field over a sphere using the cached tables
+     *
+     * Argument 0: The number of elements along the edge of the base cube
+     */
+
+    const unsigned int elementCount = state.range( 0 );
+
+    const surfaceIntegration::unitSphereQuadrature &quadrature = surfaceIntegration::getUnitSphereQuadrature( elementCount );
+
+    floatVector nodalValues( quadrature.nodalWeights.size( ), 1 );
+
+    for ( auto _ : state ){
+
+        floatVector answer;
+
+        surfaceIntegration::integrateSphere( quadrature, 1.3, nodalValues, answer );
+
+        benchmark::DoNotOptimize( answer.data( ) );
+
+    }
+
+}
+BENCHMARK( BM_integrateSphere )->Arg( 2 )->Arg( 8 )->Arg( 16 );
+
+BENCHMARK_MAIN( );
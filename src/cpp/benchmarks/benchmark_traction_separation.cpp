@@ -0,0 +1,332 @@
+/**
+  * \file benchmark_traction_separation.cpp
+  *
+  * Micro-benchmarks for the traction separation support module
+  */
+
+#include<traction_separation.h>
+#include<cmath>
+
+#include<benchmark/benchmark.h>
+
+typedef tractionSeparation::floatType floatType; //!< Redefinition for the float type
+typedef tractionSeparation::floatVector floatVector; //!< Redefinition for the float vector
+typedef tractionSeparation::floatMatrix floatMatrix; //!< Redefinition for the float matrix
+
+namespace{
+
+    const unsigned int dim = 3; //!< The spatial dimension
+
+    const floatVector F = { 0.39211752, 0.34317802, 0.72904971,
+                            0.43857224, 0.0596779 , 0.39804426,
+                            0.73799541, 0.18249173, 0.17545176 }; //!< The deformation gradient
+
+    const floatVector chi = { 0.53155137, 0.53182759, 0.63440096,
+                              0.84943179, 0.72445532, 0.61102351,
+                              0.72244338, 0.32295891, 0.36178866 }; //!< The micro-deformation tensor
+
+    const floatVector chi_nl = { 1.69646919, 0.28613933, 0.22685145,
+                                 0.55131477, 1.71946897, 0.42310646,
+                                 0.9807642 , 0.68482974, 1.4809319 }; //!< The non-local micro-deformation tensor
+
+    const floatType R_nl = 2.3; //!< The non-local particle radius
+
+    floatVector formGradChi( ){
+        /*!
+         * Form a non-trivial gradient of the micro-deformation
+         */
+
+        floatVector gradChi( dim * dim * dim );
+
+        for ( unsigned int i = 0; i < gradChi.size( ); i++ ){
+
+            gradChi[ i ] = 0.1 * i - 1;
+
+        }
+
+        return gradChi;
+
+    }
+
+    floatVector formPoints( const unsigned int &numPoints, const floatType &scale ){
+        /*!
+         * Form a deterministic set of points stored point by point inside of a ball of radius scale
+         *
+         * \param &numPoints: The number of points
+         * \param &scale: The size of the region containing the points
+         */
+
+        floatVector points( dim * numPoints );
+
+        for ( unsigned int p = 0; p < numPoints; p++ ){
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                points[ dim * p + i ] = scale * std::sin( 1.7 * ( p + 1 ) + 2.3 * i ) / std::sqrt( dim );
+
+            }
+
+        }
+
+        return points;
+
+    }
+
+}
+
+static void BM_computeCurrentDistance( benchmark::State &state ){
+    /*!
+     * Compute the current distance between two points on neighboring particles
+     */
+
+    const floatVector Xi_1 = { 0.69646919, 0.28613933, 0.22685145 };
+
+    const floatVector Xi_2 = { 0.43857224, 0.0596779 , 0.39804426 };
+
+    const floatVector D = { 0.72244338, 0.32295891, 0.36178866 };
+
+    const floatVector gradChi = formGradChi( );
+
+    for ( auto _ : state ){
+
+        floatVector d;
+
+        tractionSeparation::computeCurrentDistance( Xi_1, Xi_2, D, F, chi, gradChi, d );
+
+        benchmark::DoNotOptimize( d.data( ) );
+
+    }
+
+}
+BENCHMARK( BM_computeCurrentDistance );
+
+static void BM_computeCurrentDistanceGeneral( benchmark::State &state ){
+    /*!
+     * Compute the current distance between two points on neighboring particles using the non-local micro-deformation
+     */
+
+    const floatVector Xi_1 = { 0.69646919, 0.28613933, 0.22685145 };
+
+    const floatVector Xi_2 = { 0.43857224, 0.0596779 , 0.39804426 };
+
+    const floatVector D = { 0.72244338, 0.32295891, 0.36178866 };
+
+    for ( auto _ : state ){
+
+        floatVector d;
+
+        tractionSeparation::computeCurrentDistanceGeneral( Xi_1, Xi_2, D, F, chi, chi_nl, d );
+
+        benchmark::DoNotOptimize( d.data( ) );
+
+    }
+
+}
+BENCHMARK( BM_computeCurrentDistanceGeneral );
+
+static void BM_computeCurrentDistanceBatch( benchmark::State &state ){
+    /*!
+     * Compute the current distances of many pairs of points at once
+     *
+     * Argument 0: The number of points
+     */
+
+    const unsigned int numPoints = state.range( 0 );
+
+    const floatVector Xi_1 = formPoints( numPoints, 1.0 );
+
+    const floatVector Xi_2 = formPoints( numPoints, 0.5 );
+
+    const floatVector D( dim * numPoints, 0.5 );
+
+    const floatVector gradChi = formGradChi( );
+
+    for ( auto _ : state ){
+
+        floatVector d;
+
+        tractionSeparation::computeCurrentDistanceBatch( numPoints, Xi_1, Xi_2, D, F, chi, gradChi, d );
+
+        benchmark::DoNotOptimize( d.data( ) );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * numPoints );
+
+}
+BENCHMARK( BM_computeCurrentDistanceBatch )->RangeMultiplier( 4 )->Range( 1, 1024 );
+
+static void BM_solveOverlapDistance( benchmark::State &state ){
+    /*!
+     * Solve for the distance from a point to the surface of a non-local particle
+     */
+
+    const floatVector xi_t = { 0.39211752, 0.34317802, 0.72904971 };
+
+    for ( auto _ : state ){
+
+        floatVector d;
+
+        tractionSeparation::solveOverlapDistance( chi_nl, xi_t, R_nl, d );
+
+        benchmark::DoNotOptimize( d.data( ) );
+
+    }
+
+}
+BENCHMARK( BM_solveOverlapDistance );
+
+static void BM_solveOverlapDistance_warmStart( benchmark::State &state ){
+    /*!
+     * Solve for the distance from a point to the surface of a non-local particle starting from the converged solution
+     */
+
+    const floatVector xi_t = { 0.39211752, 0.34317802, 0.72904971 };
+
+    floatVector X0, d;
+
+    tractionSeparation::solveOverlapDistance( chi_nl, xi_t, R_nl, X0, d );
+
+    for ( auto _ : state ){
+
+        floatVector X = X0;
+
+        tractionSeparation::solveOverlapDistance( chi_nl, xi_t, R_nl, X, d );
+
+        benchmark::DoNotOptimize( d.data( ) );
+
+    }
+
+}
+BENCHMARK( BM_solveOverlapDistance_warmStart );
+
+static void BM_solveOverlapDistance_gradients( benchmark::State &state ){
+    /*!
+     * Solve for the distance from a point to the surface of a non-local particle and its gradients
+     */
+
+    const floatVector xi_t = { 0.39211752, 0.34317802, 0.72904971 };
+
+    for ( auto _ : state ){
+
+        floatVector d, dddR_nl;
+
+        floatMatrix dddchi_nl, dddxi_t;
+
+        tractionSeparation::solveOverlapDistance( chi_nl, xi_t, R_nl, d, dddchi_nl, dddxi_t, dddR_nl );
+
+        benchmark::DoNotOptimize( d.data( ) );
+
+    }
+
+}
+BENCHMARK( BM_solveOverlapDistance_gradients );
+
+static void BM_solveOverlapDistanceBatch( benchmark::State &state ){
+    /*!
+     * Solve for the overlap distances of many points inside of the same non-local particle
+     *
+     * Argument 0: The number of points
+     */
+
+    const unsigned int numPoints = state.range( 0 );
+
+    const floatVector xi_t = formPoints( numPoints, 0.25 * R_nl );
+
+    for ( auto _ : state ){
+
+        floatVector X, d;
+
+        tractionSeparation::solveOverlapDistanceBatch( numPoints, chi_nl, xi_t, R_nl, X, d );
+
+        benchmark::DoNotOptimize( d.data( ) );
+
+    }
+
+    state.SetItemsProcessed( state.iterations( ) * numPoints );
+
+}
+BENCHMARK( BM_solveOverlapDistanceBatch )->RangeMultiplier( 4 )->Range( 1, 1024 );
+
+static void BM_computeParticleOverlap( benchmark::State &state ){
+    /*!
+     * Compute the overlap of a point on the local particle with a non-local particle
+     *
+     * Argument 0: Zero if the point is outside of the non-local particle and one if it overlaps
+     */
+
+    const bool overlapping = state.range( 0 );
+
+    const floatVector Xi_1 = { 1, 0, 0 };
+
+    const floatVector dX = { 2, 0, 0 };
+
+    const floatType R = 1;
+
+    const floatVector F_overlap = { 0.75, 0.0, 0.0,
+                                    0.00, 1.0, 0.0,
+                                    0.00, 0.0, 1.0 };
+
+    const floatVector F_separated = { 1.25, 0.0, 0.0,
+                                      0.00, 1.0, 0.0,
+                                      0.00, 0.0, 1.0 };
+
+    const floatVector chi_eye = { 1.0, 0.0, 0.0,
+                                  0.0, 1.0, 0.0,
+                                  0.0, 0.0, 1.0 };
+
+    const floatVector gradChi( dim * dim * dim, 0 );
+
+    const floatVector &F_used = overlapping ? F_overlap : F_separated;
+
+    for ( auto _ : state ){
+
+        floatVector overlap;
+
+        tractionSeparation::computeParticleOverlap( Xi_1, dX, R, F_used, chi_eye, gradChi, overlap );
+
+        benchmark::DoNotOptimize( overlap.data( ) );
+
+    }
+
+}
+BENCHMARK( BM_computeParticleOverlap )->Arg( 0 )->Arg( 1 );
+
+static void BM_computeParticleOverlap_gradients( benchmark::State &state ){
+    /*!
+     * Compute the overlap of a point on the local particle with a non-local particle and its gradients
+     */
+
+    const floatVector Xi_1 = { 1, 0, 0 };
+
+    const floatVector dX = { 2, 0, 0 };
+
+    const floatType R = 1;
+
+    const floatVector F_overlap = { 0.75, 0.0, 0.0,
+                                    0.00, 1.0, 0.0,
+                                    0.00, 0.0, 1.0 };
+
+    const floatVector chi_eye = { 1.0, 0.0, 0.0,
+                                  0.0, 1.0, 0.0,
+                                  0.0, 0.0, 1.0 };
+
+    const floatVector gradChi( dim * dim * dim, 0 );
+
+    for ( auto _ : state ){
+
+        floatVector overlap, dOverlapdR_nl;
+
+        floatMatrix dOverlapdXi_1, dOverlapddX, dOverlapdF, dOverlapdChi, dOverlapdGradChi;
+
+        tractionSeparation::computeParticleOverlap( Xi_1, dX, R, F_overlap, chi_eye, gradChi, overlap,
+                                                    dOverlapdXi_1, dOverlapddX, dOverlapdR_nl, dOverlapdF, dOverlapdChi, dOverlapdGradChi );
+
+        benchmark::DoNotOptimize( overlap.data( ) );
+
+    }
+
+}
+BENCHMARK( BM_computeParticleOverlap_gradients );
+
+BENCHMARK_MAIN( );
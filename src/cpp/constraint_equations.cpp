@@ -1,5 +1,7 @@
 #include<constraint_equations.h>
 #include<sstream>
+#include<stdexcept>
+#include<string>
 
 namespace constraintEquations{
 
@@ -191,4 +193,203 @@ namespace constraintEquations{
 
     }
 
+    namespace{
+
+        unsigned int checkTractionConstraintBatch( const unsigned int &numPoints, const floatVector &cauchyStress, const floatVector &normals,
+                                                   const floatVector &tractions ){
+            /*!
+             * Check the sizes of the batched traction constraint inputs and return the spatial dimension
+             * 
+             * \param &numPoints: The number of points
+             * \param &cauchyStress: The cauchy stress in row-major vector format
+             * \param &normals: The normal vectors stored point by point
+             * \param &tractions: The traction vectors stored point by point
+             */
+
+            const unsigned int dim = normals.size( ) / numPoints;
+
+            if ( dim * numPoints != normals.size( ) ){
+
+                throw std::runtime_error( "The normals have a size of " + std::to_string( normals.size( ) ) + " which is not a multiple of the number of points ( " + std::to_string( numPoints ) + " )" );
+
+            }
+
+            if ( tractions.size( ) != normals.size( ) ){
+
+                throw std::runtime_error( "The tractions have a size of " + std::to_string( tractions.size( ) ) + " but the normals have a size of " + std::to_string( normals.size( ) ) );
+
+            }
+
+            if ( cauchyStress.size( ) != dim * dim ){
+
+                throw std::runtime_error( "The Cauchy stress has a size of " + std::to_string( cauchyStress.size( ) ) + " but should have a size of " + std::to_string( dim * dim ) );
+
+            }
+
+            return dim;
+
+        }
+
+    }
+
+    void tractionConstraintBatch( const unsigned int &numPoints, const floatVector &cauchyStress, const floatVector &normals,
+                                  const floatVector &tractions, const floatType &P, floatVector &C ){
+        /*!
+         * Compute the traction constraint at many points of a surface which share the same Cauchy stress where
+         * 
+         * \f$ C^p = P \left( \sigma_{ij} n_i^p - t_j^p \right) \left( \sigma_{kj} n_k^p - t_j^p \right) \f$
+         * 
+         * The vectors are stored point by point i.e. the i'th component of the p'th point is at normals[ dim * p + i ] so
+         * the constraints may be passed directly to surfaceIntegration::integrateMesh as nodal values.
+         * 
+         * \param &numPoints: The number of points
+         * \param &cauchyStress: The cauchy stress in row-major vector format
+         * \param &normals: The normal vectors in the current configuration
+         * \param &tractions: The traction vectors in the current configuration
+         * \param &P: The penalty parameter or a lagrange multiplier depending on how it will be used
+         * \param &C: The resulting error at each point
+         */
+
+        C.resize( numPoints );
+
+        if ( numPoints == 0 ){
+
+            return;
+
+        }
+
+        unsigned int dim;
+
+        ERROR_TOOLS_CATCH( dim = checkTractionConstraintBatch( numPoints, cauchyStress, normals, tractions ) );
+
+        for ( unsigned int p = 0; p < numPoints; p++ ){
+
+            const floatType *n = normals.data( ) + dim * p;
+
+            const floatType *t = tractions.data( ) + dim * p;
+
+            floatType errorNorm = 0;
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                floatType error = -t[ i ];
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+
+                    error += cauchyStress[ dim * j + i ] * n[ j ];
+
+                }
+
+                errorNorm += error * error;
+
+            }
+
+            C[ p ] = P * errorNorm;
+
+        }
+
+        return;
+
+    }
+
+    void tractionConstraintBatch( const unsigned int &numPoints, const floatVector &cauchyStress, const floatVector &normals,
+                                  const floatVector &tractions, const floatType &P, floatVector &C,
+                                  floatVector &dCdCauchyStress, floatVector &dCdNormal, floatVector &dCdTraction, floatVector &dCdP ){
+        /*!
+         * Compute the traction constraint and its Jacobians at many points of a surface which share the same Cauchy stress where
+         * 
+         * \f$ C^p = P \left( \sigma_{ij} n_i^p - t_j^p \right) \left( \sigma_{kj} n_k^p - t_j^p \right) \f$
+         * 
+         * The vectors are stored point by point i.e. the i'th component of the p'th point is at normals[ dim * p + i ] and the
+         * Jacobians are stored in the same way so each output may be passed directly to surfaceIntegration::integrateMesh as nodal values.
+         * The outputs are resized in place so their storage may be reused between calls.
+         * 
+         * \param &numPoints: The number of points
+         * \param &cauchyStress: The cauchy stress in row-major vector format
+         * \param &normals: The normal vectors in the current configuration
+         * \param &tractions: The traction vectors in the current configuration
+         * \param &P: The penalty parameter or a lagrange multiplier depending on how it will be used
+         * \param &C: The resulting error at each point
+         * \param &dCdCauchyStress: The derivative of the constraint w.r.t. the Cauchy stress stored as dCdCauchyStress[ dim * dim * p + dim * i + j ]
+         * \param &dCdNormal: The derivative of the constraint w.r.t. the normal stored as dCdNormal[ dim * p + i ]
+         * \param &dCdTraction: The derivative of the constraint w.r.t. the traction stored as dCdTraction[ dim * p + i ]
+         * \param &dCdP: The derivative of the constraint w.r.t. the penalty parameter at each point
+         */
+
+        C.resize( numPoints );
+
+        dCdP.resize( numPoints );
+
+        if ( numPoints == 0 ){
+
+            dCdCauchyStress.clear( );
+
+            dCdNormal.clear( );
+
+            dCdTraction.clear( );
+
+            return;
+
+        }
+
+        unsigned int dim;
+
+        ERROR_TOOLS_CATCH( dim = checkTractionConstraintBatch( numPoints, cauchyStress, normals, tractions ) );
+
+        dCdCauchyStress.resize( dim * dim * numPoints );
+
+        dCdNormal.resize( dim * numPoints );
+
+        dCdTraction.resize( dim * numPoints );
+
+        floatVector error( dim );
+
+        for ( unsigned int p = 0; p < numPoints; p++ ){
+
+            const floatType *n = normals.data( ) + dim * p;
+
+            const floatType *t = tractions.data( ) + dim * p;
+
+            floatType errorNorm = 0;
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                error[ i ] = -t[ i ];
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+
+                    error[ i ] += cauchyStress[ dim * j + i ] * n[ j ];
+
+                }
+
+                errorNorm += error[ i ] * error[ i ];
+
+            }
+
+            C[ p ] = P * errorNorm;
+
+            dCdP[ p ] = errorNorm;
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                dCdTraction[ dim * p + i ] = -2 * P * error[ i ];
+
+                dCdNormal[ dim * p + i ] = 0;
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+
+                    dCdCauchyStress[ dim * dim * p + dim * i + j ] = 2 * P * n[ i ] * error[ j ];
+
+                    dCdNormal[ dim * p + i ] += 2 * P * cauchyStress[ dim * i + j ] * error[ j ];
+
+                }
+
+            }
+
+        }
+
+        return;
+
+    }
+
 }
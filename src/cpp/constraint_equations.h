@@ -30,6 +30,13 @@ namespace constraintEquations{
                              floatVector &d2CdCauchyStressdNormal, floatVector &d2CdCauchyStressdP,
                              floatVector &d2CdNormaldP,            floatVector &d2CdTractiondP );
 
+    void tractionConstraintBatch( const unsigned int &numPoints, const floatVector &cauchyStress, const floatVector &normals,
+                                  const floatVector &tractions, const floatType &P, floatVector &C );
+
+    void tractionConstraintBatch( const unsigned int &numPoints, const floatVector &cauchyStress, const floatVector &normals,
+                                  const floatVector &tractions, const floatType &P, floatVector &C,
+                                  floatVector &dCdCauchyStress, floatVector &dCdNormal, floatVector &dCdTraction, floatVector &dCdP );
+
 }
 
 #endif
@@ -1,5 +1,8 @@
 #include<surface_integration.h>
 #include<sstream>
+#include<map>
+#include<mutex>
+#include<algorithm>
 
 namespace surfaceIntegration{
 
@@ -623,64 +626,513 @@ namespace surfaceIntegration{
 
     }
 
+    namespace{
+
+        void formGaussQuadrature( const unsigned int &quadratureOrder, floatVector &xis, floatVector &etas, floatVector &weights ){
+            /*!
+             * Form the tensor product Gauss quadrature points and weights of a quadrilateral element.
+             * The points are ordered with eta varying fastest.
+             * 
+             * \param &quadratureOrder: The number of Gauss points in each local direction (2 or 3)
+             * \param &xis: The xi coordinates of the quadrature points
+             * \param &etas: The eta coordinates of the quadrature points
+             * \param &weights: The weights of the quadrature points
+             */
+
+            floatVector gaussPoints_1D, weights_1D;
+
+            if ( quadratureOrder == 2 ){
+
+                gaussPoints_1D = { -1. / std::sqrt( 3 ), 1. / std::sqrt( 3 ) };
+
+                weights_1D = { 1., 1. };
+
+            }
+            else if ( quadratureOrder == 3 ){
+
+                gaussPoints_1D = { -std::sqrt( 0.6 ), 0., std::sqrt( 0.6 ) };
+
+                weights_1D = { 5. / 9, 8. / 9, 5. / 9 };
+
+            }
+            else{
+
+                TARDIGRADE_ERROR_TOOLS_CHECK( false, "The quadrature order must be 2 or 3 but is " + std::to_string( quadratureOrder ) );
+
+            }
+
+            unsigned int n_qp = quadratureOrder * quadratureOrder;
+
+            xis = floatVector( n_qp, 0 );
+
+            etas = floatVector( n_qp, 0 );
+
+            weights = floatVector( n_qp, 0 );
+
+            for ( unsigned int i = 0; i < quadratureOrder; i++ ){
+
+                for ( unsigned int j = 0; j < quadratureOrder; j++ ){
+
+                    xis[ quadratureOrder * i + j ] = gaussPoints_1D[ i ];
+
+                    etas[ quadratureOrder * i + j ] = gaussPoints_1D[ j ];
+
+                    weights[ quadratureOrder * i + j ] = weights_1D[ i ] * weights_1D[ j ];
+
+                }
+
+            }
+
+            return;
+
+        }
+
+        void integrateMeshFields( const floatVector &nodalPositions, const std::vector< unsigned int > &connectivity,
+                                  const std::vector< const floatVector* > &fields, const unsigned int &quadratureOrder,
+                                  const unsigned int &numThreads, floatMatrix &answers ){
+            /*!
+             * Integrate several fields over a full mesh in a single pass over the elements. The nodal
+             * positions and values are read directly from the flat arrays and the shape functions are
+             * only evaluated once for each quadrature point so no temporary storage is allocated for each element.
+             * 
+             * The integral of each element is stored and the elements are then summed pairwise in a fixed
+             * order. The elements may therefore be split between threads without changing the result.
+             * 
+             * \param &nodalPositions: The positions of the nodes
+             * \param &connectivity: The connectivity array
+             * \param &fields: The values of each field at the nodes
+             * \param &quadratureOrder: The number of Gauss points in each local direction (2 or 3)
+             * \param &numThreads: The number of threads the elements are split between when OpenMP is available
+             * \param &answers: The resulting integrated fields
+             */
+
+            constexpr unsigned int dim = 3;
+
+            constexpr unsigned int n_nodes = 9;
+
+            unsigned int n_points = nodalPositions.size( ) / dim;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK( n_points * dim == nodalPositions.size( ), "The nodal positions size is not a multiple of three" );
+
+            unsigned int n_elements = connectivity.size( ) / n_nodes;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK( n_elements * n_nodes == connectivity.size( ), "The connectivity size is not a multiple of nine" );
+
+            TARDIGRADE_ERROR_TOOLS_CHECK( n_points > 0, "The mesh has no nodes" );
+
+            std::vector< unsigned int > function_dims( fields.size( ), 0 );
+
+            // The offset of each field in the values of an element
+            std::vector< unsigned int > field_offsets( fields.size( ) + 1, 0 );
+
+            for ( unsigned int f = 0; f < fields.size( ); f++ ){
+
+                function_dims[ f ] = fields[ f ]->size( ) / n_points;
+
+                TARDIGRADE_ERROR_TOOLS_CHECK( function_dims[ f ] * n_points == fields[ f ]->size( ), "The nodal values size of field " + std::to_string( f ) + " is not a multiple of the number of nodes" );
+
+                field_offsets[ f + 1 ] = field_offsets[ f ] + function_dims[ f ];
+
+            }
+
+            const unsigned int element_dim = field_offsets[ fields.size( ) ];
+
+            for ( auto c = connectivity.begin( ); c != connectivity.end( ); c++ ){
+
+                TARDIGRADE_ERROR_TOOLS_CHECK( *c < n_points, "The connectivity refers to node " + std::to_string( *c ) + " but there are only " + std::to_string( n_points ) + " nodes" );
+
+            }
+
+            floatVector xis, etas, weights;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( formGaussQuadrature( quadratureOrder, xis, etas, weights ) );
+
+            unsigned int n_qp = weights.size( );
+
+            // Tabulate the shape functions and their local gradients at the quadrature points
+            floatVector Ns_qp( n_qp * n_nodes, 0 );
+
+            floatVector dNdxi_qp( n_qp * n_nodes * 2, 0 );
+
+            floatVector Ns;
+
+            floatMatrix dNdxi;
+
+            for ( unsigned int q = 0; q < n_qp; q++ ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( evaluateQuadraticShapeFunctions( xis[ q ], etas[ q ], Ns ) );
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( evaluateGradQuadraticShapeFunctions( xis[ q ], etas[ q ], dNdxi ) );
+
+                for ( unsigned int n = 0; n < n_nodes; n++ ){
+
+                    Ns_qp[ n_nodes * q + n ] = Ns[ n ];
+
+                    dNdxi_qp[ 2 * n_nodes * q + 2 * n + 0 ] = dNdxi[ n ][ 0 ];
+
+                    dNdxi_qp[ 2 * n_nodes * q + 2 * n + 1 ] = dNdxi[ n ][ 1 ];
+
+                }
+
+            }
+
+            floatVector elementValues( n_elements * element_dim, 0 );
+
+#ifdef _OPENMP
+            #pragma omp parallel for num_threads( std::max( 1u, numThreads ) ) schedule( static )
+#endif
+            for ( unsigned int e = 0; e < n_elements; e++ ){
+
+                const unsigned int *c = connectivity.data( ) + n_nodes * e;
+
+                for ( unsigned int q = 0; q < n_qp; q++ ){
+
+                    const floatType *N = Ns_qp.data( ) + n_nodes * q;
+
+                    const floatType *dN = dNdxi_qp.data( ) + 2 * n_nodes * q;
+
+                    // The local gradient of the position ( dim x 2 )
+                    floatType dxdxi[ dim ][ 2 ] = { { 0, 0 }, { 0, 0 }, { 0, 0 } };
+
+                    for ( unsigned int n = 0; n < n_nodes; n++ ){
+
+                        const floatType *x = nodalPositions.data( ) + dim * c[ n ];
+
+                        for ( unsigned int i = 0; i < dim; i++ ){
+
+                            dxdxi[ i ][ 0 ] += x[ i ] * dN[ 2 * n + 0 ];
+
+                            dxdxi[ i ][ 1 ] += x[ i ] * dN[ 2 * n + 1 ];
+
+                        }
+
+                    }
+
+                    floatType n0 = dxdxi[ 1 ][ 0 ] * dxdxi[ 2 ][ 1 ] - dxdxi[ 2 ][ 0 ] * dxdxi[ 1 ][ 1 ];
+
+                    floatType n1 = dxdxi[ 2 ][ 0 ] * dxdxi[ 0 ][ 1 ] - dxdxi[ 0 ][ 0 ] * dxdxi[ 2 ][ 1 ];
+
+                    floatType n2 = dxdxi[ 0 ][ 0 ] * dxdxi[ 1 ][ 1 ] - dxdxi[ 1 ][ 0 ] * dxdxi[ 0 ][ 1 ];
+
+                    floatType wJ = weights[ q ] * std::sqrt( n0 * n0 + n1 * n1 + n2 * n2 );
+
+                    for ( unsigned int f = 0; f < fields.size( ); f++ ){
+
+                        const unsigned int function_dim = function_dims[ f ];
+
+                        const floatType *v = fields[ f ]->data( );
+
+                        floatType *a = elementValues.data( ) + element_dim * e + field_offsets[ f ];
+
+                        for ( unsigned int n = 0; n < n_nodes; n++ ){
+
+                            const floatType wJN = wJ * N[ n ];
+
+                            const floatType *v_n = v + function_dim * c[ n ];
+
+                            for ( unsigned int i = 0; i < function_dim; i++ ){
+
+                                a[ i ] += wJN * v_n[ i ];
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+            // Pairwise summation of the elements in an order which is independent of the number of threads
+            for ( unsigned int width = 1; width < n_elements; width *= 2 ){
+
+                for ( unsigned int e = 0; e + width < n_elements; e += 2 * width ){
+
+                    floatType *a = elementValues.data( ) + element_dim * e;
+
+                    const floatType *b = elementValues.data( ) + element_dim * ( e + width );
+
+                    for ( unsigned int i = 0; i < element_dim; i++ ){
+
+                        a[ i ] += b[ i ];
+
+                    }
+
+                }
+
+            }
+
+            answers = floatMatrix( fields.size( ) );
+
+            for ( unsigned int f = 0; f < fields.size( ); f++ ){
+
+                answers[ f ] = floatVector( function_dims[ f ], 0 );
+
+                if ( n_elements > 0 ){
+
+                    std::copy( elementValues.begin( ) + field_offsets[ f ], elementValues.begin( ) + field_offsets[ f + 1 ], answers[ f ].begin( ) );
+
+                }
+
+            }
+
+            return;
+
+        }
+
+    }
+
     void integrateMesh( const floatVector &nodalPositions, const std::vector< unsigned int > &connectivity,
                             const floatVector &nodalValues, floatVector &answer ){
+        /*!
+         * Integrate the provided function over a full mesh using 2x2 Gauss quadrature
+         * 
+         * \param &nodalPositions: The positions of the nodes
+         * \param &connectivity: The connectivity array
+         * \param &nodalValues: The values of the function at the nodes
+         * \param &answer: The resulting integrated function
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( integrateMesh( nodalPositions, connectivity, nodalValues, 2, answer ) );
+
+        return;
+
+    }
+
+    void integrateMesh( const floatVector &nodalPositions, const std::vector< unsigned int > &connectivity,
+                        const floatVector &nodalValues, const unsigned int &quadratureOrder, floatVector &answer,
+                        const unsigned int &numThreads ){
         /*!
          * Integrate the provided function over a full mesh
          * 
          * \param &nodalPositions: The positions of the nodes
          * \param &connectivity: The connectivity array
          * \param &nodalValues: The values of the function at the nodes
+         * \param &quadratureOrder: The number of Gauss points in each local direction (2 or 3)
          * \param &answer: The resulting integrated function
+         * \param &numThreads: The number of threads the elements are split between when OpenMP is available.
+         *     The result does not depend on the number of threads.
          */
 
-        unsigned int dim = 3;
+        floatMatrix answers;
 
-        unsigned int n_nodes = 9;
+        TARDIGRADE_ERROR_TOOLS_CATCH( integrateMeshFields( nodalPositions, connectivity, { &nodalValues }, quadratureOrder, numThreads, answers ) );
 
-        unsigned int n_points = nodalPositions.size( ) / dim;
+        answer = std::move( answers[ 0 ] );
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( n_points * dim == nodalPositions.size( ), "The nodal positions size is not a multiple of three" );
+        return;
 
-        unsigned int n_elements = connectivity.size( ) / n_nodes;
+    }
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( n_elements * n_nodes == connectivity.size( ), "The connectivity size is not a multiple of nine" );
+    void integrateMesh( const floatVector &nodalPositions, const std::vector< unsigned int > &connectivity,
+                        const floatMatrix &nodalValues, floatMatrix &answer ){
+        /*!
+         * Integrate several functions over a full mesh in a single pass using 2x2 Gauss quadrature
+         * 
+         * \param &nodalPositions: The positions of the nodes
+         * \param &connectivity: The connectivity array
+         * \param &nodalValues: The values of the each function at the nodes
+         * \param &answer: The resulting integrated functions
+         */
 
-        unsigned int function_dim = nodalValues.size( ) / n_points;
+        TARDIGRADE_ERROR_TOOLS_CATCH( integrateMesh( nodalPositions, connectivity, nodalValues, 2, answer ) );
 
-        TARDIGRADE_ERROR_TOOLS_CHECK( function_dim * n_points != nodalValues.size( ), "The nodal values size is not a multiple of nine" );
+        return;
 
-        floatMatrix nodalPositions_e( dim, floatVector( n_nodes, 0 ) );
+    }
 
-        floatMatrix nodalValues_e( function_dim, floatVector( n_nodes, 0 ) );
+    void integrateMesh( const floatVector &nodalPositions, const std::vector< unsigned int > &connectivity,
+                        const floatMatrix &nodalValues, const unsigned int &quadratureOrder, floatMatrix &answer,
+                        const unsigned int &numThreads ){
+        /*!
+         * Integrate several functions over a full mesh in a single pass
+         * 
+         * \param &nodalPositions: The positions of the nodes
+         * \param &connectivity: The connectivity array
+         * \param &nodalValues: The values of the each function at the nodes
+         * \param &quadratureOrder: The number of Gauss points in each local direction (2 or 3)
+         * \param &answer: The resulting integrated functions
+         * \param &numThreads: The number of threads the elements are split between when OpenMP is available.
+         *     The result does not depend on the number of threads.
+         */
 
-        answer = floatVector( function_dim, 0 );
+        std::vector< const floatVector* > fields( nodalValues.size( ) );
+
+        for ( unsigned int f = 0; f < nodalValues.size( ); f++ ){
+
+            fields[ f ] = &nodalValues[ f ];
+
+        }
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( integrateMeshFields( nodalPositions, connectivity, fields, quadratureOrder, numThreads, answer ) );
+
+        return;
+
+    }
+
+    namespace{
+
+        void formUnitSphereQuadrature( const unsigned int &elementCount, unitSphereQuadrature &quadrature ){
+            /*!
+             * Form the integration tables of the decomposition of the unit sphere
+             * 
+             * \param &elementCount: The number of elements on each edge of the projected unit cube
+             * \param &quadrature: The resulting integration tables
+             */
+
+            const unsigned int dim = 3;
+
+            const unsigned int n_nodes = 9;
+
+            quadrature.elementCount = elementCount;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( decomposeSphere( 1.0, elementCount, quadrature.points, quadrature.connectivity ) );
+
+            unsigned int n_points = quadrature.points.size( ) / dim;
+
+            unsigned int n_elements = quadrature.connectivity.size( ) / n_nodes;
+
+            floatVector xis, etas;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( formGaussQuadrature( 2, xis, etas, quadrature.quadratureWeights ) );
+
+            const unsigned int n_qp = quadrature.quadratureWeights.size( );
+
+            quadrature.shapeFunctions = floatVector( n_qp * n_nodes, 0 );
+
+            quadrature.gradShapeFunctions = floatVector( n_qp * n_nodes * 2, 0 );
+
+            floatVector Ns;
 
-        floatVector answer_e;
+            floatMatrix dNdxi;
 
-        for ( unsigned int e = 0; e < n_elements; e++ ){
+            for ( unsigned int q = 0; q < n_qp; q++ ){
 
-            floatVector c( connectivity.begin( ) + n_nodes * e, connectivity.begin( ) + n_nodes * ( e + 1 ) );
+                TARDIGRADE_ERROR_TOOLS_CATCH( evaluateQuadraticShapeFunctions( xis[ q ], etas[ q ], Ns ) );
 
-            for ( auto ci = c.begin( ); ci != c.end( ); ci++ ){
+                TARDIGRADE_ERROR_TOOLS_CATCH( evaluateGradQuadraticShapeFunctions( xis[ q ], etas[ q ], dNdxi ) );
 
-                for ( unsigned int i = 0; i < dim; i++ ){
+                for ( unsigned int n = 0; n < n_nodes; n++ ){
 
-                    nodalPositions_e[ i ][ ci - c.begin( ) ] = nodalPositions[ dim  * ( *ci ) + i ];
+                    quadrature.shapeFunctions[ n_nodes * q + n ] = Ns[ n ];
+
+                    quadrature.gradShapeFunctions[ 2 * n_nodes * q + 2 * n + 0 ] = dNdxi[ n ][ 0 ];
+
+                    quadrature.gradShapeFunctions[ 2 * n_nodes * q + 2 * n + 1 ] = dNdxi[ n ][ 1 ];
 
                 }
 
-                for ( unsigned int i = 0; i < function_dim; i++ ){
+            }
+
+            quadrature.referenceJacobians = floatVector( n_elements * n_qp, 0 );
+
+            quadrature.nodalWeights = floatVector( n_points, 0 );
+
+            floatMatrix nodalPositions_e( dim, floatVector( n_nodes, 0 ) );
+
+            for ( unsigned int e = 0; e < n_elements; e++ ){
+
+                for ( unsigned int n = 0; n < n_nodes; n++ ){
 
-                    nodalValues_e[ i ][ ci - c.begin( ) ] = nodalValues[ function_dim  * ( *ci ) + i ];
+                    for ( unsigned int i = 0; i < dim; i++ ){
+
+                        nodalPositions_e[ i ][ n ] = quadrature.points[ dim * quadrature.connectivity[ n_nodes * e + n ] + i ];
+
+                    }
+
+                }
+
+                for ( unsigned int q = 0; q < n_qp; q++ ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( localJacobian( xis[ q ], etas[ q ], nodalPositions_e, quadrature.referenceJacobians[ n_qp * e + q ] ) );
+
+                    floatType wJ = quadrature.quadratureWeights[ q ] * quadrature.referenceJacobians[ n_qp * e + q ];
+
+                    for ( unsigned int n = 0; n < n_nodes; n++ ){
+
+                        quadrature.nodalWeights[ quadrature.connectivity[ n_nodes * e + n ] ] += wJ * quadrature.shapeFunctions[ n_nodes * q + n ];
+
+                    }
 
                 }
 
             }
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( integrateFunction( nodalPositions_e, nodalValues_e, answer_e ) );
+            return;
+
+        }
+
+    }
+
+    const unitSphereQuadrature &getUnitSphereQuadrature( const unsigned int &elementCount ){
+        /*!
+         * Get the integration tables of the decomposition of the unit sphere. The tables are
+         * formed the first time an element count is requested and are then shared, unmodified,
+         * for the life of the process. The lookup is safe to call from multiple threads.
+         * 
+         * \param &elementCount: The number of elements on each edge of the projected unit cube
+         */
+
+        static std::map< unsigned int, unitSphereQuadrature > cache;
+
+        static std::mutex cacheMutex;
+
+        std::lock_guard< std::mutex > lock( cacheMutex );
+
+        auto entry = cache.find( elementCount );
+
+        if ( entry != cache.end( ) ){
+
+            return entry->second;
+
+        }
+
+        unitSphereQuadrature quadrature;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( formUnitSphereQuadrature( elementCount, quadrature ) );
+
+        // References to map entries remain valid as further element counts are added
+        return cache.emplace( elementCount, std::move( quadrature ) ).first->second;
+
+    }
+
+    void integrateSphere( const unitSphereQuadrature &quadrature, const floatType &radius,
+                          const floatVector &nodalValues, floatVector &answer ){
+        /*!
+         * Integrate the provided function over the decomposition of a sphere of the given radius
+         * using the cached unit sphere tables. The integral is the dot product of the nodal weights
+         * and the nodal values scaled by the square of the radius.
+         * 
+         * \param &quadrature: The unit sphere integration tables
+         * \param &radius: The radius of the sphere
+         * \param &nodalValues: The values of the function at the nodes (n1_1, n1_2, ..., n2_1, ... )
+         * \param &answer: The resulting integrated function
+         */
+
+        unsigned int n_points = quadrature.nodalWeights.size( );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( n_points > 0, "The unit sphere quadrature has no nodes" );
+
+        unsigned int function_dim = nodalValues.size( ) / n_points;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( function_dim * n_points == nodalValues.size( ), "The nodal values size is not a multiple of the number of nodes" );
+
+        answer = floatVector( function_dim, 0 );
+
+        for ( unsigned int n = 0; n < n_points; n++ ){
+
+            for ( unsigned int i = 0; i < function_dim; i++ ){
+
+                answer[ i ] += quadrature.nodalWeights[ n ] * nodalValues[ function_dim * n + i ];
+
+            }
+
+        }
+
+        for ( unsigned int i = 0; i < function_dim; i++ ){
 
-            answer += answer_e;
+            answer[ i ] *= radius * radius;
 
         }
 
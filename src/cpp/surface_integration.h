@@ -56,6 +56,46 @@ namespace surfaceIntegration{
     void integrateMesh( const floatVector &nodalPositions, const std::vector< unsigned int > &connectivity,
                         const floatVector &nodalValues, floatVector &answer );
 
+    void integrateMesh( const floatVector &nodalPositions, const std::vector< unsigned int > &connectivity,
+                        const floatVector &nodalValues, const unsigned int &quadratureOrder, floatVector &answer,
+                        const unsigned int &numThreads = 1 );
+
+    void integrateMesh( const floatVector &nodalPositions, const std::vector< unsigned int > &connectivity,
+                        const floatMatrix &nodalValues, floatMatrix &answer );
+
+    void integrateMesh( const floatVector &nodalPositions, const std::vector< unsigned int > &connectivity,
+                        const floatMatrix &nodalValues, const unsigned int &quadratureOrder, floatMatrix &answer,
+                        const unsigned int &numThreads = 1 );
+
+    /*!
+     * Immutable integration tables for the decomposition of the unit sphere. The tables are
+     * formed once for each element count and shared by every caller.
+     */
+    struct unitSphereQuadrature{
+
+        unsigned int elementCount; //!< The number of elements on each edge of the projected unit cube
+
+        floatVector points; //!< The points on the surface of the unit sphere (p1x, p1y, p1z, p2x, ... )
+
+        std::vector< unsigned int > connectivity; //!< The connectivity array for the elements
+
+        floatVector quadratureWeights; //!< The weights of the 2x2 Gauss quadrature points
+
+        floatVector shapeFunctions; //!< The shape functions at the quadrature points (quadrature point x node)
+
+        floatVector gradShapeFunctions; //!< The local gradients of the shape functions at the quadrature points (quadrature point x node x 2)
+
+        floatVector referenceJacobians; //!< The surface jacobians at the quadrature points (element x quadrature point)
+
+        floatVector nodalWeights; //!< The integration weight of each node so integrals are dot products with the nodal values
+
+    };
+
+    const unitSphereQuadrature &getUnitSphereQuadrature( const unsigned int &elementCount );
+
+    void integrateSphere( const unitSphereQuadrature &quadrature, const floatType &radius,
+                          const floatVector &nodalValues, floatVector &answer );
+
 }
 
 #endif
@@ -5,8 +5,10 @@
   */
 
 #include<asp.h>
+#include<traction_separation.h>
 #include<sstream>
 #include<fstream>
+#include<thread>
 
 #define BOOST_TEST_MODULE test_asp
 #include <boost/test/included/unit_test.hpp>
@@ -412,7 +414,7 @@ namespace asp{
                 }
 
                 static void setParticlePairOverlap( asp::aspBase &asp,
-                                                    asp::dataStorage< std::unordered_map< unsigned int, floatVector > > &particlePairOverlap ){
+                                                    asp::dataStorage< asp::mapFloatVector > &particlePairOverlap ){
 
                     BOOST_CHECK_NO_THROW( asp.setParticlePairOverlap( ) );
 
@@ -425,7 +427,7 @@ namespace asp{
                 }
 
                 static void setSurfaceOverlapEnergyDensity( asp::aspBase &asp,
-                                                            asp::dataStorage< std::unordered_map< unsigned int, floatType > > &surfaceOverlapEnergyDensity ){
+                                                            asp::dataStorage< asp::mapFloatType > &surfaceOverlapEnergyDensity ){
 
                     BOOST_CHECK_NO_THROW( asp.setSurfaceOverlapEnergyDensity( ) );
 
@@ -526,7 +528,7 @@ namespace asp{
                 }
 
                 static void setSurfaceOverlapThickness( asp::aspBase &asp,
-                                                        asp::dataStorage< std::unordered_map< unsigned int, floatType > > &result ){
+                                                        asp::dataStorage< asp::mapFloatType > &result ){
 
                     BOOST_CHECK_NO_THROW( asp.setSurfaceOverlapThickness( ) );
 
@@ -558,6 +560,29 @@ namespace asp{
 
                 }
 
+                static bool boundingBoxesOverlap( asp::aspBase &asp, floatMatrix &boundingBox1, floatMatrix &boundingBox2 ){
+
+                    return asp.boundingBoxesOverlap( boundingBox1, boundingBox2 );
+
+                }
+
+                static void formNeighborLists( asp::aspBase &asp, std::vector< floatMatrix > &boundingBoxes, std::vector< std::vector< unsigned int > > &neighbors ){
+
+                    BOOST_CHECK_NO_THROW( asp.formNeighborLists( boundingBoxes, neighbors ) );
+
+                    return;
+
+                }
+
+                static void setLocalParticleNeighbors( asp::aspBase &asp,
+                                                           asp::dataStorage< std::vector< std::vector< unsigned int > > > &result ){
+
+                    BOOST_CHECK_NO_THROW( asp.setLocalParticleNeighbors( ) );
+
+                    result = asp._localParticleNeighbors;
+
+                }
+
                 // Direct write functions for mocking
                 static void set_indices( asp::aspBase &asp,
                                             unsigned int localIndex, unsigned int nonLocalIndex, unsigned int localSurfaceNodeIndex ){
@@ -877,7 +902,7 @@ namespace asp{
 
                 }
 
-                static void set_particlePairOverlap( asp::aspBase &asp, const std::unordered_map< unsigned int, floatVector > &particlePairOverlap ){
+                static void set_particlePairOverlap( asp::aspBase &asp, const asp::mapFloatVector &particlePairOverlap ){
 
                     asp._particlePairOverlap.first = true;
                     asp._particlePairOverlap.second = particlePairOverlap;
@@ -1026,6 +1051,27 @@ namespace asp{
 
                 }
 
+                static void set_numAssemblyThreads( asp::aspBase &asp, const unsigned int &value ){
+
+                    asp._numAssemblyThreads = value;
+
+                }
+
+                static bool hasAssembledStorage( const asp::aspBase &asp ){
+
+                    return asp._localParticleNeighbors.first || ( asp._localParticleNeighbors.second.size( ) > 0 ) ||
+                           ( asp._assembledSparseSurfaceAdhesionEnergyDensities.second.rowOffsets.size( ) > 0 ) ||
+                           ( asp._assembledSparseSurfaceOverlapTractions.second.rowOffsets.size( ) > 0 );
+
+                }
+
+                static void set_localParticleNeighbors( asp::aspBase &asp, const std::vector< std::vector< unsigned int > > &value ){
+
+                    asp._localParticleNeighbors.first = true;
+                    asp._localParticleNeighbors.second = value;
+
+                }
+
                 // Read functions for checking for errors
                 static asp::dataStorage< floatVector > getLocalReferenceNormal( asp::aspBase &asp ){
 
@@ -1087,6 +1133,24 @@ namespace asp{
 
                 }
 
+                static asp::dataStorage< floatMatrix > getdCurrentDistanceVectordLocalDeformationGradient( asp::aspBase &asp ){
+
+                    return asp._dCurrentDistanceVectordLocalDeformationGradient;
+
+                }
+
+                static asp::dataStorage< floatMatrix > getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( asp::aspBase &asp ){
+
+                    return asp._d2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector;
+
+                }
+
+                static asp::dataStorage< floatMatrix > getdLocalCurrentNormaldLocalMicroDeformation( asp::aspBase &asp ){
+
+                    return asp._dLocalCurrentNormaldLocalMicroDeformation;
+
+                }
+
                 static std::vector< asp::dataBase* > getInteractionPairData( asp::aspBase &asp ){
 
                     return asp._interactionPairData;
@@ -1111,6 +1175,25 @@ namespace asp{
 
                 }
 
+                static const asp::overlapSolutionStorage &get_overlapSolutions( asp::aspBase &asp ){
+
+                    return asp._overlapSolutions.second;
+
+                }
+
+                static floatVector &get_overlapSolution( asp::aspBase &asp, const unsigned int &localIndex,
+                                                         const unsigned int &nonLocalIndex, const unsigned int &surfacePointIndex ){
+
+                    if ( asp._overlapSolutions.second.size( ) <= localIndex ){
+
+                        asp._overlapSolutions.second.resize( std::max( localIndex + 1, *asp.getNumLocalParticles( ) ) );
+
+                    }
+
+                    return asp._overlapSolutions.second[ localIndex ][ std::make_pair( nonLocalIndex, surfacePointIndex ) ];
+
+                }
+
                 static void resetSurfacePointData( asp::aspBase &asp ){
 
                     asp.resetSurfacePointData( );
@@ -1332,903 +1415,1144 @@ BOOST_AUTO_TEST_CASE( testAbaqusInterface ){
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_computeLocalParticleEnergyDensity ){
+BOOST_AUTO_TEST_CASE( testAbaqusViewInterface ){
     /*!
-     * Test the default implementation of the computation of the local particle's energy density
+     * Test the asp abaqus interface which uses views of the Fortran memory
      */
 
-    class aspBaseMock : public asp::aspBase{
+    //Strings
+    char CMNAME[ ] = "asp";
+    //Scalar integers
+    int NDI = 3;
+    int NSHR = 3;
+    int NTENS = 6;
+    int NSTATV = 2;
+    int NPROPS = 2;
+    int NOEL = 1;
+    int NPT = 1;
+    int LAYER = 0;
+    int KSPT = 0;
+    int KINC = 1;
+    //Scalar doubles
+    double SSE = 0;
+    double SPD = 0;
+    double SCD = 0;
+    double RPL = 0;
+    double DRPLDT = 0;
+    double DTIME = 0;
+    double TEMP = 0;
+    double DTEMP = 0;
+    double PNEWDT = 1;
+    double CELENT = 0;
+    //Fortan int column major arrays
+    std::vector< int > jstep( 4 );
+    int* JSTEP  = jstep.data( );
+    //Fortan double column major arrays
+    std::vector< double > stress = { 1, 2, 3, 4, 5, 6 };
+    double* STRESS = stress.data( );
+    std::vector< double > statev = { 7, 8 };
+    double* STATEV = statev.data( );
+    std::vector< double > ddsdde( NTENS * NTENS );
+    for ( unsigned int i = 0; i < ddsdde.size( ); i++ ){ ddsdde[ i ] = 0.1 * i; }
+    double* DDSDDE = ddsdde.data( );
+    std::vector< double > ddsddt( NTENS );
+    double* DDSDDT = ddsddt.data( );
+    std::vector< double > drplde( NTENS );
+    double* DRPLDE = drplde.data( );
+    std::vector< double > strain( NTENS );
+    double* STRAN  = strain.data( );
+    std::vector< double > dstrain( NTENS );
+    double* DSTRAN = dstrain.data( );
+    std::vector< double > time( 2 );
+    double* TIME   = time.data( );
+    std::vector< double > predef( 1 );
+    double* PREDEF = predef.data( );
+    std::vector< double > dpred( 1 );
+    double* DPRED  = dpred.data( );
+    std::vector< double > props( NPROPS );
+    double* PROPS  = props.data( );
+    std::vector< double > coords( 3 );
+    double* COORDS = coords.data( );
+    std::vector< double > drot( 3 * 3);
+    double* DROT   = drot.data( );
+    std::vector< double > dfgrd0( 3 * 3);
+    double* DFGRD0 = dfgrd0.data( );
+    std::vector< double > dfgrd1( 3 * 3);
+    double* DFGRD1 = dfgrd1.data( );
 
-        public:
+    const std::vector< double > stressAnswer = stress;
+    const std::vector< double > statevAnswer = statev;
+    const std::vector< double > ddsddeAnswer = ddsdde;
 
-            aspBaseMock( floatType &radius ){
+    //Sign of life test. The dummy material model doesn't change any values.
+    boost::test_tools::output_test_stream result;
 
-                asp::unit_test::aspBaseTester::set_radius( *this, radius );
+    {
 
-            }
+        cout_redirect guard( result.rdbuf( ) );
 
-    };
+        asp::abaqusViewInterface(
+            STRESS, STATEV, DDSDDE, SSE,    SPD,
+            SCD,    RPL,    DDSDDT, DRPLDE, DRPLDT,
+            STRAN,  DSTRAN, TIME,   DTIME,  TEMP,
+            DTEMP,  PREDEF, DPRED,  CMNAME, NDI,
+            NSHR,   NTENS,  NSTATV, PROPS,  NPROPS,
+            COORDS, DROT,   PNEWDT, CELENT, DFGRD0,
+            DFGRD1, NOEL,   NPT,    LAYER,  KSPT,
+            JSTEP,  KINC );
 
-    floatType previousTime = 1.2;
+    }
 
-    floatType deltaTime = 0.4;
+    BOOST_CHECK( result.is_equal( "Hello Abaqus\n" ) );
 
-    floatVector currentDeformationGradient = { 1, 2, 3,
-                                               4, 5, 6,
-                                               7, 8, 9 };
+    BOOST_CHECK( vectorTools::fuzzyEquals( stress, stressAnswer ) );
 
-    floatVector previousDeformationGradient = { .1, .2, .3,
-                                                .4, .5, .6,
-                                                .7, .8, .9 };
+    BOOST_CHECK( vectorTools::fuzzyEquals( statev, statevAnswer ) );
 
-    floatType currentTemperature = 295.4;
+    BOOST_CHECK( vectorTools::fuzzyEquals( ddsdde, ddsddeAnswer ) );
 
-    floatType previousTemperature = 0.43;
+    //Check that the matrix views are column major
+    asp::matrixView ddsddeView( DDSDDE, NTENS, NTENS, Eigen::OuterStride< >( NTENS ) );
 
-    floatVector previousStateVariables;
+    BOOST_CHECK( vectorTools::fuzzyEquals( ddsddeView( 1, 2 ), ddsdde[ 1 + NTENS * 2 ] ) );
 
-    floatVector currentStateVariables;
+    //Check for nStateVariables thrown exception
+    int NSTATV_incorrect = 1;
+    BOOST_CHECK_THROW(
+        asp::abaqusViewInterface(
+           STRESS, STATEV, DDSDDE,           SSE,    SPD,
+           SCD,    RPL,    DDSDDT,           DRPLDE, DRPLDT,
+           STRAN,  DSTRAN, TIME,             DTIME,  TEMP,
+           DTEMP,  PREDEF, DPRED,            CMNAME, NDI,
+           NSHR,   NTENS,  NSTATV_incorrect, PROPS,  NPROPS,
+           COORDS, DROT,   PNEWDT,           CELENT, DFGRD0,
+           DFGRD1, NOEL,   NPT,              LAYER,  KSPT,
+           JSTEP,  KINC ),
+        std::exception );
 
-    floatVector parameters = { 30., 20. };
+    //Check for nMaterialParameters thrown exception
+    int NPROPS_incorrect = 1;
+    BOOST_CHECK_THROW(
+        asp::abaqusViewInterface(
+           STRESS, STATEV, DDSDDE, SSE,    SPD,
+           SCD,    RPL,    DDSDDT, DRPLDE, DRPLDT,
+           STRAN,  DSTRAN, TIME,   DTIME,  TEMP,
+           DTEMP,  PREDEF, DPRED,  CMNAME, NDI,
+           NSHR,   NTENS,  NSTATV, PROPS,  NPROPS_incorrect,
+           COORDS, DROT,   PNEWDT, CELENT, DFGRD0,
+           DFGRD1, NOEL,   NPT,    LAYER,  KSPT,
+           JSTEP,  KINC ),
+        std::exception );
 
-    floatType radius = 2.4;
+}
 
-    floatType energy = 0;
+BOOST_AUTO_TEST_CASE( test_abaqusBlockInterface ){
+    /*!
+     * Test the evaluation of a block of material points
+     */
 
-    floatVector cauchyStress;
+    int nblock = 5;
 
-    aspBaseMock asp( radius );
+    int ndir = 3;
 
-    BOOST_CHECK_NO_THROW( asp.computeLocalParticleEnergyDensity( previousTime, deltaTime, currentDeformationGradient, previousDeformationGradient,
-                                                                 currentTemperature, previousTemperature, previousStateVariables, parameters, energy, cauchyStress, currentStateVariables ) );
+    int nshr = 3;
 
-    BOOST_CHECK( !vectorTools::fuzzyEquals( energy, 0. ) );
+    int nstatev = 2;
 
-    BOOST_CHECK( cauchyStress.size( ) == currentDeformationGradient.size( ) );
+    int nprops = 2;
 
-    energy = 0;
+    char cmname[ ] = "asp";
 
-    cauchyStress.clear( );
+    auto blockArray = [ & ]( const int &size, const double &offset ){
 
-    floatType logProbabilityRatio = 3.4;
+        std::vector< double > array( nblock * size );
 
-    BOOST_CHECK_NO_THROW( asp.computeLocalParticleEnergyDensity( previousTime, deltaTime, currentDeformationGradient, previousDeformationGradient,
-                                                                 currentTemperature, previousTemperature, previousStateVariables, parameters, energy, cauchyStress, currentStateVariables, logProbabilityRatio ) );
+        for ( unsigned int i = 0; i < array.size( ); i++ ){
 
-    BOOST_CHECK( !vectorTools::fuzzyEquals( energy, 0. ) );
+            array[ i ] = offset + 0.1 * i;
 
-    BOOST_CHECK( cauchyStress.size( ) == currentDeformationGradient.size( ) );
+        }
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( logProbabilityRatio, 0. ) );
+        return array;
 
-}
+    };
 
-BOOST_AUTO_TEST_CASE( test_aspBase_initializeUnitSphere ){
-    /*!
-     * Test the initialization of the unit sphere
-     */
+    std::vector< double > props = { 1, 2 };
 
-    asp::aspBase asp;
+    std::vector< double > coordMp = blockArray( 3, 1 );
 
-    asp::dataStorage< floatVector > unitSpherePoints;
+    std::vector< double > charLength = blockArray( 1, 2 );
 
-    asp::dataStorage< std::vector< unsigned int > > unitSphereConnectivity;
+    std::vector< double > density = blockArray( 1, 3 );
 
-    asp::unit_test::aspBaseTester::initializeUnitSphere( asp, unitSpherePoints, unitSphereConnectivity );
+    std::vector< double > strainInc = blockArray( ndir + nshr, 4 );
 
-    BOOST_CHECK( unitSpherePoints.first );
+    std::vector< double > relSpinInc = blockArray( nshr, 5 );
 
-    BOOST_CHECK( unitSphereConnectivity.first );
+    std::vector< double > tempOld = blockArray( 1, 6 );
 
-    unsigned int npoints = unitSpherePoints.second.size( ) / 3;
+    std::vector< double > stretchOld = blockArray( ndir + nshr, 7 );
 
-    BOOST_CHECK( ( unitSpherePoints.second.size( ) % 3 ) == 0 );
+    std::vector< double > defgradOld = blockArray( ndir + 2 * nshr, 8 );
 
-    auto it = std::min_element( unitSphereConnectivity.second.begin( ), unitSphereConnectivity.second.end( ) );
+    std::vector< double > stressOld = blockArray( ndir + nshr, 9 );
 
-    BOOST_CHECK( ( *it ) == 0 );
+    std::vector< double > stateOld = blockArray( nstatev, 10 );
 
-    it = std::max_element( unitSphereConnectivity.second.begin( ), unitSphereConnectivity.second.end( ) );
+    std::vector< double > enerInternOld = blockArray( 1, 11 );
 
-    BOOST_CHECK( ( *it ) == ( npoints - 1 ) );
+    std::vector< double > enerInelasOld = blockArray( 1, 12 );
 
-    asp::aspBase aspGet1;
-    asp::aspBase aspGet2;
+    std::vector< double > tempNew = blockArray( 1, 13 );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet1.getUnitSpherePoints( ), unitSpherePoints.second ) );
+    std::vector< double > stretchNew = blockArray( ndir + nshr, 14 );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet2.getUnitSphereConnectivity( ), unitSphereConnectivity.second ) );
+    std::vector< double > defgradNew = blockArray( ndir + 2 * nshr, 15 );
 
-}
+    asp::materialPointBlock block;
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setLocalReferenceRadius ){
+    block.nblock = nblock;
+    block.ndir = ndir;
+    block.nshr = nshr;
+    block.nstatev = nstatev;
+    block.nprops = nprops;
+    block.cmname = cmname;
+    block.coordMp = coordMp.data( );
+    block.charLength = charLength.data( );
+    block.props = props.data( );
+    block.density = density.data( );
+    block.strainInc = strainInc.data( );
+    block.relSpinInc = relSpinInc.data( );
+    block.tempOld = tempOld.data( );
+    block.stretchOld = stretchOld.data( );
+    block.defgradOld = defgradOld.data( );
+    block.stressOld = stressOld.data( );
+    block.stateOld = stateOld.data( );
+    block.enerInternOld = enerInternOld.data( );
+    block.enerInelasOld = enerInelasOld.data( );
+    block.tempNew = tempNew.data( );
+    block.stretchNew = stretchNew.data( );
+    block.defgradNew = defgradNew.data( );
 
-    class aspBaseMock : public asp::aspBase{
+    // The views of a point are strided by the number of points in the block
+    std::vector< double > stressNew( nblock * ( ndir + nshr ) ), stateNew( nblock * nstatev ), enerInternNew( nblock ), enerInelasNew( nblock );
 
-        public:
+    block.stressNew = stressNew.data( );
+    block.stateNew = stateNew.data( );
+    block.enerInternNew = enerInternNew.data( );
+    block.enerInelasNew = enerInelasNew.data( );
 
-            aspBaseMock( floatType &radius ){
-    
-                asp::unit_test::aspBaseTester::set_radius( *this, radius );
-    
-            }
+    asp::materialPointView point( block, 3 );
 
-    };
+    BOOST_CHECK( point.defgradOld.size( ) == 9 );
 
-    floatType radiusAnswer = 2.3;
+    BOOST_CHECK( point.fieldOld.size( ) == 0 );
 
-    aspBaseMock asp( radiusAnswer );
+    BOOST_CHECK( vectorTools::fuzzyEquals( point.defgradOld( 7 ), defgradOld[ 3 + nblock * 7 ] ) );
 
-    asp::dataStorage< floatType > radius;
+    BOOST_CHECK( vectorTools::fuzzyEquals( point.coords( 2 ), coordMp[ 3 + nblock * 2 ] ) );
 
-    asp::unit_test::aspBaseTester::setLocalReferenceRadius( asp, radius );
+    BOOST_CHECK( vectorTools::fuzzyEquals( point.density, density[ 3 ] ) );
 
-    BOOST_CHECK( radius.first );
+    point.stressNew( 4 ) = 1.23;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( radiusAnswer, radius.second ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( stressNew[ 3 + nblock * 4 ], 1.23 ) );
 
-    aspBaseMock aspGet( radiusAnswer );
+    // The dummy material model carries the values at the start of the increment to the end
+    std::vector< unsigned int > numThreads = { 1, 2, 8 };
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( radiusAnswer, *aspGet.getLocalReferenceRadius( ) ) );
+    for ( auto n = numThreads.begin( ); n != numThreads.end( ); n++ ){
 
-}
+        std::fill( stressNew.begin( ), stressNew.end( ), 0 );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalReferenceRadius ){
+        std::fill( stateNew.begin( ), stateNew.end( ), 0 );
 
-    class aspBaseMock : public asp::aspBase{
+        std::fill( enerInternNew.begin( ), enerInternNew.end( ), 0 );
 
-        public:
+        std::fill( enerInelasNew.begin( ), enerInelasNew.end( ), 0 );
 
-            aspBaseMock( floatType &radius ){
-    
-                asp::unit_test::aspBaseTester::set_radius( *this, radius );
-    
-            }
+        asp::abaqusBlockInterface( block, *n );
 
-    };
+        BOOST_CHECK( vectorTools::fuzzyEquals( stressNew, stressOld ) );
 
-    floatType radiusAnswer = 2.3;
+        BOOST_CHECK( vectorTools::fuzzyEquals( stateNew, stateOld ) );
 
-    aspBaseMock asp( radiusAnswer );
+        BOOST_CHECK( vectorTools::fuzzyEquals( enerInternNew, enerInternOld ) );
 
-    asp::dataStorage< floatType > radius;
+        BOOST_CHECK( vectorTools::fuzzyEquals( enerInelasNew, enerInelasOld ) );
 
-    asp::unit_test::aspBaseTester::setNonLocalReferenceRadius( asp, radius );
+    }
 
-    BOOST_CHECK( radius.first );
+    // An empty block is valid
+    asp::materialPointBlock empty = block;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( radiusAnswer, radius.second ) );
+    empty.nblock = 0;
 
-    aspBaseMock aspGet( radiusAnswer );
+    BOOST_CHECK_NO_THROW( asp::abaqusBlockInterface( empty ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( radiusAnswer, *aspGet.getNonLocalReferenceRadius( ) ) );
+    //Check for nStateVariables thrown exception
+    asp::materialPointBlock incorrect = block;
 
-}
+    incorrect.nstatev = 1;
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalReferenceNormal ){
+    BOOST_CHECK_THROW( asp::abaqusBlockInterface( incorrect ), std::exception );
 
-    class aspBaseMock : public asp::aspBase{
+    //Check for nMaterialParameters thrown exception
+    incorrect = block;
 
-        void initializeUnitSphere( ){
+    incorrect.nprops = 1;
 
-            floatVector points = {
-                                      1, 2, 3,
-                                      4, 5, 6,
-                                      7, 8, 9
-                                  };
+    BOOST_CHECK_THROW( asp::abaqusBlockInterface( incorrect ), std::exception );
 
-            std::vector< unsigned int > connectivity = {
-                                                           1, 2, 3
-                                                       };
+    //Check for missing arrays
+    incorrect = block;
 
-            asp::unit_test::aspBaseTester::set_unitSphere( *this, points, connectivity );
+    incorrect.stressNew = NULL;
 
-            return;
+    BOOST_CHECK_THROW( asp::abaqusBlockInterface( incorrect ), std::exception );
 
-        }
+}
 
-    };
+BOOST_AUTO_TEST_CASE( test_isConvergenceError ){
+    /*!
+     * Test the detection of solver convergence failures
+     */
 
-    aspBaseMock asp;
+    tractionSeparation::convergenceError error( "The optimizer did not converge" );
 
-    floatMatrix normalAnswers = {
-                                    { 1, 2, 3},
-                                    { 4, 5, 6},
-                                    { 7, 8, 9}
-                                };
+    BOOST_CHECK( asp::isConvergenceError( error ) );
 
-    for ( unsigned int i = 0; i < normalAnswers.size( ); i++ ){
+    BOOST_CHECK( !asp::isConvergenceError( std::runtime_error( "Some other failure" ) ) );
 
-        normalAnswers[ i ] /= vectorTools::l2norm( normalAnswers[ i ] );
+    // Convergence errors which have been given additional context should still be detected
+    try{
 
-    }
+        try{
 
-    floatVector result;
+            throw error;
 
-    for ( unsigned int i = 0; i < normalAnswers.size( ); i++ ){
+        }
+        catch( std::exception &e ){
 
-        asp.getLocalReferenceNormal( i, result );
+            std::throw_with_nested( std::runtime_error( "Failure in the evaluation" ) );
 
-        BOOST_CHECK( vectorTools::fuzzyEquals( result, normalAnswers[ i ] ) );
+        }
 
     }
+    catch( std::exception &e ){
 
-}
+        BOOST_CHECK( asp::isConvergenceError( e ) );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setLocalSurfaceReferenceRelativePositionVector ){
+    }
 
-    class aspBaseMock : public asp::aspBase{
+}
 
-        void setLocalReferenceNormal( ){
+BOOST_AUTO_TEST_CASE( test_columnToRowMajor ){
+    /*!
+     * Test the conversion of a column major array to a row major matrix
+     */
 
-            floatVector normal = { 1, 2, 3 };
+    std::vector< double > columnMajor = { 1, 4, 2, 5, 3, 6 };
 
-            normal /= vectorTools::l2norm( normal );
+    floatMatrix answer = { { 1, 2, 3 },
+                           { 4, 5, 6 } };
 
-            asp::unit_test::aspBaseTester::set_localReferenceNormal( *this, normal );
+    floatMatrix result;
 
-            return;
+    asp::columnToRowMajor( columnMajor.data( ), 2, 3, result );
 
-        }
+    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
 
-        void setLocalReferenceRadius( ){
+    const floatType *rowData = result[ 0 ].data( );
 
-            floatType radius = 2.45;
+    columnMajor = { 7, 10, 8, 11, 9, 12 };
 
-            asp::unit_test::aspBaseTester::set_localReferenceRadius( *this, radius );
+    answer = { {  7,  8,  9 },
+               { 10, 11, 12 } };
 
-            return;
+    asp::columnToRowMajor( columnMajor.data( ), 2, 3, result );
 
-        }
+    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
 
-    };
+    BOOST_CHECK( rowData == result[ 0 ].data( ) );
 
-    aspBaseMock asp;
+}
 
-    floatVector answer = { 0.65479004, 1.30958009, 1.96437013 };
+BOOST_AUTO_TEST_CASE( testAbaqusInterface_reentrant ){
+    /*!
+     * Test that the asp abaqus interface can be called concurrently and that a workspace is re-used between calls
+     */
 
-    asp::dataStorage< floatVector > result;
+    class abaqusPoint{
 
-    asp::unit_test::aspBaseTester::setLocalSurfaceReferenceRelativePositionVector( asp, result );
+        public:
 
-    BOOST_CHECK( result.first );
+            abaqusPoint( const unsigned int &seed ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+                for ( unsigned int i = 0; i < stress.size( ); i++ ){
 
-    aspBaseMock aspGet;
+                    stress[ i ] = seed + 0.1 * i;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalSurfaceReferenceRelativePositionVector( ), answer ) );
+                }
 
-}
+                for ( unsigned int i = 0; i < ddsdde.size( ); i++ ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalSurfaceReferenceRelativePositionVector ){
+                    ddsdde[ i ] = seed - 0.01 * i;
 
-    class aspBaseMock : public asp::aspBase{
+                }
 
-        void setLocalReferenceNormal( ){
+                statev = { ( double )seed, 2. * seed };
 
-            floatVector normal = { 1, 2, 3 };
+                props = { 1., 2. };
 
-            normal /= vectorTools::l2norm( normal );
+                // Each point is evaluated by one thread at a time
+                NOEL = seed;
 
-            asp::unit_test::aspBaseTester::set_localReferenceNormal( *this, normal );
+            }
 
-            return;
+            void evaluate( asp::abaqusInterfaceWorkspace *workspace = NULL ){
 
-        }
+                if ( workspace ){
 
-        void setNonLocalReferenceRadius( ){
+                    asp::abaqusInterface( stress.data( ), statev.data( ), ddsdde.data( ), SSE,            SPD,
+                                          SCD,            RPL,            ddsddt.data( ), drplde.data( ), DRPLDT,
+                                          strain.data( ), dstrain.data( ), time.data( ),  DTIME,          TEMP,
+                                          DTEMP,          predef.data( ), dpred.data( ),  CMNAME,         NDI,
+                                          NSHR,           NTENS,          NSTATV,         props.data( ),  NPROPS,
+                                          coords.data( ), drot.data( ),   PNEWDT,         CELENT,         dfgrd0.data( ),
+                                          dfgrd1.data( ), NOEL,           NPT,            LAYER,          KSPT,
+                                          jstep.data( ),  KINC,           *workspace );
 
-            floatType radius = 2.45;
+                }
+                else{
 
-            asp::unit_test::aspBaseTester::set_nonLocalReferenceRadius( *this, radius );
+                    asp::abaqusInterface( stress.data( ), statev.data( ), ddsdde.data( ), SSE,            SPD,
+                                          SCD,            RPL,            ddsddt.data( ), drplde.data( ), DRPLDT,
+                                          strain.data( ), dstrain.data( ), time.data( ),  DTIME,          TEMP,
+                                          DTEMP,          predef.data( ), dpred.data( ),  CMNAME,         NDI,
+                                          NSHR,           NTENS,          NSTATV,         props.data( ),  NPROPS,
+                                          coords.data( ), drot.data( ),   PNEWDT,         CELENT,         dfgrd0.data( ),
+                                          dfgrd1.data( ), NOEL,           NPT,            LAYER,          KSPT,
+                                          jstep.data( ),  KINC );
 
-            return;
+                }
 
-        }
+            }
+
+            char CMNAME[ 4 ] = "asp";
+            int NDI = 3;
+            int NSHR = 3;
+            int NTENS = 6;
+            int NSTATV = 2;
+            int NPROPS = 2;
+            int NOEL = 0;
+            int NPT = 0;
+            int LAYER = 0;
+            int KSPT = 0;
+            int KINC = 0;
+            double SSE = 0;
+            double SPD = 0;
+            double SCD = 0;
+            double RPL = 0;
+            double DRPLDT = 0;
+            double DTIME = 0;
+            double TEMP = 0;
+            double DTEMP = 0;
+            double PNEWDT = 0;
+            double CELENT = 0;
+            std::vector< int > jstep = std::vector< int >( 4, 0 );
+            std::vector< double > stress = std::vector< double >( 6, 0 );
+            std::vector< double > statev = std::vector< double >( 2, 0 );
+            std::vector< double > ddsdde = std::vector< double >( 36, 0 );
+            std::vector< double > ddsddt = std::vector< double >( 6, 0 );
+            std::vector< double > drplde = std::vector< double >( 6, 0 );
+            std::vector< double > strain = std::vector< double >( 6, 0 );
+            std::vector< double > dstrain = std::vector< double >( 6, 0 );
+            std::vector< double > time = std::vector< double >( 2, 0 );
+            std::vector< double > predef = std::vector< double >( 1, 0 );
+            std::vector< double > dpred = std::vector< double >( 1, 0 );
+            std::vector< double > props = std::vector< double >( 2, 0 );
+            std::vector< double > coords = std::vector< double >( 3, 0 );
+            std::vector< double > drot = std::vector< double >( 9, 0 );
+            std::vector< double > dfgrd0 = std::vector< double >( 9, 0 );
+            std::vector< double > dfgrd1 = std::vector< double >( 9, 0 );
 
     };
 
-    aspBaseMock asp;
+    // Check that the workspace storage is re-used between calls
+    asp::abaqusInterfaceWorkspace workspace;
 
-    floatVector answer = { -0.65479004, -1.30958009, -1.96437013 };
+    abaqusPoint point( 1 );
 
-    asp::dataStorage< floatVector > result;
+    point.evaluate( &workspace );
 
-    asp::unit_test::aspBaseTester::setNonLocalSurfaceReferenceRelativePositionVector( asp, result );
+    const floatType *stressData = workspace.stress.data( );
 
-    BOOST_CHECK( result.first );
+    const floatType *ddsddeData = workspace.ddsdde[ 0 ].data( );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    abaqusPoint answer( 2 );
 
-    aspBaseMock aspGet;
+    point = abaqusPoint( 2 );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalSurfaceReferenceRelativePositionVector( ), answer ) );
+    point.evaluate( &workspace );
 
-}
+    BOOST_CHECK( stressData == workspace.stress.data( ) );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setLocalDeformationGradient ){
+    BOOST_CHECK( ddsddeData == workspace.ddsdde[ 0 ].data( ) );
 
-    class aspBaseMock : public asp::aspBase{
+    BOOST_CHECK( vectorTools::fuzzyEquals( point.stress, answer.stress ) );
 
-    };
+    BOOST_CHECK( vectorTools::fuzzyEquals( point.statev, answer.statev ) );
 
-    aspBaseMock asp;
+    BOOST_CHECK( vectorTools::fuzzyEquals( point.ddsdde, answer.ddsdde ) );
 
-    floatVector answer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
-        
-    asp::unit_test::aspBaseTester::set_deformationGradient( asp, answer );
+    // Check that concurrent calls do not interfere with each other
+    const unsigned int numThreads = 4;
 
-    asp::dataStorage< floatVector > result;
+    const unsigned int numCalls = 100;
 
-    asp::unit_test::aspBaseTester::setLocalDeformationGradient( asp, result );
+    std::vector< abaqusPoint > points;
 
-    BOOST_CHECK( result.first );
+    std::vector< abaqusPoint > answers;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    for ( unsigned int i = 0; i < numThreads; i++ ){
 
-    aspBaseMock aspGet;
+        points.push_back( abaqusPoint( i + 1 ) );
 
-    asp::unit_test::aspBaseTester::set_deformationGradient( aspGet, answer );
+        answers.push_back( abaqusPoint( i + 1 ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalDeformationGradient( ), answer ) );
+    }
 
-}
+    std::vector< bool > threw( numThreads, false );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setPreviousLocalDeformationGradient ){
+    std::vector< std::thread > threads;
 
-    class aspBaseMock : public asp::aspBase{
+    for ( unsigned int i = 0; i < numThreads; i++ ){
 
-    };
+        threads.push_back( std::thread( [ &, i ]( ){
 
-    aspBaseMock asp;
+            try{
 
-    floatVector answer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
-        
-    asp::unit_test::aspBaseTester::set_previousDeformationGradient( asp, answer );
+                for ( unsigned int j = 0; j < numCalls; j++ ){
 
-    asp::dataStorage< floatVector > result;
+                    points[ i ].evaluate( );
 
-    asp::unit_test::aspBaseTester::setPreviousLocalDeformationGradient( asp, result );
+                }
 
-    BOOST_CHECK( result.first );
+            }
+            catch( std::exception &e ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+                threw[ i ] = true;
 
-    aspBaseMock aspGet;
+            }
 
-    asp::unit_test::aspBaseTester::set_previousDeformationGradient( aspGet, answer );
+        } ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getPreviousLocalDeformationGradient( ), answer ) );
+    }
 
-}
+    for ( auto thread = threads.begin( ); thread != threads.end( ); thread++ ){
 
+        thread->join( );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setLocalMicroDeformation ){
+    }
 
-    class aspBaseMock : public asp::aspBase{
+    for ( unsigned int i = 0; i < numThreads; i++ ){
 
-    };
+        BOOST_CHECK( !threw[ i ] );
 
-    aspBaseMock asp;
+        BOOST_CHECK( vectorTools::fuzzyEquals( points[ i ].stress, answers[ i ].stress ) );
 
-    floatVector answer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
-        
-    asp::unit_test::aspBaseTester::set_microDeformation( asp, answer );
+        BOOST_CHECK( vectorTools::fuzzyEquals( points[ i ].statev, answers[ i ].statev ) );
 
-    asp::dataStorage< floatVector > result;
+        BOOST_CHECK( vectorTools::fuzzyEquals( points[ i ].ddsdde, answers[ i ].ddsdde ) );
 
-    asp::unit_test::aspBaseTester::setLocalMicroDeformation( asp, result );
+    }
 
-    BOOST_CHECK( result.first );
+}
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+BOOST_AUTO_TEST_CASE( testAbaqusInterface_integrationPointState ){
+    /*!
+     * Test the commit and rollback of the integration point state across increments through the abaqus interface
+     */
 
-    aspBaseMock aspGet;
+    char CMNAME[ ] = "asp";
+    int NDI = 3;
+    int NSHR = 3;
+    int NTENS = 6;
+    int NSTATV = 2;
+    int NPROPS = 2;
+    int NOEL = 3;
+    int NPT = 2;
+    int LAYER = 0;
+    int KSPT = 0;
+    int KINC = 2;
+    double SSE = 0;
+    double SPD = 0;
+    double SCD = 0;
+    double RPL = 0;
+    double DRPLDT = 0;
+    double DTIME = 1;
+    double TEMP = 0;
+    double DTEMP = 0;
+    double PNEWDT = 1;
+    double CELENT = 0;
+    std::vector< int > jstep( 4 );
+    std::vector< double > stress( NTENS );
+    std::vector< double > statev( NSTATV );
+    std::vector< double > ddsdde( NTENS * NTENS );
+    std::vector< double > ddsddt( NTENS );
+    std::vector< double > drplde( NTENS );
+    std::vector< double > strain( NTENS );
+    std::vector< double > dstrain( NTENS );
+    std::vector< double > time( 2, 0 );
+    std::vector< double > predef( 1 );
+    std::vector< double > dpred( 1 );
+    std::vector< double > props( NPROPS );
+    std::vector< double > coords( 3 );
+    std::vector< double > drot( 3 * 3 );
+    std::vector< double > dfgrd0 = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
 
-    asp::unit_test::aspBaseTester::set_microDeformation( aspGet, answer );
+    // Evaluate the point for a deformation gradient with the shear F12 in column major order
+    auto evaluate = [ & ]( const double &shear ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalMicroDeformation( ), answer ) );
+        std::vector< double > dfgrd1 = { 1, shear, 0, 0, 1, 0, 0, 0, 1 };
 
-}
+        asp::abaqusInterface( stress.data( ), statev.data( ), ddsdde.data( ), SSE,            SPD,
+                              SCD,            RPL,            ddsddt.data( ), drplde.data( ), DRPLDT,
+                              strain.data( ), dstrain.data( ), time.data( ),  DTIME,          TEMP,
+                              DTEMP,          predef.data( ), dpred.data( ),  CMNAME,         NDI,
+                              NSHR,           NTENS,          NSTATV,         props.data( ),  NPROPS,
+                              coords.data( ), drot.data( ),   PNEWDT,         CELENT,         dfgrd0.data( ),
+                              dfgrd1.data( ), NOEL,           NPT,            LAYER,          KSPT,
+                              jstep.data( ),  KINC );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setPreviousLocalMicroDeformation ){
+    };
 
-    class aspBaseMock : public asp::aspBase{
+    auto deformation = [ ]( const double &shear ){
+
+        return floatVector( { 1, 0, 0, shear, 1, 0, 0, 0, 1 } );
 
     };
 
-    aspBaseMock asp;
+    asp::integrationPointStateCache &cache = asp::getIntegrationPointStateCache( );
 
-    floatVector answer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
-        
-    asp::unit_test::aspBaseTester::set_previousMicroDeformation( asp, answer );
+    cache.clear( );
 
-    asp::dataStorage< floatVector > result;
+    // The first iteration of the first increment starts from an empty committed state
+    evaluate( 0.1 );
 
-    asp::unit_test::aspBaseTester::setPreviousLocalMicroDeformation( asp, result );
+    BOOST_CHECK( cache.getCommittedState( NOEL, NPT )->deformation.size( ) == 0 );
 
-    BOOST_CHECK( result.first );
+    // A cutback requested by another point discards the trial state
+    PNEWDT = 0.5;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    evaluate( 0.2 );
 
-    aspBaseMock aspGet;
+    BOOST_CHECK( cache.getCommittedState( NOEL, NPT )->deformation.size( ) == 0 );
 
-    asp::unit_test::aspBaseTester::set_previousMicroDeformation( aspGet, answer );
+    // The retry of the increment is committed explicitly at the end of the increment
+    PNEWDT = 1;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getPreviousLocalMicroDeformation( ), answer ) );
+    DTIME = 0.5;
 
-}
+    evaluate( 0.3 );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setReferenceDistanceVector ){
+    evaluate( 0.4 );
 
-    class aspBaseMock : public asp::aspBase{
+    cache.commit( );
 
-    };
+    BOOST_CHECK( vectorTools::fuzzyEquals( cache.getCommittedState( NOEL, NPT )->deformation, deformation( 0.4 ) ) );
 
-    aspBaseMock asp;
+    // A checkpoint written during the next increment contains the converged state of the previous increment
+    time = { 0.5, 0.5 };
 
-    floatVector answer = { 0, 0, 0 };
+    evaluate( 0.5 );
 
-    asp::dataStorage< floatVector > result;
+    const std::string filename = "testAbaqusInterface_integrationPointState.bin";
 
-    asp::unit_test::aspBaseTester::setReferenceDistanceVector( asp, result );
+    cache.writeCheckpoint( filename );
 
-    BOOST_CHECK( result.first );
+    asp::integrationPointStateCache restarted;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    restarted.readCheckpoint( filename );
 
-    aspBaseMock aspGet;
+    std::remove( filename.c_str( ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getReferenceDistanceVector( ), answer ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( restarted.getCommittedState( NOEL, NPT )->deformation, deformation( 0.4 ) ) );
 
-}
+    // Without an explicit commit the converged increment is committed by the first call of the next increment
+    time = { 1., 1. };
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setLocalReferenceParticleSpacing ){
+    evaluate( 0.6 );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( cache.getCommittedState( NOEL, NPT )->deformation, deformation( 0.5 ) ) );
+
+    // Further commits without a trial state leave the committed state unchanged
+    cache.commit( );
+
+    cache.commit( );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( cache.getCommittedState( NOEL, NPT )->deformation, deformation( 0.6 ) ) );
 
+    // The deformation of the asp model of a point is set on every call and unchanged iterations re-use its results
     class aspBaseMock : public asp::aspBase{
 
-        void setLocalSurfaceReferenceRelativePositionVector( ){
+        public:
 
-            floatVector value = { 1, 2, 3 };
+            unsigned int numLocalParticles = 2;
 
-            asp::unit_test::aspBaseTester::set_localSurfaceReferenceRelativePositionVector( *this, value );
+            unsigned int numEvaluations = 0;
 
-            return;
+            floatType zero = 0;
 
-        }
+            floatType one = 1;
 
-        void setNonLocalSurfaceReferenceRelativePositionVector( ){
+            floatVector microCauchyStress = { 1, 2, 3 };
 
-            floatVector value = { 4, 5, 6 };
+            aspBaseMock( ) : aspBase( ){
 
-            asp::unit_test::aspBaseTester::set_nonLocalSurfaceReferenceRelativePositionVector( *this, value );
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
 
-            return;
+            }
 
-        }
+        private:
 
-        void setReferenceDistanceVector( ){
+            virtual void setLocalParticleEnergy( ){
 
-            floatVector value = { 7, 8, 9 };
+                numEvaluations++;
 
-            asp::unit_test::aspBaseTester::set_referenceDistanceVector( *this, value );
+                floatType energy = ( *getDeformationGradient( ) )[ 3 ] * ( *getLocalIndex( ) + 1 );
 
-            return;
+                asp::unit_test::aspBaseTester::set_localParticleEnergy( *this, energy );
 
-        }
+            }
+
+            virtual void setLocalParticleQuantities( ){
+
+                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, zero );
+
+                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, microCauchyStress );
+
+                asp::unit_test::aspBaseTester::set_localParticleCurrentVolume( *this, one );
+
+                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, zero );
+
+            }
 
     };
 
-    aspBaseMock asp;
+    std::shared_ptr< aspBaseMock > model = std::make_shared< aspBaseMock >( );
 
-    floatVector answer = { 4, 5, 6 };
+    model->setDeformationChangeTolerance( 1e-6 );
 
-    asp::dataStorage< floatVector > result;
+    time = { 1.5, 1.5 };
 
-    asp::unit_test::aspBaseTester::setLocalReferenceParticleSpacingVector( asp, result );
+    cache.getTrialState( NOEL, NPT, time[ 1 ], DTIME ).model = model;
 
-    BOOST_CHECK( result.first );
+    evaluate( 0.7 );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *model->getDeformationGradient( ), deformation( 0.7 ) ) );
 
-    aspBaseMock aspGet;
+    BOOST_CHECK( vectorTools::fuzzyEquals( *model->getPreviousDeformationGradient( ), floatVector( { 1, 0, 0, 0, 1, 0, 0, 0, 1 } ) ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalReferenceParticleSpacingVector( ), answer ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *model->getMicroDeformation( ), deformation( 0.7 ) ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *model->getGradientMicroDeformation( ), floatVector( 27, 0 ) ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *model->getAssembledLocalParticleEnergies( ), floatVector( { 0.7, 1.4 } ) ) );
+
+    evaluate( 0.7 + 1e-8 );
+
+    BOOST_CHECK( !( *model->getDeformationChanged( ) ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *model->getAssembledLocalParticleEnergies( ), floatVector( { 0.7, 1.4 } ) ) );
+
+    BOOST_CHECK( model->numEvaluations == 2 );
+
+    evaluate( 0.8 );
+
+    BOOST_CHECK( *model->getDeformationChanged( ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *model->getAssembledLocalParticleEnergies( ), floatVector( { 0.8, 1.6 } ) ) );
+
+    BOOST_CHECK( model->numEvaluations == 4 );
+
+    // The model is retained by the committed state
+    cache.commit( );
+
+    BOOST_CHECK( cache.getCommittedState( NOEL, NPT )->model == model );
+
+    cache.clear( );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalMicroDeformation ){
+BOOST_AUTO_TEST_CASE( test_integrationPointStateCache ){
+    /*!
+     * Test that the integration point states are committed when an increment converges and are rolled back with cutbacks
+     */
 
-    class aspBaseMock : public asp::aspBase{
+    asp::integrationPointStateCache cache;
 
-        floatVector microDeformationBase = { 4,  5,  6,
-                                             7,  8,  9,
-                                            10, 11, 12 };
+    BOOST_CHECK( cache.size( ) == 0 );
 
-        void setLocalReferenceParticleSpacingVector( ){
+    BOOST_CHECK( !cache.getCommittedState( 1, 1 ) );
 
-            floatVector value = { 1, 2, 3 };
+    // First increment [ 0, 1 ]
+    asp::integrationPointState *state = &cache.getTrialState( 1, 1, 0., 1. );
 
-            asp::unit_test::aspBaseTester::set_localReferenceParticleSpacing( *this, value );
+    BOOST_CHECK( state->overlapSolutions.size( ) == 0 );
 
-            return;
+    state->overlapSolutions = { 1 };
 
-        }
+    state->localParticleNeighbors = { { 1 } };
 
-        void setNonLocalMicroDeformationBase( ){
+    // An equilibrium iteration of the same increment continues from the trial state
+    state = &cache.getTrialState( 1, 1, 0., 1. );
 
-            asp::aspBase::setNonLocalMicroDeformationBase( microDeformationBase );
+    BOOST_CHECK( vectorTools::fuzzyEquals( state->overlapSolutions, floatVector( { 1 } ) ) );
 
-        }
+    BOOST_CHECK( state->localParticleNeighbors == std::vector< std::vector< unsigned int > >( { { 1 } } ) );
 
-    };
+    BOOST_CHECK( cache.getCommittedState( 1, 1 )->overlapSolutions.size( ) == 0 );
 
-    aspBaseMock asp;
+    state->overlapSolutions = { 1.5 };
 
-    floatVector gradientMicroDeformation = { 13, 14, 15, 16, 17, 18, 19, 20, 21,
-                                             22, 23, 24, 25, 26, 27, 28, 29, 30,
-                                             31, 32, 33, 34, 35, 36, 37, 38, 39 };
+    // A second point is independent of the first
+    cache.getTrialState( 1, 2, 0., 1. ).overlapSolutions = { 10 };
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp, gradientMicroDeformation );
+    BOOST_CHECK( cache.size( ) == 2 );
 
-    floatVector answer = { 90, 109, 128,
-                          147, 166, 185, 
-                          204, 223, 242 };
+    // The second increment [ 1, 2 ] commits the last iteration of the first
+    state = &cache.getTrialState( 1, 1, 1., 1. );
 
-    asp::dataStorage< floatVector > result;
+    BOOST_CHECK( vectorTools::fuzzyEquals( state->overlapSolutions, floatVector( { 1.5 } ) ) );
 
-    asp::unit_test::aspBaseTester::setNonLocalMicroDeformation( asp, result );
+    BOOST_CHECK( vectorTools::fuzzyEquals( cache.getCommittedState( 1, 1 )->overlapSolutions, floatVector( { 1.5 } ) ) );
 
-    BOOST_CHECK( result.first );
+    state->overlapSolutions = { 2 };
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    // A cutback of the second increment discards its trial state even if the increment is repeated
+    cache.rollback( 1, 1 );
 
-    aspBaseMock aspGet;
+    cache.rollback( 5, 5 );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspGet, gradientMicroDeformation );
+    BOOST_CHECK( cache.size( ) == 2 );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalMicroDeformation( ), answer ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( cache.getTrialState( 1, 1, 1., 1. ).overlapSolutions, floatVector( { 1.5 } ) ) );
 
-}
+    cache.rollback( 1, 1 );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalMicroDeformationDerivatives ){
+    state = &cache.getTrialState( 1, 1, 1., 0.5 );
 
-    class aspBaseMock : public asp::aspBase{
+    BOOST_CHECK( vectorTools::fuzzyEquals( state->overlapSolutions, floatVector( { 1.5 } ) ) );
 
-        public:
+    state->overlapSolutions = { 3 };
 
-            floatVector microDeformationBase = { 4,  5,  6,
-                                                 7,  8,  9,
-                                                10, 11, 12 };
-    
-            floatVector Xi = { 1, 2, 3 };
-    
-            floatVector D = { 3, 4, 5 };
-    
-            floatVector XiNL = { 6, 7, 8 };
+    // A retry at the start of the increment without an explicit rollback also discards the trial state
+    state = &cache.getTrialState( 1, 1, 1., 0.25 );
 
-        private:
+    BOOST_CHECK( vectorTools::fuzzyEquals( state->overlapSolutions, floatVector( { 1.5 } ) ) );
 
-            void setLocalSurfaceReferenceRelativePositionVector( ) override {
-    
-                asp::aspBase::setLocalSurfaceReferenceRelativePositionVector( Xi );
-    
-                return;
-    
-            }
-    
-            void setReferenceDistanceVector( ) override {
-    
-                asp::aspBase::setReferenceDistanceVector( D );
-    
-                return;
-    
-            }
-    
-            void setNonLocalSurfaceReferenceRelativePositionVector( ) override {
-    
-                asp::aspBase::setNonLocalSurfaceReferenceRelativePositionVector( XiNL );
-    
-                return;
-    
-            }
-    
-            void setNonLocalMicroDeformationBase( ) override{
-    
-                asp::aspBase::setNonLocalMicroDeformationBase( microDeformationBase );
-    
-            }
+    state->overlapSolutions = { 4 };
 
-    };
+    // The next increment [ 1.25, 2.25 ] commits the retried increment
+    state = &cache.getTrialState( 1, 1, 1.25, 1. );
 
-    aspBaseMock asp1, asp2, asp3, asp4, asp5;
+    BOOST_CHECK( vectorTools::fuzzyEquals( cache.getCommittedState( 1, 1 )->overlapSolutions, floatVector( { 4 } ) ) );
 
-    floatVector gradientMicroDeformation = { 13, 14, 15, 16, 17, 18, 19, 20, 21,
-                                             22, 23, 24, 25, 26, 27, 28, 29, 30,
-                                             31, 32, 33, 34, 35, 36, 37, 38, 39 };
+    BOOST_CHECK( vectorTools::fuzzyEquals( state->overlapSolutions, floatVector( { 4 } ) ) );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp1, gradientMicroDeformation );
+    BOOST_CHECK( cache.getCommittedState( 1, 1 )->localParticleNeighbors == std::vector< std::vector< unsigned int > >( { { 1 } } ) );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp2, gradientMicroDeformation );
+    BOOST_CHECK( cache.getCommittedState( 1, 2 )->overlapSolutions.size( ) == 0 );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp3, gradientMicroDeformation );
+    cache.clear( );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp4, gradientMicroDeformation );
+    BOOST_CHECK( cache.size( ) == 0 );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp5, gradientMicroDeformation );
+    BOOST_CHECK( &asp::getIntegrationPointStateCache( ) == &asp::getIntegrationPointStateCache( ) );
 
-    floatMatrix dChiNLdChiNLBase( 9, floatVector( 9, 0 ) );
+}
 
-    floatMatrix dChiNLdGradChi( 9, floatVector( 27, 0 ) );
+BOOST_AUTO_TEST_CASE( test_integrationPointStateCache_checkpoint ){
+    /*!
+     * Test the checkpoint and restart of the integration point state cache
+     */
 
-    floatMatrix dChiNLdXi( 9, floatVector( 3, 0 ) );
+    const std::string filename = "test_integrationPointStateCache_checkpoint.bin";
 
-    floatMatrix dChiNLdD( 9, floatVector( 3, 0 ) );
+    asp::integrationPointStateCache cache, restarted;
 
-    floatMatrix dChiNLdXiNL( 9, floatVector( 3, 0 ) );
+    asp::integrationPointState *state = &cache.getTrialState( 1, 2, 0., 1. );
 
-    floatType eps = 1e-6;
+    state->localParticleNeighbors = { { 0, 1 }, { }, { 1, 2, 3 } };
 
-    for ( unsigned int i = 0; i < asp1.microDeformationBase.size( ); i++ ){
+    state->referenceSurfacePoints = { 1, 2, 3, 4, 5, 6 };
 
-        floatVector deltas( asp1.microDeformationBase.size( ), 0 );
+    state->overlapSolutions = { 0.1, 0.2, 0.3 };
 
-        deltas[ i ] = eps * std::fabs( asp1.microDeformationBase[ i ] ) + eps;
+    state->deformation = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
 
-        aspBaseMock aspp, aspm;
+    // Commit the first trial state and start a second which should not be stored
+    state = &cache.getTrialState( 1, 2, 1., 1. );
 
-        aspp.microDeformationBase += deltas;
+    state->overlapSolutions = { 4 };
 
-        aspm.microDeformationBase -= deltas;
+    cache.getTrialState( 3, 1, 1., 1. );
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
+    cache.writeCheckpoint( filename );
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
+    restarted.getTrialState( 5, 5, 0., 1. );
 
-        for ( unsigned int j = 0; j < 9; j++ ){
+    restarted.readCheckpoint( filename );
 
-            dChiNLdChiNLBase[ j ][ i ] = ( ( *aspp.getNonLocalMicroDeformation( ) )[ j ] - ( *aspm.getNonLocalMicroDeformation( ) )[ j ] ) / ( 2 * deltas[ i ] );
+    BOOST_CHECK( restarted.size( ) == 2 );
 
-        }
+    BOOST_CHECK( !restarted.getCommittedState( 5, 5 ) );
 
-    }
+    const asp::integrationPointState *committed = restarted.getCommittedState( 1, 2 );
 
-    for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
+    BOOST_CHECK( committed->localParticleNeighbors == std::vector< std::vector< unsigned int > >( { { 0, 1 }, { }, { 1, 2, 3 } } ) );
 
-        floatVector deltas( gradientMicroDeformation.size( ), 0 );
+    BOOST_CHECK( committed->referenceSurfacePoints == floatVector( { 1, 2, 3, 4, 5, 6 } ) );
 
-        deltas[ i ] = eps * std::fabs( gradientMicroDeformation[ i ] ) + eps;
+    BOOST_CHECK( committed->overlapSolutions == floatVector( { 0.1, 0.2, 0.3 } ) );
 
-        aspBaseMock aspp, aspm;
+    BOOST_CHECK( committed->deformation == floatVector( { 1, 0, 0, 0, 1, 0, 0, 0, 1 } ) );
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation + deltas );
+    BOOST_CHECK( restarted.getCommittedState( 3, 1 )->overlapSolutions.size( ) == 0 );
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation - deltas );
+    // The restarted trial state starts from the restored committed state
+    BOOST_CHECK( restarted.getTrialState( 1, 2, 1., 1. ).overlapSolutions == floatVector( { 0.1, 0.2, 0.3 } ) );
 
-        for ( unsigned int j = 0; j < 9; j++ ){
+    // Checkpoints written with the other byte order are rejected and the cache is unchanged
+    {
+        std::fstream file( filename, std::ios::binary | std::ios::in | std::ios::out );
 
-            dChiNLdGradChi[ j ][ i ] = ( ( *aspp.getNonLocalMicroDeformation( ) )[ j ] - ( *aspm.getNonLocalMicroDeformation( ) )[ j ] ) / ( 2 * deltas[ i ] );
+        char marker[ 8 ];
 
-        }
+        file.seekg( 8 );
 
-    }
+        file.read( marker, 8 );
 
-    for ( unsigned int i = 0; i < asp3.Xi.size( ); i++ ){
+        std::reverse( marker, marker + 8 );
 
-        floatVector deltas( asp3.Xi.size( ), 0 );
+        file.seekp( 8 );
 
-        deltas[ i ] = eps * std::fabs( asp3.Xi[ i ] ) + eps;
+        file.write( marker, 8 );
+    }
 
-        aspBaseMock aspp, aspm;
+    BOOST_CHECK_THROW( restarted.readCheckpoint( filename ), std::exception );
 
-        aspp.Xi += deltas;
+    BOOST_CHECK( restarted.size( ) == 2 );
 
-        aspm.Xi -= deltas;
+    // Files which are not checkpoints are rejected and the cache is unchanged
+    {
+        std::ofstream file( filename, std::ios::binary | std::ios::trunc );
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
+        file << "not a checkpoint";
+    }
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
+    BOOST_CHECK_THROW( restarted.readCheckpoint( filename ), std::exception );
 
-        for ( unsigned int j = 0; j < 9; j++ ){
+    BOOST_CHECK( restarted.size( ) == 2 );
 
-            dChiNLdXi[ j ][ i ] = ( ( *aspp.getNonLocalMicroDeformation( ) )[ j ] - ( *aspm.getNonLocalMicroDeformation( ) )[ j ] ) / ( 2 * deltas[ i ] );
+    BOOST_CHECK_THROW( restarted.readCheckpoint( "missing_" + filename ), std::exception );
 
-        }
+    std::remove( filename.c_str( ) );
 
-    }
+}
 
-    for ( unsigned int i = 0; i < asp4.D.size( ); i++ ){
+BOOST_AUTO_TEST_CASE( test_aspBase_computeLocalParticleEnergyDensity ){
+    /*!
+     * Test the default implementation of the computation of the local particle's energy density
+     */
 
-        floatVector deltas( asp4.D.size( ), 0 );
+    class aspBaseMock : public asp::aspBase{
 
-        deltas[ i ] = eps * std::fabs( asp4.D[ i ] ) + eps;
+        public:
 
-        aspBaseMock aspp, aspm;
+            aspBaseMock( floatType &radius ){
 
-        aspp.D += deltas;
+                asp::unit_test::aspBaseTester::set_radius( *this, radius );
 
-        aspm.D -= deltas;
+            }
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
+    };
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
+    floatType previousTime = 1.2;
 
-        for ( unsigned int j = 0; j < 9; j++ ){
+    floatType deltaTime = 0.4;
 
-            dChiNLdD[ j ][ i ] = ( ( *aspp.getNonLocalMicroDeformation( ) )[ j ] - ( *aspm.getNonLocalMicroDeformation( ) )[ j ] ) / ( 2 * deltas[ i ] );
+    floatVector currentDeformationGradient = { 1, 2, 3,
+                                               4, 5, 6,
+                                               7, 8, 9 };
 
-        }
+    floatVector previousDeformationGradient = { .1, .2, .3,
+                                                .4, .5, .6,
+                                                .7, .8, .9 };
 
-    }
+    floatType currentTemperature = 295.4;
 
-    for ( unsigned int i = 0; i < asp5.XiNL.size( ); i++ ){
+    floatType previousTemperature = 0.43;
 
-        floatVector deltas( asp5.XiNL.size( ), 0 );
+    floatVector previousStateVariables;
 
-        deltas[ i ] = eps * std::fabs( asp5.XiNL[ i ] ) + eps;
+    floatVector currentStateVariables;
 
-        aspBaseMock aspp, aspm;
+    floatVector parameters = { 30., 20. };
 
-        aspp.XiNL += deltas;
+    floatType radius = 2.4;
 
-        aspm.XiNL -= deltas;
+    floatType energy = 0;
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
+    floatVector cauchyStress;
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
+    aspBaseMock asp( radius );
 
-        for ( unsigned int j = 0; j < 9; j++ ){
+    BOOST_CHECK_NO_THROW( asp.computeLocalParticleEnergyDensity( previousTime, deltaTime, currentDeformationGradient, previousDeformationGradient,
+                                                                 currentTemperature, previousTemperature, previousStateVariables, parameters, energy, cauchyStress, currentStateVariables ) );
 
-            dChiNLdXiNL[ j ][ i ] = ( ( *aspp.getNonLocalMicroDeformation( ) )[ j ] - ( *aspm.getNonLocalMicroDeformation( ) )[ j ] ) / ( 2 * deltas[ i ] );
+    BOOST_CHECK( !vectorTools::fuzzyEquals( energy, 0. ) );
 
-        }
+    BOOST_CHECK( cauchyStress.size( ) == currentDeformationGradient.size( ) );
 
-    }
+    energy = 0;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dChiNLdChiNLBase, *asp1.getdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ) ) );
+    cauchyStress.clear( );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dChiNLdGradChi, *asp2.getdNonLocalMicroDeformationdGradientMicroDeformation( ) ) );
+    floatType logProbabilityRatio = 3.4;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dChiNLdXi, *asp3.getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) ) );
+    BOOST_CHECK_NO_THROW( asp.computeLocalParticleEnergyDensity( previousTime, deltaTime, currentDeformationGradient, previousDeformationGradient,
+                                                                 currentTemperature, previousTemperature, previousStateVariables, parameters, energy, cauchyStress, currentStateVariables, logProbabilityRatio ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dChiNLdD, *asp4.getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) ) );
+    BOOST_CHECK( !vectorTools::fuzzyEquals( energy, 0. ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dChiNLdXiNL, *asp5.getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) ) );
+    BOOST_CHECK( cauchyStress.size( ) == currentDeformationGradient.size( ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( logProbabilityRatio, 0. ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalMicroDeformationSecondDerivatives ){
+BOOST_AUTO_TEST_CASE( test_aspBase_initializeUnitSphere ){
+    /*!
+     * Test the initialization of the unit sphere
+     */
 
-    class aspBaseMock : public asp::aspBase{
+    asp::aspBase asp;
 
-        public:
+    asp::dataStorage< floatVector > unitSpherePoints;
 
-            floatVector microDeformationBase = { 4,  5,  6,
-                                                 7,  8,  9,
-                                                10, 11, 12 };
-    
-            floatVector Xi = { 1, 2, 3 };
-    
-            floatVector D = { 3, 4, 5 };
-    
-            floatVector XiNL = { 6, 7, 8 };
+    asp::dataStorage< std::vector< unsigned int > > unitSphereConnectivity;
 
-        private:
+    asp::unit_test::aspBaseTester::initializeUnitSphere( asp, unitSpherePoints, unitSphereConnectivity );
 
-            void setLocalSurfaceReferenceRelativePositionVector( ) override {
-    
-                asp::aspBase::setLocalSurfaceReferenceRelativePositionVector( Xi );
-    
-                return;
-    
-            }
-    
-            void setReferenceDistanceVector( ) override {
-    
-                asp::aspBase::setReferenceDistanceVector( D );
-    
-                return;
-    
-            }
-    
-            void setNonLocalSurfaceReferenceRelativePositionVector( ) override {
-    
-                asp::aspBase::setNonLocalSurfaceReferenceRelativePositionVector( XiNL );
-    
-                return;
-    
-            }
-    
-            void setNonLocalMicroDeformationBase( ) override{
-    
-                asp::aspBase::setNonLocalMicroDeformationBase( microDeformationBase );
-    
-            }
+    BOOST_CHECK( unitSpherePoints.first );
 
-    };
+    BOOST_CHECK( unitSphereConnectivity.first );
 
-    aspBaseMock asp1, asp2, asp3, asp4, asp5;
+    unsigned int npoints = unitSpherePoints.second.size( ) / 3;
 
-    floatVector gradientMicroDeformation = { 13, 14, 15, 16, 17, 18, 19, 20, 21,
-                                             22, 23, 24, 25, 26, 27, 28, 29, 30,
-                                             31, 32, 33, 34, 35, 36, 37, 38, 39 };
+    BOOST_CHECK( ( unitSpherePoints.second.size( ) % 3 ) == 0 );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp1, gradientMicroDeformation );
+    auto it = std::min_element( unitSphereConnectivity.second.begin( ), unitSphereConnectivity.second.end( ) );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp2, gradientMicroDeformation );
+    BOOST_CHECK( ( *it ) == 0 );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp3, gradientMicroDeformation );
+    it = std::max_element( unitSphereConnectivity.second.begin( ), unitSphereConnectivity.second.end( ) );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp4, gradientMicroDeformation );
+    BOOST_CHECK( ( *it ) == ( npoints - 1 ) );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp5, gradientMicroDeformation );
+    asp::aspBase aspGet1;
+    asp::aspBase aspGet2;
 
-    floatMatrix d2ChiNLdXidGradChi( 9, floatVector( 3 * 27, 0 ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet1.getUnitSpherePoints( ), unitSpherePoints.second ) );
 
-    floatMatrix d2ChiNLdDdGradChi( 9, floatVector( 3 * 27, 0 ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet2.getUnitSphereConnectivity( ), unitSphereConnectivity.second ) );
 
-    floatMatrix d2ChiNLdXiNLdGradChi( 9, floatVector( 3 * 27, 0 ) );
+}
 
-    floatType eps = 1e-6;
+BOOST_AUTO_TEST_CASE( test_aspBase_setLocalReferenceRadius ){
 
-    for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
+    class aspBaseMock : public asp::aspBase{
 
-        floatVector deltas( gradientMicroDeformation.size( ), 0 );
+        public:
 
-        deltas[ i ] = eps * std::fabs( gradientMicroDeformation[ i ] ) + eps;
+            aspBaseMock( floatType &radius ){
+    
+                asp::unit_test::aspBaseTester::set_radius( *this, radius );
+    
+            }
 
-        aspBaseMock aspp, aspm;
+    };
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation + deltas );
+    floatType radiusAnswer = 2.3;
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation - deltas );
+    aspBaseMock asp( radiusAnswer );
 
-        for ( unsigned int j = 0; j < 9; j++ ){
+    asp::dataStorage< floatType > radius;
 
-            for ( unsigned int k = 0; k < 3; k++ ){
+    asp::unit_test::aspBaseTester::setLocalReferenceRadius( asp, radius );
 
-                d2ChiNLdXidGradChi[ j ][ 27 * k + i ] = ( ( *aspp.getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) )[ j ][ k ] - ( *aspm.getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    BOOST_CHECK( radius.first );
 
-                d2ChiNLdDdGradChi[ j ][ 27 * k + i ] = ( ( *aspp.getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) )[ j ][ k ] - ( *aspm.getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    BOOST_CHECK( vectorTools::fuzzyEquals( radiusAnswer, radius.second ) );
 
-                d2ChiNLdXiNLdGradChi[ j ][ 27 * k + i ] = ( ( *aspp.getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) )[ j ][ k ] - ( *aspm.getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    aspBaseMock aspGet( radiusAnswer );
 
-            }
+    BOOST_CHECK( vectorTools::fuzzyEquals( radiusAnswer, *aspGet.getLocalReferenceRadius( ) ) );
 
-        }
+}
 
-    }
+BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalReferenceRadius ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ChiNLdXidGradChi, *asp1.getd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ) ) );
+    class aspBaseMock : public asp::aspBase{
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ChiNLdDdGradChi, *asp2.getd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( ) ) );
+        public:
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ChiNLdXiNLdGradChi, *asp3.getd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( ) ) );
+            aspBaseMock( floatType &radius ){
+    
+                asp::unit_test::aspBaseTester::set_radius( *this, radius );
+    
+            }
 
-}
+    };
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setLocalCurrentNormal ){
+    floatType radiusAnswer = 2.3;
 
-    class aspBaseMock : public asp::aspBase{
+    aspBaseMock asp( radiusAnswer );
 
-        void setLocalReferenceNormal( ){
+    asp::dataStorage< floatType > radius;
 
-            floatVector value = { 1, 2, 3 };
+    asp::unit_test::aspBaseTester::setNonLocalReferenceRadius( asp, radius );
 
-            asp::unit_test::aspBaseTester::set_localReferenceNormal( *this, value );
+    BOOST_CHECK( radius.first );
 
-            return;
+    BOOST_CHECK( vectorTools::fuzzyEquals( radiusAnswer, radius.second ) );
 
-        }
+    aspBaseMock aspGet( radiusAnswer );
 
-        void setLocalMicroDeformation( ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( radiusAnswer, *aspGet.getNonLocalReferenceRadius( ) ) );
 
-            floatVector value = { 0.39293837, -0.42772133, -0.54629709,
-                                  0.10262954,  0.43893794, -0.15378708,
-                                  0.9615284 ,  0.36965948, -0.0381362 };
+}
 
-            asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, value );
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalReferenceNormal ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        void initializeUnitSphere( ){
+
+            floatVector points = {
+                                      1, 2, 3,
+                                      4, 5, 6,
+                                      7, 8, 9
+                                  };
+
+            std::vector< unsigned int > connectivity = {
+                                                           1, 2, 3
+                                                       };
+
+            asp::unit_test::aspBaseTester::set_unitSphere( *this, points, connectivity );
 
             return;
 
@@ -2238,224 +2562,288 @@ BOOST_AUTO_TEST_CASE( test_aspBase_setLocalCurrentNormal ){
 
     aspBaseMock asp;
 
-    floatVector answer = { -0.73381014, -0.454509  ,  0.50492004 };
+    floatMatrix normalAnswers = {
+                                    { 1, 2, 3},
+                                    { 4, 5, 6},
+                                    { 7, 8, 9}
+                                };
 
-    asp::dataStorage< floatVector > result;
+    for ( unsigned int i = 0; i < normalAnswers.size( ); i++ ){
 
-    asp::unit_test::aspBaseTester::setLocalCurrentNormal( asp, result );
+        normalAnswers[ i ] /= vectorTools::l2norm( normalAnswers[ i ] );
 
-    BOOST_CHECK( result.first );
+    }
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    floatVector result;
 
-    aspBaseMock aspGet;
+    for ( unsigned int i = 0; i < normalAnswers.size( ); i++ ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalCurrentNormal( ), answer ) );
+        asp.getLocalReferenceNormal( i, result );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( result, normalAnswers[ i ] ) );
+
+    }
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setLocalCurrentNormalGradients ){
+BOOST_AUTO_TEST_CASE( test_aspBase_setLocalSurfaceReferenceRelativePositionVector ){
 
     class aspBaseMock : public asp::aspBase{
 
-        public:
+        void setLocalReferenceNormal( ){
 
-            floatVector N = { 1, 2, 3 };
-    
-            floatVector chi = { 0.39293837, -0.42772133, -0.54629709,
-                                0.10262954,  0.43893794, -0.15378708,
-                                0.9615284 ,  0.36965948, -0.0381362 };
+            floatVector normal = { 1, 2, 3 };
 
-        private:
+            normal /= vectorTools::l2norm( normal );
 
-            void setLocalReferenceNormal( ){
-    
-                asp::aspBase::setLocalReferenceNormal( N );
-    
-                return;
-    
-            }
-    
-            void setLocalMicroDeformation( ){
-    
-                asp::aspBase::setLocalMicroDeformation( chi );
-    
-            }
+            asp::unit_test::aspBaseTester::set_localReferenceNormal( *this, normal );
 
-    };
+            return;
 
-    aspBaseMock asp1, asp2;
+        }
 
-    floatMatrix dndChi( 3, floatVector( 9, 0 ) );
+        void setLocalReferenceRadius( ){
 
-    floatMatrix dndN( 3, floatVector( 3, 0 ) );
+            floatType radius = 2.45;
 
-    floatType eps = 1e-6;
+            asp::unit_test::aspBaseTester::set_localReferenceRadius( *this, radius );
 
-    for ( unsigned int i = 0; i < asp1.chi.size( ); i++ ){
+            return;
 
-        floatVector deltas( asp1.chi.size( ), 0 );
+        }
 
-        deltas[ i ] = eps * std::fabs( asp1.chi[ i ] ) + eps;
+    };
 
-        aspBaseMock aspp, aspm;
+    aspBaseMock asp;
 
-        aspp.chi += deltas;
+    floatVector answer = { 0.65479004, 1.30958009, 1.96437013 };
 
-        aspm.chi -= deltas;
+    asp::dataStorage< floatVector > result;
 
-        for ( unsigned int j = 0; j < 3; j++ ){
+    asp::unit_test::aspBaseTester::setLocalSurfaceReferenceRelativePositionVector( asp, result );
 
-            dndChi[ j ][ i ] = ( ( *aspp.getLocalCurrentNormal( ) )[ j ] - ( *aspm.getLocalCurrentNormal( ) )[ j ] ) / ( 2 * deltas[ i ] );
+    BOOST_CHECK( result.first );
 
-        }
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
 
-    }
+    aspBaseMock aspGet;
 
-    for ( unsigned int i = 0; i < asp1.N.size( ); i++ ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalSurfaceReferenceRelativePositionVector( ), answer ) );
 
-        floatVector deltas( asp1.N.size( ), 0 );
+}
 
-        deltas[ i ] = eps * std::fabs( asp1.N[ i ] ) + eps;
+BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalSurfaceReferenceRelativePositionVector ){
 
-        aspBaseMock aspp, aspm;
+    class aspBaseMock : public asp::aspBase{
 
-        aspp.N += deltas;
+        void setLocalReferenceNormal( ){
 
-        aspm.N -= deltas;
+            floatVector normal = { 1, 2, 3 };
 
-        for ( unsigned int j = 0; j < 3; j++ ){
+            normal /= vectorTools::l2norm( normal );
 
-            dndN[ j ][ i ] = ( ( *aspp.getLocalCurrentNormal( ) )[ j ] - ( *aspm.getLocalCurrentNormal( ) )[ j ] ) / ( 2 * deltas[ i ] );
+            asp::unit_test::aspBaseTester::set_localReferenceNormal( *this, normal );
+
+            return;
 
         }
 
-    }
+        void setNonLocalReferenceRadius( ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dndChi, *asp1.getdLocalCurrentNormaldLocalMicroDeformation( ) ) );
+            floatType radius = 2.45;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dndN, *asp1.getdLocalCurrentNormaldLocalReferenceNormal( ) ) );
+            asp::unit_test::aspBaseTester::set_nonLocalReferenceRadius( *this, radius );
 
-}
+            return;
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalCurrentNormal ){
+        }
 
-    class aspBaseMock : public asp::aspBase{
+    };
 
-        public:
+    aspBaseMock asp;
 
-            floatMatrix values = { { 1, 2, 3 }, { 4, 5, 6 } };
+    floatVector answer = { -0.65479004, -1.30958009, -1.96437013 };
 
+    asp::dataStorage< floatVector > result;
 
-        private:
+    asp::unit_test::aspBaseTester::setNonLocalSurfaceReferenceRelativePositionVector( asp, result );
 
-            void getLocalReferenceNormal( const unsigned int &index, floatVector &value ){
-    
-                value = values[ index ];
-    
-                return;
-    
-            }
-    
-            void setLocalMicroDeformation( ){
-    
-                floatVector value = { 0.39293837, -0.42772133, -0.54629709,
-                                      0.10262954,  0.43893794, -0.15378708,
-                                      0.9615284 ,  0.36965948, -0.0381362 };
-    
-                asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, value );
-    
-                return;
-    
-            }
+    BOOST_CHECK( result.first );
 
-    };
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
 
-    aspBaseMock asp;
+    aspBaseMock aspGet;
 
-    floatMatrix answers = {
-                              { -0.73381014, -0.454509  ,  0.50492004 },
-                              { -0.68612755, -0.39784135,  0.60905767 },
-                          };
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalSurfaceReferenceRelativePositionVector( ), answer ) );
 
-    floatVector result;
+}
 
-    for ( unsigned int i = 0; i < answers.size( ); i++ ){
+BOOST_AUTO_TEST_CASE( test_aspBase_setLocalDeformationGradient ){
 
-        asp.getLocalCurrentNormal( i, result );
+    class aspBaseMock : public asp::aspBase{
 
-        BOOST_CHECK( vectorTools::fuzzyEquals( result, answers[ i ] ) );
+    };
 
-    }
+    aspBaseMock asp;
 
-}
+    floatVector answer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        
+    asp::unit_test::aspBaseTester::set_deformationGradient( asp, answer );
 
+    asp::dataStorage< floatVector > result;
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVector ){
+    asp::unit_test::aspBaseTester::setLocalDeformationGradient( asp, result );
 
-    class aspBaseMock : public asp::aspBase{
+    BOOST_CHECK( result.first );
 
-        void setLocalSurfaceReferenceRelativePositionVector( ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
 
-            floatVector value = { 1, 2, 3 };
+    aspBaseMock aspGet;
 
-            asp::unit_test::aspBaseTester::set_localSurfaceReferenceRelativePositionVector( *this, value );
+    asp::unit_test::aspBaseTester::set_deformationGradient( aspGet, answer );
 
-            return;
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalDeformationGradient( ), answer ) );
 
-        }
+}
 
-        void setNonLocalSurfaceReferenceRelativePositionVector( ){
+BOOST_AUTO_TEST_CASE( test_aspBase_setPreviousLocalDeformationGradient ){
 
-            floatVector value = { 4, 5, 6 };
+    class aspBaseMock : public asp::aspBase{
 
-            asp::unit_test::aspBaseTester::set_nonLocalSurfaceReferenceRelativePositionVector( *this, value );
+    };
 
-            return;
+    aspBaseMock asp;
 
-        }
+    floatVector answer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        
+    asp::unit_test::aspBaseTester::set_previousDeformationGradient( asp, answer );
 
-        void setReferenceDistanceVector( ){
+    asp::dataStorage< floatVector > result;
 
-            floatVector value = { 7, 8, 9 };
+    asp::unit_test::aspBaseTester::setPreviousLocalDeformationGradient( asp, result );
 
-            asp::unit_test::aspBaseTester::set_referenceDistanceVector( *this, value );
+    BOOST_CHECK( result.first );
 
-            return;
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
 
-        }
+    aspBaseMock aspGet;
 
-        void setLocalDeformationGradient( ){
+    asp::unit_test::aspBaseTester::set_previousDeformationGradient( aspGet, answer );
 
-            floatVector value = { 10, 11, 12,
-                                  13, 14, 15,
-                                  16, 17, 18 };
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getPreviousLocalDeformationGradient( ), answer ) );
 
-            asp::unit_test::aspBaseTester::set_localDeformationGradient( *this, value );
+}
 
-            return;
 
-        }
+BOOST_AUTO_TEST_CASE( test_aspBase_setLocalMicroDeformation ){
 
-        void setLocalMicroDeformation( ){
+    class aspBaseMock : public asp::aspBase{
 
-            floatVector value = { 19, 20, 21,
-                                  22, 23, 24,
-                                  25, 26, 27 };
+    };
 
-            asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, value );
+    aspBaseMock asp;
+
+    floatVector answer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        
+    asp::unit_test::aspBaseTester::set_microDeformation( asp, answer );
+
+    asp::dataStorage< floatVector > result;
+
+    asp::unit_test::aspBaseTester::setLocalMicroDeformation( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    aspBaseMock aspGet;
+
+    asp::unit_test::aspBaseTester::set_microDeformation( aspGet, answer );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalMicroDeformation( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setPreviousLocalMicroDeformation ){
+
+    class aspBaseMock : public asp::aspBase{
+
+    };
+
+    aspBaseMock asp;
+
+    floatVector answer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        
+    asp::unit_test::aspBaseTester::set_previousMicroDeformation( asp, answer );
+
+    asp::dataStorage< floatVector > result;
+
+    asp::unit_test::aspBaseTester::setPreviousLocalMicroDeformation( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    aspBaseMock aspGet;
+
+    asp::unit_test::aspBaseTester::set_previousMicroDeformation( aspGet, answer );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getPreviousLocalMicroDeformation( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setReferenceDistanceVector ){
+
+    class aspBaseMock : public asp::aspBase{
+
+    };
+
+    aspBaseMock asp;
+
+    floatVector answer = { 0, 0, 0 };
+
+    asp::dataStorage< floatVector > result;
+
+    asp::unit_test::aspBaseTester::setReferenceDistanceVector( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    aspBaseMock aspGet;
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getReferenceDistanceVector( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setLocalReferenceParticleSpacing ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        void setLocalSurfaceReferenceRelativePositionVector( ){
+
+            floatVector value = { 1, 2, 3 };
+
+            asp::unit_test::aspBaseTester::set_localSurfaceReferenceRelativePositionVector( *this, value );
 
             return;
 
         }
 
-        void setNonLocalMicroDeformation( ){
+        void setNonLocalSurfaceReferenceRelativePositionVector( ){
 
-            floatVector value = { 28, 29, 30,
-                                  31, 32, 33,
-                                  34, 35, 36 };
+            floatVector value = { 4, 5, 6 };
 
-            asp::unit_test::aspBaseTester::set_nonLocalMicroDeformation( *this, value );
+            asp::unit_test::aspBaseTester::set_nonLocalSurfaceReferenceRelativePositionVector( *this, value );
+
+            return;
+
+        }
+
+        void setReferenceDistanceVector( ){
+
+            floatVector value = { 7, 8, 9 };
+
+            asp::unit_test::aspBaseTester::set_referenceDistanceVector( *this, value );
 
             return;
 
@@ -2465,15 +2853,63 @@ BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVector ){
 
     aspBaseMock asp;
 
-    floatVector gradientMicroDeformation( 27, 0 );
+    floatVector answer = { 4, 5, 6 };
+
+    asp::dataStorage< floatVector > result;
+
+    asp::unit_test::aspBaseTester::setLocalReferenceParticleSpacingVector( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    aspBaseMock aspGet;
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalReferenceParticleSpacingVector( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalMicroDeformation ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        floatVector microDeformationBase = { 4,  5,  6,
+                                             7,  8,  9,
+                                            10, 11, 12 };
+
+        void setLocalReferenceParticleSpacingVector( ){
+
+            floatVector value = { 1, 2, 3 };
+
+            asp::unit_test::aspBaseTester::set_localReferenceParticleSpacing( *this, value );
+
+            return;
+
+        }
+
+        void setNonLocalMicroDeformationBase( ){
+
+            asp::aspBase::setNonLocalMicroDeformationBase( microDeformationBase );
+
+        }
+
+    };
+
+    aspBaseMock asp;
+
+    floatVector gradientMicroDeformation = { 13, 14, 15, 16, 17, 18, 19, 20, 21,
+                                             22, 23, 24, 25, 26, 27, 28, 29, 30,
+                                             31, 32, 33, 34, 35, 36, 37, 38, 39 };
 
     asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp, gradientMicroDeformation );
 
-    floatVector answer = { 482, 554, 626 };
+    floatVector answer = { 90, 109, 128,
+                          147, 166, 185, 
+                          204, 223, 242 };
 
     asp::dataStorage< floatVector > result;
 
-    asp::unit_test::aspBaseTester::setCurrentDistanceVector( asp, result );
+    asp::unit_test::aspBaseTester::setNonLocalMicroDeformation( asp, result );
 
     BOOST_CHECK( result.first );
 
@@ -2483,33 +2919,25 @@ BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVector ){
 
     asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspGet, gradientMicroDeformation );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getCurrentDistanceVector( ), answer ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalMicroDeformation( ), answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVectorGradients ){
+BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalMicroDeformationDerivatives ){
 
     class aspBaseMock : public asp::aspBase{
 
         public:
 
-            floatVector Xi = { 1, 2, 3 };
-    
-            floatVector XiNL = { 4, 5, 6 };
-    
-            floatVector D = { .7, .8, .9 };
+            floatVector microDeformationBase = { 4,  5,  6,
+                                                 7,  8,  9,
+                                                10, 11, 12 };
     
-            floatVector F = { 10, 11, 12,
-                              13, 14, 15,
-                              16, 17, 18 };
+            floatVector Xi = { 1, 2, 3 };
     
-            floatVector chi = { 19, 20, 21,
-                                22, 23, 24,
-                                25, 26, 27 };
+            floatVector D = { 3, 4, 5 };
     
-            floatVector chiNLBase = { 28, 29, 30,
-                                      31, 32, 33,
-                                      34, 35, 36 };
+            floatVector XiNL = { 6, 7, 8 };
 
         private:
 
@@ -2521,14 +2949,6 @@ BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVectorGradients ){
     
             }
     
-            void setNonLocalSurfaceReferenceRelativePositionVector( ) override {
-    
-                asp::aspBase::setNonLocalSurfaceReferenceRelativePositionVector( XiNL );
-    
-                return;
-    
-            }
-    
             void setReferenceDistanceVector( ) override {
     
                 asp::aspBase::setReferenceDistanceVector( D );
@@ -2537,37 +2957,27 @@ BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVectorGradients ){
     
             }
     
-            void setLocalDeformationGradient( ) override {
-    
-                asp::aspBase::setLocalDeformationGradient( F );
-    
-                return;
-    
-            }
-    
-            void setLocalMicroDeformation( ) override {
+            void setNonLocalSurfaceReferenceRelativePositionVector( ) override {
     
-                asp::aspBase::setLocalMicroDeformation( chi );
+                asp::aspBase::setNonLocalSurfaceReferenceRelativePositionVector( XiNL );
     
                 return;
     
             }
     
-            void setNonLocalMicroDeformationBase( ) override {
-    
-                asp::aspBase::setNonLocalMicroDeformationBase( chiNLBase );
+            void setNonLocalMicroDeformationBase( ) override{
     
-                return;
+                asp::aspBase::setNonLocalMicroDeformationBase( microDeformationBase );
     
             }
 
     };
 
-    aspBaseMock asp1, asp2, asp3, asp4, asp5, asp6, asp7;
+    aspBaseMock asp1, asp2, asp3, asp4, asp5;
 
-    floatVector gradientMicroDeformation = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9,
-                                             1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8,
-                                             1.9, 2.0, 2.1, 2.2, 2.3, 2.4, 2.5, 2.6, 2.7 };
+    floatVector gradientMicroDeformation = { 13, 14, 15, 16, 17, 18, 19, 20, 21,
+                                             22, 23, 24, 25, 26, 27, 28, 29, 30,
+                                             31, 32, 33, 34, 35, 36, 37, 38, 39 };
 
     asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp1, gradientMicroDeformation );
 
@@ -2579,229 +2989,161 @@ BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVectorGradients ){
 
     asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp5, gradientMicroDeformation );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp6, gradientMicroDeformation );
-
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp7, gradientMicroDeformation );
-
-    floatMatrix dddXi( 3, floatVector( 3, 0 ) );
-
-    floatMatrix dddD( 3, floatVector( 3, 0 ) );
-
-    floatMatrix dddXiNL( 3, floatVector( 3, 0 ) );
+    floatMatrix dChiNLdChiNLBase( 9, floatVector( 9, 0 ) );
 
-    floatMatrix dddF( 3, floatVector( 9, 0 ) );
+    floatMatrix dChiNLdGradChi( 9, floatVector( 27, 0 ) );
 
-    floatMatrix dddChi( 3, floatVector( 9, 0 ) );
+    floatMatrix dChiNLdXi( 9, floatVector( 3, 0 ) );
 
-    floatMatrix dddChiNLBase( 3, floatVector( 9, 0 ) );
+    floatMatrix dChiNLdD( 9, floatVector( 3, 0 ) );
 
-    floatMatrix dddGradChi( 3, floatVector( 27, 0 ) );
+    floatMatrix dChiNLdXiNL( 9, floatVector( 3, 0 ) );
 
     floatType eps = 1e-6;
 
-    for ( unsigned int i = 0; i < asp1.Xi.size( ); i++ ){
+    for ( unsigned int i = 0; i < asp1.microDeformationBase.size( ); i++ ){
 
-        floatVector deltas( asp1.Xi.size( ), 0 );
+        floatVector deltas( asp1.microDeformationBase.size( ), 0 );
 
-        deltas[ i ] = eps * std::fabs( asp1.Xi[ i ] ) + eps;
+        deltas[ i ] = eps * std::fabs( asp1.microDeformationBase[ i ] ) + eps;
 
         aspBaseMock aspp, aspm;
 
-        aspp.Xi += deltas;
+        aspp.microDeformationBase += deltas;
 
-        aspm.Xi -= deltas;
+        aspm.microDeformationBase -= deltas;
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-        for ( unsigned int j = 0; j < 3; j++ ){
+        for ( unsigned int j = 0; j < 9; j++ ){
 
-            dddXi[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
+            dChiNLdChiNLBase[ j ][ i ] = ( ( *aspp.getNonLocalMicroDeformation( ) )[ j ] - ( *aspm.getNonLocalMicroDeformation( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
         }
 
     }
 
-    for ( unsigned int i = 0; i < asp2.D.size( ); i++ ){
+    for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
 
-        floatVector deltas( asp2.D.size( ), 0 );
+        floatVector deltas( gradientMicroDeformation.size( ), 0 );
 
-        deltas[ i ] = eps * std::fabs( asp1.D[ i ] ) + eps;
-
-        aspBaseMock aspp, aspm;
-
-        aspp.D += deltas;
-
-        aspm.D -= deltas;
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
-
-        for ( unsigned int j = 0; j < 3; j++ ){
-
-            dddD[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
-
-        }
-
-    }
-
-    for ( unsigned int i = 0; i < asp3.XiNL.size( ); i++ ){
-
-        floatVector deltas( asp3.XiNL.size( ), 0 );
-
-        deltas[ i ] = eps * std::fabs( asp3.XiNL[ i ] ) + eps;
+        deltas[ i ] = eps * std::fabs( gradientMicroDeformation[ i ] ) + eps;
 
         aspBaseMock aspp, aspm;
 
-        aspp.XiNL += deltas;
-
-        aspm.XiNL -= deltas;
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation + deltas );
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation - deltas );
 
-        for ( unsigned int j = 0; j < 3; j++ ){
+        for ( unsigned int j = 0; j < 9; j++ ){
 
-            dddXiNL[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
+            dChiNLdGradChi[ j ][ i ] = ( ( *aspp.getNonLocalMicroDeformation( ) )[ j ] - ( *aspm.getNonLocalMicroDeformation( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
         }
 
     }
 
-    for ( unsigned int i = 0; i < asp4.F.size( ); i++ ){
+    for ( unsigned int i = 0; i < asp3.Xi.size( ); i++ ){
 
-        floatVector deltas( asp4.F.size( ), 0 );
+        floatVector deltas( asp3.Xi.size( ), 0 );
 
-        deltas[ i ] = eps * std::fabs( asp4.F[ i ] ) + eps;
+        deltas[ i ] = eps * std::fabs( asp3.Xi[ i ] ) + eps;
 
         aspBaseMock aspp, aspm;
 
-        aspp.F += deltas;
+        aspp.Xi += deltas;
 
-        aspm.F -= deltas;
+        aspm.Xi -= deltas;
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-        for ( unsigned int j = 0; j < 3; j++ ){
+        for ( unsigned int j = 0; j < 9; j++ ){
 
-            dddF[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
+            dChiNLdXi[ j ][ i ] = ( ( *aspp.getNonLocalMicroDeformation( ) )[ j ] - ( *aspm.getNonLocalMicroDeformation( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
         }
 
     }
 
-    for ( unsigned int i = 0; i < asp5.chi.size( ); i++ ){
+    for ( unsigned int i = 0; i < asp4.D.size( ); i++ ){
 
-        floatVector deltas( asp5.chi.size( ), 0 );
+        floatVector deltas( asp4.D.size( ), 0 );
 
-        deltas[ i ] = eps * std::fabs( asp5.chi[ i ] ) + eps;
+        deltas[ i ] = eps * std::fabs( asp4.D[ i ] ) + eps;
 
         aspBaseMock aspp, aspm;
 
-        aspp.chi += deltas;
+        aspp.D += deltas;
 
-        aspm.chi -= deltas;
+        aspm.D -= deltas;
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-        for ( unsigned int j = 0; j < 3; j++ ){
+        for ( unsigned int j = 0; j < 9; j++ ){
 
-            dddChi[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
+            dChiNLdD[ j ][ i ] = ( ( *aspp.getNonLocalMicroDeformation( ) )[ j ] - ( *aspm.getNonLocalMicroDeformation( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
         }
 
     }
 
-    for ( unsigned int i = 0; i < asp6.chiNLBase.size( ); i++ ){
+    for ( unsigned int i = 0; i < asp5.XiNL.size( ); i++ ){
 
-        floatVector deltas( asp6.chiNLBase.size( ), 0 );
+        floatVector deltas( asp5.XiNL.size( ), 0 );
 
-        deltas[ i ] = eps * std::fabs( asp6.chiNLBase[ i ] ) + eps;
+        deltas[ i ] = eps * std::fabs( asp5.XiNL[ i ] ) + eps;
 
         aspBaseMock aspp, aspm;
 
-        aspp.chiNLBase += deltas;
+        aspp.XiNL += deltas;
 
-        aspm.chiNLBase -= deltas;
+        aspm.XiNL -= deltas;
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-        for ( unsigned int j = 0; j < 3; j++ ){
-
-            dddChiNLBase[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
-
-        }
-
-    }
-
-    for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
-
-        floatVector deltas( gradientMicroDeformation.size( ), 0 );
-
-        deltas[ i ] = eps * std::fabs( gradientMicroDeformation[ i ] ) + eps;
-
-        aspBaseMock aspp, aspm;
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation + deltas );
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation - deltas );
-
-        for ( unsigned int j = 0; j < 3; j++ ){
+        for ( unsigned int j = 0; j < 9; j++ ){
 
-            dddGradChi[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
+            dChiNLdXiNL[ j ][ i ] = ( ( *aspp.getNonLocalMicroDeformation( ) )[ j ] - ( *aspm.getNonLocalMicroDeformation( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
         }
 
     }
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dddXi, *asp1.getdCurrentDistanceVectordLocalReferenceRelativePositionVector( ) ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( dddD, *asp2.getdCurrentDistanceVectordLocalReferenceDistanceVector( ) ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( dddXiNL, *asp3.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dChiNLdChiNLBase, *asp1.getdNonLocalMicroDeformationdNonLocalMicroDeformationBase( ) ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dddF, *asp4.getdCurrentDistanceVectordLocalDeformationGradient( ) ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dChiNLdGradChi, *asp2.getdNonLocalMicroDeformationdGradientMicroDeformation( ) ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dddChi, *asp5.getdCurrentDistanceVectordLocalMicroDeformation( ) ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dChiNLdXi, *asp3.getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dddChiNLBase, *asp6.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dChiNLdD, *asp4.getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dddGradChi, *asp7.getdCurrentDistanceVectordGradientMicroDeformation( ) ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dChiNLdXiNL, *asp5.getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVectorSecondGradients ){
+BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalMicroDeformationSecondDerivatives ){
 
     class aspBaseMock : public asp::aspBase{
 
         public:
 
-            floatVector Xi = { 1, 2, 3 };
-    
-            floatVector XiNL = { 4, 5, 6 };
-    
-            floatVector D = { .7, .8, .9 };
+            floatVector microDeformationBase = { 4,  5,  6,
+                                                 7,  8,  9,
+                                                10, 11, 12 };
     
-            floatVector F = { 10, 11, 12,
-                              13, 14, 15,
-                              16, 17, 18 };
+            floatVector Xi = { 1, 2, 3 };
     
-            floatVector chi = { 19, 20, 21,
-                                22, 23, 24,
-                                25, 26, 27 };
+            floatVector D = { 3, 4, 5 };
     
-            floatVector chiNLBase = { 28, 29, 30,
-                                      31, 32, 33,
-                                      34, 35, 36 };
+            floatVector XiNL = { 6, 7, 8 };
 
         private:
 
@@ -2813,14 +3155,6 @@ BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVectorSecondGradients ){
     
             }
     
-            void setNonLocalSurfaceReferenceRelativePositionVector( ) override {
-    
-                asp::aspBase::setNonLocalSurfaceReferenceRelativePositionVector( XiNL );
-    
-                return;
-    
-            }
-    
             void setReferenceDistanceVector( ) override {
     
                 asp::aspBase::setReferenceDistanceVector( D );
@@ -2829,37 +3163,27 @@ BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVectorSecondGradients ){
     
             }
     
-            void setLocalDeformationGradient( ) override {
-    
-                asp::aspBase::setLocalDeformationGradient( F );
-    
-                return;
-    
-            }
-    
-            void setLocalMicroDeformation( ) override {
+            void setNonLocalSurfaceReferenceRelativePositionVector( ) override {
     
-                asp::aspBase::setLocalMicroDeformation( chi );
+                asp::aspBase::setNonLocalSurfaceReferenceRelativePositionVector( XiNL );
     
                 return;
     
             }
     
-            void setNonLocalMicroDeformationBase( ) override {
-    
-                asp::aspBase::setNonLocalMicroDeformationBase( chiNLBase );
+            void setNonLocalMicroDeformationBase( ) override{
     
-                return;
+                asp::aspBase::setNonLocalMicroDeformationBase( microDeformationBase );
     
             }
 
     };
 
-    aspBaseMock asp1, asp2, asp3, asp4, asp5, asp6, asp7;
+    aspBaseMock asp1, asp2, asp3, asp4, asp5;
 
-    floatVector gradientMicroDeformation = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9,
-                                             1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8,
-                                             1.9, 2.0, 2.1, 2.2, 2.3, 2.4, 2.5, 2.6, 2.7 };
+    floatVector gradientMicroDeformation = { 13, 14, 15, 16, 17, 18, 19, 20, 21,
+                                             22, 23, 24, 25, 26, 27, 28, 29, 30,
+                                             31, 32, 33, 34, 35, 36, 37, 38, 39 };
 
     asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp1, gradientMicroDeformation );
 
@@ -2871,598 +3195,513 @@ BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVectorSecondGradients ){
 
     asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp5, gradientMicroDeformation );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp6, gradientMicroDeformation );
+    floatMatrix d2ChiNLdXidGradChi( 9, floatVector( 3 * 27, 0 ) );
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp7, gradientMicroDeformation );
+    floatMatrix d2ChiNLdDdGradChi( 9, floatVector( 3 * 27, 0 ) );
 
-    floatMatrix d2ddXidXi_answer( 3, floatVector( 3 * 3, 0 ) );
-    floatMatrix d2ddXidXi = d2ddXidXi_answer;
+    floatMatrix d2ChiNLdXiNLdGradChi( 9, floatVector( 3 * 27, 0 ) );
 
-    floatMatrix d2ddDdXi_answer( 3, floatVector( 3 * 3, 0 ) );
-    floatMatrix d2ddDdXi = d2ddDdXi_answer;
+    floatType eps = 1e-6;
 
-    floatMatrix d2ddXiNLdXi( 3, floatVector( 3 * 3, 0 ) );
+    for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
 
-    floatMatrix d2ddFdXi( 3, floatVector( 9 * 3, 0 ) );
+        floatVector deltas( gradientMicroDeformation.size( ), 0 );
 
-    floatMatrix d2ddChidXi( 3, floatVector( 9 * 3, 0 ) );
+        deltas[ i ] = eps * std::fabs( gradientMicroDeformation[ i ] ) + eps;
 
-    floatMatrix d2ddChiNLBasedXi_answer( 3, floatVector( 9 * 3, 0 ) );
-    floatMatrix d2ddChiNLBasedXi = d2ddChiNLBasedXi_answer;
+        aspBaseMock aspp, aspm;
 
-    floatMatrix d2ddGradChidXi( 3, floatVector( 27 * 3, 0 ) );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation + deltas );
 
-    floatMatrix d2ddDdD_answer( 3, floatVector( 3 * 3, 0 ) );
-    floatMatrix d2ddDdD = d2ddDdD_answer;
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation - deltas );
 
-    floatMatrix d2ddXiNLdD( 3, floatVector( 3 * 3, 0 ) );
+        for ( unsigned int j = 0; j < 9; j++ ){
 
-    floatMatrix d2ddFdD( 3, floatVector( 9 * 3, 0 ) );
+            for ( unsigned int k = 0; k < 3; k++ ){
 
-    floatMatrix d2ddChidD_answer( 3, floatVector( 9 * 3, 0 ) );
-    floatMatrix d2ddChidD = d2ddChidD_answer;
+                d2ChiNLdXidGradChi[ j ][ 27 * k + i ] = ( ( *aspp.getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) )[ j ][ k ] - ( *aspm.getdNonLocalMicroDeformationdLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    floatMatrix d2ddChiNLBasedD_answer( 3, floatVector( 9 * 3, 0 ) );
-    floatMatrix d2ddChiNLBasedD = d2ddChiNLBasedD_answer;
+                d2ChiNLdDdGradChi[ j ][ 27 * k + i ] = ( ( *aspp.getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) )[ j ][ k ] - ( *aspm.getdNonLocalMicroDeformationdLocalReferenceDistanceVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    floatMatrix d2ddGradChidD( 3, floatVector( 27 * 3, 0 ) );
+                d2ChiNLdXiNLdGradChi[ j ][ 27 * k + i ] = ( ( *aspp.getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) )[ j ][ k ] - ( *aspm.getdNonLocalMicroDeformationdNonLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    floatMatrix d2ddXiNLdXiNL( 3, floatVector( 3 * 3, 0 ) );
+            }
 
-    floatMatrix d2ddFdXiNL( 3, floatVector( 9 * 3, 0 ) );
+        }
 
-    floatMatrix d2ddChidXiNL_answer( 3, floatVector( 9 * 3, 0 ) );
-    floatMatrix d2ddChidXiNL = d2ddChidXiNL_answer;
+    }
 
-    floatMatrix d2ddChiNLBasedXiNL( 3, floatVector( 9 * 3, 0 ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ChiNLdXidGradChi, *asp1.getd2NonLocalMicroDeformationdLocalReferenceRelativePositionVectordGradientMicroDeformation( ) ) );
 
-    floatMatrix d2ddGradChidXiNL( 3, floatVector( 27 * 3, 0 ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ChiNLdDdGradChi, *asp2.getd2NonLocalMicroDeformationdLocalReferenceDistanceVectordGradientMicroDeformation( ) ) );
 
-    floatMatrix d2ddFdF_answer( 3, floatVector( 9 * 9, 0 ) );
-    floatMatrix d2ddFdF( 3, floatVector( 9 * 9, 0 ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ChiNLdXiNLdGradChi, *asp3.getd2NonLocalMicroDeformationdNonLocalReferenceRelativePositionVectordGradientMicroDeformation( ) ) );
 
-    floatMatrix d2ddChidF_answer( 3, floatVector( 9 * 9, 0 ) );
-    floatMatrix d2ddChidF( 3, floatVector( 9 * 9, 0 ) );
+}
 
-    floatMatrix d2ddChiNLBasedF_answer( 3, floatVector( 9 * 9, 0 ) );
-    floatMatrix d2ddChiNLBasedF( 3, floatVector( 9 * 9, 0 ) );
+BOOST_AUTO_TEST_CASE( test_aspBase_setLocalCurrentNormal ){
 
-    floatMatrix d2ddGradChidF_answer( 3, floatVector( 27 * 9, 0 ) );
-    floatMatrix d2ddGradChidF( 3, floatVector( 27 * 9, 0 ) );
+    class aspBaseMock : public asp::aspBase{
 
-    floatMatrix d2ddChidChi_answer( 3, floatVector( 9 * 9, 0 ) );
-    floatMatrix d2ddChidChi( 3, floatVector( 9 * 9, 0 ) );
+        void setLocalReferenceNormal( ){
 
-    floatMatrix d2ddChiNLBasedChi_answer( 3, floatVector( 9 * 9, 0 ) );
-    floatMatrix d2ddChiNLBasedChi( 3, floatVector( 9 * 9, 0 ) );
+            floatVector value = { 1, 2, 3 };
 
-    floatMatrix d2ddGradChidChi_answer( 3, floatVector( 27 * 9, 0 ) );
-    floatMatrix d2ddGradChidChi( 3, floatVector( 27 * 9, 0 ) );
+            asp::unit_test::aspBaseTester::set_localReferenceNormal( *this, value );
 
-    floatMatrix d2ddChiNLBasedChiNLBase_answer( 3, floatVector( 9 * 9, 0 ) );
-    floatMatrix d2ddChiNLBasedChiNLBase( 3, floatVector( 9 * 9, 0 ) );
+            return;
 
-    floatMatrix d2ddGradChidChiNLBase_answer( 3, floatVector( 27 * 9, 0 ) );
-    floatMatrix d2ddGradChidChiNLBase( 3, floatVector( 27 * 9, 0 ) );
+        }
 
-    floatMatrix d2ddGradChidGradChi_answer( 3, floatVector( 27 * 27, 0 ) );
-    floatMatrix d2ddGradChidGradChi( 3, floatVector( 27 * 27, 0 ) );
+        void setLocalMicroDeformation( ){
 
-    floatType eps = 1e-6;
+            floatVector value = { 0.39293837, -0.42772133, -0.54629709,
+                                  0.10262954,  0.43893794, -0.15378708,
+                                  0.9615284 ,  0.36965948, -0.0381362 };
 
-    for ( unsigned int i = 0; i < asp1.Xi.size( ); i++ ){
+            asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, value );
 
-        floatVector deltas( asp1.Xi.size( ), 0 );
+            return;
 
-        deltas[ i ] = eps * std::fabs( asp1.Xi[ i ] ) + eps;
+        }
 
-        aspBaseMock aspp, aspm;
+    };
 
-        aspp.Xi += deltas;
+    aspBaseMock asp;
 
-        aspm.Xi -= deltas;
+    floatVector answer = { -0.73381014, -0.454509  ,  0.50492004 };
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
+    asp::dataStorage< floatVector > result;
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
+    asp::unit_test::aspBaseTester::setLocalCurrentNormal( asp, result );
 
-        for ( unsigned int j = 0; j < 3; j++ ){
+    BOOST_CHECK( result.first );
 
-            for ( unsigned int k = 0; k < 3; k++ ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
 
-                d2ddXidXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalReferenceRelativePositionVector( ) )[ j ][ k ]
-                                              - ( *aspm.getdCurrentDistanceVectordLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    aspBaseMock aspGet;
 
-            }
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalCurrentNormal( ), answer ) );
 
-            for ( unsigned int k = 0; k < 3; k++ ){
+}
 
-                d2ddDdXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalReferenceDistanceVector( ) )[ j ][ k ]
-                                             - ( *aspm.getdCurrentDistanceVectordLocalReferenceDistanceVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+BOOST_AUTO_TEST_CASE( test_aspBase_setLocalCurrentNormalGradients ){
 
-            }
+    class aspBaseMock : public asp::aspBase{
 
-            for ( unsigned int k = 0; k < 3; k++ ){
+        public:
 
-                d2ddXiNLdXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ]
-                                                - ( *aspm.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+            floatVector N = { 1, 2, 3 };
+    
+            floatVector chi = { 0.39293837, -0.42772133, -0.54629709,
+                                0.10262954,  0.43893794, -0.15378708,
+                                0.9615284 ,  0.36965948, -0.0381362 };
 
+        private:
+
+            void setLocalReferenceNormal( ){
+    
+                asp::aspBase::setLocalReferenceNormal( N );
+    
+                return;
+    
+            }
+    
+            void setLocalMicroDeformation( ){
+    
+                asp::aspBase::setLocalMicroDeformation( chi );
+    
             }
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+    };
 
-                d2ddFdXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ]
-                                             - ( *aspm.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    aspBaseMock asp1, asp2;
 
-            }
+    floatMatrix dndChi( 3, floatVector( 9, 0 ) );
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+    floatMatrix dndN( 3, floatVector( 3, 0 ) );
 
-                d2ddChidXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ]
-                                               - ( *aspm.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    floatType eps = 1e-6;
 
-            }
+    for ( unsigned int i = 0; i < asp1.chi.size( ); i++ ){
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+        floatVector deltas( asp1.chi.size( ), 0 );
 
-                d2ddChiNLBasedXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
-                                                     - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+        deltas[ i ] = eps * std::fabs( asp1.chi[ i ] ) + eps;
 
-            }
+        aspBaseMock aspp, aspm;
 
-            for ( unsigned int k = 0; k < 27; k++ ){
+        aspp.chi += deltas;
 
-                d2ddGradChidXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
-                                                   - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+        aspm.chi -= deltas;
 
-            }
+        for ( unsigned int j = 0; j < 3; j++ ){
+
+            dndChi[ j ][ i ] = ( ( *aspp.getLocalCurrentNormal( ) )[ j ] - ( *aspm.getLocalCurrentNormal( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
         }
 
     }
 
-    for ( unsigned int i = 0; i < asp2.D.size( ); i++ ){
+    for ( unsigned int i = 0; i < asp1.N.size( ); i++ ){
 
-        floatVector deltas( asp2.D.size( ), 0 );
+        floatVector deltas( asp1.N.size( ), 0 );
 
-        deltas[ i ] = eps * std::fabs( asp1.D[ i ] ) + eps;
+        deltas[ i ] = eps * std::fabs( asp1.N[ i ] ) + eps;
 
         aspBaseMock aspp, aspm;
 
-        aspp.D += deltas;
-
-        aspm.D -= deltas;
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
+        aspp.N += deltas;
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
+        aspm.N -= deltas;
 
         for ( unsigned int j = 0; j < 3; j++ ){
 
-            for ( unsigned int k = 0; k < 3; k++ ){
+            dndN[ j ][ i ] = ( ( *aspp.getLocalCurrentNormal( ) )[ j ] - ( *aspm.getLocalCurrentNormal( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
-                d2ddDdD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalReferenceDistanceVector( ) )[ j ][ k ]
-                                            - ( *aspm.getdCurrentDistanceVectordLocalReferenceDistanceVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+        }
 
-            }
+    }
 
-            for ( unsigned int k = 0; k < 3; k++ ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( dndChi, *asp1.getdLocalCurrentNormaldLocalMicroDeformation( ) ) );
 
-                d2ddXiNLdD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ]
-                                               - ( *aspm.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dndN, *asp1.getdLocalCurrentNormaldLocalReferenceNormal( ) ) );
 
-            }
+}
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalCurrentNormal ){
 
-                d2ddFdD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ]
-                                            - ( *aspm.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    class aspBaseMock : public asp::aspBase{
 
-            }
+        public:
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+            floatMatrix values = { { 1, 2, 3 }, { 4, 5, 6 } };
 
-                d2ddChidD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ]
-                                              - ( *aspm.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
+        private:
+
+            void getLocalReferenceNormal( const unsigned int &index, floatVector &value ){
+    
+                value = values[ index ];
+    
+                return;
+    
+            }
+    
+            void setLocalMicroDeformation( ){
+    
+                floatVector value = { 0.39293837, -0.42772133, -0.54629709,
+                                      0.10262954,  0.43893794, -0.15378708,
+                                      0.9615284 ,  0.36965948, -0.0381362 };
+    
+                asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, value );
+    
+                return;
+    
             }
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+    };
 
-                d2ddChiNLBasedD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
-                                                    - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    aspBaseMock asp;
 
-            }
+    floatMatrix answers = {
+                              { -0.73381014, -0.454509  ,  0.50492004 },
+                              { -0.68612755, -0.39784135,  0.60905767 },
+                          };
 
-            for ( unsigned int k = 0; k < 27; k++ ){
+    floatVector result;
 
-                d2ddGradChidD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
-                                                  - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    for ( unsigned int i = 0; i < answers.size( ); i++ ){
 
-            }
+        asp.getLocalCurrentNormal( i, result );
 
-        }
+        BOOST_CHECK( vectorTools::fuzzyEquals( result, answers[ i ] ) );
 
     }
 
-    for ( unsigned int i = 0; i < asp3.XiNL.size( ); i++ ){
-
-        floatVector deltas( asp3.XiNL.size( ), 0 );
+}
 
-        deltas[ i ] = eps * std::fabs( asp3.XiNL[ i ] ) + eps;
 
-        aspBaseMock aspp, aspm;
+BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVector ){
 
-        aspp.XiNL += deltas;
+    class aspBaseMock : public asp::aspBase{
 
-        aspm.XiNL -= deltas;
+        void setLocalSurfaceReferenceRelativePositionVector( ){
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
+            floatVector value = { 1, 2, 3 };
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
+            asp::unit_test::aspBaseTester::set_localSurfaceReferenceRelativePositionVector( *this, value );
 
-        for ( unsigned int j = 0; j < 3; j++ ){
+            return;
 
-            for ( unsigned int k = 0; k < 3; k++ ){
+        }
 
-                d2ddXiNLdXiNL[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ]
-                                                  - ( *aspm.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+        void setNonLocalSurfaceReferenceRelativePositionVector( ){
 
-            }
+            floatVector value = { 4, 5, 6 };
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+            asp::unit_test::aspBaseTester::set_nonLocalSurfaceReferenceRelativePositionVector( *this, value );
 
-                d2ddFdXiNL[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ]
-                                               - ( *aspm.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+            return;
 
-            }
+        }
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+        void setReferenceDistanceVector( ){
 
-                d2ddChidXiNL[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ]
-                                                 - ( *aspm.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+            floatVector value = { 7, 8, 9 };
 
-            }
+            asp::unit_test::aspBaseTester::set_referenceDistanceVector( *this, value );
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+            return;
 
-                d2ddChiNLBasedXiNL[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
-                                                       - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+        }
 
-            }
+        void setLocalDeformationGradient( ){
 
-            for ( unsigned int k = 0; k < 27; k++ ){
+            floatVector value = { 10, 11, 12,
+                                  13, 14, 15,
+                                  16, 17, 18 };
 
-                d2ddGradChidXiNL[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
-                                                     - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+            asp::unit_test::aspBaseTester::set_localDeformationGradient( *this, value );
 
-            }
+            return;
 
         }
 
-    }
+        void setLocalMicroDeformation( ){
 
-    for ( unsigned int i = 0; i < asp4.F.size( ); i++ ){
+            floatVector value = { 19, 20, 21,
+                                  22, 23, 24,
+                                  25, 26, 27 };
 
-        floatVector deltas( asp4.F.size( ), 0 );
+            asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, value );
 
-        deltas[ i ] = eps * std::fabs( asp4.F[ i ] ) + eps;
+            return;
 
-        aspBaseMock aspp, aspm;
+        }
 
-        aspp.F += deltas;
+        void setNonLocalMicroDeformation( ){
 
-        aspm.F -= deltas;
+            floatVector value = { 28, 29, 30,
+                                  31, 32, 33,
+                                  34, 35, 36 };
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
+            asp::unit_test::aspBaseTester::set_nonLocalMicroDeformation( *this, value );
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
+            return;
 
-        for ( unsigned int j = 0; j < 3; j++ ){
+        }
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+    };
 
-                d2ddFdF[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ]
-                                            - ( *aspm.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    aspBaseMock asp;
 
-            }
+    floatVector gradientMicroDeformation( 27, 0 );
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp, gradientMicroDeformation );
 
-                d2ddChidF[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ]
-                                              - ( *aspm.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    floatVector answer = { 482, 554, 626 };
 
-            }
+    asp::dataStorage< floatVector > result;
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+    asp::unit_test::aspBaseTester::setCurrentDistanceVector( asp, result );
 
-                d2ddChiNLBasedF[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
-                                                    - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    BOOST_CHECK( result.first );
 
-            }
-
-            for ( unsigned int k = 0; k < 27; k++ ){
-
-                d2ddGradChidF[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
-                                                  - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
-
-            }
-
-        }
-    }
-
-    for ( unsigned int i = 0; i < asp5.chi.size( ); i++ ){
-
-        floatVector deltas( asp5.chi.size( ), 0 );
-
-        deltas[ i ] = eps * std::fabs( asp5.chi[ i ] ) + eps;
-
-        aspBaseMock aspp, aspm;
-
-        aspp.chi += deltas;
-
-        aspm.chi -= deltas;
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
 
-        for ( unsigned int j = 0; j < 3; j++ ){
+    aspBaseMock aspGet;
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspGet, gradientMicroDeformation );
 
-                d2ddChidChi[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ]
-                                                - ( *aspm.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getCurrentDistanceVector( ), answer ) );
 
-            }
+}
 
-            for ( unsigned int k = 0; k < 9; k++ ){
+BOOST_AUTO_TEST_CASE( test_aspBase_evaluationMode ){
+    /*!
+     * Test that the derivatives of the current distance vector and the local current normal are only formed
+     * when the evaluation mode requires them or they are requested directly
+     */
 
-                d2ddChiNLBasedChi[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
-                                                      - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+    class aspBaseMock : public asp::aspBase{
 
-            }
+        void setLocalReferenceNormal( ){
 
-            for ( unsigned int k = 0; k < 27; k++ ){
+            floatVector value = { 1, 2, 3 };
 
-                d2ddGradChidChi[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
-                                                    - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+            asp::unit_test::aspBaseTester::set_localReferenceNormal( *this, value );
 
-            }
+            return;
 
         }
 
-    }
-
-    for ( unsigned int i = 0; i < asp6.chiNLBase.size( ); i++ ){
-
-        floatVector deltas( asp6.chiNLBase.size( ), 0 );
-
-        deltas[ i ] = eps * std::fabs( asp6.chiNLBase[ i ] ) + eps;
-
-        aspBaseMock aspp, aspm;
-
-        aspp.chiNLBase += deltas;
-
-        aspm.chiNLBase -= deltas;
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
-
-        for ( unsigned int j = 0; j < 3; j++ ){
-
-            for ( unsigned int k = 0; k < 9; k++ ){
-
-                d2ddChiNLBasedChiNLBase[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
-                                                            - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
-
-            }
+        void setLocalSurfaceReferenceRelativePositionVector( ){
 
-            for ( unsigned int k = 0; k < 27; k++ ){
+            floatVector value = { 1, 2, 3 };
 
-                d2ddGradChidChiNLBase[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
-                                                          - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+            asp::unit_test::aspBaseTester::set_localSurfaceReferenceRelativePositionVector( *this, value );
 
-            }
+            return;
 
         }
 
-    }
-
-    for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
-
-        floatVector deltas( gradientMicroDeformation.size( ), 0 );
-
-        deltas[ i ] = eps * std::fabs( gradientMicroDeformation[ i ] ) + eps;
-
-        aspBaseMock aspp, aspm;
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation + deltas );
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation - deltas );
-
-        for ( unsigned int j = 0; j < 3; j++ ){
+        void setNonLocalSurfaceReferenceRelativePositionVector( ){
 
-            for ( unsigned int k = 0; k < 27; k++ ){
+            floatVector value = { 4, 5, 6 };
 
-                d2ddGradChidGradChi[ j ][ 27 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
-                                                         - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
+            asp::unit_test::aspBaseTester::set_nonLocalSurfaceReferenceRelativePositionVector( *this, value );
 
-            }
+            return;
 
         }
 
-    }
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddXidXi, d2ddXidXi_answer ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddDdXi, d2ddDdXi_answer ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddXiNLdXi, *asp1.getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( ) ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddFdXi, *asp1.getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( ) ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChidXi, *asp1.getd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( ) ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedXi, d2ddChiNLBasedXi_answer ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidXi, *asp1.getd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( ) ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddDdD, d2ddDdD_answer ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddXiNLdD, *asp1.getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( ) ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddFdD, *asp1.getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( ) ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChidD, d2ddChidD_answer ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedD, d2ddChiNLBasedD_answer ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidD, *asp1.getd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( ) ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddXiNLdXiNL, *asp1.getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( ) ) );
+        void setReferenceDistanceVector( ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddFdXiNL, *asp1.getd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( ) ) );
+            floatVector value = { 7, 8, 9 };
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChidXiNL, d2ddChidXiNL_answer ) );
+            asp::unit_test::aspBaseTester::set_referenceDistanceVector( *this, value );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedXiNL, *asp1.getd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( ) ) );
+            return;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidXiNL, *asp1.getd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( ) ) );
+        }
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddFdF, d2ddFdF_answer ) );
+        void setLocalDeformationGradient( ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChidF, d2ddChidF_answer ) );
+            floatVector value = { 10, 11, 12,
+                                  13, 14, 15,
+                                  16, 17, 18 };
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedF, d2ddChiNLBasedF_answer ) );
+            asp::unit_test::aspBaseTester::set_localDeformationGradient( *this, value );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidF, d2ddGradChidF_answer ) );
+            return;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChidChi, d2ddChidChi_answer ) );
+        }
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedChi, d2ddChiNLBasedChi_answer ) );
+        void setLocalMicroDeformation( ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidChi, d2ddGradChidChi_answer ) );
+            floatVector value = { 0.39293837, -0.42772133, -0.54629709,
+                                  0.10262954,  0.43893794, -0.15378708,
+                                  0.9615284 ,  0.36965948, -0.0381362 };
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedChiNLBase, d2ddChiNLBasedChiNLBase_answer ) );
+            asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, value );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidChiNLBase, d2ddGradChidChiNLBase_answer ) );
+            return;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidGradChi, d2ddGradChidGradChi_answer ) );
+        }
 
-}
+        void setNonLocalMicroDeformation( ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setSurfaceParameters ){
+            floatVector value = { 28, 29, 30,
+                                  31, 32, 33,
+                                  34, 35, 36 };
 
-    class aspBaseMock : public asp::aspBase{
+            asp::unit_test::aspBaseTester::set_nonLocalMicroDeformation( *this, value );
 
-        public:
+            return;
 
-            floatVector surfaceParametersAnswer = { 1, 2, 3 };
+        }
 
-        private:
+    };
 
-            virtual void setSurfaceParameters( ){
+    floatVector gradientMicroDeformation( 27, 0 );
 
-                asp::unit_test::aspBaseTester::set_surfaceParameters( *this, surfaceParametersAnswer );
+    for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
 
-            }
-    };
+        gradientMicroDeformation[ i ] = 0.01 * i;
 
-    aspBaseMock asp;
+    }
 
-    floatVector answer = { 1, 2, 3 };
+    // The default mode forms all of the derivatives with the values
+    aspBaseMock aspHessian;
 
-    asp::dataStorage< floatVector > result;
+    BOOST_CHECK( *aspHessian.getEvaluationMode( ) == asp::HESSIAN );
 
-    asp::unit_test::aspBaseTester::setSurfaceParameters( asp, result );
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspHessian, gradientMicroDeformation );
 
-    BOOST_CHECK( result.first );
+    floatVector currentDistanceAnswer = *aspHessian.getCurrentDistanceVector( );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    floatVector localCurrentNormalAnswer = *aspHessian.getLocalCurrentNormal( );
 
-    aspBaseMock aspGet;
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getdCurrentDistanceVectordLocalDeformationGradient( aspHessian ).first );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getSurfaceParameters( ), answer ) );
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( aspHessian ).first );
 
-}
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getdLocalCurrentNormaldLocalMicroDeformation( aspHessian ).first );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceAdhesionEnergyDensity ){
+    floatMatrix dddFAnswer = *aspHessian.getdCurrentDistanceVectordLocalDeformationGradient( );
 
-    class aspBaseMock : public asp::aspBase{
+    floatMatrix d2ddFdXiAnswer = *aspHessian.getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( );
 
-        public:
+    floatMatrix dndChiAnswer = *aspHessian.getdLocalCurrentNormaldLocalMicroDeformation( );
 
-            floatVector distanceVector = { 1, 2, 3 };
+    // Only the values are formed in the energy mode
+    aspBaseMock aspEnergy;
 
-            floatVector localCurrentNormal = { 0.45584231, 0.56980288, 0.68376346 };
+    aspEnergy.setEvaluationMode( asp::ENERGY );
 
-            floatVector surfaceParameters = { 12.3, 45.6 };
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspEnergy, gradientMicroDeformation );
 
-            aspBaseMock( ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspEnergy.getCurrentDistanceVector( ), currentDistanceAnswer ) );
 
-                asp::unit_test::aspBaseTester::set_currentDistanceVector( *this, distanceVector );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspEnergy.getLocalCurrentNormal( ), localCurrentNormalAnswer ) );
 
-                asp::unit_test::aspBaseTester::set_localCurrentNormal( *this, localCurrentNormal );
+    BOOST_CHECK( !asp::unit_test::aspBaseTester::getdCurrentDistanceVectordLocalDeformationGradient( aspEnergy ).first );
 
-                asp::unit_test::aspBaseTester::set_surfaceParameters( *this, surfaceParameters );
+    BOOST_CHECK( !asp::unit_test::aspBaseTester::getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( aspEnergy ).first );
 
-            }
+    BOOST_CHECK( !asp::unit_test::aspBaseTester::getdLocalCurrentNormaldLocalMicroDeformation( aspEnergy ).first );
 
-    };
-    
-    aspBaseMock asp, aspGet;
+    // Requesting a first derivative directly only forms the first derivatives
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspEnergy.getdCurrentDistanceVectordLocalDeformationGradient( ), dddFAnswer ) );
 
-    floatType answer = 178.2828858284305;
+    BOOST_CHECK( !asp::unit_test::aspBaseTester::getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( aspEnergy ).first );
 
-    floatType result;
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspEnergy.getdLocalCurrentNormaldLocalMicroDeformation( ), dndChiAnswer ) );
 
-    asp.computeSurfaceAdhesionEnergyDensity( result );
+    // Requesting a second derivative directly forms the second derivatives
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspEnergy.getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( ), d2ddFdXiAnswer ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
+    // The first derivatives are formed with the values in the gradient mode
+    aspBaseMock aspGradient;
 
-    asp::dataStorage< floatType > result2;
+    aspGradient.setEvaluationMode( asp::GRADIENT );
 
-    asp::unit_test::aspBaseTester::setSurfaceAdhesionEnergyDensity( asp, result2 );
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspGradient, gradientMicroDeformation );
 
-    BOOST_CHECK( result2.first );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGradient.getCurrentDistanceVector( ), currentDistanceAnswer ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result2.second, answer ) );
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getdCurrentDistanceVectordLocalDeformationGradient( aspGradient ).first );
 
-    result = *aspGet.getSurfaceAdhesionEnergyDensity( );
+    BOOST_CHECK( vectorTools::fuzzyEquals( asp::unit_test::aspBaseTester::getdCurrentDistanceVectordLocalDeformationGradient( aspGradient ).second, dddFAnswer ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
+    BOOST_CHECK( !asp::unit_test::aspBaseTester::getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( aspGradient ).first );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceAdhesionEnergyDensity2 ){
+BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVectorGradients ){
 
     class aspBaseMock : public asp::aspBase{
 
         public:
 
-            floatVector Xi = { .1, .2, .3 };
+            floatVector Xi = { 1, 2, 3 };
     
-            floatVector XiNL = { .4, .5, .6 };
+            floatVector XiNL = { 4, 5, 6 };
     
             floatVector D = { .7, .8, .9 };
     
-            floatVector F = { 1.1, 0.2, 0.3,
-                              0.4, 1.5, 0.6,
-                              0.7, 0.8, 1.9 };
+            floatVector F = { 10, 11, 12,
+                              13, 14, 15,
+                              16, 17, 18 };
     
-            floatVector chi = { 1.19, 0.20, 0.21,
-                                0.22, 1.23, 0.24,
-                                0.25, 0.26, 0.27 };
+            floatVector chi = { 19, 20, 21,
+                                22, 23, 24,
+                                25, 26, 27 };
     
-            floatVector chiNLBase = { 1.28, 0.29, 0.30,
-                                      0.31, 1.32, 0.33,
-                                      0.34, 0.35, 1.36 };
-
-            floatVector localReferenceNormal = { 0.4, .8, -0.2 };
-
-            floatVector surfaceParameters = { 12.3, 45.6 };
+            floatVector chiNLBase = { 28, 29, 30,
+                                      31, 32, 33,
+                                      34, 35, 36 };
 
         private:
 
@@ -3514,1701 +3753,1705 @@ BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceAdhesionEnergyDensity2 ){
     
             }
 
-            void setSurfaceParameters( ) override {
+    };
 
-                asp::aspBase::setSurfaceParameters( surfaceParameters );
-
-            }
-
-            void setLocalReferenceNormal( ) override {
-
-                asp::aspBase::setLocalReferenceNormal( localReferenceNormal );
-
-            }
-
-    };
-    
-    aspBaseMock asp, aspGet, asp1, asp2, asp3;
+    aspBaseMock asp1, asp2, asp3, asp4, asp5, asp6, asp7;
 
     floatVector gradientMicroDeformation = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9,
                                              1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8,
                                              1.9, 2.0, 2.1, 2.2, 2.3, 2.4, 2.5, 2.6, 2.7 };
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp, gradientMicroDeformation );
-
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspGet, gradientMicroDeformation );
-
     asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp1, gradientMicroDeformation );
 
     asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp2, gradientMicroDeformation );
 
     asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp3, gradientMicroDeformation );
 
-    floatType answer;
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp4, gradientMicroDeformation );
 
-    floatType result;
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp5, gradientMicroDeformation );
 
-    asp.computeSurfaceAdhesionEnergyDensity( answer );
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp6, gradientMicroDeformation );
 
-    floatVector _dSurfaceAdhesionEnergyDensitydLocalDeformationGradient,
-                _dSurfaceAdhesionEnergyDensitydLocalMicroDeformation,
-                _dSurfaceAdhesionEnergyDensitydGradientMicroDeformation;
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp7, gradientMicroDeformation );
 
-    asp.computeSurfaceAdhesionEnergyDensity( result,
-                                             _dSurfaceAdhesionEnergyDensitydLocalDeformationGradient,
-                                             _dSurfaceAdhesionEnergyDensitydLocalMicroDeformation,
-                                             _dSurfaceAdhesionEnergyDensitydGradientMicroDeformation );
+    floatMatrix dddXi( 3, floatVector( 3, 0 ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
+    floatMatrix dddD( 3, floatVector( 3, 0 ) );
 
-    aspGet.getdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( );
+    floatMatrix dddXiNL( 3, floatVector( 3, 0 ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result, *aspGet.getSurfaceAdhesionEnergyDensity( ) ) );
+    floatMatrix dddF( 3, floatVector( 9, 0 ) );
 
-    floatVector dSurfaceAdhesionEnergyDensitydLocalDeformationGradient( 9, 0 );
+    floatMatrix dddChi( 3, floatVector( 9, 0 ) );
 
-    floatVector dSurfaceAdhesionEnergyDensitydLocalMicroDeformation( 9, 0 );
+    floatMatrix dddChiNLBase( 3, floatVector( 9, 0 ) );
+
+    floatMatrix dddGradChi( 3, floatVector( 27, 0 ) );
 
-    floatVector dSurfaceAdhesionEnergyDensitydGradientMicroDeformation( 27, 0 );
-    
     floatType eps = 1e-6;
 
-    for ( unsigned int i = 0; i < asp1.F.size( ); i++ ){
+    for ( unsigned int i = 0; i < asp1.Xi.size( ); i++ ){
 
-        floatVector delta( asp1.F.size( ), 0 );
+        floatVector deltas( asp1.Xi.size( ), 0 );
 
-        delta[ i ] = eps * std::fabs( asp1.F[ i ] ) + eps;
+        deltas[ i ] = eps * std::fabs( asp1.Xi[ i ] ) + eps;
 
         aspBaseMock aspp, aspm;
 
-        aspp.F += delta;
+        aspp.Xi += deltas;
 
-        aspm.F -= delta;
+        aspm.Xi -= deltas;
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-        dSurfaceAdhesionEnergyDensitydLocalDeformationGradient[ i ] = (  ( *aspp.getSurfaceAdhesionEnergyDensity( ) ) - ( *aspm.getSurfaceAdhesionEnergyDensity( ) ) ) / ( 2 * delta[ i ] );
+        for ( unsigned int j = 0; j < 3; j++ ){
+
+            dddXi[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
+
+        }
 
     }
 
-    for ( unsigned int i = 0; i < asp2.chi.size( ); i++ ){
+    for ( unsigned int i = 0; i < asp2.D.size( ); i++ ){
 
-        floatVector delta( asp2.chi.size( ), 0 );
+        floatVector deltas( asp2.D.size( ), 0 );
 
-        delta[ i ] = eps * std::fabs( asp2.chi[ i ] ) + eps;
+        deltas[ i ] = eps * std::fabs( asp1.D[ i ] ) + eps;
 
         aspBaseMock aspp, aspm;
 
-        aspp.chi += delta;
+        aspp.D += deltas;
 
-        aspm.chi -= delta;
+        aspm.D -= deltas;
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
         asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-        dSurfaceAdhesionEnergyDensitydLocalMicroDeformation[ i ] = (  ( *aspp.getSurfaceAdhesionEnergyDensity( ) ) - ( *aspm.getSurfaceAdhesionEnergyDensity( ) ) ) / ( 2 * delta[ i ] );
-
-    }
-
-    for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
-
-        floatVector delta( gradientMicroDeformation.size( ), 0 );
-
-        delta[ i ] = eps * std::fabs( gradientMicroDeformation[ i ] ) + eps;
-
-        aspBaseMock aspp, aspm;
-
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation + delta );
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation - delta );
+            dddD[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
-        dSurfaceAdhesionEnergyDensitydGradientMicroDeformation[ i ] = (  ( *aspp.getSurfaceAdhesionEnergyDensity( ) ) - ( *aspm.getSurfaceAdhesionEnergyDensity( ) ) ) / ( 2 * delta[ i ] );
+        }
 
     }
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( dSurfaceAdhesionEnergyDensitydLocalDeformationGradient, *asp1.getdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ) ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( dSurfaceAdhesionEnergyDensitydLocalMicroDeformation, *asp2.getdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( ) ) );
-
-    BOOST_CHECK( vectorTools::fuzzyEquals( dSurfaceAdhesionEnergyDensitydGradientMicroDeformation, *asp3.getdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( ) ) );
-
-}
-
-BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceAdhesionTraction ){
+    for ( unsigned int i = 0; i < asp3.XiNL.size( ); i++ ){
 
-    class aspBaseMock : public asp::aspBase{
+        floatVector deltas( asp3.XiNL.size( ), 0 );
 
-        public:
+        deltas[ i ] = eps * std::fabs( asp3.XiNL[ i ] ) + eps;
 
-            floatVector distanceVector = { 1, 2, 3 };
+        aspBaseMock aspp, aspm;
 
-            floatVector localCurrentNormal = { 0.45584231, 0.56980288, 0.68376346 };
+        aspp.XiNL += deltas;
 
-            floatVector surfaceParameters = { 12.3, 45.6 };
+        aspm.XiNL -= deltas;
 
-            aspBaseMock( ){
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
-                asp::unit_test::aspBaseTester::set_currentDistanceVector( *this, distanceVector );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-                asp::unit_test::aspBaseTester::set_localCurrentNormal( *this, localCurrentNormal );
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-                asp::unit_test::aspBaseTester::set_surfaceParameters( *this, surfaceParameters );
+            dddXiNL[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
-            }
+        }
 
-    };
-    
-    aspBaseMock asp, aspGet;
+    }
 
-    floatVector dn = vectorTools::dot( asp.distanceVector, asp.localCurrentNormal ) * asp.localCurrentNormal;
+    for ( unsigned int i = 0; i < asp4.F.size( ); i++ ){
 
-    floatVector dt = ( asp.distanceVector - dn );
+        floatVector deltas( asp4.F.size( ), 0 );
 
-    floatVector answer = asp.surfaceParameters[ 0 ] * dn + asp.surfaceParameters[ 1 ] * dt;
+        deltas[ i ] = eps * std::fabs( asp4.F[ i ] ) + eps;
 
-    floatVector result;
+        aspBaseMock aspp, aspm;
 
-    asp.computeSurfaceAdhesionTraction( result );
+        aspp.F += deltas;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
+        aspm.F -= deltas;
 
-    asp::dataStorage< floatVector > result2;
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
-    asp::unit_test::aspBaseTester::setSurfaceAdhesionTraction( asp, result2 );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-    BOOST_CHECK( result2.first );
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result2.second, answer ) );
+            dddF[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
-    result = *aspGet.getSurfaceAdhesionTraction( );
+        }
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
+    }
 
-}
+    for ( unsigned int i = 0; i < asp5.chi.size( ); i++ ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getSurfaceAdhesionEnergyDensity_error ){
+        floatVector deltas( asp5.chi.size( ), 0 );
 
-    class aspBaseMock : public asp::aspBase{
+        deltas[ i ] = eps * std::fabs( asp5.chi[ i ] ) + eps;
 
-        private:
+        aspBaseMock aspp, aspm;
 
-            virtual void computeSurfaceAdhesionEnergyDensity( floatType &surfaceAdhesionEnergyDensity ){
+        aspp.chi += deltas;
 
-                throw std::runtime_error( "This should throw an error" );
+        aspm.chi -= deltas;
 
-            }
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
-    };
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-    aspBaseMock asp;
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-    //Setup redirect variables for stderr
-    std::stringbuf buffer;
-    cerr_redirect rd( &buffer );
+            dddChi[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
-    BOOST_REQUIRE_THROW(
-        try{
-            asp.getSurfaceAdhesionEnergyDensity( );
-        }
-        catch(std::exception &e){
-            errorTools::printNestedExceptions( e );
-            throw;
         }
-    , std::exception );
-
-    BOOST_CHECK( buffer.str( ).find( "This should throw an error" ) != std::string::npos );
-
-    BOOST_CHECK( buffer.str( ).find( "getSurfaceAdhesionEnergyDensity" ) != std::string::npos );
-
-    BOOST_CHECK( buffer.str( ).find( "setSurfaceAdhesionEnergyDensity" ) != std::string::npos );
-
-}
-
-BOOST_AUTO_TEST_CASE( test_aspBase_getSurfaceAdhesionEnergyDensity ){
-
-    class aspBaseMock : public asp::aspBase{
-
-        private:
 
-            virtual void computeSurfaceAdhesionEnergyDensity( floatType &surfaceAdhesionEnergyDensity ){
+    }
 
-                surfaceAdhesionEnergyDensity = 123;
+    for ( unsigned int i = 0; i < asp6.chiNLBase.size( ); i++ ){
 
-                return;
+        floatVector deltas( asp6.chiNLBase.size( ), 0 );
 
-            }
+        deltas[ i ] = eps * std::fabs( asp6.chiNLBase[ i ] ) + eps;
 
-    };
+        aspBaseMock aspp, aspm;
 
-    aspBaseMock asp;
+        aspp.chiNLBase += deltas;
 
-    //Setup redirect variables for stderr
-    std::stringbuf buffer;
-    cerr_redirect rd( &buffer );
+        aspm.chiNLBase -= deltas;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getSurfaceAdhesionEnergyDensity( ), 123. ) );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
-}
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalReferenceSurfacePoints ){
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-    class aspBaseMock : public asp::aspBase{
+            dddChiNLBase[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
-        public:
+        }
 
-            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    }
 
-            std::vector< unsigned int > connectivity = { 1, 2, 3 };
+    for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
 
-            floatType radius = 1.3;
+        floatVector deltas( gradientMicroDeformation.size( ), 0 );
 
-        private:
+        deltas[ i ] = eps * std::fabs( gradientMicroDeformation[ i ] ) + eps;
 
-            virtual void initializeUnitSphere( ){
+        aspBaseMock aspp, aspm;
 
-                asp::unit_test::aspBaseTester::set_unitSphere( *this, points, connectivity );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation + deltas );
 
-            }
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation - deltas );
 
-            virtual void setLocalReferenceRadius( ){
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-                asp::unit_test::aspBaseTester::set_localReferenceRadius( *this, radius );
+            dddGradChi[ j ][ i ] = ( ( *aspp.getCurrentDistanceVector( ) )[ j ] - ( *aspm.getCurrentDistanceVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
 
-            }
+        }
 
-    };
+    }
 
-    aspBaseMock asp, aspGet;
+    BOOST_CHECK( vectorTools::fuzzyEquals( dddXi, *asp1.getdCurrentDistanceVectordLocalReferenceRelativePositionVector( ) ) );
 
-    floatVector answer = asp.points * asp.radius;
+    BOOST_CHECK( vectorTools::fuzzyEquals( dddD, *asp2.getdCurrentDistanceVectordLocalReferenceDistanceVector( ) ) );
 
-    asp::dataStorage< floatVector > result;
+    BOOST_CHECK( vectorTools::fuzzyEquals( dddXiNL, *asp3.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) ) );
 
-    asp::unit_test::aspBaseTester::setLocalReferenceSurfacePoints( asp, result );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dddF, *asp4.getdCurrentDistanceVectordLocalDeformationGradient( ) ) );
 
-    BOOST_CHECK( result.first );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dddChi, *asp5.getdCurrentDistanceVectordLocalMicroDeformation( ) ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dddChiNLBase, *asp6.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalReferenceSurfacePoints( ), answer ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dddGradChi, *asp7.getdCurrentDistanceVectordGradientMicroDeformation( ) ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getNonLocalReferenceSurfacePoints ){
+BOOST_AUTO_TEST_CASE( test_aspBase_setCurrentDistanceVectorSecondGradients ){
 
     class aspBaseMock : public asp::aspBase{
 
         public:
 
-            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
-
-            std::vector< unsigned int > connectivity = { 1, 2, 3 };
-
-            floatType radius = 1.3;
+            floatVector Xi = { 1, 2, 3 };
+    
+            floatVector XiNL = { 4, 5, 6 };
+    
+            floatVector D = { .7, .8, .9 };
+    
+            floatVector F = { 10, 11, 12,
+                              13, 14, 15,
+                              16, 17, 18 };
+    
+            floatVector chi = { 19, 20, 21,
+                                22, 23, 24,
+                                25, 26, 27 };
+    
+            floatVector chiNLBase = { 28, 29, 30,
+                                      31, 32, 33,
+                                      34, 35, 36 };
 
         private:
 
-            virtual void initializeUnitSphere( ){
-
-                asp::unit_test::aspBaseTester::set_unitSphere( *this, points, connectivity );
-
+            void setLocalSurfaceReferenceRelativePositionVector( ) override {
+    
+                asp::aspBase::setLocalSurfaceReferenceRelativePositionVector( Xi );
+    
+                return;
+    
             }
-
-            virtual void setNonLocalReferenceRadius( ){
-
-                asp::unit_test::aspBaseTester::set_nonLocalReferenceRadius( *this, radius );
-
+    
+            void setNonLocalSurfaceReferenceRelativePositionVector( ) override {
+    
+                asp::aspBase::setNonLocalSurfaceReferenceRelativePositionVector( XiNL );
+    
+                return;
+    
+            }
+    
+            void setReferenceDistanceVector( ) override {
+    
+                asp::aspBase::setReferenceDistanceVector( D );
+    
+                return;
+    
+            }
+    
+            void setLocalDeformationGradient( ) override {
+    
+                asp::aspBase::setLocalDeformationGradient( F );
+    
+                return;
+    
+            }
+    
+            void setLocalMicroDeformation( ) override {
+    
+                asp::aspBase::setLocalMicroDeformation( chi );
+    
+                return;
+    
+            }
+    
+            void setNonLocalMicroDeformationBase( ) override {
+    
+                asp::aspBase::setNonLocalMicroDeformationBase( chiNLBase );
+    
+                return;
+    
             }
 
     };
 
-    aspBaseMock asp, aspGet;
+    aspBaseMock asp1, asp2, asp3, asp4, asp5, asp6, asp7;
 
-    floatVector answer = asp.points * asp.radius;
+    floatVector gradientMicroDeformation = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9,
+                                             1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8,
+                                             1.9, 2.0, 2.1, 2.2, 2.3, 2.4, 2.5, 2.6, 2.7 };
 
-    asp::dataStorage< floatVector > result;
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp1, gradientMicroDeformation );
 
-    asp::unit_test::aspBaseTester::setNonLocalReferenceSurfacePoints( asp, result );
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp2, gradientMicroDeformation );
 
-    BOOST_CHECK( result.first );
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp3, gradientMicroDeformation );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp4, gradientMicroDeformation );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalReferenceSurfacePoints( ), answer ) );
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp5, gradientMicroDeformation );
 
-}
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp6, gradientMicroDeformation );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalCurrentSurfacePoints ){
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp7, gradientMicroDeformation );
 
-    class aspBaseMock : public asp::aspBase{
+    floatMatrix d2ddXidXi_answer( 3, floatVector( 3 * 3, 0 ) );
+    floatMatrix d2ddXidXi = d2ddXidXi_answer;
 
-        public:
+    floatMatrix d2ddDdXi_answer( 3, floatVector( 3 * 3, 0 ) );
+    floatMatrix d2ddDdXi = d2ddDdXi_answer;
 
-            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    floatMatrix d2ddXiNLdXi( 3, floatVector( 3 * 3, 0 ) );
 
-            floatVector microDeformation = { .1, .2, .3, .4, .5, .6, .7, .8, .9 };
+    floatMatrix d2ddFdXi( 3, floatVector( 9 * 3, 0 ) );
 
-        private:
+    floatMatrix d2ddChidXi( 3, floatVector( 9 * 3, 0 ) );
 
-            virtual void setLocalReferenceSurfacePoints( ){
+    floatMatrix d2ddChiNLBasedXi_answer( 3, floatVector( 9 * 3, 0 ) );
+    floatMatrix d2ddChiNLBasedXi = d2ddChiNLBasedXi_answer;
 
-                asp::unit_test::aspBaseTester::set_localReferenceSurfacePoints( *this, points );
+    floatMatrix d2ddGradChidXi( 3, floatVector( 27 * 3, 0 ) );
 
-            }
+    floatMatrix d2ddDdD_answer( 3, floatVector( 3 * 3, 0 ) );
+    floatMatrix d2ddDdD = d2ddDdD_answer;
 
-            virtual void setLocalMicroDeformation( ){
+    floatMatrix d2ddXiNLdD( 3, floatVector( 3 * 3, 0 ) );
 
-                asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, microDeformation );
+    floatMatrix d2ddFdD( 3, floatVector( 9 * 3, 0 ) );
 
-            }
+    floatMatrix d2ddChidD_answer( 3, floatVector( 9 * 3, 0 ) );
+    floatMatrix d2ddChidD = d2ddChidD_answer;
 
-    };
+    floatMatrix d2ddChiNLBasedD_answer( 3, floatVector( 9 * 3, 0 ) );
+    floatMatrix d2ddChiNLBasedD = d2ddChiNLBasedD_answer;
 
-    aspBaseMock asp, aspGet;
+    floatMatrix d2ddGradChidD( 3, floatVector( 27 * 3, 0 ) );
 
-    floatVector answer = { 1.4,  3.2,  5. ,
-                           3.2,  7.7, 12.2,
-                           5. , 12.2, 19.4,
-                           6.8, 16.7, 26.6};
+    floatMatrix d2ddXiNLdXiNL( 3, floatVector( 3 * 3, 0 ) );
 
-    asp::dataStorage< floatVector > result;
+    floatMatrix d2ddFdXiNL( 3, floatVector( 9 * 3, 0 ) );
 
-    asp::unit_test::aspBaseTester::setLocalCurrentSurfacePoints( asp, result );
+    floatMatrix d2ddChidXiNL_answer( 3, floatVector( 9 * 3, 0 ) );
+    floatMatrix d2ddChidXiNL = d2ddChidXiNL_answer;
 
-    BOOST_CHECK( result.first );
+    floatMatrix d2ddChiNLBasedXiNL( 3, floatVector( 9 * 3, 0 ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    floatMatrix d2ddGradChidXiNL( 3, floatVector( 27 * 3, 0 ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalCurrentSurfacePoints( ), answer ) );
+    floatMatrix d2ddFdF_answer( 3, floatVector( 9 * 9, 0 ) );
+    floatMatrix d2ddFdF( 3, floatVector( 9 * 9, 0 ) );
 
-}
+    floatMatrix d2ddChidF_answer( 3, floatVector( 9 * 9, 0 ) );
+    floatMatrix d2ddChidF( 3, floatVector( 9 * 9, 0 ) );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getNonLocalCurrentSurfacePoints ){
+    floatMatrix d2ddChiNLBasedF_answer( 3, floatVector( 9 * 9, 0 ) );
+    floatMatrix d2ddChiNLBasedF( 3, floatVector( 9 * 9, 0 ) );
 
-    class aspBaseMock : public asp::aspBase{
+    floatMatrix d2ddGradChidF_answer( 3, floatVector( 27 * 9, 0 ) );
+    floatMatrix d2ddGradChidF( 3, floatVector( 27 * 9, 0 ) );
 
-        public:
+    floatMatrix d2ddChidChi_answer( 3, floatVector( 9 * 9, 0 ) );
+    floatMatrix d2ddChidChi( 3, floatVector( 9 * 9, 0 ) );
 
-            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    floatMatrix d2ddChiNLBasedChi_answer( 3, floatVector( 9 * 9, 0 ) );
+    floatMatrix d2ddChiNLBasedChi( 3, floatVector( 9 * 9, 0 ) );
 
-            floatVector microDeformation = { .1, .2, .3, .4, .5, .6, .7, .8, .9 };
+    floatMatrix d2ddGradChidChi_answer( 3, floatVector( 27 * 9, 0 ) );
+    floatMatrix d2ddGradChidChi( 3, floatVector( 27 * 9, 0 ) );
 
-        private:
+    floatMatrix d2ddChiNLBasedChiNLBase_answer( 3, floatVector( 9 * 9, 0 ) );
+    floatMatrix d2ddChiNLBasedChiNLBase( 3, floatVector( 9 * 9, 0 ) );
 
-            virtual void setNonLocalReferenceSurfacePoints( ){
+    floatMatrix d2ddGradChidChiNLBase_answer( 3, floatVector( 27 * 9, 0 ) );
+    floatMatrix d2ddGradChidChiNLBase( 3, floatVector( 27 * 9, 0 ) );
 
-                asp::unit_test::aspBaseTester::set_nonLocalReferenceSurfacePoints( *this, points );
+    floatMatrix d2ddGradChidGradChi_answer( 3, floatVector( 27 * 27, 0 ) );
+    floatMatrix d2ddGradChidGradChi( 3, floatVector( 27 * 27, 0 ) );
 
-            }
+    floatType eps = 1e-6;
 
-            virtual void setNonLocalMicroDeformation( ){
+    for ( unsigned int i = 0; i < asp1.Xi.size( ); i++ ){
 
-                asp::unit_test::aspBaseTester::set_nonLocalMicroDeformation( *this, microDeformation );
+        floatVector deltas( asp1.Xi.size( ), 0 );
 
-            }
+        deltas[ i ] = eps * std::fabs( asp1.Xi[ i ] ) + eps;
 
-    };
+        aspBaseMock aspp, aspm;
 
-    aspBaseMock asp, aspGet;
+        aspp.Xi += deltas;
 
-    floatVector answer = { 1.4,  3.2,  5. ,
-                           3.2,  7.7, 12.2,
-                           5. , 12.2, 19.4,
-                           6.8, 16.7, 26.6};
+        aspm.Xi -= deltas;
 
-    asp::dataStorage< floatVector > result;
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
-    asp::unit_test::aspBaseTester::setNonLocalCurrentSurfacePoints( asp, result );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-    BOOST_CHECK( result.first );
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+            for ( unsigned int k = 0; k < 3; k++ ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalCurrentSurfacePoints( ), answer ) );
+                d2ddXidXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalReferenceRelativePositionVector( ) )[ j ][ k ]
+                                              - ( *aspm.getdCurrentDistanceVectordLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-}
+            }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleCurrentBoundingBox ){
+            for ( unsigned int k = 0; k < 3; k++ ){
 
-    class aspBaseMock : public asp::aspBase{
+                d2ddDdXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalReferenceDistanceVector( ) )[ j ][ k ]
+                                             - ( *aspm.getdCurrentDistanceVectordLocalReferenceDistanceVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-        public:
+            }
 
-            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+            for ( unsigned int k = 0; k < 3; k++ ){
 
-        private:
+                d2ddXiNLdXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ]
+                                                - ( *aspm.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-            virtual void setLocalCurrentSurfacePoints( ){
+            }
 
-                asp::unit_test::aspBaseTester::set_localCurrentSurfacePoints( *this, points );
+            for ( unsigned int k = 0; k < 9; k++ ){
+
+                d2ddFdXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ]
+                                             - ( *aspm.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
             }
 
-    };
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-    aspBaseMock asp, aspGet;
+                d2ddChidXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ]
+                                               - ( *aspm.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    floatMatrix answer = { { 1, 10 },
-                           { 2, 11 },
-                           { 3, 12 } };
+            }
 
-    asp::dataStorage< floatMatrix > result;
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-    asp::unit_test::aspBaseTester::setLocalParticleCurrentBoundingBox( asp, result );
+                d2ddChiNLBasedXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
+                                                     - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    BOOST_CHECK( result.first );
+            }
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+            for ( unsigned int k = 0; k < 27; k++ ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleCurrentBoundingBox( ), answer ) );
+                d2ddGradChidXi[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
+                                                   - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-}
+            }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getNonLocalParticleCurrentBoundingBox ){
+        }
 
-    class aspBaseMock : public asp::aspBase{
+    }
 
-        public:
+    for ( unsigned int i = 0; i < asp2.D.size( ); i++ ){
 
-            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+        floatVector deltas( asp2.D.size( ), 0 );
 
-        private:
+        deltas[ i ] = eps * std::fabs( asp1.D[ i ] ) + eps;
 
-            virtual void setNonLocalCurrentSurfacePoints( ){
+        aspBaseMock aspp, aspm;
 
-                asp::unit_test::aspBaseTester::set_nonLocalCurrentSurfacePoints( *this, points );
-
-            }
+        aspp.D += deltas;
 
-    };
+        aspm.D -= deltas;
 
-    aspBaseMock asp, aspGet;
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
-    floatMatrix answer = { { 1, 10 },
-                           { 2, 11 },
-                           { 3, 12 } };
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-    asp::dataStorage< floatMatrix > result;
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-    asp::unit_test::aspBaseTester::setNonLocalParticleCurrentBoundingBox( asp, result );
+            for ( unsigned int k = 0; k < 3; k++ ){
 
-    BOOST_CHECK( result.first );
+                d2ddDdD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalReferenceDistanceVector( ) )[ j ][ k ]
+                                            - ( *aspm.getdCurrentDistanceVectordLocalReferenceDistanceVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+            }
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalParticleCurrentBoundingBox( ), answer ) );
+            for ( unsigned int k = 0; k < 3; k++ ){
 
-}
+                d2ddXiNLdD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ]
+                                               - ( *aspm.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_formBoundingBox ){
+            }
 
-    asp::aspBase asp;
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-    floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+                d2ddFdD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ]
+                                            - ( *aspm.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    floatMatrix answer = { { 1, 7 },
-                           { 2, 8 },
-                           { 3, 9 } };
+            }
 
-    floatMatrix result;
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-    asp::unit_test::aspBaseTester::formBoundingBox( asp, points, result );
+                d2ddChidD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ]
+                                              - ( *aspm.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
+            }
 
-}
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_pointInBoundingBox ){
+                d2ddChiNLBasedD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
+                                                    - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    asp::aspBase asp;
+            }
 
-    floatVector point = { 1, 2 };
+            for ( unsigned int k = 0; k < 27; k++ ){
 
-    floatMatrix boundingBox = { { 0, 2 }, { 1, 3 } };
+                d2ddGradChidD[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
+                                                  - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::pointInBoundingBox( asp, point, boundingBox ) );
+            }
 
-    point = { 1, -2 };
+        }
 
-    BOOST_CHECK( !asp::unit_test::aspBaseTester::pointInBoundingBox( asp, point, boundingBox ) );
+    }
 
-}
+    for ( unsigned int i = 0; i < asp3.XiNL.size( ); i++ ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_idBoundingBoxContainedPoints ){
+        floatVector deltas( asp3.XiNL.size( ), 0 );
 
-    asp::aspBase asp;
+        deltas[ i ] = eps * std::fabs( asp3.XiNL[ i ] ) + eps;
 
-    floatVector points = { 1, 2, 3, 1, -2, 4, 0.5, 1.1, 4.9 };
+        aspBaseMock aspp, aspm;
 
-    floatMatrix boundingBox = { { 0, 2 }, { 1, 3 }, { 2, 5 } };
+        aspp.XiNL += deltas;
 
-    std::vector< unsigned int > answer = { 0, 2 };
+        aspm.XiNL -= deltas;
 
-    std::vector< unsigned int > result;
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
-    asp::unit_test::aspBaseTester::idBoundingBoxContainedPoints( asp, points, boundingBox, result );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-}
+            for ( unsigned int k = 0; k < 3; k++ ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getMicroDeformation ){
+                d2ddXiNLdXiNL[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ]
+                                                  - ( *aspm.getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    asp::aspBase asp;
+            }
 
-    floatVector answer = { 1, 2, 3, 4, 5, 6 };
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-    asp::unit_test::aspBaseTester::set_microDeformation( asp, answer );
+                d2ddFdXiNL[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ]
+                                               - ( *aspm.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getMicroDeformation( ), answer ) );
+            }
 
-}
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getGradientMicroDeformation ){
+                d2ddChidXiNL[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ]
+                                                 - ( *aspm.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    asp::aspBase asp;
+            }
 
-    floatVector answer = { 1, 2, 3, 4, 5, 6 };
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp, answer );
+                d2ddChiNLBasedXiNL[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
+                                                       - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getGradientMicroDeformation( ), answer ) );
+            }
 
-}
+            for ( unsigned int k = 0; k < 27; k++ ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setLocalGradientMicroDeformation ){
+                d2ddGradChidXiNL[ j ][ 3 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
+                                                     - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    asp::aspBase asp, aspGet;
+            }
 
-    floatVector answer = { 1, 2, 3, 4, 5, 6 };
+        }
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp, answer );
+    }
 
-    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspGet, answer );
+    for ( unsigned int i = 0; i < asp4.F.size( ); i++ ){
 
-    asp::dataStorage< floatVector > result;
+        floatVector deltas( asp4.F.size( ), 0 );
 
-    asp::unit_test::aspBaseTester::setLocalGradientMicroDeformation( asp, result );
+        deltas[ i ] = eps * std::fabs( asp4.F[ i ] ) + eps;
 
-    BOOST_CHECK( result.first );
+        aspBaseMock aspp, aspm;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+        aspp.F += deltas;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalGradientMicroDeformation( ), answer ) );
+        aspm.F -= deltas;
 
-}
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalMicroDeformationBase ){
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-    asp::aspBase asp, aspGet;
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-    floatVector answer = { 1, 2, 3, 4, 5, 6 };
+                d2ddFdF[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ]
+                                            - ( *aspm.getdCurrentDistanceVectordLocalDeformationGradient( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    asp::unit_test::aspBaseTester::set_microDeformation( asp, answer );
+            }
 
-    asp::unit_test::aspBaseTester::set_microDeformation( aspGet, answer );
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-    asp::dataStorage< floatVector > result;
+                d2ddChidF[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ]
+                                              - ( *aspm.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    asp::unit_test::aspBaseTester::setNonLocalMicroDeformationBase( asp, result );
+            }
 
-    BOOST_CHECK( result.first );
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+                d2ddChiNLBasedF[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
+                                                    - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalMicroDeformationBase( ), answer ) );
+            }
 
-}
+            for ( unsigned int k = 0; k < 27; k++ ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setSurfaceOverlapParameters ){
+                d2ddGradChidF[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
+                                                  - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    class aspBaseMock : public asp::aspBase{
+            }
 
-        public:
+        }
+    }
 
-            floatVector overlapParameters = { 1, 2, 3};
+    for ( unsigned int i = 0; i < asp5.chi.size( ); i++ ){
 
-        private:
+        floatVector deltas( asp5.chi.size( ), 0 );
 
-            virtual void setSurfaceOverlapParameters( ){
+        deltas[ i ] = eps * std::fabs( asp5.chi[ i ] ) + eps;
 
-                asp::unit_test::aspBaseTester::set_surfaceOverlapParameters( *this, overlapParameters );
+        aspBaseMock aspp, aspm;
 
-            }
+        aspp.chi += deltas;
 
-    };
+        aspm.chi -= deltas;
 
-    aspBaseMock asp, aspGet;
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
-    asp::dataStorage< floatVector > result;
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-    asp::unit_test::aspBaseTester::setSurfaceOverlapParameters( asp, result );
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-    BOOST_CHECK( result.first );
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, asp.overlapParameters ) );
+                d2ddChidChi[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ]
+                                                - ( *aspm.getdCurrentDistanceVectordLocalMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getSurfaceOverlapParameters( ), asp.overlapParameters ) );
+            }
 
-}
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setParticlePairOverlap ){
-    /*!
-     * Test setting the particle pair overlap values
-     */
+                d2ddChiNLBasedChi[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
+                                                      - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-    class aspBaseMock : public asp::aspBase{
+            }
 
-        public:
+            for ( unsigned int k = 0; k < 27; k++ ){
 
-            floatMatrix nonLocalParticleCurrentBoundingBox = { { 0, 2 }, { 0, 2 }, { 0, 2 } };
+                d2ddGradChidChi[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
+                                                    - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
-            floatVector localReferenceSurfacePoints = { 0, 0, 1, 1, 0, 0, 1.1, 0, 0 };
+            }
 
-            floatVector localCurrentSurfacePoints = { 0, 0, 1, 1.1, 0, 0, 1.1 * 1.1, 0, 0 };
+        }
 
-            floatVector localDeformationGradient = { 1.1, 0, 0, 0, 1, 0, 0, 0, 1 };
+    }
 
-            floatType nonLocalReferenceRadius = 2.3;
+    for ( unsigned int i = 0; i < asp6.chiNLBase.size( ); i++ ){
 
-            floatVector localMicroDeformation = { 1.5, 0, 0, 0, 1, 0, 0, 0, 1 };
+        floatVector deltas( asp6.chiNLBase.size( ), 0 );
 
-            floatVector localReferenceParticleSpacing = { 2. / 1.1, 0, 0 };
+        deltas[ i ] = eps * std::fabs( asp6.chiNLBase[ i ] ) + eps;
 
-            floatVector localGradientMicroDeformation = { 0, 0, 0, 0, 0, 0, 0, 0, 0,
-                                                          0, 0, 0, 0, 0, 0, 0, 0, 0,
-                                                          0, 0, 0, 0, 0, 0, 0, 0, 0 };
+        aspBaseMock aspp, aspm;
 
-            floatVector nonLocalMicroDeformationBase = { 1 / 2.3, 0, 0, 0, 1, 0, 0, 0, 1 };
+        aspp.chiNLBase += deltas;
 
-        private:
+        aspm.chiNLBase -= deltas;
 
-            virtual void setNonLocalParticleCurrentBoundingBox( ){
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
-                asp::unit_test::aspBaseTester::set_nonLocalParticleCurrentBoundingBox( *this, nonLocalParticleCurrentBoundingBox );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-            }
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-            virtual void setLocalCurrentSurfacePoints( ){
+            for ( unsigned int k = 0; k < 9; k++ ){
 
-                asp::unit_test::aspBaseTester::set_localCurrentSurfacePoints( *this, localCurrentSurfacePoints );
+                d2ddChiNLBasedChiNLBase[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ]
+                                                            - ( *aspm.getdCurrentDistanceVectordNonLocalMicroDeformationBase( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
             }
 
-            virtual void setLocalReferenceSurfacePoints( ){
+            for ( unsigned int k = 0; k < 27; k++ ){
 
-                asp::unit_test::aspBaseTester::set_localReferenceSurfacePoints( *this, localReferenceSurfacePoints );
+                d2ddGradChidChiNLBase[ j ][ 9 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
+                                                          - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
             }
 
-            virtual void setLocalDeformationGradient( ){
+        }
 
-                asp::unit_test::aspBaseTester::set_localDeformationGradient( *this, localDeformationGradient );
+    }
 
-            }
+    for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
 
-            virtual void setNonLocalReferenceRadius( ){
+        floatVector deltas( gradientMicroDeformation.size( ), 0 );
 
-                asp::unit_test::aspBaseTester::set_nonLocalReferenceRadius( *this, nonLocalReferenceRadius );
+        deltas[ i ] = eps * std::fabs( gradientMicroDeformation[ i ] ) + eps;
 
-            }
+        aspBaseMock aspp, aspm;
 
-            virtual void setLocalMicroDeformation( ){
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation + deltas );
 
-                asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, localMicroDeformation );
-
-            }
-
-            virtual void setLocalReferenceParticleSpacingVector( ){
-
-                asp::unit_test::aspBaseTester::set_localReferenceParticleSpacing( *this, localReferenceParticleSpacing );
-
-            }
-
-            virtual void setLocalGradientMicroDeformation( ){
-
-                asp::unit_test::aspBaseTester::set_localGradientMicroDeformation( *this, localGradientMicroDeformation );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation - deltas );
 
-            }
+        for ( unsigned int j = 0; j < 3; j++ ){
 
-            virtual void setNonLocalMicroDeformationBase( ){
+            for ( unsigned int k = 0; k < 27; k++ ){
 
-                asp::unit_test::aspBaseTester::set_nonLocalMicroDeformationBase( *this, nonLocalMicroDeformationBase );
+                d2ddGradChidGradChi[ j ][ 27 * k + i ] = ( ( *aspp.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ]
+                                                         - ( *aspm.getdCurrentDistanceVectordGradientMicroDeformation( ) )[ j ][ k ] ) / ( 2 * deltas[ i ] );
 
             }
 
-    };
-
-    aspBaseMock asp, aspGet;
-
-    std::unordered_map< unsigned int, floatVector > answer = { { 0, { 0, 0, 0 } }, { 1, { -0.5, 0, 0 } }, { 2, { -0.65, 0, 0 } } };
-
-    asp::dataStorage< std::unordered_map< unsigned int, floatVector > > result;
-
-    asp::unit_test::aspBaseTester::setParticlePairOverlap( asp, result );
-
-    BOOST_CHECK( result.first );
-
-    const std::unordered_map< unsigned int, floatVector > *result2 = aspGet.getParticlePairOverlap( );
-
-    for ( auto p = answer.begin( ); p != answer.end( ); p++ ){
-
-        auto search = result.second.find( p->first );
-
-        BOOST_CHECK( search != result.second.end( ) );
-
-        if ( search != result.second.end( ) ){
-
-            BOOST_CHECK( vectorTools::fuzzyEquals( p->second, search->second ) );
-
-        }
-
-        auto search2 = result2->find( p->first );
-
-        BOOST_CHECK( search2 != result2->end( ) );
-
-        if ( search2 != result2->end( ) ){
-
-            BOOST_CHECK( vectorTools::fuzzyEquals( p->second, search2->second ) );
-
         }
 
     }
 
-}
-
-BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceOverlapEnergyDensity ){
-
-    class aspBaseMock : public asp::aspBase{
-
-        public:
-   
-            std::unordered_map< unsigned int, floatVector > particlePairOverlap = { { 0, { -0.5, 0, 0 } }, { 4, { 2, -1, 4 } } };
-
-            floatVector surfaceOverlapParameters = { 2.3 };
-
-            floatMatrix currentNormals = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 10, 11, 12 }, { 13, 14, 15 } };
-
-        private:
-
-            virtual void setParticlePairOverlap( ){
-
-                asp::unit_test::aspBaseTester::set_particlePairOverlap( *this, particlePairOverlap );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddXidXi, d2ddXidXi_answer ) );
 
-            }
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddDdXi, d2ddDdXi_answer ) );
 
-            virtual void setSurfaceOverlapParameters( ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddXiNLdXi, *asp1.getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceRelativePositionVector( ) ) );
 
-                asp::unit_test::aspBaseTester::set_surfaceOverlapParameters( *this, surfaceOverlapParameters );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddFdXi, *asp1.getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceRelativePositionVector( ) ) );
 
-            }
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChidXi, *asp1.getd2CurrentDistanceVectordLocalMicroDeformationdLocalReferenceRelativePositionVector( ) ) );
 
-            virtual void getLocalCurrentNormal( const unsigned int &index, floatVector &normal ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedXi, d2ddChiNLBasedXi_answer ) );
 
-                normal = currentNormals[ index ];
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidXi, *asp1.getd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceRelativePositionVector( ) ) );
 
-            }
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddDdD, d2ddDdD_answer ) );
 
-    };
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddXiNLdD, *asp1.getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordLocalReferenceDistanceVector( ) ) );
 
-    aspBaseMock asp, aspGet;
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddFdD, *asp1.getd2CurrentDistanceVectordLocalDeformationGradientdLocalReferenceDistanceVector( ) ) );
 
-    std::unordered_map< unsigned int, floatType > result;
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChidD, d2ddChidD_answer ) );
 
-    asp::dataStorage< std::unordered_map< unsigned int, floatType > > resultSet;
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedD, d2ddChiNLBasedD_answer ) );
 
-    BOOST_CHECK_NO_THROW( asp.computeSurfaceOverlapEnergyDensity( result ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidD, *asp1.getd2CurrentDistanceVectordGradientMicroDeformationdLocalReferenceDistanceVector( ) ) );
 
-    asp::unit_test::aspBaseTester::setSurfaceOverlapEnergyDensity( asp, resultSet );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddXiNLdXiNL, *asp1.getd2CurrentDistanceVectordNonLocalReferenceRelativePositionVectordNonLocalReferenceRelativePositionVector( ) ) );
 
-    BOOST_CHECK( resultSet.first );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddFdXiNL, *asp1.getd2CurrentDistanceVectordLocalDeformationGradientdNonLocalReferenceRelativePositionVector( ) ) );
 
-    const std::unordered_map< unsigned int, floatType > *resultGet;
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChidXiNL, d2ddChidXiNL_answer ) );
 
-    resultGet = aspGet.getSurfaceOverlapEnergyDensity( );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedXiNL, *asp1.getd2CurrentDistanceVectordNonLocalMicroDeformationBasedNonLocalReferenceRelativePositionVector( ) ) );
 
-    for ( auto p = asp.particlePairOverlap.begin( ); p != asp.particlePairOverlap.end( ); p++ ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidXiNL, *asp1.getd2CurrentDistanceVectordGradientMicroDeformationdNonLocalReferenceRelativePositionVector( ) ) );
 
-        auto overlapEnergy = result.find( p->first );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddFdF, d2ddFdF_answer ) );
 
-        BOOST_CHECK( overlapEnergy != result.end( ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChidF, d2ddChidF_answer ) );
 
-        BOOST_CHECK( vectorTools::fuzzyEquals( overlapEnergy->second, 0.5 * asp.surfaceOverlapParameters[ 0 ] * vectorTools::dot( p->second, p->second ) * std::fabs( vectorTools::dot( asp.currentNormals[ p->first ], p->second ) ) ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedF, d2ddChiNLBasedF_answer ) );
 
-        auto overlapEnergySet = resultSet.second.find( p->first );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidF, d2ddGradChidF_answer ) );
 
-        BOOST_CHECK( overlapEnergySet != resultSet.second.end( ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChidChi, d2ddChidChi_answer ) );
 
-        BOOST_CHECK( vectorTools::fuzzyEquals( overlapEnergySet->second, 0.5 * asp.surfaceOverlapParameters[ 0 ] * vectorTools::dot( p->second, p->second ) * std::fabs( vectorTools::dot( asp.currentNormals[ p->first ], p->second ) ) ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedChi, d2ddChiNLBasedChi_answer ) );
 
-        auto overlapEnergyGet = resultGet->find( p->first );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidChi, d2ddGradChidChi_answer ) );
 
-        BOOST_CHECK( overlapEnergyGet != resultGet->end( ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddChiNLBasedChiNLBase, d2ddChiNLBasedChiNLBase_answer ) );
 
-        BOOST_CHECK( vectorTools::fuzzyEquals( overlapEnergyGet->second, 0.5 * asp.surfaceOverlapParameters[ 0 ] * vectorTools::dot( p->second, p->second ) * std::fabs( vectorTools::dot( asp.currentNormals[ p->first ], p->second ) ) ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidChiNLBase, d2ddGradChidChiNLBase_answer ) );
 
-    } 
+    BOOST_CHECK( vectorTools::fuzzyEquals( d2ddGradChidGradChi, d2ddGradChidGradChi_answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceOverlapThickness ){
+BOOST_AUTO_TEST_CASE( test_aspBase_setSurfaceParameters ){
 
     class aspBaseMock : public asp::aspBase{
 
         public:
-   
-            std::unordered_map< unsigned int, floatVector > particlePairOverlap = { { 0, { -0.5, 0, 0 } }, { 4, { 2, -1, 4 } } };
 
-            floatMatrix currentNormals = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 10, 11, 12 }, { 13, 14, 15 } };
+            floatVector surfaceParametersAnswer = { 1, 2, 3 };
 
         private:
 
-            virtual void setParticlePairOverlap( ){
-
-                asp::unit_test::aspBaseTester::set_particlePairOverlap( *this, particlePairOverlap );
-
-            }
-
-            virtual void getLocalCurrentNormal( const unsigned int &index, floatVector &normal ){
+            virtual void setSurfaceParameters( ){
 
-                normal = currentNormals[ index ];
+                asp::unit_test::aspBaseTester::set_surfaceParameters( *this, surfaceParametersAnswer );
 
             }
-
     };
 
-    aspBaseMock asp, aspGet;
-
-    asp::dataStorage< std::unordered_map< unsigned int, floatType > > resultSet;
-
-    asp::unit_test::aspBaseTester::setSurfaceOverlapThickness( asp, resultSet );
-
-    BOOST_CHECK( resultSet.first );
-
-    const std::unordered_map< unsigned int, floatType > *resultGet;
-
-    resultGet = aspGet.getSurfaceOverlapThickness( );
-
-    for ( auto p = asp.particlePairOverlap.begin( ); p != asp.particlePairOverlap.end( ); p++ ){
+    aspBaseMock asp;
 
-        auto overlapThicknessSet = resultSet.second.find( p->first );
+    floatVector answer = { 1, 2, 3 };
 
-        BOOST_CHECK( overlapThicknessSet != resultSet.second.end( ) );
+    asp::dataStorage< floatVector > result;
 
-        BOOST_CHECK( vectorTools::fuzzyEquals( overlapThicknessSet->second, std::fabs( vectorTools::dot( asp.currentNormals[ p->first ], p->second ) ) ) );
+    asp::unit_test::aspBaseTester::setSurfaceParameters( asp, result );
 
-        auto overlapThicknessGet = resultGet->find( p->first );
+    BOOST_CHECK( result.first );
 
-        BOOST_CHECK( overlapThicknessGet != resultGet->end( ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
 
-        BOOST_CHECK( vectorTools::fuzzyEquals( overlapThicknessGet->second, std::fabs( vectorTools::dot( asp.currentNormals[ p->first ], p->second ) ) ) );
+    aspBaseMock aspGet;
 
-    } 
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getSurfaceParameters( ), answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceOverlapTraction ){
+BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceAdhesionEnergyDensity ){
 
     class aspBaseMock : public asp::aspBase{
 
         public:
-   
-            std::unordered_map< unsigned int, floatVector > particlePairOverlap = { { 0, { -0.5, 0, 0 } }, { 4, { 2, -1, 4 } } };
 
-            floatVector surfaceOverlapParameters = { 2.3 };
+            floatVector distanceVector = { 1, 2, 3 };
 
-        private:
+            floatVector localCurrentNormal = { 0.45584231, 0.56980288, 0.68376346 };
 
-            virtual void setParticlePairOverlap( ){
+            floatVector surfaceParameters = { 12.3, 45.6 };
 
-                asp::unit_test::aspBaseTester::set_particlePairOverlap( *this, particlePairOverlap );
+            aspBaseMock( ){
 
-            }
+                asp::unit_test::aspBaseTester::set_currentDistanceVector( *this, distanceVector );
 
-            virtual void setSurfaceOverlapParameters( ){
+                asp::unit_test::aspBaseTester::set_localCurrentNormal( *this, localCurrentNormal );
 
-                asp::unit_test::aspBaseTester::set_surfaceOverlapParameters( *this, surfaceOverlapParameters );
+                asp::unit_test::aspBaseTester::set_surfaceParameters( *this, surfaceParameters );
 
             }
 
     };
-
+    
     aspBaseMock asp, aspGet;
 
-    std::unordered_map< unsigned int, floatVector > result;
-
-    BOOST_CHECK_NO_THROW( asp.computeSurfaceOverlapTraction( result ) );
-
-    const std::unordered_map< unsigned int, floatVector > *resultGet;
+    floatType answer = 178.2828858284305;
 
-    resultGet = aspGet.getSurfaceOverlapTraction( );
+    floatType result;
 
-    for ( auto p = asp.particlePairOverlap.begin( ); p != asp.particlePairOverlap.end( ); p++ ){
+    asp.computeSurfaceAdhesionEnergyDensity( result );
 
-        auto overlapTraction = result.find( p->first );
+    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
 
-        BOOST_CHECK( overlapTraction != result.end( ) );
+    asp::dataStorage< floatType > result2;
 
-        BOOST_CHECK( vectorTools::fuzzyEquals( overlapTraction->second, asp.surfaceOverlapParameters[ 0 ] * p->second ) );
+    asp::unit_test::aspBaseTester::setSurfaceAdhesionEnergyDensity( asp, result2 );
 
-        auto overlapTractionGet = resultGet->find( p->first );
+    BOOST_CHECK( result2.first );
 
-        BOOST_CHECK( overlapTractionGet != result.end( ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( result2.second, answer ) );
 
-        BOOST_CHECK( vectorTools::fuzzyEquals( overlapTraction->second, asp.surfaceOverlapParameters[ 0 ] * p->second ) );
+    result = *aspGet.getSurfaceAdhesionEnergyDensity( );
 
-    } 
+    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_resetInteractionPairData ){
+BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceAdhesionEnergyDensity2 ){
 
     class aspBaseMock : public asp::aspBase{
 
         public:
 
-            asp::dataStorage< int > interactionData1;
-        
-            asp::dataStorage< floatVector > interactionData2;
-    
-            asp::dataStorage< floatType > surfaceData1;
+            floatVector Xi = { .1, .2, .3 };
     
-            asp::dataStorage< floatMatrix > surfaceData2;
+            floatVector XiNL = { .4, .5, .6 };
     
-            asp::dataStorage< std::unordered_map< int, floatType > > particleData1;
-
-            aspBaseMock( ){
-
-                interactionData1 = asp::dataStorage< int >( true, 1 );
-        
-                interactionData2 = asp::dataStorage< floatVector >( true, { 1, 2, 3 } );
+            floatVector D = { .7, .8, .9 };
     
-                surfaceData1 = asp::dataStorage< floatType >( true, 2. );
+            floatVector F = { 1.1, 0.2, 0.3,
+                              0.4, 1.5, 0.6,
+                              0.7, 0.8, 1.9 };
     
-                surfaceData2 = asp::dataStorage< floatMatrix >( true, { { 1, 2, 3 }, { 4, 5, 6 } } );
+            floatVector chi = { 1.19, 0.20, 0.21,
+                                0.22, 1.23, 0.24,
+                                0.25, 0.26, 0.27 };
     
-                particleData1 = asp::dataStorage< std::unordered_map< int, floatType > >( true, { { 1, 1 }, { 2, 3 } } );
-
-                addInteractionPairData( &interactionData1 );
-
-                addInteractionPairData( &interactionData2 );
+            floatVector chiNLBase = { 1.28, 0.29, 0.30,
+                                      0.31, 1.32, 0.33,
+                                      0.34, 0.35, 1.36 };
 
-                addSurfacePointData( &surfaceData1 );
+            floatVector localReferenceNormal = { 0.4, .8, -0.2 };
 
-                addSurfacePointData( &surfaceData2 );
+            floatVector surfaceParameters = { 12.3, 45.6 };
 
-                addLocalParticleData( &particleData1 );
+        private:
 
+            void setLocalSurfaceReferenceRelativePositionVector( ) override {
+    
+                asp::aspBase::setLocalSurfaceReferenceRelativePositionVector( Xi );
+    
+                return;
+    
+            }
+    
+            void setNonLocalSurfaceReferenceRelativePositionVector( ) override {
+    
+                asp::aspBase::setNonLocalSurfaceReferenceRelativePositionVector( XiNL );
+    
+                return;
+    
+            }
+    
+            void setReferenceDistanceVector( ) override {
+    
+                asp::aspBase::setReferenceDistanceVector( D );
+    
+                return;
+    
+            }
+    
+            void setLocalDeformationGradient( ) override {
+    
+                asp::aspBase::setLocalDeformationGradient( F );
+    
+                return;
+    
+            }
+    
+            void setLocalMicroDeformation( ) override {
+    
+                asp::aspBase::setLocalMicroDeformation( chi );
+    
+                return;
+    
+            }
+    
+            void setNonLocalMicroDeformationBase( ) override {
+    
+                asp::aspBase::setNonLocalMicroDeformationBase( chiNLBase );
+    
+                return;
+    
             }
 
-    };
-
-    aspBaseMock asp;
-
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 2 );
-
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 2 );
-
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 1 );
+            void setSurfaceParameters( ) override {
 
-    asp::unit_test::aspBaseTester::resetInteractionPairData( asp );
+                asp::aspBase::setSurfaceParameters( surfaceParameters );
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 0 );
+            }
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 2 );
+            void setLocalReferenceNormal( ) override {
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 1 );
+                asp::aspBase::setLocalReferenceNormal( localReferenceNormal );
 
-    BOOST_CHECK( !asp.interactionData1.first );
+            }
 
-    BOOST_CHECK( !asp.interactionData2.first );
+    };
+    
+    aspBaseMock asp, aspGet, asp1, asp2, asp3;
 
-    BOOST_CHECK( asp.surfaceData1.first );
+    floatVector gradientMicroDeformation = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9,
+                                             1.0, 1.1, 1.2, 1.3, 1.4, 1.5, 1.6, 1.7, 1.8,
+                                             1.9, 2.0, 2.1, 2.2, 2.3, 2.4, 2.5, 2.6, 2.7 };
 
-    BOOST_CHECK( asp.surfaceData2.first );
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp, gradientMicroDeformation );
 
-    BOOST_CHECK( asp.particleData1.first );
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspGet, gradientMicroDeformation );
 
-}
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp1, gradientMicroDeformation );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_resetSurfacePointData ){
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp2, gradientMicroDeformation );
 
-    class aspBaseMock : public asp::aspBase{
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp3, gradientMicroDeformation );
 
-        public:
+    floatType answer;
 
-            asp::dataStorage< int > interactionData1;
-        
-            asp::dataStorage< floatVector > interactionData2;
-    
-            asp::dataStorage< floatType > surfaceData1;
-    
-            asp::dataStorage< floatMatrix > surfaceData2;
-    
-            asp::dataStorage< std::unordered_map< int, floatType > > particleData1;
+    floatType result;
 
-            aspBaseMock( ){
+    asp.computeSurfaceAdhesionEnergyDensity( answer );
 
-                interactionData1 = asp::dataStorage< int >( true, 1 );
-        
-                interactionData2 = asp::dataStorage< floatVector >( true, { 1, 2, 3 } );
-    
-                surfaceData1 = asp::dataStorage< floatType >( true, 2. );
-    
-                surfaceData2 = asp::dataStorage< floatMatrix >( true, { { 1, 2, 3 }, { 4, 5, 6 } } );
-    
-                particleData1 = asp::dataStorage< std::unordered_map< int, floatType > >( true, { { 1, 1 }, { 2, 3 } } );
+    floatVector _dSurfaceAdhesionEnergyDensitydLocalDeformationGradient,
+                _dSurfaceAdhesionEnergyDensitydLocalMicroDeformation,
+                _dSurfaceAdhesionEnergyDensitydGradientMicroDeformation;
 
-                addInteractionPairData( &interactionData1 );
+    asp.computeSurfaceAdhesionEnergyDensity( result,
+                                             _dSurfaceAdhesionEnergyDensitydLocalDeformationGradient,
+                                             _dSurfaceAdhesionEnergyDensitydLocalMicroDeformation,
+                                             _dSurfaceAdhesionEnergyDensitydGradientMicroDeformation );
 
-                addInteractionPairData( &interactionData2 );
+    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
 
-                addSurfacePointData( &surfaceData1 );
+    aspGet.getdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( );
 
-                addSurfacePointData( &surfaceData2 );
+    BOOST_CHECK( vectorTools::fuzzyEquals( result, *aspGet.getSurfaceAdhesionEnergyDensity( ) ) );
 
-                addLocalParticleData( &particleData1 );
+    floatVector dSurfaceAdhesionEnergyDensitydLocalDeformationGradient( 9, 0 );
 
-            }
+    floatVector dSurfaceAdhesionEnergyDensitydLocalMicroDeformation( 9, 0 );
 
-    };
+    floatVector dSurfaceAdhesionEnergyDensitydGradientMicroDeformation( 27, 0 );
+    
+    floatType eps = 1e-6;
 
-    aspBaseMock asp;
+    for ( unsigned int i = 0; i < asp1.F.size( ); i++ ){
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 2 );
+        floatVector delta( asp1.F.size( ), 0 );
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 2 );
+        delta[ i ] = eps * std::fabs( asp1.F[ i ] ) + eps;
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 1 );
+        aspBaseMock aspp, aspm;
 
-    asp::unit_test::aspBaseTester::resetSurfacePointData( asp );
+        aspp.F += delta;
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 0 );
+        aspm.F -= delta;
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 0 );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 1 );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-    BOOST_CHECK( !asp.interactionData1.first );
+        dSurfaceAdhesionEnergyDensitydLocalDeformationGradient[ i ] = (  ( *aspp.getSurfaceAdhesionEnergyDensity( ) ) - ( *aspm.getSurfaceAdhesionEnergyDensity( ) ) ) / ( 2 * delta[ i ] );
 
-    BOOST_CHECK( !asp.interactionData2.first );
+    }
 
-    BOOST_CHECK( !asp.surfaceData1.first );
+    for ( unsigned int i = 0; i < asp2.chi.size( ); i++ ){
 
-    BOOST_CHECK( !asp.surfaceData2.first );
+        floatVector delta( asp2.chi.size( ), 0 );
 
-    BOOST_CHECK( asp.particleData1.first );
+        delta[ i ] = eps * std::fabs( asp2.chi[ i ] ) + eps;
 
-}
+        aspBaseMock aspp, aspm;
 
-BOOST_AUTO_TEST_CASE( test_aspBase_resetLocalParticleData ){
+        aspp.chi += delta;
 
-    class aspBaseMock : public asp::aspBase{
+        aspm.chi -= delta;
 
-        public:
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation );
 
-            asp::dataStorage< int > interactionData1;
-        
-            asp::dataStorage< floatVector > interactionData2;
-    
-            asp::dataStorage< floatType > surfaceData1;
-    
-            asp::dataStorage< floatMatrix > surfaceData2;
-    
-            asp::dataStorage< std::unordered_map< int, floatType > > particleData1;
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation );
 
-            aspBaseMock( ){
+        dSurfaceAdhesionEnergyDensitydLocalMicroDeformation[ i ] = (  ( *aspp.getSurfaceAdhesionEnergyDensity( ) ) - ( *aspm.getSurfaceAdhesionEnergyDensity( ) ) ) / ( 2 * delta[ i ] );
 
-                interactionData1 = asp::dataStorage< int >( true, 1 );
-        
-                interactionData2 = asp::dataStorage< floatVector >( true, { 1, 2, 3 } );
-    
-                surfaceData1 = asp::dataStorage< floatType >( true, 2. );
-    
-                surfaceData2 = asp::dataStorage< floatMatrix >( true, { { 1, 2, 3 }, { 4, 5, 6 } } );
-    
-                particleData1 = asp::dataStorage< std::unordered_map< int, floatType > >( true, { { 1, 1 }, { 2, 3 } } );
+    }
 
-                addInteractionPairData( &interactionData1 );
+    for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
 
-                addInteractionPairData( &interactionData2 );
+        floatVector delta( gradientMicroDeformation.size( ), 0 );
 
-                addSurfacePointData( &surfaceData1 );
+        delta[ i ] = eps * std::fabs( gradientMicroDeformation[ i ] ) + eps;
 
-                addSurfacePointData( &surfaceData2 );
+        aspBaseMock aspp, aspm;
 
-                addLocalParticleData( &particleData1 );
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspp, gradientMicroDeformation + delta );
 
-            }
+        asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspm, gradientMicroDeformation - delta );
 
-    };
+        dSurfaceAdhesionEnergyDensitydGradientMicroDeformation[ i ] = (  ( *aspp.getSurfaceAdhesionEnergyDensity( ) ) - ( *aspm.getSurfaceAdhesionEnergyDensity( ) ) ) / ( 2 * delta[ i ] );
 
-    aspBaseMock asp;
+    }
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 2 );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dSurfaceAdhesionEnergyDensitydLocalDeformationGradient, *asp1.getdSurfaceAdhesionEnergyDensitydLocalDeformationGradient( ) ) );
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 2 );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dSurfaceAdhesionEnergyDensitydLocalMicroDeformation, *asp2.getdSurfaceAdhesionEnergyDensitydLocalMicroDeformation( ) ) );
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 1 );
+    BOOST_CHECK( vectorTools::fuzzyEquals( dSurfaceAdhesionEnergyDensitydGradientMicroDeformation, *asp3.getdSurfaceAdhesionEnergyDensitydGradientMicroDeformation( ) ) );
 
-    asp::unit_test::aspBaseTester::resetLocalParticleData( asp );
+}
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 0 );
+BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceAdhesionTraction ){
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 0 );
+    class aspBaseMock : public asp::aspBase{
 
-    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 0 );
+        public:
 
-    BOOST_CHECK( !asp.interactionData1.first );
+            floatVector distanceVector = { 1, 2, 3 };
 
-    BOOST_CHECK( !asp.interactionData2.first );
+            floatVector localCurrentNormal = { 0.45584231, 0.56980288, 0.68376346 };
 
-    BOOST_CHECK( !asp.surfaceData1.first );
+            floatVector surfaceParameters = { 12.3, 45.6 };
 
-    BOOST_CHECK( !asp.surfaceData2.first );
+            aspBaseMock( ){
 
-    BOOST_CHECK( !asp.particleData1.first );
+                asp::unit_test::aspBaseTester::set_currentDistanceVector( *this, distanceVector );
 
-}
+                asp::unit_test::aspBaseTester::set_localCurrentNormal( *this, localCurrentNormal );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getNumLocalParticles ){
+                asp::unit_test::aspBaseTester::set_surfaceParameters( *this, surfaceParameters );
 
-    asp::aspBase asp;
+            }
 
-    asp::unit_test::aspBaseTester::checkNumLocalParticles( asp );
+    };
+    
+    aspBaseMock asp, aspGet;
 
-}
+    floatVector dn = vectorTools::dot( asp.distanceVector, asp.localCurrentNormal ) * asp.localCurrentNormal;
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousTime ){
+    floatVector dt = ( asp.distanceVector - dn );
 
-    asp::aspBase asp;
+    floatVector answer = asp.surfaceParameters[ 0 ] * dn + asp.surfaceParameters[ 1 ] * dt;
 
-    asp::unit_test::aspBaseTester::checkPreviousTime( asp );
+    floatVector result;
 
-}
+    asp.computeSurfaceAdhesionTraction( result );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getDeltaTime ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
 
-    asp::aspBase asp;
+    asp::dataStorage< floatVector > result2;
 
-    asp::unit_test::aspBaseTester::checkDeltaTime( asp );
+    asp::unit_test::aspBaseTester::setSurfaceAdhesionTraction( asp, result2 );
 
-}
+    BOOST_CHECK( result2.first );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousTemperature ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( result2.second, answer ) );
 
-    asp::aspBase asp;
+    result = *aspGet.getSurfaceAdhesionTraction( );
 
-    asp::unit_test::aspBaseTester::checkPreviousTemperature( asp );
+    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getTemperature ){
+BOOST_AUTO_TEST_CASE( test_aspBase_getSurfaceAdhesionEnergyDensity_error ){
 
-    asp::aspBase asp;
+    class aspBaseMock : public asp::aspBase{
 
-    asp::unit_test::aspBaseTester::checkTemperature( asp );
+        private:
 
-}
+            virtual void computeSurfaceAdhesionEnergyDensity( floatType &surfaceAdhesionEnergyDensity ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getDeformationGradient ){
+                throw std::runtime_error( "This should throw an error" );
 
-    asp::aspBase asp;
+            }
 
-    asp::unit_test::aspBaseTester::checkDeformationGradient( asp );
+    };
 
-}
+    aspBaseMock asp;
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousDeformationGradient ){
+    //Setup redirect variables for stderr
+    std::stringbuf buffer;
+    cerr_redirect rd( &buffer );
 
-    asp::aspBase asp;
+    BOOST_REQUIRE_THROW(
+        try{
+            asp.getSurfaceAdhesionEnergyDensity( );
+        }
+        catch(std::exception &e){
+            errorTools::printNestedExceptions( e );
+            throw;
+        }
+    , std::exception );
 
-    asp::unit_test::aspBaseTester::checkPreviousDeformationGradient( asp );
+    BOOST_CHECK( buffer.str( ).find( "This should throw an error" ) != std::string::npos );
+
+    BOOST_CHECK( buffer.str( ).find( "getSurfaceAdhesionEnergyDensity" ) != std::string::npos );
+
+    BOOST_CHECK( buffer.str( ).find( "setSurfaceAdhesionEnergyDensity" ) != std::string::npos );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousMicroDeformation ){
+BOOST_AUTO_TEST_CASE( test_aspBase_getSurfaceAdhesionEnergyDensity ){
 
-    asp::aspBase asp;
+    class aspBaseMock : public asp::aspBase{
 
-    asp::unit_test::aspBaseTester::checkPreviousMicroDeformation( asp );
+        private:
 
-}
+            virtual void computeSurfaceAdhesionEnergyDensity( floatType &surfaceAdhesionEnergyDensity ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousStateVariables ){
+                surfaceAdhesionEnergyDensity = 123;
 
-    asp::aspBase asp;
+                return;
 
-    asp::unit_test::aspBaseTester::checkPreviousStateVariables( asp );
+            }
 
-}
+    };
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousLocalStateVariables ){
+    aspBaseMock asp;
 
-    asp::aspBase asp;
+    //Setup redirect variables for stderr
+    std::stringbuf buffer;
+    cerr_redirect rd( &buffer );
 
-    asp::unit_test::aspBaseTester::checkPreviousLocalStateVariables( asp );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getSurfaceAdhesionEnergyDensity( ), 123. ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getParticleParameters ){
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalReferenceSurfacePoints ){
 
-    asp::aspBase asp;
+    class aspBaseMock : public asp::aspBase{
 
-    asp::unit_test::aspBaseTester::checkParticleParameters( asp );
+        public:
 
-}
+            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalIndex ){
+            std::vector< unsigned int > connectivity = { 1, 2, 3 };
 
-    asp::aspBase asp;
+            floatType radius = 1.3;
 
-    asp::unit_test::aspBaseTester::checkLocalIndex( asp );
+        private:
 
-}
+            virtual void initializeUnitSphere( ){
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getNonLocalIndex ){
+                asp::unit_test::aspBaseTester::set_unitSphere( *this, points, connectivity );
 
-    asp::aspBase asp;
+            }
 
-    asp::unit_test::aspBaseTester::checkNonLocalIndex( asp );
+            virtual void setLocalReferenceRadius( ){
 
-}
+                asp::unit_test::aspBaseTester::set_localReferenceRadius( *this, radius );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalSurfaceNodeIndex ){
+            }
 
-    asp::aspBase asp;
+    };
 
-    asp::unit_test::aspBaseTester::checkLocalSurfaceNodeIndex( asp );
+    aspBaseMock asp, aspGet;
+
+    floatVector answer = asp.points * asp.radius;
+
+    asp::dataStorage< floatVector > result;
+
+    asp::unit_test::aspBaseTester::setLocalReferenceSurfacePoints( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalReferenceSurfacePoints( ), answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleEnergy ){
+BOOST_AUTO_TEST_CASE( test_aspBase_getNonLocalReferenceSurfacePoints ){
 
     class aspBaseMock : public asp::aspBase{
 
         public:
 
-            floatType volume = 2.4;
-    
-            floatType energyDensity = 3.5;
-    
-            floatVector stress = { 1, 2, 3 };
-    
-            floatVector stateVariables = { -1, -2 };
-    
-            floatType probabilityRatio = .34;
+            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+            std::vector< unsigned int > connectivity = { 1, 2, 3 };
+
+            floatType radius = 1.3;
 
         private:
 
-            void setLocalParticleCurrentVolume( ){
-    
-                asp::unit_test::aspBaseTester::set_localParticleCurrentVolume( *this, volume );
-    
-            }
+            virtual void initializeUnitSphere( ){
 
-            void setLocalParticleQuantities( ){
-    
-                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, energyDensity );
+                asp::unit_test::aspBaseTester::set_unitSphere( *this, points, connectivity );
 
-                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, stress );
+            }
 
-                asp::unit_test::aspBaseTester::set_localParticleStateVariables( *this, stateVariables );
+            virtual void setNonLocalReferenceRadius( ){
+
+                asp::unit_test::aspBaseTester::set_nonLocalReferenceRadius( *this, radius );
 
-                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, probabilityRatio );
-    
             }
 
     };
 
     aspBaseMock asp, aspGet;
 
-    floatType answer = 8.4;
+    floatVector answer = asp.points * asp.radius;
 
-    asp::dataStorage< floatType > result;
+    asp::dataStorage< floatVector > result;
 
-    asp::unit_test::aspBaseTester::setLocalParticleEnergy( asp, result );
+    asp::unit_test::aspBaseTester::setNonLocalReferenceSurfacePoints( asp, result );
 
     BOOST_CHECK( result.first );
 
     BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleEnergy( ), answer ) );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalReferenceSurfacePoints( ), answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleEnergyDensity ){
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalCurrentSurfacePoints ){
 
     class aspBaseMock : public asp::aspBase{
 
         public:
 
-            floatType volume = 2.4;
-    
-            floatType energyDensity = 3.5;
+            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
 
-            floatVector stress = { 1, 2, 3 };
-    
-            floatVector stateVariables = { -1, -2 };
-    
-            floatType probabilityRatio = .34;
+            floatVector microDeformation = { .1, .2, .3, .4, .5, .6, .7, .8, .9 };
 
         private:
 
-            void setLocalParticleQuantities( ){
-    
-                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, energyDensity );
-    
-                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, stress );
+            virtual void setLocalReferenceSurfacePoints( ){
 
-                asp::unit_test::aspBaseTester::set_localParticleStateVariables( *this, stateVariables );
+                asp::unit_test::aspBaseTester::set_localReferenceSurfacePoints( *this, points );
+
+            }
+
+            virtual void setLocalMicroDeformation( ){
+
+                asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, microDeformation );
 
-                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, probabilityRatio );
-    
             }
 
     };
 
     aspBaseMock asp, aspGet;
 
-    floatType answer = asp.energyDensity;
+    floatVector answer = { 1.4,  3.2,  5. ,
+                           3.2,  7.7, 12.2,
+                           5. , 12.2, 19.4,
+                           6.8, 16.7, 26.6};
 
-    asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( asp, asp.energyDensity );
+    asp::dataStorage< floatVector > result;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleEnergyDensity( ), answer ) );
+    asp::unit_test::aspBaseTester::setLocalCurrentSurfacePoints( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalCurrentSurfacePoints( ), answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleLogProbabilityRatio ){
+BOOST_AUTO_TEST_CASE( test_aspBase_getNonLocalCurrentSurfacePoints ){
 
     class aspBaseMock : public asp::aspBase{
 
         public:
 
-            floatType volume = 2.4;
-    
-            floatType energyDensity = 3.5;
+            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
 
-            floatVector stress = { 1, 2, 3 };
-    
-            floatVector stateVariables = { -1, -2 };
-    
-            floatType probabilityRatio = .34;
+            floatVector microDeformation = { .1, .2, .3, .4, .5, .6, .7, .8, .9 };
 
         private:
 
-            void setLocalParticleQuantities( ){
-    
-                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, energyDensity );
-    
-                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, stress );
+            virtual void setNonLocalReferenceSurfacePoints( ){
 
-                asp::unit_test::aspBaseTester::set_localParticleStateVariables( *this, stateVariables );
+                asp::unit_test::aspBaseTester::set_nonLocalReferenceSurfacePoints( *this, points );
+
+            }
+
+            virtual void setNonLocalMicroDeformation( ){
+
+                asp::unit_test::aspBaseTester::set_nonLocalMicroDeformation( *this, microDeformation );
 
-                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, probabilityRatio );
-    
             }
 
     };
 
     aspBaseMock asp, aspGet;
 
-    floatType answer = asp.probabilityRatio;
+    floatVector answer = { 1.4,  3.2,  5. ,
+                           3.2,  7.7, 12.2,
+                           5. , 12.2, 19.4,
+                           6.8, 16.7, 26.6};
 
-    asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( asp, asp.probabilityRatio );
+    asp::dataStorage< floatVector > result;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleLogProbabilityRatio( ), answer ) );
+    asp::unit_test::aspBaseTester::setNonLocalCurrentSurfacePoints( asp, result );
 
-}
+    BOOST_CHECK( result.first );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setLocalParticleQuantities ){
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
 
-    class aspBaseMock : public asp::aspBase{
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalCurrentSurfacePoints( ), answer ) );
 
-        private:
+}
 
-            virtual void computeLocalParticleEnergyDensity( const floatType &previousTime, const floatType &deltaTime,
-                                                            const floatVector &currentMicroDeformation, const floatVector &previousMicroDeformation,
-                                                            const floatType &currentTemperature, const floatType &previousTemperature,
-                                                            const floatVector &previousStateVariables,
-                                                            const floatVector &parameters,
-                                                            floatType &energyDensity, floatVector &cauchyStress, floatVector &stateVariables, floatType &logProbabilityRatio ){
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleCurrentBoundingBox ){
 
-                energyDensity = 1.2;
+    class aspBaseMock : public asp::aspBase{
 
-                cauchyStress = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        public:
 
-                stateVariables = { -1, -2 };
+            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
 
-                logProbabilityRatio = 0.47;
+        private:
 
-                return;
+            virtual void setLocalCurrentSurfacePoints( ){
+
+                asp::unit_test::aspBaseTester::set_localCurrentSurfacePoints( *this, points );
 
             }
 
     };
 
-    aspBaseMock asp, aspGet1, aspGet2, aspGet3, aspGet4;
+    aspBaseMock asp, aspGet;
 
-    floatType energyDensityAnswer = 1.2;
+    floatMatrix answer = { { 1, 10 },
+                           { 2, 11 },
+                           { 3, 12 } };
 
-    floatVector cauchyStressAnswer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    asp::dataStorage< floatMatrix > result;
 
-    floatVector stateVariablesAnswer = { -1, -2 };
+    asp::unit_test::aspBaseTester::setLocalParticleCurrentBoundingBox( asp, result );
 
-    floatType logProbabilityRatioAnswer = 0.47;
+    BOOST_CHECK( result.first );
 
-    asp::dataStorage< floatType > energyDensityResult;
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
 
-    asp::dataStorage< floatVector > cauchyStressResult;
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleCurrentBoundingBox( ), answer ) );
 
-    asp::dataStorage< floatVector > stateVariableResult;
+}
 
-    asp::dataStorage< floatType > logProbabilityRatioResult;
+BOOST_AUTO_TEST_CASE( test_aspBase_getNonLocalParticleCurrentBoundingBox ){
 
-    asp::unit_test::aspBaseTester::setLocalParticleQuantities( asp, energyDensityResult, cauchyStressResult, stateVariableResult, logProbabilityRatioResult );
+    class aspBaseMock : public asp::aspBase{
 
-    BOOST_CHECK( energyDensityResult.first );
+        public:
 
-    BOOST_CHECK( cauchyStressResult.first );
+            floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
 
-    BOOST_CHECK( stateVariableResult.first );
+        private:
 
-    BOOST_CHECK( logProbabilityRatioResult.first );
+            virtual void setNonLocalCurrentSurfacePoints( ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( energyDensityResult.second, energyDensityAnswer ) );
+                asp::unit_test::aspBaseTester::set_nonLocalCurrentSurfacePoints( *this, points );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( cauchyStressResult.second, cauchyStressAnswer ) );
+            }
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( stateVariableResult.second, stateVariablesAnswer ) );
+    };
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( logProbabilityRatioResult.second, logProbabilityRatioAnswer ) );
+    aspBaseMock asp, aspGet;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet1.getLocalParticleEnergyDensity( ), energyDensityAnswer ) );
+    floatMatrix answer = { { 1, 10 },
+                           { 2, 11 },
+                           { 3, 12 } };
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet2.getLocalParticleMicroCauchyStress( ), cauchyStressAnswer ) );
+    asp::dataStorage< floatMatrix > result;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet3.getLocalParticleStateVariables( ), stateVariablesAnswer ) );
+    asp::unit_test::aspBaseTester::setNonLocalParticleCurrentBoundingBox( asp, result );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet4.getLocalParticleLogProbabilityRatio( ), logProbabilityRatioAnswer ) );
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalParticleCurrentBoundingBox( ), answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleReferenceVolume ){
+BOOST_AUTO_TEST_CASE( test_aspBase_formBoundingBox ){
 
-    class aspBaseMock : public asp::aspBase{
+    asp::aspBase asp;
 
-        floatType radius = 2.4;
+    floatVector points = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
 
-        private:
+    floatMatrix answer = { { 1, 7 },
+                           { 2, 8 },
+                           { 3, 9 } };
 
-            void setLocalReferenceRadius( ){
-    
-                asp::unit_test::aspBaseTester::set_localReferenceRadius( *this, radius );
-    
-            }
+    floatMatrix result;
 
-    };
+    asp::unit_test::aspBaseTester::formBoundingBox( asp, points, result );
 
-    aspBaseMock asp, aspGet;
+    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
 
-    floatType answer = 57.90583579096705;
+}
 
-    asp::dataStorage< floatType > result;
+BOOST_AUTO_TEST_CASE( test_aspBase_pointInBoundingBox ){
 
-    asp::unit_test::aspBaseTester::setLocalParticleReferenceVolume( asp, result );
+    asp::aspBase asp;
 
-    BOOST_CHECK( result.first );
+    floatVector point = { 1, 2 };
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    floatMatrix boundingBox = { { 0, 2 }, { 1, 3 } };
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleReferenceVolume( ), answer ) );
+    BOOST_CHECK( asp::unit_test::aspBaseTester::pointInBoundingBox( asp, point, boundingBox ) );
+
+    point = { 1, -2 };
+
+    BOOST_CHECK( !asp::unit_test::aspBaseTester::pointInBoundingBox( asp, point, boundingBox ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleCurrentVolume ){
+BOOST_AUTO_TEST_CASE( test_aspBase_idBoundingBoxContainedPoints ){
 
-    class aspBaseMock : public asp::aspBase{
+    asp::aspBase asp;
 
-        floatType referenceVolume = 2.4;
+    floatVector points = { 1, 2, 3, 1, -2, 4, 0.5, 1.1, 4.9 };
 
-        floatVector microDeformation = { 1, 2, 3, 4, 5, 6, 7, 8, 2 };
+    floatMatrix boundingBox = { { 0, 2 }, { 1, 3 }, { 2, 5 } };
 
-        private:
+    std::vector< unsigned int > answer = { 0, 2 };
 
-            void setLocalParticleReferenceVolume( ){
-    
-                asp::unit_test::aspBaseTester::set_localParticleReferenceVolume( *this, referenceVolume );
-    
-            }
+    std::vector< unsigned int > result;
 
-            void setLocalMicroDeformation( ){
-    
-                asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, microDeformation );
-    
-            }
+    asp::unit_test::aspBaseTester::idBoundingBoxContainedPoints( asp, points, boundingBox, result );
 
-    };
+    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
 
-    aspBaseMock asp, aspGet;
+    // Points on the boundary are contained
+    points = { 0, 1, 2, 2, 3, 5, 2.1, 3, 5 };
 
-    floatType answer = 50.39999999999997;
+    answer = { 0, 1 };
 
-    asp::dataStorage< floatType > result;
+    asp::unit_test::aspBaseTester::idBoundingBoxContainedPoints( asp, points, boundingBox, result );
 
-    asp::unit_test::aspBaseTester::setLocalParticleCurrentVolume( asp, result );
+    BOOST_CHECK( vectorTools::fuzzyEquals( result, answer ) );
 
-    BOOST_CHECK( result.first );
+    points = { };
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    asp::unit_test::aspBaseTester::idBoundingBoxContainedPoints( asp, points, boundingBox, result );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleCurrentVolume( ), answer ) );
+    BOOST_CHECK( result.size( ) == 0 );
+
+    // Check that incorrectly sized bounding boxes are detected
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            void idBoundingBoxContainedPoints( const floatVector &points, const floatMatrix &boundingBox, std::vector< unsigned int > &containedPoints ){
+
+                asp::aspBase::idBoundingBoxContainedPoints( points, boundingBox, containedPoints );
+
+            }
+
+    };
+
+    aspBaseMock aspMock;
+
+    floatMatrix boundingBox_incorrect = { { 0, 2 }, { 1, 3 } };
+
+    BOOST_CHECK_THROW( aspMock.idBoundingBoxContainedPoints( points, boundingBox_incorrect, result ), std::exception );
+
+    boundingBox_incorrect = { { 0, 2 }, { 1, 3 }, { 2 } };
+
+    BOOST_CHECK_THROW( aspMock.idBoundingBoxContainedPoints( points, boundingBox_incorrect, result ), std::exception );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setLocalParticleParameters ){
+BOOST_AUTO_TEST_CASE( test_aspBase_singlePrecisionBroadPhase ){
+    /*!
+     * Test that the overlap candidate culling is conservative when the points are stored in single precision
+     */
 
     class aspBaseMock : public asp::aspBase{
 
-        floatVector particleParameters = { 1, 2, 3 };
+        public:
+
+            using asp::aspBase::pointInBoundingBox;
+
+            using asp::aspBase::formBoundingBox;
+
+            using asp::aspBase::idBoundingBoxContainedPoints;
 
     };
 
-    aspBaseMock asp, aspGet;
+    aspBaseMock asp;
 
-    floatVector answer = { 1, 2, 3 };
+    // The bounds and points are not representable in single precision and are rounded away from the box
+    floatMatrix boundingBox = { { 0.3, 0.1 + 1 }, { 0.3, 1.1 }, { -1.1, -0.3 } };
 
-    asp::dataStorage< floatVector > result;
+    floatVector points = { 0.3, 1.1, -0.3, 1.1, 0.3, -1.1, 0.7, 0.7, -0.7, 0.29, 0.7, -0.7 };
 
-    asp::unit_test::aspBaseTester::set_particleParameters( asp, answer );
+    std::vector< float > singlePoints( points.begin( ), points.end( ) );
 
-    asp::unit_test::aspBaseTester::set_particleParameters( aspGet, answer );
+    std::vector< unsigned int > answer = { 0, 1, 2 };
 
-    asp::unit_test::aspBaseTester::setLocalParticleParameters( asp, result );
+    std::vector< unsigned int > result;
 
-    BOOST_CHECK( result.first );
+    asp.idBoundingBoxContainedPoints( points, boundingBox, result );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+    BOOST_CHECK( result == answer );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleParameters( ), answer ) );
+    asp.idBoundingBoxContainedPoints( singlePoints, boundingBox, result );
 
-}
+    BOOST_CHECK( result == answer );
 
-BOOST_AUTO_TEST_CASE( test_aspBase_assembleLocalParticle ){
+    for ( unsigned int p = 0; p < 3; p++ ){
 
-    class aspBaseMock : public asp::aspBase{
+        std::vector< float > point( singlePoints.begin( ) + 3 * p, singlePoints.begin( ) + 3 * ( p + 1 ) );
 
-        public:
+        BOOST_CHECK( asp.pointInBoundingBox( point, boundingBox ) );
 
-            unsigned int numLocalParticles = 4;
-    
-            floatVector energies = { 1, 2, 3, 4 };
+    }
 
-            floatVector energyDensities = { 10, 20, 30, 40 };
-    
-            floatMatrix microCauchyStresses = { { 1, 2, 3 }, { 4, 5 }, { 6, 7, 8 }, { 9, 10, 11, 12 } };
-    
-            floatVector localParticleVolumes = { 0.1, 0.2, 0.3, 0.4 };
-    
-            floatVector probabilityRatios = { -0.2, -0.3, -0.4, -0.5 };
-    
-            aspBaseMock( ) : aspBase( ){
-    
-                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
-    
-            }
+    // The bounding box of single precision points contains the points they were rounded from
+    floatMatrix singleBoundingBox;
 
-        private:
+    asp.formBoundingBox( singlePoints, singleBoundingBox );
 
-            virtual void setLocalParticleEnergy( ){
+    for ( unsigned int p = 0; p < points.size( ) / 3; p++ ){
 
-                const unsigned int* localIndex = getLocalIndex( );
+        BOOST_CHECK( asp.pointInBoundingBox( floatVector( points.begin( ) + 3 * p, points.begin( ) + 3 * ( p + 1 ) ), singleBoundingBox ) );
 
-                asp::unit_test::aspBaseTester::set_localParticleEnergy( *this, energies[ *localIndex ] );
+    }
 
-            }
+    // The broad phase points are converted from the current surface points
+    class aspBaseMockPoints : public asp::aspBase{
 
-            virtual void setLocalParticleQuantities( ){
-    
-                const unsigned int* localIndex = getLocalIndex( );
-    
-                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, energies[ *localIndex ] );
+        public:
+
+            floatVector points = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6 };
+
+            aspBaseMockPoints( ) : aspBase( ){
+
+                asp::unit_test::aspBaseTester::set_localCurrentSurfacePoints( *this, points );
 
-                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, microCauchyStresses[ *localIndex ] );
-    
-                asp::unit_test::aspBaseTester::set_localParticleCurrentVolume( *this, localParticleVolumes[ *localIndex ] );
-    
-                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, probabilityRatios[ *localIndex ] );
-    
             }
 
     };
 
-    aspBaseMock asp1, asp2, asp3, asp4;
+    aspBaseMockPoints aspPoints;
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *asp1.getAssembledLocalParticleEnergies( ), asp1.energies ) );
+    const asp::broadPhaseFloatVector *broadPhasePoints = aspPoints.getLocalCurrentSurfacePointsBroadPhase( );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *asp2.getAssembledLocalParticleMicroCauchyStresses( ), asp2.microCauchyStresses ) );
+    BOOST_CHECK( broadPhasePoints->size( ) == aspPoints.points.size( ) );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *asp3.getAssembledLocalParticleVolumes( ), asp3.localParticleVolumes ) );
+    for ( unsigned int i = 0; i < aspPoints.points.size( ); i++ ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *asp4.getAssembledLocalParticleLogProbabilityRatios( ), asp4.probabilityRatios ) );
+        BOOST_CHECK( std::abs( ( *broadPhasePoints )[ i ] - aspPoints.points[ i ] ) <= 1e-7 * std::abs( aspPoints.points[ i ] ) );
+
+    }
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_setSurfaceAdhesionThickness ){
+BOOST_AUTO_TEST_CASE( test_aspBase_boundingBoxesOverlap ){
 
-    class aspBaseMock : public asp::aspBase{
+    asp::aspBase asp;
 
-        public:
+    floatMatrix boundingBox1 = { { 0, 2 }, { 1, 3 }, { 2, 5 } };
 
-            floatVector normalVector = { 1, 2, 3 };
+    floatMatrix boundingBox2 = { { 1, 4 }, { 2, 3 }, { -1, 2 } };
 
-            floatVector distanceVector = { 4, 5, 6 };
+    floatMatrix boundingBox3 = { { 1, 4 }, { 3.5, 4 }, { 0, 3 } };
 
-            aspBaseMock( ){
+    BOOST_CHECK( asp::unit_test::aspBaseTester::boundingBoxesOverlap( asp, boundingBox1, boundingBox2 ) );
 
-                normalVector /= vectorTools::l2norm( normalVector );
+    BOOST_CHECK( asp::unit_test::aspBaseTester::boundingBoxesOverlap( asp, boundingBox2, boundingBox1 ) );
 
-            }
+    BOOST_CHECK( !asp::unit_test::aspBaseTester::boundingBoxesOverlap( asp, boundingBox1, boundingBox3 ) );
 
-        private:
+    BOOST_CHECK( !asp::unit_test::aspBaseTester::boundingBoxesOverlap( asp, boundingBox2, boundingBox3 ) );
 
-            virtual void setCurrentDistanceVector( ){
+}
 
-                asp::unit_test::aspBaseTester::set_currentDistanceVector( *this, distanceVector );
+BOOST_AUTO_TEST_CASE( test_aspBase_formNeighborLists ){
 
-            }
+    asp::aspBase asp;
 
-            virtual void setLocalCurrentNormal( ){
+    std::vector< floatMatrix > boundingBoxes =
+        {
+            { {  0.0,  1.0 }, {  0.0, 1.0 }, { 0.0, 1.0 } },
+            { {  0.9,  1.9 }, {  0.5, 1.5 }, { 0.2, 1.2 } },
+            { {  5.0,  6.0 }, {  0.0, 1.0 }, { 0.0, 1.0 } },
+            { {  1.9,  2.5 }, { -0.5, 0.5 }, { 1.2, 1.7 } },
+            { { -3.0, -2.5 }, {  4.0, 4.1 }, { 0.0, 0.0 } },
+            { {  5.5,  5.5 }, {  1.0, 1.0 }, { 1.0, 1.0 } },
+        };
 
-                asp::unit_test::aspBaseTester::set_localCurrentNormal( *this, normalVector );
+    std::vector< std::vector< unsigned int > > answer =
+        {
+            { 0, 1 },
+            { 0, 1, 3 },
+            { 2, 5 },
+            { 1, 3 },
+            { 4 },
+            { 2, 5 },
+        };
 
-            }
+    std::vector< std::vector< unsigned int > > result;
 
-    };
+    asp::unit_test::aspBaseTester::formNeighborLists( asp, boundingBoxes, result );
 
-    aspBaseMock asp, aspGet;
+    BOOST_CHECK( result == answer );
 
-    floatType answer = std::fabs( vectorTools::dot( asp.normalVector, asp.distanceVector ) );
+    // Compare against the brute force search
+    for ( unsigned int i = 0; i < boundingBoxes.size( ); i++ ){
 
-    asp::dataStorage< floatType > result;
+        std::vector< unsigned int > bruteForce;
 
-    asp::unit_test::aspBaseTester::setSurfaceAdhesionThickness( asp, result );
+        for ( unsigned int j = 0; j < boundingBoxes.size( ); j++ ){
 
-    BOOST_CHECK( result.first );
+            if ( asp::unit_test::aspBaseTester::boundingBoxesOverlap( asp, boundingBoxes[ i ], boundingBoxes[ j ] ) ){
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+                bruteForce.push_back( j );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getSurfaceAdhesionThickness( ), answer ) );
+            }
+
+        }
+
+        BOOST_CHECK( result[ i ] == bruteForce );
+
+    }
+
+    // Degenerate boxes
+    boundingBoxes = { { { 1, 1 }, { 2, 2 }, { 3, 3 } }, { { 1, 1 }, { 2, 2 }, { 3, 3 } }, { { 1, 1 }, { 2, 2 }, { 4, 4 } } };
+
+    answer = { { 0, 1 }, { 0, 1 }, { 2 } };
+
+    asp::unit_test::aspBaseTester::formNeighborLists( asp, boundingBoxes, result );
+
+    BOOST_CHECK( result == answer );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_aspBase_assembleSurfaceEnergies ){
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleNeighbors ){
 
     class aspBaseMock : public asp::aspBase{
 
@@ -5216,33 +5459,1699 @@ BOOST_AUTO_TEST_CASE( test_aspBase_assembleSurfaceEnergies ){
 
             unsigned int numLocalParticles = 4;
 
-            unsigned int numSurfacePoints = 2;
+            floatVector unitCube = { -0.5, -0.5, -0.5,
+                                      0.5, -0.5, -0.5,
+                                      0.5,  0.5, -0.5,
+                                     -0.5,  0.5, -0.5,
+                                     -0.5, -0.5,  0.5,
+                                      0.5, -0.5,  0.5,
+                                      0.5,  0.5,  0.5,
+                                     -0.5,  0.5,  0.5 };
 
-            floatVector unitSpherePoints = { 1, 2, 3, 4, 5, 6 };
+            floatMatrix positions = { { 0.0, 0.0, 0.0 },
+                                      { 0.9, 0.0, 0.0 },
+                                      { 5.0, 0.0, 0.0 },
+                                      { 5.5, 0.5, 0.0 } };
 
-            std::vector< unsigned int > unitSphereConnectivity = { 10, 11, 12, 13 };
+            aspBaseMock( const floatVector &deformationGradient = { 1, 0, 0, 0, 1, 0, 0, 0, 1 } ) : aspBase( ){
 
-            std::vector< std::vector< std::vector< std::vector< unsigned int > > > > neighboringOverlapParticles
-                {
-                    {
-                        {
-                            { 1, 7 },
-                            { 0, },
-                            { },
-                            { 13, 8, 17},
-                        },
-                        {
-                            { 11, 4 },
-                            { 9, 34 },
-                            { 10 },
-                            { 8, 9, 10, 11},
-                        },
-                    },
-                    {
-                        {
-                            { 8, 13},
-                            { 2 },
-                            { 0, 1, 2 },
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+                asp::unit_test::aspBaseTester::set_deformationGradient( *this, deformationGradient );
+
+                setLocalParticleReferencePositions( vectorTools::appendVectors( positions ) );
+
+            }
+
+            aspBaseMock( const floatVector &deformationGradient, const floatMatrix &particlePositions ) : aspBase( ){
+
+                numLocalParticles = particlePositions.size( );
+
+                positions = particlePositions;
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+                asp::unit_test::aspBaseTester::set_deformationGradient( *this, deformationGradient );
+
+                setLocalParticleReferencePositions( vectorTools::appendVectors( positions ) );
+
+            }
+
+        private:
+
+            virtual void setLocalCurrentSurfacePoints( ){
+
+                asp::unit_test::aspBaseTester::set_localCurrentSurfacePoints( *this, unitCube );
+
+            }
+
+            virtual void setNonLocalCurrentSurfacePoints( ){
+
+                asp::unit_test::aspBaseTester::set_nonLocalCurrentSurfacePoints( *this, unitCube );
+
+            }
+
+            virtual void setLocalReferenceParticleSpacingVector( ){
+
+                floatVector value = positions[ *getNonLocalIndex( ) ];
+
+                for ( unsigned int i = 0; i < value.size( ); i++ ){
+
+                    value[ i ] -= positions[ *getLocalIndex( ) ][ i ];
+
+                }
+
+                asp::unit_test::aspBaseTester::set_localReferenceParticleSpacing( *this, value );
+
+            }
+
+    };
+
+    aspBaseMock aspAll, aspNeighbor, aspPadded, aspGet;
+
+    aspBaseMock aspStretched( { 2, 0, 0, 0, 1, 0, 0, 0, 1 } );
+
+    asp::dataStorage< std::vector< std::vector< unsigned int > > > result;
+
+    std::vector< std::vector< unsigned int > > answer = { { 0, 1, 2, 3 }, { 0, 1, 2, 3 }, { 0, 1, 2, 3 }, { 0, 1, 2, 3 } };
+
+    asp::unit_test::aspBaseTester::setLocalParticleNeighbors( aspAll, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( result.second == answer );
+
+    answer = { { 0, 1 }, { 0, 1 }, { 2, 3 }, { 2, 3 } };
+
+    aspNeighbor.setUseNeighborSearch( true );
+
+    asp::unit_test::aspBaseTester::set_indices( aspNeighbor, 2, 3, 1 );
+
+    asp::unit_test::aspBaseTester::setLocalParticleNeighbors( aspNeighbor, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( result.second == answer );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( aspNeighbor ).size( ) == 0 );
+
+    BOOST_CHECK( *aspNeighbor.getLocalIndex( ) == 2 );
+
+    BOOST_CHECK( *aspNeighbor.getNonLocalIndex( ) == 3 );
+
+    BOOST_CHECK( *aspNeighbor.getLocalSurfaceNodeIndex( ) == 1 );
+
+    // The lists are formed from the current positions of the particles
+    answer = { { 0 }, { 1 }, { 2, 3 }, { 2, 3 } };
+
+    aspStretched.setUseNeighborSearch( true );
+
+    asp::unit_test::aspBaseTester::setLocalParticleNeighbors( aspStretched, result );
+
+    BOOST_CHECK( result.second == answer );
+
+    answer = { { 0, 1 }, { 0, 1, 2 }, { 1, 2, 3 }, { 2, 3 } };
+
+    aspPadded.setUseNeighborSearch( true );
+
+    aspPadded.setNeighborSearchPadding( 1.6 );
+
+    asp::unit_test::aspBaseTester::setLocalParticleNeighbors( aspPadded, result );
+
+    BOOST_CHECK( result.second == answer );
+
+    answer = { { 0, 1 }, { 0, 1 }, { 2, 3 }, { 2, 3 } };
+
+    aspGet.setUseNeighborSearch( true );
+
+    aspGet.setNeighborSearchPadding( 0.1 );
+
+    BOOST_CHECK( *aspGet.getLocalParticleNeighbors( ) == answer );
+
+    // The lists are re-formed when the deformation changes
+    floatVector identity = { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, stretch = { 2, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    aspGet.setDeformation( identity, identity, floatVector( 27, 0 ), stretch, identity, floatVector( 27, 0 ) );
+
+    answer = { { 0 }, { 1 }, { 2, 3 }, { 2, 3 } };
+
+    BOOST_CHECK( *aspGet.getLocalParticleNeighbors( ) == answer );
+
+    BOOST_CHECK( *aspGet.getUseNeighborSearch( ) );
+
+    BOOST_CHECK( *aspGet.getNeighborSearchPadding( ) == 0.1 );
+
+    // The padding must be non-negative
+    BOOST_CHECK_THROW( aspGet.setNeighborSearchPadding( -1 ), std::exception );
+
+    // The search requires the reference positions of all of the particles
+    aspGet.setLocalParticleReferencePositions( { 0, 0, 0 } );
+
+    BOOST_CHECK_THROW( aspGet.getLocalParticleNeighbors( ), std::exception );
+
+    // The lists formed from the grid match the lists of the pairs which overlap when all of the pairs are tested
+    floatMatrix lattice;
+
+    for ( unsigned int a = 0; a < 5; a++ ){
+
+        for ( unsigned int b = 0; b < 4; b++ ){
+
+            for ( unsigned int c = 0; c < 3; c++ ){
+
+                floatType jitter = 0.15 * std::sin( 1. * lattice.size( ) );
+
+                lattice.push_back( { 1.1 * a + jitter, 1.05 * b - jitter, 0.95 * c + 0.5 * jitter } );
+
+            }
+
+        }
+
+    }
+
+    floatVector shear = { 1.0, 0.3, 0.0, 0.0, 1.1, 0.0, 0.0, 0.0, 0.9 };
+
+    aspBaseMock aspLattice( shear, lattice );
+
+    aspLattice.setUseNeighborSearch( true );
+
+    aspLattice.setNeighborSearchPadding( 0.02 );
+
+    std::vector< std::vector< unsigned int > > allPairs( lattice.size( ) );
+
+    unsigned int numPairs = 0;
+
+    for ( unsigned int i = 0; i < lattice.size( ); i++ ){
+
+        for ( unsigned int k = 0; k < lattice.size( ); k++ ){
+
+            bool isNeighbor = true;
+
+            for ( unsigned int a = 0; a < 3; a++ ){
+
+                floatType spacing = 0;
+
+                for ( unsigned int A = 0; A < 3; A++ ){
+
+                    spacing += shear[ 3 * a + A ] * ( lattice[ k ][ A ] - lattice[ i ][ A ] );
+
+                }
+
+                isNeighbor = isNeighbor && ( std::fabs( spacing ) <= 1 + 2 * 0.02 );
+
+            }
+
+            if ( isNeighbor ){
+
+                allPairs[ i ].push_back( k );
+
+                numPairs++;
+
+            }
+
+        }
+
+    }
+
+    BOOST_CHECK( *aspLattice.getLocalParticleNeighbors( ) == allPairs );
+
+    // The grid culls most of the pairs
+    BOOST_CHECK( numPairs < lattice.size( ) * lattice.size( ) / 2 );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getMicroDeformation ){
+
+    asp::aspBase asp;
+
+    floatVector answer = { 1, 2, 3, 4, 5, 6 };
+
+    asp::unit_test::aspBaseTester::set_microDeformation( asp, answer );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getMicroDeformation( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getGradientMicroDeformation ){
+
+    asp::aspBase asp;
+
+    floatVector answer = { 1, 2, 3, 4, 5, 6 };
+
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp, answer );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getGradientMicroDeformation( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setLocalGradientMicroDeformation ){
+
+    asp::aspBase asp, aspGet;
+
+    floatVector answer = { 1, 2, 3, 4, 5, 6 };
+
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( asp, answer );
+
+    asp::unit_test::aspBaseTester::set_gradientMicroDeformation( aspGet, answer );
+
+    asp::dataStorage< floatVector > result;
+
+    asp::unit_test::aspBaseTester::setLocalGradientMicroDeformation( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalGradientMicroDeformation( ), answer ) );
+
+}
+
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setNonLocalMicroDeformationBase ){
+
+    asp::aspBase asp, aspGet;
+
+    floatVector answer = { 1, 2, 3, 4, 5, 6 };
+
+    asp::unit_test::aspBaseTester::set_microDeformation( asp, answer );
+
+    asp::unit_test::aspBaseTester::set_microDeformation( aspGet, answer );
+
+    asp::dataStorage< floatVector > result;
+
+    asp::unit_test::aspBaseTester::setNonLocalMicroDeformationBase( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getNonLocalMicroDeformationBase( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setSurfaceOverlapParameters ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            floatVector overlapParameters = { 1, 2, 3};
+
+        private:
+
+            virtual void setSurfaceOverlapParameters( ){
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapParameters( *this, overlapParameters );
+
+            }
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    asp::dataStorage< floatVector > result;
+
+    asp::unit_test::aspBaseTester::setSurfaceOverlapParameters( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, asp.overlapParameters ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getSurfaceOverlapParameters( ), asp.overlapParameters ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setParticlePairOverlap ){
+    /*!
+     * Test setting the particle pair overlap values
+     */
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            floatMatrix nonLocalParticleCurrentBoundingBox = { { 0, 2 }, { 0, 2 }, { 0, 2 } };
+
+            floatVector localReferenceSurfacePoints = { 0, 0, 1, 1, 0, 0, 1.1, 0, 0 };
+
+            floatVector localCurrentSurfacePoints = { 0, 0, 1, 1.1, 0, 0, 1.1 * 1.1, 0, 0 };
+
+            floatVector localDeformationGradient = { 1.1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+            floatType nonLocalReferenceRadius = 2.3;
+
+            floatVector localMicroDeformation = { 1.5, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+            floatVector localReferenceParticleSpacing = { 2. / 1.1, 0, 0 };
+
+            floatVector localGradientMicroDeformation = { 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                          0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                          0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+            floatVector nonLocalMicroDeformationBase = { 1 / 2.3, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+        private:
+
+            virtual void setNonLocalParticleCurrentBoundingBox( ){
+
+                asp::unit_test::aspBaseTester::set_nonLocalParticleCurrentBoundingBox( *this, nonLocalParticleCurrentBoundingBox );
+
+            }
+
+            virtual void setLocalCurrentSurfacePoints( ){
+
+                asp::unit_test::aspBaseTester::set_localCurrentSurfacePoints( *this, localCurrentSurfacePoints );
+
+            }
+
+            virtual void setLocalReferenceSurfacePoints( ){
+
+                asp::unit_test::aspBaseTester::set_localReferenceSurfacePoints( *this, localReferenceSurfacePoints );
+
+            }
+
+            virtual void setLocalDeformationGradient( ){
+
+                asp::unit_test::aspBaseTester::set_localDeformationGradient( *this, localDeformationGradient );
+
+            }
+
+            virtual void setNonLocalReferenceRadius( ){
+
+                asp::unit_test::aspBaseTester::set_nonLocalReferenceRadius( *this, nonLocalReferenceRadius );
+
+            }
+
+            virtual void setLocalMicroDeformation( ){
+
+                asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, localMicroDeformation );
+
+            }
+
+            virtual void setLocalReferenceParticleSpacingVector( ){
+
+                asp::unit_test::aspBaseTester::set_localReferenceParticleSpacing( *this, localReferenceParticleSpacing );
+
+            }
+
+            virtual void setLocalGradientMicroDeformation( ){
+
+                asp::unit_test::aspBaseTester::set_localGradientMicroDeformation( *this, localGradientMicroDeformation );
+
+            }
+
+            virtual void setNonLocalMicroDeformationBase( ){
+
+                asp::unit_test::aspBaseTester::set_nonLocalMicroDeformationBase( *this, nonLocalMicroDeformationBase );
+
+            }
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    asp::mapFloatVector answer = { { 0, { 0, 0, 0 } }, { 1, { -0.5, 0, 0 } }, { 2, { -0.65, 0, 0 } } };
+
+    asp::dataStorage< asp::mapFloatVector > result;
+
+    asp::unit_test::aspBaseTester::setParticlePairOverlap( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    const asp::mapFloatVector *result2 = aspGet.getParticlePairOverlap( );
+
+    for ( auto p = answer.begin( ); p != answer.end( ); p++ ){
+
+        auto search = result.second.find( p->first );
+
+        BOOST_CHECK( search != result.second.end( ) );
+
+        if ( search != result.second.end( ) ){
+
+            BOOST_CHECK( vectorTools::fuzzyEquals( p->second, search->second ) );
+
+        }
+
+        auto search2 = result2->find( p->first );
+
+        BOOST_CHECK( search2 != result2->end( ) );
+
+        if ( search2 != result2->end( ) ){
+
+            BOOST_CHECK( vectorTools::fuzzyEquals( p->second, search2->second ) );
+
+        }
+
+    }
+
+    // The converged overlap distance solutions are kept for each local particle, non-local particle, and overlapping surface point
+    const asp::overlapSolutionStorage &overlapSolutions = asp::unit_test::aspBaseTester::get_overlapSolutions( aspGet );
+
+    BOOST_CHECK( overlapSolutions.size( ) > 0 );
+
+    for ( auto p = answer.begin( ); p != answer.end( ); p++ ){
+
+        auto search = overlapSolutions[ 0 ].find( std::make_pair( 0, p->first ) );
+
+        BOOST_CHECK( search != overlapSolutions[ 0 ].end( ) );
+
+        if ( search != overlapSolutions[ 0 ].end( ) ){
+
+            if ( vectorTools::fuzzyEquals( p->second, floatVector( 3, 0 ) ) ){
+
+                BOOST_CHECK( search->second.size( ) == 0 );
+
+            }
+            else{
+
+                BOOST_CHECK( search->second.size( ) == 4 );
+
+            }
+
+        }
+
+    }
+
+    // Re-evaluating the overlap is warm started by the stored solutions and gives the same overlap
+    asp::unit_test::aspBaseTester::resetInteractionPairData( aspGet );
+
+#ifdef ASP_INSTRUMENTATION
+    const unsigned long long initialIterations = aspGet.getInstrumentationCounters( )->overlapNewtonIterations;
+#endif
+
+    const asp::mapFloatVector *result3 = aspGet.getParticlePairOverlap( );
+
+#ifdef ASP_INSTRUMENTATION
+    BOOST_CHECK( aspGet.getInstrumentationCounters( )->overlapNewtonIterations == initialIterations );
+#endif
+
+    for ( auto p = answer.begin( ); p != answer.end( ); p++ ){
+
+        auto search = result3->find( p->first );
+
+        BOOST_CHECK( search != result3->end( ) );
+
+        if ( search != result3->end( ) ){
+
+            BOOST_CHECK( vectorTools::fuzzyEquals( p->second, search->second ) );
+
+        }
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceOverlapEnergyDensity ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+   
+            asp::mapFloatVector particlePairOverlap = { { 0, { -0.5, 0, 0 } }, { 4, { 2, -1, 4 } } };
+
+            floatVector surfaceOverlapParameters = { 2.3 };
+
+            floatMatrix currentNormals = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 10, 11, 12 }, { 13, 14, 15 } };
+
+        private:
+
+            virtual void setParticlePairOverlap( ){
+
+                asp::unit_test::aspBaseTester::set_particlePairOverlap( *this, particlePairOverlap );
+
+            }
+
+            virtual void setSurfaceOverlapParameters( ){
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapParameters( *this, surfaceOverlapParameters );
+
+            }
+
+            virtual void getLocalCurrentNormal( const unsigned int &index, floatVector &normal ){
+
+                normal = currentNormals[ index ];
+
+            }
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    asp::mapFloatType result;
+
+    asp::dataStorage< asp::mapFloatType > resultSet;
+
+    BOOST_CHECK_NO_THROW( asp.computeSurfaceOverlapEnergyDensity( result ) );
+
+    asp::unit_test::aspBaseTester::setSurfaceOverlapEnergyDensity( asp, resultSet );
+
+    BOOST_CHECK( resultSet.first );
+
+    const asp::mapFloatType *resultGet;
+
+    resultGet = aspGet.getSurfaceOverlapEnergyDensity( );
+
+    for ( auto p = asp.particlePairOverlap.begin( ); p != asp.particlePairOverlap.end( ); p++ ){
+
+        auto overlapEnergy = result.find( p->first );
+
+        BOOST_CHECK( overlapEnergy != result.end( ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( overlapEnergy->second, 0.5 * asp.surfaceOverlapParameters[ 0 ] * vectorTools::dot( p->second, p->second ) * std::fabs( vectorTools::dot( asp.currentNormals[ p->first ], p->second ) ) ) );
+
+        auto overlapEnergySet = resultSet.second.find( p->first );
+
+        BOOST_CHECK( overlapEnergySet != resultSet.second.end( ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( overlapEnergySet->second, 0.5 * asp.surfaceOverlapParameters[ 0 ] * vectorTools::dot( p->second, p->second ) * std::fabs( vectorTools::dot( asp.currentNormals[ p->first ], p->second ) ) ) );
+
+        auto overlapEnergyGet = resultGet->find( p->first );
+
+        BOOST_CHECK( overlapEnergyGet != resultGet->end( ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( overlapEnergyGet->second, 0.5 * asp.surfaceOverlapParameters[ 0 ] * vectorTools::dot( p->second, p->second ) * std::fabs( vectorTools::dot( asp.currentNormals[ p->first ], p->second ) ) ) );
+
+    } 
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceOverlapThickness ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+   
+            asp::mapFloatVector particlePairOverlap = { { 0, { -0.5, 0, 0 } }, { 4, { 2, -1, 4 } } };
+
+            floatMatrix currentNormals = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 }, { 10, 11, 12 }, { 13, 14, 15 } };
+
+        private:
+
+            virtual void setParticlePairOverlap( ){
+
+                asp::unit_test::aspBaseTester::set_particlePairOverlap( *this, particlePairOverlap );
+
+            }
+
+            virtual void getLocalCurrentNormal( const unsigned int &index, floatVector &normal ){
+
+                normal = currentNormals[ index ];
+
+            }
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    asp::dataStorage< asp::mapFloatType > resultSet;
+
+    asp::unit_test::aspBaseTester::setSurfaceOverlapThickness( asp, resultSet );
+
+    BOOST_CHECK( resultSet.first );
+
+    const asp::mapFloatType *resultGet;
+
+    resultGet = aspGet.getSurfaceOverlapThickness( );
+
+    for ( auto p = asp.particlePairOverlap.begin( ); p != asp.particlePairOverlap.end( ); p++ ){
+
+        auto overlapThicknessSet = resultSet.second.find( p->first );
+
+        BOOST_CHECK( overlapThicknessSet != resultSet.second.end( ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( overlapThicknessSet->second, std::fabs( vectorTools::dot( asp.currentNormals[ p->first ], p->second ) ) ) );
+
+        auto overlapThicknessGet = resultGet->find( p->first );
+
+        BOOST_CHECK( overlapThicknessGet != resultGet->end( ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( overlapThicknessGet->second, std::fabs( vectorTools::dot( asp.currentNormals[ p->first ], p->second ) ) ) );
+
+    } 
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_computeSurfaceOverlapTraction ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+   
+            asp::mapFloatVector particlePairOverlap = { { 0, { -0.5, 0, 0 } }, { 4, { 2, -1, 4 } } };
+
+            floatVector surfaceOverlapParameters = { 2.3 };
+
+        private:
+
+            virtual void setParticlePairOverlap( ){
+
+                asp::unit_test::aspBaseTester::set_particlePairOverlap( *this, particlePairOverlap );
+
+            }
+
+            virtual void setSurfaceOverlapParameters( ){
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapParameters( *this, surfaceOverlapParameters );
+
+            }
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    asp::mapFloatVector result;
+
+    BOOST_CHECK_NO_THROW( asp.computeSurfaceOverlapTraction( result ) );
+
+    const asp::mapFloatVector *resultGet;
+
+    resultGet = aspGet.getSurfaceOverlapTraction( );
+
+    for ( auto p = asp.particlePairOverlap.begin( ); p != asp.particlePairOverlap.end( ); p++ ){
+
+        auto overlapTraction = result.find( p->first );
+
+        BOOST_CHECK( overlapTraction != result.end( ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( overlapTraction->second, asp.surfaceOverlapParameters[ 0 ] * p->second ) );
+
+        auto overlapTractionGet = resultGet->find( p->first );
+
+        BOOST_CHECK( overlapTractionGet != result.end( ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( overlapTraction->second, asp.surfaceOverlapParameters[ 0 ] * p->second ) );
+
+    } 
+
+}
+
+BOOST_AUTO_TEST_CASE( test_dataStorage_clear ){
+    /*!
+     * Test that clearing the data storage retains the storage of the vectors and matrices
+     */
+
+    asp::dataStorage< floatVector > vectorData( true, { 1, 2, 3 } );
+
+    const floatType *vectorPointer = vectorData.second.data( );
+
+    vectorData.clear( );
+
+    BOOST_CHECK( !vectorData.first );
+
+    BOOST_CHECK( vectorData.second.size( ) == 0 );
+
+    vectorData.second = { 4, 5, 6 };
+
+    BOOST_CHECK( vectorPointer == vectorData.second.data( ) );
+
+    asp::dataStorage< floatMatrix > matrixData( true, { { 1, 2, 3 }, { 4, 5, 6 } } );
+
+    const floatType *rowPointers[ 2 ] = { matrixData.second[ 0 ].data( ), matrixData.second[ 1 ].data( ) };
+
+    matrixData.clear( );
+
+    BOOST_CHECK( !matrixData.first );
+
+    BOOST_CHECK( matrixData.second.size( ) == 2 );
+
+    BOOST_CHECK( ( matrixData.second[ 0 ].size( ) == 3 ) && ( matrixData.second[ 1 ].size( ) == 3 ) );
+
+    floatMatrix answer = { { 7, 8, 9 }, { 10, 11, 12 } };
+
+    matrixData.second = answer;
+
+    BOOST_CHECK( rowPointers[ 0 ] == matrixData.second[ 0 ].data( ) );
+
+    BOOST_CHECK( rowPointers[ 1 ] == matrixData.second[ 1 ].data( ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( matrixData.second, answer ) );
+
+    // Values of a different shape replace the retained rows
+    matrixData.clear( );
+
+    answer = { { 1 }, { 2 }, { 3 } };
+
+    matrixData.second = answer;
+
+    BOOST_CHECK( matrixData.second == answer );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_resetInteractionPairData ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            asp::dataStorage< int > interactionData1;
+        
+            asp::dataStorage< floatVector > interactionData2;
+    
+            asp::dataStorage< floatType > surfaceData1;
+    
+            asp::dataStorage< floatMatrix > surfaceData2;
+    
+            asp::dataStorage< std::unordered_map< int, floatType > > particleData1;
+
+            aspBaseMock( ){
+
+                interactionData1 = asp::dataStorage< int >( true, 1 );
+        
+                interactionData2 = asp::dataStorage< floatVector >( true, { 1, 2, 3 } );
+    
+                surfaceData1 = asp::dataStorage< floatType >( true, 2. );
+    
+                surfaceData2 = asp::dataStorage< floatMatrix >( true, { { 1, 2, 3 }, { 4, 5, 6 } } );
+    
+                particleData1 = asp::dataStorage< std::unordered_map< int, floatType > >( true, { { 1, 1 }, { 2, 3 } } );
+
+                addInteractionPairData( &interactionData1 );
+
+                addInteractionPairData( &interactionData2 );
+
+                addSurfacePointData( &surfaceData1 );
+
+                addSurfacePointData( &surfaceData2 );
+
+                addLocalParticleData( &particleData1 );
+
+            }
+
+    };
+
+    aspBaseMock asp;
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 2 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 2 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 1 );
+
+    asp::unit_test::aspBaseTester::resetInteractionPairData( asp );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 0 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 2 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 1 );
+
+    BOOST_CHECK( !asp.interactionData1.first );
+
+    BOOST_CHECK( !asp.interactionData2.first );
+
+    BOOST_CHECK( asp.surfaceData1.first );
+
+    BOOST_CHECK( asp.surfaceData2.first );
+
+    BOOST_CHECK( asp.particleData1.first );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_resetSurfacePointData ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            asp::dataStorage< int > interactionData1;
+        
+            asp::dataStorage< floatVector > interactionData2;
+    
+            asp::dataStorage< floatType > surfaceData1;
+    
+            asp::dataStorage< floatMatrix > surfaceData2;
+    
+            asp::dataStorage< std::unordered_map< int, floatType > > particleData1;
+
+            aspBaseMock( ){
+
+                interactionData1 = asp::dataStorage< int >( true, 1 );
+        
+                interactionData2 = asp::dataStorage< floatVector >( true, { 1, 2, 3 } );
+    
+                surfaceData1 = asp::dataStorage< floatType >( true, 2. );
+    
+                surfaceData2 = asp::dataStorage< floatMatrix >( true, { { 1, 2, 3 }, { 4, 5, 6 } } );
+    
+                particleData1 = asp::dataStorage< std::unordered_map< int, floatType > >( true, { { 1, 1 }, { 2, 3 } } );
+
+                addInteractionPairData( &interactionData1 );
+
+                addInteractionPairData( &interactionData2 );
+
+                addSurfacePointData( &surfaceData1 );
+
+                addSurfacePointData( &surfaceData2 );
+
+                addLocalParticleData( &particleData1 );
+
+            }
+
+    };
+
+    aspBaseMock asp;
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 2 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 2 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 1 );
+
+    asp::unit_test::aspBaseTester::resetSurfacePointData( asp );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 0 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 0 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 1 );
+
+    BOOST_CHECK( !asp.interactionData1.first );
+
+    BOOST_CHECK( !asp.interactionData2.first );
+
+    BOOST_CHECK( !asp.surfaceData1.first );
+
+    BOOST_CHECK( !asp.surfaceData2.first );
+
+    BOOST_CHECK( asp.particleData1.first );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_resetLocalParticleData ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            asp::dataStorage< int > interactionData1;
+        
+            asp::dataStorage< floatVector > interactionData2;
+    
+            asp::dataStorage< floatType > surfaceData1;
+    
+            asp::dataStorage< floatMatrix > surfaceData2;
+    
+            asp::dataStorage< std::unordered_map< int, floatType > > particleData1;
+
+            aspBaseMock( ){
+
+                interactionData1 = asp::dataStorage< int >( true, 1 );
+        
+                interactionData2 = asp::dataStorage< floatVector >( true, { 1, 2, 3 } );
+    
+                surfaceData1 = asp::dataStorage< floatType >( true, 2. );
+    
+                surfaceData2 = asp::dataStorage< floatMatrix >( true, { { 1, 2, 3 }, { 4, 5, 6 } } );
+    
+                particleData1 = asp::dataStorage< std::unordered_map< int, floatType > >( true, { { 1, 1 }, { 2, 3 } } );
+
+                addInteractionPairData( &interactionData1 );
+
+                addInteractionPairData( &interactionData2 );
+
+                addSurfacePointData( &surfaceData1 );
+
+                addSurfacePointData( &surfaceData2 );
+
+                addLocalParticleData( &particleData1 );
+
+            }
+
+    };
+
+    aspBaseMock asp;
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 2 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 2 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 1 );
+
+    asp::unit_test::aspBaseTester::resetLocalParticleData( asp );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getInteractionPairData( asp ).size( ) == 0 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getSurfacePointData( asp ).size( ) == 0 );
+
+    BOOST_CHECK( asp::unit_test::aspBaseTester::getLocalParticleData( asp ).size( ) == 0 );
+
+    BOOST_CHECK( !asp.interactionData1.first );
+
+    BOOST_CHECK( !asp.interactionData2.first );
+
+    BOOST_CHECK( !asp.surfaceData1.first );
+
+    BOOST_CHECK( !asp.surfaceData2.first );
+
+    BOOST_CHECK( !asp.particleData1.first );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getNumLocalParticles ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkNumLocalParticles( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousTime ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkPreviousTime( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getDeltaTime ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkDeltaTime( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousTemperature ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkPreviousTemperature( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getTemperature ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkTemperature( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getDeformationGradient ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkDeformationGradient( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousDeformationGradient ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkPreviousDeformationGradient( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousMicroDeformation ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkPreviousMicroDeformation( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousStateVariables ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkPreviousStateVariables( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getPreviousLocalStateVariables ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkPreviousLocalStateVariables( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getParticleParameters ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkParticleParameters( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalIndex ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkLocalIndex( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getNonLocalIndex ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkNonLocalIndex( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalSurfaceNodeIndex ){
+
+    asp::aspBase asp;
+
+    asp::unit_test::aspBaseTester::checkLocalSurfaceNodeIndex( asp );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleEnergy ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            floatType volume = 2.4;
+    
+            floatType energyDensity = 3.5;
+    
+            floatVector stress = { 1, 2, 3 };
+    
+            floatVector stateVariables = { -1, -2 };
+    
+            floatType probabilityRatio = .34;
+
+        private:
+
+            void setLocalParticleCurrentVolume( ){
+    
+                asp::unit_test::aspBaseTester::set_localParticleCurrentVolume( *this, volume );
+    
+            }
+
+            void setLocalParticleQuantities( ){
+    
+                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, energyDensity );
+
+                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, stress );
+
+                asp::unit_test::aspBaseTester::set_localParticleStateVariables( *this, stateVariables );
+
+                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, probabilityRatio );
+    
+            }
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    floatType answer = 8.4;
+
+    asp::dataStorage< floatType > result;
+
+    asp::unit_test::aspBaseTester::setLocalParticleEnergy( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleEnergy( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleEnergyDensity ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            floatType volume = 2.4;
+    
+            floatType energyDensity = 3.5;
+
+            floatVector stress = { 1, 2, 3 };
+    
+            floatVector stateVariables = { -1, -2 };
+    
+            floatType probabilityRatio = .34;
+
+        private:
+
+            void setLocalParticleQuantities( ){
+    
+                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, energyDensity );
+    
+                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, stress );
+
+                asp::unit_test::aspBaseTester::set_localParticleStateVariables( *this, stateVariables );
+
+                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, probabilityRatio );
+    
+            }
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    floatType answer = asp.energyDensity;
+
+    asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( asp, asp.energyDensity );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleEnergyDensity( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleLogProbabilityRatio ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            floatType volume = 2.4;
+    
+            floatType energyDensity = 3.5;
+
+            floatVector stress = { 1, 2, 3 };
+    
+            floatVector stateVariables = { -1, -2 };
+    
+            floatType probabilityRatio = .34;
+
+        private:
+
+            void setLocalParticleQuantities( ){
+    
+                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, energyDensity );
+    
+                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, stress );
+
+                asp::unit_test::aspBaseTester::set_localParticleStateVariables( *this, stateVariables );
+
+                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, probabilityRatio );
+    
+            }
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    floatType answer = asp.probabilityRatio;
+
+    asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( asp, asp.probabilityRatio );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleLogProbabilityRatio( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setLocalParticleQuantities ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        private:
+
+            virtual void computeLocalParticleEnergyDensity( const floatType &previousTime, const floatType &deltaTime,
+                                                            const floatVector &currentMicroDeformation, const floatVector &previousMicroDeformation,
+                                                            const floatType &currentTemperature, const floatType &previousTemperature,
+                                                            const floatVector &previousStateVariables,
+                                                            const floatVector &parameters,
+                                                            floatType &energyDensity, floatVector &cauchyStress, floatVector &stateVariables, floatType &logProbabilityRatio ){
+
+                energyDensity = 1.2;
+
+                cauchyStress = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+                stateVariables = { -1, -2 };
+
+                logProbabilityRatio = 0.47;
+
+                return;
+
+            }
+
+    };
+
+    aspBaseMock asp, aspGet1, aspGet2, aspGet3, aspGet4;
+
+    floatType energyDensityAnswer = 1.2;
+
+    floatVector cauchyStressAnswer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    floatVector stateVariablesAnswer = { -1, -2 };
+
+    floatType logProbabilityRatioAnswer = 0.47;
+
+    asp::dataStorage< floatType > energyDensityResult;
+
+    asp::dataStorage< floatVector > cauchyStressResult;
+
+    asp::dataStorage< floatVector > stateVariableResult;
+
+    asp::dataStorage< floatType > logProbabilityRatioResult;
+
+    asp::unit_test::aspBaseTester::setLocalParticleQuantities( asp, energyDensityResult, cauchyStressResult, stateVariableResult, logProbabilityRatioResult );
+
+    BOOST_CHECK( energyDensityResult.first );
+
+    BOOST_CHECK( cauchyStressResult.first );
+
+    BOOST_CHECK( stateVariableResult.first );
+
+    BOOST_CHECK( logProbabilityRatioResult.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( energyDensityResult.second, energyDensityAnswer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( cauchyStressResult.second, cauchyStressAnswer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( stateVariableResult.second, stateVariablesAnswer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( logProbabilityRatioResult.second, logProbabilityRatioAnswer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet1.getLocalParticleEnergyDensity( ), energyDensityAnswer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet2.getLocalParticleMicroCauchyStress( ), cauchyStressAnswer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet3.getLocalParticleStateVariables( ), stateVariablesAnswer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet4.getLocalParticleLogProbabilityRatio( ), logProbabilityRatioAnswer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleReferenceVolume ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        floatType radius = 2.4;
+
+        private:
+
+            void setLocalReferenceRadius( ){
+    
+                asp::unit_test::aspBaseTester::set_localReferenceRadius( *this, radius );
+    
+            }
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    floatType answer = 57.90583579096705;
+
+    asp::dataStorage< floatType > result;
+
+    asp::unit_test::aspBaseTester::setLocalParticleReferenceVolume( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleReferenceVolume( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_getLocalParticleCurrentVolume ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        floatType referenceVolume = 2.4;
+
+        floatVector microDeformation = { 1, 2, 3, 4, 5, 6, 7, 8, 2 };
+
+        private:
+
+            void setLocalParticleReferenceVolume( ){
+    
+                asp::unit_test::aspBaseTester::set_localParticleReferenceVolume( *this, referenceVolume );
+    
+            }
+
+            void setLocalMicroDeformation( ){
+    
+                asp::unit_test::aspBaseTester::set_localMicroDeformation( *this, microDeformation );
+    
+            }
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    floatType answer = 50.39999999999997;
+
+    asp::dataStorage< floatType > result;
+
+    asp::unit_test::aspBaseTester::setLocalParticleCurrentVolume( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleCurrentVolume( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setLocalParticleParameters ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        floatVector particleParameters = { 1, 2, 3 };
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    floatVector answer = { 1, 2, 3 };
+
+    asp::dataStorage< floatVector > result;
+
+    asp::unit_test::aspBaseTester::set_particleParameters( asp, answer );
+
+    asp::unit_test::aspBaseTester::set_particleParameters( aspGet, answer );
+
+    asp::unit_test::aspBaseTester::setLocalParticleParameters( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getLocalParticleParameters( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_assembleLocalParticle ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            unsigned int numLocalParticles = 4;
+    
+            floatVector energies = { 1, 2, 3, 4 };
+
+            floatVector energyDensities = { 10, 20, 30, 40 };
+    
+            floatMatrix microCauchyStresses = { { 1, 2, 3 }, { 4, 5 }, { 6, 7, 8 }, { 9, 10, 11, 12 } };
+    
+            floatVector localParticleVolumes = { 0.1, 0.2, 0.3, 0.4 };
+    
+            floatVector probabilityRatios = { -0.2, -0.3, -0.4, -0.5 };
+    
+            aspBaseMock( ) : aspBase( ){
+    
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+    
+            }
+
+        private:
+
+            virtual void setLocalParticleEnergy( ){
+
+                const unsigned int* localIndex = getLocalIndex( );
+
+                asp::unit_test::aspBaseTester::set_localParticleEnergy( *this, energies[ *localIndex ] );
+
+            }
+
+            virtual void setLocalParticleQuantities( ){
+    
+                const unsigned int* localIndex = getLocalIndex( );
+    
+                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, energies[ *localIndex ] );
+
+                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, microCauchyStresses[ *localIndex ] );
+    
+                asp::unit_test::aspBaseTester::set_localParticleCurrentVolume( *this, localParticleVolumes[ *localIndex ] );
+    
+                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, probabilityRatios[ *localIndex ] );
+    
+            }
+
+    };
+
+    aspBaseMock asp1, asp2, asp3, asp4;
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp1.getAssembledLocalParticleEnergies( ), asp1.energies ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp2.getAssembledLocalParticleMicroCauchyStresses( ), asp2.microCauchyStresses ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp3.getAssembledLocalParticleVolumes( ), asp3.localParticleVolumes ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp4.getAssembledLocalParticleLogProbabilityRatios( ), asp4.probabilityRatios ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_counterRandomStream ){
+    /*!
+     * Test the counter-based random streams
+     */
+
+    asp::counterRandomStream stream1( 12, 3 ), stream2( 12, 3 ), stream3( 12, 4 ), stream4( 13, 3 );
+
+    std::vector< uint64_t > values1, values2;
+
+    for ( unsigned int i = 0; i < 10; i++ ){
+
+        values1.push_back( stream1( ) );
+
+    }
+
+    // Values may be accessed directly and in any order
+    for ( unsigned int i = 10; i > 0; i-- ){
+
+        values2.insert( values2.begin( ), stream2.at( i - 1 ) );
+
+    }
+
+    BOOST_CHECK( values1 == values2 );
+
+    BOOST_CHECK( *stream1.getCounter( ) == 10 );
+
+    BOOST_CHECK( *stream2.getCounter( ) == 0 );
+
+    BOOST_CHECK( stream3.at( 0 ) != values1[ 0 ] );
+
+    BOOST_CHECK( stream4.at( 0 ) != values1[ 0 ] );
+
+    for ( unsigned int i = 0; i < 100; i++ ){
+
+        floatType value = stream3.uniform( );
+
+        BOOST_CHECK( ( value >= 0 ) && ( value < 1 ) );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_evaluateEnsemble ){
+    /*!
+     * Test the evaluation of an ensemble of independent realizations
+     */
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            floatVector energies;
+
+            floatMatrix microCauchyStresses;
+
+            floatVector probabilityRatios;
+
+            aspBaseMock( const unsigned int &numLocalParticles, const unsigned int &stressSize, asp::counterRandomStream &stream ) : aspBase( ){
+
+                unsigned int numParticles = numLocalParticles;
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numParticles );
+
+                for ( unsigned int i = 0; i < numLocalParticles; i++ ){
+
+                    energies.push_back( stream.uniform( ) );
+
+                    floatVector stress( stressSize );
+
+                    for ( auto s = stress.begin( ); s != stress.end( ); s++ ){
+
+                        *s = stream.uniform( );
+
+                    }
+
+                    microCauchyStresses.push_back( stress );
+
+                    probabilityRatios.push_back( -stream.uniform( ) );
+
+                }
+
+            }
+
+        private:
+
+            virtual void setLocalParticleEnergy( ){
+
+                const unsigned int* localIndex = getLocalIndex( );
+
+                asp::unit_test::aspBaseTester::set_localParticleEnergy( *this, energies[ *localIndex ] );
+
+            }
+
+            virtual void setLocalParticleQuantities( ){
+
+                const unsigned int* localIndex = getLocalIndex( );
+
+                floatType one = 1;
+
+                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, energies[ *localIndex ] );
+
+                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, microCauchyStresses[ *localIndex ] );
+
+                asp::unit_test::aspBaseTester::set_localParticleCurrentVolume( *this, one );
+
+                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, probabilityRatios[ *localIndex ] );
+
+            }
+
+    };
+
+    const unsigned int numRealizations = 7;
+
+    asp::realizationFactory factory = [ ]( const unsigned int &realization, asp::counterRandomStream &stream ){
+
+        return std::unique_ptr< asp::aspBase >( new aspBaseMock( 3, 9, stream ) );
+
+    };
+
+    asp::ensembleResults serial, parallel;
+
+    asp::evaluateEnsemble( numRealizations, factory, 1234, serial );
+
+    BOOST_CHECK( serial.numRealizations == numRealizations );
+
+    BOOST_CHECK( serial.numLocalParticles == 3 );
+
+    BOOST_CHECK( serial.stressSize == 9 );
+
+    BOOST_CHECK( serial.values.size( ) == numRealizations * 3 * 11 );
+
+    for ( unsigned int r = 0; r < numRealizations; r++ ){
+
+        asp::counterRandomStream stream( 1234, r );
+
+        aspBaseMock answer( 3, 9, stream );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( serial.getEnergies( r ), serial.getEnergies( r ) + 3 ), answer.energies ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( serial.getMicroCauchyStresses( r ), serial.getMicroCauchyStresses( r ) + 27 ), vectorTools::appendVectors( answer.microCauchyStresses ) ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( serial.getLogProbabilityRatios( r ), serial.getLogProbabilityRatios( r ) + 3 ), answer.probabilityRatios ) );
+
+    }
+
+    // The results do not depend on the number of threads
+    asp::evaluateEnsemble( numRealizations, factory, 1234, parallel, 4 );
+
+    BOOST_CHECK( parallel.values == serial.values );
+
+    // Realizations must share the layout of the first realization
+    asp::realizationFactory inconsistentFactory = [ ]( const unsigned int &realization, asp::counterRandomStream &stream ){
+
+        return std::unique_ptr< asp::aspBase >( new aspBaseMock( 3, ( realization == 5 ) ? 6 : 9, stream ) );
+
+    };
+
+    BOOST_CHECK_THROW( asp::evaluateEnsemble( numRealizations, inconsistentFactory, 1234, parallel, 4 ), std::exception );
+
+    // A realization with a different number of local particles is rejected before it writes into the other realizations
+    asp::realizationFactory oversizedFactory = [ ]( const unsigned int &realization, asp::counterRandomStream &stream ){
+
+        return std::unique_ptr< asp::aspBase >( new aspBaseMock( ( realization == 5 ) ? 4 : 3, 9, stream ) );
+
+    };
+
+    BOOST_CHECK_THROW( asp::evaluateEnsemble( numRealizations, oversizedFactory, 1234, parallel ), std::exception );
+
+    BOOST_CHECK( parallel.values.size( ) == serial.values.size( ) );
+
+    BOOST_CHECK( floatVector( parallel.getEnergies( 6 ), parallel.getEnergies( 6 ) + 33 ) == floatVector( serial.getEnergies( 6 ), serial.getEnergies( 6 ) + 33 ) );
+
+    asp::evaluateEnsemble( 0, factory, 1234, parallel );
+
+    BOOST_CHECK( parallel.values.size( ) == 0 );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setSurfaceAdhesionThickness ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            floatVector normalVector = { 1, 2, 3 };
+
+            floatVector distanceVector = { 4, 5, 6 };
+
+            aspBaseMock( ){
+
+                normalVector /= vectorTools::l2norm( normalVector );
+
+            }
+
+        private:
+
+            virtual void setCurrentDistanceVector( ){
+
+                asp::unit_test::aspBaseTester::set_currentDistanceVector( *this, distanceVector );
+
+            }
+
+            virtual void setLocalCurrentNormal( ){
+
+                asp::unit_test::aspBaseTester::set_localCurrentNormal( *this, normalVector );
+
+            }
+
+    };
+
+    aspBaseMock asp, aspGet;
+
+    floatType answer = std::fabs( vectorTools::dot( asp.normalVector, asp.distanceVector ) );
+
+    asp::dataStorage< floatType > result;
+
+    asp::unit_test::aspBaseTester::setSurfaceAdhesionThickness( asp, result );
+
+    BOOST_CHECK( result.first );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( result.second, answer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspGet.getSurfaceAdhesionThickness( ), answer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_assembleSurfaceEnergies ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            unsigned int numLocalParticles = 4;
+
+            unsigned int numSurfacePoints = 2;
+
+            floatVector unitSpherePoints = { 1, 2, 3, 4, 5, 6 };
+
+            std::vector< unsigned int > unitSphereConnectivity = { 10, 11, 12, 13 };
+
+            std::vector< std::vector< std::vector< std::vector< unsigned int > > > > neighboringOverlapParticles
+                {
+                    {
+                        {
+                            { 1, 7 },
+                            { 0, },
+                            { },
+                            { 13, 8, 17},
+                        },
+                        {
+                            { 11, 4 },
+                            { 9, 34 },
+                            { 10 },
+                            { 8, 9, 10, 11},
+                        },
+                    },
+                    {
+                        {
+                            { 8, 13},
+                            { 2 },
+                            { 0, 1, 2 },
                             { 13 },
                         },
                         {
@@ -5282,322 +7191,2264 @@ BOOST_AUTO_TEST_CASE( test_aspBase_assembleSurfaceEnergies ){
                     },
                 };
 
-            std::vector< std::vector< floatVector > > adhesionEnergyDensities =
-                {
-                    {
-                        {
-                            1, 2, 3, 4
-                        },
-                        {
-                            5, 6, 7, 8
-                        },
-                    },
-                    {
-                        {
-                            9, 10, 11, 12
-                        },
-                        {
-                            13, 14, 15, 16
-                        },
-                    },
-                    {
-                        {
-                            17, 18, 19, 20
-                        },
-                        {
-                            21, 22, 23, 24
-                        },
-                    },
-                    {
-                        {
-                            25, 26, 27, 28
-                        },
-                        {
-                            29, 30, 31, 32
-                        },
-                    },
-                };
+            std::vector< std::vector< floatVector > > adhesionEnergyDensities =
+                {
+                    {
+                        {
+                            1, 2, 3, 4
+                        },
+                        {
+                            5, 6, 7, 8
+                        },
+                    },
+                    {
+                        {
+                            9, 10, 11, 12
+                        },
+                        {
+                            13, 14, 15, 16
+                        },
+                    },
+                    {
+                        {
+                            17, 18, 19, 20
+                        },
+                        {
+                            21, 22, 23, 24
+                        },
+                    },
+                    {
+                        {
+                            25, 26, 27, 28
+                        },
+                        {
+                            29, 30, 31, 32
+                        },
+                    },
+                };
+
+            std::vector< std::vector< floatVector > > adhesionThicknesses =
+            {
+                {
+                    {
+                        33, 34, 35, 36
+                    },
+                    {
+                        37, 38, 39, 40
+                    },
+                },
+                {
+                    {
+                        41, 42, 43, 44
+                    },
+                    {
+                        45, 46, 47, 48
+                    },
+                },
+                {
+                    {
+                        49, 50, 51, 52
+                    },
+                    {
+                        53, 54, 55, 56
+                    },
+                },
+                {
+                    {
+                        57, 58, 59, 60
+                    },
+                    {
+                        61, 62, 63, 64
+                    },
+                },
+            };
+
+            std::vector< std::vector< floatMatrix > > adhesionTractions =
+            {
+                {
+                    {
+                        {  1,  2,  3 },
+                        {  4,  5,  6 },
+                        {  7,  8,  9 },
+                        { 10, 11, 12 },
+                    },
+                    {
+                        { 13, 14, 15 },
+                        { 16, 17, 18 },
+                        { 19, 20, 21 },
+                        { 22, 23, 24 },
+                    },
+                },
+                {
+                    {
+                        { 25, 26, 27 },
+                        { 28, 29, 30 },
+                        { 31, 32, 33 },
+                        { 34, 35, 36 },
+                    },
+                    {
+                        { 37, 38, 39 },
+                        { 40, 41, 42 },
+                        { 43, 44, 45 },
+                        { 46, 47, 48 },
+                    },
+                },
+                {
+                    {
+                        { 49, 50, 51 },
+                        { 52, 53, 54 },
+                        { 55, 56, 57 },
+                        { 58, 59, 60 },
+                    },
+                    {
+                        { 61, 62, 63 },
+                        { 64, 65, 66 },
+                        { 67, 68, 69 },
+                        { 70, 71, 72 },
+                    },
+                },
+                {
+                    {
+                        { 73, 74, 75 },
+                        { 76, 77, 78 },
+                        { 79, 80, 81 },
+                        { 82, 83, 84 },
+                    },
+                    {
+                        { 85, 86, 87 },
+                        { 88, 89, 90 },
+                        { 91, 92, 93 },
+                        { 94, 95, 96 },
+                    },
+                },
+            };
+
+            std::vector< std::vector< std::vector< asp::mapFloatType > > > overlapEnergyDensities;
+
+            std::vector< std::vector< std::vector< asp::mapFloatType > > > overlapThicknesses;
+
+            std::vector< std::vector< std::vector< asp::mapFloatVector > > > overlapTractions;
+    
+            aspBaseMock( ) : aspBase( ){
+    
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+   
+                initializeOverlapQuantitiesTest( );
+ 
+            }
+
+        private:
+
+            void initializeOverlapQuantitiesTest( ){
+
+                overlapEnergyDensities.resize( numLocalParticles );
+
+                overlapThicknesses.resize( numLocalParticles );
+
+                overlapTractions.resize( numLocalParticles );
+
+                for ( unsigned int i = 0; i < numLocalParticles; i++ ){
+
+                    overlapEnergyDensities[ i ].resize( numSurfacePoints );
+    
+                    overlapThicknesses[ i ].resize( numSurfacePoints );
+    
+                    overlapTractions[ i ].resize( numSurfacePoints );
+
+                    for ( unsigned int j = 0; j < numSurfacePoints; j++ ){
+
+                        overlapEnergyDensities[ i ][ j ].resize( numLocalParticles );
+
+                        overlapThicknesses[ i ][ j ].resize( numLocalParticles );
+
+                        overlapTractions[ i ][ j ].resize( numLocalParticles );
+
+                        for ( unsigned int k = 0; k < numLocalParticles; k++ ){
+
+                            for ( auto index = neighboringOverlapParticles[ i ][ j ][ k ].begin( );
+                                       index != neighboringOverlapParticles[ i ][ j ][ k ].end( ); index++ ){
+
+                                overlapEnergyDensities[ i ][ j ][ k ].emplace( *index, adhesionEnergyDensities[ i ][ j ][ k ] * ( *index ) * .142 );
+
+                                overlapThicknesses[ i ][ j ][ k ].emplace( *index, adhesionThicknesses[ i ][ j ][ k ] * ( ( *index ) - 3 ) * .89 );
+
+                                overlapTractions[ i ][ j ][ k ].emplace( *index, adhesionTractions[ i ][ j ][ k ] * ( ( *index ) - .78 ) * .09 );
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+            virtual void initializeUnitSphere( ){
+
+                asp::unit_test::aspBaseTester::set_unitSphere( *this, unitSpherePoints, unitSphereConnectivity );
+
+            }
+
+            virtual void setSurfaceAdhesionEnergyDensity( ){
+    
+                const unsigned int* localIndex = getLocalIndex( );
+
+                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+
+                const unsigned int* nonLocalIndex = getNonLocalIndex( );
+    
+                asp::unit_test::aspBaseTester::set_surfaceAdhesionEnergyDensity( *this, adhesionEnergyDensities[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
+    
+            }
+
+            virtual void setSurfaceAdhesionTraction( ){
+    
+                const unsigned int* localIndex = getLocalIndex( );
+
+                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+
+                const unsigned int* nonLocalIndex = getNonLocalIndex( );
+    
+                asp::unit_test::aspBaseTester::set_surfaceAdhesionTraction( *this, adhesionTractions[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
+    
+            }
+
+            virtual void setSurfaceAdhesionThickness( ){
+    
+                const unsigned int* localIndex = getLocalIndex( );
+
+                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+
+                const unsigned int* nonLocalIndex = getNonLocalIndex( );
+    
+                asp::unit_test::aspBaseTester::set_surfaceAdhesionThickness( *this, adhesionThicknesses[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
+    
+            }
+
+            virtual void setSurfaceOverlapEnergyDensity( ){
+    
+                const unsigned int* localIndex = getLocalIndex( );
+
+                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+
+                const unsigned int* nonLocalIndex = getNonLocalIndex( );
+    
+                asp::unit_test::aspBaseTester::set_surfaceOverlapEnergyDensity( *this, overlapEnergyDensities[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
+    
+            }
+
+            virtual void setSurfaceOverlapTraction( ){
+    
+                const unsigned int* localIndex = getLocalIndex( );
+
+                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+
+                const unsigned int* nonLocalIndex = getNonLocalIndex( );
+    
+                asp::unit_test::aspBaseTester::set_surfaceOverlapTraction( *this, overlapTractions[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
+    
+            }
+
+            virtual void setSurfaceOverlapThickness( ){
+    
+                const unsigned int* localIndex = getLocalIndex( );
+
+                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+
+                const unsigned int* nonLocalIndex = getNonLocalIndex( );
+    
+                asp::unit_test::aspBaseTester::set_surfaceOverlapThickness( *this, overlapThicknesses[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
+    
+            }
+
+    };
+
+    aspBaseMock asp1, asp2, asp3, asp4, asp5, asp6;
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp1.getAssembledSurfaceAdhesionEnergyDensities( ), asp1.adhesionEnergyDensities ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp2.getAssembledSurfaceAdhesionTractions( ), asp2.adhesionTractions ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp3.getAssembledSurfaceAdhesionThicknesses( ), asp3.adhesionThicknesses ) );
+
+    for ( unsigned int i = 0; i < asp1.numLocalParticles; i++ ){
+
+        for ( unsigned int j = 0; j < asp1.numSurfacePoints; j++ ){
+
+            for ( unsigned int k = 0; k < asp1.numLocalParticles; k++ ){
+
+                for ( auto index = asp1.neighboringOverlapParticles[ i ][ j ][ k ].begin( );
+                           index != asp1.neighboringOverlapParticles[ i ][ j ][ k ].end( );
+                           index++ ){
+
+                    auto energy    = ( *asp4.getAssembledSurfaceOverlapEnergyDensities( ) )[ i ][ j ][ k ].find( *index );
+
+                    auto thickness = ( *asp5.getAssembledSurfaceOverlapThicknesses( ) )[ i ][ j ][ k ].find( *index );
+
+                    auto traction  = ( *asp6.getAssembledSurfaceOverlapTractions( ) )[ i ][ j ][ k ].find( *index );
+
+                    BOOST_CHECK( energy != ( *asp4.getAssembledSurfaceOverlapEnergyDensities( ) )[ i ][ j ][ k ].end( ) );
+
+                    BOOST_CHECK( thickness != ( *asp5.getAssembledSurfaceOverlapThicknesses( ) )[ i ][ j ][ k ].end( ) );
+
+                    BOOST_CHECK( traction != ( *asp6.getAssembledSurfaceOverlapTractions( ) )[ i ][ j ][ k ].end( ) );
+
+                    BOOST_CHECK( vectorTools::fuzzyEquals( energy->second, asp4.overlapEnergyDensities[ i ][ j ][ k ][ *index ] ) );
+
+                    BOOST_CHECK( vectorTools::fuzzyEquals( thickness->second, asp5.overlapThicknesses[ i ][ j ][ k ][ *index ] ) );
+
+                    BOOST_CHECK( vectorTools::fuzzyEquals( traction->second, asp6.overlapTractions[ i ][ j ][ k ][ *index ] ) );
+
+                }
+
+            }
+
+        }
+
+    }
+
+}
+
+
+BOOST_AUTO_TEST_CASE( test_aspBase_assembleSurfaceResponsesNeighbors ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            unsigned int numLocalParticles = 3;
+
+            floatVector unitSpherePoints = { 1, 2, 3, 4, 5, 6 };
+
+            std::vector< unsigned int > unitSphereConnectivity = { 10, 11, 12, 13 };
+
+            std::vector< std::vector< unsigned int > > neighbors = { { 0, 2 }, { 1 }, { 0, 2 } };
+
+            std::vector< std::vector< unsigned int > > visitedPairs;
+
+            aspBaseMock( ) : aspBase( ){
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+            }
+
+        private:
+
+            virtual void initializeUnitSphere( ){
+
+                asp::unit_test::aspBaseTester::set_unitSphere( *this, unitSpherePoints, unitSphereConnectivity );
+
+            }
+
+            virtual void setLocalParticleNeighbors( ){
+
+                asp::unit_test::aspBaseTester::set_localParticleNeighbors( *this, neighbors );
+
+            }
+
+            virtual void setSurfaceAdhesionEnergyDensity( ){
+
+                visitedPairs.push_back( { *getLocalIndex( ), *getLocalSurfaceNodeIndex( ), *getNonLocalIndex( ) } );
+
+                floatType value = 1 + *getLocalIndex( ) + 10 * ( *getLocalSurfaceNodeIndex( ) ) + 100 * ( *getNonLocalIndex( ) );
+
+                asp::unit_test::aspBaseTester::set_surfaceAdhesionEnergyDensity( *this, value );
+
+            }
+
+            virtual void setSurfaceAdhesionTraction( ){
+
+                floatVector value = { 1, 2, 3 };
+
+                asp::unit_test::aspBaseTester::set_surfaceAdhesionTraction( *this, value );
+
+            }
+
+            virtual void setSurfaceAdhesionThickness( ){
+
+                floatType value = 1;
+
+                asp::unit_test::aspBaseTester::set_surfaceAdhesionThickness( *this, value );
+
+            }
+
+            virtual void setSurfaceOverlapEnergyDensity( ){
+
+                asp::mapFloatType value;
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapEnergyDensity( *this, value );
+
+            }
+
+            virtual void setSurfaceOverlapTraction( ){
+
+                asp::mapFloatVector value;
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapTraction( *this, value );
+
+            }
+
+            virtual void setSurfaceOverlapThickness( ){
+
+                asp::mapFloatType value;
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapThickness( *this, value );
+
+            }
+
+    };
+
+    aspBaseMock asp;
+
+    std::vector< std::vector< floatVector > > answer =
+        {
+            { {   1, 0, 201 }, {  11, 0, 211 } },
+            { {   0, 102, 0 }, {   0, 112, 0 } },
+            { {   3, 0, 203 }, {  13, 0, 213 } },
+        };
+
+    std::vector< std::vector< unsigned int > > visitedAnswer =
+        {
+            { 0, 0, 0 }, { 0, 0, 2 }, { 0, 1, 0 }, { 0, 1, 2 },
+            { 1, 0, 1 }, { 1, 1, 1 },
+            { 2, 0, 0 }, { 2, 0, 2 }, { 2, 1, 0 }, { 2, 1, 2 },
+        };
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getAssembledSurfaceAdhesionEnergyDensities( ), answer ) );
+
+    BOOST_CHECK( asp.visitedPairs == visitedAnswer );
+
+    BOOST_CHECK( ( *asp.getAssembledSurfaceAdhesionTractions( ) )[ 0 ][ 0 ][ 1 ].size( ) == 0 );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( ( *asp.getAssembledSurfaceAdhesionTractions( ) )[ 0 ][ 0 ][ 2 ], floatVector( { 1, 2, 3 } ) ) );
+
+    const asp::sparseSurfaceResponse *sparse = asp.getAssembledSparseSurfaceAdhesionEnergyDensities( );
+
+    BOOST_CHECK( sparse->getNumPairs( ) == visitedAnswer.size( ) );
+
+    unsigned int pair;
+
+    BOOST_CHECK( sparse->findPair( 2, 1, 2, pair ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( sparse->values[ sparse->entryOffsets[ pair ] ], 213. ) );
+
+    BOOST_CHECK( !sparse->findPair( 2, 1, 1, pair ) );
+
+    BOOST_CHECK( asp.getAssembledSparseSurfaceOverlapTractions( )->getNumEntries( ) == 0 );
+
+    // The tractions are not assembled in the energy mode
+    aspBaseMock aspEnergy;
+
+    aspEnergy.setEvaluationMode( asp::ENERGY );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *aspEnergy.getAssembledSurfaceAdhesionEnergyDensities( ), answer ) );
+
+    BOOST_CHECK( aspEnergy.getAssembledSparseSurfaceAdhesionThicknesses( )->getNumPairs( ) == visitedAnswer.size( ) );
+
+    BOOST_CHECK( aspEnergy.getAssembledSparseSurfaceAdhesionTractions( )->getNumPairs( ) == 0 );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_flatMap ){
+    /*!
+     * Test the flat map used for the surface overlap quantities
+     */
+
+    asp::mapFloatType scalarMap = { { 7, 0.5 }, { 2, 1.5 }, { 7, 2.5 } };
+
+    BOOST_CHECK( scalarMap.size( ) == 2 );
+
+    BOOST_CHECK( scalarMap.begin( )->first == 2 );
+
+    BOOST_CHECK( ( scalarMap.begin( ) + 1 )->first == 7 );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( scalarMap.at( 7 ), 0.5 ) );
+
+    BOOST_CHECK( scalarMap.find( 3 ) == scalarMap.end( ) );
+
+    BOOST_CHECK( scalarMap.count( 2 ) == 1 );
+
+    BOOST_CHECK( scalarMap.count( 3 ) == 0 );
+
+    BOOST_CHECK_THROW( scalarMap.at( 3 ), std::out_of_range );
+
+    BOOST_CHECK( !scalarMap.insert( { 2, 4.5 } ).second );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( scalarMap[ 2 ], 1.5 ) );
+
+    scalarMap[ 4 ] = 3.5;
+
+    BOOST_CHECK( scalarMap.emplace( 0, 6.5 ).second );
+
+    std::vector< unsigned int > keyAnswer = { 0, 2, 4, 7 };
+
+    floatVector valueAnswer = { 6.5, 1.5, 3.5, 0.5 };
+
+    std::vector< unsigned int > keys;
+
+    floatVector values;
+
+    for ( auto v = scalarMap.begin( ); v != scalarMap.end( ); v++ ){
+
+        keys.push_back( v->first );
+
+        values.push_back( v->second );
+
+    }
+
+    BOOST_CHECK( keys == keyAnswer );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( values, valueAnswer ) );
+
+    BOOST_CHECK( scalarMap.erase( 4 ) == 1 );
+
+    BOOST_CHECK( scalarMap.erase( 4 ) == 0 );
+
+    BOOST_CHECK( scalarMap == asp::mapFloatType( { { 7, 0.5 }, { 0, 6.5 }, { 2, 1.5 } } ) );
+
+    asp::mapFloatVector vectorMap;
+
+    vectorMap.emplace( 3, floatVector( { 1, 2, 3 } ) );
+
+    vectorMap.insert( { 1, { 4, 5, 6 } } );
+
+    BOOST_CHECK( vectorMap.begin( )->first == 1 );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( vectorMap.find( 3 )->second, floatVector( { 1, 2, 3 } ) ) );
+
+    vectorMap.clear( );
+
+    BOOST_CHECK( vectorMap.empty( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_sparseSurfaceResponse ){
+
+    asp::sparseSurfaceResponse scalar, vector, mapScalar, mapVector;
+
+    // Two local particles with two surface points each
+    scalar.initialize( 2, 2, 1 );
+
+    vector.initialize( 2, 2, 3 );
+
+    mapScalar.initialize( 2, 2, 1 );
+
+    mapVector.initialize( 2, 2, 3 );
+
+    // Row ( 0, 0 )
+    scalar.appendPair( 0, 1. );
+    scalar.appendPair( 1, 2. );
+    vector.appendPair( 1, floatVector( { 1, 2, 3 } ) );
+    mapScalar.appendPair( 0, asp::mapFloatType( { { 7, 0.5 }, { 2, 1.5 } } ) );
+    mapVector.appendPair( 1, asp::mapFloatVector( { { 4, { 1, 2, 3 } }, { 3, { 4, 5, 6 } } } ) );
+
+    scalar.closeRow( );
+    vector.closeRow( );
+    mapScalar.closeRow( );
+    mapVector.closeRow( );
+
+    // Row ( 0, 1 ) is empty
+    scalar.closeRow( );
+    vector.closeRow( );
+    mapScalar.closeRow( );
+    mapVector.closeRow( );
+
+    // Row ( 1, 0 )
+    scalar.appendPair( 1, 3. );
+    vector.appendPair( 0, floatVector( { 4, 5, 6 } ) );
+    mapScalar.appendPair( 1, asp::mapFloatType( ) );
+    mapVector.appendPair( 0, asp::mapFloatVector( { { 0, { 7, 8, 9 } } } ) );
+
+    scalar.closeRow( );
+    vector.closeRow( );
+    mapScalar.closeRow( );
+    mapVector.closeRow( );
+
+    // Row ( 1, 1 ) is empty
+    scalar.closeRow( );
+    vector.closeRow( );
+    mapScalar.closeRow( );
+    mapVector.closeRow( );
+
+    BOOST_CHECK( scalar.rowOffsets == std::vector< unsigned int >( { 0, 2, 2, 3, 3 } ) );
+
+    BOOST_CHECK( scalar.nonLocalIndices == std::vector< unsigned int >( { 0, 1, 1 } ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( scalar.values, floatVector( { 1, 2, 3 } ) ) );
+
+    BOOST_CHECK( mapScalar.entryOffsets == std::vector< unsigned int >( { 0, 2, 2 } ) );
+
+    BOOST_CHECK( mapScalar.entryKeys == std::vector< unsigned int >( { 2, 7 } ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( mapScalar.values, floatVector( { 1.5, 0.5 } ) ) );
+
+    BOOST_CHECK( mapVector.entryKeys == std::vector< unsigned int >( { 3, 4, 0 } ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( mapVector.values, floatVector( { 4, 5, 6, 1, 2, 3, 7, 8, 9 } ) ) );
+
+    unsigned int pair;
+
+    BOOST_CHECK( scalar.findPair( 0, 0, 1, pair ) );
+
+    BOOST_CHECK( pair == 1 );
+
+    BOOST_CHECK( scalar.findPair( 1, 0, 1, pair ) );
+
+    BOOST_CHECK( pair == 2 );
+
+    BOOST_CHECK( !scalar.findPair( 0, 1, 0, pair ) );
+
+    BOOST_CHECK( !scalar.findPair( 2, 0, 0, pair ) );
+
+    std::vector< std::vector< floatVector > > scalarDense;
+
+    std::vector< std::vector< floatVector > > scalarAnswer = { { { 1, 2 }, { 0, 0 } }, { { 0, 3 }, { 0, 0 } } };
+
+    scalar.toDense( scalarDense );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( scalarDense, scalarAnswer ) );
+
+    std::vector< std::vector< floatMatrix > > vectorDense;
+
+    vector.toDense( vectorDense );
+
+    BOOST_CHECK( vectorDense[ 0 ][ 0 ][ 0 ].size( ) == 0 );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( vectorDense[ 0 ][ 0 ][ 1 ], floatVector( { 1, 2, 3 } ) ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( vectorDense[ 1 ][ 0 ][ 0 ], floatVector( { 4, 5, 6 } ) ) );
+
+    std::vector< std::vector< std::vector< asp::mapFloatType > > > mapScalarDense;
+
+    mapScalar.toDense( mapScalarDense );
+
+    BOOST_CHECK( mapScalarDense[ 0 ][ 0 ][ 0 ].size( ) == 2 );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( mapScalarDense[ 0 ][ 0 ][ 0 ][ 7 ], 0.5 ) );
+
+    BOOST_CHECK( mapScalarDense[ 1 ][ 0 ][ 1 ].size( ) == 0 );
+
+    std::vector< std::vector< std::vector< asp::mapFloatVector > > > mapVectorDense;
+
+    mapVector.toDense( mapVectorDense );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( mapVectorDense[ 0 ][ 0 ][ 1 ][ 3 ], floatVector( { 4, 5, 6 } ) ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( mapVectorDense[ 1 ][ 0 ][ 0 ][ 0 ], floatVector( { 7, 8, 9 } ) ) );
+
+    BOOST_CHECK_THROW( vector.appendPair( 0, floatVector( { 1, 2 } ) ), std::exception );
+
+    BOOST_CHECK_THROW( vector.appendPair( 0, 1. ), std::exception );
+
+    scalar.clear( );
+
+    BOOST_CHECK( scalar.getNumPairs( ) == 0 );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_parallelAssembleLocalParticles ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            unsigned int numLocalParticles = 7;
+
+            floatVector energies = { 1, 2, 3, 4, 5, 6, 7 };
+
+            floatMatrix microCauchyStresses = { { 1, 2, 3 }, { 4, 5 }, { 6, 7, 8 }, { 9, 10, 11, 12 }, { 13 }, { 14, 15 }, { 16, 17, 18 } };
+
+            floatVector localParticleVolumes = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7 };
+
+            floatVector probabilityRatios = { -0.2, -0.3, -0.4, -0.5, -0.6, -0.7, -0.8 };
+
+            aspBaseMock( ) : aspBase( ){
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+            }
+
+        private:
+
+            virtual std::unique_ptr< asp::aspBase > createAssemblyWorker( ) const{
+
+                return std::unique_ptr< asp::aspBase >( new aspBaseMock( *this ) );
+
+            }
+
+            virtual void setLocalParticleEnergy( ){
+
+                asp::unit_test::aspBaseTester::set_localParticleEnergy( *this, energies[ *getLocalIndex( ) ] );
+
+            }
+
+            virtual void setLocalParticleQuantities( ){
+
+                const unsigned int* localIndex = getLocalIndex( );
+
+                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, energies[ *localIndex ] );
+
+                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, microCauchyStresses[ *localIndex ] );
+
+                asp::unit_test::aspBaseTester::set_localParticleCurrentVolume( *this, localParticleVolumes[ *localIndex ] );
+
+                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, probabilityRatios[ *localIndex ] );
+
+            }
+
+    };
+
+    // More threads than particles should also be supported
+    std::vector< unsigned int > numThreads = { 2, 3, 16 };
+
+    for ( auto n = numThreads.begin( ); n != numThreads.end( ); n++ ){
+
+        aspBaseMock asp;
+
+        asp::unit_test::aspBaseTester::set_numAssemblyThreads( asp, *n );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getAssembledLocalParticleEnergies( ), asp.energies ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getAssembledLocalParticleMicroCauchyStresses( ), asp.microCauchyStresses ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getAssembledLocalParticleVolumes( ), asp.localParticleVolumes ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getAssembledLocalParticleLogProbabilityRatios( ), asp.probabilityRatios ) );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_parallelAssembleSurfaceResponses ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            unsigned int numLocalParticles = 5;
+
+            floatVector unitSpherePoints = { 1, 2, 3, 4, 5, 6 };
+
+            std::vector< unsigned int > unitSphereConnectivity = { 10, 11, 12, 13 };
+
+            std::vector< std::vector< unsigned int > > neighbors = { { 0, 2 }, { 1 }, { 0, 2, 4 }, { }, { 2, 3, 4 } };
+
+            bool useWorkers = true;
+
+            mutable bool workerHasAssembledStorage = false;
+
+            aspBaseMock( ) : aspBase( ){
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+            }
+
+        private:
+
+            floatType value( ){
+
+                return 1 + *getLocalIndex( ) + 10 * ( *getLocalSurfaceNodeIndex( ) ) + 100 * ( *getNonLocalIndex( ) );
+
+            }
+
+            virtual std::unique_ptr< asp::aspBase > createAssemblyWorker( ) const{
+
+                if ( useWorkers ){
+
+                    std::unique_ptr< asp::aspBase > worker( new aspBaseMock( *this ) );
+
+                    workerHasAssembledStorage = workerHasAssembledStorage || asp::unit_test::aspBaseTester::hasAssembledStorage( *worker );
+
+                    return worker;
+
+                }
+
+                return asp::aspBase::createAssemblyWorker( );
+
+            }
+
+            virtual void initializeUnitSphere( ){
+
+                asp::unit_test::aspBaseTester::set_unitSphere( *this, unitSpherePoints, unitSphereConnectivity );
+
+            }
+
+            virtual void setLocalParticleNeighbors( ){
+
+                asp::unit_test::aspBaseTester::set_localParticleNeighbors( *this, neighbors );
+
+            }
+
+            virtual void setSurfaceAdhesionEnergyDensity( ){
+
+                floatType result = value( );
+
+                asp::unit_test::aspBaseTester::set_surfaceAdhesionEnergyDensity( *this, result );
+
+            }
+
+            virtual void setSurfaceAdhesionTraction( ){
+
+                floatVector result = { value( ), 2 * value( ), 3 * value( ) };
+
+                asp::unit_test::aspBaseTester::set_surfaceAdhesionTraction( *this, result );
+
+            }
+
+            virtual void setSurfaceAdhesionThickness( ){
+
+                floatType result = -value( );
+
+                asp::unit_test::aspBaseTester::set_surfaceAdhesionThickness( *this, result );
+
+            }
+
+            virtual void setSurfaceOverlapEnergyDensity( ){
+
+                asp::mapFloatType result = { { *getNonLocalIndex( ), value( ) }, { 7, 0.5 * value( ) } };
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapEnergyDensity( *this, result );
+
+            }
+
+            virtual void setSurfaceOverlapTraction( ){
+
+                asp::mapFloatVector result = { { *getLocalSurfaceNodeIndex( ), { value( ), 0, -value( ) } } };
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapTraction( *this, result );
+
+            }
+
+            virtual void setSurfaceOverlapThickness( ){
+
+                asp::mapFloatType result;
+
+                if ( *getLocalIndex( ) == *getNonLocalIndex( ) ){
+
+                    result.emplace( 3, value( ) );
+
+                }
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapThickness( *this, result );
+
+            }
+
+    };
+
+    aspBaseMock serial;
+
+    std::vector< unsigned int > numThreads = { 2, 4, 8 };
+
+    for ( auto n = numThreads.begin( ); n != numThreads.end( ); n++ ){
+
+        aspBaseMock parallel;
+
+        asp::unit_test::aspBaseTester::set_numAssemblyThreads( parallel, *n );
+
+        std::vector< std::pair< const asp::sparseSurfaceResponse*, const asp::sparseSurfaceResponse* > > results =
+            {
+                { serial.getAssembledSparseSurfaceAdhesionEnergyDensities( ), parallel.getAssembledSparseSurfaceAdhesionEnergyDensities( ) },
+                { serial.getAssembledSparseSurfaceAdhesionTractions( ),       parallel.getAssembledSparseSurfaceAdhesionTractions( ) },
+                { serial.getAssembledSparseSurfaceAdhesionThicknesses( ),     parallel.getAssembledSparseSurfaceAdhesionThicknesses( ) },
+                { serial.getAssembledSparseSurfaceOverlapEnergyDensities( ),  parallel.getAssembledSparseSurfaceOverlapEnergyDensities( ) },
+                { serial.getAssembledSparseSurfaceOverlapTractions( ),        parallel.getAssembledSparseSurfaceOverlapTractions( ) },
+                { serial.getAssembledSparseSurfaceOverlapThicknesses( ),      parallel.getAssembledSparseSurfaceOverlapThicknesses( ) },
+            };
+
+        for ( auto r = results.begin( ); r != results.end( ); r++ ){
+
+            BOOST_CHECK( r->first->rowOffsets == r->second->rowOffsets );
+
+            BOOST_CHECK( r->first->nonLocalIndices == r->second->nonLocalIndices );
+
+            BOOST_CHECK( r->first->entryOffsets == r->second->entryOffsets );
+
+            BOOST_CHECK( r->first->entryKeys == r->second->entryKeys );
+
+            BOOST_CHECK( vectorTools::fuzzyEquals( r->first->values, r->second->values ) );
+
+        }
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( *serial.getAssembledSurfaceAdhesionTractions( ), *parallel.getAssembledSurfaceAdhesionTractions( ) ) );
+
+        // The workers do not receive copies of the assembled quantities or the neighbor lists
+        BOOST_CHECK( !parallel.workerHasAssembledStorage );
+
+        BOOST_CHECK( *parallel.getLocalParticleNeighbors( ) == parallel.neighbors );
+
+    }
+
+    // Derived classes which do not copy themselves cannot use the parallel assembly
+    aspBaseMock sliced;
+
+    sliced.useWorkers = false;
+
+    asp::unit_test::aspBaseTester::set_numAssemblyThreads( sliced, 2 );
+
+    BOOST_CHECK_THROW( sliced.getAssembledSparseSurfaceAdhesionEnergyDensities( ), std::exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_fusedSurfaceResponses ){
+    /*!
+     * Test that the fused evaluation of the surface responses matches the evaluation with the individual getters
+     */
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            unsigned int numLocalParticles = 3;
+
+            floatVector unitSpherePoints = { 1, 0, 0, 0, 1, 0, 0, 0, 1, -1, 0, 0 };
+
+            std::vector< unsigned int > unitSphereConnectivity = { 0, 1, 2, 3 };
+
+            std::vector< std::vector< unsigned int > > neighbors = { { 0, 1 }, { 2 }, { 0, 1, 2 } };
+
+            aspBaseMock( const bool &fused, const asp::evaluationMode &mode ) : aspBase( ){
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+                _useFusedSurfaceResponses = fused;
+
+                setEvaluationMode( mode );
+
+            }
+
+        private:
+
+            floatType value( ){
+
+                return 1 + *getLocalIndex( ) + 0.1 * ( *getLocalSurfaceNodeIndex( ) ) + 0.01 * ( *getNonLocalIndex( ) );
+
+            }
+
+            virtual void initializeUnitSphere( ){
+
+                asp::unit_test::aspBaseTester::set_unitSphere( *this, unitSpherePoints, unitSphereConnectivity );
+
+            }
+
+            virtual void setLocalParticleNeighbors( ){
+
+                asp::aspBase::setLocalParticleNeighbors( neighbors );
+
+            }
+
+            virtual void setCurrentDistanceVector( ){
+
+                asp::aspBase::setCurrentDistanceVector( { value( ), -2 * value( ), 0.5 } );
+
+            }
+
+            virtual void setLocalCurrentNormal( ){
+
+                floatVector normal = { 1, value( ), -1 };
+
+                asp::aspBase::setLocalCurrentNormal( normal / vectorTools::l2norm( normal ) );
+
+            }
+
+            virtual void setSurfaceParameters( ){
+
+                asp::aspBase::setSurfaceParameters( { 12.3, 45.6 } );
+
+            }
+
+            virtual void setSurfaceOverlapParameters( ){
+
+                asp::aspBase::setSurfaceOverlapParameters( { 2.3 } );
+
+            }
+
+            virtual void setParticlePairOverlap( ){
+
+                asp::mapFloatVector overlap;
+
+                if ( *getLocalIndex( ) != *getNonLocalIndex( ) ){
+
+                    overlap = { { 0, { -value( ), 0, 0.1 } }, { 3, { 0.2, value( ), -0.3 } } };
+
+                }
+
+                asp::aspBase::setParticlePairOverlap( overlap );
+
+            }
+
+            virtual void getLocalCurrentNormal( const unsigned int &index, floatVector &normal ){
+
+                normal = { unitSpherePoints[ 3 * index + 0 ], unitSpherePoints[ 3 * index + 1 ], unitSpherePoints[ 3 * index + 2 ] };
+
+            }
+
+    };
+
+    std::vector< asp::evaluationMode > modes = { asp::ENERGY, asp::GRADIENT };
+
+    for ( auto mode = modes.begin( ); mode != modes.end( ); mode++ ){
+
+        aspBaseMock individual( false, *mode ), fused( true, *mode );
+
+        std::vector< std::pair< const asp::sparseSurfaceResponse*, const asp::sparseSurfaceResponse* > > results =
+            {
+                { individual.getAssembledSparseSurfaceAdhesionEnergyDensities( ), fused.getAssembledSparseSurfaceAdhesionEnergyDensities( ) },
+                { individual.getAssembledSparseSurfaceAdhesionTractions( ),       fused.getAssembledSparseSurfaceAdhesionTractions( ) },
+                { individual.getAssembledSparseSurfaceAdhesionThicknesses( ),     fused.getAssembledSparseSurfaceAdhesionThicknesses( ) },
+                { individual.getAssembledSparseSurfaceOverlapEnergyDensities( ),  fused.getAssembledSparseSurfaceOverlapEnergyDensities( ) },
+                { individual.getAssembledSparseSurfaceOverlapTractions( ),        fused.getAssembledSparseSurfaceOverlapTractions( ) },
+                { individual.getAssembledSparseSurfaceOverlapThicknesses( ),      fused.getAssembledSparseSurfaceOverlapThicknesses( ) },
+            };
+
+        // The overlap only exists between different particles
+        BOOST_CHECK( results[ 3 ].second->getNumEntries( ) == 2 * 4 * 4 );
+
+        for ( auto r = results.begin( ); r != results.end( ); r++ ){
+
+            BOOST_CHECK( r->first->rowOffsets == r->second->rowOffsets );
+
+            BOOST_CHECK( r->first->nonLocalIndices == r->second->nonLocalIndices );
+
+            BOOST_CHECK( r->first->entryOffsets == r->second->entryOffsets );
+
+            BOOST_CHECK( r->first->entryKeys == r->second->entryKeys );
+
+            BOOST_CHECK( vectorTools::fuzzyEquals( r->first->values, r->second->values ) );
+
+        }
+
+        // The tractions are only assembled if gradients are required
+        BOOST_CHECK( ( results[ 1 ].second->values.size( ) == 0 ) == ( *mode == asp::ENERGY ) );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_batchedCurrentDistances ){
+    /*!
+     * Test that the batched evaluation of the current distance vectors of a surface point matches the evaluation of
+     * each pair
+     */
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            unsigned int numLocalParticles = 3;
+
+            floatVector unitSpherePoints = { 1, 0, 0, 0, 1, 0, 0, 0, 1, -1, 0, 0 };
+
+            std::vector< unsigned int > unitSphereConnectivity = { 0, 1, 2, 3 };
+
+            std::vector< std::vector< unsigned int > > neighbors = { { 0, 1 }, { 2 }, { 0, 1, 2 } };
+
+            aspBaseMock( const bool &batched, const asp::evaluationMode &mode ) : aspBase( ){
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+                floatVector gradientMicroDeformation( 27, 0 );
+
+                for ( unsigned int i = 0; i < gradientMicroDeformation.size( ); i++ ){
+
+                    gradientMicroDeformation[ i ] = 0.01 * ( i + 1 );
+
+                }
+
+                asp::unit_test::aspBaseTester::set_gradientMicroDeformation( *this, gradientMicroDeformation );
+
+                _useBatchedCurrentDistances = batched;
+
+                setEvaluationMode( mode );
+
+            }
+
+        private:
+
+            static floatType rowSum( const floatMatrix &A, const unsigned int &row ){
+
+                floatType result = 0;
+
+                for ( auto v = A[ row ].begin( ); v != A[ row ].end( ); v++ ){
+
+                    result += *v;
+
+                }
+
+                return result;
+
+            }
+
+            virtual void initializeUnitSphere( ){
+
+                asp::unit_test::aspBaseTester::set_unitSphere( *this, unitSpherePoints, unitSphereConnectivity );
+
+            }
+
+            virtual void setLocalParticleNeighbors( ){
+
+                asp::aspBase::setLocalParticleNeighbors( neighbors );
+
+            }
+
+            virtual void setLocalSurfaceReferenceRelativePositionVector( ){
+
+                floatType j = *getLocalSurfaceNodeIndex( );
+
+                asp::aspBase::setLocalSurfaceReferenceRelativePositionVector( { 1 + j, 0.5 * j, -0.25 } );
+
+            }
+
+            virtual void setNonLocalSurfaceReferenceRelativePositionVector( ){
+
+                floatType k = *getNonLocalIndex( );
+
+                asp::aspBase::setNonLocalSurfaceReferenceRelativePositionVector( { -k, 0.3, 0.1 * k } );
+
+            }
+
+            virtual void setReferenceDistanceVector( ){
+
+                floatType i = *getLocalIndex( );
+
+                floatType k = *getNonLocalIndex( );
+
+                asp::aspBase::setReferenceDistanceVector( { 2 + k - i, 0.1 * i, 0.2 * k } );
+
+            }
+
+            virtual void setLocalDeformationGradient( ){
+
+                floatType i = *getLocalIndex( );
+
+                asp::aspBase::setLocalDeformationGradient( { 1 + 0.1 * i, 0.2, 0, 0, 1, 0.1 * i, 0, 0, 1 } );
+
+            }
+
+            virtual void setLocalMicroDeformation( ){
+
+                floatType i = *getLocalIndex( );
+
+                asp::aspBase::setLocalMicroDeformation( { 1, 0.1 * i, 0, 0.3, 1, 0, 0, 0, 1 - 0.05 * i } );
+
+            }
+
+            virtual void setNonLocalMicroDeformationBase( ){
+
+                floatType k = *getNonLocalIndex( );
+
+                asp::aspBase::setNonLocalMicroDeformationBase( { 1 + 0.1 * k, 0, 0.2, 0, 1, 0, 0.1 * k, 0, 1 } );
+
+            }
+
+            virtual void setSurfaceAdhesionEnergyDensity( ){
+
+                const floatVector *d = getCurrentDistanceVector( );
+
+                asp::aspBase::setSurfaceAdhesionEnergyDensity( ( *d )[ 0 ] - 2 * ( *d )[ 1 ] + 3 * ( *d )[ 2 ] );
+
+            }
+
+            virtual void setSurfaceAdhesionTraction( ){
+
+                const floatVector *d = getCurrentDistanceVector( );
+
+                const floatMatrix *dddF = getdCurrentDistanceVectordLocalDeformationGradient( );
+
+                const floatMatrix *dddChi = getdCurrentDistanceVectordLocalMicroDeformation( );
+
+                const floatMatrix *dddXiNL = getdCurrentDistanceVectordNonLocalReferenceRelativePositionVector( );
+
+                const floatMatrix *dddGradChi = getdCurrentDistanceVectordGradientMicroDeformation( );
+
+                asp::aspBase::setSurfaceAdhesionTraction( { ( *d )[ 0 ] + rowSum( *dddF, 0 ),
+                                                            ( *d )[ 1 ] + rowSum( *dddChi, 1 ) + rowSum( *dddXiNL, 1 ),
+                                                            ( *d )[ 2 ] + rowSum( *dddGradChi, 2 ) } );
+
+            }
+
+            virtual void setSurfaceAdhesionThickness( ){
+
+                asp::aspBase::setSurfaceAdhesionThickness( 1. );
+
+            }
+
+            virtual void setSurfaceOverlapEnergyDensity( ){
+
+                asp::aspBase::setSurfaceOverlapEnergyDensity( asp::mapFloatType( ) );
+
+            }
+
+            virtual void setSurfaceOverlapTraction( ){
+
+                asp::aspBase::setSurfaceOverlapTraction( asp::mapFloatVector( ) );
+
+            }
+
+            virtual void setSurfaceOverlapThickness( ){
+
+                asp::aspBase::setSurfaceOverlapThickness( asp::mapFloatType( ) );
+
+            }
+
+    };
+
+    std::vector< asp::evaluationMode > modes = { asp::ENERGY, asp::GRADIENT };
+
+    for ( auto mode = modes.begin( ); mode != modes.end( ); mode++ ){
+
+        aspBaseMock individual( false, *mode ), batched( true, *mode );
+
+        std::vector< std::pair< const asp::sparseSurfaceResponse*, const asp::sparseSurfaceResponse* > > results =
+            {
+                { individual.getAssembledSparseSurfaceAdhesionEnergyDensities( ), batched.getAssembledSparseSurfaceAdhesionEnergyDensities( ) },
+                { individual.getAssembledSparseSurfaceAdhesionTractions( ),       batched.getAssembledSparseSurfaceAdhesionTractions( ) },
+            };
+
+        BOOST_CHECK( results[ 0 ].second->getNumPairs( ) == 4 * 6 );
+
+        for ( auto r = results.begin( ); r != results.end( ); r++ ){
+
+            BOOST_CHECK( r->first->rowOffsets == r->second->rowOffsets );
+
+            BOOST_CHECK( r->first->nonLocalIndices == r->second->nonLocalIndices );
+
+            BOOST_CHECK( vectorTools::fuzzyEquals( r->first->values, r->second->values ) );
+
+        }
+
+        BOOST_CHECK( ( results[ 1 ].second->values.size( ) == 0 ) == ( *mode == asp::ENERGY ) );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspModel ){
+    /*!
+     * Test the assembly of a model whose functions are dispatched statically
+     */
+
+    class staticModel final : public asp::aspModel< staticModel >{
+
+        public:
+
+            unsigned int numLocalParticles = 4;
+
+            floatVector unitSpherePoints = { 1, 0, 0, 0, 1, 0, 0, 0, 1, -1, 0, 0 };
+
+            std::vector< unsigned int > unitSphereConnectivity = { 0, 1, 2, 3 };
+
+            std::vector< std::vector< unsigned int > > neighbors = { { 0, 1 }, { 2 }, { 0, 1, 2, 3 }, { } };
+
+            unsigned int numPairResets = 0;
+
+            staticModel( const asp::evaluationMode &mode ) : aspModel< staticModel >( ){
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+                setEvaluationMode( mode );
+
+            }
+
+            static floatType value( const unsigned int &i, const unsigned int &j, const unsigned int &k ){
+
+                return 1 + i + 0.1 * j + 0.01 * k;
+
+            }
+
+            virtual void computeSurfaceResponses( floatType &surfaceAdhesionEnergyDensity, floatVector &surfaceAdhesionTraction,
+                                                  floatType &surfaceAdhesionThickness, asp::mapFloatType &surfaceOverlapEnergyDensity,
+                                                  asp::mapFloatVector &surfaceOverlapTraction, asp::mapFloatType &surfaceOverlapThickness ) override{
+
+                // The value is cached by the model and reset with the pair data
+                BOOST_CHECK( !_cachedValue.first );
+
+                _cachedValue.second = value( *getLocalIndex( ), *getLocalSurfaceNodeIndex( ), *getNonLocalIndex( ) );
+
+                _cachedValue.first = true;
+
+                floatType v = _cachedValue.second;
+
+                surfaceAdhesionEnergyDensity = v;
+
+                surfaceAdhesionTraction = { v, 2 * v, 3 * v };
+
+                surfaceAdhesionThickness = 0.5 * v;
+
+                // The overlap solutions are kept by the worker evaluating the pair and handed back to the model
+                asp::unit_test::aspBaseTester::get_overlapSolution( *this, *getLocalIndex( ), *getNonLocalIndex( ), *getLocalSurfaceNodeIndex( ) ) = { v };
+
+                surfaceOverlapEnergyDensity.clear( );
+
+                surfaceOverlapTraction.clear( );
+
+                surfaceOverlapThickness.clear( );
+
+                if ( *getLocalIndex( ) != *getNonLocalIndex( ) ){
+
+                    surfaceOverlapEnergyDensity.emplace( *getLocalSurfaceNodeIndex( ), -v );
+
+                    surfaceOverlapTraction.emplace( *getLocalSurfaceNodeIndex( ), floatVector( { 0, -v, 0 } ) );
+
+                    surfaceOverlapThickness.emplace( *getLocalSurfaceNodeIndex( ), 0.1 * v );
+
+                }
+
+            }
+
+            virtual void computeLocalParticleEnergyDensity( const floatType &previousTime, const floatType &deltaTime,
+                                                            const floatVector &currentMicroDeformation, const floatVector &previousMicroDeformation,
+                                                            const floatType &currentTemperature, const floatType &previousTemperature,
+                                                            const floatVector &previousStateVariables,
+                                                            const floatVector &parameters,
+                                                            floatType &energyDensity, floatVector &cauchyStress, floatVector &stateVariables,
+                                                            floatType &logProbabilityRatio ) override{
+
+                const unsigned int localIndex = *getLocalIndex( );
+
+                energyDensity = value( localIndex, 0, 0 );
+
+                cauchyStress = { 1. * localIndex, 2. };
+
+                stateVariables = { };
+
+                logProbabilityRatio = -energyDensity;
+
+            }
+
+            virtual void resetInteractionPairData( ) override{
+
+                numPairResets++;
+
+                asp::clearStorage( _cachedValue );
+
+                asp::aspBase::resetInteractionPairData( );
+
+            }
+
+        private:
+
+            asp::dataStorage< floatType > _cachedValue;
+
+            virtual void initializeUnitSphere( ){
+
+                asp::unit_test::aspBaseTester::set_unitSphere( *this, unitSpherePoints, unitSphereConnectivity );
+
+            }
+
+            virtual void setLocalParticleNeighbors( ){
+
+                asp::aspBase::setLocalParticleNeighbors( neighbors );
+
+            }
+
+            virtual void setLocalParticleCurrentVolume( ){
+
+                floatType volume = 2;
+
+                asp::unit_test::aspBaseTester::set_localParticleCurrentVolume( *this, volume );
+
+            }
+
+            virtual void setLocalParticleQuantities( ){
+
+                // The local particle quantities are formed from the model's energy density
+                BOOST_CHECK( false );
+
+            }
+
+    };
+
+    std::vector< asp::evaluationMode > modes = { asp::ENERGY, asp::GRADIENT };
+
+    for ( auto mode = modes.begin( ); mode != modes.end( ); mode++ ){
+
+        staticModel serial( *mode );
+
+        const asp::sparseSurfaceResponse *energies = serial.getAssembledSparseSurfaceAdhesionEnergyDensities( );
+
+        unsigned int numPairs = 0;
+
+        for ( unsigned int i = 0; i < serial.numLocalParticles; i++ ){
+
+            for ( unsigned int j = 0; j < 4; j++ ){
+
+                unsigned int row = 4 * i + j;
+
+                BOOST_CHECK( std::vector< unsigned int >( energies->nonLocalIndices.begin( ) + energies->rowOffsets[ row ],
+                                                          energies->nonLocalIndices.begin( ) + energies->rowOffsets[ row + 1 ] ) == serial.neighbors[ i ] );
+
+                for ( unsigned int p = energies->rowOffsets[ row ]; p < energies->rowOffsets[ row + 1 ]; p++ ){
+
+                    BOOST_CHECK( vectorTools::fuzzyEquals( energies->values[ p ], staticModel::value( i, j, energies->nonLocalIndices[ p ] ) ) );
+
+                }
+
+                numPairs += serial.neighbors[ i ].size( );
+
+            }
+
+        }
+
+        // The model's reset is called once for every pair
+        BOOST_CHECK( serial.numPairResets >= numPairs );
+
+        BOOST_CHECK( ( serial.getAssembledSparseSurfaceAdhesionTractions( )->values.size( ) == 0 ) == ( *mode == asp::ENERGY ) );
+
+        BOOST_CHECK( serial.getAssembledSparseSurfaceOverlapEnergyDensities( )->getNumEntries( ) == 4 * 5 );
+
+        staticModel parallel( *mode );
+
+        asp::unit_test::aspBaseTester::set_numAssemblyThreads( parallel, 3 );
+
+        std::vector< std::pair< const asp::sparseSurfaceResponse*, const asp::sparseSurfaceResponse* > > results =
+            {
+                { serial.getAssembledSparseSurfaceAdhesionEnergyDensities( ), parallel.getAssembledSparseSurfaceAdhesionEnergyDensities( ) },
+                { serial.getAssembledSparseSurfaceAdhesionTractions( ),       parallel.getAssembledSparseSurfaceAdhesionTractions( ) },
+                { serial.getAssembledSparseSurfaceAdhesionThicknesses( ),     parallel.getAssembledSparseSurfaceAdhesionThicknesses( ) },
+                { serial.getAssembledSparseSurfaceOverlapEnergyDensities( ),  parallel.getAssembledSparseSurfaceOverlapEnergyDensities( ) },
+                { serial.getAssembledSparseSurfaceOverlapTractions( ),        parallel.getAssembledSparseSurfaceOverlapTractions( ) },
+                { serial.getAssembledSparseSurfaceOverlapThicknesses( ),      parallel.getAssembledSparseSurfaceOverlapThicknesses( ) },
+            };
+
+        for ( auto r = results.begin( ); r != results.end( ); r++ ){
+
+            BOOST_CHECK( r->first->rowOffsets == r->second->rowOffsets );
+
+            BOOST_CHECK( r->first->nonLocalIndices == r->second->nonLocalIndices );
+
+            BOOST_CHECK( r->first->entryKeys == r->second->entryKeys );
+
+            BOOST_CHECK( vectorTools::fuzzyEquals( r->first->values, r->second->values ) );
+
+        }
+
+        const asp::overlapSolutionStorage &serialSolutions = asp::unit_test::aspBaseTester::get_overlapSolutions( serial );
+
+        const asp::overlapSolutionStorage &parallelSolutions = asp::unit_test::aspBaseTester::get_overlapSolutions( parallel );
+
+        BOOST_CHECK( serialSolutions.size( ) == serial.numLocalParticles );
+
+        BOOST_CHECK( parallelSolutions == serialSolutions );
+
+        for ( unsigned int i = 0; i < serial.numLocalParticles; i++ ){
+
+            BOOST_CHECK( serialSolutions[ i ].size( ) == 4 * serial.neighbors[ i ].size( ) );
+
+            for ( auto s = serialSolutions[ i ].begin( ); s != serialSolutions[ i ].end( ); s++ ){
+
+                BOOST_CHECK( vectorTools::fuzzyEquals( s->second, { staticModel::value( i, s->first.second, s->first.first ) } ) );
+
+            }
+
+        }
+
+        // The local particles are assembled through the model
+        floatVector energyAnswer = { 2, 4, 6, 8 };
+
+        floatVector logProbabilityRatioAnswer = { -1, -2, -3, -4 };
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( *parallel.getAssembledLocalParticleEnergies( ), energyAnswer ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( *serial.getAssembledLocalParticleEnergies( ), energyAnswer ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( *serial.getAssembledLocalParticleLogProbabilityRatios( ), logProbabilityRatioAnswer ) );
+
+        BOOST_CHECK( ( *serial.getAssembledLocalParticleMicroCauchyStresses( ) )[ 3 ] == floatVector( { 3, 2 } ) );
+
+#ifdef ASP_INSTRUMENTATION
+        // The loops of the model record the same stages as those of aspBase
+        BOOST_CHECK( serial.getInstrumentationCounters( )->calls[ asp::SURFACE_RESPONSES ] == numPairs );
+
+        BOOST_CHECK( parallel.getInstrumentationCounters( )->calls[ asp::SURFACE_RESPONSES ] == numPairs );
+
+        BOOST_CHECK( serial.getInstrumentationCounters( )->calls[ asp::LOCAL_PARTICLE_ENERGY ] == serial.numLocalParticles );
+#endif
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspModel_surfaceResponseFunctions ){
+    /*!
+     * Test that the fused surface responses of a statically dispatched model use the model's response functions
+     */
+
+    class responseModel final : public asp::aspModel< responseModel >{
+
+        public:
+
+            unsigned int numLocalParticles = 3;
+
+            floatVector unitSpherePoints = { 1, 0, 0, 0, 1, 0, 0, 0, 1, -1, 0, 0 };
+
+            std::vector< unsigned int > unitSphereConnectivity = { 0, 1, 2, 3 };
+
+            std::vector< std::vector< unsigned int > > neighbors = { { 0, 1 }, { 2 }, { 0, 1, 2 } };
+
+            responseModel( const bool &useFusedSurfaceResponses ) : aspModel< responseModel >( ){
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+                _useFusedSurfaceResponses = useFusedSurfaceResponses;
+
+                setEvaluationMode( asp::GRADIENT );
+
+            }
+
+            static floatType value( const unsigned int &i, const unsigned int &j, const unsigned int &k ){
+
+                return 1 + i + 0.1 * j + 0.01 * k;
+
+            }
+
+            using asp::aspBase::computeSurfaceAdhesionEnergyDensity;
+
+            virtual void computeSurfaceAdhesionEnergyDensity( floatType &surfaceAdhesionEnergyDensity ) override{
+
+                surfaceAdhesionEnergyDensity = 7 * value( *getLocalIndex( ), *getLocalSurfaceNodeIndex( ), *getNonLocalIndex( ) );
+
+            }
+
+            virtual void computeSurfaceAdhesionTraction( floatVector &surfaceAdhesionTraction ) override{
+
+                surfaceAdhesionTraction = { 0, 0, value( *getLocalIndex( ), *getLocalSurfaceNodeIndex( ), *getNonLocalIndex( ) ) };
+
+            }
+
+            virtual void computeSurfaceOverlapEnergyDensity( asp::mapFloatType &surfaceOverlapEnergyDensity ) override{
+
+                surfaceOverlapEnergyDensity.emplace( *getLocalSurfaceNodeIndex( ), -value( *getLocalIndex( ), *getLocalSurfaceNodeIndex( ), *getNonLocalIndex( ) ) );
+
+            }
+
+            virtual void computeSurfaceOverlapTraction( asp::mapFloatVector &surfaceOverlapTraction ) override{
+
+                surfaceOverlapTraction.emplace( *getLocalSurfaceNodeIndex( ), floatVector( { 1, 2, 3 } ) );
+
+            }
+
+        private:
+
+            virtual void initializeUnitSphere( ){
+
+                asp::unit_test::aspBaseTester::set_unitSphere( *this, unitSpherePoints, unitSphereConnectivity );
+
+            }
+
+            virtual void setLocalParticleNeighbors( ){
+
+                asp::aspBase::setLocalParticleNeighbors( neighbors );
+
+            }
+
+            virtual void setSurfaceAdhesionThickness( ){
+
+                floatType thickness = 0.5;
+
+                asp::unit_test::aspBaseTester::set_surfaceAdhesionThickness( *this, thickness );
+
+            }
+
+            virtual void setSurfaceOverlapThickness( ){
+
+                asp::mapFloatType thickness = { { *getLocalSurfaceNodeIndex( ), 0.25 } };
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapThickness( *this, thickness );
+
+            }
+
+    };
+
+    responseModel fused( true ), individual( false );
+
+    const asp::sparseSurfaceResponse *energies = fused.getAssembledSparseSurfaceAdhesionEnergyDensities( );
+
+    for ( unsigned int i = 0; i < fused.numLocalParticles; i++ ){
+
+        for ( unsigned int j = 0; j < 4; j++ ){
+
+            unsigned int row = 4 * i + j;
+
+            for ( unsigned int p = energies->rowOffsets[ row ]; p < energies->rowOffsets[ row + 1 ]; p++ ){
+
+                // The model's override changes the energy
+                BOOST_CHECK( vectorTools::fuzzyEquals( energies->values[ p ], 7 * responseModel::value( i, j, energies->nonLocalIndices[ p ] ) ) );
+
+            }
+
+        }
+
+    }
+
+    std::vector< std::pair< const asp::sparseSurfaceResponse*, const asp::sparseSurfaceResponse* > > results =
+        {
+            { fused.getAssembledSparseSurfaceAdhesionEnergyDensities( ), individual.getAssembledSparseSurfaceAdhesionEnergyDensities( ) },
+            { fused.getAssembledSparseSurfaceAdhesionTractions( ),       individual.getAssembledSparseSurfaceAdhesionTractions( ) },
+            { fused.getAssembledSparseSurfaceAdhesionThicknesses( ),     individual.getAssembledSparseSurfaceAdhesionThicknesses( ) },
+            { fused.getAssembledSparseSurfaceOverlapEnergyDensities( ),  individual.getAssembledSparseSurfaceOverlapEnergyDensities( ) },
+            { fused.getAssembledSparseSurfaceOverlapTractions( ),        individual.getAssembledSparseSurfaceOverlapTractions( ) },
+            { fused.getAssembledSparseSurfaceOverlapThicknesses( ),      individual.getAssembledSparseSurfaceOverlapThicknesses( ) },
+        };
+
+    for ( auto r = results.begin( ); r != results.end( ); r++ ){
+
+        BOOST_CHECK( r->first->rowOffsets == r->second->rowOffsets );
+
+        BOOST_CHECK( r->first->nonLocalIndices == r->second->nonLocalIndices );
+
+        BOOST_CHECK( r->first->entryKeys == r->second->entryKeys );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( r->first->values, r->second->values ) );
+
+    }
+
+    BOOST_CHECK( fused.getAssembledSparseSurfaceOverlapTractions( )->getNumEntries( ) == 4 * 6 );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_pairSelection ){
+    /*!
+     * Test the selection of the particle pairs whose surface responses are assembled
+     */
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            unsigned int numLocalParticles = 3;
+
+            floatVector unitSpherePoints = { 1, 0, 0, 0, 1, 0, 0, 0, 1, -1, 0, 0 };
+
+            std::vector< unsigned int > unitSphereConnectivity = { 0, 1, 2, 3 };
+
+            std::vector< std::vector< unsigned int > > neighbors = { { 0, 1, 2 }, { 0, 1 }, { 0, 2 } };
+
+            unsigned int numEvaluations = 0;
+
+            aspBaseMock( const asp::pairSelection &selection ) : aspBase( ){
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+                setPairSelection( selection );
+
+                setEvaluationMode( asp::GRADIENT );
+
+            }
+
+        private:
+
+            floatType value( ){
+
+                return 1 + *getLocalIndex( ) + 0.1 * ( *getLocalSurfaceNodeIndex( ) ) + 0.01 * ( *getNonLocalIndex( ) );
+
+            }
+
+            virtual void initializeUnitSphere( ){
+
+                asp::unit_test::aspBaseTester::set_unitSphere( *this, unitSpherePoints, unitSphereConnectivity );
 
-            std::vector< std::vector< floatVector > > adhesionThicknesses =
-            {
-                {
-                    {
-                        33, 34, 35, 36
-                    },
-                    {
-                        37, 38, 39, 40
-                    },
-                },
-                {
-                    {
-                        41, 42, 43, 44
-                    },
-                    {
-                        45, 46, 47, 48
-                    },
-                },
-                {
-                    {
-                        49, 50, 51, 52
-                    },
-                    {
-                        53, 54, 55, 56
-                    },
-                },
-                {
-                    {
-                        57, 58, 59, 60
-                    },
-                    {
-                        61, 62, 63, 64
-                    },
-                },
-            };
+            }
 
-            std::vector< std::vector< floatMatrix > > adhesionTractions =
-            {
-                {
-                    {
-                        {  1,  2,  3 },
-                        {  4,  5,  6 },
-                        {  7,  8,  9 },
-                        { 10, 11, 12 },
-                    },
-                    {
-                        { 13, 14, 15 },
-                        { 16, 17, 18 },
-                        { 19, 20, 21 },
-                        { 22, 23, 24 },
-                    },
-                },
-                {
-                    {
-                        { 25, 26, 27 },
-                        { 28, 29, 30 },
-                        { 31, 32, 33 },
-                        { 34, 35, 36 },
-                    },
-                    {
-                        { 37, 38, 39 },
-                        { 40, 41, 42 },
-                        { 43, 44, 45 },
-                        { 46, 47, 48 },
-                    },
-                },
-                {
-                    {
-                        { 49, 50, 51 },
-                        { 52, 53, 54 },
-                        { 55, 56, 57 },
-                        { 58, 59, 60 },
-                    },
-                    {
-                        { 61, 62, 63 },
-                        { 64, 65, 66 },
-                        { 67, 68, 69 },
-                        { 70, 71, 72 },
-                    },
-                },
-                {
-                    {
-                        { 73, 74, 75 },
-                        { 76, 77, 78 },
-                        { 79, 80, 81 },
-                        { 82, 83, 84 },
-                    },
-                    {
-                        { 85, 86, 87 },
-                        { 88, 89, 90 },
-                        { 91, 92, 93 },
-                        { 94, 95, 96 },
-                    },
-                },
-            };
+            virtual void setLocalParticleNeighbors( ){
+
+                asp::aspBase::setLocalParticleNeighbors( neighbors );
+
+            }
+
+            virtual void setCurrentDistanceVector( ){
+
+                numEvaluations++;
+
+                asp::aspBase::setCurrentDistanceVector( { value( ), -2 * value( ), 0.5 } );
+
+            }
+
+            virtual void setLocalCurrentNormal( ){
+
+                floatVector normal = { 1, 1. + *getLocalSurfaceNodeIndex( ), -1 };
+
+                asp::aspBase::setLocalCurrentNormal( normal / vectorTools::l2norm( normal ) );
+
+            }
+
+            virtual void setSurfaceParameters( ){
+
+                asp::aspBase::setSurfaceParameters( { 12.3, 45.6 } );
+
+            }
+
+            virtual void setSurfaceOverlapEnergyDensity( ){
+
+                asp::mapFloatType result;
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapEnergyDensity( *this, result );
+
+            }
+
+            virtual void setSurfaceOverlapTraction( ){
+
+                asp::mapFloatVector result;
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapTraction( *this, result );
+
+            }
+
+            virtual void setSurfaceOverlapThickness( ){
+
+                asp::mapFloatType result;
+
+                asp::unit_test::aspBaseTester::set_surfaceOverlapThickness( *this, result );
+
+            }
+
+    };
+
+    aspBaseMock all( asp::ALL_PAIRS ), distinct( asp::DISTINCT_PAIRS );
+
+    const asp::sparseSurfaceResponse *allEnergies = all.getAssembledSparseSurfaceAdhesionEnergyDensities( );
+
+    const asp::sparseSurfaceResponse *allTractions = all.getAssembledSparseSurfaceAdhesionTractions( );
+
+    std::vector< std::vector< unsigned int > > answerPairs = { { 1, 2 }, { 0 }, { 0 } };
+
+    std::vector< aspBaseMock* > mocks = { &distinct };
+
+    for ( auto m = mocks.begin( ); m != mocks.end( ); m++ ){
+
+        const asp::sparseSurfaceResponse *energies = ( *m )->getAssembledSparseSurfaceAdhesionEnergyDensities( );
+
+        const asp::sparseSurfaceResponse *tractions = ( *m )->getAssembledSparseSurfaceAdhesionTractions( );
+
+        unsigned int numAnswerPairs = 0;
+
+        for ( unsigned int i = 0; i < 3; i++ ){
+
+            for ( unsigned int j = 0; j < 4; j++ ){
+
+                unsigned int row = 4 * i + j;
+
+                std::vector< unsigned int > result( energies->nonLocalIndices.begin( ) + energies->rowOffsets[ row ],
+                                                    energies->nonLocalIndices.begin( ) + energies->rowOffsets[ row + 1 ] );
+
+                BOOST_CHECK( result == answerPairs[ i ] );
+
+                numAnswerPairs += answerPairs[ i ].size( );
+
+                // The responses of the retained pairs are unchanged
+                for ( unsigned int p = energies->rowOffsets[ row ]; p < energies->rowOffsets[ row + 1 ]; p++ ){
+
+                    unsigned int q = allEnergies->rowOffsets[ row ];
+
+                    while ( allEnergies->nonLocalIndices[ q ] != energies->nonLocalIndices[ p ] ){
+
+                        q++;
+
+                    }
+
+                    BOOST_CHECK( vectorTools::fuzzyEquals( energies->values[ energies->entryOffsets[ p ] ],
+                                                           allEnergies->values[ allEnergies->entryOffsets[ q ] ] ) );
+
+                    BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( tractions->values.begin( ) + 3 * tractions->entryOffsets[ p ],
+                                                                        tractions->values.begin( ) + 3 * tractions->entryOffsets[ p + 1 ] ),
+                                                           floatVector( allTractions->values.begin( ) + 3 * allTractions->entryOffsets[ q ],
+                                                                        allTractions->values.begin( ) + 3 * allTractions->entryOffsets[ q + 1 ] ) ) );
+
+                }
+
+            }
+
+        }
+
+        BOOST_CHECK( energies->getNumPairs( ) == numAnswerPairs );
+
+        // Each retained pair is only evaluated once
+        BOOST_CHECK( ( *m )->numEvaluations == numAnswerPairs );
+
+    }
+
+    BOOST_CHECK( all.numEvaluations == 4 * 7 );
+
+    BOOST_CHECK( *distinct.getPairSelection( ) == asp::DISTINCT_PAIRS );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_checkpoint ){
+    /*!
+     * Test the checkpoint and restart of the reference data and assembled quantities
+     */
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            unsigned int numLocalParticles = 3;
+
+            unsigned int numEvaluations = 0;
+
+            unsigned int numNeighborSearches = 0;
+
+            floatType zero = 0;
+
+            floatType one = 1;
+
+            floatVector microCauchyStress = { 1, 2, 3 };
+
+            aspBaseMock( ) : aspBase( ){
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
+
+            }
+
+        private:
+
+            virtual void setLocalParticleNeighbors( ){
+
+                numNeighborSearches++;
+
+                asp::aspBase::setLocalParticleNeighbors( std::vector< std::vector< unsigned int > >( numLocalParticles, { 0, 1, 2 } ) );
+
+            }
+
+            virtual void setLocalParticleEnergy( ){
+
+                numEvaluations++;
+
+                floatType energy = ( *getDeformationGradient( ) )[ 0 ] * ( *getLocalIndex( ) + 1 );
+
+                asp::unit_test::aspBaseTester::set_localParticleEnergy( *this, energy );
+
+            }
+
+            virtual void setLocalParticleQuantities( ){
+
+                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, zero );
+
+                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, microCauchyStress );
+
+                asp::unit_test::aspBaseTester::set_localParticleCurrentVolume( *this, one );
+
+                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, zero );
+
+            }
+
+    };
+
+    const std::string filename = "test_aspBase_checkpoint.bin";
+
+    floatVector previousDeformationGradient = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    floatVector previousMicroDeformation = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    floatVector previousGradientMicroDeformation( 27, 0 );
 
-            std::vector< std::vector< std::vector< std::unordered_map< unsigned int, floatType > > > > overlapEnergyDensities;
+    floatVector deformationGradient = { 2, 0, 0, 0, 1, 0, 0, 0, 1 };
 
-            std::vector< std::vector< std::vector< std::unordered_map< unsigned int, floatType > > > > overlapThicknesses;
+    floatVector microDeformation = { 1, 0.1, 0, 0, 1, 0, 0, 0, 1 };
+
+    floatVector gradientMicroDeformation( 27, 0.01 );
+
+    aspBaseMock asp, restarted;
+
+    asp.setDeformation( previousDeformationGradient, previousMicroDeformation, previousGradientMicroDeformation,
+                        deformationGradient, microDeformation, gradientMicroDeformation );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getAssembledLocalParticleEnergies( ), floatVector( { 2, 4, 6 } ) ) );
+
+    const floatVector unitSpherePoints = *asp.getUnitSpherePoints( );
+
+    const std::vector< unsigned int > unitSphereConnectivity = *asp.getUnitSphereConnectivity( );
+
+    const std::vector< std::vector< unsigned int > > neighbors = *asp.getLocalParticleNeighbors( );
+
+    asp.writeCheckpoint( filename );
+
+    restarted.readCheckpoint( filename );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *restarted.getDeformationGradient( ), deformationGradient ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *restarted.getGradientMicroDeformation( ), gradientMicroDeformation ) );
+
+    BOOST_CHECK( *restarted.getUnitSpherePoints( ) == unitSpherePoints );
+
+    BOOST_CHECK( *restarted.getUnitSphereConnectivity( ) == unitSphereConnectivity );
+
+    BOOST_CHECK( *restarted.getLocalParticleNeighbors( ) == neighbors );
+
+    // The restored assembled quantities are re-used for the same deformation
+    restarted.setDeformation( previousDeformationGradient, previousMicroDeformation, previousGradientMicroDeformation,
+                              deformationGradient, microDeformation, gradientMicroDeformation );
+
+    BOOST_CHECK( !( *restarted.getDeformationChanged( ) ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *restarted.getAssembledLocalParticleEnergies( ), floatVector( { 2, 4, 6 } ) ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *restarted.getAssembledLocalParticleMicroCauchyStresses( ), *asp.getAssembledLocalParticleMicroCauchyStresses( ) ) );
+
+    BOOST_CHECK( restarted.numEvaluations == 0 );
+
+    // The restored quantities are re-computed when the deformation changes
+    deformationGradient[ 0 ] = 3;
+
+    restarted.setDeformation( previousDeformationGradient, previousMicroDeformation, previousGradientMicroDeformation,
+                              deformationGradient, microDeformation, gradientMicroDeformation );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *restarted.getAssembledLocalParticleEnergies( ), floatVector( { 3, 6, 9 } ) ) );
+
+    BOOST_CHECK( restarted.numEvaluations == 3 );
+
+    // The restored neighbor lists are reset with the other assembled quantities
+    BOOST_CHECK( restarted.numNeighborSearches == 0 );
+
+    BOOST_CHECK( *restarted.getLocalParticleNeighbors( ) == neighbors );
+
+    BOOST_CHECK( restarted.numNeighborSearches == 1 );
+
+    // Truncated checkpoints are rejected and the object is unchanged
+    asp.writeCheckpoint( filename );
+
+    {
+        std::ifstream input( filename, std::ios::binary );
+
+        std::string contents( ( std::istreambuf_iterator< char >( input ) ), std::istreambuf_iterator< char >( ) );
+
+        input.close( );
+
+        std::ofstream output( filename, std::ios::binary | std::ios::trunc );
+
+        output.write( contents.data( ), contents.size( ) - 16 );
+    }
+
+    BOOST_CHECK_THROW( restarted.readCheckpoint( filename ), std::exception );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *restarted.getDeformationGradient( ), deformationGradient ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *restarted.getAssembledLocalParticleEnergies( ), floatVector( { 3, 6, 9 } ) ) );
+
+    BOOST_CHECK( *restarted.getLocalParticleNeighbors( ) == neighbors );
+
+    BOOST_CHECK( restarted.numEvaluations == 3 );
+
+    BOOST_CHECK( restarted.numNeighborSearches == 1 );
+
+    // Checkpoints of other objects are rejected
+    asp::integrationPointStateCache cache;
+
+    cache.writeCheckpoint( filename );
+
+    BOOST_CHECK_THROW( restarted.readCheckpoint( filename ), std::exception );
+
+    std::remove( filename.c_str( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_setDeformation ){
+    /*!
+     * Test that the assembled quantities are only re-computed when the deformation changes
+     */
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            unsigned int numLocalParticles = 3;
+
+            unsigned int numEvaluations = 0;
+
+            floatType zero = 0;
+
+            floatType one = 1;
+
+            floatVector microCauchyStress = { 1, 2, 3 };
 
-            std::vector< std::vector< std::vector< std::unordered_map< unsigned int, floatVector > > > > overlapTractions;
-    
             aspBaseMock( ) : aspBase( ){
-    
+
                 asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
-   
-                initializeOverlapQuantitiesTest( );
- 
+
             }
 
         private:
 
-            void initializeOverlapQuantitiesTest( ){
+            virtual void setLocalParticleEnergy( ){
 
-                overlapEnergyDensities.resize( numLocalParticles );
+                numEvaluations++;
 
-                overlapThicknesses.resize( numLocalParticles );
+                floatType energy = ( *getDeformationGradient( ) )[ 0 ] * ( *getLocalIndex( ) + 1 );
 
-                overlapTractions.resize( numLocalParticles );
+                asp::unit_test::aspBaseTester::set_localParticleEnergy( *this, energy );
 
-                for ( unsigned int i = 0; i < numLocalParticles; i++ ){
+            }
 
-                    overlapEnergyDensities[ i ].resize( numSurfacePoints );
-    
-                    overlapThicknesses[ i ].resize( numSurfacePoints );
-    
-                    overlapTractions[ i ].resize( numSurfacePoints );
+            virtual void setLocalParticleQuantities( ){
 
-                    for ( unsigned int j = 0; j < numSurfacePoints; j++ ){
+                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, zero );
 
-                        overlapEnergyDensities[ i ][ j ].resize( numLocalParticles );
+                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, microCauchyStress );
 
-                        overlapThicknesses[ i ][ j ].resize( numLocalParticles );
+                asp::unit_test::aspBaseTester::set_localParticleCurrentVolume( *this, one );
 
-                        overlapTractions[ i ][ j ].resize( numLocalParticles );
+                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, zero );
 
-                        for ( unsigned int k = 0; k < numLocalParticles; k++ ){
+            }
 
-                            for ( auto index = neighboringOverlapParticles[ i ][ j ][ k ].begin( );
-                                       index != neighboringOverlapParticles[ i ][ j ][ k ].end( ); index++ ){
+    };
 
-                                overlapEnergyDensities[ i ][ j ][ k ].emplace( *index, adhesionEnergyDensities[ i ][ j ][ k ] * ( *index ) * .142 );
+    floatVector previousDeformationGradient = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
 
-                                overlapThicknesses[ i ][ j ][ k ].emplace( *index, adhesionThicknesses[ i ][ j ][ k ] * ( ( *index ) - 3 ) * .89 );
+    floatVector previousMicroDeformation = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
 
-                                overlapTractions[ i ][ j ][ k ].emplace( *index, adhesionTractions[ i ][ j ][ k ] * ( ( *index ) - .78 ) * .09 );
+    floatVector previousGradientMicroDeformation( 27, 0 );
 
-                            }
+    floatVector deformationGradient = { 2, 0, 0, 0, 1, 0, 0, 0, 1 };
 
-                        }
+    floatVector microDeformation = { 1, 0.1, 0, 0, 1, 0, 0, 0, 1 };
 
-                    }
+    floatVector gradientMicroDeformation( 27, 0.01 );
 
-                }
+    aspBaseMock asp;
 
-            }
+    asp.setDeformation( previousDeformationGradient, previousMicroDeformation, previousGradientMicroDeformation,
+                        deformationGradient, microDeformation, gradientMicroDeformation );
 
-            virtual void initializeUnitSphere( ){
+    BOOST_CHECK( *asp.getDeformationChanged( ) );
 
-                asp::unit_test::aspBaseTester::set_unitSphere( *this, unitSpherePoints, unitSphereConnectivity );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getPreviousDeformationGradient( ), previousDeformationGradient ) );
 
-            }
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getDeformationGradient( ), deformationGradient ) );
 
-            virtual void setSurfaceAdhesionEnergyDensity( ){
-    
-                const unsigned int* localIndex = getLocalIndex( );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getMicroDeformation( ), microDeformation ) );
 
-                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getGradientMicroDeformation( ), gradientMicroDeformation ) );
 
-                const unsigned int* nonLocalIndex = getNonLocalIndex( );
-    
-                asp::unit_test::aspBaseTester::set_surfaceAdhesionEnergyDensity( *this, adhesionEnergyDensities[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
-    
-            }
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getAssembledLocalParticleEnergies( ), floatVector( { 2, 4, 6 } ) ) );
 
-            virtual void setSurfaceAdhesionTraction( ){
-    
-                const unsigned int* localIndex = getLocalIndex( );
+    BOOST_CHECK( asp.numEvaluations == 3 );
 
-                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+    // An unchanged deformation re-uses the assembled quantities
+    asp.setDeformation( previousDeformationGradient, previousMicroDeformation, previousGradientMicroDeformation,
+                        deformationGradient, microDeformation, gradientMicroDeformation );
 
-                const unsigned int* nonLocalIndex = getNonLocalIndex( );
-    
-                asp::unit_test::aspBaseTester::set_surfaceAdhesionTraction( *this, adhesionTractions[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
-    
-            }
+    BOOST_CHECK( !( *asp.getDeformationChanged( ) ) );
 
-            virtual void setSurfaceAdhesionThickness( ){
-    
-                const unsigned int* localIndex = getLocalIndex( );
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getAssembledLocalParticleEnergies( ), floatVector( { 2, 4, 6 } ) ) );
 
-                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+    BOOST_CHECK( asp.numEvaluations == 3 );
+
+    // Changes within the tolerance are treated as unchanged
+    BOOST_CHECK_THROW( asp.setDeformationChangeTolerance( -1e-6 ), std::exception );
+
+    BOOST_CHECK( *asp.getDeformationChangeTolerance( ) == 0 );
+
+    asp.setDeformationChangeTolerance( 1e-6 );
+
+    BOOST_CHECK( *asp.getDeformationChangeTolerance( ) == 1e-6 );
+
+    floatVector perturbedDeformationGradient = deformationGradient;
+
+    perturbedDeformationGradient[ 0 ] += 1e-8;
+
+    asp.setDeformation( previousDeformationGradient, previousMicroDeformation, previousGradientMicroDeformation,
+                        perturbedDeformationGradient, microDeformation, gradientMicroDeformation );
+
+    BOOST_CHECK( !( *asp.getDeformationChanged( ) ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getDeformationGradient( ), deformationGradient ) );
+
+    BOOST_CHECK( asp.numEvaluations == 3 );
+
+    // A changed deformation resets the assembled quantities
+    perturbedDeformationGradient[ 0 ] = 3;
+
+    asp.setDeformation( previousDeformationGradient, previousMicroDeformation, previousGradientMicroDeformation,
+                        perturbedDeformationGradient, microDeformation, gradientMicroDeformation );
+
+    BOOST_CHECK( *asp.getDeformationChanged( ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getAssembledLocalParticleEnergies( ), floatVector( { 3, 6, 9 } ) ) );
+
+    BOOST_CHECK( asp.numEvaluations == 6 );
+
+    floatVector perturbedGradientMicroDeformation = gradientMicroDeformation;
+
+    perturbedGradientMicroDeformation[ 26 ] += 1;
+
+    asp.setDeformation( previousDeformationGradient, previousMicroDeformation, previousGradientMicroDeformation,
+                        perturbedDeformationGradient, microDeformation, perturbedGradientMicroDeformation );
+
+    BOOST_CHECK( *asp.getDeformationChanged( ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( *asp.getAssembledLocalParticleEnergies( ), floatVector( { 3, 6, 9 } ) ) );
+
+    BOOST_CHECK( asp.numEvaluations == 9 );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_instrumentationCounters ){
+
+    asp::instrumentationCounters a, b;
+
+    a.calls[ asp::OVERLAP_SOLVE ] = 2;
+
+    a.seconds[ asp::OVERLAP_SOLVE ] = 0.5;
+
+    a.overlapNewtonIterations = 7;
+
+    b.calls[ asp::OVERLAP_SOLVE ] = 3;
+
+    b.seconds[ asp::OVERLAP_SOLVE ] = 0.25;
+
+    b.overlapCandidatesTested = 4;
+
+    b.overlapNewtonIterations = 1;
+
+    a.merge( b );
+
+    BOOST_CHECK( a.calls[ asp::OVERLAP_SOLVE ] == 5 );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( a.seconds[ asp::OVERLAP_SOLVE ], 0.75 ) );
+
+    BOOST_CHECK( a.overlapCandidatesTested == 4 );
+
+    BOOST_CHECK( a.overlapNewtonIterations == 8 );
+
+    std::stringstream output;
+
+    a.write( output );
+
+    BOOST_CHECK( output.str( ).find( "overlap solve: 5 calls" ) != std::string::npos );
+
+    // The Abaqus scaling benchmark reads the UMAT times from the log file by this name
+    BOOST_CHECK( std::string( asp::getInstrumentationStageName( asp::ABAQUS_UMAT ) ) == "abaqus umat" );
+
+    a.reset( );
+
+    BOOST_CHECK( a.calls[ asp::OVERLAP_SOLVE ] == 0 );
+
+    BOOST_CHECK( a.overlapNewtonIterations == 0 );
+
+    asp::resetRecordedInstrumentation( );
+
+    asp::recordInstrumentation( b );
+
+    asp::recordInstrumentation( b );
+
+    BOOST_CHECK( asp::getRecordedInstrumentation( ).calls[ asp::OVERLAP_SOLVE ] == 6 );
+
+    asp::resetRecordedInstrumentation( );
+
+    BOOST_CHECK( asp::getRecordedInstrumentation( ).calls[ asp::OVERLAP_SOLVE ] == 0 );
+
+    // The counters recorded by each thread are included while the thread runs and after it has finished
+    asp::recordInstrumentation( b );
+
+    std::vector< std::thread > threads;
+
+    for ( unsigned int i = 0; i < 4; i++ ){
+
+        threads.push_back( std::thread( [ & ]( ){
+
+            for ( unsigned int j = 0; j < 100; j++ ){
+
+                asp::recordInstrumentation( b );
 
-                const unsigned int* nonLocalIndex = getNonLocalIndex( );
-    
-                asp::unit_test::aspBaseTester::set_surfaceAdhesionThickness( *this, adhesionThicknesses[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
-    
             }
 
-            virtual void setSurfaceOverlapEnergyDensity( ){
-    
-                const unsigned int* localIndex = getLocalIndex( );
+        } ) );
 
-                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+    }
+
+    for ( auto thread = threads.begin( ); thread != threads.end( ); thread++ ){
+
+        thread->join( );
+
+    }
+
+    BOOST_CHECK( asp::getRecordedInstrumentation( ).calls[ asp::OVERLAP_SOLVE ] == 3 * 401 );
+
+    asp::resetRecordedInstrumentation( );
+
+    BOOST_CHECK( asp::getRecordedInstrumentation( ).calls[ asp::OVERLAP_SOLVE ] == 0 );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_aspBase_instrumentation ){
+
+    class aspBaseMock : public asp::aspBase{
+
+        public:
+
+            unsigned int numLocalParticles = 5;
+
+            aspBaseMock( ) : aspBase( ){
+
+                asp::unit_test::aspBaseTester::set_numLocalParticles( *this, numLocalParticles );
 
-                const unsigned int* nonLocalIndex = getNonLocalIndex( );
-    
-                asp::unit_test::aspBaseTester::set_surfaceOverlapEnergyDensity( *this, overlapEnergyDensities[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
-    
             }
 
-            virtual void setSurfaceOverlapTraction( ){
-    
-                const unsigned int* localIndex = getLocalIndex( );
+        private:
 
-                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+            virtual std::unique_ptr< asp::aspBase > createAssemblyWorker( ) const{
+
+                return std::unique_ptr< asp::aspBase >( new aspBaseMock( *this ) );
 
-                const unsigned int* nonLocalIndex = getNonLocalIndex( );
-    
-                asp::unit_test::aspBaseTester::set_surfaceOverlapTraction( *this, overlapTractions[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
-    
             }
 
-            virtual void setSurfaceOverlapThickness( ){
-    
-                const unsigned int* localIndex = getLocalIndex( );
+            virtual void setLocalParticleEnergy( ){
 
-                const unsigned int* localSurfaceNodeIndex = getLocalSurfaceNodeIndex( );
+                floatType energy = *getLocalIndex( );
+
+                asp::unit_test::aspBaseTester::set_localParticleEnergy( *this, energy );
 
-                const unsigned int* nonLocalIndex = getNonLocalIndex( );
-    
-                asp::unit_test::aspBaseTester::set_surfaceOverlapThickness( *this, overlapThicknesses[ *localIndex ][ *localSurfaceNodeIndex ][ *nonLocalIndex ] );
-    
             }
 
-    };
+            virtual void setLocalParticleQuantities( ){
 
-    aspBaseMock asp1, asp2, asp3, asp4, asp5, asp6;
+                floatType value = *getLocalIndex( );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *asp1.getAssembledSurfaceAdhesionEnergyDensities( ), asp1.adhesionEnergyDensities ) );
+                floatVector stress = { value };
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *asp2.getAssembledSurfaceAdhesionTractions( ), asp2.adhesionTractions ) );
+                asp::unit_test::aspBaseTester::set_localParticleEnergyDensity( *this, value );
 
-    BOOST_CHECK( vectorTools::fuzzyEquals( *asp3.getAssembledSurfaceAdhesionThicknesses( ), asp3.adhesionThicknesses ) );
+                asp::unit_test::aspBaseTester::set_localParticleMicroCauchyStress( *this, stress );
 
-    for ( unsigned int i = 0; i < asp1.numLocalParticles; i++ ){
+                asp::unit_test::aspBaseTester::set_localParticleCurrentVolume( *this, value );
 
-        for ( unsigned int j = 0; j < asp1.numSurfacePoints; j++ ){
+                asp::unit_test::aspBaseTester::set_localParticleLogProbabilityRatio( *this, value );
 
-            for ( unsigned int k = 0; k < asp1.numLocalParticles; k++ ){
+            }
 
-                for ( auto index = asp1.neighboringOverlapParticles[ i ][ j ][ k ].begin( );
-                           index != asp1.neighboringOverlapParticles[ i ][ j ][ k ].end( );
-                           index++ ){
+    };
 
-                    auto energy    = ( *asp4.getAssembledSurfaceOverlapEnergyDensities( ) )[ i ][ j ][ k ].find( *index );
+    std::vector< unsigned int > numThreads = { 1, 3 };
 
-                    auto thickness = ( *asp5.getAssembledSurfaceOverlapThicknesses( ) )[ i ][ j ][ k ].find( *index );
+    for ( auto n = numThreads.begin( ); n != numThreads.end( ); n++ ){
 
-                    auto traction  = ( *asp6.getAssembledSurfaceOverlapTractions( ) )[ i ][ j ][ k ].find( *index );
+        aspBaseMock asp;
 
-                    BOOST_CHECK( energy != ( *asp4.getAssembledSurfaceOverlapEnergyDensities( ) )[ i ][ j ][ k ].end( ) );
+        asp::unit_test::aspBaseTester::set_numAssemblyThreads( asp, *n );
 
-                    BOOST_CHECK( thickness != ( *asp5.getAssembledSurfaceOverlapThicknesses( ) )[ i ][ j ][ k ].end( ) );
+        asp.getAssembledLocalParticleEnergies( );
 
-                    BOOST_CHECK( traction != ( *asp6.getAssembledSurfaceOverlapTractions( ) )[ i ][ j ][ k ].end( ) );
+        const asp::instrumentationCounters *counters = asp.getInstrumentationCounters( );
 
-                    BOOST_CHECK( vectorTools::fuzzyEquals( energy->second, asp4.overlapEnergyDensities[ i ][ j ][ k ][ *index ] ) );
+#ifdef ASP_INSTRUMENTATION
+        // The local particle energies evaluated by the workers are added to the counters of the object
+        BOOST_CHECK( counters->calls[ asp::LOCAL_PARTICLE_ASSEMBLY ] == 1 );
 
-                    BOOST_CHECK( vectorTools::fuzzyEquals( thickness->second, asp5.overlapThicknesses[ i ][ j ][ k ][ *index ] ) );
+        BOOST_CHECK( counters->calls[ asp::LOCAL_PARTICLE_ENERGY ] == asp.numLocalParticles );
 
-                    BOOST_CHECK( vectorTools::fuzzyEquals( traction->second, asp6.overlapTractions[ i ][ j ][ k ][ *index ] ) );
+        BOOST_CHECK( counters->seconds[ asp::LOCAL_PARTICLE_ASSEMBLY ] >= 0 );
+#else
+        // The instrumentation is removed
+        BOOST_CHECK( counters->calls[ asp::LOCAL_PARTICLE_ASSEMBLY ] == 0 );
 
-                }
+        BOOST_CHECK( counters->calls[ asp::LOCAL_PARTICLE_ENERGY ] == 0 );
+#endif
 
-            }
+        asp.resetInstrumentationCounters( );
 
-        }
+        BOOST_CHECK( counters->calls[ asp::LOCAL_PARTICLE_ASSEMBLY ] == 0 );
 
     }
 
 }
-
@@ -5,6 +5,7 @@
   */
 
 #include<constraint_equations.h>
+#include<surface_integration.h>
 #include<sstream>
 #include<fstream>
 
@@ -210,3 +211,93 @@ BOOST_AUTO_TEST_CASE( test_tractionConstraint ){
     BOOST_CHECK( vectorTools::fuzzyEquals( d2CdTractiondP, d2CdTractiondP_answer ) );
 
 }
+
+BOOST_AUTO_TEST_CASE( test_tractionConstraintBatch ){
+    /*!
+     * Test of the traction constraint evaluated at all of the points of a surface
+     */
+
+    floatVector cauchyStress = { 0.69646919, 0.28613933, 0.22685145,
+                                 0.55131477, 0.71946897, 0.42310646,
+                                 0.9807642 , 0.68482974, 0.4809319 };
+
+    floatType P = 0.7379954057320357;
+
+    floatVector points;
+
+    std::vector< unsigned int > connectivity;
+
+    surfaceIntegration::decomposeSphere( 1.0, 2, points, connectivity );
+
+    const unsigned int numPoints = points.size( ) / 3;
+
+    floatVector tractions( points.size( ), 0 );
+
+    for ( unsigned int i = 0; i < tractions.size( ); i++ ){
+
+        tractions[ i ] = 0.1 * ( i % 7 ) - 0.2;
+
+    }
+
+    floatVector C, dCdCauchyStress, dCdNormal, dCdTraction, dCdP;
+
+    constraintEquations::tractionConstraintBatch( numPoints, cauchyStress, points, tractions, P, C );
+
+    floatVector C_2;
+
+    constraintEquations::tractionConstraintBatch( numPoints, cauchyStress, points, tractions, P, C_2, dCdCauchyStress, dCdNormal, dCdTraction, dCdP );
+
+    BOOST_CHECK( C.size( ) == numPoints );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( C_2, C ) );
+
+    BOOST_CHECK( dCdCauchyStress.size( ) == 9 * numPoints );
+
+    BOOST_CHECK( dCdNormal.size( ) == 3 * numPoints );
+
+    BOOST_CHECK( dCdTraction.size( ) == 3 * numPoints );
+
+    BOOST_CHECK( dCdP.size( ) == numPoints );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        floatVector normal( points.begin( ) + 3 * p, points.begin( ) + 3 * ( p + 1 ) );
+
+        floatVector traction( tractions.begin( ) + 3 * p, tractions.begin( ) + 3 * ( p + 1 ) );
+
+        floatType C_answer, dCdP_answer;
+
+        floatVector dCdCauchyStress_answer, dCdNormal_answer, dCdTraction_answer;
+
+        constraintEquations::tractionConstraint( cauchyStress, normal, traction, P, C_answer, dCdCauchyStress_answer, dCdNormal_answer, dCdTraction_answer, dCdP_answer );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( C[ p ], C_answer ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( dCdCauchyStress.begin( ) + 9 * p, dCdCauchyStress.begin( ) + 9 * ( p + 1 ) ), dCdCauchyStress_answer ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( dCdNormal.begin( ) + 3 * p, dCdNormal.begin( ) + 3 * ( p + 1 ) ), dCdNormal_answer ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( dCdTraction.begin( ) + 3 * p, dCdTraction.begin( ) + 3 * ( p + 1 ) ), dCdTraction_answer ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( dCdP[ p ], dCdP_answer ) );
+
+    }
+
+    // The batched values are integrated over the surface without reshaping
+    floatVector constraintEnergy;
+
+    surfaceIntegration::integrateMesh( points, connectivity, C, constraintEnergy );
+
+    BOOST_CHECK( constraintEnergy.size( ) == 1 );
+
+    floatVector dConstraintEnergydCauchyStress;
+
+    surfaceIntegration::integrateMesh( points, connectivity, dCdCauchyStress, dConstraintEnergydCauchyStress );
+
+    BOOST_CHECK( dConstraintEnergydCauchyStress.size( ) == 9 );
+
+    BOOST_CHECK_THROW( constraintEquations::tractionConstraintBatch( numPoints, cauchyStress, points, floatVector( 3, 0 ), P, C ), std::exception );
+
+    BOOST_CHECK_THROW( constraintEquations::tractionConstraintBatch( numPoints, floatVector( 4, 0 ), points, tractions, P, C ), std::exception );
+
+}
@@ -1097,3 +1097,212 @@ BOOST_AUTO_TEST_CASE( test_integrateMesh ){
     BOOST_CHECK( vectorTools::fuzzyEquals( answer, result ) );
 
 }
+
+BOOST_AUTO_TEST_CASE( test_getUnitSphereQuadrature ){
+
+    unsigned int elementCount = 3;
+
+    floatVector points;
+
+    std::vector< unsigned int > connectivity;
+
+    surfaceIntegration::decomposeSphere( 1.0, elementCount, points, connectivity );
+
+    const surfaceIntegration::unitSphereQuadrature &quadrature = surfaceIntegration::getUnitSphereQuadrature( elementCount );
+
+    BOOST_CHECK( quadrature.elementCount == elementCount );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( quadrature.points, points ) );
+
+    BOOST_CHECK( quadrature.connectivity == connectivity );
+
+    BOOST_CHECK( &quadrature == &surfaceIntegration::getUnitSphereQuadrature( elementCount ) );
+
+    BOOST_CHECK( &quadrature != &surfaceIntegration::getUnitSphereQuadrature( elementCount + 1 ) );
+
+    floatVector Ns;
+
+    floatMatrix dNdxi;
+
+    floatType xi  = 1. / std::sqrt( 3 );
+
+    floatType eta = -1. / std::sqrt( 3 );
+
+    surfaceIntegration::evaluateQuadraticShapeFunctions( xi, eta, Ns );
+
+    surfaceIntegration::evaluateGradQuadraticShapeFunctions( xi, eta, dNdxi );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( quadrature.shapeFunctions.begin( ) + 18, quadrature.shapeFunctions.begin( ) + 27 ), Ns ) );
+
+    for ( unsigned int n = 0; n < 9; n++ ){
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( quadrature.gradShapeFunctions[ 2 * 9 * 2 + 2 * n + 0 ], dNdxi[ n ][ 0 ] ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( quadrature.gradShapeFunctions[ 2 * 9 * 2 + 2 * n + 1 ], dNdxi[ n ][ 1 ] ) );
+
+    }
+
+    floatMatrix nodalPositions_e( 3, floatVector( 9, 0 ) );
+
+    for ( unsigned int n = 0; n < 9; n++ ){
+
+        for ( unsigned int i = 0; i < 3; i++ ){
+
+            nodalPositions_e[ i ][ n ] = points[ 3 * connectivity[ 9 * 5 + n ] + i ];
+
+        }
+
+    }
+
+    floatType jacobian;
+
+    surfaceIntegration::localJacobian( xi, eta, nodalPositions_e, jacobian );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( quadrature.referenceJacobians[ 4 * 5 + 2 ], jacobian ) );
+
+    floatVector nodalValues( points.size( ) / 3, 1 );
+
+    floatVector answer = { 2.77417423 };
+
+    floatVector result;
+
+    surfaceIntegration::integrateSphere( quadrature, 0.47, nodalValues, result );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( answer, result ) );
+
+    std::iota( nodalValues.begin( ), nodalValues.end( ), 0 );
+
+    answer = { 325.44326147 };
+
+    surfaceIntegration::integrateSphere( quadrature, 0.47, nodalValues, result );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( answer, result ) );
+
+    nodalValues = floatVector( 2 * points.size( ) / 3, 0 );
+
+    for ( unsigned int n = 0; n < points.size( ) / 3; n++ ){
+
+        nodalValues[ 2 * n + 0 ] = 1;
+
+        nodalValues[ 2 * n + 1 ] = n;
+
+    }
+
+    answer = { 2.77417423, 325.44326147 };
+
+    surfaceIntegration::integrateSphere( quadrature, 0.47, nodalValues, result );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( answer, result ) );
+
+    BOOST_CHECK_THROW( surfaceIntegration::integrateSphere( quadrature, 0.47, floatVector( 5, 0 ), result ), std::exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_integrateMesh_quadratureOrder ){
+
+    floatVector points;
+
+    std::vector< unsigned int > connectivity;
+
+    surfaceIntegration::decomposeSphere( 0.47, 3, points, connectivity );
+
+    floatVector nodalValues( points.size( ) / 3, 1 );
+
+    floatVector answer2 = { 2.77417423 };
+
+    floatVector answer3 = { 2.77370535 };
+
+    floatVector result;
+
+    surfaceIntegration::integrateMesh( points, connectivity, nodalValues, 2, result );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( answer2, result ) );
+
+    surfaceIntegration::integrateMesh( points, connectivity, nodalValues, 3, result );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( answer3, result ) );
+
+    floatVector linearValues( nodalValues.size( ), 0 );
+
+    std::iota( linearValues.begin( ), linearValues.end( ), 0 );
+
+    surfaceIntegration::integrateMesh( points, connectivity, linearValues, 3, result );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( { 325.07284087 } ), result ) );
+
+    BOOST_CHECK_THROW( surfaceIntegration::integrateMesh( points, connectivity, nodalValues, 4, result ), std::exception );
+
+    BOOST_CHECK_THROW( surfaceIntegration::integrateMesh( points, connectivity, floatVector( nodalValues.size( ) + 1, 1 ), 2, result ), std::exception );
+
+    // Integrate several fields in a single pass
+    floatMatrix fields = { nodalValues, linearValues, floatVector( 2 * nodalValues.size( ), 2 ) };
+
+    floatMatrix answers = { answer2, { 325.44326147 }, { 2 * answer2[ 0 ], 2 * answer2[ 0 ] } };
+
+    floatMatrix results;
+
+    surfaceIntegration::integrateMesh( points, connectivity, fields, results );
+
+    BOOST_CHECK( results.size( ) == answers.size( ) );
+
+    for ( unsigned int f = 0; f < answers.size( ); f++ ){
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( answers[ f ], results[ f ] ) );
+
+    }
+
+    answers = { answer3, { 325.07284087 }, { 2 * answer3[ 0 ], 2 * answer3[ 0 ] } };
+
+    surfaceIntegration::integrateMesh( points, connectivity, fields, 3, results );
+
+    for ( unsigned int f = 0; f < answers.size( ); f++ ){
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( answers[ f ], results[ f ] ) );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_integrateMesh_threads ){
+
+    floatVector points;
+
+    std::vector< unsigned int > connectivity;
+
+    surfaceIntegration::decomposeSphere( 0.47, 5, points, connectivity );
+
+    floatVector linearValues( points.size( ) / 3, 0 );
+
+    std::iota( linearValues.begin( ), linearValues.end( ), 0 );
+
+    floatMatrix fields = { floatVector( linearValues.size( ), 1 ), linearValues, points };
+
+    floatMatrix answers;
+
+    surfaceIntegration::integrateMesh( points, connectivity, fields, 3, answers );
+
+    // The result must be bitwise identical for any number of threads
+    for ( unsigned int numThreads = 1; numThreads < 6; numThreads++ ){
+
+        floatMatrix results;
+
+        surfaceIntegration::integrateMesh( points, connectivity, fields, 3, results, numThreads );
+
+        BOOST_CHECK( results == answers );
+
+        floatVector result;
+
+        surfaceIntegration::integrateMesh( points, connectivity, linearValues, 2, result, numThreads );
+
+        floatVector answer;
+
+        surfaceIntegration::integrateMesh( points, connectivity, linearValues, answer );
+
+        BOOST_CHECK( result == answer );
+
+    }
+
+    // The first moment of the sphere vanishes
+    BOOST_CHECK( vectorTools::fuzzyEquals( answers[ 2 ], floatVector( 3, 0 ) ) );
+
+}
@@ -1228,6 +1228,237 @@ BOOST_AUTO_TEST_CASE( test_computeCurrentDistanceGeneral ){
 
 }
 
+BOOST_AUTO_TEST_CASE( test_computeCurrentDistanceGeneral_fixed ){
+    /*!
+     * Test the fixed size computation of the current distance against the general computation
+     */
+
+    floatVector Xi_1 = { 0.69646919, 0.28613933, 0.22685145 };
+    floatVector Xi_2 = { 0.55131477, 0.71946897, 0.42310646 };
+    floatVector D    = { 0.9807642 , 0.68482974, 0.4809319  };
+
+    floatVector F    = { 0.39211752, 0.34317802, 0.72904971,
+                         0.43857224, 0.0596779 , 0.39804426,
+                         0.73799541, 0.18249173, 0.17545176 };
+
+    floatVector chi  = { 0.53155137, 0.53182759, 0.63440096,
+                         0.84943179, 0.72445532, 0.61102351,
+                         0.72244338, 0.32295891, 0.36178866 };
+
+    floatVector chiNL = { 0.88594794, 0.07791236, 0.97964616,
+                          0.24767146, 0.75288472, 0.52667564,
+                          0.90755375, 0.8840703 , 0.08926896 };
+
+    floatVector d_answer = { 1.02803094, 0.58567184, 1.42330265 };
+
+    tractionSeparation::fixedVector< 3 > Xi_1_fixed, Xi_2_fixed, D_fixed, d;
+
+    tractionSeparation::fixedSecondOrderTensor< 3 > F_fixed, chi_fixed, chiNL_fixed;
+
+    std::copy( Xi_1.begin( ), Xi_1.end( ), Xi_1_fixed.begin( ) );
+    std::copy( Xi_2.begin( ), Xi_2.end( ), Xi_2_fixed.begin( ) );
+    std::copy( D.begin( ), D.end( ), D_fixed.begin( ) );
+    std::copy( F.begin( ), F.end( ), F_fixed.begin( ) );
+    std::copy( chi.begin( ), chi.end( ), chi_fixed.begin( ) );
+    std::copy( chiNL.begin( ), chiNL.end( ), chiNL_fixed.begin( ) );
+
+    tractionSeparation::computeCurrentDistanceGeneral< 3 >( Xi_1_fixed, Xi_2_fixed, D_fixed, F_fixed, chi_fixed, chiNL_fixed, d );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( d.begin( ), d.end( ) ), d_answer ) );
+
+    tractionSeparation::fixedVector< 3 > d_2;
+
+    tractionSeparation::fixedSecondOrderTensor< 3 > dddXi_1, dddXi_2, dddD;
+
+    tractionSeparation::fixedThirdOrderTensor< 3 > dddF, dddchi, dddchiNL;
+
+    tractionSeparation::computeCurrentDistanceGeneral< 3 >( Xi_1_fixed, Xi_2_fixed, D_fixed, F_fixed, chi_fixed, chiNL_fixed, d_2,
+                                                            dddXi_1, dddXi_2, dddD, dddF, dddchi, dddchiNL );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( d_2.begin( ), d_2.end( ) ), d_answer ) );
+
+    // Compare the gradients to the gradients computed with a second, non-fixed size, set of inputs
+    floatVector d_general;
+
+    floatMatrix dddXi_1_general, dddXi_2_general, dddD_general, dddF_general, dddchi_general, dddchiNL_general,
+                d2ddFdXi_1, d2ddchidXi_1, d2ddFdXi_2, d2ddchiNLdXi_2, d2ddFdD;
+
+    tractionSeparation::computeCurrentDistanceGeneral( Xi_1, Xi_2, D, F, chi, chiNL, d_general,
+                                                       dddXi_1_general, dddXi_2_general, dddD_general,
+                                                       dddF_general, dddchi_general, dddchiNL_general,
+                                                       d2ddFdXi_1, d2ddchidXi_1, d2ddFdXi_2, d2ddchiNLdXi_2, d2ddFdD );
+
+    for ( unsigned int i = 0; i < 3; i++ ){
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( dddXi_1.begin( ) + 3 * i, dddXi_1.begin( ) + 3 * ( i + 1 ) ), dddXi_1_general[ i ] ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( dddXi_2.begin( ) + 3 * i, dddXi_2.begin( ) + 3 * ( i + 1 ) ), dddXi_2_general[ i ] ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( dddD.begin( ) + 3 * i, dddD.begin( ) + 3 * ( i + 1 ) ), dddD_general[ i ] ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( dddF.begin( ) + 9 * i, dddF.begin( ) + 9 * ( i + 1 ) ), dddF_general[ i ] ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( dddchi.begin( ) + 9 * i, dddchi.begin( ) + 9 * ( i + 1 ) ), dddchi_general[ i ] ) );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( dddchiNL.begin( ) + 9 * i, dddchiNL.begin( ) + 9 * ( i + 1 ) ), dddchiNL_general[ i ] ) );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_computeCurrentDistanceBatch ){
+    /*!
+     * Test the batched computation of the current distance against the computation for the individual points
+     */
+
+    const unsigned int dim = 3;
+
+    const unsigned int numPoints = 4;
+
+    floatMatrix Xi_1 = { { 0.69646919, 0.28613933, 0.22685145 },
+                         { 0.55131477, 0.71946897, 0.42310646 },
+                         { 0.9807642 , 0.68482974, 0.4809319  },
+                         { 0.39211752, 0.34317802, 0.72904971 } };
+
+    floatMatrix Xi_2 = { { 0.43857224, 0.0596779 , 0.39804426 },
+                         { 0.73799541, 0.18249173, 0.17545176 },
+                         { 0.53155137, 0.53182759, 0.63440096 },
+                         { 0.84943179, 0.72445532, 0.61102351 } };
+
+    floatMatrix D    = { { 0.72244338, 0.32295891, 0.36178866 },
+                         { 0.22826323, 0.29371405, 0.63097612 },
+                         { 0.09210494, 0.43370117, 0.43086276 },
+                         { 0.4936851 , 0.42583029, 0.31226122 } };
+
+    floatVector F    = { 0.39211752, 0.34317802, 0.72904971,
+                         0.43857224, 0.0596779 , 0.39804426,
+                         0.73799541, 0.18249173, 0.17545176 };
+
+    floatVector chi  = { 0.53155137, 0.53182759, 0.63440096,
+                         0.84943179, 0.72445532, 0.61102351,
+                         0.72244338, 0.32295891, 0.36178866 };
+
+    floatVector gradChi( dim * dim * dim );
+
+    for ( unsigned int i = 0; i < gradChi.size( ); i++ ){
+
+        gradChi[ i ] = 0.1 * i - 1;
+
+    }
+
+    floatMatrix chiNL( numPoints, floatVector( dim * dim ) );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        for ( unsigned int i = 0; i < dim * dim; i++ ){
+
+            chiNL[ p ][ i ] = chi[ i ] + 0.05 * ( p + 1 ) * i;
+
+        }
+
+    }
+
+    // Pack the inputs as structures of arrays
+    floatVector Xi_1_soa( dim * numPoints ), Xi_2_soa( dim * numPoints ), D_soa( dim * numPoints ), chiNL_soa( dim * dim * numPoints );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+
+            Xi_1_soa[ numPoints * I + p ] = Xi_1[ p ][ I ];
+
+            Xi_2_soa[ numPoints * I + p ] = Xi_2[ p ][ I ];
+
+            D_soa[ numPoints * I + p ] = D[ p ][ I ];
+
+        }
+
+        for ( unsigned int I = 0; I < dim * dim; I++ ){
+
+            chiNL_soa[ numPoints * I + p ] = chiNL[ p ][ I ];
+
+        }
+
+    }
+
+    floatVector d, dddF, dddChi, dddGradChi;
+
+    tractionSeparation::computeCurrentDistanceBatch( numPoints, Xi_1_soa, Xi_2_soa, D_soa, F, chi, gradChi, d, dddF, dddChi, dddGradChi );
+
+    floatVector dGeneral, dddFGeneral, dddchiGeneral, dddchiNLGeneral;
+
+    tractionSeparation::computeCurrentDistanceGeneralBatch( numPoints, Xi_1_soa, Xi_2_soa, D_soa, F, chi, chiNL_soa, dGeneral,
+                                                            dddFGeneral, dddchiGeneral, dddchiNLGeneral );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        floatVector d_answer;
+
+        floatMatrix dddXi_1_answer, dddXi_2_answer, dddD_answer, dddF_answer, dddChi_answer, dddGradChi_answer;
+
+        tractionSeparation::computeCurrentDistance( Xi_1[ p ], Xi_2[ p ], D[ p ], F, chi, gradChi, d_answer,
+                                                    dddXi_1_answer, dddXi_2_answer, dddD_answer,
+                                                    dddF_answer, dddChi_answer, dddGradChi_answer );
+
+        floatVector dGeneral_answer;
+
+        floatMatrix dddXi_1General_answer, dddXi_2General_answer, dddDGeneral_answer, dddFGeneral_answer, dddchiGeneral_answer, dddchiNLGeneral_answer;
+
+        tractionSeparation::computeCurrentDistanceGeneral( Xi_1[ p ], Xi_2[ p ], D[ p ], F, chi, chiNL[ p ], dGeneral_answer,
+                                                           dddXi_1General_answer, dddXi_2General_answer, dddDGeneral_answer,
+                                                           dddFGeneral_answer, dddchiGeneral_answer, dddchiNLGeneral_answer );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            BOOST_CHECK( vectorTools::fuzzyEquals( d[ numPoints * i + p ], d_answer[ i ] ) );
+
+            BOOST_CHECK( vectorTools::fuzzyEquals( dGeneral[ numPoints * i + p ], dGeneral_answer[ i ] ) );
+
+            for ( unsigned int I = 0; I < dim * dim; I++ ){
+
+                BOOST_CHECK( vectorTools::fuzzyEquals( dddF[ numPoints * ( dim * dim * i + I ) + p ], dddF_answer[ i ][ I ] ) );
+
+                BOOST_CHECK( vectorTools::fuzzyEquals( dddChi[ numPoints * ( dim * dim * i + I ) + p ], dddChi_answer[ i ][ I ] ) );
+
+                BOOST_CHECK( vectorTools::fuzzyEquals( dddFGeneral[ numPoints * ( dim * dim * i + I ) + p ], dddFGeneral_answer[ i ][ I ] ) );
+
+                BOOST_CHECK( vectorTools::fuzzyEquals( dddchiGeneral[ numPoints * ( dim * dim * i + I ) + p ], dddchiGeneral_answer[ i ][ I ] ) );
+
+                BOOST_CHECK( vectorTools::fuzzyEquals( dddchiNLGeneral[ numPoints * ( dim * dim * i + I ) + p ], dddchiNLGeneral_answer[ i ][ I ] ) );
+
+            }
+
+            for ( unsigned int I = 0; I < dim * dim * dim; I++ ){
+
+                BOOST_CHECK( vectorTools::fuzzyEquals( dddGradChi[ numPoints * ( dim * dim * dim * i + I ) + p ], dddGradChi_answer[ i ][ I ] ) );
+
+            }
+
+        }
+
+    }
+
+    floatVector d_batch;
+
+    tractionSeparation::computeCurrentDistanceBatch( numPoints, Xi_1_soa, Xi_2_soa, D_soa, F, chi, gradChi, d_batch );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( d_batch, d ) );
+
+    floatVector dGeneral_batch;
+
+    tractionSeparation::computeCurrentDistanceGeneralBatch( numPoints, Xi_1_soa, Xi_2_soa, D_soa, F, chi, chiNL_soa, dGeneral_batch );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( dGeneral_batch, dGeneral ) );
+
+    // Check that inconsistent sizes are detected
+    floatVector D_incorrect( dim * numPoints - 1 );
+
+    BOOST_CHECK_THROW( tractionSeparation::computeCurrentDistanceBatch( numPoints, Xi_1_soa, Xi_2_soa, D_incorrect, F, chi, gradChi, d_batch ), std::exception );
+
+    BOOST_CHECK_THROW( tractionSeparation::computeCurrentDistanceGeneralBatch( numPoints, Xi_1_soa, Xi_2_soa, D_soa, F, chi, chi, dGeneral_batch ), std::exception );
+
+}
+
 BOOST_AUTO_TEST_CASE( test_decomposeVector ){
     /*!
      * Test the decomposition of a vector into normal and tangential parts
@@ -3285,6 +3516,145 @@ BOOST_AUTO_TEST_CASE( test_solveOverlapDistance ){
 
 }
 
+BOOST_AUTO_TEST_CASE( test_solveOverlapDistance_warmStart ){
+    /*!
+     * Test the warm started and batched solutions of the overlap distance
+     */
+
+    floatVector chi_nl = { 1.69646919, 0.28613933, 0.22685145,
+                           0.55131477, 1.71946897, 0.42310646,
+                           0.9807642 , 0.68482974, 1.4809319 };
+
+    floatVector xi_t = { 0.39211752, 0.34317802, 0.72904971 };
+
+    floatType R_nl = 2.3;
+
+    floatVector distance_answer = { -0.881778439521, -0.787105632647, 1.57022824141 };
+
+    floatVector X, distance;
+
+    tractionSeparation::solveOverlapDistance( chi_nl, xi_t, R_nl, X, distance );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( distance, distance_answer ) );
+
+    BOOST_CHECK( X.size( ) == 4 );
+
+    floatVector Xi( X.begin( ), X.begin( ) + 3 );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( vectorTools::dot( Xi, Xi ), R_nl * R_nl ) );
+
+    // Seeding with the converged solution should not require any further iterations
+    floatVector X_warm = X;
+
+    floatVector distance_warm;
+
+    tractionSeparation::solveOverlapDistance( chi_nl, xi_t, R_nl, X_warm, distance_warm, 1e-9, 1e-9, 0 );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( distance_warm, distance_answer ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( X_warm, X ) );
+
+    // The warm started gradients should match the cold started ones
+    floatMatrix dddchi_nl, dddxi_t;
+
+    floatVector dddR_nl;
+
+    tractionSeparation::solveOverlapDistance( chi_nl, xi_t, R_nl, distance, dddchi_nl, dddxi_t, dddR_nl );
+
+    floatMatrix dddchi_nl_warm, dddxi_t_warm;
+
+    floatVector dddR_nl_warm;
+
+    X_warm = X;
+
+    tractionSeparation::solveOverlapDistance( chi_nl, xi_t, R_nl, X_warm, distance_warm, dddchi_nl_warm, dddxi_t_warm, dddR_nl_warm );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( distance_warm, distance ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( dddchi_nl_warm, dddchi_nl ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( dddxi_t_warm, dddxi_t ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( dddR_nl_warm, dddR_nl ) );
+
+    // Solve for several points at once
+    const unsigned int numPoints = 3;
+
+    floatVector xi_t_batch = { 0.39211752, 0.34317802, 0.72904971,
+                               0.5,        0.4,        0.9,
+                              -0.5,        0.25,       0.1 };
+
+    floatVector X_batch, distance_batch;
+
+    tractionSeparation::solveOverlapDistanceBatch( numPoints, chi_nl, xi_t_batch, R_nl, X_batch, distance_batch );
+
+    BOOST_CHECK( X_batch.size( ) == 4 * numPoints );
+
+    BOOST_CHECK( distance_batch.size( ) == 3 * numPoints );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        floatVector xi_p( xi_t_batch.begin( ) + 3 * p, xi_t_batch.begin( ) + 3 * ( p + 1 ) );
+
+        floatVector distance_p;
+
+        tractionSeparation::solveOverlapDistance( chi_nl, xi_p, R_nl, distance_p );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( floatVector( distance_batch.begin( ) + 3 * p, distance_batch.begin( ) + 3 * ( p + 1 ) ), distance_p ) );
+
+    }
+
+    // Warm start the batch with the previous solution
+    floatVector X_batch_warm = X_batch, distance_batch_warm;
+
+    tractionSeparation::solveOverlapDistanceBatch( numPoints, chi_nl, xi_t_batch, R_nl, X_batch_warm, distance_batch_warm, 1e-9, 1e-9, 0 );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( distance_batch_warm, distance_batch ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( X_batch_warm, X_batch ) );
+
+    BOOST_CHECK_THROW( tractionSeparation::solveOverlapDistanceBatch( 2, chi_nl, xi_t_batch, R_nl, X_batch, distance_batch ), std::exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_solveOverlapDistance_convergenceError ){
+    /*!
+     * Test that a failure of the overlap distance solve is reported as a convergence error
+     */
+
+    floatVector chi_nl = { 1.69646919, 0.28613933, 0.22685145,
+                           0.55131477, 1.71946897, 0.42310646,
+                           0.9807642 , 0.68482974, 1.4809319 };
+
+    floatVector xi_t = { 0.39211752, 0.34317802, 0.72904971 };
+
+    floatType R_nl = 2.3;
+
+    floatVector distance;
+
+    BOOST_CHECK_THROW( tractionSeparation::solveOverlapDistance( chi_nl, xi_t, R_nl, distance, 1e-9, 1e-9, 0 ), tractionSeparation::convergenceError );
+
+    // A line-search failure is a convergence error which is still recorded by the solver statistics
+    floatVector xi_t_linesearch = { 0.1, 0.2, 0.3 };
+
+    const unsigned long long initialSolves = tractionSeparation::getOverlapSolverStatistics( ).solves;
+
+    BOOST_CHECK_THROW( tractionSeparation::solveOverlapDistance( chi_nl, xi_t_linesearch, R_nl, distance ), tractionSeparation::convergenceError );
+
+#ifdef ASP_INSTRUMENTATION
+    BOOST_CHECK( tractionSeparation::getOverlapSolverStatistics( ).solves == initialSolves + 1 );
+#else
+    BOOST_CHECK( tractionSeparation::getOverlapSolverStatistics( ).solves == initialSolves );
+#endif
+
+    BOOST_CHECK_NO_THROW( tractionSeparation::checkSolverStatus( tractionSeparation::SOLVER_CONVERGED ) );
+
+    BOOST_CHECK_THROW( tractionSeparation::checkSolverStatus( tractionSeparation::SOLVER_LINESEARCH_FAILURE ), tractionSeparation::convergenceError );
+
+    BOOST_CHECK_THROW( tractionSeparation::checkSolverStatus( tractionSeparation::SOLVER_NOT_CONVERGED ), tractionSeparation::convergenceError );
+
+}
+
 BOOST_AUTO_TEST_CASE( test_computeParticleOverlap ){
 
     floatVector Xi_1 = { 1, 0, 0 };
@@ -13585,3 +13955,231 @@ BOOST_AUTO_TEST_CASE( test_computeLinearTraction ){
     BOOST_CHECK( vectorTools::fuzzyEquals( d2tractionddtdp, d2tractionddtdp_answer ) );
 
 }
+
+BOOST_AUTO_TEST_CASE( test_adhesionPairBatch ){
+    /*!
+     * Test the fused evaluation of the linear traction separation responses of a batch of pairs against the per-pair
+     * functions and finite differences
+     */
+
+    const unsigned int dim = 3;
+
+    const unsigned int numPairs = 4;
+
+    floatVector F = { 1.05, 0.02, -0.01,
+                      0.03, 0.97, 0.04,
+                     -0.02, 0.01, 1.02 };
+
+    floatVector chi = { 0.98, -0.03, 0.02,
+                        0.01, 1.04, -0.02,
+                        0.03, 0.02, 0.99 };
+
+    floatVector parameters = { 2.3, 0.7 };
+
+    floatVector Xi_1( dim * numPairs ), Xi_2( dim * numPairs ), D( dim * numPairs ), normals( dim * numPairs );
+
+    floatVector chiNL( dim * dim * numPairs ), weights( numPairs );
+
+    for ( unsigned int p = 0; p < numPairs; p++ ){
+
+        floatVector n = { std::cos( 0.7 * p ) * std::sin( 0.3 + 0.5 * p ), std::sin( 0.7 * p ) * std::sin( 0.3 + 0.5 * p ), std::cos( 0.3 + 0.5 * p ) };
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+
+            Xi_1[ numPairs * I + p ] = 0.1 * ( I + 1 ) + 0.05 * p;
+
+            Xi_2[ numPairs * I + p ] = -0.2 * ( I + 1 ) + 0.03 * p * p;
+
+            D[ numPairs * I + p ] = 1.0 * ( I == 0 ) + 0.1 * p;
+
+            normals[ numPairs * I + p ] = n[ I ];
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                chiNL[ numPairs * ( dim * i + I ) + p ] = ( i == I ) + 0.01 * ( i + 2 * I + 3 * p + 1 );
+
+            }
+
+        }
+
+        weights[ p ] = 0.25 + 0.1 * p;
+
+    }
+
+    tractionSeparation::adhesionPairBatch batch;
+
+    BOOST_CHECK_THROW( batch.evaluate( F, chi, chiNL, normals, parameters ), std::exception );
+
+    BOOST_CHECK_THROW( batch.setReferencePairs( numPairs, Xi_1, Xi_2, floatVector( dim * numPairs - 1 ), weights ), std::exception );
+
+    batch.setReferencePairs( numPairs, Xi_1, Xi_2, D, weights );
+
+    BOOST_CHECK( batch.getNumPairs( ) == numPairs );
+
+    BOOST_CHECK( batch.getReferenceUploads( ) == 1 );
+
+    BOOST_CHECK_THROW( batch.evaluate( F, chi, floatVector( dim * dim ), normals, parameters ), std::exception );
+
+    // The results are independent of the number of host threads
+    batch.evaluate( F, chi, chiNL, normals, parameters, 2 );
+
+    const floatVector threadedTractions = batch.getTractions( );
+
+    const floatType threadedEnergy = batch.getEnergy( );
+
+    batch.evaluate( F, chi, chiNL, normals, parameters );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( batch.getTractions( ), threadedTractions ) );
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( batch.getEnergy( ), threadedEnergy ) );
+
+    // Compare with the per-pair functions
+    floatType energyAnswer = 0;
+
+    for ( unsigned int p = 0; p < numPairs; p++ ){
+
+        floatVector xi_1( dim ), xi_2( dim ), d_0( dim ), n( dim ), chi_nl( dim * dim );
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+
+            xi_1[ I ] = Xi_1[ numPairs * I + p ];
+
+            xi_2[ I ] = Xi_2[ numPairs * I + p ];
+
+            d_0[ I ] = D[ numPairs * I + p ];
+
+            n[ I ] = normals[ numPairs * I + p ];
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                chi_nl[ dim * i + I ] = chiNL[ numPairs * ( dim * i + I ) + p ];
+
+            }
+
+        }
+
+        floatVector d, dn, dt, traction;
+
+        floatType energy;
+
+        tractionSeparation::computeCurrentDistanceGeneral( xi_1, xi_2, d_0, F, chi, chi_nl, d );
+
+        tractionSeparation::decomposeVector( d, n, dn, dt );
+
+        tractionSeparation::computeLinearTraction( dn, dt, parameters, traction );
+
+        tractionSeparation::computeLinearTractionEnergy( dn, dt, parameters, energy );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( batch.getEnergies( )[ p ], energy ) );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            BOOST_CHECK( vectorTools::fuzzyEquals( batch.getTractions( )[ numPairs * i + p ], traction[ i ] ) );
+
+        }
+
+        energyAnswer += weights[ p ] * energy;
+
+    }
+
+    BOOST_CHECK( vectorTools::fuzzyEquals( batch.getEnergy( ), energyAnswer ) );
+
+    // Compare the gradients with finite differences
+    const floatType eps = 1e-6;
+
+    const floatVector dEnergydF = batch.getdEnergydF( );
+
+    const floatVector dEnergydChi = batch.getdEnergydChi( );
+
+    const floatVector dEnergydChiNL = batch.getdEnergydChiNL( );
+
+    const floatVector dEnergydNormals = batch.getdEnergydNormals( );
+
+    for ( unsigned int k = 0; k < dim * dim; k++ ){
+
+        floatType delta = eps * std::fabs( F[ k ] ) + eps;
+
+        floatVector Fp = F, Fm = F;
+
+        Fp[ k ] += delta;
+
+        Fm[ k ] -= delta;
+
+        batch.evaluate( Fp, chi, chiNL, normals, parameters );
+
+        floatType ep = batch.getEnergy( );
+
+        batch.evaluate( Fm, chi, chiNL, normals, parameters );
+
+        floatType em = batch.getEnergy( );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( ( ep - em ) / ( 2 * delta ), dEnergydF[ k ], 1e-5, 1e-6 ) );
+
+        delta = eps * std::fabs( chi[ k ] ) + eps;
+
+        floatVector chip = chi, chim = chi;
+
+        chip[ k ] += delta;
+
+        chim[ k ] -= delta;
+
+        batch.evaluate( F, chip, chiNL, normals, parameters );
+
+        ep = batch.getEnergy( );
+
+        batch.evaluate( F, chim, chiNL, normals, parameters );
+
+        em = batch.getEnergy( );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( ( ep - em ) / ( 2 * delta ), dEnergydChi[ k ], 1e-5, 1e-6 ) );
+
+    }
+
+    for ( unsigned int k = 0; k < dim * dim * numPairs; k++ ){
+
+        floatType delta = eps * std::fabs( chiNL[ k ] ) + eps;
+
+        floatVector chiNLp = chiNL, chiNLm = chiNL;
+
+        chiNLp[ k ] += delta;
+
+        chiNLm[ k ] -= delta;
+
+        batch.evaluate( F, chi, chiNLp, normals, parameters );
+
+        floatType ep = batch.getEnergy( );
+
+        batch.evaluate( F, chi, chiNLm, normals, parameters );
+
+        floatType em = batch.getEnergy( );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( ( ep - em ) / ( 2 * delta ), dEnergydChiNL[ k ], 1e-5, 1e-6 ) );
+
+    }
+
+    for ( unsigned int k = 0; k < dim * numPairs; k++ ){
+
+        floatType delta = eps * std::fabs( normals[ k ] ) + eps;
+
+        floatVector normalsp = normals, normalsm = normals;
+
+        normalsp[ k ] += delta;
+
+        normalsm[ k ] -= delta;
+
+        batch.evaluate( F, chi, chiNL, normalsp, parameters );
+
+        floatType ep = batch.getEnergy( );
+
+        batch.evaluate( F, chi, chiNL, normalsm, parameters );
+
+        floatType em = batch.getEnergy( );
+
+        BOOST_CHECK( vectorTools::fuzzyEquals( ( ep - em ) / ( 2 * delta ), dEnergydNormals[ k ], 1e-5, 1e-6 ) );
+
+    }
+
+    // The reference pairs remain resident between the evaluations
+    BOOST_CHECK( batch.getReferenceUploads( ) == 1 );
+
+}
@@ -10,8 +10,74 @@
 
 #include<traction_separation.h>
 
+#include<algorithm>
+
+#ifdef ASP_OPENMP_OFFLOAD
+#include<omp.h>
+#endif
+
 namespace tractionSeparation{
 
+    namespace{
+
+        template< unsigned int n >
+        fixedVector< n > toFixed( const floatVector &value ){
+            /*!
+             * Copy a vector into a fixed size array. The size of the vector is assumed to have been checked.
+             * 
+             * \param &value: The vector to copy
+             */
+
+            fixedVector< n > result;
+
+            std::copy( value.begin( ), value.begin( ) + n, result.begin( ) );
+
+            return result;
+
+        }
+
+        template< unsigned int dim, std::size_t n >
+        void toMatrix( const std::array< floatType, n > &value, floatMatrix &result ){
+            /*!
+             * Copy a fixed size row-major array with dim rows into a matrix
+             * 
+             * \param &value: The fixed size array
+             * \param &result: The resulting matrix
+             */
+
+            const unsigned int nCols = n / dim;
+
+            result.resize( dim );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                result[ i ].assign( value.begin( ) + nCols * i, value.begin( ) + nCols * ( i + 1 ) );
+
+            }
+
+        }
+
+        template< unsigned int dim >
+        bool isFixedSize( const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
+                          const floatVector &F, const floatVector &chi, const floatVector &chiNL ){
+            /*!
+             * Check if the inputs to the current distance have the sizes of the fixed size kernels
+             * 
+             * \param &Xi_1: The relative micro-position vector for the local particle
+             * \param &Xi_2: The relative micro-position vector for the non-local particle
+             * \param &D: The initial separation between the particles
+             * \param &F: The deformation gradient
+             * \param &chi: The micro-deformation
+             * \param &chiNL: the non-local micro-deformation
+             */
+
+            return ( Xi_1.size( ) == dim ) && ( Xi_2.size( ) == dim ) && ( D.size( ) == dim ) &&
+                   ( F.size( ) == dim * dim ) && ( chi.size( ) == dim * dim ) && ( chiNL.size( ) == dim * dim );
+
+        }
+
+    }
+
     void computeCurrentDistanceGeneral( const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
                                             const floatVector &F,    const floatVector &chi,  const floatVector &chiNL,
                                             floatVector &d ){
@@ -37,6 +103,21 @@ namespace tractionSeparation{
          * \param &d: The current separation between the particles
          */
 
+        if ( isFixedSize< 3 >( Xi_1, Xi_2, D, F, chi, chiNL ) ){
+
+            // Use the fixed size kernel for three dimensions
+            fixedVector< 3 > d_fixed;
+
+            computeCurrentDistanceGeneral< 3 >( toFixed< 3 >( Xi_1 ), toFixed< 3 >( Xi_2 ), toFixed< 3 >( D ),
+                                                toFixed< 9 >( F ), toFixed< 9 >( chi ), toFixed< 9 >( chiNL ),
+                                                d_fixed );
+
+            d = floatVector( d_fixed.begin( ), d_fixed.end( ) );
+
+            return;
+
+        }
+
         floatVector dX = Xi_1 + D - Xi_2;
 
         floatVector dx( dX.size( ), 0 );
@@ -97,6 +178,39 @@ namespace tractionSeparation{
          * \param &dddchi: The gradient of d w.r.t. the local micro-deformation tensor
          * \param &dddchiNL: The gradient of d w.r.t. the non-local micro-deformation tensor
          */
+
+        if ( isFixedSize< 3 >( Xi_1, Xi_2, D, F, chi, chiNL ) ){
+
+            // Use the fixed size kernel for three dimensions
+            fixedVector< 3 > d_fixed;
+
+            fixedSecondOrderTensor< 3 > dddXi_1_fixed, dddXi_2_fixed, dddD_fixed;
+
+            fixedThirdOrderTensor< 3 > dddF_fixed, dddchi_fixed, dddchiNL_fixed;
+
+            computeCurrentDistanceGeneral< 3 >( toFixed< 3 >( Xi_1 ), toFixed< 3 >( Xi_2 ), toFixed< 3 >( D ),
+                                                toFixed< 9 >( F ), toFixed< 9 >( chi ), toFixed< 9 >( chiNL ),
+                                                d_fixed, dddXi_1_fixed, dddXi_2_fixed, dddD_fixed,
+                                                dddF_fixed, dddchi_fixed, dddchiNL_fixed );
+
+            d = floatVector( d_fixed.begin( ), d_fixed.end( ) );
+
+            toMatrix< 3 >( dddXi_1_fixed, dddXi_1 );
+
+            toMatrix< 3 >( dddXi_2_fixed, dddXi_2 );
+
+            toMatrix< 3 >( dddD_fixed, dddD );
+
+            toMatrix< 3 >( dddF_fixed, dddF );
+
+            toMatrix< 3 >( dddchi_fixed, dddchi );
+
+            toMatrix< 3 >( dddchiNL_fixed, dddchiNL );
+
+            return;
+
+        }
+
         floatVector dX = Xi_1 + D - Xi_2;
 
         floatVector dx( dX.size( ), 0 );
@@ -231,43 +345,546 @@ namespace tractionSeparation{
 
         vectorTools::eye( eye );
 
-        for ( unsigned int i = 0; i < dX.size( ); i++ ){
+        for ( unsigned int i = 0; i < dX.size( ); i++ ){
+
+            for ( unsigned int I = 0; I < dX.size( ); I++ ){
+
+                dx[ i ] += F[ dX.size( ) * i + I ] * dX[ I ];
+
+                xi_1[ i ] += chi[ dX.size( ) * i + I ] * Xi_1[ I ];
+
+                xi_2[ i ] += chiNL[ dX.size( ) * i + I ] * Xi_2[ I ];
+
+                dddXi_1[ i ][ I ] =  F[ dX.size( ) * i + I ] - chi[ dX.size( ) * i + I ];
+
+                dddXi_2[ i ][ I ] = -F[ dX.size( ) * i + I ] + chiNL[ dX.size( ) * i + I ];
+
+                dddD[ i ][ I ] = F[ dX.size( ) * i + I ];
+
+                for ( unsigned int A = 0; A < dX.size( ); A++ ){
+
+                    dddF[ i ][ dX.size( ) * I + A ]     =  eye[ dX.size( ) * i + I ] * dX[ A ];
+
+                    dddchi[ i ][ dX.size( ) * I + A ]   = -eye[ dX.size( ) * i + I ] * Xi_1[ A ];
+
+                    dddchiNL[ i ][ dX.size( ) * I + A ] =  eye[ dX.size( ) * i + I ] * Xi_2[ A ];
+
+                }
+
+            }
+
+            // The second gradients are only non-zero when I = i and a = A
+            for ( unsigned int A = 0; A < dX.size( ); A++ ){
+
+                d2ddFdXi_1[ i ][ dX.size( ) * dX.size( ) * i + dX.size( ) * A + A ]     =  1;
+
+                d2ddchidXi_1[ i ][ dX.size( ) * dX.size( ) * i + dX.size( ) * A + A ]   = -1;
+
+                d2ddFdXi_2[ i ][ dX.size( ) * dX.size( ) * i + dX.size( ) * A + A ]     = -1;
+
+                d2ddchiNLdXi_2[ i ][ dX.size( ) * dX.size( ) * i + dX.size( ) * A + A ] =  1;
+
+                d2ddFdD[ i ][ dX.size( ) * dX.size( ) * i + dX.size( ) * A + A ]        =  1;
+
+            }
+
+        }
+
+        d = dx - xi_1 + xi_2;
+
+        return;
+
+    }
+
+    template< unsigned int dim >
+    void computeCurrentDistanceGeneral( const fixedVector< dim > &Xi_1, const fixedVector< dim > &Xi_2, const fixedVector< dim > &D,
+                                            const fixedSecondOrderTensor< dim > &F, const fixedSecondOrderTensor< dim > &chi,
+                                            const fixedSecondOrderTensor< dim > &chiNL,
+                                            fixedVector< dim > &d ){
+        /*!
+         * Compute the distance in the current configuration using fixed size arrays so that the loops can be unrolled
+         * 
+         * \f$d_i = F_{iI} dX_I - \chi_{iI} \Xi_I^1 + \chi_{iI}^{NL} \Xi_I^2 \f$
+         * 
+         * \f$dX_I = \Xi_I^1 + D_I - \Xi_I^2 \f$
+         * 
+         * \param &Xi_1: The relative micro-position vector for the local particle
+         * \param &Xi_2: The relative micro-position vector for the non-local particle
+         * \param &D: The initial separation between the particles
+         * \param &F: The deformation gradient \f$\frac{dx_i}{dX_I}\f$
+         * \param &chi: The micro-deformation
+         * \param &chiNL: the non-local micro-deformation at \f$\Xi_2\f$
+         * \param &d: The current separation between the particles
+         */
+
+        fixedVector< dim > dX;
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+
+            dX[ I ] = Xi_1[ I ] + D[ I ] - Xi_2[ I ];
+
+        }
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            d[ i ] = 0;
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                d[ i ] += F[ dim * i + I ] * dX[ I ] - chi[ dim * i + I ] * Xi_1[ I ] + chiNL[ dim * i + I ] * Xi_2[ I ];
+
+            }
+
+        }
+
+    }
+
+    template< unsigned int dim >
+    void computeCurrentDistanceGeneral( const fixedVector< dim > &Xi_1, const fixedVector< dim > &Xi_2, const fixedVector< dim > &D,
+                                            const fixedSecondOrderTensor< dim > &F, const fixedSecondOrderTensor< dim > &chi,
+                                            const fixedSecondOrderTensor< dim > &chiNL,
+                                            fixedVector< dim > &d,
+                                            fixedSecondOrderTensor< dim > &dddXi_1, fixedSecondOrderTensor< dim > &dddXi_2,
+                                            fixedSecondOrderTensor< dim > &dddD,
+                                            fixedThirdOrderTensor< dim > &dddF, fixedThirdOrderTensor< dim > &dddchi,
+                                            fixedThirdOrderTensor< dim > &dddchiNL ){
+        /*!
+         * Compute the distance in the current configuration and its gradients using fixed size arrays so that the loops
+         * can be unrolled
+         * 
+         * \f$d_i = F_{iI} dX_I - \chi_{iI} \Xi_I^1 + \chi_{iI}^{NL} \Xi_I^2 \f$
+         * 
+         * \f$dX_I = \Xi_I^1 + D_I - \Xi_I^2 \f$
+         * 
+         * The gradients w.r.t. the tensors are stored in row-major order i.e., \f$\frac{\partial d_i}{\partial F_{IA}}\f$ is
+         * stored at dddF[ dim * dim * i + dim * I + A ]
+         * 
+         * \param &Xi_1: The relative micro-position vector for the local particle
+         * \param &Xi_2: The relative micro-position vector for the non-local particle
+         * \param &D: The initial separation between the particles
+         * \param &F: The deformation gradient \f$\frac{dx_i}{dX_I}\f$
+         * \param &chi: The micro-deformation
+         * \param &chiNL: the non-local micro-deformation at \f$\Xi_2\f$
+         * \param &d: The current separation between the particles
+         * \param &dddXi_1: The gradient of d w.r.t. the local reference relative position vector
+         * \param &dddXi_2: The gradient of d w.r.t. the non-local reference relative position vector
+         * \param &dddD: The gradient of d w.r.t. the reference distance vector
+         * \param &dddF: The gradient of d w.r.t. the deformation gradient
+         * \param &dddchi: The gradient of d w.r.t. the local micro-deformation tensor
+         * \param &dddchiNL: The gradient of d w.r.t. the non-local micro-deformation tensor
+         */
+
+        fixedVector< dim > dX;
+
+        for ( unsigned int I = 0; I < dim; I++ ){
+
+            dX[ I ] = Xi_1[ I ] + D[ I ] - Xi_2[ I ];
+
+        }
+
+        dddF.fill( 0 );
+
+        dddchi.fill( 0 );
+
+        dddchiNL.fill( 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            d[ i ] = 0;
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                d[ i ] += F[ dim * i + I ] * dX[ I ] - chi[ dim * i + I ] * Xi_1[ I ] + chiNL[ dim * i + I ] * Xi_2[ I ];
+
+                dddXi_1[ dim * i + I ] =  F[ dim * i + I ] - chi[ dim * i + I ];
+
+                dddXi_2[ dim * i + I ] = -F[ dim * i + I ] + chiNL[ dim * i + I ];
+
+                dddD[ dim * i + I ] = F[ dim * i + I ];
+
+            }
+
+            // Only the terms where the first index of the tensor matches the index of d are non-zero
+            for ( unsigned int A = 0; A < dim; A++ ){
+
+                dddF[ dim * dim * i + dim * i + A ]     =  dX[ A ];
+
+                dddchi[ dim * dim * i + dim * i + A ]   = -Xi_1[ A ];
+
+                dddchiNL[ dim * dim * i + dim * i + A ] =  Xi_2[ A ];
+
+            }
+
+        }
+
+    }
+
+    template void computeCurrentDistanceGeneral< 3 >( const fixedVector< 3 > &Xi_1, const fixedVector< 3 > &Xi_2, const fixedVector< 3 > &D,
+                                                          const fixedSecondOrderTensor< 3 > &F, const fixedSecondOrderTensor< 3 > &chi,
+                                                          const fixedSecondOrderTensor< 3 > &chiNL,
+                                                          fixedVector< 3 > &d );
+
+    template void computeCurrentDistanceGeneral< 3 >( const fixedVector< 3 > &Xi_1, const fixedVector< 3 > &Xi_2, const fixedVector< 3 > &D,
+                                                          const fixedSecondOrderTensor< 3 > &F, const fixedSecondOrderTensor< 3 > &chi,
+                                                          const fixedSecondOrderTensor< 3 > &chiNL,
+                                                          fixedVector< 3 > &d,
+                                                          fixedSecondOrderTensor< 3 > &dddXi_1, fixedSecondOrderTensor< 3 > &dddXi_2,
+                                                          fixedSecondOrderTensor< 3 > &dddD,
+                                                          fixedThirdOrderTensor< 3 > &dddF, fixedThirdOrderTensor< 3 > &dddchi,
+                                                          fixedThirdOrderTensor< 3 > &dddchiNL );
+
+    namespace{
+
+        unsigned int checkBatchSizes( const unsigned int &numPoints, const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
+                                      const floatVector &F, const floatVector &chi ){
+            /*!
+             * Check the sizes of the structure-of-arrays inputs to the batched current distance computations and return
+             * the spatial dimension
+             * 
+             * \param &numPoints: The number of points in the batch
+             * \param &Xi_1: The relative micro-position vectors for the local particle
+             * \param &Xi_2: The relative micro-position vectors for the non-local particle
+             * \param &D: The initial separations between the particles
+             * \param &F: The deformation gradient
+             * \param &chi: The micro-deformation
+             */
+
+            TARDIGRADE_ERROR_TOOLS_CHECK( numPoints > 0, "The batch must contain at least one point" );
+
+            TARDIGRADE_ERROR_TOOLS_CHECK( ( Xi_1.size( ) % numPoints ) == 0, "The size of Xi_1 ( " + std::to_string( Xi_1.size( ) ) + " ) is not a multiple of the number of points ( " + std::to_string( numPoints ) + " )" );
+
+            const unsigned int dim = Xi_1.size( ) / numPoints;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK( Xi_2.size( ) == Xi_1.size( ), "Xi_2 has a size of " + std::to_string( Xi_2.size( ) ) + " but should have a size of " + std::to_string( Xi_1.size( ) ) );
+
+            TARDIGRADE_ERROR_TOOLS_CHECK( D.size( ) == Xi_1.size( ), "D has a size of " + std::to_string( D.size( ) ) + " but should have a size of " + std::to_string( Xi_1.size( ) ) );
+
+            TARDIGRADE_ERROR_TOOLS_CHECK( F.size( ) == dim * dim, "The deformation gradient has a size of " + std::to_string( F.size( ) ) + " but should have a size of " + std::to_string( dim * dim ) );
+
+            TARDIGRADE_ERROR_TOOLS_CHECK( chi.size( ) == dim * dim, "The micro-deformation has a size of " + std::to_string( chi.size( ) ) + " but should have a size of " + std::to_string( dim * dim ) );
+
+            return dim;
+
+        }
+
+    }
+
+    void computeCurrentDistanceBatch( const unsigned int &numPoints,
+                                          const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
+                                          const floatVector &F,    const floatVector &chi,  const floatVector &gradChi,
+                                          floatVector &d ){
+        /*!
+         * Compute the distance in the current configuration for a batch of points which share the same deformation
+         * 
+         * \f$d_i = F_{iI} dX_I - \chi_{iI} \Xi_I^1 + \left(\chi_{iI} + \chi_{iI,J} dX_J \right) \Xi_I^2 \f$
+         * 
+         * \f$dX_I = \Xi_I^1 + D_I - \Xi_I^2 \f$
+         * 
+         * The vectors are stored as structures of arrays so that component I of point p is stored at [ numPoints * I + p ].
+         * The loops over the points are innermost and contiguous so that they can be vectorized.
+         * 
+         * \param &numPoints: The number of points in the batch
+         * \param &Xi_1: The micro-position vectors for the local particle
+         * \param &Xi_2: The micro-position vectors for the non-local particle
+         * \param &D: The initial separations between the particles
+         * \param &F: The deformation gradient \f$\frac{dx_i}{dX_I}\f$
+         * \param &chi: The micro-deformation
+         * \param &gradChi: the gradient of the micro deformation w.r.t. the reference spatial variable
+         * \param &d: The current separations between the particles
+         */
+
+        unsigned int dim;
+        TARDIGRADE_ERROR_TOOLS_CATCH( dim = checkBatchSizes( numPoints, Xi_1, Xi_2, D, F, chi ) );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( gradChi.size( ) == dim * dim * dim, "The gradient of the micro-deformation has a size of " + std::to_string( gradChi.size( ) ) + " but should have a size of " + std::to_string( dim * dim * dim ) );
+
+        floatVector dX( dim * numPoints );
+
+        for ( unsigned int n = 0; n < dim * numPoints; n++ ){
+
+            dX[ n ] = Xi_1[ n ] + D[ n ] - Xi_2[ n ];
+
+        }
+
+        d = floatVector( dim * numPoints, 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            floatType *d_i = d.data( ) + numPoints * i;
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                const floatType *dX_I = dX.data( ) + numPoints * I;
+
+                const floatType *Xi_1_I = Xi_1.data( ) + numPoints * I;
+
+                const floatType *Xi_2_I = Xi_2.data( ) + numPoints * I;
+
+                const floatType F_iI = F[ dim * i + I ];
+
+                const floatType chi_iI = chi[ dim * i + I ];
+
+#ifdef _OPENMP
+                #pragma omp simd
+#endif
+                for ( unsigned int p = 0; p < numPoints; p++ ){
+
+                    d_i[ p ] += F_iI * dX_I[ p ] + chi_iI * ( Xi_2_I[ p ] - Xi_1_I[ p ] );
+
+                }
+
+                for ( unsigned int J = 0; J < dim; J++ ){
+
+                    const floatType *dX_J = dX.data( ) + numPoints * J;
+
+                    const floatType gradChi_iIJ = gradChi[ dim * dim * i + dim * I + J ];
+
+#ifdef _OPENMP
+                    #pragma omp simd
+#endif
+                    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+                        d_i[ p ] += gradChi_iIJ * dX_J[ p ] * Xi_2_I[ p ];
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+    void computeCurrentDistanceBatch( const unsigned int &numPoints,
+                                          const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
+                                          const floatVector &F,    const floatVector &chi,  const floatVector &gradChi,
+                                          floatVector &d, floatVector &dddF, floatVector &dddChi, floatVector &dddGradChi ){
+        /*!
+         * Compute the distance in the current configuration and its gradients w.r.t. the deformation measures for a batch
+         * of points which share the same deformation
+         * 
+         * \f$d_i = F_{iI} dX_I - \chi_{iI} \Xi_I^1 + \left(\chi_{iI} + \chi_{iI,J} dX_J \right) \Xi_I^2 \f$
+         * 
+         * \f$dX_I = \Xi_I^1 + D_I - \Xi_I^2 \f$
+         * 
+         * The vectors are stored as structures of arrays so that component I of point p is stored at [ numPoints * I + p ].
+         * The gradients are stored in the same way so that e.g. \f$\frac{\partial d_i}{\partial F_{IA}}\f$ of point p is
+         * stored at dddF[ numPoints * ( dim * dim * i + dim * I + A ) + p ].
+         * 
+         * \param &numPoints: The number of points in the batch
+         * \param &Xi_1: The micro-position vectors for the local particle
+         * \param &Xi_2: The micro-position vectors for the non-local particle
+         * \param &D: The initial separations between the particles
+         * \param &F: The deformation gradient \f$\frac{dx_i}{dX_I}\f$
+         * \param &chi: The micro-deformation
+         * \param &gradChi: the gradient of the micro deformation w.r.t. the reference spatial variable
+         * \param &d: The current separations between the particles
+         * \param &dddF: The gradients of d w.r.t. the deformation gradient
+         * \param &dddChi: The gradients of d w.r.t. the micro deformation
+         * \param &dddGradChi: The gradients of d w.r.t. the gradient of the micro deformation
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeCurrentDistanceBatch( numPoints, Xi_1, Xi_2, D, F, chi, gradChi, d ) );
+
+        const unsigned int dim = Xi_1.size( ) / numPoints;
+
+        dddF       = floatVector( dim * dim * dim * numPoints, 0 );
+
+        dddChi     = floatVector( dim * dim * dim * numPoints, 0 );
+
+        dddGradChi = floatVector( dim * dim * dim * dim * numPoints, 0 );
+
+        floatVector dX( dim * numPoints );
+
+        for ( unsigned int n = 0; n < dim * numPoints; n++ ){
+
+            dX[ n ] = Xi_1[ n ] + D[ n ] - Xi_2[ n ];
+
+        }
+
+        // Only the terms where the first index of the tensor matches the index of d are non-zero
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int A = 0; A < dim; A++ ){
+
+                const floatType *Xi_1_A = Xi_1.data( ) + numPoints * A;
+
+                const floatType *Xi_2_A = Xi_2.data( ) + numPoints * A;
+
+                const floatType *dX_A = dX.data( ) + numPoints * A;
+
+                floatType *dddF_iiA = dddF.data( ) + numPoints * ( dim * dim * i + dim * i + A );
+
+                floatType *dddChi_iiA = dddChi.data( ) + numPoints * ( dim * dim * i + dim * i + A );
+
+#ifdef _OPENMP
+                #pragma omp simd
+#endif
+                for ( unsigned int p = 0; p < numPoints; p++ ){
+
+                    dddF_iiA[ p ] = dX_A[ p ];
+
+                    dddChi_iiA[ p ] = Xi_2_A[ p ] - Xi_1_A[ p ];
+
+                }
+
+                for ( unsigned int J = 0; J < dim; J++ ){
+
+                    const floatType *dX_J = dX.data( ) + numPoints * J;
+
+                    floatType *dddGradChi_iiAJ = dddGradChi.data( ) + numPoints * ( dim * dim * dim * i + dim * dim * i + dim * A + J );
+
+#ifdef _OPENMP
+                    #pragma omp simd
+#endif
+                    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+                        dddGradChi_iiAJ[ p ] = Xi_2_A[ p ] * dX_J[ p ];
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+    void computeCurrentDistanceGeneralBatch( const unsigned int &numPoints,
+                                                 const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
+                                                 const floatVector &F,    const floatVector &chi,  const floatVector &chiNL,
+                                                 floatVector &d ){
+        /*!
+         * Compute the distance in the current configuration for a batch of points which share the same local deformation
+         * 
+         * \f$d_i = F_{iI} dX_I - \chi_{iI} \Xi_I^1 + \chi_{iI}^{NL} \Xi_I^2 \f$
+         * 
+         * \f$dX_I = \Xi_I^1 + D_I - \Xi_I^2 \f$
+         * 
+         * The vectors and the non-local micro-deformations are stored as structures of arrays so that component I of point
+         * p is stored at [ numPoints * I + p ] and component iI of the non-local micro-deformation of point p is stored at
+         * chiNL[ numPoints * ( dim * i + I ) + p ]. The loops over the points are innermost and contiguous so that they can
+         * be vectorized.
+         * 
+         * \param &numPoints: The number of points in the batch
+         * \param &Xi_1: The relative micro-position vectors for the local particle
+         * \param &Xi_2: The relative micro-position vectors for the non-local particle
+         * \param &D: The initial separations between the particles
+         * \param &F: The deformation gradient \f$\frac{dx_i}{dX_I}\f$
+         * \param &chi: The micro-deformation
+         * \param &chiNL: the non-local micro-deformations at \f$\Xi_2\f$
+         * \param &d: The current separations between the particles
+         */
+
+        unsigned int dim;
+        TARDIGRADE_ERROR_TOOLS_CATCH( dim = checkBatchSizes( numPoints, Xi_1, Xi_2, D, F, chi ) );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( chiNL.size( ) == dim * dim * numPoints, "The non-local micro-deformation has a size of " + std::to_string( chiNL.size( ) ) + " but should have a size of " + std::to_string( dim * dim * numPoints ) );
+
+        d = floatVector( dim * numPoints, 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            floatType *d_i = d.data( ) + numPoints * i;
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                const floatType *Xi_1_I = Xi_1.data( ) + numPoints * I;
+
+                const floatType *Xi_2_I = Xi_2.data( ) + numPoints * I;
+
+                const floatType *D_I = D.data( ) + numPoints * I;
+
+                const floatType *chiNL_iI = chiNL.data( ) + numPoints * ( dim * i + I );
+
+                const floatType F_iI = F[ dim * i + I ];
+
+                const floatType chi_iI = chi[ dim * i + I ];
+
+#ifdef _OPENMP
+                #pragma omp simd
+#endif
+                for ( unsigned int p = 0; p < numPoints; p++ ){
+
+                    d_i[ p ] += F_iI * ( Xi_1_I[ p ] + D_I[ p ] - Xi_2_I[ p ] ) - chi_iI * Xi_1_I[ p ] + chiNL_iI[ p ] * Xi_2_I[ p ];
+
+                }
+
+            }
+
+        }
+
+    }
+
+    void computeCurrentDistanceGeneralBatch( const unsigned int &numPoints,
+                                                 const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
+                                                 const floatVector &F,    const floatVector &chi,  const floatVector &chiNL,
+                                                 floatVector &d, floatVector &dddF, floatVector &dddchi, floatVector &dddchiNL ){
+        /*!
+         * Compute the distance in the current configuration and its gradients w.r.t. the deformation measures for a batch
+         * of points which share the same local deformation
+         * 
+         * \f$d_i = F_{iI} dX_I - \chi_{iI} \Xi_I^1 + \chi_{iI}^{NL} \Xi_I^2 \f$
+         * 
+         * \f$dX_I = \Xi_I^1 + D_I - \Xi_I^2 \f$
+         * 
+         * The storage is the same as for the batched distance. The gradients are stored so that e.g.
+         * \f$\frac{\partial d_i}{\partial F_{IA}}\f$ of point p is stored at dddF[ numPoints * ( dim * dim * i + dim * I + A ) + p ].
+         * 
+         * \param &numPoints: The number of points in the batch
+         * \param &Xi_1: The relative micro-position vectors for the local particle
+         * \param &Xi_2: The relative micro-position vectors for the non-local particle
+         * \param &D: The initial separations between the particles
+         * \param &F: The deformation gradient \f$\frac{dx_i}{dX_I}\f$
+         * \param &chi: The micro-deformation
+         * \param &chiNL: the non-local micro-deformations at \f$\Xi_2\f$
+         * \param &d: The current separations between the particles
+         * \param &dddF: The gradients of d w.r.t. the deformation gradient
+         * \param &dddchi: The gradients of d w.r.t. the local micro-deformation
+         * \param &dddchiNL: The gradients of d w.r.t. the non-local micro-deformations
+         */
 
-            for ( unsigned int I = 0; I < dX.size( ); I++ ){
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeCurrentDistanceGeneralBatch( numPoints, Xi_1, Xi_2, D, F, chi, chiNL, d ) );
 
-                dx[ i ] += F[ dX.size( ) * i + I ] * dX[ I ];
+        const unsigned int dim = Xi_1.size( ) / numPoints;
 
-                xi_1[ i ] += chi[ dX.size( ) * i + I ] * Xi_1[ I ];
+        dddF     = floatVector( dim * dim * dim * numPoints, 0 );
 
-                xi_2[ i ] += chiNL[ dX.size( ) * i + I ] * Xi_2[ I ];
+        dddchi   = floatVector( dim * dim * dim * numPoints, 0 );
 
-                dddXi_1[ i ][ I ] =  F[ dX.size( ) * i + I ] - chi[ dX.size( ) * i + I ];
+        dddchiNL = floatVector( dim * dim * dim * numPoints, 0 );
 
-                dddXi_2[ i ][ I ] = -F[ dX.size( ) * i + I ] + chiNL[ dX.size( ) * i + I ];
+        // Only the terms where the first index of the tensor matches the index of d are non-zero
+        for ( unsigned int i = 0; i < dim; i++ ){
 
-                dddD[ i ][ I ] = F[ dX.size( ) * i + I ];
+            for ( unsigned int A = 0; A < dim; A++ ){
 
-                for ( unsigned int A = 0; A < dX.size( ); A++ ){
+                const floatType *Xi_1_A = Xi_1.data( ) + numPoints * A;
 
-                    dddF[ i ][ dX.size( ) * I + A ]     =  eye[ dX.size( ) * i + I ] * dX[ A ];
+                const floatType *Xi_2_A = Xi_2.data( ) + numPoints * A;
 
-                    dddchi[ i ][ dX.size( ) * I + A ]   = -eye[ dX.size( ) * i + I ] * Xi_1[ A ];
+                const floatType *D_A = D.data( ) + numPoints * A;
 
-                    dddchiNL[ i ][ dX.size( ) * I + A ] =  eye[ dX.size( ) * i + I ] * Xi_2[ A ];
+                const unsigned int offset = numPoints * ( dim * dim * i + dim * i + A );
 
-                    for ( unsigned int a = 0; a < dX.size( ); a++ ){
+                floatType *dddF_iiA = dddF.data( ) + offset;
 
-                        d2ddFdXi_1[ i ][ dX.size( ) * dX.size( ) * I + dX.size( ) * A + a ]     +=  eye[ dX.size( ) * i + I ] * eye[ dX.size( ) * A + a ];
+                floatType *dddchi_iiA = dddchi.data( ) + offset;
 
-                        d2ddchidXi_1[ i ][ dX.size( ) * dX.size( ) * I + dX.size( ) * A + a ]   += -eye[ dX.size( ) * i + I ] * eye[ dX.size( ) * A + a ];
+                floatType *dddchiNL_iiA = dddchiNL.data( ) + offset;
 
-                        d2ddFdXi_2[ i ][ dX.size( ) * dX.size( ) * I + dX.size( ) * A + a ]     += -eye[ dX.size( ) * i + I ] * eye[ dX.size( ) * A + a ];
+#ifdef _OPENMP
+                #pragma omp simd
+#endif
+                for ( unsigned int p = 0; p < numPoints; p++ ){
 
-                        d2ddchiNLdXi_2[ i ][ dX.size( ) * dX.size( ) * I + dX.size( ) * A + a ] += eye[ dX.size( ) * i + I ] * eye[ dX.size( ) * A + a ];
+                    dddF_iiA[ p ] = Xi_1_A[ p ] + D_A[ p ] - Xi_2_A[ p ];
 
-                        d2ddFdD[ i ][ dX.size( ) * dX.size( ) * I + dX.size( ) * A + a ]        +=  eye[ dX.size( ) * i + I ] * eye[ dX.size( ) * A + a ];
+                    dddchi_iiA[ p ] = -Xi_1_A[ p ];
 
-                    }
+                    dddchiNL_iiA[ p ] = Xi_2_A[ p ];
 
                 }
 
@@ -275,10 +892,6 @@ namespace tractionSeparation{
 
         }
 
-        d = dx - xi_1 + xi_2;
-
-        return;
-
     }
 
     void computeCurrentDistance( const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
@@ -1406,6 +2019,34 @@ namespace tractionSeparation{
          * \param &overlap: The overlap vector
          */
 
+        floatVector X;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeParticleOverlap( Xi_1, dX, R_nl, F, chi, chi_nl_basis, gradChi, X, overlap ) );
+
+        return;
+
+    }
+
+    void computeParticleOverlap( const floatVector &Xi_1, const floatVector &dX, const floatType &R_nl,
+                                     const floatVector &F,    const floatVector &chi, const floatVector &chi_nl_basis, const floatVector &gradChi,
+                                     floatVector &X, floatVector &overlap ){
+        /*!
+         * Compute the amount that a point on the local particle overlaps with the non-local particle where the solve of the
+         * overlap distance may be warm started e.g. by the solution of the same point in the previous increment.
+         * 
+         * \param &Xi_1: The local micro relative position vector to test.
+         * \param &dX: The spacing between the local and non-local particle centroids in the reference configuration
+         * \param &R_nl: The non-local particle radius in the reference configuration
+         * \param &F: The deformation gradient
+         * \param &chi: The micro deformation tensor
+         * \param &chi_nl_basis: The non-local micro deformation tensor basis
+         * \param &gradChi: The gradient of the micro deformation tensor w.r.t. the reference spatial position
+         * \param &X: The unknown vector of the overlap distance Lagrangian. If it has a size of the dimension plus one on entry
+         *     it is the initial iterate of the solve. It is set to the solution if the point overlaps the non-local particle
+         *     and is unchanged otherwise.
+         * \param &overlap: The overlap vector
+         */
+
         TARDIGRADE_ERROR_TOOLS_CHECK( chi.size( ) == ( Xi_1.size( ) * Xi_1.size( ) ), "The incoming chi vector has an inconsistent size with the micro-position vector\n  size is " + std::to_string( chi.size( ) ) + " and must be " + std::to_string( Xi_1.size( ) * Xi_1.size( ) ) );
 
         TARDIGRADE_ERROR_TOOLS_CHECK( chi_nl_basis.size( ) == ( Xi_1.size( ) * Xi_1.size( ) ), "The incoming chi non-local basis vector has an inconsistent size with the micro-position vector\n  size is " + std::to_string( chi.size( ) ) + " and must be " + std::to_string( Xi_1.size( ) * Xi_1.size( ) ) );
@@ -1429,7 +2070,7 @@ namespace tractionSeparation{
 
         }
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( computeParticleOverlapChi_nl( Xi_1, dX, R_nl, F, chi, chi_nl, overlap ) );
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeParticleOverlapChi_nl( Xi_1, dX, R_nl, F, chi, chi_nl, X, overlap ) );
 
         return;
 
@@ -1466,6 +2107,33 @@ namespace tractionSeparation{
          * \param &overlap: The overlap vector
          */
 
+        floatVector X;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeParticleOverlapChi_nl( Xi_1, dX, R_nl, F, chi, chi_nl, X, overlap ) );
+
+        return;
+
+    }
+
+    void computeParticleOverlapChi_nl( const floatVector &Xi_1, const floatVector &dX, const floatType &R_nl,
+                                           const floatVector &F,    const floatVector &chi,  const floatVector &chi_nl,
+                                           floatVector &X, floatVector &overlap ){
+        /*!
+         * Compute the amount that a point on the local particle overlaps with the non-local particle where the solve of the
+         * overlap distance may be warm started e.g. by the solution of the same point in the previous increment.
+         * 
+         * \param &Xi_1: The local micro relative position vector to test.
+         * \param &dX: The spacing between the local and non-local particle centroids in the reference configuration
+         * \param &R_nl: The non-local particle radius in the reference configuration
+         * \param &F: The deformation gradient
+         * \param &chi: The micro deformation tensor
+         * \param &chi_nl: The non-local micro deformation tensor
+         * \param &X: The unknown vector of the overlap distance Lagrangian. If it has a size of the dimension plus one on entry
+         *     it is the initial iterate of the solve. It is set to the solution if the point overlaps the non-local particle
+         *     and is unchanged otherwise.
+         * \param &overlap: The overlap vector
+         */
+
         TARDIGRADE_ERROR_TOOLS_CHECK( Xi_1.size( ) == dX.size( ), "The local micro relative position vector and the inter-particle spacing should have the same dimension\n\tXi_1: " + std::to_string( Xi_1.size( ) ) + "\n\tdX: " + std::to_string( dX.size( ) ) );
 
         TARDIGRADE_ERROR_TOOLS_CHECK( F.size( ) == ( dX.size( ) * dX.size( ) ), "The deformation gradient is not the expected dimension.\n\tF: " + std::to_string( F.size( ) ) + "\n\texpected: " + std::to_string( dX.size( ) * dX.size( ) ) );
@@ -1525,7 +2193,7 @@ namespace tractionSeparation{
         }
         else{
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( solveOverlapDistance( chi_nl, xi_t, R_nl, overlap ) );
+            TARDIGRADE_ERROR_TOOLS_CATCH( solveOverlapDistance( chi_nl, xi_t, R_nl, X, overlap ) );
 
         }
 
@@ -7008,152 +7676,597 @@ namespace tractionSeparation{
                                      + eye[ xi_t.size( ) * i + K ] * eye[ xi_t.size( ) * I + L ] * eye[ xi_t.size( )* J + j ];
 
 
-                            }
+                            }
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+            dLdX[ i ] -= 2 * lambda * Xi[ i ];
+
+            d2LdXdX[ X.size( ) * i + i ] -= 2 * lambda;
+
+            d2LdXdX[ X.size( ) * i + X.size( ) - 1 ] -= 2 * Xi[ i ];
+            d2LdXdX[ X.size( ) * ( X.size( ) - 1 ) + i ] -= 2 * Xi[ i ];
+
+        }
+
+        dLdX[ Xi.size( ) ] -= ( vectorTools::dot( Xi, Xi ) - R_nl * R_nl );
+
+        d2LdXdR_nl[ X.size( ) - 1 ] = 2 * R_nl;
+
+        d3LdXdR_nldR_nl[ X.size( ) - 1 ] = 2;
+
+        return;
+
+    }
+
+    namespace{
+
+        overlapSolverStatistics &getMutableOverlapSolverStatistics( ){
+            /*!
+             * Get the overlap solver statistics of the calling thread
+             */
+
+            thread_local overlapSolverStatistics statistics;
+
+            return statistics;
+
+        }
+
+    }
+
+    const overlapSolverStatistics &getOverlapSolverStatistics( ){
+        /*!
+         * Get the counts of the work done by the overlap distance solver on the calling thread. The counts are cumulative
+         * so the work done by a section of code is the difference of the counts before and after it.
+         */
+
+        return getMutableOverlapSolverStatistics( );
+
+    }
+
+    const char *getSolverStatusMessage( const solverStatus &status ){
+        /*!
+         * Get the message which describes the status of a solve
+         * 
+         * \param &status: The status of the solve
+         */
+
+        switch ( status ){
+
+            case SOLVER_CONVERGED:
+                return "The solver converged";
+
+            case SOLVER_LINESEARCH_FAILURE:
+                return "Failure in linesearch";
+
+            case SOLVER_NOT_CONVERGED:
+                return "The optimizer did not converge";
+
+        }
+
+        return "Unknown solver status";
+
+    }
+
+    void checkSolverStatus( const solverStatus &status ){
+        /*!
+         * Convert the status of a solve to an exception. A solve which failed throws a convergenceError so that the
+         * caller may recover from the failure, e.g. by reducing the time increment.
+         * 
+         * \param &status: The status of the solve
+         */
+
+        if ( status != SOLVER_CONVERGED ){
+
+            throw convergenceError( getSolverStatusMessage( status ) );
+
+        }
+
+    }
+
+    namespace{
+
+        /*!
+         * Reusable storage for the Newton solve of the overlap distance Lagrangian
+         */
+        struct overlapDistanceWorkspace{
+
+            floatVector chiTchi; //!< The product \f$\chi_{iI}^{nl} \chi_{iJ}^{nl}\f$
+
+            floatVector invChi; //!< The inverse of the non-local micro-deformation tensor
+
+            floatVector chiTxi; //!< The product \f$\chi_{iI}^{nl} \xi_i^t\f$
+
+            floatVector residual; //!< The gradient of the Lagrangian w.r.t. the unknown vector
+
+            floatVector jacobian; //!< The Hessian of the Lagrangian w.r.t. the unknown vector
+
+            floatVector dX; //!< The Newton step
+
+            floatVector Xtrial; //!< The line-search trial iterate
+
+        };
+
+        void initializeOverlapDistanceWorkspace( const floatVector &chi_nl, const unsigned int &dim, overlapDistanceWorkspace &workspace ){
+            /*!
+             * Size the workspace and compute the inverse of the non-local micro-deformation and the parts of the Hessian which
+             * only depend on it
+             *
+             * \param &chi_nl: The non-local micro-deformation tensor
+             * \param &dim: The spatial dimension
+             * \param &workspace: The workspace to be initialized
+             */
+
+            if ( chi_nl.size( ) != dim * dim ){
+
+                ERROR_TOOLS_CATCH( throw std::runtime_error( "chi_nl has a size of " + std::to_string( chi_nl.size( ) ) + " and should have a size of " + std::to_string( dim * dim ) ) );
+
+            }
+
+            workspace.invChi = vectorTools::inverse( chi_nl, dim, dim );
+
+            workspace.chiTchi.assign( dim * dim, 0 );
+
+            workspace.chiTxi.assign( dim, 0 );
+
+            workspace.residual.assign( dim + 1, 0 );
+
+            workspace.jacobian.assign( ( dim + 1 ) * ( dim + 1 ), 0 );
+
+            workspace.dX.assign( dim + 1, 0 );
+
+            workspace.Xtrial.assign( dim + 1, 0 );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int I = 0; I < dim; I++ ){
+
+                    for ( unsigned int J = 0; J < dim; J++ ){
+
+                        workspace.chiTchi[ dim * I + J ] += chi_nl[ dim * i + I ] * chi_nl[ dim * i + J ];
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        void initializeOverlapDistanceGuess( const floatVector &inv_chi_nl, const floatType *xi_t, const unsigned int &dim, floatType *X ){
+            /*!
+             * Set the default initial iterate of the unknown vector which is the reference position of
+             * \f$\xi_t\f$ in the non-local particle with a unit Lagrange multiplier
+             *
+             * \param &inv_chi_nl: The inverse of the non-local micro-deformation tensor
+             * \param *xi_t: The position inside of the non-local particle
+             * \param &dim: The spatial dimension
+             * \param *X: The unknown vector
+             */
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                X[ I ] = 0;
+
+                for ( unsigned int i = 0; i < dim; i++ ){
+
+                    X[ I ] += inv_chi_nl[ dim * I + i ] * xi_t[ i ];
+
+                }
+
+            }
+
+            X[ dim ] = 1;
+
+        }
+
+        floatType computeOverlapDistanceResidual( const overlapDistanceWorkspace &workspace, const unsigned int &dim, const floatType &R_nl,
+                                                      const floatType *X, floatVector &residual ){
+            /*!
+             * Compute the gradient of the overlap distance Lagrangian w.r.t. the unknown vector and return its l2 norm.
+             * This is the same quantity as dLdX from computeOverlapDistanceLagrangian but only requires the
+             * pre-computed products in the workspace.
+             *
+             * \param &workspace: The initialized workspace
+             * \param &dim: The spatial dimension
+             * \param &R_nl: The non-local particle radius in the reference configuration
+             * \param *X: The unknown vector
+             * \param &residual: The gradient of the Lagrangian w.r.t. the unknown vector
+             */
+
+            const floatType lambda = X[ dim ];
+
+            floatType XiXi = 0;
+
+            floatType norm = 0;
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                residual[ I ] = -workspace.chiTxi[ I ] - 2 * lambda * X[ I ];
+
+                for ( unsigned int J = 0; J < dim; J++ ){
+
+                    residual[ I ] += workspace.chiTchi[ dim * I + J ] * X[ J ];
+
+                }
+
+                XiXi += X[ I ] * X[ I ];
+
+                norm += residual[ I ] * residual[ I ];
+
+            }
+
+            residual[ dim ] = -( XiXi - R_nl * R_nl );
+
+            norm += residual[ dim ] * residual[ dim ];
+
+            return std::sqrt( norm );
+
+        }
+
+        void computeOverlapDistanceJacobian( const overlapDistanceWorkspace &workspace, const unsigned int &dim,
+                                                 const floatType *X, floatVector &jacobian ){
+            /*!
+             * Compute the Hessian of the overlap distance Lagrangian w.r.t. the unknown vector
+             *
+             * \param &workspace: The initialized workspace
+             * \param &dim: The spatial dimension
+             * \param *X: The unknown vector
+             * \param &jacobian: The row-major Hessian of the Lagrangian w.r.t. the unknown vector
+             */
+
+            const unsigned int n = dim + 1;
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                for ( unsigned int J = 0; J < dim; J++ ){
+
+                    jacobian[ n * I + J ] = workspace.chiTchi[ dim * I + J ];
+
+                }
+
+                jacobian[ n * I + I ] -= 2 * X[ dim ];
+
+                jacobian[ n * I + dim ] = -2 * X[ I ];
+
+                jacobian[ n * dim + I ] = -2 * X[ I ];
+
+            }
+
+            jacobian[ n * dim + dim ] = 0;
+
+        }
+
+        bool solveFourByFour( const floatType *A, const floatType *b, floatType *x ){
+            /*!
+             * Solve the row-major 4x4 linear system \f$A x = b\f$ in closed form using the expansion of the
+             * determinant in terms of the 2x2 minors of the first two and last two rows.
+             *
+             * Returns false without modifying x if the system is numerically singular
+             *
+             * \param *A: The row-major coefficient matrix
+             * \param *b: The right hand side vector
+             * \param *x: The solution vector
+             */
+
+            const floatType s0 = A[  0 ] * A[  5 ] - A[  4 ] * A[  1 ];
+            const floatType s1 = A[  0 ] * A[  6 ] - A[  4 ] * A[  2 ];
+            const floatType s2 = A[  0 ] * A[  7 ] - A[  4 ] * A[  3 ];
+            const floatType s3 = A[  1 ] * A[  6 ] - A[  5 ] * A[  2 ];
+            const floatType s4 = A[  1 ] * A[  7 ] - A[  5 ] * A[  3 ];
+            const floatType s5 = A[  2 ] * A[  7 ] - A[  6 ] * A[  3 ];
+
+            const floatType c5 = A[ 10 ] * A[ 15 ] - A[ 14 ] * A[ 11 ];
+            const floatType c4 = A[  9 ] * A[ 15 ] - A[ 13 ] * A[ 11 ];
+            const floatType c3 = A[  9 ] * A[ 14 ] - A[ 13 ] * A[ 10 ];
+            const floatType c2 = A[  8 ] * A[ 15 ] - A[ 12 ] * A[ 11 ];
+            const floatType c1 = A[  8 ] * A[ 14 ] - A[ 12 ] * A[ 10 ];
+            const floatType c0 = A[  8 ] * A[ 13 ] - A[ 12 ] * A[  9 ];
+
+            const floatType det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+            floatType scale = 0;
+
+            for ( unsigned int i = 0; i < 16; i++ ){
+
+                scale = std::fmax( scale, std::fabs( A[ i ] ) );
+
+            }
+
+            if ( std::fabs( det ) <= 1e-14 * scale * scale * scale * scale ){
+
+                return false;
+
+            }
+
+            const floatType invDet = 1 / det;
+
+            const floatType inv[ 16 ] = {
+                (  A[  5 ] * c5 - A[  6 ] * c4 + A[  7 ] * c3 ),
+                ( -A[  1 ] * c5 + A[  2 ] * c4 - A[  3 ] * c3 ),
+                (  A[ 13 ] * s5 - A[ 14 ] * s4 + A[ 15 ] * s3 ),
+                ( -A[  9 ] * s5 + A[ 10 ] * s4 - A[ 11 ] * s3 ),
+                ( -A[  4 ] * c5 + A[  6 ] * c2 - A[  7 ] * c1 ),
+                (  A[  0 ] * c5 - A[  2 ] * c2 + A[  3 ] * c1 ),
+                ( -A[ 12 ] * s5 + A[ 14 ] * s2 - A[ 15 ] * s1 ),
+                (  A[  8 ] * s5 - A[ 10 ] * s2 + A[ 11 ] * s1 ),
+                (  A[  4 ] * c4 - A[  5 ] * c2 + A[  7 ] * c0 ),
+                ( -A[  0 ] * c4 + A[  1 ] * c2 - A[  3 ] * c0 ),
+                (  A[ 12 ] * s4 - A[ 13 ] * s2 + A[ 15 ] * s0 ),
+                ( -A[  8 ] * s4 + A[  9 ] * s2 - A[ 11 ] * s0 ),
+                ( -A[  4 ] * c3 + A[  5 ] * c1 - A[  6 ] * c0 ),
+                (  A[  0 ] * c3 - A[  1 ] * c1 + A[  2 ] * c0 ),
+                ( -A[ 12 ] * s3 + A[ 13 ] * s1 - A[ 14 ] * s0 ),
+                (  A[  8 ] * s3 - A[  9 ] * s1 + A[ 10 ] * s0 )
+            };
+
+            for ( unsigned int i = 0; i < 4; i++ ){
+
+                x[ i ] = invDet * ( inv[ 4 * i + 0 ] * b[ 0 ] + inv[ 4 * i + 1 ] * b[ 1 ] + inv[ 4 * i + 2 ] * b[ 2 ] + inv[ 4 * i + 3 ] * b[ 3 ] );
+
+            }
+
+            return true;
+
+        }
+
+        solverStatus solveOverlapDistanceUnknowns( const floatVector &chi_nl, const floatType *xi_t, const unsigned int &dim, const floatType &R_nl, floatType *X,
+                                                       const floatType tolr, const floatType tola, const unsigned int max_iteration,
+                                                       const unsigned int max_ls, const floatType alpha_ls, overlapDistanceWorkspace &workspace ){
+            /*!
+             * Solve for the unknown vector of the overlap distance Lagrangian using Newton's method with a backtracking line-search
+             * starting from the provided value of X. The workspace must have been initialized for chi_nl.
+             *
+             * The line-search only evaluates the gradient of the Lagrangian and the Hessian is only formed at accepted iterates.
+             * In three dimensions the Newton step is computed in closed form.
+             *
+             * A failure of the solve is returned as a status rather than thrown so that the kernel has no exception handling.
+             *
+             * \param &chi_nl: The non-local micro-deformation tensor
+             * \param *xi_t: The position inside of the non-local particle
+             * \param &dim: The spatial dimension
+             * \param &R_nl: The non-local particle radius in the reference configuration
+             * \param *X: The unknown vector. The incoming value is the initial iterate.
+             * \param tolr: The relative tolerance which is scaled by the residual of the default initial iterate
+             * \param tola: The absolute tolerance
+             * \param max_iteration: The maximum number of iterations
+             * \param max_ls: The maximum number of line-search iterations
+             * \param alpha_ls: The alpha parameter for the line-search
+             * \param &workspace: The initialized workspace
+             */
+
+            const unsigned int n = dim + 1;
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                workspace.chiTxi[ I ] = 0;
+
+                for ( unsigned int i = 0; i < dim; i++ ){
+
+                    workspace.chiTxi[ I ] += chi_nl[ dim * i + I ] * xi_t[ i ];
+
+                }
+
+            }
+
+            // The relative tolerance is scaled by the residual of the default initial iterate, \f$X_I = \chi_{Ii}^{-1} \xi_i^t\f$
+            // and a unit Lagrange multiplier, so that it does not depend on the provided initial iterate
+            floatType XiXi = 0;
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                floatType XI = 0;
+
+                for ( unsigned int i = 0; i < dim; i++ ){
+
+                    XI += workspace.invChi[ dim * I + i ] * xi_t[ i ];
+
+                }
+
+                XiXi += XI * XI;
+
+            }
+
+            floatType tol = tolr * std::sqrt( 4 * XiXi + ( R_nl * R_nl - XiXi ) * ( R_nl * R_nl - XiXi ) ) + tola;
+
+            floatType R = computeOverlapDistanceResidual( workspace, dim, R_nl, X, workspace.residual );
+
+            floatType Rp = R;
+
+            unsigned int num_iteration = 0;
+
+            while ( ( num_iteration < max_iteration ) && ( R > tol ) ){
+
+                computeOverlapDistanceJacobian( workspace, dim, X, workspace.jacobian );
+
+                for ( unsigned int I = 0; I < n; I++ ){
+
+                    workspace.residual[ I ] *= -1;
+
+                }
 
-                        }
+                if ( ( n != 4 ) || !solveFourByFour( workspace.jacobian.data( ), workspace.residual.data( ), workspace.dX.data( ) ) ){
 
-                    }
+                    unsigned int rank;
+
+                    workspace.dX = vectorTools::solveLinearSystem( workspace.jacobian, workspace.residual, n, n, rank );
 
                 }
 
-            }
+                floatType lambda = 1;
 
-            dLdX[ i ] -= 2 * lambda * Xi[ i ];
+                for ( unsigned int I = 0; I < n; I++ ){
 
-            d2LdXdX[ X.size( ) * i + i ] -= 2 * lambda;
+                    workspace.Xtrial[ I ] = X[ I ] + lambda * workspace.dX[ I ];
 
-            d2LdXdX[ X.size( ) * i + X.size( ) - 1 ] -= 2 * Xi[ i ];
-            d2LdXdX[ X.size( ) * ( X.size( ) - 1 ) + i ] -= 2 * Xi[ i ];
+                }
 
-        }
+                R = computeOverlapDistanceResidual( workspace, dim, R_nl, workspace.Xtrial.data( ), workspace.residual );
 
-        dLdX[ Xi.size( ) ] -= ( vectorTools::dot( Xi, Xi ) - R_nl * R_nl );
+                unsigned int num_ls = 0;
 
-        d2LdXdR_nl[ X.size( ) - 1 ] = 2 * R_nl;
+                while ( ( num_ls < max_ls ) && ( R > ( 1 - alpha_ls ) * Rp ) ){
 
-        d3LdXdR_nldR_nl[ X.size( ) - 1 ] = 2;
+                    lambda *= 0.5;
 
-        return;
+                    for ( unsigned int I = 0; I < n; I++ ){
 
-    }
+                        workspace.Xtrial[ I ] = X[ I ] + lambda * workspace.dX[ I ];
 
-    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &d,
-                                   const floatType tolr, const floatType tola, const unsigned int max_iteration,
-                                   const unsigned int max_ls, const floatType alpha_ls ){
-        /*!
-         * Solve for the overlap distance where \f$\xi_t\f$ is known to be inside of the non-local particle
-         * 
-         * \param &chi_nl: The non-local micro-deformation tensor
-         * \param &xi_t: The position inside of the non-local particle
-         * \param &R_nl: The non-local particle radius in the reference configuration
-         * \param &d: The distance vector going from \f$\xi_t\f$ to the solved point on the surface of the non-local particle.
-         * \param tolr: The relative tolerance
-         * \param tola: The absolute tolerance
-         * \param max_iteration: The maximum number of iterations
-         * \param max_ls: The maximum number of line-search iterations
-         * \param alpha_ls: The alpha parameter for the line-search
-         */
+                    }
 
-        floatVector inv_chi_nl = vectorTools::inverse( chi_nl, xi_t.size( ), xi_t.size( ) );
+                    R = computeOverlapDistanceResidual( workspace, dim, R_nl, workspace.Xtrial.data( ), workspace.residual );
 
-        floatVector Xi_t( xi_t.size( ), 0 );
+                    num_ls++;
 
-        for ( unsigned int I = 0; I < xi_t.size( ); I++ ){
+                }
 
-            for ( unsigned int i = 0; i < xi_t.size( ); i++ ){
+#ifdef ASP_INSTRUMENTATION
+                getMutableOverlapSolverStatistics( ).lineSearchIterations += num_ls;
+#endif
 
-                Xi_t[ I ] += inv_chi_nl[ xi_t.size( ) * I + i ] * xi_t[ i ];
+                if ( R > ( 1 - alpha_ls ) * Rp ){
 
-            }
+#ifdef ASP_INSTRUMENTATION
+                    // The failed iteration is counted so that every exit records the work of the solve
+                    getMutableOverlapSolverStatistics( ).solves++;
 
-        }
+                    getMutableOverlapSolverStatistics( ).iterations += num_iteration + 1;
+#endif
 
-        floatVector lagrange( 1, 1 );
+                    return SOLVER_LINESEARCH_FAILURE;
 
-        floatVector X = vectorTools::appendVectors( { Xi_t, lagrange } );
+                }
 
-        floatType L;
+                std::copy( workspace.Xtrial.begin( ), workspace.Xtrial.end( ), X );
 
-        floatVector dLdX, dLdchi_nl, dLdxi_t;
+                Rp = R;
 
-        floatType dLdR_nl;
+                num_iteration++;
 
-        floatVector d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl, d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl, d2Ldxi_tdxi_t, d2Ldxi_tdR_nl;
+            }
 
-        floatType d2LdR_nldR_nl;
+#ifdef ASP_INSTRUMENTATION
+            getMutableOverlapSolverStatistics( ).solves++;
 
-        ERROR_TOOLS_CATCH( computeOverlapDistanceLagrangian( X, chi_nl, xi_t, R_nl, L,
-                                                             dLdX, dLdchi_nl, dLdxi_t, dLdR_nl,
-                                                             d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl,
-                                                             d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl,
-                                                             d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
-                                                             d2LdR_nldR_nl ) );
+            getMutableOverlapSolverStatistics( ).iterations += num_iteration;
+#endif
+
+            if ( R > tol ){
 
-        floatType R = vectorTools::l2norm( dLdX );
+                return SOLVER_NOT_CONVERGED;
 
-        floatType Rp = R;
+            }
 
-        floatType tol = tolr * R + tola;
+            return SOLVER_CONVERGED;
 
-        unsigned int num_iteration = 0;
+        }
 
-        floatVector dX;
+        void solveOverlapDistanceUnknowns( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &X,
+                                               const floatType tolr, const floatType tola, const unsigned int max_iteration,
+                                               const unsigned int max_ls, const floatType alpha_ls ){
+            /*!
+             * Solve for the unknown vector of the overlap distance Lagrangian for a single point. If X does not
+             * have a size of the dimension plus one it is initialized with the default initial iterate. Otherwise X is the
+             * initial iterate and the solve is repeated from the default initial iterate if it fails to converge.
+             *
+             * \param &chi_nl: The non-local micro-deformation tensor
+             * \param &xi_t: The position inside of the non-local particle
+             * \param &R_nl: The non-local particle radius in the reference configuration
+             * \param &X: The unknown vector
+             * \param tolr: The relative tolerance
+             * \param tola: The absolute tolerance
+             * \param max_iteration: The maximum number of iterations
+             * \param max_ls: The maximum number of line-search iterations
+             * \param alpha_ls: The alpha parameter for the line-search
+             */
 
-        while ( ( num_iteration < max_iteration ) && ( R > tol ) ){
+            const unsigned int dim = xi_t.size( );
 
-            unsigned int rank;
+            overlapDistanceWorkspace workspace;
 
-            dX = -vectorTools::solveLinearSystem( d2LdXdX, dLdX, dLdX.size( ), dLdX.size( ), rank );
+            ERROR_TOOLS_CATCH( initializeOverlapDistanceWorkspace( chi_nl, dim, workspace ) );
 
-            floatType lambda = 1;
+            const bool warmStart = ( X.size( ) == ( dim + 1 ) );
 
-            ERROR_TOOLS_CATCH( computeOverlapDistanceLagrangian( X + lambda * dX, chi_nl, xi_t, R_nl, L,
-                                                                 dLdX, dLdchi_nl, dLdxi_t, dLdR_nl,
-                                                                 d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl,
-                                                                 d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl,
-                                                                 d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
-                                                                 d2LdR_nldR_nl ) );
+            if ( !warmStart ){
 
-            unsigned int num_ls = 0;
+                X = floatVector( dim + 1, 0 );
 
-            R = vectorTools::l2norm( dLdX );
+                initializeOverlapDistanceGuess( workspace.invChi, xi_t.data( ), dim, X.data( ) );
 
-            while ( ( num_ls < max_ls ) && ( R > ( 1 - alpha_ls ) * Rp ) ){ 
+            }
 
-                lambda *= 0.5;
+            solverStatus status = solveOverlapDistanceUnknowns( chi_nl, xi_t.data( ), dim, R_nl, X.data( ), tolr, tola, max_iteration, max_ls, alpha_ls, workspace );
 
-                ERROR_TOOLS_CATCH( computeOverlapDistanceLagrangian( X + lambda * dX, chi_nl, xi_t, R_nl, L,
-                                                                     dLdX, dLdchi_nl, dLdxi_t, dLdR_nl,
-                                                                     d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl,
-                                                                     d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl,
-                                                                     d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
-                                                                     d2LdR_nldR_nl ) );
+            // A warm start which doesn't converge, e.g. one from a very different deformation, is retried from the default iterate
+            if ( warmStart && ( status != SOLVER_CONVERGED ) ){
 
-                R = vectorTools::l2norm( dLdX );
+                initializeOverlapDistanceGuess( workspace.invChi, xi_t.data( ), dim, X.data( ) );
 
-                num_ls++;
+                status = solveOverlapDistanceUnknowns( chi_nl, xi_t.data( ), dim, R_nl, X.data( ), tolr, tola, max_iteration, max_ls, alpha_ls, workspace );
 
             }
 
-            if ( R > ( 1 - alpha_ls ) * Rp ){
+            ERROR_TOOLS_CATCH( checkSolverStatus( status ) );
 
-                ERROR_TOOLS_CATCH( throw std::runtime_error( "Failure in linesearch" ) );
+        }
 
-            }
+    }
 
-            X += lambda * dX;
+    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &d,
+                                   const floatType tolr, const floatType tola, const unsigned int max_iteration,
+                                   const unsigned int max_ls, const floatType alpha_ls ){
+        /*!
+         * Solve for the overlap distance where \f$\xi_t\f$ is known to be inside of the non-local particle
+         * 
+         * \param &chi_nl: The non-local micro-deformation tensor
+         * \param &xi_t: The position inside of the non-local particle
+         * \param &R_nl: The non-local particle radius in the reference configuration
+         * \param &d: The distance vector going from \f$\xi_t\f$ to the solved point on the surface of the non-local particle.
+         * \param tolr: The relative tolerance
+         * \param tola: The absolute tolerance
+         * \param max_iteration: The maximum number of iterations
+         * \param max_ls: The maximum number of line-search iterations
+         * \param alpha_ls: The alpha parameter for the line-search
+         */
 
-            Rp = R;
+        floatVector X;
 
-            num_iteration++;
+        ERROR_TOOLS_CATCH( solveOverlapDistance( chi_nl, xi_t, R_nl, X, d, tolr, tola, max_iteration, max_ls, alpha_ls ) );
 
-        }
+        return;
 
-        if ( R > tol ){
+    }
 
-            ERROR_TOOLS_CATCH( throw std::runtime_error( "The optimizer did not converge" ) );
+    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &X, floatVector &d,
+                                   const floatType tolr, const floatType tola, const unsigned int max_iteration,
+                                   const unsigned int max_ls, const floatType alpha_ls ){
+        /*!
+         * Solve for the overlap distance where \f$\xi_t\f$ is known to be inside of the non-local particle
+         * 
+         * \param &chi_nl: The non-local micro-deformation tensor
+         * \param &xi_t: The position inside of the non-local particle
+         * \param &R_nl: The non-local particle radius in the reference configuration
+         * \param &X: The unknown vector of the Lagrangian i.e. the reference position on the surface of the non-local particle
+         *     followed by the Lagrange multiplier. If it has a size of the dimension plus one on entry it is used
+         *     as the initial iterate ( e.g. the solution from the previous increment ) otherwise the default guess is used.
+         *     An initial iterate which fails to converge is replaced by the default guess.
+         * \param &d: The distance vector going from \f$\xi_t\f$ to the solved point on the surface of the non-local particle.
+         * \param tolr: The relative tolerance
+         * \param tola: The absolute tolerance
+         * \param max_iteration: The maximum number of iterations
+         * \param max_ls: The maximum number of line-search iterations
+         * \param alpha_ls: The alpha parameter for the line-search
+         */
 
-        }
+        ERROR_TOOLS_CATCH( solveOverlapDistanceUnknowns( chi_nl, xi_t, R_nl, X, tolr, tola, max_iteration, max_ls, alpha_ls ) );
 
         d = -xi_t;
 
@@ -7192,23 +8305,41 @@ namespace tractionSeparation{
          * \param alpha_ls: The alpha parameter for the line-search
          */
 
-        floatVector inv_chi_nl = vectorTools::inverse( chi_nl, xi_t.size( ), xi_t.size( ) );
-
-        floatVector Xi_t( xi_t.size( ), 0 );
-
-        for ( unsigned int I = 0; I < xi_t.size( ); I++ ){
-
-            for ( unsigned int i = 0; i < xi_t.size( ); i++ ){
+        floatVector X;
 
-                Xi_t[ I ] += inv_chi_nl[ xi_t.size( ) * I + i ] * xi_t[ i ];
+        ERROR_TOOLS_CATCH( solveOverlapDistance( chi_nl, xi_t, R_nl, X, d, dddchi_nl, dddxi_t, dddR_nl,
+                                                 tolr, tola, max_iteration, max_ls, alpha_ls ) );
 
-            }
+        return;
 
-        }
+    }
 
-        floatVector lagrange( 1, 1 );
+    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &X, floatVector &d,
+                                   floatMatrix &dddchi_nl, floatMatrix &dddxi_t, floatVector &dddR_nl,
+                                   const floatType tolr, const floatType tola, const unsigned int max_iteration,
+                                   const unsigned int max_ls, const floatType alpha_ls ){
+        /*!
+         * Solve for the overlap distance where \f$\xi_t\f$ is known to be inside of the non-local particle
+         * 
+         * \param &chi_nl: The non-local micro-deformation tensor
+         * \param &xi_t: The position inside of the non-local particle
+         * \param &R_nl: The non-local particle radius in the reference configuration
+         * \param &X: The unknown vector of the Lagrangian i.e. the reference position on the surface of the non-local particle
+         *     followed by the Lagrange multiplier. If it has a size of the dimension plus one on entry it is used
+         *     as the initial iterate ( e.g. the solution from the previous increment ) otherwise the default guess is used.
+         *     An initial iterate which fails to converge is replaced by the default guess.
+         * \param &d: The distance vector going from \f$\xi_t\f$ to the solved point on the surface of the non-local particle.
+         * \param &dddchi_nl: The gradient of the distance vector w.r.t. the non-local micro-deformation tensor
+         * \param &dddxi_t: The gradient of the distance vector w.r.t. the target micro-relative position vector
+         * \param &dddR_nl: The gradient of the distance vector w.r.t. the non-local particle radius
+         * \param tolr: The relative tolerance
+         * \param tola: The absolute tolerance
+         * \param max_iteration: The maximum number of iterations
+         * \param max_ls: The maximum number of line-search iterations
+         * \param alpha_ls: The alpha parameter for the line-search
+         */
 
-        floatVector X = vectorTools::appendVectors( { Xi_t, lagrange } );
+        ERROR_TOOLS_CATCH( solveOverlapDistanceUnknowns( chi_nl, xi_t, R_nl, X, tolr, tola, max_iteration, max_ls, alpha_ls ) );
 
         floatType L;
 
@@ -7227,72 +8358,6 @@ namespace tractionSeparation{
                                                              d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
                                                              d2LdR_nldR_nl ) );
 
-        floatType R = vectorTools::l2norm( dLdX );
-
-        floatType Rp = R;
-
-        floatType tol = tolr * R + tola;
-
-        unsigned int num_iteration = 0;
-
-        floatVector dX;
-
-        while ( ( num_iteration < max_iteration ) && ( R > tol ) ){
-
-            unsigned int rank;
-
-            dX = -vectorTools::solveLinearSystem( d2LdXdX, dLdX, dLdX.size( ), dLdX.size( ), rank );
-
-            floatType lambda = 1;
-
-            ERROR_TOOLS_CATCH( computeOverlapDistanceLagrangian( X + lambda * dX, chi_nl, xi_t, R_nl, L,
-                                                                 dLdX, dLdchi_nl, dLdxi_t, dLdR_nl,
-                                                                 d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl,
-                                                                 d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl,
-                                                                 d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
-                                                                 d2LdR_nldR_nl ) );
-
-            unsigned int num_ls = 0;
-
-            R = vectorTools::l2norm( dLdX );
-
-            while ( ( num_ls < max_ls ) && ( R > ( 1 - alpha_ls ) * Rp ) ){ 
-
-                lambda *= 0.5;
-
-                ERROR_TOOLS_CATCH( computeOverlapDistanceLagrangian( X + lambda * dX, chi_nl, xi_t, R_nl, L,
-                                                                     dLdX, dLdchi_nl, dLdxi_t, dLdR_nl,
-                                                                     d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl,
-                                                                     d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl,
-                                                                     d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
-                                                                     d2LdR_nldR_nl ) );
-
-                R = vectorTools::l2norm( dLdX );
-
-                num_ls++;
-
-            }
-
-            if ( R > ( 1 - alpha_ls ) * Rp ){
-
-                ERROR_TOOLS_CATCH( throw std::runtime_error( "Failure in linesearch" ) );
-
-            }
-
-            X += lambda * dX;
-
-            Rp = R;
-
-            num_iteration++;
-
-        }
-
-        if ( R > tol ){
-
-            ERROR_TOOLS_CATCH( throw std::runtime_error( "The optimizer did not converge" ) );
-
-        }
-
         d = -xi_t;
 
         for ( unsigned int i = 0; i < xi_t.size( ); i++ ){
@@ -7418,23 +8483,53 @@ namespace tractionSeparation{
          * \param alpha_ls: The alpha parameter for the line-search
          */
 
-        floatVector inv_chi_nl = vectorTools::inverse( chi_nl, xi_t.size( ), xi_t.size( ) );
+        floatVector X;
 
-        floatVector Xi_t( xi_t.size( ), 0 );
+        ERROR_TOOLS_CATCH( solveOverlapDistance( chi_nl, xi_t, R_nl, X, d, dddchi_nl, dddxi_t, dddR_nl,
+                                                 d2ddchi_nldchi_nl, d2ddchi_nldxi_t, d2ddchi_nldR_nl,
+                                                 d2ddxi_tdxi_t, d2ddxi_tdR_nl,
+                                                 d2ddR_nldR_nl,
+                                                 tolr, tola, max_iteration, max_ls, alpha_ls ) );
 
-        for ( unsigned int I = 0; I < xi_t.size( ); I++ ){
-
-            for ( unsigned int i = 0; i < xi_t.size( ); i++ ){
-
-                Xi_t[ I ] += inv_chi_nl[ xi_t.size( ) * I + i ] * xi_t[ i ];
-
-            }
+        return;
 
-        }
+    }
 
-        floatVector lagrange( 1, 1 );
+    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &X, floatVector &d,
+                                   floatMatrix &dddchi_nl, floatMatrix &dddxi_t, floatVector &dddR_nl,
+                                   floatMatrix &d2ddchi_nldchi_nl, floatMatrix &d2ddchi_nldxi_t, floatMatrix &d2ddchi_nldR_nl,
+                                   floatMatrix &d2ddxi_tdxi_t, floatMatrix &d2ddxi_tdR_nl,
+                                   floatVector &d2ddR_nldR_nl,
+                                   const floatType tolr, const floatType tola, const unsigned int max_iteration,
+                                   const unsigned int max_ls, const floatType alpha_ls ){
+        /*!
+         * Solve for the overlap distance where \f$\xi_t\f$ is known to be inside of the non-local particle
+         * 
+         * \param &chi_nl: The non-local micro-deformation tensor
+         * \param &xi_t: The position inside of the non-local particle
+         * \param &R_nl: The non-local particle radius in the reference configuration
+         * \param &X: The unknown vector of the Lagrangian i.e. the reference position on the surface of the non-local particle
+         *     followed by the Lagrange multiplier. If it has a size of the dimension plus one on entry it is used
+         *     as the initial iterate ( e.g. the solution from the previous increment ) otherwise the default guess is used.
+         *     An initial iterate which fails to converge is replaced by the default guess.
+         * \param &d: The distance vector going from \f$\xi_t\f$ to the solved point on the surface of the non-local particle.
+         * \param &dddchi_nl: The gradient of the distance vector w.r.t. the non-local micro-deformation tensor
+         * \param &dddxi_t: The gradient of the distance vector w.r.t. the target micro-relative position vector
+         * \param &dddR_nl: The gradient of the distance vector w.r.t. the non-local particle radius
+         * \param &d2ddchi_nldchi_nl: The second gradient of the distance vector w.r.t. the non-local micro-deformation tensor
+         * \param &d2ddchi_nldxi_t: The second gradient of the distance vector w.r.t. the non-local micro-deformation tensor and \f$\xi_t\f$
+         * \param &d2ddchi_nldR_nl: The second gradient of the distance vector w.r.t. the non-local micro-deformation tensor the non-local reference radius
+         * \param &d2ddxi_tdxi_t: The second gradient of the distance vector w.r.t. \f$\xi_t\f$
+         * \param &d2ddxi_tdR_nl: The second gradient of the distance vector w.r.t. \f$\xi_t\f$ and the non-local reference radius
+         * \param &d2ddR_nldR_nl: The second gradient of the distance vector w.r.t. the non-local reference radius
+         * \param tolr: The relative tolerance
+         * \param tola: The absolute tolerance
+         * \param max_iteration: The maximum number of iterations
+         * \param max_ls: The maximum number of line-search iterations
+         * \param alpha_ls: The alpha parameter for the line-search
+         */
 
-        floatVector X = vectorTools::appendVectors( { Xi_t, lagrange } );
+        ERROR_TOOLS_CATCH( solveOverlapDistanceUnknowns( chi_nl, xi_t, R_nl, X, tolr, tola, max_iteration, max_ls, alpha_ls ) );
 
         floatType L;
 
@@ -7446,79 +8541,6 @@ namespace tractionSeparation{
 
         floatType d2LdR_nldR_nl;
 
-        ERROR_TOOLS_CATCH( computeOverlapDistanceLagrangian( X, chi_nl, xi_t, R_nl, L,
-                                                             dLdX, dLdchi_nl, dLdxi_t, dLdR_nl,
-                                                             d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl,
-                                                             d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl,
-                                                             d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
-                                                             d2LdR_nldR_nl ) );
-
-        floatType R = vectorTools::l2norm( dLdX );
-
-        floatType Rp = R;
-
-        floatType tol = tolr * R + tola;
-
-        unsigned int num_iteration = 0;
-
-        floatVector dX;
-
-        while ( ( num_iteration < max_iteration ) && ( R > tol ) ){
-
-            unsigned int rank;
-
-            dX = -vectorTools::solveLinearSystem( d2LdXdX, dLdX, dLdX.size( ), dLdX.size( ), rank );
-
-            floatType lambda = 1;
-
-            ERROR_TOOLS_CATCH( computeOverlapDistanceLagrangian( X + lambda * dX, chi_nl, xi_t, R_nl, L,
-                                                                 dLdX, dLdchi_nl, dLdxi_t, dLdR_nl,
-                                                                 d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl,
-                                                                 d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl,
-                                                                 d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
-                                                                 d2LdR_nldR_nl ) );
-
-            unsigned int num_ls = 0;
-
-            R = vectorTools::l2norm( dLdX );
-
-            while ( ( num_ls < max_ls ) && ( R > ( 1 - alpha_ls ) * Rp ) ){ 
-
-                lambda *= 0.5;
-
-                ERROR_TOOLS_CATCH( computeOverlapDistanceLagrangian( X + lambda * dX, chi_nl, xi_t, R_nl, L,
-                                                                     dLdX, dLdchi_nl, dLdxi_t, dLdR_nl,
-                                                                     d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl,
-                                                                     d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl,
-                                                                     d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
-                                                                     d2LdR_nldR_nl ) );
-
-                R = vectorTools::l2norm( dLdX );
-
-                num_ls++;
-
-            }
-
-            if ( R > ( 1 - alpha_ls ) * Rp ){
-
-                ERROR_TOOLS_CATCH( throw std::runtime_error( "Failure in linesearch" ) );
-
-            }
-
-            X += lambda * dX;
-
-            Rp = R;
-
-            num_iteration++;
-
-        }
-
-        if ( R > tol ){
-
-            ERROR_TOOLS_CATCH( throw std::runtime_error( "The optimizer did not converge" ) );
-
-        }
-
         d = -xi_t;
 
         for ( unsigned int i = 0; i < xi_t.size( ); i++ ){
@@ -7868,15 +8890,79 @@ namespace tractionSeparation{
 
                 }
 
-            }
+            }
+
+        }
+
+        return;
+
+    }
+
+    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &d,
+                                   floatMatrix &dddchi_nl, floatMatrix &dddxi_t, floatVector &dddR_nl,
+                                   floatMatrix &d2ddchi_nldchi_nl, floatMatrix &d2ddchi_nldxi_t, floatMatrix &d2ddchi_nldR_nl,
+                                   floatMatrix &d2ddxi_tdxi_t, floatMatrix &d2ddxi_tdR_nl,
+                                   floatVector &d2ddR_nldR_nl,
+                                   floatMatrix &d3ddchi_nldchi_nldchi_nl, floatMatrix &d3ddchi_nldchi_nldxi_t, floatMatrix &d3ddchi_nldchi_nldR_nl,
+                                   floatMatrix &d3ddchi_nldxi_tdxi_t, floatMatrix &d3ddchi_nldxi_tdR_nl,
+                                   floatMatrix &d3ddchi_nldR_nldR_nl,
+                                   floatMatrix &d3ddxi_tdxi_tdxi_t, floatMatrix &d3ddxi_tdxi_tdR_nl,
+                                   floatMatrix &d3ddxi_tdR_nldR_nl,
+                                   floatVector &d3ddR_nldR_nldR_nl,
+                                   const floatType tolr, const floatType tola, const unsigned int max_iteration,
+                                   const unsigned int max_ls, const floatType alpha_ls ){
+        /*!
+         * Solve for the overlap distance where \f$\xi_t\f$ is known to be inside of the non-local particle
+         * 
+         * \param &chi_nl: The non-local micro-deformation tensor
+         * \param &xi_t: The position inside of the non-local particle
+         * \param &R_nl: The non-local particle radius in the reference configuration
+         * \param &d: The distance vector going from \f$\xi_t\f$ to the solved point on the surface of the non-local particle.
+         * \param &dddchi_nl: The gradient of the distance vector w.r.t. the non-local micro-deformation tensor
+         * \param &dddxi_t: The gradient of the distance vector w.r.t. the target micro-relative position vector
+         * \param &dddR_nl: The gradient of the distance vector w.r.t. the non-local particle radius
+         * \param &d2ddchi_nldchi_nl: The second gradient of the distance vector w.r.t. the non-local micro-deformation tensor
+         * \param &d2ddchi_nldxi_t: The second gradient of the distance vector w.r.t. the non-local micro-deformation tensor and \f$\xi_t\f$
+         * \param &d2ddchi_nldR_nl: The second gradient of the distance vector w.r.t. the non-local micro-deformation tensor the non-local reference radius
+         * \param &d2ddxi_tdxi_t: The second gradient of the distance vector w.r.t. \f$\xi_t\f$
+         * \param &d2ddxi_tdR_nl: The second gradient of the distance vector w.r.t. \f$\xi_t\f$ and the non-local reference radius
+         * \param &d2ddR_nldR_nl: The second gradient of the distance vector w.r.t. the non-local reference radius
+         * \param &d3ddchi_nldchi_nldchi_nl: The third gradient of the distance vector w.r.t. the non-local micro-deformation tensor
+         * \param &d3ddchi_nldchi_nldxi_t: The third gradient of the distance vector w.r.t. the non-local micro-deformation tensor twice and \f$\xi_t\f$ once
+         * \param &d3ddchi_nldchi_nldR_nl: The third gradient of the distance vector w.r.t. the non-local micro-deformation tensor, \f$\xi_t\f$, and the non-local reference radius
+         * \param &d3ddchi_nldxi_tdxi_t: The third gradient of the distance vector w.r.t. the non-local micro-deformation tensor once and \f$\xi_t\f$ twice
+         * \param &d3ddchi_nldxi_tdR_nl: The third gradient of the distance vector w.r.t. the non-local micro-deformation tensor, \f$\xi_t\f$ twice, and the non-local reference radius
+         * \param &d3ddchi_nldR_nldR_nl: The third gradient of the distance vector w.r.t. the non-local micro-deformation tensor once and the non-local reference radius twice
+         * \param &d3ddxi_tdxi_tdxi_t: The third gradient of the distance vector w.r.t. \f$\xi_t\f$
+         * \param &d3ddxi_tdxi_tdR_nl: The third gradient of the distance vector w.r.t. \f$\xi_t\f$ twice and the non-local reference radius once
+         * \param &d3ddxi_tdR_nldR_nl: The third gradient of the distance vector w.r.t. \f$\xi_t\f$ once and the non-local reference radius twice
+         * \param &d3ddR_nldR_nldR_nl: The third gradient of the distance vector w.r.t. the non-local reference radius
+         * \param tolr: The relative tolerance
+         * \param tola: The absolute tolerance
+         * \param max_iteration: The maximum number of iterations
+         * \param max_ls: The maximum number of line-search iterations
+         * \param alpha_ls: The alpha parameter for the line-search
+         */
+
+        floatVector X;
 
-        }
+        ERROR_TOOLS_CATCH( solveOverlapDistance( chi_nl, xi_t, R_nl, X, d, dddchi_nl, dddxi_t, dddR_nl,
+                                                 d2ddchi_nldchi_nl, d2ddchi_nldxi_t, d2ddchi_nldR_nl,
+                                                 d2ddxi_tdxi_t, d2ddxi_tdR_nl,
+                                                 d2ddR_nldR_nl,
+                                                 d3ddchi_nldchi_nldchi_nl, d3ddchi_nldchi_nldxi_t, d3ddchi_nldchi_nldR_nl,
+                                                 d3ddchi_nldxi_tdxi_t, d3ddchi_nldxi_tdR_nl,
+                                                 d3ddchi_nldR_nldR_nl,
+                                                 d3ddxi_tdxi_tdxi_t, d3ddxi_tdxi_tdR_nl,
+                                                 d3ddxi_tdR_nldR_nl,
+                                                 d3ddR_nldR_nldR_nl,
+                                                 tolr, tola, max_iteration, max_ls, alpha_ls ) );
 
         return;
 
     }
 
-    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &d,
+    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &X, floatVector &d,
                                    floatMatrix &dddchi_nl, floatMatrix &dddxi_t, floatVector &dddR_nl,
                                    floatMatrix &d2ddchi_nldchi_nl, floatMatrix &d2ddchi_nldxi_t, floatMatrix &d2ddchi_nldR_nl,
                                    floatMatrix &d2ddxi_tdxi_t, floatMatrix &d2ddxi_tdR_nl,
@@ -7895,6 +8981,10 @@ namespace tractionSeparation{
          * \param &chi_nl: The non-local micro-deformation tensor
          * \param &xi_t: The position inside of the non-local particle
          * \param &R_nl: The non-local particle radius in the reference configuration
+         * \param &X: The unknown vector of the Lagrangian i.e. the reference position on the surface of the non-local particle
+         *     followed by the Lagrange multiplier. If it has a size of the dimension plus one on entry it is used
+         *     as the initial iterate ( e.g. the solution from the previous increment ) otherwise the default guess is used.
+         *     An initial iterate which fails to converge is replaced by the default guess.
          * \param &d: The distance vector going from \f$\xi_t\f$ to the solved point on the surface of the non-local particle.
          * \param &dddchi_nl: The gradient of the distance vector w.r.t. the non-local micro-deformation tensor
          * \param &dddxi_t: The gradient of the distance vector w.r.t. the target micro-relative position vector
@@ -7922,23 +9012,7 @@ namespace tractionSeparation{
          * \param alpha_ls: The alpha parameter for the line-search
          */
 
-        floatVector inv_chi_nl = vectorTools::inverse( chi_nl, xi_t.size( ), xi_t.size( ) );
-
-        floatVector Xi_t( xi_t.size( ), 0 );
-
-        for ( unsigned int I = 0; I < xi_t.size( ); I++ ){
-
-            for ( unsigned int i = 0; i < xi_t.size( ); i++ ){
-
-                Xi_t[ I ] += inv_chi_nl[ xi_t.size( ) * I + i ] * xi_t[ i ];
-
-            }
-
-        }
-
-        floatVector lagrange( 1, 1 );
-
-        floatVector X = vectorTools::appendVectors( { Xi_t, lagrange } );
+        ERROR_TOOLS_CATCH( solveOverlapDistanceUnknowns( chi_nl, xi_t, R_nl, X, tolr, tola, max_iteration, max_ls, alpha_ls ) );
 
         floatType L;
 
@@ -7950,79 +9024,6 @@ namespace tractionSeparation{
 
         floatType d2LdR_nldR_nl;
 
-        ERROR_TOOLS_CATCH( computeOverlapDistanceLagrangian( X, chi_nl, xi_t, R_nl, L,
-                                                             dLdX, dLdchi_nl, dLdxi_t, dLdR_nl,
-                                                             d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl,
-                                                             d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl,
-                                                             d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
-                                                             d2LdR_nldR_nl ) );
-
-        floatType R = vectorTools::l2norm( dLdX );
-
-        floatType Rp = R;
-
-        floatType tol = tolr * R + tola;
-
-        unsigned int num_iteration = 0;
-
-        floatVector dX;
-
-        while ( ( num_iteration < max_iteration ) && ( R > tol ) ){
-
-            unsigned int rank;
-
-            dX = -vectorTools::solveLinearSystem( d2LdXdX, dLdX, dLdX.size( ), dLdX.size( ), rank );
-
-            floatType lambda = 1;
-
-            ERROR_TOOLS_CATCH( computeOverlapDistanceLagrangian( X + lambda * dX, chi_nl, xi_t, R_nl, L,
-                                                                 dLdX, dLdchi_nl, dLdxi_t, dLdR_nl,
-                                                                 d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl,
-                                                                 d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl,
-                                                                 d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
-                                                                 d2LdR_nldR_nl ) );
-
-            unsigned int num_ls = 0;
-
-            R = vectorTools::l2norm( dLdX );
-
-            while ( ( num_ls < max_ls ) && ( R > ( 1 - alpha_ls ) * Rp ) ){ 
-
-                lambda *= 0.5;
-
-                ERROR_TOOLS_CATCH( computeOverlapDistanceLagrangian( X + lambda * dX, chi_nl, xi_t, R_nl, L,
-                                                                     dLdX, dLdchi_nl, dLdxi_t, dLdR_nl,
-                                                                     d2LdXdX, d2LdXdchi_nl, d2LdXdxi_t, d2LdXdR_nl,
-                                                                     d2Ldchi_nldchi_nl, d2Ldchi_nldxi_t, d2Ldchi_nldR_nl,
-                                                                     d2Ldxi_tdxi_t, d2Ldxi_tdR_nl,
-                                                                     d2LdR_nldR_nl ) );
-
-                R = vectorTools::l2norm( dLdX );
-
-                num_ls++;
-
-            }
-
-            if ( R > ( 1 - alpha_ls ) * Rp ){
-
-                ERROR_TOOLS_CATCH( throw std::runtime_error( "Failure in linesearch" ) );
-
-            }
-
-            X += lambda * dX;
-
-            Rp = R;
-
-            num_iteration++;
-
-        }
-
-        if ( R > tol ){
-
-            ERROR_TOOLS_CATCH( throw std::runtime_error( "The optimizer did not converge" ) );
-
-        }
-
         d = -xi_t;
 
         for ( unsigned int i = 0; i < xi_t.size( ); i++ ){
@@ -8809,4 +9810,432 @@ namespace tractionSeparation{
 
     }
 
+
+    void solveOverlapDistanceBatch( const unsigned int &numPoints, const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl,
+                                        floatVector &X, floatVector &d,
+                                        const floatType tolr, const floatType tola, const unsigned int max_iteration,
+                                        const unsigned int max_ls, const floatType alpha_ls ){
+        /*!
+         * Solve for the overlap distances of many points which are known to be inside of the same non-local particle.
+         * The products of the non-local micro-deformation tensor and the solver storage are shared between all of the points.
+         *
+         * The points are stored point by point i.e. the i'th component of the p'th point is at xi_t[ dim * p + i ]
+         *
+         * \param &numPoints: The number of points
+         * \param &chi_nl: The non-local micro-deformation tensor
+         * \param &xi_t: The positions inside of the non-local particle
+         * \param &R_nl: The non-local particle radius in the reference configuration
+         * \param &X: The unknown vectors of the Lagrangian stored as X[ ( dim + 1 ) * p + I ]. If X has a size of numPoints * ( dim + 1 )
+         *     on entry the values are used as the initial iterates ( e.g. the solutions from the previous increment ) otherwise the
+         *     default guess is used for every point. A point whose initial iterate fails to converge is solved again from the
+         *     default guess.
+         * \param &d: The distance vectors going from each \f$\xi_t\f$ to the solved point on the surface of the non-local particle
+         *     stored as d[ dim * p + i ]
+         * \param tolr: The relative tolerance
+         * \param tola: The absolute tolerance
+         * \param max_iteration: The maximum number of iterations
+         * \param max_ls: The maximum number of line-search iterations
+         * \param alpha_ls: The alpha parameter for the line-search
+         */
+
+        if ( numPoints == 0 ){
+
+            X.clear( );
+
+            d.clear( );
+
+            return;
+
+        }
+
+        if ( ( xi_t.size( ) % numPoints ) != 0 ){
+
+            ERROR_TOOLS_CATCH( throw std::runtime_error( "xi_t has a size of " + std::to_string( xi_t.size( ) ) + " which is not a multiple of the number of points ( " + std::to_string( numPoints ) + " )" ) );
+
+        }
+
+        const unsigned int dim = xi_t.size( ) / numPoints;
+
+        overlapDistanceWorkspace workspace;
+
+        ERROR_TOOLS_CATCH( initializeOverlapDistanceWorkspace( chi_nl, dim, workspace ) );
+
+        const bool warmStart = ( X.size( ) == numPoints * ( dim + 1 ) );
+
+        if ( !warmStart ){
+
+            X = floatVector( numPoints * ( dim + 1 ), 0 );
+
+            for ( unsigned int p = 0; p < numPoints; p++ ){
+
+                initializeOverlapDistanceGuess( workspace.invChi, xi_t.data( ) + dim * p, dim, X.data( ) + ( dim + 1 ) * p );
+
+            }
+
+        }
+
+        d = floatVector( numPoints * dim, 0 );
+
+        for ( unsigned int p = 0; p < numPoints; p++ ){
+
+            floatType *Xp = X.data( ) + ( dim + 1 ) * p;
+
+            solverStatus status = solveOverlapDistanceUnknowns( chi_nl, xi_t.data( ) + dim * p, dim, R_nl, Xp,
+                                                                tolr, tola, max_iteration, max_ls, alpha_ls, workspace );
+
+            if ( warmStart && ( status != SOLVER_CONVERGED ) ){
+
+                initializeOverlapDistanceGuess( workspace.invChi, xi_t.data( ) + dim * p, dim, Xp );
+
+                status = solveOverlapDistanceUnknowns( chi_nl, xi_t.data( ) + dim * p, dim, R_nl, Xp,
+                                                       tolr, tola, max_iteration, max_ls, alpha_ls, workspace );
+
+            }
+
+            ERROR_TOOLS_CATCH( checkSolverStatus( status ) );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                d[ dim * p + i ] = -xi_t[ dim * p + i ];
+
+                for ( unsigned int I = 0; I < dim; I++ ){
+
+                    d[ dim * p + i ] += chi_nl[ dim * i + I ] * Xp[ I ];
+
+                }
+
+            }
+
+        }
+
+        return;
+
+    }
+
+    bool isOffloadEnabled( ){
+        /*!
+         * Check whether the batched pair kernels are evaluated on an OpenMP target device i.e. if the library was compiled
+         * with ASP_OPENMP_OFFLOAD and a device is available
+         */
+
+#ifdef ASP_OPENMP_OFFLOAD
+        return omp_get_num_devices( ) > 0;
+#else
+        return false;
+#endif
+
+    }
+
+    adhesionPairBatch::~adhesionPairBatch( ){
+        /*!
+         * Release the device buffers of the batch
+         */
+
+        release( );
+
+    }
+
+    void adhesionPairBatch::release( ){
+        /*!
+         * Unmap the buffers of the batch from the device. The host buffers are retained.
+         */
+
+        if ( !_mapped ){
+
+            return;
+
+        }
+
+#ifdef ASP_OPENMP_OFFLOAD
+        // The buffers are only referenced in the map clauses which some compilers do not count as uses
+        [[maybe_unused]] const unsigned int n = _numPairs;
+
+        [[maybe_unused]] floatType *Xi_1 = _Xi_1.data( );
+        [[maybe_unused]] floatType *Xi_2 = _Xi_2.data( );
+        [[maybe_unused]] floatType *D = _D.data( );
+        [[maybe_unused]] floatType *weights = _weights.data( );
+        [[maybe_unused]] floatType *chiNL = _chiNL.data( );
+        [[maybe_unused]] floatType *normals = _normals.data( );
+        [[maybe_unused]] floatType *tractions = _tractions.data( );
+        [[maybe_unused]] floatType *energies = _energies.data( );
+        [[maybe_unused]] floatType *dEnergydChiNL = _dEnergydChiNL.data( );
+        [[maybe_unused]] floatType *dEnergydNormals = _dEnergydNormals.data( );
+
+        #pragma omp target exit data map( delete: Xi_1[ 0 : dim * n ], Xi_2[ 0 : dim * n ], D[ 0 : dim * n ], weights[ 0 : n ], \
+                                                  chiNL[ 0 : dim * dim * n ], normals[ 0 : dim * n ], tractions[ 0 : dim * n ], \
+                                                  energies[ 0 : n ], dEnergydChiNL[ 0 : dim * dim * n ], dEnergydNormals[ 0 : dim * n ] )
+#endif
+
+        _mapped = false;
+
+    }
+
+    void adhesionPairBatch::allocate( const unsigned int &numPairs ){
+        /*!
+         * Size the host buffers for a number of pairs and map them to the device. The buffers are only re-allocated, and
+         * re-mapped, when the number of pairs changes.
+         *
+         * \param &numPairs: The number of pairs
+         */
+
+        if ( _mapped && ( numPairs == _numPairs ) ){
+
+            return;
+
+        }
+
+        release( );
+
+        _numPairs = numPairs;
+
+        _Xi_1.resize( dim * numPairs );
+        _Xi_2.resize( dim * numPairs );
+        _D.resize( dim * numPairs );
+        _weights.resize( numPairs );
+        _chiNL.resize( dim * dim * numPairs );
+        _normals.resize( dim * numPairs );
+        _tractions.resize( dim * numPairs );
+        _energies.resize( numPairs );
+        _dEnergydChiNL.resize( dim * dim * numPairs );
+        _dEnergydNormals.resize( dim * numPairs );
+
+#ifdef ASP_OPENMP_OFFLOAD
+        [[maybe_unused]] const unsigned int n = _numPairs;
+
+        [[maybe_unused]] floatType *Xi_1 = _Xi_1.data( );
+        [[maybe_unused]] floatType *Xi_2 = _Xi_2.data( );
+        [[maybe_unused]] floatType *D = _D.data( );
+        [[maybe_unused]] floatType *weights = _weights.data( );
+        [[maybe_unused]] floatType *chiNL = _chiNL.data( );
+        [[maybe_unused]] floatType *normals = _normals.data( );
+        [[maybe_unused]] floatType *tractions = _tractions.data( );
+        [[maybe_unused]] floatType *energies = _energies.data( );
+        [[maybe_unused]] floatType *dEnergydChiNL = _dEnergydChiNL.data( );
+        [[maybe_unused]] floatType *dEnergydNormals = _dEnergydNormals.data( );
+
+        #pragma omp target enter data map( alloc: Xi_1[ 0 : dim * n ], Xi_2[ 0 : dim * n ], D[ 0 : dim * n ], weights[ 0 : n ], \
+                                                  chiNL[ 0 : dim * dim * n ], normals[ 0 : dim * n ], tractions[ 0 : dim * n ], \
+                                                  energies[ 0 : n ], dEnergydChiNL[ 0 : dim * dim * n ], dEnergydNormals[ 0 : dim * n ] )
+#endif
+
+        _mapped = true;
+
+    }
+
+    void adhesionPairBatch::setReferencePairs( const unsigned int &numPairs, const floatVector &Xi_1, const floatVector &Xi_2,
+                                               const floatVector &D, const floatVector &weights ){
+        /*!
+         * Set the reference data of the pairs and copy them to the device where they remain until they are set again
+         *
+         * \param &numPairs: The number of pairs
+         * \param &Xi_1: The reference relative positions of the local surface points stored as a structure of arrays
+         * \param &Xi_2: The reference relative positions of the non-local surface points stored as a structure of arrays
+         * \param &D: The reference distances between the particle centers stored as a structure of arrays
+         * \param &weights: The weight of each pair e.g. the surface quadrature weight of the local surface point
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( numPairs > 0, "The batch must contain at least one pair" );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( Xi_1.size( ) == dim * numPairs, "Xi_1 has a size of " + std::to_string( Xi_1.size( ) ) + " but should have a size of " + std::to_string( dim * numPairs ) );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( Xi_2.size( ) == dim * numPairs, "Xi_2 has a size of " + std::to_string( Xi_2.size( ) ) + " but should have a size of " + std::to_string( dim * numPairs ) );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( D.size( ) == dim * numPairs, "D has a size of " + std::to_string( D.size( ) ) + " but should have a size of " + std::to_string( dim * numPairs ) );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( weights.size( ) == numPairs, "The weights have a size of " + std::to_string( weights.size( ) ) + " but should have a size of " + std::to_string( numPairs ) );
+
+        allocate( numPairs );
+
+        std::copy( Xi_1.begin( ), Xi_1.end( ), _Xi_1.begin( ) );
+        std::copy( Xi_2.begin( ), Xi_2.end( ), _Xi_2.begin( ) );
+        std::copy( D.begin( ), D.end( ), _D.begin( ) );
+        std::copy( weights.begin( ), weights.end( ), _weights.begin( ) );
+
+#ifdef ASP_OPENMP_OFFLOAD
+        [[maybe_unused]] const unsigned int n = _numPairs;
+
+        [[maybe_unused]] floatType *Xi_1_d = _Xi_1.data( );
+        [[maybe_unused]] floatType *Xi_2_d = _Xi_2.data( );
+        [[maybe_unused]] floatType *D_d = _D.data( );
+        [[maybe_unused]] floatType *weights_d = _weights.data( );
+
+        #pragma omp target update to( Xi_1_d[ 0 : dim * n ], Xi_2_d[ 0 : dim * n ], D_d[ 0 : dim * n ], weights_d[ 0 : n ] )
+#endif
+
+        _referenceUploads++;
+
+    }
+
+    void adhesionPairBatch::evaluate( const floatVector &F, const floatVector &chi, const floatVector &chiNL, const floatVector &normals,
+                                      const floatVector &parameters, [[maybe_unused]] const unsigned int numThreads ){
+        /*!
+         * Evaluate the linear traction separation responses of the pairs and the first derivatives of their weighted energy
+         *
+         * \f$d_i = F_{iI} dX_I - \chi_{iI} \Xi_I^1 + \chi_{iI}^{NL} \Xi_I^2 \f$
+         *
+         * \f$t_i = E^n d^n_i + E^t d^t_i \f$
+         *
+         * \f$e = \frac{1}{2} \left[ E^n d^n_i d^n_i + E^t d^t_i d^t_i\right]\f$
+         *
+         * \f$E = \sum_p w_p e_p \f$
+         *
+         * where \f$dX_I = \Xi_I^1 + D_I - \Xi_I^2 \f$ and the distance is decomposed as in decomposeVector. The results are
+         * the same as computeCurrentDistanceGeneral, decomposeVector, computeLinearTraction, and computeLinearTractionEnergy
+         * applied to each pair. The normals are assumed to be unit vectors and are not checked in the kernel.
+         *
+         * \param &F: The deformation gradient \f$\frac{dx_i}{dX_I}\f$ shared by the pairs
+         * \param &chi: The local micro-deformation shared by the pairs
+         * \param &chiNL: The non-local micro-deformation of each pair stored as a structure of arrays so that component iI
+         *     of pair p is stored at [ numPairs * ( dim * i + I ) + p ]
+         * \param &normals: The current normal of the local surface point of each pair stored as a structure of arrays
+         * \param &parameters: The traction separation parameters \f$ E^n \f$ and \f$ E^t \f$
+         * \param numThreads: The number of threads which evaluate the pairs on the host. Unused when offloaded.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( _mapped, "The reference pairs must be set before the batch is evaluated" );
+
+        const unsigned int n = _numPairs;
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( F.size( ) == dim * dim, "The deformation gradient has a size of " + std::to_string( F.size( ) ) + " but should have a size of " + std::to_string( dim * dim ) );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( chi.size( ) == dim * dim, "The micro-deformation has a size of " + std::to_string( chi.size( ) ) + " but should have a size of " + std::to_string( dim * dim ) );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( chiNL.size( ) == dim * dim * n, "The non-local micro-deformation has a size of " + std::to_string( chiNL.size( ) ) + " but should have a size of " + std::to_string( dim * dim * n ) );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( normals.size( ) == dim * n, "The normals have a size of " + std::to_string( normals.size( ) ) + " but should have a size of " + std::to_string( dim * n ) );
+
+        TARDIGRADE_ERROR_TOOLS_CHECK( parameters.size( ) == 2, "Two parameters are required for the traction-separation law. " + std::to_string( parameters.size( ) ) + " are provided." );
+
+        std::copy( chiNL.begin( ), chiNL.end( ), _chiNL.begin( ) );
+        std::copy( normals.begin( ), normals.end( ), _normals.begin( ) );
+
+        const floatType *Xi_1_p = _Xi_1.data( );
+        const floatType *Xi_2_p = _Xi_2.data( );
+        const floatType *D_p = _D.data( );
+        const floatType *weights_p = _weights.data( );
+        const floatType *chiNL_p = _chiNL.data( );
+        const floatType *normals_p = _normals.data( );
+        [[maybe_unused]] floatType *tractions_p = _tractions.data( );
+        [[maybe_unused]] floatType *energies_p = _energies.data( );
+        [[maybe_unused]] floatType *dEnergydChiNL_p = _dEnergydChiNL.data( );
+        [[maybe_unused]] floatType *dEnergydNormals_p = _dEnergydNormals.data( );
+
+        const floatType En = parameters[ 0 ];
+
+        const floatType Et = parameters[ 1 ];
+
+        floatType F_p[ dim * dim ], chi_p[ dim * dim ];
+
+        std::copy( F.begin( ), F.end( ), F_p );
+        std::copy( chi.begin( ), chi.end( ), chi_p );
+
+        floatType energy = 0;
+
+        floatType dEnergydF_p[ dim * dim ] = { };
+
+        floatType dEnergydChi_p[ dim * dim ] = { };
+
+#ifdef ASP_OPENMP_OFFLOAD
+        #pragma omp target update to( chiNL_p[ 0 : dim * dim * n ], normals_p[ 0 : dim * n ] )
+
+        #pragma omp target teams distribute parallel for \
+            map( alloc: Xi_1_p[ 0 : dim * n ], Xi_2_p[ 0 : dim * n ], D_p[ 0 : dim * n ], weights_p[ 0 : n ], \
+                        chiNL_p[ 0 : dim * dim * n ], normals_p[ 0 : dim * n ], tractions_p[ 0 : dim * n ], energies_p[ 0 : n ], \
+                        dEnergydChiNL_p[ 0 : dim * dim * n ], dEnergydNormals_p[ 0 : dim * n ] ) \
+            map( to: F_p[ 0 : dim * dim ], chi_p[ 0 : dim * dim ] ) \
+            map( tofrom: energy, dEnergydF_p[ 0 : dim * dim ], dEnergydChi_p[ 0 : dim * dim ] ) \
+            reduction( +: energy, dEnergydF_p[ 0 : dim * dim ], dEnergydChi_p[ 0 : dim * dim ] )
+#elif defined( _OPENMP )
+        #pragma omp parallel for num_threads( numThreads ) \
+            reduction( +: energy, dEnergydF_p[ 0 : dim * dim ], dEnergydChi_p[ 0 : dim * dim ] )
+#endif
+        for ( unsigned int p = 0; p < n; p++ ){
+
+            floatType dX[ dim ], d[ dim ], nrm[ dim ], dt[ dim ], t[ dim ];
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                dX[ I ] = Xi_1_p[ n * I + p ] + D_p[ n * I + p ] - Xi_2_p[ n * I + p ];
+
+                nrm[ I ] = normals_p[ n * I + p ];
+
+            }
+
+            // The current distance
+            floatType dn = 0;
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                d[ i ] = 0;
+
+                for ( unsigned int I = 0; I < dim; I++ ){
+
+                    d[ i ] += F_p[ dim * i + I ] * dX[ I ] - chi_p[ dim * i + I ] * Xi_1_p[ n * I + p ]
+                            + chiNL_p[ n * ( dim * i + I ) + p ] * Xi_2_p[ n * I + p ];
+
+                }
+
+                dn += d[ i ] * nrm[ i ];
+
+            }
+
+            // The decomposition, traction, and energy
+            floatType dndn = 0, dtdt = 0, an = 0;
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                dt[ i ] = d[ i ] - dn * nrm[ i ];
+
+                t[ i ] = En * dn * nrm[ i ] + Et * dt[ i ];
+
+                dndn += dn * nrm[ i ] * dn * nrm[ i ];
+
+                dtdt += dt[ i ] * dt[ i ];
+
+                an += ( En * dn * nrm[ i ] - Et * dt[ i ] ) * nrm[ i ];
+
+            }
+
+            const floatType e = 0.5 * ( En * dndn + Et * dtdt );
+
+            const floatType w = weights_p[ p ];
+
+            energies_p[ p ] = e;
+
+            energy += w * e;
+
+            // The energy is stationary in d at the traction i.e. de/dd_i = t_i
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                tractions_p[ n * i + p ] = t[ i ];
+
+                dEnergydNormals_p[ n * i + p ] = w * ( ( En * dn * nrm[ i ] - Et * dt[ i ] ) * dn + d[ i ] * an );
+
+                for ( unsigned int I = 0; I < dim; I++ ){
+
+                    dEnergydF_p[ dim * i + I ] += w * t[ i ] * dX[ I ];
+
+                    dEnergydChi_p[ dim * i + I ] -= w * t[ i ] * Xi_1_p[ n * I + p ];
+
+                    dEnergydChiNL_p[ n * ( dim * i + I ) + p ] = w * t[ i ] * Xi_2_p[ n * I + p ];
+
+                }
+
+            }
+
+        }
+
+#ifdef ASP_OPENMP_OFFLOAD
+        #pragma omp target update from( tractions_p[ 0 : dim * n ], energies_p[ 0 : n ], dEnergydChiNL_p[ 0 : dim * dim * n ], \
+                                        dEnergydNormals_p[ 0 : dim * n ] )
+#endif
+
+        _energy = energy;
+
+        _dEnergydF = floatVector( dEnergydF_p, dEnergydF_p + dim * dim );
+
+        _dEnergydChi = floatVector( dEnergydChi_p, dEnergydChi_p + dim * dim );
+
+    }
+
 }
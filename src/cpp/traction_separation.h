@@ -11,17 +11,81 @@
 #ifndef TRACTIONSEPARATION_H
 #define TRACTIONSEPARATION_H
 
+#include<array>
+#include<stdexcept>
+#include<string>
+
 #define USE_EIGEN
 #include<vector_tools.h>
 #include<error_tools.h>
 #include<constitutive_tools.h>
 
+#ifdef ASP_FAST_ERROR_HANDLING
+//! Remove the exception context frames from the inner loops. Exceptions still propagate but without the nested context.
+#undef ERROR_TOOLS_CATCH
+#define ERROR_TOOLS_CATCH( expr ) { expr; }
+#undef TARDIGRADE_ERROR_TOOLS_CATCH
+#define TARDIGRADE_ERROR_TOOLS_CATCH( expr ) { expr; }
+#endif
+
 namespace tractionSeparation{
 
     typedef constitutiveTools::floatType floatType; //!< Define the float values type.
     typedef constitutiveTools::floatVector floatVector; //!< Define a vector of floats
     typedef constitutiveTools::floatMatrix floatMatrix; //!< Define a matrix of floats
 
+    template< unsigned int dim >
+    using fixedVector = std::array< floatType, dim >; //!< Define a fixed size vector of floats
+
+    template< unsigned int dim >
+    using fixedSecondOrderTensor = std::array< floatType, dim * dim >; //!< Define a fixed size row-major second order tensor
+
+    template< unsigned int dim >
+    using fixedThirdOrderTensor = std::array< floatType, dim * dim * dim >; //!< Define a fixed size row-major third order tensor
+
+    /*!
+     * Counts of the work done by the overlap distance solver on the calling thread. The counts are only recorded when
+     * the library is compiled with ASP_INSTRUMENTATION and otherwise remain zero.
+     */
+    struct overlapSolverStatistics{
+
+        unsigned long long solves = 0; //!< The number of overlap distance solves
+
+        unsigned long long iterations = 0; //!< The number of Newton iterations
+
+        unsigned long long lineSearchIterations = 0; //!< The number of line-search backtracks
+
+    };
+
+    const overlapSolverStatistics &getOverlapSolverStatistics( );
+
+    enum solverStatus{
+        /*!
+         * The outcome of a solve. The solver kernels return their status rather than throwing so that the inner loops
+         * have no exception handling. The status is converted to an exception by checkSolverStatus.
+         */
+
+        SOLVER_CONVERGED = 0, //!< The solve converged
+        SOLVER_LINESEARCH_FAILURE = 1, //!< The line-search could not reduce the residual
+        SOLVER_NOT_CONVERGED = 2 //!< The residual did not reach the tolerance in the maximum number of iterations
+    };
+
+    class convergenceError : public std::runtime_error{
+        /*!
+         * The exception thrown when a solver fails to converge. A failure to converge may be recovered from by reducing
+         * the time increment so the Abaqus interfaces request a cutback rather than terminating the analysis.
+         */
+
+        public:
+
+            explicit convergenceError( const std::string &message ) : std::runtime_error( message ){ }
+
+    };
+
+    const char *getSolverStatusMessage( const solverStatus &status );
+
+    void checkSolverStatus( const solverStatus &status );
+
     void computeCurrentDistance( const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
                                      const floatVector &F,    const floatVector &chi,  const floatVector &gradChi,
                                      floatVector &d );
@@ -60,6 +124,42 @@ namespace tractionSeparation{
                                             floatMatrix &d2ddFdXi_2, floatMatrix &d2ddchiNLdXi_2,
                                             floatMatrix &d2ddFdD );
 
+    template< unsigned int dim = 3 >
+    void computeCurrentDistanceGeneral( const fixedVector< dim > &Xi_1, const fixedVector< dim > &Xi_2, const fixedVector< dim > &D,
+                                            const fixedSecondOrderTensor< dim > &F, const fixedSecondOrderTensor< dim > &chi,
+                                            const fixedSecondOrderTensor< dim > &chiNL,
+                                            fixedVector< dim > &d );
+
+    template< unsigned int dim = 3 >
+    void computeCurrentDistanceGeneral( const fixedVector< dim > &Xi_1, const fixedVector< dim > &Xi_2, const fixedVector< dim > &D,
+                                            const fixedSecondOrderTensor< dim > &F, const fixedSecondOrderTensor< dim > &chi,
+                                            const fixedSecondOrderTensor< dim > &chiNL,
+                                            fixedVector< dim > &d,
+                                            fixedSecondOrderTensor< dim > &dddXi_1, fixedSecondOrderTensor< dim > &dddXi_2,
+                                            fixedSecondOrderTensor< dim > &dddD,
+                                            fixedThirdOrderTensor< dim > &dddF, fixedThirdOrderTensor< dim > &dddchi,
+                                            fixedThirdOrderTensor< dim > &dddchiNL );
+
+    void computeCurrentDistanceBatch( const unsigned int &numPoints,
+                                          const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
+                                          const floatVector &F,    const floatVector &chi,  const floatVector &gradChi,
+                                          floatVector &d );
+
+    void computeCurrentDistanceBatch( const unsigned int &numPoints,
+                                          const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
+                                          const floatVector &F,    const floatVector &chi,  const floatVector &gradChi,
+                                          floatVector &d, floatVector &dddF, floatVector &dddChi, floatVector &dddGradChi );
+
+    void computeCurrentDistanceGeneralBatch( const unsigned int &numPoints,
+                                                 const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
+                                                 const floatVector &F,    const floatVector &chi,  const floatVector &chiNL,
+                                                 floatVector &d );
+
+    void computeCurrentDistanceGeneralBatch( const unsigned int &numPoints,
+                                                 const floatVector &Xi_1, const floatVector &Xi_2, const floatVector &D,
+                                                 const floatVector &F,    const floatVector &chi,  const floatVector &chiNL,
+                                                 floatVector &d, floatVector &dddF, floatVector &dddchi, floatVector &dddchiNL );
+
     void decomposeVector( const floatVector &d, const floatVector &n,
                               floatVector &dn, floatVector &dt );
 
@@ -181,6 +281,10 @@ namespace tractionSeparation{
                                      const floatVector &F,    const floatVector &chi,  const floatVector &chi_nl_basis, const floatVector &gradChi,
                                      floatVector &overlap );
 
+    void computeParticleOverlap( const floatVector &Xi_1, const floatVector &dX, const floatType &R_nl,
+                                     const floatVector &F,    const floatVector &chi,  const floatVector &chi_nl_basis, const floatVector &gradChi,
+                                     floatVector &X, floatVector &overlap );
+
     void computeParticleOverlap( const floatVector &Xi_1, const floatVector &dX, const floatType &R_nl,
                                      const floatVector &F,    const floatVector &chi, const floatVector &chi_nl_basis, const floatVector &gradChi,
                                      floatVector &overlap,
@@ -245,6 +349,10 @@ namespace tractionSeparation{
                                            const floatVector &F,    const floatVector &chi,  const floatVector &chi_nl,
                                            floatVector &overlap );
 
+    void computeParticleOverlapChi_nl( const floatVector &Xi_1, const floatVector &dX, const floatType &R_nl,
+                                           const floatVector &F,    const floatVector &chi,  const floatVector &chi_nl,
+                                           floatVector &X, floatVector &overlap );
+
     void computeParticleOverlapChi_nl( const floatVector &Xi_1, const floatVector &dX, const floatType &R_nl,
                                            const floatVector &F,    const floatVector &chi,  const floatVector &chi_nl,
                                            floatVector &overlap,
@@ -337,11 +445,20 @@ namespace tractionSeparation{
                                    const floatType tolr = 1e-9, const floatType tola = 1e-9, const unsigned int max_iteration = 20,
                                    const unsigned int max_ls = 5, const floatType alpha_ls = 1e-4 );
 
+    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &X, floatVector &d,
+                                   const floatType tolr = 1e-9, const floatType tola = 1e-9, const unsigned int max_iteration = 20,
+                                   const unsigned int max_ls = 5, const floatType alpha_ls = 1e-4 );
+
     void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &d,
                                    floatMatrix &dddchi_nl, floatMatrix &dddxi_t, floatVector &dddR_nl,
                                    const floatType tolr = 1e-9, const floatType tola = 1e-9, const unsigned int max_iteration = 20,
                                    const unsigned int max_ls = 5, const floatType alpha_ls = 1e-4 );
 
+    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &X, floatVector &d,
+                                   floatMatrix &dddchi_nl, floatMatrix &dddxi_t, floatVector &dddR_nl,
+                                   const floatType tolr = 1e-9, const floatType tola = 1e-9, const unsigned int max_iteration = 20,
+                                   const unsigned int max_ls = 5, const floatType alpha_ls = 1e-4 );
+
     void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &d,
                                    floatMatrix &dddchi_nl, floatMatrix &dddxi_t, floatVector &dddR_nl,
                                    floatMatrix &d2ddchi_nldchi_nl, floatMatrix &d2ddchi_nldxi_t, floatMatrix &d2ddchi_nldR_nl,
@@ -350,6 +467,14 @@ namespace tractionSeparation{
                                    const floatType tolr = 1e-9, const floatType tola = 1e-9, const unsigned int max_iteration = 20,
                                    const unsigned int max_ls = 5, const floatType alpha_ls = 1e-4 );
 
+    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &X, floatVector &d,
+                                   floatMatrix &dddchi_nl, floatMatrix &dddxi_t, floatVector &dddR_nl,
+                                   floatMatrix &d2ddchi_nldchi_nl, floatMatrix &d2ddchi_nldxi_t, floatMatrix &d2ddchi_nldR_nl,
+                                   floatMatrix &d2ddxi_tdxi_t, floatMatrix &d2ddxi_tdR_nl,
+                                   floatVector &d2ddR_nldR_nl,
+                                   const floatType tolr = 1e-9, const floatType tola = 1e-9, const unsigned int max_iteration = 20,
+                                   const unsigned int max_ls = 5, const floatType alpha_ls = 1e-4 );
+
     void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &d,
                                    floatMatrix &dddchi_nl, floatMatrix &dddxi_t, floatVector &dddR_nl,
                                    floatMatrix &d2ddchi_nldchi_nl, floatMatrix &d2ddchi_nldxi_t, floatMatrix &d2ddchi_nldR_nl,
@@ -364,6 +489,129 @@ namespace tractionSeparation{
                                    const floatType tolr = 1e-9, const floatType tola = 1e-9, const unsigned int max_iteration = 20,
                                    const unsigned int max_ls = 5, const floatType alpha_ls = 1e-4 );
 
+    void solveOverlapDistance( const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl, floatVector &X, floatVector &d,
+                                   floatMatrix &dddchi_nl, floatMatrix &dddxi_t, floatVector &dddR_nl,
+                                   floatMatrix &d2ddchi_nldchi_nl, floatMatrix &d2ddchi_nldxi_t, floatMatrix &d2ddchi_nldR_nl,
+                                   floatMatrix &d2ddxi_tdxi_t, floatMatrix &d2ddxi_tdR_nl,
+                                   floatVector &d2ddR_nldR_nl,
+                                   floatMatrix &d3ddchi_nldchi_nldchi_nl, floatMatrix &d3ddchi_nldchi_nldxi_t, floatMatrix &d3ddchi_nldchi_nldR_nl,
+                                   floatMatrix &d3ddchi_nldxi_tdxi_t, floatMatrix &d3ddchi_nldxi_tdR_nl,
+                                   floatMatrix &d3ddchi_nldR_nldR_nl,
+                                   floatMatrix &d3ddxi_tdxi_tdxi_t, floatMatrix &d3ddxi_tdxi_tdR_nl,
+                                   floatMatrix &d3ddxi_tdR_nldR_nl,
+                                   floatVector &d3ddR_nldR_nldR_nl,
+                                   const floatType tolr = 1e-9, const floatType tola = 1e-9, const unsigned int max_iteration = 20,
+                                   const unsigned int max_ls = 5, const floatType alpha_ls = 1e-4 );
+
+    void solveOverlapDistanceBatch( const unsigned int &numPoints, const floatVector &chi_nl, const floatVector &xi_t, const floatType &R_nl,
+                                        floatVector &X, floatVector &d,
+                                        const floatType tolr = 1e-9, const floatType tola = 1e-9, const unsigned int max_iteration = 20,
+                                        const unsigned int max_ls = 5, const floatType alpha_ls = 1e-4 );
+
+    bool isOffloadEnabled( );
+
+    class adhesionPairBatch{
+        /*!
+         * A batch of the (local surface point, non-local particle) pairs of a local particle whose linear traction
+         * separation responses are evaluated in a single kernel. The current distance, its decomposition, the traction,
+         * the energy, and the first derivatives of the weighted energy are fused so that each pair is visited once.
+         *
+         * The pairs are stored as structures of arrays so that component I of pair p is stored at [ numPairs * I + p ].
+         * When the library is compiled with ASP_OPENMP_OFFLOAD the kernel is evaluated on the default OpenMP target
+         * device. The reference pair data are copied to the device once when they are set and remain resident, as do the
+         * buffers of the per-increment inputs and the outputs, so that an evaluation only copies the current non-local
+         * micro-deformations and normals to the device and the results back. Otherwise the kernel is evaluated on the
+         * host by the requested number of OpenMP threads.
+         *
+         * Only the adhesion responses are offloaded. The overlap solves (computeParticleOverlap and solveOverlapDistance)
+         * are iterative with a line search and per-point convergence checks and are evaluated on the host.
+         */
+
+        public:
+
+            static constexpr unsigned int dim = 3; //!< The spatial dimension of the pairs
+
+            adhesionPairBatch( ) = default;
+
+            adhesionPairBatch( const adhesionPairBatch &other ) = delete;
+
+            adhesionPairBatch &operator=( const adhesionPairBatch &other ) = delete;
+
+            ~adhesionPairBatch( );
+
+            void setReferencePairs( const unsigned int &numPairs, const floatVector &Xi_1, const floatVector &Xi_2,
+                                    const floatVector &D, const floatVector &weights );
+
+            void evaluate( const floatVector &F, const floatVector &chi, const floatVector &chiNL, const floatVector &normals,
+                           const floatVector &parameters, const unsigned int numThreads = 1 );
+
+            //! Get the number of pairs in the batch
+            unsigned int getNumPairs( ) const{ return _numPairs; }
+
+            //! Get the number of times the reference pair data have been copied to the device
+            unsigned long long getReferenceUploads( ) const{ return _referenceUploads; }
+
+            //! Get the tractions of the pairs
+            const floatVector &getTractions( ) const{ return _tractions; }
+
+            //! Get the energies of the pairs
+            const floatVector &getEnergies( ) const{ return _energies; }
+
+            //! Get the sum of the weighted energies of the pairs
+            floatType getEnergy( ) const{ return _energy; }
+
+            //! Get the gradient of the weighted energy w.r.t. the deformation gradient
+            const floatVector &getdEnergydF( ) const{ return _dEnergydF; }
+
+            //! Get the gradient of the weighted energy w.r.t. the local micro-deformation
+            const floatVector &getdEnergydChi( ) const{ return _dEnergydChi; }
+
+            //! Get the gradients of the weighted energy w.r.t. the non-local micro-deformation of each pair
+            const floatVector &getdEnergydChiNL( ) const{ return _dEnergydChiNL; }
+
+            //! Get the gradients of the weighted energy w.r.t. the current normal of each pair
+            const floatVector &getdEnergydNormals( ) const{ return _dEnergydNormals; }
+
+        private:
+
+            void allocate( const unsigned int &numPairs );
+
+            void release( );
+
+            unsigned int _numPairs = 0; //!< The number of pairs
+
+            bool _mapped = false; //!< Flag for whether the buffers are mapped to the device
+
+            unsigned long long _referenceUploads = 0; //!< The number of copies of the reference pair data to the device
+
+            floatVector _Xi_1; //!< The reference relative positions of the local surface points
+
+            floatVector _Xi_2; //!< The reference relative positions of the non-local surface points
+
+            floatVector _D; //!< The reference distances between the particle centers
+
+            floatVector _weights; //!< The weights of the pairs e.g. the surface quadrature weights
+
+            floatVector _chiNL; //!< The current non-local micro-deformations
+
+            floatVector _normals; //!< The current normals of the local surface points
+
+            floatVector _tractions; //!< The tractions of the pairs
+
+            floatVector _energies; //!< The energies of the pairs
+
+            floatVector _dEnergydChiNL; //!< The gradients of the weighted energy w.r.t. the non-local micro-deformations
+
+            floatVector _dEnergydNormals; //!< The gradients of the weighted energy w.r.t. the current normals
+
+            floatType _energy = 0; //!< The sum of the weighted energies
+
+            floatVector _dEnergydF; //!< The gradient of the weighted energy w.r.t. the deformation gradient
+
+            floatVector _dEnergydChi; //!< The gradient of the weighted energy w.r.t. the local micro-deformation
+
+    };
+
 }
 
 #endif